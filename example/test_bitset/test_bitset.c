@@ -0,0 +1,291 @@
+/*
+
+    ********** DO NOT REMOVE THIS INFORMATION ************
+
+    ACR - A set of C functions in a git Repository
+    Copyright (C) 2018 - 2020 Adam C. Rosenberg
+
+    Please read LICENSE before using this code
+
+    Please read README.md for instructions on including
+    this code in your project and where to find examples
+
+    If you contribute to this code, Please add your name
+    and email address to the AUTHORS list below so that
+    we know who to thank!
+
+    AUTHORS
+
+    Adam Rosenberg <adam@sirspot.com>
+
+    LICENSE
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+    ******************************************************
+
+*/
+/** \file test_bitset.c
+
+    application to test bitset struct, macros, and functions
+
+*/
+#include "ACR/bitset.h"
+
+//
+// PROTOTYPES
+//
+
+/** simple example to use a bitset on the stack
+*/
+int StackTest(void);
+
+/** simple example to use a bitset on the heap
+*/
+int HeapTest(void);
+
+/** example to combine bitsets with logic operations
+*/
+int LogicTest(void);
+
+/** example to find set bits using find next, rank, and select
+*/
+int RankSelectTest(void);
+
+//
+// MAIN
+//
+
+int main(int argc, char** argv)
+{
+	int result = ACR_SUCCESS;
+
+	ACR_UNUSED(argc);
+	ACR_UNUSED(argv);
+
+	result |= StackTest();
+	result |= HeapTest();
+
+	result |= LogicTest();
+	result |= RankSelectTest();
+
+	return result;
+}
+
+//
+// IMPLEMENTATION
+//
+
+/**********************************************************/
+int StackTest(void)
+{
+	int result = ACR_SUCCESS;
+	ACR_Bitset_t bitset;
+
+	ACR_BitsetInit(&bitset);
+	if(ACR_BitsetAllocate(&bitset, 5000) == ACR_INFO_OK)
+	{
+		//
+		// OK - 5000 bits ready for use
+		//
+
+		ACR_BitsetSet(&bitset, 4999);
+		if(ACR_BitsetTest(&bitset, 4999) != ACR_INFO_TRUE)
+		{
+			result = ACR_FAILURE;
+		}
+	}
+	else
+	{
+		// failed to allocate 5000 bits
+		result = ACR_FAILURE;
+	}
+	ACR_BitsetDeInit(&bitset);
+
+	return result;
+}
+
+/**********************************************************/
+int HeapTest(void)
+{
+	int result = ACR_SUCCESS;
+	ACR_Bitset_t* bitsetPtr;
+
+	ACR_BitsetNew(&bitsetPtr);
+	if(ACR_BitsetAllocate(bitsetPtr, 5000) == ACR_INFO_OK)
+	{
+		//
+		// OK - 5000 bits ready for use
+		//
+
+		ACR_BitsetSetAll(bitsetPtr);
+		if(ACR_BitsetCount(bitsetPtr) != 5000)
+		{
+			result = ACR_FAILURE;
+		}
+	}
+	else
+	{
+		// failed to allocate 5000 bits
+		result = ACR_FAILURE;
+	}
+	ACR_BitsetDelete(&bitsetPtr);
+
+	return result;
+}
+
+/**********************************************************/
+int LogicTest(void)
+{
+	int result = ACR_SUCCESS;
+	ACR_Bitset_t evens;
+	ACR_Bitset_t threes;
+	ACR_Length_t bitCount = 1000;
+	ACR_Length_t i;
+
+	ACR_BitsetInit(&evens);
+	ACR_BitsetInit(&threes);
+	ACR_BitsetAllocate(&evens, bitCount);
+	ACR_BitsetAllocate(&threes, bitCount);
+	for(i = 0; i < bitCount; i++)
+	{
+		if((i % 2) == 0)
+		{
+			ACR_BitsetSet(&evens, i);
+		}
+		if((i % 3) == 0)
+		{
+			ACR_BitsetSet(&threes, i);
+		}
+	}
+
+	// multiples of 6
+	ACR_BitsetAnd(&evens, &threes);
+	if(ACR_BitsetCount(&evens) != 167)
+	{
+		ACR_DEBUG_PRINT(1, "FAIL AND found %d bits", (int)ACR_BitsetCount(&evens));
+		result = ACR_FAILURE;
+	}
+
+	// multiples of 3 that are not multiples of 6
+	ACR_BitsetXor(&evens, &threes);
+	if(ACR_BitsetCount(&evens) != 167)
+	{
+		ACR_DEBUG_PRINT(2, "FAIL XOR found %d bits", (int)ACR_BitsetCount(&evens));
+		result = ACR_FAILURE;
+	}
+
+	// nothing is left after removing all multiples of 3
+	ACR_BitsetAndNot(&evens, &threes);
+	if(ACR_BitsetCount(&evens) != 0)
+	{
+		ACR_DEBUG_PRINT(3, "FAIL ANDNOT found %d bits", (int)ACR_BitsetCount(&evens));
+		result = ACR_FAILURE;
+	}
+
+	ACR_BitsetOr(&evens, &threes);
+	if(ACR_BitsetCount(&evens) != 334)
+	{
+		ACR_DEBUG_PRINT(4, "FAIL OR found %d bits", (int)ACR_BitsetCount(&evens));
+		result = ACR_FAILURE;
+	}
+
+	if(result == ACR_SUCCESS)
+	{
+		ACR_DEBUG_PRINT(5, "PASS logic operations");
+	}
+
+	ACR_BitsetDeInit(&evens);
+	ACR_BitsetDeInit(&threes);
+
+	return result;
+}
+
+/**********************************************************/
+int RankSelectTest(void)
+{
+	int result = ACR_SUCCESS;
+	ACR_Bitset_t bitset;
+	ACR_Length_t bitCount = 100000;
+	ACR_Length_t bit;
+	ACR_Length_t found;
+	ACR_Length_t n;
+
+	ACR_BitsetInit(&bitset);
+	if(ACR_BitsetAllocate(&bitset, bitCount) != ACR_INFO_OK)
+	{
+		return ACR_FAILURE;
+	}
+
+	// every 7th bit is set. the macros are used without braces
+	// to make sure they work as a single statement
+	for(bit = 0; bit < bitCount; bit++)
+	{
+		if((bit % 7) == 0)
+			ACR_BITSET_SET(bitset, bit);
+		else
+			ACR_BITSET_CLEAR(bitset, bit);
+	}
+
+	// walk all set bits
+	n = 0;
+	bit = 0;
+	while(ACR_BitsetFindNext(&bitset, bit, &bit) == ACR_INFO_OK)
+	{
+		if(bit != (n * 7))
+		{
+			ACR_DEBUG_PRINT(6, "FAIL find next found bit %d", (int)bit);
+			result = ACR_FAILURE;
+			break;
+		}
+		n++;
+		bit++;
+	}
+
+	// compare with and without the rank index
+	ACR_BitsetBuildRankIndex(&bitset);
+	for(bit = 0; bit < bitCount; bit += 13)
+	{
+		if(ACR_BitsetRank(&bitset, bit) != ((bit + 6) / 7))
+		{
+			ACR_DEBUG_PRINT(7, "FAIL rank of bit %d", (int)bit);
+			result = ACR_FAILURE;
+			break;
+		}
+	}
+	for(n = 0; n < (bitCount / 7); n += 11)
+	{
+		if((ACR_BitsetSelect(&bitset, n, &found) != ACR_INFO_OK) || (found != (n * 7)))
+		{
+			ACR_DEBUG_PRINT(8, "FAIL select %d", (int)n);
+			result = ACR_FAILURE;
+			break;
+		}
+	}
+	if(ACR_BitsetSelect(&bitset, ACR_BitsetCount(&bitset), &found) != ACR_INFO_ERROR)
+	{
+		ACR_DEBUG_PRINT(9, "FAIL select past the last set bit");
+		result = ACR_FAILURE;
+	}
+
+	if(result == ACR_SUCCESS)
+	{
+		ACR_DEBUG_PRINT(10, "PASS rank and select with %d bits set", (int)ACR_BitsetCount(&bitset));
+	}
+
+	ACR_BitsetDeInit(&bitset);
+
+	return result;
+}
@@ -65,6 +65,31 @@ int LowLevelTest(void);
 */
 int VerboseTest(void);
 
+/** example to walk a buffer one block at a time
+    by summing all of the bytes in the buffer
+*/
+int BlockTest(void);
+
+/** example to copy and fill a buffer that is larger
+    than ACR_BUFFER_STREAMING_THRESHOLD
+*/
+int StreamingTest(void);
+
+/** compare the speed of normal and streaming copies and how
+    much each one slows down work that uses data in the cache
+*/
+int StreamingBenchmark(void);
+
+/** example to copy, fill, compare, and check a buffer
+    using several threads
+*/
+int ParallelTest(void);
+
+/** measure how the speed of the parallel functions
+    changes with the number of threads
+*/
+int ParallelBenchmark(void);
+
 //
 // MAIN
 //
@@ -82,6 +107,14 @@ int main(int argc, char** argv)
 
 	result |= VerboseTest();
 
+	result |= BlockTest();
+
+	result |= StreamingTest();
+	result |= StreamingBenchmark();
+
+	result |= ParallelTest();
+	result |= ParallelBenchmark();
+
 	return result;
 }
 
@@ -212,3 +245,414 @@ int VerboseTest(void)
 
 	return ACR_SUCCESS;
 }
+
+/**********************************************************/
+static ACR_Info_t BlockTestSumBytes(
+	void* context,
+	ACR_Byte_t* bytes,
+	ACR_Length_t length)
+{
+	ACR_Length_t* sum = (ACR_Length_t*)context;
+	while(length > 0)
+	{
+		(*sum) += (*bytes);
+		bytes++;
+		length--;
+	}
+	return ACR_INFO_OK;
+}
+
+/**********************************************************/
+static ACR_Info_t BlockTestSumBlocks(
+	void* context,
+	ACR_Block_t* blocks,
+	ACR_Length_t count)
+{
+	return BlockTestSumBytes(context, (ACR_Byte_t*)blocks, count * ACR_BYTES_PER_BLOCK);
+}
+
+/**********************************************************/
+int BlockTest(void)
+{
+	ACR_BUFFER(buffer);
+	ACR_Buffer_t offsetBuffer;
+	ACR_Length_t expectedSum = 0;
+	ACR_Length_t sum;
+	ACR_Length_t offset;
+	ACR_Length_t i;
+
+	ACR_BUFFER_ALLOC(buffer, 5000);
+	if(ACR_BUFFER_IS_VALID(buffer) == ACR_BOOL_FALSE)
+	{
+		// cannot allocate 5000 bytes
+		return ACR_FAILURE;
+	}
+
+	for(i = 0; i < buffer.m_Length; i++)
+	{
+		((ACR_Byte_t*)buffer.m_Pointer)[i] = (ACR_Byte_t)i;
+	}
+
+	// start at each possible offset from the block
+	// alignment so that every head and tail length is used
+	for(offset = 0; offset < ACR_BYTES_PER_BLOCK; offset++)
+	{
+		ACR_BufferInit(&offsetBuffer);
+		ACR_BufferRef(&offsetBuffer, ((ACR_Byte_t*)buffer.m_Pointer) + offset, buffer.m_Length - offset - 1);
+		expectedSum = 0;
+		BlockTestSumBytes(&expectedSum, (ACR_Byte_t*)offsetBuffer.m_Pointer, offsetBuffer.m_Length);
+		sum = 0;
+		if(ACR_BufferForEachBlock(&offsetBuffer, BlockTestSumBytes, BlockTestSumBlocks, &sum, 0, ACR_BUFFER_PREFETCH_DISTANCE) != ACR_INFO_OK)
+		{
+			ACR_DEBUG_PRINT(9, "FAIL ACR_BufferForEachBlock did not walk the buffer");
+			ACR_BUFFER_FREE(buffer);
+			return ACR_FAILURE;
+		}
+		if(sum != expectedSum)
+		{
+			ACR_DEBUG_PRINT(10, "FAIL sum of blocks at offset %d is %d instead of %d", (int)offset, (int)sum, (int)expectedSum);
+			ACR_BUFFER_FREE(buffer);
+			return ACR_FAILURE;
+		}
+		ACR_BufferDeInit(&offsetBuffer);
+	}
+	ACR_DEBUG_PRINT(11, "PASS sum of blocks is %d", (int)expectedSum);
+
+	ACR_BUFFER_FREE(buffer);
+
+	return ACR_SUCCESS;
+}
+
+/**********************************************************/
+int StreamingTest(void)
+{
+	int result = ACR_SUCCESS;
+	ACR_Buffer_t src;
+	ACR_Buffer_t dst;
+	ACR_Buffer_t offsetSrc;
+	ACR_Buffer_t invalid;
+	ACR_Length_t length = ACR_BUFFER_STREAMING_THRESHOLD + 100;
+	ACR_Length_t i;
+	ACR_Byte_t* bytes;
+
+	ACR_BufferInit(&src);
+	ACR_BufferInit(&dst);
+	ACR_BufferInit(&offsetSrc);
+	if((ACR_BufferAllocate(&src, length) != ACR_INFO_OK) ||
+	   (ACR_BufferAllocate(&dst, length) != ACR_INFO_OK))
+	{
+		// failed to allocate memory
+		ACR_BufferDeInit(&src);
+		ACR_BufferDeInit(&dst);
+		return ACR_FAILURE;
+	}
+
+	bytes = (ACR_Byte_t*)src.m_Pointer;
+	for(i = 0; i < length; i++)
+	{
+		bytes[i] = (ACR_Byte_t)(i * 7);
+	}
+
+	// start from an odd offset so the head and tail are used
+	ACR_BufferRef(&offsetSrc, bytes + 3, length - 3);
+	ACR_BufferFillStreaming(&dst, 0xAA);
+	if(ACR_BufferCopyStreaming(&dst, &offsetSrc) != ACR_INFO_OK)
+	{
+		ACR_DEBUG_PRINT(1, "FAIL ACR_BufferCopyStreaming");
+		result = ACR_FAILURE;
+	}
+	else
+	{
+		ACR_Byte_t* copied = (ACR_Byte_t*)dst.m_Pointer;
+		if((memcmp(copied, bytes + 3, (size_t)(length - 3)) != 0) ||
+		   (copied[length - 3] != 0xAA) || (copied[length - 1] != 0xAA))
+		{
+			ACR_DEBUG_PRINT(2, "FAIL streaming copy does not match");
+			result = ACR_FAILURE;
+		}
+	}
+
+	// too small
+	if(ACR_BufferCopyStreaming(&offsetSrc, &dst) != ACR_INFO_ERROR)
+	{
+		ACR_DEBUG_PRINT(3, "FAIL ACR_BufferCopyStreaming copied into a smaller buffer");
+		result = ACR_FAILURE;
+	}
+
+	ACR_BufferFillStreaming(&offsetSrc, 0x55);
+	for(i = 3; i < length; i++)
+	{
+		if(bytes[i] != 0x55)
+		{
+			ACR_DEBUG_PRINT(4, "FAIL streaming fill at %d", (int)i);
+			result = ACR_FAILURE;
+			break;
+		}
+	}
+	if(bytes[2] != 14)
+	{
+		ACR_DEBUG_PRINT(5, "FAIL streaming fill before the buffer");
+		result = ACR_FAILURE;
+	}
+
+	// a destination without memory is not valid even with a length
+	ACR_BufferInit(&invalid);
+	invalid.m_Length = length;
+	if(ACR_BufferCopyStreaming(&invalid, &src) != ACR_INFO_ERROR)
+	{
+		ACR_DEBUG_PRINT(6, "FAIL ACR_BufferCopyStreaming copied into an invalid buffer");
+		result = ACR_FAILURE;
+	}
+
+	ACR_BufferDeInit(&offsetSrc);
+	ACR_BufferDeInit(&src);
+	ACR_BufferDeInit(&dst);
+
+	return result;
+}
+
+/**********************************************************/
+static ACR_Block_t StreamingBenchmarkHotWork(
+	ACR_Block_t* hot,
+	ACR_Length_t count)
+{
+	// sum the hot data, which is small enough to stay
+	// in the cache unless something else evicts it
+	ACR_Block_t sum = 0;
+	ACR_Length_t i;
+	for(i = 0; i < count; i++)
+	{
+		sum += hot[i];
+	}
+	return sum;
+}
+
+/**********************************************************/
+int StreamingBenchmark(void)
+{
+	ACR_Buffer_t src;
+	ACR_Buffer_t dst;
+	ACR_Buffer_t hot;
+	ACR_Length_t length = ACR_BUFFER_STREAMING_THRESHOLD * 8;
+	ACR_Length_t hotCount = (256 * 1024) / ACR_BYTES_PER_BLOCK;
+	ACR_Block_t sum = 0;
+	double start;
+	double copyTime[2] = {0, 0};
+	double fillTime[2] = {0, 0};
+	double hotTime[2] = {0, 0};
+	int repeat;
+	int streaming;
+
+	ACR_BufferInit(&src);
+	ACR_BufferInit(&dst);
+	ACR_BufferInit(&hot);
+	if((ACR_BufferAllocate(&src, length) != ACR_INFO_OK) ||
+	   (ACR_BufferAllocate(&dst, length) != ACR_INFO_OK) ||
+	   (ACR_BufferAllocate(&hot, hotCount * ACR_BYTES_PER_BLOCK) != ACR_INFO_OK))
+	{
+		// not enough memory to run the benchmark
+		ACR_BufferDeInit(&src);
+		ACR_BufferDeInit(&dst);
+		ACR_BufferDeInit(&hot);
+		return ACR_SUCCESS;
+	}
+	ACR_BufferClear(&src);
+	ACR_BufferClear(&dst);
+	ACR_BufferClear(&hot);
+
+	for(repeat = 0; repeat < 4; repeat++)
+	{
+		for(streaming = 0; streaming < 2; streaming++)
+		{
+			// time the copy and fill
+			start = ACR_TimerSeconds();
+			if(streaming)
+			{
+				ACR_BufferCopyStreaming(&dst, &src);
+			}
+			else
+			{
+				memcpy(dst.m_Pointer, src.m_Pointer, (size_t)length);
+			}
+			copyTime[streaming] += ACR_TimerSeconds() - start;
+
+			// the hot data is in the cache after this
+			sum += StreamingBenchmarkHotWork((ACR_Block_t*)hot.m_Pointer, hotCount);
+
+			start = ACR_TimerSeconds();
+			if(streaming)
+			{
+				ACR_BufferFillStreaming(&dst, (ACR_Byte_t)repeat);
+			}
+			else
+			{
+				ACR_MEMSET(dst.m_Pointer, repeat, (size_t)length);
+			}
+			fillTime[streaming] += ACR_TimerSeconds() - start;
+
+			// time the hot work to see how much of
+			// the hot data is still in the cache
+			start = ACR_TimerSeconds();
+			sum += StreamingBenchmarkHotWork((ACR_Block_t*)hot.m_Pointer, hotCount);
+			hotTime[streaming] += ACR_TimerSeconds() - start;
+		}
+	}
+
+	if((copyTime[0] > 0) && (copyTime[1] > 0) && (fillTime[0] > 0) && (fillTime[1] > 0))
+	{
+		double megabytes = (4.0 * (double)length) / (1024.0 * 1024.0);
+		ACR_UNUSED(megabytes);
+		ACR_DEBUG_PRINT(1, "BENCHMARK copy   normal %.0f MB/s streaming %.0f MB/s", megabytes / copyTime[0], megabytes / copyTime[1]);
+		ACR_DEBUG_PRINT(2, "BENCHMARK fill   normal %.0f MB/s streaming %.0f MB/s", megabytes / fillTime[0], megabytes / fillTime[1]);
+		ACR_DEBUG_PRINT(3, "BENCHMARK hot work after normal %.1f us after streaming %.1f us", hotTime[0] * 250000.0, hotTime[1] * 250000.0);
+	}
+	ACR_DEBUG_PRINT(4, "BENCHMARK hot sum %d", (int)sum);
+
+	ACR_BufferDeInit(&src);
+	ACR_BufferDeInit(&dst);
+	ACR_BufferDeInit(&hot);
+
+	return ACR_SUCCESS;
+}
+
+/**********************************************************/
+int ParallelTest(void)
+{
+	int result = ACR_SUCCESS;
+	ACR_Buffer_t src;
+	ACR_Buffer_t dst;
+	ACR_Buffer_t check;
+	ACR_Length_t length = ACR_BUFFER_PARALLEL_THRESHOLD + 12345;
+	ACR_Length_t i;
+	ACR_Byte_t* bytes;
+	ACR_Crc32_t crc;
+	ACR_Crc32_t singleCrc;
+	char text[] = "123456789";
+
+	// the standard CRC-32 check value
+	ACR_BufferInit(&check);
+	ACR_BufferRef(&check, text, 9);
+	if((ACR_BufferCrc32Parallel(&check, 0, &crc) != ACR_INFO_OK) || (crc != 0xCBF43926UL))
+	{
+		ACR_DEBUG_PRINT(1, "FAIL CRC-32 of 123456789 is %lx", (unsigned long)crc);
+		result = ACR_FAILURE;
+	}
+	ACR_BufferDeInit(&check);
+
+	ACR_BufferInit(&src);
+	ACR_BufferInit(&dst);
+	if((ACR_BufferAllocate(&src, length) != ACR_INFO_OK) ||
+	   (ACR_BufferAllocate(&dst, length) != ACR_INFO_OK))
+	{
+		// failed to allocate memory
+		ACR_BufferDeInit(&src);
+		ACR_BufferDeInit(&dst);
+		return ACR_FAILURE;
+	}
+
+	bytes = (ACR_Byte_t*)src.m_Pointer;
+	for(i = 0; i < length; i++)
+	{
+		bytes[i] = (ACR_Byte_t)((i * 31) + (i >> 13));
+	}
+
+	ACR_BufferFillParallel(&dst, 0, 3);
+	if(ACR_BufferCompareParallel(&dst, &src, 3) == ACR_INFO_EQUAL)
+	{
+		ACR_DEBUG_PRINT(2, "FAIL compare after fill");
+		result = ACR_FAILURE;
+	}
+
+	if((ACR_BufferCopyParallel(&dst, &src, 3) != ACR_INFO_OK) ||
+	   (memcmp(dst.m_Pointer, src.m_Pointer, (size_t)length) != 0) ||
+	   (ACR_BufferCompareParallel(&dst, &src, 0) != ACR_INFO_EQUAL))
+	{
+		ACR_DEBUG_PRINT(3, "FAIL parallel copy");
+		result = ACR_FAILURE;
+	}
+
+	// a difference near the end
+	((ACR_Byte_t*)dst.m_Pointer)[length - 10] = (ACR_Byte_t)(bytes[length - 10] + 1);
+	if(ACR_BufferCompareParallel(&src, &dst, 0) != ACR_INFO_LESS)
+	{
+		ACR_DEBUG_PRINT(4, "FAIL parallel compare");
+		result = ACR_FAILURE;
+	}
+
+	// every thread count gives the same CRC-32
+	ACR_BufferCrc32Parallel(&src, 1, &singleCrc);
+	for(i = 2; i <= ACR_BUFFER_MAX_THREADS; i++)
+	{
+		ACR_BufferCrc32Parallel(&src, (ACR_Count_t)i, &crc);
+		if(crc != singleCrc)
+		{
+			ACR_DEBUG_PRINT(5, "FAIL CRC-32 with %d threads is %lx instead of %lx", (int)i, (unsigned long)crc, (unsigned long)singleCrc);
+			result = ACR_FAILURE;
+		}
+	}
+
+	ACR_BufferDeInit(&src);
+	ACR_BufferDeInit(&dst);
+
+	return result;
+}
+
+/**********************************************************/
+int ParallelBenchmark(void)
+{
+	ACR_Buffer_t src;
+	ACR_Buffer_t dst;
+	ACR_Length_t length = ACR_BUFFER_PARALLEL_THRESHOLD * 4;
+	ACR_Count_t threadCount;
+	ACR_Crc32_t crc;
+	double megabytes = ((double)length) / (1024.0 * 1024.0);
+	double start;
+	double copyTime;
+	double fillTime;
+	double compareTime;
+	double crcTime;
+
+	ACR_BufferInit(&src);
+	ACR_BufferInit(&dst);
+	if((ACR_BufferAllocate(&src, length) != ACR_INFO_OK) ||
+	   (ACR_BufferAllocate(&dst, length) != ACR_INFO_OK))
+	{
+		// not enough memory to run the benchmark
+		ACR_BufferDeInit(&src);
+		ACR_BufferDeInit(&dst);
+		return ACR_SUCCESS;
+	}
+	ACR_BufferClear(&src);
+	ACR_BufferClear(&dst);
+
+	ACR_UNUSED(megabytes);
+	for(threadCount = 1; threadCount <= ACR_BUFFER_MAX_THREADS; threadCount *= 2)
+	{
+		start = ACR_TimerSeconds();
+		ACR_BufferCopyParallel(&dst, &src, threadCount);
+		copyTime = ACR_TimerSeconds() - start;
+
+		start = ACR_TimerSeconds();
+		ACR_BufferFillParallel(&dst, 0, threadCount);
+		fillTime = ACR_TimerSeconds() - start;
+
+		start = ACR_TimerSeconds();
+		ACR_BufferCompareParallel(&dst, &src, threadCount);
+		compareTime = ACR_TimerSeconds() - start;
+
+		start = ACR_TimerSeconds();
+		ACR_BufferCrc32Parallel(&src, threadCount, &crc);
+		crcTime = ACR_TimerSeconds() - start;
+
+		if((copyTime > 0) && (fillTime > 0) && (compareTime > 0) && (crcTime > 0))
+		{
+			ACR_DEBUG_PRINT(1, "BENCHMARK %d threads MB/s copy %.0f fill %.0f compare %.0f crc32 %.0f", (int)threadCount,
+				megabytes / copyTime, megabytes / fillTime, megabytes / compareTime, megabytes / crcTime);
+		}
+	}
+
+	ACR_BufferDeInit(&src);
+	ACR_BufferDeInit(&dst);
+
+	return ACR_SUCCESS;
+}
@@ -0,0 +1,657 @@
+/*
+
+    ********** DO NOT REMOVE THIS INFORMATION ************
+
+    ACR - A set of C functions in a git Repository
+    Copyright (C) 2018 - 2020 Adam C. Rosenberg
+
+    Please read LICENSE before using this code
+
+    Please read README.md for instructions on including
+    this code in your project and where to find examples
+
+    If you contribute to this code, Please add your name
+    and email address to the AUTHORS list below so that
+    we know who to thank!
+
+    AUTHORS
+
+    Adam Rosenberg <adam@sirspot.com>
+
+    LICENSE
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+    ******************************************************
+
+*/
+/** \file test_concurrentmap.c
+
+    application to test the concurrent hash map
+
+*/
+#include "ACR/concurrentmap.h"
+#include "ACR/hashmap.h"
+
+#include <stdio.h>
+// included for memset()
+#include <string.h>
+
+// the threaded tests start threads with the native thread
+// functions when they are available
+#ifndef ACR_NO_THREADS
+#if defined(_WIN32)
+// included for CreateThread()
+#include <windows.h>
+#define TEST_HAS_THREADS ACR_BOOL_TRUE
+#define TEST_THREAD_FUNC DWORD WINAPI
+#define TEST_THREAD_RETURN 0
+typedef HANDLE TestThread_t;
+typedef SRWLOCK TestLock_t;
+#define TEST_LOCK_INIT(lock) InitializeSRWLock(&(lock));
+#define TEST_LOCK_DEINIT(lock)
+#define TEST_LOCK(lock) AcquireSRWLockExclusive(&(lock));
+#define TEST_UNLOCK(lock) ReleaseSRWLockExclusive(&(lock));
+#elif defined(ACR_COMPILER_GCC) || defined(ACR_COMPILER_CLANG) || defined(ACR_COMPILER_MINGW)
+// included for pthread_create()
+#include <pthread.h>
+#define TEST_HAS_THREADS ACR_BOOL_TRUE
+#define TEST_THREAD_FUNC void*
+#define TEST_THREAD_RETURN ACR_NULL
+typedef pthread_t TestThread_t;
+typedef pthread_mutex_t TestLock_t;
+#define TEST_LOCK_INIT(lock) pthread_mutex_init(&(lock), ACR_NULL);
+#define TEST_LOCK_DEINIT(lock) pthread_mutex_destroy(&(lock));
+#define TEST_LOCK(lock) pthread_mutex_lock(&(lock));
+#define TEST_UNLOCK(lock) pthread_mutex_unlock(&(lock));
+#endif
+#endif // #ifndef ACR_NO_THREADS
+
+#ifndef TEST_HAS_THREADS
+#define TEST_HAS_THREADS ACR_BOOL_FALSE
+#endif
+
+// the number of different keys used by the tests
+#define TEST_KEY_COUNT 4000
+
+// the number of threads in the threaded test
+#define TEST_THREAD_COUNT 4
+
+// the number of operations of each thread in the benchmark
+#ifndef TEST_BENCHMARK_OPERATIONS
+#define TEST_BENCHMARK_OPERATIONS 200000
+#endif
+
+// the most threads in the benchmark
+#define TEST_BENCHMARK_MAX_THREADS 16
+
+//
+// PROTOTYPES
+//
+
+/** check adding, replacing, finding, and removing keys from
+    one thread
+*/
+int ConcurrentMapTest(void);
+
+/** check that threads that change and read the same keys at
+    the same time never see a value that is partly written
+*/
+int ConcurrentMapThreadTest(void);
+
+/** compare the speed of the concurrent map with a hash map
+    behind one lock for more and more threads
+*/
+int ConcurrentMapBenchmark(void);
+
+//
+// MAIN
+//
+
+int main(int argc, char** argv)
+{
+	int result = ACR_SUCCESS;
+
+	ACR_UNUSED(argc);
+	ACR_UNUSED(argv);
+
+	#if ACR_HAS_MALLOC == ACR_BOOL_TRUE
+	result |= ConcurrentMapTest();
+	result |= ConcurrentMapThreadTest();
+
+	result |= ConcurrentMapBenchmark();
+	#endif
+
+	return result;
+}
+
+//
+// IMPLEMENTATION
+//
+
+/** the text of the keys used by the tests
+*/
+static char g_TestKeys[TEST_KEY_COUNT][32];
+
+/** a value that shows if it was read while it was written
+*/
+typedef struct TestValue_s
+{
+	ACR_Length_t m_Key;
+	ACR_Length_t m_Version;
+	ACR_Length_t m_Check;
+} TestValue_t;
+
+/** fill in the keys that look like names from a program
+*/
+static void TestKeysFill(void)
+{
+	const char* prefixes[] = {"session.", "user:", "caf\xC3\xA9/", "k", "a.much.longer.prefix."};
+	int i;
+	for(i = 0; i < TEST_KEY_COUNT; i++)
+	{
+		sprintf(g_TestKeys[i], "%s%d", prefixes[i % 5], i);
+	}
+}
+
+/** get a key as a string
+*/
+static ACR_String_t TestKey(
+	int i)
+{
+	return ACR_StringFromMemory((ACR_Byte_t*)g_TestKeys[i], ACR_MAX_LENGTH, ACR_MAX_COUNT);
+}
+
+/** fill in a value for a key and a version
+*/
+static void TestValueSet(
+	TestValue_t* value,
+	int key,
+	ACR_Length_t version)
+{
+	value->m_Key = (ACR_Length_t)key;
+	value->m_Version = version;
+	value->m_Check = (value->m_Key * 2654435761UL) ^ version;
+}
+
+/** check that a value was not read while it was written
+*/
+static int TestValueCheck(
+	const TestValue_t* value,
+	int key)
+{
+	return (value->m_Key == (ACR_Length_t)key) && (value->m_Check == ((value->m_Key * 2654435761UL) ^ value->m_Version));
+}
+
+/**********************************************************/
+int ConcurrentMapTest(void)
+{
+	ACR_ConcurrentMap_t map;
+	TestValue_t value;
+	TestValue_t found;
+	ACR_String_t empty = ACR_StringFromMemory((ACR_Byte_t*)"", ACR_MAX_LENGTH, ACR_MAX_COUNT);
+	ACR_String_t large;
+	ACR_Byte_t* largeKey;
+	int i;
+
+	TestKeysFill();
+	if(ACR_ConcurrentMapInit(&map, sizeof(TestValue_t), 0) != ACR_INFO_OK)
+	{
+		ACR_DEBUG_PRINT(1, "FAIL map was not created");
+		return ACR_FAILURE;
+	}
+
+	for(i = 0; i < TEST_KEY_COUNT; i++)
+	{
+		TestValueSet(&value, i, 1);
+		if(ACR_ConcurrentMapAdd(&map, TestKey(i), &value) != ACR_INFO_NEW)
+		{
+			ACR_DEBUG_PRINT(2, "FAIL key %s was not added", g_TestKeys[i]);
+			ACR_ConcurrentMapDeInit(&map);
+			return ACR_FAILURE;
+		}
+	}
+
+	// adding again keeps the value and setting replaces it
+	for(i = 0; i < TEST_KEY_COUNT; i++)
+	{
+		TestValueSet(&value, i, 2);
+		if((ACR_ConcurrentMapAdd(&map, TestKey(i), &value) != ACR_INFO_OLD) ||
+		   (ACR_ConcurrentMapFind(&map, TestKey(i), &found) != ACR_INFO_OK) || (found.m_Version != 1) ||
+		   (ACR_ConcurrentMapSet(&map, TestKey(i), &value) != ACR_INFO_OLD) ||
+		   (ACR_ConcurrentMapFind(&map, TestKey(i), &found) != ACR_INFO_OK) || (found.m_Version != 2) || (TestValueCheck(&found, i) == 0))
+		{
+			ACR_DEBUG_PRINT(3, "FAIL key %s has the wrong value", g_TestKeys[i]);
+			ACR_ConcurrentMapDeInit(&map);
+			return ACR_FAILURE;
+		}
+	}
+	if(ACR_ConcurrentMapCount(&map) != TEST_KEY_COUNT)
+	{
+		ACR_DEBUG_PRINT(4, "FAIL map has %d keys instead of %d", (int)ACR_ConcurrentMapCount(&map), TEST_KEY_COUNT);
+		ACR_ConcurrentMapDeInit(&map);
+		return ACR_FAILURE;
+	}
+
+	// remove every other key and add them back so that the
+	// removed entries are reused
+	for(i = 0; i < TEST_KEY_COUNT; i += 2)
+	{
+		if((ACR_ConcurrentMapRemove(&map, TestKey(i)) != ACR_INFO_OK) || (ACR_ConcurrentMapRemove(&map, TestKey(i)) != ACR_INFO_UNKNOWN))
+		{
+			ACR_DEBUG_PRINT(5, "FAIL key %s was not removed once", g_TestKeys[i]);
+			ACR_ConcurrentMapDeInit(&map);
+			return ACR_FAILURE;
+		}
+	}
+	for(i = 0; i < TEST_KEY_COUNT; i++)
+	{
+		if(ACR_ConcurrentMapFind(&map, TestKey(i), ACR_NULL) != (((i % 2) == 0) ? ACR_INFO_UNKNOWN : ACR_INFO_OK))
+		{
+			ACR_DEBUG_PRINT(6, "FAIL key %s is found after the other keys were removed", g_TestKeys[i]);
+			ACR_ConcurrentMapDeInit(&map);
+			return ACR_FAILURE;
+		}
+	}
+	for(i = 0; i < TEST_KEY_COUNT; i += 2)
+	{
+		TestValueSet(&value, i, 3);
+		if((ACR_ConcurrentMapSet(&map, TestKey(i), &value) != ACR_INFO_NEW) ||
+		   (ACR_ConcurrentMapFind(&map, TestKey(i), &found) != ACR_INFO_OK) || (found.m_Version != 3) || (TestValueCheck(&found, i) == 0))
+		{
+			ACR_DEBUG_PRINT(7, "FAIL key %s was not added again", g_TestKeys[i]);
+			ACR_ConcurrentMapDeInit(&map);
+			return ACR_FAILURE;
+		}
+	}
+
+	// the empty key, a value of zeros, and a key larger than a
+	// block of entries
+	largeKey = (ACR_Byte_t*)malloc(3 * ACR_CONCURRENT_MAP_BLOCK_LENGTH);
+	if(largeKey != ACR_NULL)
+	{
+		memset(largeKey, 'x', 3 * ACR_CONCURRENT_MAP_BLOCK_LENGTH);
+		large = ACR_StringFromMemory(largeKey, 3 * ACR_CONCURRENT_MAP_BLOCK_LENGTH, ACR_MAX_COUNT);
+		if((ACR_ConcurrentMapSet(&map, empty, ACR_NULL) != ACR_INFO_NEW) || (ACR_ConcurrentMapSet(&map, large, ACR_NULL) != ACR_INFO_NEW) ||
+		   (ACR_ConcurrentMapFind(&map, empty, &found) != ACR_INFO_OK) || (found.m_Key != 0) || (found.m_Check != 0) ||
+		   (ACR_ConcurrentMapFind(&map, large, ACR_NULL) != ACR_INFO_OK) || (ACR_ConcurrentMapCount(&map) != (TEST_KEY_COUNT + 2)))
+		{
+			ACR_DEBUG_PRINT(8, "FAIL the empty key or the large key was not added");
+			free(largeKey);
+			ACR_ConcurrentMapDeInit(&map);
+			return ACR_FAILURE;
+		}
+		largeKey[0] = 'y';
+		if(ACR_ConcurrentMapFind(&map, large, ACR_NULL) != ACR_INFO_UNKNOWN)
+		{
+			ACR_DEBUG_PRINT(9, "FAIL a different large key was found");
+			free(largeKey);
+			ACR_ConcurrentMapDeInit(&map);
+			return ACR_FAILURE;
+		}
+		free(largeKey);
+	}
+
+	ACR_ConcurrentMapDeInit(&map);
+	if(ACR_ConcurrentMapFind(&map, TestKey(1), ACR_NULL) != ACR_INFO_UNKNOWN)
+	{
+		ACR_DEBUG_PRINT(10, "FAIL key was found after the map was freed");
+		return ACR_FAILURE;
+	}
+	return ACR_SUCCESS;
+}
+
+#if TEST_HAS_THREADS == ACR_BOOL_TRUE
+/** the work of one thread of the threaded test
+*/
+typedef struct TestThreadWork_s
+{
+	ACR_ConcurrentMap_t* m_Map;
+	int m_Thread;
+	int m_Torn;
+	int m_Found;
+} TestThreadWork_t;
+
+/** change the keys of this thread and read the keys of every
+    thread
+*/
+static TEST_THREAD_FUNC ConcurrentMapTestThread(
+	void* param)
+{
+	TestThreadWork_t* work = (TestThreadWork_t*)param;
+	TestValue_t value;
+	TestValue_t found;
+	ACR_Length_t version;
+	int round;
+	int i;
+	for(round = 0; round < 4; round++)
+	{
+		for(i = 0; i < TEST_KEY_COUNT; i++)
+		{
+			// each key is changed by one thread
+			if((i % TEST_THREAD_COUNT) == work->m_Thread)
+			{
+				version = (ACR_Length_t)((round * TEST_KEY_COUNT) + i);
+				TestValueSet(&value, i, version);
+				if((round % 2) == 1)
+				{
+					ACR_ConcurrentMapRemove(work->m_Map, TestKey(i));
+				}
+				ACR_ConcurrentMapSet(work->m_Map, TestKey(i), &value);
+			}
+			else if(ACR_ConcurrentMapFind(work->m_Map, TestKey(i), &found) == ACR_INFO_OK)
+			{
+				work->m_Found++;
+				if(TestValueCheck(&found, i) == 0)
+				{
+					work->m_Torn++;
+				}
+			}
+		}
+	}
+	return TEST_THREAD_RETURN;
+}
+#endif
+
+/**********************************************************/
+int ConcurrentMapThreadTest(void)
+{
+	#if TEST_HAS_THREADS == ACR_BOOL_TRUE
+	ACR_ConcurrentMap_t map;
+	TestThread_t threads[TEST_THREAD_COUNT];
+	TestThreadWork_t work[TEST_THREAD_COUNT];
+	TestValue_t found;
+	int attempt;
+	int t;
+	int i;
+
+	TestKeysFill();
+	for(attempt = 0; attempt < 5; attempt++)
+	{
+		// few shards so that the threads change the same shards
+		// and every shard grows while it is read
+		if(ACR_ConcurrentMapInit(&map, sizeof(TestValue_t), (attempt == 0) ? 1 : 4) != ACR_INFO_OK)
+		{
+			ACR_DEBUG_PRINT(11, "FAIL map was not created");
+			return ACR_FAILURE;
+		}
+		for(t = 0; t < TEST_THREAD_COUNT; t++)
+		{
+			work[t].m_Map = &map;
+			work[t].m_Thread = t;
+			work[t].m_Torn = 0;
+			work[t].m_Found = 0;
+			#if defined(_WIN32)
+			threads[t] = CreateThread(ACR_NULL, 0, ConcurrentMapTestThread, &work[t], 0, ACR_NULL);
+			#else
+			pthread_create(&threads[t], ACR_NULL, ConcurrentMapTestThread, &work[t]);
+			#endif
+		}
+		for(t = 0; t < TEST_THREAD_COUNT; t++)
+		{
+			#if defined(_WIN32)
+			WaitForSingleObject(threads[t], INFINITE);
+			CloseHandle(threads[t]);
+			#else
+			pthread_join(threads[t], ACR_NULL);
+			#endif
+			if(work[t].m_Torn != 0)
+			{
+				ACR_DEBUG_PRINT(12, "FAIL thread %d read %d of %d values while they were written", t, work[t].m_Torn, work[t].m_Found);
+				ACR_ConcurrentMapDeInit(&map);
+				return ACR_FAILURE;
+			}
+		}
+
+		// every key has the value from the last round
+		for(i = 0; i < TEST_KEY_COUNT; i++)
+		{
+			if((ACR_ConcurrentMapFind(&map, TestKey(i), &found) != ACR_INFO_OK) || (TestValueCheck(&found, i) == 0) ||
+			   (found.m_Version != (ACR_Length_t)((3 * TEST_KEY_COUNT) + i)))
+			{
+				ACR_DEBUG_PRINT(13, "FAIL key %s does not have its last value", g_TestKeys[i]);
+				ACR_ConcurrentMapDeInit(&map);
+				return ACR_FAILURE;
+			}
+		}
+		if(ACR_ConcurrentMapCount(&map) != TEST_KEY_COUNT)
+		{
+			ACR_DEBUG_PRINT(14, "FAIL map has %d keys instead of %d", (int)ACR_ConcurrentMapCount(&map), TEST_KEY_COUNT);
+			ACR_ConcurrentMapDeInit(&map);
+			return ACR_FAILURE;
+		}
+		ACR_ConcurrentMapDeInit(&map);
+	}
+	#endif
+	return ACR_SUCCESS;
+}
+
+#if TEST_HAS_THREADS == ACR_BOOL_TRUE
+/** the maps and the work of one thread of the benchmark
+*/
+typedef struct TestBenchmarkWork_s
+{
+	ACR_ConcurrentMap_t* m_Map;
+	ACR_HashMap_t* m_Locked;
+	TestLock_t* m_Lock;
+	int m_FindPercent;
+	int m_Seed;
+	int m_Found;
+} TestBenchmarkWork_t;
+
+/** get the next operation of a thread, which is the same for
+    both maps
+*/
+static int TestBenchmarkNext(
+	TestBenchmarkWork_t* work)
+{
+	work->m_Seed = (int)((((unsigned int)work->m_Seed) * 1103515245U + 12345U) & 0x7FFFFFFFU);
+	return work->m_Seed >> 4;
+}
+
+/** find, set, and remove random keys of the concurrent map
+*/
+static TEST_THREAD_FUNC ConcurrentMapBenchmarkThread(
+	void* param)
+{
+	TestBenchmarkWork_t* work = (TestBenchmarkWork_t*)param;
+	TestValue_t value;
+	int operation;
+	int key;
+	int n;
+	for(n = 0; n < TEST_BENCHMARK_OPERATIONS; n++)
+	{
+		operation = TestBenchmarkNext(work);
+		key = (operation >> 8) % TEST_KEY_COUNT;
+		operation = (operation & 0xFF) % 100;
+		if(operation < work->m_FindPercent)
+		{
+			if(ACR_ConcurrentMapFind(work->m_Map, TestKey(key), &value) == ACR_INFO_OK)
+			{
+				work->m_Found++;
+			}
+		}
+		else if((operation & 1) == 0)
+		{
+			TestValueSet(&value, key, (ACR_Length_t)n);
+			ACR_ConcurrentMapSet(work->m_Map, TestKey(key), &value);
+		}
+		else
+		{
+			ACR_ConcurrentMapRemove(work->m_Map, TestKey(key));
+		}
+	}
+	return TEST_THREAD_RETURN;
+}
+
+/** find, set, and remove random keys of the hash map behind
+    one lock
+*/
+static TEST_THREAD_FUNC LockedMapBenchmarkThread(
+	void* param)
+{
+	TestBenchmarkWork_t* work = (TestBenchmarkWork_t*)param;
+	TestValue_t value;
+	void* found;
+	int operation;
+	int key;
+	int n;
+	for(n = 0; n < TEST_BENCHMARK_OPERATIONS; n++)
+	{
+		operation = TestBenchmarkNext(work);
+		key = (operation >> 8) % TEST_KEY_COUNT;
+		operation = (operation & 0xFF) % 100;
+		TEST_LOCK(*work->m_Lock)
+		if(operation < work->m_FindPercent)
+		{
+			if(ACR_HashMapFindString(work->m_Locked, TestKey(key), &found) == ACR_INFO_OK)
+			{
+				memcpy(&value, found, sizeof(TestValue_t));
+				work->m_Found++;
+			}
+		}
+		else if((operation & 1) == 0)
+		{
+			if(ACR_HashMapAddString(work->m_Locked, TestKey(key), &found) != ACR_INFO_ERROR)
+			{
+				TestValueSet((TestValue_t*)found, key, (ACR_Length_t)n);
+			}
+		}
+		else
+		{
+			ACR_HashMapRemoveString(work->m_Locked, TestKey(key));
+		}
+		TEST_UNLOCK(*work->m_Lock)
+	}
+	return TEST_THREAD_RETURN;
+}
+
+/** run one benchmark thread function on a number of threads
+    \returns the number of seconds
+*/
+static double TestBenchmarkRun(
+	TestBenchmarkWork_t* work,
+	int threadCount,
+	TEST_THREAD_FUNC (*function)(void*))
+{
+	TestThread_t threads[TEST_BENCHMARK_MAX_THREADS];
+	double start = ACR_TimerSeconds();
+	int t;
+	for(t = 0; t < threadCount; t++)
+	{
+		#if defined(_WIN32)
+		threads[t] = CreateThread(ACR_NULL, 0, function, &work[t], 0, ACR_NULL);
+		#else
+		pthread_create(&threads[t], ACR_NULL, function, &work[t]);
+		#endif
+	}
+	for(t = 0; t < threadCount; t++)
+	{
+		#if defined(_WIN32)
+		WaitForSingleObject(threads[t], INFINITE);
+		CloseHandle(threads[t]);
+		#else
+		pthread_join(threads[t], ACR_NULL);
+		#endif
+	}
+	return ACR_TimerSeconds() - start;
+}
+#endif
+
+/**********************************************************/
+int ConcurrentMapBenchmark(void)
+{
+	#if TEST_HAS_THREADS == ACR_BOOL_TRUE
+	ACR_ConcurrentMap_t map;
+	ACR_HashMap_t locked;
+	TestLock_t lock;
+	TestBenchmarkWork_t work[TEST_BENCHMARK_MAX_THREADS];
+	TestValue_t value;
+	void* found;
+	int findPercents[2] = {90, 50};
+	int mix;
+	int threadCount;
+	int t;
+	int i;
+	double concurrentTime;
+	double lockedTime;
+	double operations;
+
+	TestKeysFill();
+	TEST_LOCK_INIT(lock)
+	for(mix = 0; mix < 2; mix++)
+	{
+		for(threadCount = 1; threadCount <= TEST_BENCHMARK_MAX_THREADS; threadCount *= 2)
+		{
+			// both maps start with half of the keys
+			if(ACR_ConcurrentMapInit(&map, sizeof(TestValue_t), 0) != ACR_INFO_OK)
+			{
+				ACR_DEBUG_PRINT(15, "FAIL map was not created");
+				TEST_LOCK_DEINIT(lock)
+				return ACR_FAILURE;
+			}
+			ACR_HashMapInit(&locked, ACR_HASHMAP_KEYS_STRING, sizeof(TestValue_t));
+			for(i = 0; i < TEST_KEY_COUNT; i += 2)
+			{
+				TestValueSet(&value, i, 0);
+				ACR_ConcurrentMapSet(&map, TestKey(i), &value);
+				if(ACR_HashMapAddString(&locked, TestKey(i), &found) == ACR_INFO_NEW)
+				{
+					memcpy(found, &value, sizeof(TestValue_t));
+				}
+			}
+
+			for(t = 0; t < threadCount; t++)
+			{
+				work[t].m_Map = &map;
+				work[t].m_Locked = &locked;
+				work[t].m_Lock = &lock;
+				work[t].m_FindPercent = findPercents[mix];
+				work[t].m_Seed = t + 1;
+				work[t].m_Found = 0;
+			}
+			concurrentTime = TestBenchmarkRun(work, threadCount, ConcurrentMapBenchmarkThread);
+			for(t = 0; t < threadCount; t++)
+			{
+				work[t].m_Seed = t + 1;
+				work[t].m_Found = 0;
+			}
+			lockedTime = TestBenchmarkRun(work, threadCount, LockedMapBenchmarkThread);
+
+			operations = (double)threadCount * TEST_BENCHMARK_OPERATIONS;
+			ACR_UNUSED(operations);
+			if((concurrentTime > 0) && (lockedTime > 0))
+			{
+				ACR_DEBUG_PRINT(16, "BENCHMARK %d%% finds %2d threads M operations/s ACR_ConcurrentMap_t %.2f ACR_HashMap_t with a lock %.2f",
+					findPercents[mix], threadCount, operations / (concurrentTime * 1000000.0), operations / (lockedTime * 1000000.0));
+			}
+
+			// with one thread both maps did the same operations
+			if((threadCount == 1) && (ACR_ConcurrentMapCount(&map) != locked.m_Count))
+			{
+				ACR_DEBUG_PRINT(17, "FAIL the maps have %d and %d keys", (int)ACR_ConcurrentMapCount(&map), (int)locked.m_Count);
+				ACR_HashMapDeInit(&locked);
+				ACR_ConcurrentMapDeInit(&map);
+				TEST_LOCK_DEINIT(lock)
+				return ACR_FAILURE;
+			}
+			ACR_HashMapDeInit(&locked);
+			ACR_ConcurrentMapDeInit(&map);
+		}
+	}
+	TEST_LOCK_DEINIT(lock)
+	#endif
+	return ACR_SUCCESS;
+}
@@ -0,0 +1,389 @@
+/*
+
+    ********** DO NOT REMOVE THIS INFORMATION ************
+
+    ACR - A set of C functions in a git Repository
+    Copyright (C) 2018 - 2020 Adam C. Rosenberg
+
+    Please read LICENSE before using this code
+
+    Please read README.md for instructions on including
+    this code in your project and where to find examples
+
+    If you contribute to this code, Please add your name
+    and email address to the AUTHORS list below so that
+    we know who to thank!
+
+    AUTHORS
+
+    Adam Rosenberg <adam@sirspot.com>
+
+    LICENSE
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+    ******************************************************
+
+*/
+/** \file test_format.c
+
+    application to test compiled formats
+
+*/
+#include "ACR/format.h"
+
+#include <stdio.h>
+
+//
+// PROTOTYPES
+//
+
+/** check ACR_FormatAppend() against snprintf() and the
+    conversions that snprintf() does not have
+*/
+int FormatTest(void);
+
+/** check that format text that is not supported is found
+    when it is compiled
+*/
+int FormatInvalidTest(void);
+
+/** compare the speed of ACR_FormatAppend() with snprintf()
+*/
+int FormatBenchmark(void);
+
+//
+// MAIN
+//
+
+int main(int argc, char** argv)
+{
+	int result = ACR_SUCCESS;
+
+	ACR_UNUSED(argc);
+	ACR_UNUSED(argv);
+
+	#if ACR_USE_64BIT == ACR_BOOL_TRUE
+	result |= FormatTest();
+	result |= FormatInvalidTest();
+
+	result |= FormatBenchmark();
+	#endif
+
+	return result;
+}
+
+//
+// IMPLEMENTATION
+//
+
+#if ACR_USE_64BIT == ACR_BOOL_TRUE
+
+/** get a string that references null-terminated text
+*/
+static ACR_String_t TestString(
+	const char* text)
+{
+	ACR_STRING(string);
+	ACR_STRING_REFERENCE(string, text, strlen(text), ACR_EMPTY_VALUE);
+	return string;
+}
+
+/** check that the buffer holds the text
+*/
+static int FormatTestCheck(
+	const char* format,
+	ACR_VarBuffer_t* buffer,
+	const char* expected)
+{
+	ACR_UNUSED(format);
+
+	if((buffer->m_Buffer.m_Length != (ACR_Length_t)strlen(expected)) ||
+	   (memcmp(buffer->m_Buffer.m_Pointer, expected, strlen(expected)) != 0))
+	{
+		ACR_DEBUG_PRINT(1, "FAIL \"%s\" gave \"%.*s\" instead of \"%s\"", format,
+			(int)buffer->m_Buffer.m_Length, (const char*)buffer->m_Buffer.m_Pointer, expected);
+		return ACR_FAILURE;
+	}
+	return ACR_SUCCESS;
+}
+
+/**********************************************************/
+int FormatTest(void)
+{
+	const char* text = "x=%d y=%5d z=%-5d| %05d %+d %x %X %08x %lu %lld %llu %zu %c %s %.3s %10s %-10s| %s 100%%";
+	const char* flags[] = {"", "-", "0", "+", "-+", "+0"};
+	const char* sizes[] = {"", "l", "ll", "z", "h", "hh"};
+	const char* types = "diuxX";
+	ACR_Format_t format;
+	ACR_VarBuffer_t buffer;
+	char formatText[64];
+	char precisionText[8];
+	char expected[256];
+	long long value;
+	int width;
+	int test;
+	int result = ACR_SUCCESS;
+
+	ACR_FormatInit(&format);
+	ACR_VarBufferInit(&buffer);
+
+	// the same as snprintf()
+	if(ACR_FormatCompile(&format, TestString(text)) != ACR_INFO_OK)
+	{
+		ACR_DEBUG_PRINT(2, "FAIL could not compile \"%s\"", text);
+		result = ACR_FAILURE;
+	}
+	else
+	{
+		ACR_FormatAppend(&format, &buffer, 1, -23, 456, -78, 9, 0xBEEFu, 0xBEEFu, 0x1Fu, 123456789ul, -1234567890123ll,
+			18446744073709551615ull, (size_t)77, 'Q', "text", "abcdef", "right", "left", (const char*)ACR_NULL);
+		snprintf(expected, sizeof(expected), text, 1, -23, 456, -78, 9, 0xBEEFu, 0xBEEFu, 0x1Fu, 123456789ul, -1234567890123ll,
+			18446744073709551615ull, (size_t)77, 'Q', "text", "abcdef", "right", "left", "(null)");
+		result = FormatTestCheck(text, &buffer, expected);
+	}
+
+	// the buffer only grows once and to exactly the length
+	// when there are no doubles
+	if((result == ACR_SUCCESS) && (ACR_VarBufferGetMaxLength(&buffer) != (ACR_Length_t)strlen(expected)))
+	{
+		ACR_DEBUG_PRINT(3, "FAIL buffer max length is %d instead of %d",
+			(int)ACR_VarBufferGetMaxLength(&buffer), (int)strlen(expected));
+		result = ACR_FAILURE;
+	}
+
+	// conversions that snprintf() does not have
+	if(result == ACR_SUCCESS)
+	{
+		text = "[%S] [%.*S] [%-6S] [%I] [%6I] [%g] [%8g] [%-8g] [%*d] [%-*d]";
+		ACR_FormatCompile(&format, TestString(text));
+		buffer.m_Buffer.m_Length = 0;
+		ACR_FormatAppend(&format, &buffer, TestString("string"), 3, TestString("abcdef"), TestString("ab"),
+			ACR_INFO_OK, ACR_INFO_ERROR, 0.1, 1.5, -2.0, 4, 7, -4, 7);
+		snprintf(expected, sizeof(expected), "[string] [abc] [ab    ] [%.*s] [%6.*s] [0.1] [     1.5] [-2      ] [   7] [7   ]",
+			(int)ACR_InfoToString(ACR_INFO_OK).m_Buffer.m_Length, (const char*)ACR_InfoToString(ACR_INFO_OK).m_Buffer.m_Pointer,
+			(int)ACR_InfoToString(ACR_INFO_ERROR).m_Buffer.m_Length, (const char*)ACR_InfoToString(ACR_INFO_ERROR).m_Buffer.m_Pointer);
+		result = FormatTestCheck(text, &buffer, expected);
+	}
+
+	// text that is already in the buffer is kept
+	if(result == ACR_SUCCESS)
+	{
+		text = "";
+		ACR_FormatCompile(&format, TestString(text));
+		ACR_FormatAppend(&format, &buffer);
+		text = "%% and %d";
+		ACR_FormatCompile(&format, TestString(text));
+		ACR_FormatAppend(&format, &buffer, 5);
+		strcat(expected, "% and 5");
+		result = FormatTestCheck(text, &buffer, expected);
+	}
+
+	// the precision of an ACR_String_t is a number of UTF8
+	// characters so a character is never split
+	if(result == ACR_SUCCESS)
+	{
+		text = "[%.2S] [%.1S] [%.0S] [%.9S] [%.2S]";
+		ACR_FormatCompile(&format, TestString(text));
+		buffer.m_Buffer.m_Length = 0;
+		ACR_FormatAppend(&format, &buffer, TestString("h\xC3\xA9llo"), TestString("\xE2\x82\xAC" "5"),
+			TestString("abc"), TestString("h\xC3\xA9llo"), TestString("\x80\x80xy"));
+		result = FormatTestCheck(text, &buffer, "[h\xC3\xA9] [\xE2\x82\xAC] [] [h\xC3\xA9llo] [\x80\x80x]");
+	}
+
+	// info values that are not in the enum
+	if(result == ACR_SUCCESS)
+	{
+		text = "[%I] [%I]";
+		ACR_FormatCompile(&format, TestString(text));
+		buffer.m_Buffer.m_Length = 0;
+		ACR_FormatAppend(&format, &buffer, 99, -1);
+		snprintf(expected, sizeof(expected), "[%.*s] [%.*s]",
+			(int)ACR_InfoToString(ACR_INFO_UNKNOWN).m_Buffer.m_Length, (const char*)ACR_InfoToString(ACR_INFO_UNKNOWN).m_Buffer.m_Pointer,
+			(int)ACR_InfoToString(ACR_INFO_UNKNOWN).m_Buffer.m_Length, (const char*)ACR_InfoToString(ACR_INFO_UNKNOWN).m_Buffer.m_Pointer);
+		result = FormatTestCheck(text, &buffer, expected);
+	}
+
+	// short and char sizes and the precision of integers
+	if(result == ACR_SUCCESS)
+	{
+		text = "[%+hd] [%hx] [%hhu] [%hhd] [%.3d] [%08.5x] [%.0d] [%+.0d] [%5.0u] [%-6.3d] [%.*X]";
+		ACR_FormatCompile(&format, TestString(text));
+		buffer.m_Buffer.m_Length = 0;
+		ACR_FormatAppend(&format, &buffer, (int)6968347660708ll, 0x1234AA03, 1000, 200, 7, 0xBEEFu, 0, 0, 0u, -42, 6, 0xABCu);
+		snprintf(expected, sizeof(expected), text, (int)6968347660708ll, 0x1234AA03, 1000, 200, 7, 0xBEEFu, 0, 0, 0u, -42, 6, 0xABCu);
+		result = FormatTestCheck(text, &buffer, expected);
+	}
+
+	// more arguments than are saved between finding the
+	// length and writing
+	if(result == ACR_SUCCESS)
+	{
+		text = "%d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %s %d";
+		ACR_FormatCompile(&format, TestString(text));
+		buffer.m_Buffer.m_Length = 0;
+		ACR_FormatAppend(&format, &buffer, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, "twenty", 21);
+		snprintf(expected, sizeof(expected), text, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, "twenty", 21);
+		result = FormatTestCheck(text, &buffer, expected);
+	}
+
+	// random integer conversions
+	srand(42);
+	for(test = 0; (test < 20000) && (result == ACR_SUCCESS); test++)
+	{
+		width = rand() % 25;
+		precisionText[0] = 0;
+		if((rand() % 3) == 0)
+		{
+			snprintf(precisionText, sizeof(precisionText), ".%d", rand() % 22);
+		}
+		snprintf(formatText, sizeof(formatText), "<%s%d%s%s%c>", flags[rand() % 6], width,
+			precisionText, sizes[rand() % 6], types[rand() % 5]);
+		value = (long long)((((unsigned long long)rand()) << 48) ^ (((unsigned long long)rand()) << 24) ^ (unsigned long long)rand());
+		value >>= rand() % 63;
+		if((rand() % 16) == 0)
+		{
+			value = 0;
+		}
+		if((rand() % 2) == 0)
+		{
+			value = -value;
+		}
+		if(ACR_FormatCompile(&format, TestString(formatText)) != ACR_INFO_OK)
+		{
+			ACR_DEBUG_PRINT(4, "FAIL could not compile \"%s\"", formatText);
+			result = ACR_FAILURE;
+			break;
+		}
+		buffer.m_Buffer.m_Length = 0;
+		if(strstr(formatText, "ll") != ACR_NULL)
+		{
+			ACR_FormatAppend(&format, &buffer, value);
+			snprintf(expected, sizeof(expected), formatText, value);
+		}
+		else if(strchr(formatText, 'l') != ACR_NULL)
+		{
+			ACR_FormatAppend(&format, &buffer, (long)value);
+			snprintf(expected, sizeof(expected), formatText, (long)value);
+		}
+		else if(strchr(formatText, 'z') != ACR_NULL)
+		{
+			ACR_FormatAppend(&format, &buffer, (size_t)value);
+			snprintf(expected, sizeof(expected), formatText, (size_t)value);
+		}
+		else
+		{
+			// short and char sizes are passed as int and then
+			// converted by the format
+			ACR_FormatAppend(&format, &buffer, (int)value);
+			snprintf(expected, sizeof(expected), formatText, (int)value);
+		}
+		result = FormatTestCheck(formatText, &buffer, expected);
+	}
+
+	ACR_VarBufferDeInit(&buffer);
+	ACR_FormatDeInit(&format);
+	return result;
+}
+
+/**********************************************************/
+int FormatInvalidTest(void)
+{
+	const char* texts[] = {
+		"%", "abc%", "%f", "%e", "%ls", "%zs", "%.3c", "%.2g", "%99999d", "%5", "%-"
+	};
+	ACR_Format_t format;
+	int test;
+
+	ACR_FormatInit(&format);
+	for(test = 0; test < (int)(sizeof(texts) / sizeof(texts[0])); test++)
+	{
+		if(ACR_FormatCompile(&format, TestString(texts[test])) != ACR_INFO_INVALID)
+		{
+			ACR_DEBUG_PRINT(5, "FAIL \"%s\" is not invalid", texts[test]);
+			ACR_FormatDeInit(&format);
+			return ACR_FAILURE;
+		}
+	}
+	ACR_FormatDeInit(&format);
+
+	if((ACR_FormatCompile(ACR_NULL, TestString("%d")) != ACR_INFO_ERROR) ||
+	   (ACR_FormatAppend(ACR_NULL, ACR_NULL, 1) != ACR_INFO_ERROR))
+	{
+		ACR_DEBUG_PRINT(6, "FAIL no error without a format");
+		return ACR_FAILURE;
+	}
+	return ACR_SUCCESS;
+}
+
+/**********************************************************/
+int FormatBenchmark(void)
+{
+	const char* text = "id=%d name=%s count=%u mask=%08x ok=%s";
+	ACR_Format_t format;
+	ACR_VarBuffer_t buffer;
+	char simple[128];
+	int count = 1000000;
+	int i;
+	size_t simpleLength = 0;
+	ACR_Length_t length = 0;
+	double start;
+	double simpleTime;
+	double time;
+	double millions = (double)count / 1000000.0;
+
+	ACR_UNUSED(millions);
+	ACR_FormatInit(&format);
+	ACR_VarBufferInit(&buffer);
+	if(ACR_FormatCompile(&format, TestString(text)) != ACR_INFO_OK)
+	{
+		ACR_DEBUG_PRINT(7, "FAIL could not compile \"%s\"", text);
+		return ACR_FAILURE;
+	}
+
+	start = ACR_TimerSeconds();
+	for(i = 0; i < count; i++)
+	{
+		simpleLength += (size_t)snprintf(simple, sizeof(simple), text, i, "benchmark", (unsigned int)i * 7u, (unsigned int)i, "true");
+	}
+	simpleTime = ACR_TimerSeconds() - start;
+
+	start = ACR_TimerSeconds();
+	for(i = 0; i < count; i++)
+	{
+		buffer.m_Buffer.m_Length = 0;
+		ACR_FormatAppend(&format, &buffer, i, "benchmark", (unsigned int)i * 7u, (unsigned int)i, "true");
+		length += buffer.m_Buffer.m_Length;
+	}
+	time = ACR_TimerSeconds() - start;
+
+	if((simpleTime > 0) && (time > 0))
+	{
+		ACR_DEBUG_PRINT(8, "BENCHMARK millions per second snprintf %.1f ACR_FormatAppend %.1f",
+			millions / simpleTime, millions / time);
+	}
+
+	ACR_VarBufferDeInit(&buffer);
+	ACR_FormatDeInit(&format);
+
+	if((ACR_Length_t)simpleLength != length)
+	{
+		ACR_DEBUG_PRINT(9, "FAIL benchmark lengths are not the same");
+		return ACR_FAILURE;
+	}
+	return ACR_SUCCESS;
+}
+
+#endif // #if ACR_USE_64BIT == ACR_BOOL_TRUE
@@ -0,0 +1,416 @@
+/*
+
+    ********** DO NOT REMOVE THIS INFORMATION ************
+
+    ACR - A set of C functions in a git Repository
+    Copyright (C) 2018 - 2020 Adam C. Rosenberg
+
+    Please read LICENSE before using this code
+
+    Please read README.md for instructions on including
+    this code in your project and where to find examples
+
+    If you contribute to this code, Please add your name
+    and email address to the AUTHORS list below so that
+    we know who to thank!
+
+    AUTHORS
+
+    Adam Rosenberg <adam@sirspot.com>
+
+    LICENSE
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+    ******************************************************
+
+*/
+/** \file test_hash.c
+
+    application to test the fast non-cryptographic hashes
+
+*/
+#include "ACR/hash.h"
+
+#include <stdio.h>
+// included for memcpy()
+#include <string.h>
+
+// the longest data checked by the tests
+#define TEST_DATA_LENGTH 2500
+
+//
+// PROTOTYPES
+//
+
+/** check that the hash of known data does not change
+    between versions, platforms, and SIMD or not
+*/
+int HashKnownTest(void);
+
+/** check that hashing in chunks is the same as hashing all
+    of the data at once
+*/
+int HashStreamTest(void);
+
+/** check that every bit of the data and the seed changes
+    about half of the bits of the hash
+*/
+int HashAvalancheTest(void);
+
+/** check the case-insensitive hash of strings
+*/
+int HashIgnoreCaseTest(void);
+
+/** measure the throughput and latency of the hash
+*/
+int HashBenchmark(void);
+
+//
+// MAIN
+//
+
+int main(int argc, char** argv)
+{
+	int result = ACR_SUCCESS;
+
+	ACR_UNUSED(argc);
+	ACR_UNUSED(argv);
+
+	#if ACR_USE_64BIT == ACR_BOOL_TRUE
+	result |= HashKnownTest();
+	result |= HashStreamTest();
+	result |= HashAvalancheTest();
+	result |= HashIgnoreCaseTest();
+
+	#if ACR_HAS_MALLOC == ACR_BOOL_TRUE
+	result |= HashBenchmark();
+	#endif
+	#endif
+
+	return result;
+}
+
+//
+// IMPLEMENTATION
+//
+
+#if ACR_USE_64BIT == ACR_BOOL_TRUE
+
+/** data that is different at every position
+*/
+static ACR_Byte_t g_TestData[TEST_DATA_LENGTH];
+
+/** fill in the test data
+*/
+static void TestDataFill(void)
+{
+	ACR_Hash64_t x = 0x243F6A8885A308D3ULL;
+	int i;
+	for(i = 0; i < TEST_DATA_LENGTH; i++)
+	{
+		x = (x * 6364136223846793005ULL) + 1442695040888963407ULL;
+		g_TestData[i] = (ACR_Byte_t)(x >> 56);
+	}
+}
+
+/** count the bits that are different
+*/
+static int TestBitsChanged(
+	ACR_Hash64_t a,
+	ACR_Hash64_t b)
+{
+	ACR_Hash64_t x = a ^ b;
+	int count = 0;
+	while(x != 0)
+	{
+		x &= x - 1;
+		count++;
+	}
+	return count;
+}
+
+/**********************************************************/
+int HashKnownTest(void)
+{
+	// one length for each way the data is read
+	const ACR_Length_t lengths[] = {0, 3, 8, 16, 40, 100, 256, 257, 1000, 2500};
+	const ACR_Hash64_t expected[] =
+	{
+		0x7C4ACDCBEED59B2AULL, 0x589AC304C787AB40ULL, 0x12E42789ED11CB1EULL, 0xB84910C65B8B4EE8ULL, 0x458A31850597D33CULL,
+		0x458ADC5506893F29ULL, 0x96FB1CEAEC5CD031ULL, 0x592AA54F535B4AEAULL, 0x7176BCC4733CBEEDULL, 0x70827F41DF43A4CAULL
+	};
+	ACR_Hash64_t hash;
+	int i;
+
+	TestDataFill();
+	for(i = 0; i < 10; i++)
+	{
+		hash = ACR_Hash64(g_TestData, lengths[i], 0x1234ULL);
+		if(hash != expected[i])
+		{
+			ACR_DEBUG_PRINT(1, "FAIL hash of %d bytes is 0x%016llX instead of 0x%016llX", (int)lengths[i], hash, expected[i]);
+			return ACR_FAILURE;
+		}
+	}
+	return ACR_SUCCESS;
+}
+
+/**********************************************************/
+int HashStreamTest(void)
+{
+	const ACR_Length_t chunks[] = {1, 7, 63, 64, 65, 255, 256, 300, 1024};
+	ACR_HashState_t state;
+	ACR_Hash128_t once;
+	ACR_Hash128_t streamed;
+	ACR_Length_t length;
+	ACR_Length_t pos;
+	ACR_Length_t chunk;
+	int c;
+
+	TestDataFill();
+	for(length = 0; length <= TEST_DATA_LENGTH; length += ((length < 600) ? 1 : 37))
+	{
+		once = ACR_Hash128(g_TestData, length, 99);
+		if(ACR_Hash64(g_TestData, length, 99) != once.m_Low)
+		{
+			ACR_DEBUG_PRINT(2, "FAIL the 64bit hash of %d bytes is not the low bits of the 128bit hash", (int)length);
+			return ACR_FAILURE;
+		}
+		for(c = 0; c < 9; c++)
+		{
+			ACR_HashInit(&state, 99);
+			for(pos = 0; pos < length; pos += chunk)
+			{
+				chunk = ((length - pos) < chunks[c]) ? (length - pos) : chunks[c];
+				ACR_HashUpdate(&state, g_TestData + pos, chunk);
+			}
+			streamed = ACR_HashFinal128(&state);
+			if((streamed.m_Low != once.m_Low) || (streamed.m_High != once.m_High) || (ACR_HashFinal64(&state) != once.m_Low))
+			{
+				ACR_DEBUG_PRINT(3, "FAIL the hash of %d bytes in chunks of %d is different", (int)length, (int)chunks[c]);
+				return ACR_FAILURE;
+			}
+		}
+	}
+	return ACR_SUCCESS;
+}
+
+/**********************************************************/
+int HashAvalancheTest(void)
+{
+	const ACR_Length_t lengths[] = {1, 4, 8, 12, 16, 24, 64, 200, 300, 1100};
+	ACR_Byte_t data[1100];
+	ACR_Hash64_t hash;
+	ACR_Hash64_t other;
+	ACR_Hash128_t hash128;
+	ACR_Hash128_t other128;
+	int total;
+	int bits;
+	int n;
+	int i;
+
+	TestDataFill();
+	for(n = 0; n < 10; n++)
+	{
+		memcpy(data, g_TestData, (size_t)lengths[n]);
+		hash = ACR_Hash64(data, lengths[n], 0);
+		hash128 = ACR_Hash128(data, lengths[n], 0);
+		total = 0;
+		for(i = 0; i < (int)(lengths[n] * 8); i++)
+		{
+			data[i / 8] ^= (ACR_Byte_t)(1 << (i % 8));
+			other = ACR_Hash64(data, lengths[n], 0);
+			other128 = ACR_Hash128(data, lengths[n], 0);
+			data[i / 8] ^= (ACR_Byte_t)(1 << (i % 8));
+			bits = TestBitsChanged(hash, other);
+			if((bits < 12) || (TestBitsChanged(hash128.m_High, other128.m_High) < 12))
+			{
+				ACR_DEBUG_PRINT(4, "FAIL changing bit %d of %d bytes changed only %d bits", i, (int)lengths[n], bits);
+				return ACR_FAILURE;
+			}
+			total += bits;
+		}
+		// the average is very close to 32 for a good hash
+		if(((total / (int)(lengths[n] * 8)) < 29) || ((total / (int)(lengths[n] * 8)) > 35))
+		{
+			ACR_DEBUG_PRINT(5, "FAIL changing a bit of %d bytes changed %d bits on average", (int)lengths[n], total / (int)(lengths[n] * 8));
+			return ACR_FAILURE;
+		}
+		for(i = 0; i < 64; i++)
+		{
+			if(TestBitsChanged(hash, ACR_Hash64(data, lengths[n], ((ACR_Hash64_t)1) << i)) < 12)
+			{
+				ACR_DEBUG_PRINT(6, "FAIL changing bit %d of the seed did not change the hash of %d bytes", i, (int)lengths[n]);
+				return ACR_FAILURE;
+			}
+		}
+	}
+
+	// data that only differs by length
+	memset(data, 0, sizeof(data));
+	for(n = 1; n < 1100; n++)
+	{
+		if(ACR_Hash64(data, (ACR_Length_t)n, 0) == ACR_Hash64(data, (ACR_Length_t)(n - 1), 0))
+		{
+			ACR_DEBUG_PRINT(7, "FAIL %d and %d zero bytes have the same hash", n, n - 1);
+			return ACR_FAILURE;
+		}
+	}
+	return ACR_SUCCESS;
+}
+
+/**********************************************************/
+int HashIgnoreCaseTest(void)
+{
+	const char* same[][3] =
+	{
+		{"Name", "NAME", "name"},
+		{"caf\xC3\xA9", "CAF\xC3\x89", "Caf\xC3\xA9"},
+		// final sigma and sigma are the same when case is ignored
+		{"\xCE\xA3\xCE\xA3", "\xCF\x83\xCF\x82", "\xCF\x83\xCF\x83"},
+		// kelvin sign is three bytes and k is one
+		{"\xE2\x84\xAA" "elvin", "Kelvin", "kELVIN"}
+	};
+	char upper[400];
+	char lower[400];
+	ACR_String_t a;
+	ACR_String_t b;
+	int i;
+	int j;
+
+	for(i = 0; i < 4; i++)
+	{
+		a = ACR_StringFromMemory((ACR_Byte_t*)same[i][0], ACR_MAX_LENGTH, ACR_MAX_COUNT);
+		for(j = 1; j < 3; j++)
+		{
+			b = ACR_StringFromMemory((ACR_Byte_t*)same[i][j], ACR_MAX_LENGTH, ACR_MAX_COUNT);
+			if((ACR_HashString(a, ACR_INFO_NO, 5) != ACR_HashString(b, ACR_INFO_NO, 5)) ||
+			   (ACR_HashString(a, ACR_INFO_YES, 5) == ACR_HashString(b, ACR_INFO_YES, 5)))
+			{
+				ACR_DEBUG_PRINT(8, "FAIL %s and %s do not have the same hash when case is ignored", same[i][0], same[i][j]);
+				return ACR_FAILURE;
+			}
+		}
+	}
+
+	// strings longer than the memory used to fold them, with
+	// characters of two bytes that become one byte
+	for(i = 0; i < 399; i++)
+	{
+		if((i % 3) == 0)
+		{
+			upper[i] = (char)('A' + (i % 26));
+			lower[i] = (char)('a' + (i % 26));
+		}
+		else if((i % 3) == 1)
+		{
+			// U+212A KELVIN SIGN folds to k
+			upper[i] = '1';
+			lower[i] = '1';
+		}
+		else
+		{
+			upper[i] = '-';
+			lower[i] = '-';
+		}
+	}
+	upper[399] = 0;
+	lower[399] = 0;
+	a = ACR_StringFromMemory((ACR_Byte_t*)upper, ACR_MAX_LENGTH, ACR_MAX_COUNT);
+	b = ACR_StringFromMemory((ACR_Byte_t*)lower, ACR_MAX_LENGTH, ACR_MAX_COUNT);
+	if((ACR_HashString(a, ACR_INFO_NO, 0) != ACR_HashString(b, ACR_INFO_NO, 0)) ||
+	   (ACR_HashString(b, ACR_INFO_NO, 0) != ACR_Hash64((const ACR_Byte_t*)lower, 399, 0)) ||
+	   (ACR_HashString(b, ACR_INFO_YES, 0) != ACR_HashBuffer(b.m_Buffer, 0)))
+	{
+		ACR_DEBUG_PRINT(9, "FAIL a long string does not have the same hash when case is ignored");
+		return ACR_FAILURE;
+	}
+	return ACR_SUCCESS;
+}
+
+/** hash a string with FNV-1a like the repo did before
+*/
+static ACR_Hash64_t TestFnv(
+	const ACR_Byte_t* src,
+	ACR_Length_t length)
+{
+	ACR_Hash64_t hash = 14695981039346656037ULL;
+	ACR_Length_t pos;
+	for(pos = 0; pos < length; pos++)
+	{
+		hash = (hash ^ src[pos]) * 1099511628211ULL;
+	}
+	return hash;
+}
+
+/**********************************************************/
+int HashBenchmark(void)
+{
+	const ACR_Length_t lengths[] = {8, 16, 32, 64, 256, 1024, 65536, 1048576};
+	ACR_Byte_t* data;
+	ACR_Hash64_t sum = 0;
+	ACR_Length_t total;
+	ACR_Length_t repeat;
+	ACR_Length_t r;
+	double start;
+	double hashTime;
+	double fnvTime;
+	int n;
+
+	data = (ACR_Byte_t*)malloc(1048576 + 64);
+	if(data == ACR_NULL)
+	{
+		return ACR_SUCCESS;
+	}
+	memset(data, 0x5A, 1048576 + 64);
+
+	for(n = 0; n < 8; n++)
+	{
+		// about 64MB of data for each length
+		repeat = 67108864 / lengths[n];
+		total = repeat * lengths[n];
+
+		// the data changes each time so the hashes cannot be
+		// reused and short hashes measure latency
+		start = ACR_TimerSeconds();
+		for(r = 0; r < repeat; r++)
+		{
+			sum += ACR_Hash64(data + (r & 63), lengths[n], sum);
+		}
+		hashTime = ACR_TimerSeconds() - start;
+
+		start = ACR_TimerSeconds();
+		for(r = 0; r < repeat; r++)
+		{
+			sum += TestFnv(data + (r & 63), lengths[n]);
+		}
+		fnvTime = ACR_TimerSeconds() - start;
+
+		if((hashTime > 0) && (fnvTime > 0))
+		{
+			ACR_DEBUG_PRINT(10, "BENCHMARK %7d bytes ACR_Hash64 %6.2f GB/s %6.1f ns, FNV-1a %5.2f GB/s %7.1f ns",
+				(int)lengths[n], (double)total / (hashTime * 1000000000.0), (hashTime * 1000000000.0) / (double)repeat,
+				(double)total / (fnvTime * 1000000000.0), (fnvTime * 1000000000.0) / (double)repeat);
+		}
+	}
+
+	free(data);
+	ACR_UNUSED(total);
+	ACR_UNUSED(sum);
+	return ACR_SUCCESS;
+}
+
+#endif // #if ACR_USE_64BIT == ACR_BOOL_TRUE
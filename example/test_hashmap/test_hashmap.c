@@ -0,0 +1,669 @@
+/*
+
+    ********** DO NOT REMOVE THIS INFORMATION ************
+
+    ACR - A set of C functions in a git Repository
+    Copyright (C) 2018 - 2020 Adam C. Rosenberg
+
+    Please read LICENSE before using this code
+
+    Please read README.md for instructions on including
+    this code in your project and where to find examples
+
+    If you contribute to this code, Please add your name
+    and email address to the AUTHORS list below so that
+    we know who to thank!
+
+    AUTHORS
+
+    Adam Rosenberg <adam@sirspot.com>
+
+    LICENSE
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+    ******************************************************
+
+*/
+/** \file test_hashmap.c
+
+    application to test the ACR_HashMap_t type
+
+*/
+#include "ACR/hashmap.h"
+
+#include <stdio.h>
+// included for memcmp() and strlen()
+#include <string.h>
+
+// the number of keys used by the tests
+#define TEST_KEY_COUNT 20000
+
+// the largest number of keys in the benchmark. build with
+// -D TEST_HASHMAP_MAX_COUNT=100000000 to also run 10M and
+// 100M keys on a machine with enough memory
+#ifndef TEST_HASHMAP_MAX_COUNT
+#define TEST_HASHMAP_MAX_COUNT 1000000
+#endif
+
+//
+// PROTOTYPES
+//
+
+/** check adding, finding, removing, and visiting integer
+    keys
+*/
+int HashMapIntegerTest(void);
+
+/** check adding, finding, removing, and visiting string
+    keys
+*/
+int HashMapStringTest(void);
+
+/** check reserve, clear, and a map with no values
+*/
+int HashMapReserveTest(void);
+
+/** compare the speed of ACR_HashMap_t with a chained hash
+    table from 1K to TEST_HASHMAP_MAX_COUNT keys
+*/
+int HashMapBenchmark(void);
+
+//
+// MAIN
+//
+
+int main(int argc, char** argv)
+{
+	int result = ACR_SUCCESS;
+
+	ACR_UNUSED(argc);
+	ACR_UNUSED(argv);
+
+	#if ACR_HAS_MALLOC == ACR_BOOL_TRUE
+	result |= HashMapIntegerTest();
+	result |= HashMapStringTest();
+	result |= HashMapReserveTest();
+
+	result |= HashMapBenchmark();
+	#endif
+
+	return result;
+}
+
+//
+// IMPLEMENTATION
+//
+
+/** the value stored for each key by the tests
+*/
+typedef struct TestValue_s
+{
+	ACR_Length_t m_Key;
+	int m_Number;
+} TestValue_t;
+
+/** get a different key for each number that is not in
+    order, including 0 and keys with only high bits
+*/
+static ACR_Length_t TestKey(
+	int i)
+{
+	return ((ACR_Length_t)i * (ACR_Length_t)2654435761UL) ^ ((ACR_Length_t)(i & 1) << ((sizeof(ACR_Length_t) * 8) - 1));
+}
+
+/** write the string key for a number into memory
+*/
+static ACR_String_t TestStringKey(
+	char* memory,
+	int i)
+{
+	// keys of different lengths and some with UTF-8
+	const char* prefixes[] = {"k", "key_", "caf\xC3\xA9_", "a much longer key that is stored in the arena_"};
+	char digits[16];
+	int length = 0;
+	int count = 0;
+	const char* prefix = prefixes[i % 4];
+	while(prefix[length] != 0)
+	{
+		memory[length] = prefix[length];
+		length++;
+	}
+	do
+	{
+		digits[count++] = (char)('0' + (i % 10));
+		i /= 10;
+	} while(i > 0);
+	while(count > 0)
+	{
+		memory[length++] = digits[--count];
+	}
+	memory[length] = 0;
+	return ACR_StringFromMemory((ACR_Byte_t*)memory, ACR_MAX_LENGTH, ACR_MAX_COUNT);
+}
+
+/**********************************************************/
+int HashMapIntegerTest(void)
+{
+	ACR_HashMap_t map;
+	TestValue_t* value;
+	ACR_Count_t position = 0;
+	ACR_Length_t key;
+	ACR_Info_t expected;
+	int visited = 0;
+	int round;
+	int i;
+
+	ACR_HashMapInit(&map, ACR_HASHMAP_KEYS_INTEGER, sizeof(TestValue_t));
+	if(ACR_HashMapFindInteger(&map, 0, ACR_NULL) != ACR_INFO_UNKNOWN)
+	{
+		ACR_DEBUG_PRINT(1, "FAIL an empty map found a key");
+		return ACR_FAILURE;
+	}
+
+	for(i = 0; i < TEST_KEY_COUNT; i++)
+	{
+		if((ACR_HashMapAddInteger(&map, TestKey(i), (void**)&value) != ACR_INFO_NEW) || (value->m_Key != 0) || (value->m_Number != 0))
+		{
+			ACR_DEBUG_PRINT(2, "FAIL key %d was not added with a zero value", i);
+			ACR_HashMapDeInit(&map);
+			return ACR_FAILURE;
+		}
+		value->m_Key = TestKey(i);
+		value->m_Number = i;
+	}
+
+	// remove and add keys again so that the groups that
+	// overflowed become empty and full again
+	for(round = 0; round < 3; round++)
+	{
+		for(i = round; i < TEST_KEY_COUNT; i += 3)
+		{
+			if(ACR_HashMapRemoveInteger(&map, TestKey(i)) != ACR_INFO_OK)
+			{
+				ACR_DEBUG_PRINT(3, "FAIL key %d was not removed", i);
+				ACR_HashMapDeInit(&map);
+				return ACR_FAILURE;
+			}
+		}
+		for(i = 0; i < TEST_KEY_COUNT; i++)
+		{
+			expected = ((i % 3) == round) ? ACR_INFO_UNKNOWN : ACR_INFO_OK;
+			if((ACR_HashMapFindInteger(&map, TestKey(i), (void**)&value) != expected) ||
+			   ((expected == ACR_INFO_OK) && ((value->m_Key != TestKey(i)) || (value->m_Number != i))))
+			{
+				ACR_DEBUG_PRINT(4, "FAIL key %d was not found correctly after removing keys", i);
+				ACR_HashMapDeInit(&map);
+				return ACR_FAILURE;
+			}
+		}
+		if((ACR_HashMapRemoveInteger(&map, TestKey(round)) != ACR_INFO_UNKNOWN) ||
+		   (map.m_Count != (ACR_Count_t)(TEST_KEY_COUNT - ((TEST_KEY_COUNT - round + 2) / 3))))
+		{
+			ACR_DEBUG_PRINT(5, "FAIL the map has %d keys after removing keys", (int)map.m_Count);
+			ACR_HashMapDeInit(&map);
+			return ACR_FAILURE;
+		}
+		for(i = round; i < TEST_KEY_COUNT; i += 3)
+		{
+			if(ACR_HashMapAddInteger(&map, TestKey(i), (void**)&value) != ACR_INFO_NEW)
+			{
+				ACR_DEBUG_PRINT(6, "FAIL key %d was not added again", i);
+				ACR_HashMapDeInit(&map);
+				return ACR_FAILURE;
+			}
+			value->m_Key = TestKey(i);
+			value->m_Number = i;
+		}
+	}
+
+	if(ACR_HashMapAddInteger(&map, TestKey(7), (void**)&value) != ACR_INFO_OLD || (value->m_Number != 7))
+	{
+		ACR_DEBUG_PRINT(7, "FAIL adding key 7 again did not find the old value");
+		ACR_HashMapDeInit(&map);
+		return ACR_FAILURE;
+	}
+
+	while(ACR_HashMapNextInteger(&map, &position, &key, (void**)&value) == ACR_INFO_OK)
+	{
+		if(value->m_Key != key)
+		{
+			ACR_DEBUG_PRINT(8, "FAIL visited a key with the wrong value");
+			ACR_HashMapDeInit(&map);
+			return ACR_FAILURE;
+		}
+		visited++;
+	}
+	if(visited != TEST_KEY_COUNT)
+	{
+		ACR_DEBUG_PRINT(9, "FAIL visited %d keys instead of %d", visited, TEST_KEY_COUNT);
+		ACR_HashMapDeInit(&map);
+		return ACR_FAILURE;
+	}
+
+	ACR_HashMapDeInit(&map);
+	return ACR_SUCCESS;
+}
+
+/**********************************************************/
+int HashMapStringTest(void)
+{
+	ACR_HashMap_t map;
+	ACR_String_t key;
+	int* value;
+	ACR_Count_t position = 0;
+	char memory[64];
+	int visited = 0;
+	int round;
+	int i;
+
+	ACR_HashMapInit(&map, ACR_HASHMAP_KEYS_STRING, sizeof(int));
+	if(ACR_HashMapAddInteger(&map, 1, ACR_NULL) != ACR_INFO_ERROR)
+	{
+		ACR_DEBUG_PRINT(10, "FAIL an integer key was added to a map of strings");
+		return ACR_FAILURE;
+	}
+
+	// remove most keys and add them again so the key bytes
+	// are moved together when the map grows
+	for(round = 0; round < 4; round++)
+	{
+		for(i = 0; i < TEST_KEY_COUNT; i++)
+		{
+			if(ACR_HashMapAddString(&map, TestStringKey(memory, i), (void**)&value) != ACR_INFO_NEW)
+			{
+				ACR_DEBUG_PRINT(11, "FAIL key %s was not added", memory);
+				ACR_HashMapDeInit(&map);
+				return ACR_FAILURE;
+			}
+			(*value) = i;
+		}
+		for(i = 0; i < TEST_KEY_COUNT; i++)
+		{
+			if((ACR_HashMapFindString(&map, TestStringKey(memory, i), (void**)&value) != ACR_INFO_OK) || ((*value) != i))
+			{
+				ACR_DEBUG_PRINT(12, "FAIL key %s was not found", memory);
+				ACR_HashMapDeInit(&map);
+				return ACR_FAILURE;
+			}
+		}
+		for(i = 0; i < TEST_KEY_COUNT; i++)
+		{
+			if(((i % 8) != 0) && (ACR_HashMapRemoveString(&map, TestStringKey(memory, i)) != ACR_INFO_OK))
+			{
+				ACR_DEBUG_PRINT(13, "FAIL key %s was not removed", memory);
+				ACR_HashMapDeInit(&map);
+				return ACR_FAILURE;
+			}
+		}
+		for(i = 0; i < TEST_KEY_COUNT; i += 8)
+		{
+			ACR_HashMapRemoveString(&map, TestStringKey(memory, i));
+		}
+		if((map.m_Count != 0) || (map.m_KeysUsed != 0))
+		{
+			ACR_DEBUG_PRINT(14, "FAIL the map has %d keys after removing every key", (int)map.m_Count);
+			ACR_HashMapDeInit(&map);
+			return ACR_FAILURE;
+		}
+	}
+
+	for(i = 0; i < TEST_KEY_COUNT; i++)
+	{
+		ACR_HashMapAddString(&map, TestStringKey(memory, i), (void**)&value);
+		(*value) = i;
+	}
+	for(i = 0; i < TEST_KEY_COUNT; i++)
+	{
+		if((i % 2) != 0)
+		{
+			ACR_HashMapRemoveString(&map, TestStringKey(memory, i));
+		}
+	}
+	// growing the map moves the key bytes of the keys that
+	// are left into new memory
+	for(i = TEST_KEY_COUNT; i < (4 * TEST_KEY_COUNT); i++)
+	{
+		ACR_HashMapAddString(&map, TestStringKey(memory, i), (void**)&value);
+		(*value) = i;
+	}
+	if(map.m_KeysRemoved != 0)
+	{
+		ACR_DEBUG_PRINT(15, "FAIL %d bytes of removed keys were not reused", (int)map.m_KeysRemoved);
+		ACR_HashMapDeInit(&map);
+		return ACR_FAILURE;
+	}
+
+	while(ACR_HashMapNextString(&map, &position, &key, (void**)&value) == ACR_INFO_OK)
+	{
+		TestStringKey(memory, (*value));
+		if(((((*value) % 2) != 0) && ((*value) < TEST_KEY_COUNT)) || (key.m_Buffer.m_Length != (ACR_Length_t)strlen(memory)) ||
+		   (memcmp(key.m_Buffer.m_Pointer, memory, (size_t)key.m_Buffer.m_Length) != 0) || (key.m_Count != TestStringKey(memory, (*value)).m_Count))
+		{
+			ACR_DEBUG_PRINT(16, "FAIL visited key %s with the wrong value %d", memory, (*value));
+			ACR_HashMapDeInit(&map);
+			return ACR_FAILURE;
+		}
+		visited++;
+	}
+	if(visited != ((TEST_KEY_COUNT / 2) + (3 * TEST_KEY_COUNT)))
+	{
+		ACR_DEBUG_PRINT(17, "FAIL visited %d keys", visited);
+		ACR_HashMapDeInit(&map);
+		return ACR_FAILURE;
+	}
+
+	// the empty string is a key like any other
+	key = ACR_StringFromMemory((ACR_Byte_t*)"", ACR_MAX_LENGTH, ACR_MAX_COUNT);
+	if((ACR_HashMapFindString(&map, key, ACR_NULL) != ACR_INFO_UNKNOWN) || (ACR_HashMapAddString(&map, key, ACR_NULL) != ACR_INFO_NEW) ||
+	   (ACR_HashMapFindString(&map, key, ACR_NULL) != ACR_INFO_OK) || (ACR_HashMapRemoveString(&map, key) != ACR_INFO_OK))
+	{
+		ACR_DEBUG_PRINT(18, "FAIL the empty string is not a key");
+		ACR_HashMapDeInit(&map);
+		return ACR_FAILURE;
+	}
+
+	ACR_HashMapDeInit(&map);
+	return ACR_SUCCESS;
+}
+
+/**********************************************************/
+int HashMapReserveTest(void)
+{
+	ACR_HashMap_t set;
+	ACR_Count_t capacity;
+	void* value;
+	int i;
+
+	// a map with no values is a set of keys
+	ACR_HashMapInit(&set, ACR_HASHMAP_KEYS_INTEGER, 0);
+	if((ACR_HashMapReserve(&set, TEST_KEY_COUNT) != ACR_INFO_OK) || (set.m_Capacity < TEST_KEY_COUNT))
+	{
+		ACR_DEBUG_PRINT(19, "FAIL reserve did not make room for %d keys", TEST_KEY_COUNT);
+		ACR_HashMapDeInit(&set);
+		return ACR_FAILURE;
+	}
+	capacity = set.m_Capacity;
+	for(i = 0; i < TEST_KEY_COUNT; i++)
+	{
+		if(ACR_HashMapAddInteger(&set, (ACR_Length_t)i, &value) != ACR_INFO_NEW)
+		{
+			ACR_DEBUG_PRINT(20, "FAIL key %d was not added", i);
+			ACR_HashMapDeInit(&set);
+			return ACR_FAILURE;
+		}
+	}
+	if(set.m_Capacity != capacity)
+	{
+		ACR_DEBUG_PRINT(21, "FAIL the map grew after reserve");
+		ACR_HashMapDeInit(&set);
+		return ACR_FAILURE;
+	}
+
+	ACR_HashMapClear(&set);
+	if((set.m_Count != 0) || (set.m_Capacity != capacity) || (ACR_HashMapFindInteger(&set, 5, ACR_NULL) != ACR_INFO_UNKNOWN) ||
+	   (ACR_HashMapAddInteger(&set, 5, ACR_NULL) != ACR_INFO_NEW) || (ACR_HashMapFindInteger(&set, 5, ACR_NULL) != ACR_INFO_OK))
+	{
+		ACR_DEBUG_PRINT(22, "FAIL the map was not empty after clear");
+		ACR_HashMapDeInit(&set);
+		return ACR_FAILURE;
+	}
+
+	ACR_HashMapDeInit(&set);
+	return ACR_SUCCESS;
+}
+
+/** a node of the chained hash table in the benchmark
+*/
+typedef struct TestChainNode_s
+{
+	struct TestChainNode_s* m_Next;
+	ACR_Length_t m_Key;
+	ACR_Length_t m_Value;
+} TestChainNode_t;
+
+/** a chained hash table like most libraries use, with one
+    allocation per key
+*/
+typedef struct TestChain_s
+{
+	TestChainNode_t** m_Buckets;
+	ACR_Length_t m_Mask;
+	ACR_Length_t m_Count;
+} TestChain_t;
+
+/** the same mixing of integer keys as the map
+*/
+static ACR_Length_t TestChainHash(
+	ACR_Length_t key)
+{
+	#if ACR_USE_64BIT == ACR_BOOL_TRUE
+	key ^= key >> 33;
+	key *= 0xFF51AFD7ED558CCDULL;
+	key ^= key >> 33;
+	key *= 0xC4CEB9FE1A85EC53ULL;
+	key ^= key >> 33;
+	#else
+	key ^= key >> 16;
+	key *= 0x85EBCA6BUL;
+	key ^= key >> 13;
+	key *= 0xC2B2AE35UL;
+	key ^= key >> 16;
+	#endif
+	return key;
+}
+
+/** add a key to the chained hash table, doubling the buckets
+    when there is more than one key per bucket
+*/
+static ACR_Length_t* TestChainAdd(
+	TestChain_t* me,
+	ACR_Length_t key)
+{
+	TestChainNode_t** buckets;
+	TestChainNode_t* node;
+	TestChainNode_t* next;
+	ACR_Length_t i;
+	ACR_Length_t hash = TestChainHash(key);
+
+	for(node = me->m_Buckets[hash & me->m_Mask]; node != ACR_NULL; node = node->m_Next)
+	{
+		if(node->m_Key == key)
+		{
+			return &node->m_Value;
+		}
+	}
+	if(me->m_Count > me->m_Mask)
+	{
+		buckets = (TestChainNode_t**)calloc((size_t)((me->m_Mask + 1) * 2), sizeof(TestChainNode_t*));
+		if(buckets == ACR_NULL)
+		{
+			return ACR_NULL;
+		}
+		for(i = 0; i <= me->m_Mask; i++)
+		{
+			for(node = me->m_Buckets[i]; node != ACR_NULL; node = next)
+			{
+				next = node->m_Next;
+				node->m_Next = buckets[TestChainHash(node->m_Key) & ((me->m_Mask * 2) + 1)];
+				buckets[TestChainHash(node->m_Key) & ((me->m_Mask * 2) + 1)] = node;
+			}
+		}
+		free(me->m_Buckets);
+		me->m_Buckets = buckets;
+		me->m_Mask = (me->m_Mask * 2) + 1;
+	}
+	node = (TestChainNode_t*)malloc(sizeof(TestChainNode_t));
+	if(node == ACR_NULL)
+	{
+		return ACR_NULL;
+	}
+	node->m_Key = key;
+	node->m_Value = 0;
+	node->m_Next = me->m_Buckets[hash & me->m_Mask];
+	me->m_Buckets[hash & me->m_Mask] = node;
+	me->m_Count++;
+	return &node->m_Value;
+}
+
+/** find a key in the chained hash table
+*/
+static ACR_Length_t* TestChainFind(
+	const TestChain_t* me,
+	ACR_Length_t key)
+{
+	TestChainNode_t* node;
+	for(node = me->m_Buckets[TestChainHash(key) & me->m_Mask]; node != ACR_NULL; node = node->m_Next)
+	{
+		if(node->m_Key == key)
+		{
+			return &node->m_Value;
+		}
+	}
+	return ACR_NULL;
+}
+
+/** free the chained hash table
+*/
+static void TestChainFree(
+	TestChain_t* me)
+{
+	TestChainNode_t* node;
+	TestChainNode_t* next;
+	ACR_Length_t i;
+	for(i = 0; i <= me->m_Mask; i++)
+	{
+		for(node = me->m_Buckets[i]; node != ACR_NULL; node = next)
+		{
+			next = node->m_Next;
+			free(node);
+		}
+	}
+	free(me->m_Buckets);
+}
+
+/**********************************************************/
+int HashMapBenchmark(void)
+{
+	ACR_HashMap_t map;
+	TestChain_t chain;
+	ACR_Length_t* value;
+	ACR_Length_t sum;
+	ACR_Length_t chainSum;
+	ACR_Length_t count;
+	ACR_Length_t i;
+	double start;
+	double mapAdd;
+	double mapFind;
+	double mapMiss;
+	double chainAdd;
+	double chainFind;
+	double chainMiss;
+
+	for(count = 1000; count <= TEST_HASHMAP_MAX_COUNT; count *= 10)
+	{
+		chain.m_Mask = 15;
+		chain.m_Count = 0;
+		chain.m_Buckets = (TestChainNode_t**)calloc(16, sizeof(TestChainNode_t*));
+		if(chain.m_Buckets == ACR_NULL)
+		{
+			return ACR_SUCCESS;
+		}
+		ACR_HashMapInit(&map, ACR_HASHMAP_KEYS_INTEGER, sizeof(ACR_Length_t));
+		sum = 0;
+		chainSum = 0;
+
+		// the keys that are found are the even keys and the
+		// keys that are missing are the odd keys
+		start = ACR_TimerSeconds();
+		for(i = 0; i < count; i++)
+		{
+			if(ACR_HashMapAddInteger(&map, i * 2, (void**)&value) != ACR_INFO_NEW)
+			{
+				break;
+			}
+			(*value) = i;
+		}
+		mapAdd = ACR_TimerSeconds() - start;
+		start = ACR_TimerSeconds();
+		for(i = 0; i < count; i++)
+		{
+			value = TestChainAdd(&chain, i * 2);
+			if(value == ACR_NULL)
+			{
+				break;
+			}
+			(*value) = i;
+		}
+		chainAdd = ACR_TimerSeconds() - start;
+
+		start = ACR_TimerSeconds();
+		for(i = 0; i < count; i++)
+		{
+			if(ACR_HashMapFindInteger(&map, ((i * 7919) % count) * 2, (void**)&value) == ACR_INFO_OK)
+			{
+				sum += (*value);
+			}
+		}
+		mapFind = ACR_TimerSeconds() - start;
+		start = ACR_TimerSeconds();
+		for(i = 0; i < count; i++)
+		{
+			value = TestChainFind(&chain, ((i * 7919) % count) * 2);
+			if(value != ACR_NULL)
+			{
+				chainSum += (*value);
+			}
+		}
+		chainFind = ACR_TimerSeconds() - start;
+
+		start = ACR_TimerSeconds();
+		for(i = 0; i < count; i++)
+		{
+			if(ACR_HashMapFindInteger(&map, (i * 2) + 1, ACR_NULL) == ACR_INFO_OK)
+			{
+				sum++;
+			}
+		}
+		mapMiss = ACR_TimerSeconds() - start;
+		start = ACR_TimerSeconds();
+		for(i = 0; i < count; i++)
+		{
+			if(TestChainFind(&chain, (i * 2) + 1) != ACR_NULL)
+			{
+				chainSum++;
+			}
+		}
+		chainMiss = ACR_TimerSeconds() - start;
+
+		if((mapAdd > 0) && (mapFind > 0) && (mapMiss > 0) && (chainAdd > 0) && (chainFind > 0) && (chainMiss > 0))
+		{
+			ACR_DEBUG_PRINT(23, "BENCHMARK %lu keys M/s add, find, miss ACR_HashMap_t %.1f %.1f %.1f chained %.1f %.1f %.1f",
+				(unsigned long)count,
+				(double)count / (mapAdd * 1000000.0), (double)count / (mapFind * 1000000.0), (double)count / (mapMiss * 1000000.0),
+				(double)count / (chainAdd * 1000000.0), (double)count / (chainFind * 1000000.0), (double)count / (chainMiss * 1000000.0));
+		}
+
+		ACR_HashMapDeInit(&map);
+		TestChainFree(&chain);
+
+		if((sum != chainSum) || (sum != ((count * (count - 1)) / 2)))
+		{
+			ACR_DEBUG_PRINT(24, "FAIL benchmark found different values with %lu keys", (unsigned long)count);
+			return ACR_FAILURE;
+		}
+	}
+	return ACR_SUCCESS;
+}
@@ -0,0 +1,375 @@
+/*
+
+    ********** DO NOT REMOVE THIS INFORMATION ************
+
+    ACR - A set of C functions in a git Repository
+    Copyright (C) 2018 - 2020 Adam C. Rosenberg
+
+    Please read LICENSE before using this code
+
+    Please read README.md for instructions on including
+    this code in your project and where to find examples
+
+    If you contribute to this code, Please add your name
+    and email address to the AUTHORS list below so that
+    we know who to thank!
+
+    AUTHORS
+
+    Adam Rosenberg <adam@sirspot.com>
+
+    LICENSE
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+    ******************************************************
+
+*/
+/** \file test_normalize.c
+
+    application to test unicode normalization
+
+*/
+#include "ACR/normalize.h"
+#include "ACR/utf8.h"
+
+//
+// PROTOTYPES
+//
+
+/** example to normalize strings to NFC and NFD
+*/
+int NormalizeTest(void);
+
+/** normalize random strings of characters that compose and
+    decompose and check that the results agree
+*/
+int RandomNormalizeTest(void);
+
+/** compare the speed of ACR_StringIsNormalized() and
+    ACR_StringNormalize() for text that is already normalized
+*/
+int NormalizeBenchmark(void);
+
+//
+// MAIN
+//
+
+int main(int argc, char** argv)
+{
+	int result = ACR_SUCCESS;
+
+	ACR_UNUSED(argc);
+	ACR_UNUSED(argv);
+
+	result |= NormalizeTest();
+	result |= RandomNormalizeTest();
+
+	result |= NormalizeBenchmark();
+
+	return result;
+}
+
+//
+// IMPLEMENTATION
+//
+
+/** check that a string normalizes to the expected bytes
+*/
+static int NormalizeTestExpect(
+	const char* text,
+	ACR_NormalForm_t form,
+	const char* expected)
+{
+	ACR_VarBuffer_t dst;
+	ACR_STRING(src);
+	ACR_String_t normalized;
+	ACR_Info_t info;
+	int result = ACR_SUCCESS;
+
+	ACR_VarBufferInit(&dst);
+	ACR_STRING_REFERENCE(src, (void*)text, (ACR_Length_t)strlen(text), ACR_MAX_COUNT);
+	info = ACR_StringNormalize(src, form, &dst, &normalized);
+	if((normalized.m_Buffer.m_Length != (ACR_Length_t)strlen(expected)) ||
+	   (memcmp(normalized.m_Buffer.m_Pointer, expected, strlen(expected)) != 0))
+	{
+		result = ACR_FAILURE;
+	}
+	else if(strcmp(text, expected) == 0)
+	{
+		// no copy when nothing changes
+		if((info != ACR_INFO_EQUAL) || (normalized.m_Buffer.m_Pointer != src.m_Buffer.m_Pointer) || (dst.m_Buffer.m_Length != 0))
+		{
+			result = ACR_FAILURE;
+		}
+	}
+	else if(info != ACR_INFO_NOT_EQUAL)
+	{
+		result = ACR_FAILURE;
+	}
+
+	// the result is normalized
+	if(ACR_StringIsNormalized(normalized, form) == ACR_INFO_NO)
+	{
+		result = ACR_FAILURE;
+	}
+	ACR_VarBufferDeInit(&dst);
+	return result;
+}
+
+/**********************************************************/
+int NormalizeTest(void)
+{
+	int result = ACR_SUCCESS;
+	ACR_VarBuffer_t dst;
+	ACR_STRING(src);
+	ACR_String_t normalized;
+	int i;
+
+	// text, NFC, NFD
+	const char* tests[][3] = {
+		{"plain ascii", "plain ascii", "plain ascii"},
+		{"caf\xC3\xA9", "caf\xC3\xA9", "cafe\xCC\x81"},
+		{"cafe\xCC\x81", "caf\xC3\xA9", "cafe\xCC\x81"},
+		{"A\xCC\x8A", "\xC3\x85", "A\xCC\x8A"},
+		{"\xE2\x84\xAB", "\xC3\x85", "A\xCC\x8A"},
+		{"\xE1\xB9\xA9", "\xE1\xB9\xA9", "s\xCC\xA3\xCC\x87"},
+		{"s\xCC\x87\xCC\xA3", "\xE1\xB9\xA9", "s\xCC\xA3\xCC\x87"},
+		{"\xE1\xB8\x8B\xCC\xA3", "\xE1\xB8\x8D\xCC\x87", "d\xCC\xA3\xCC\x87"},
+		{"q\xCC\x87\xCC\xA3", "q\xCC\xA3\xCC\x87", "q\xCC\xA3\xCC\x87"},
+		{"\xEA\xB0\x80\xED\x9E\xA3", "\xEA\xB0\x80\xED\x9E\xA3", "\xE1\x84\x80\xE1\x85\xA1\xE1\x84\x92\xE1\x85\xB5\xE1\x87\x82"},
+		{"\xE1\x84\x80\xE1\x85\xA1\xE1\x86\xA8", "\xEA\xB0\x81", "\xE1\x84\x80\xE1\x85\xA1\xE1\x86\xA8"},
+		{"\xE0\xA5\x98", "\xE0\xA4\x95\xE0\xA4\xBC", "\xE0\xA4\x95\xE0\xA4\xBC"},
+		{"\xE2\x84\xA6", "\xCE\xA9", "\xCE\xA9"},
+		{"e\xCC\x81\xCC\x81", "\xC3\xA9\xCC\x81", "e\xCC\x81\xCC\x81"},
+		{"\xCC\x81" "e", "\xCC\x81" "e", "\xCC\x81" "e"},
+		{"\xC3\x85\xCC\xA7", "\xC3\x85\xCC\xA7", "A\xCC\xA7\xCC\x8A"},
+		{"\xC7\x95", "\xC7\x95", "U\xCC\x88\xCC\x84"},
+		{"\xE1\xBE\x82", "\xE1\xBE\x82", "\xCE\xB1\xCC\x93\xCC\x80\xCD\x85"},
+		{"\xF0\x9D\x85\x9E", "\xF0\x9D\x85\x97\xF0\x9D\x85\xA5", "\xF0\x9D\x85\x97\xF0\x9D\x85\xA5"},
+		{"\xF0\x91\x82\x99\xF0\x91\x82\xBA", "\xF0\x91\x82\x9A", "\xF0\x91\x82\x99\xF0\x91\x82\xBA"},
+		{"\xE2\xBE\xA1" "d", "\xE2\xBE\xA1" "d", "\xE2\xBE\xA1" "d"},
+		{"A\xCC\x88\xCC\x81\xCC\xA3", "\xE1\xBA\xA0\xCC\x88\xCC\x81", "A\xCC\xA3\xCC\x88\xCC\x81"}
+	};
+
+	for(i = 0; i < (int)(sizeof(tests) / sizeof(tests[0])); i++)
+	{
+		if(NormalizeTestExpect(tests[i][0], ACR_NORMAL_FORM_NFC, tests[i][1]) != ACR_SUCCESS)
+		{
+			ACR_DEBUG_PRINT(1, "FAIL NFC of test %d", i);
+			result = ACR_FAILURE;
+		}
+		if(NormalizeTestExpect(tests[i][0], ACR_NORMAL_FORM_NFD, tests[i][2]) != ACR_SUCCESS)
+		{
+			ACR_DEBUG_PRINT(2, "FAIL NFD of test %d", i);
+			result = ACR_FAILURE;
+		}
+	}
+
+	// quick check
+	ACR_STRING_REFERENCE(src, (void*)"cafe\xCC\x81", 6, 5);
+	if((ACR_StringIsNormalized(src, ACR_NORMAL_FORM_NFD) != ACR_INFO_YES) ||
+	   (ACR_StringIsNormalized(src, ACR_NORMAL_FORM_NFC) != ACR_INFO_UNKNOWN))
+	{
+		ACR_DEBUG_PRINT(3, "FAIL quick check of combining acute accent");
+		result = ACR_FAILURE;
+	}
+	ACR_STRING_REFERENCE(src, (void*)"caf\xC3\xA9", 5, 4);
+	if((ACR_StringIsNormalized(src, ACR_NORMAL_FORM_NFD) != ACR_INFO_NO) ||
+	   (ACR_StringIsNormalized(src, ACR_NORMAL_FORM_NFC) != ACR_INFO_YES))
+	{
+		ACR_DEBUG_PRINT(4, "FAIL quick check of e with acute accent");
+		result = ACR_FAILURE;
+	}
+
+	// invalid UTF8
+	ACR_VarBufferInit(&dst);
+	ACR_STRING_REFERENCE(src, (void*)"caf\xC3", 4, 4);
+	if((ACR_StringIsNormalized(src, ACR_NORMAL_FORM_NFC) != ACR_INFO_INVALID) ||
+	   (ACR_StringNormalize(src, ACR_NORMAL_FORM_NFC, &dst, &normalized) != ACR_INFO_INVALID))
+	{
+		ACR_DEBUG_PRINT(5, "FAIL invalid UTF8 was normalized");
+		result = ACR_FAILURE;
+	}
+	ACR_VarBufferDeInit(&dst);
+
+	return result;
+}
+
+/** normalize a string and keep a copy of the result
+*/
+static ACR_Length_t RandomNormalizeTestCopy(
+	const ACR_Byte_t* text,
+	ACR_Length_t length,
+	ACR_NormalForm_t form,
+	ACR_Byte_t* copy)
+{
+	ACR_VarBuffer_t dst;
+	ACR_STRING(src);
+	ACR_String_t normalized;
+
+	ACR_VarBufferInit(&dst);
+	ACR_STRING_REFERENCE(src, (void*)text, length, ACR_MAX_COUNT);
+	ACR_StringNormalize(src, form, &dst, &normalized);
+	length = normalized.m_Buffer.m_Length;
+	memcpy(copy, normalized.m_Buffer.m_Pointer, (size_t)length);
+	ACR_VarBufferDeInit(&dst);
+	return length;
+}
+
+/**********************************************************/
+int RandomNormalizeTest(void)
+{
+	int result = ACR_SUCCESS;
+	ACR_Byte_t text[200];
+	ACR_Byte_t nfc[800];
+	ACR_Byte_t nfd[800];
+	ACR_Byte_t again[800];
+	ACR_Length_t length;
+	ACR_Length_t nfcLength;
+	ACR_Length_t nfdLength;
+	ACR_Length_t againLength;
+	ACR_STRING(str);
+	int count;
+	int test;
+	int i;
+
+	// starters, combining marks of different classes,
+	// precomposed characters, and hangul
+	const ACR_Unicode_t chars[] = {
+		0x0041, 0x0065, 0x0073, 0x0064, 0x0071, 0x00C5, 0x00E9, 0x01D5, 0x1E69, 0x1E0B,
+		0x0300, 0x0301, 0x0307, 0x0308, 0x0323, 0x0327, 0x0345, 0x0313, 0x212B, 0x2126,
+		0x1100, 0x1161, 0x11A8, 0xAC00, 0xAC01, 0x0958, 0x0915, 0x093C, 0x1F82, 0x03B1
+	};
+
+	srand(6);
+	for(test = 0; (test < 3000) && (result == ACR_SUCCESS); test++)
+	{
+		length = 0;
+		count = rand() % 12;
+		for(i = 0; i < count; i++)
+		{
+			length += (ACR_Length_t)ACR_UnicodeToUtf8(chars[rand() % (int)(sizeof(chars) / sizeof(chars[0]))], text + length);
+		}
+
+		// NFC(NFD(x)) == NFC(x) and NFD(NFC(x)) == NFD(x) and
+		// normalizing again changes nothing
+		nfcLength = RandomNormalizeTestCopy(text, length, ACR_NORMAL_FORM_NFC, nfc);
+		nfdLength = RandomNormalizeTestCopy(text, length, ACR_NORMAL_FORM_NFD, nfd);
+		againLength = RandomNormalizeTestCopy(nfd, nfdLength, ACR_NORMAL_FORM_NFC, again);
+		if((againLength != nfcLength) || (memcmp(again, nfc, (size_t)nfcLength) != 0))
+		{
+			result = ACR_FAILURE;
+		}
+		againLength = RandomNormalizeTestCopy(nfc, nfcLength, ACR_NORMAL_FORM_NFD, again);
+		if((againLength != nfdLength) || (memcmp(again, nfd, (size_t)nfdLength) != 0))
+		{
+			result = ACR_FAILURE;
+		}
+		ACR_STRING_REFERENCE(str, nfc, nfcLength, ACR_MAX_COUNT);
+		if(ACR_StringIsNormalized(str, ACR_NORMAL_FORM_NFC) == ACR_INFO_NO)
+		{
+			result = ACR_FAILURE;
+		}
+		ACR_STRING_REFERENCE(str, nfd, nfdLength, ACR_MAX_COUNT);
+		if(ACR_StringIsNormalized(str, ACR_NORMAL_FORM_NFD) != ACR_INFO_YES)
+		{
+			result = ACR_FAILURE;
+		}
+		if(result != ACR_SUCCESS)
+		{
+			ACR_DEBUG_PRINT(1, "FAIL random normalize test %d", test);
+		}
+	}
+
+	return result;
+}
+
+/**********************************************************/
+int NormalizeBenchmark(void)
+{
+	int result = ACR_SUCCESS;
+	ACR_VarBuffer_t text;
+	ACR_VarBuffer_t dst;
+	ACR_STRING(src);
+	ACR_String_t normalized;
+	const char* texts[] = {
+		"user_name=john.smith@example.com&id=12345 ",
+		"Fran\xC3\xA7ois M\xC3\xBCller \xC3\x85sa Se\xC3\xB1or caf\xC3\xA9 "
+	};
+	const char* names[] = {"ascii", "latin"};
+	double start;
+	double checkTime;
+	double normalizeTime;
+	double megabytes;
+	int repeat;
+	int i;
+
+	ACR_VarBufferInit(&text);
+	ACR_VarBufferInit(&dst);
+	ACR_UNUSED(names);
+
+	for(i = 0; (i < 2) && (result == ACR_SUCCESS); i++)
+	{
+		ACR_VarBufferSetLength(&text, 0);
+		while(text.m_Buffer.m_Length < (1024 * 1024))
+		{
+			if(ACR_VarBufferReserve(&text, text.m_Buffer.m_Length + (ACR_Length_t)strlen(texts[i])) != ACR_INFO_OK)
+			{
+				// not enough memory to run the benchmark
+				result = ACR_FAILURE;
+				break;
+			}
+			ACR_VarBufferAppend(&text, (void*)texts[i], (ACR_Length_t)strlen(texts[i]));
+		}
+		ACR_STRING_REFERENCE(src, text.m_Buffer.m_Pointer, text.m_Buffer.m_Length, ACR_MAX_COUNT);
+		megabytes = (8.0 * (double)text.m_Buffer.m_Length) / (1024.0 * 1024.0);
+		ACR_UNUSED(megabytes);
+
+		start = ACR_TimerSeconds();
+		for(repeat = 0; repeat < 8; repeat++)
+		{
+			if(ACR_StringIsNormalized(src, ACR_NORMAL_FORM_NFC) != ACR_INFO_YES)
+			{
+				result = ACR_FAILURE;
+			}
+		}
+		checkTime = ACR_TimerSeconds() - start;
+
+		start = ACR_TimerSeconds();
+		for(repeat = 0; repeat < 8; repeat++)
+		{
+			if(ACR_StringNormalize(src, ACR_NORMAL_FORM_NFC, &dst, &normalized) != ACR_INFO_EQUAL)
+			{
+				result = ACR_FAILURE;
+			}
+		}
+		normalizeTime = ACR_TimerSeconds() - start;
+
+		if(result != ACR_SUCCESS)
+		{
+			ACR_DEBUG_PRINT(1, "FAIL %s text is not NFC", names[i]);
+		}
+		else if((checkTime > 0) && (normalizeTime > 0))
+		{
+			ACR_DEBUG_PRINT(2, "BENCHMARK %s NFC MB/s ACR_StringIsNormalized %.0f ACR_StringNormalize %.0f", names[i], megabytes / checkTime, megabytes / normalizeTime);
+		}
+	}
+
+	ACR_VarBufferDeInit(&text);
+	ACR_VarBufferDeInit(&dst);
+
+	return result;
+}
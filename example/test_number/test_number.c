@@ -0,0 +1,826 @@
+/*
+
+    ********** DO NOT REMOVE THIS INFORMATION ************
+
+    ACR - A set of C functions in a git Repository
+    Copyright (C) 2018 - 2020 Adam C. Rosenberg
+
+    Please read LICENSE before using this code
+
+    Please read README.md for instructions on including
+    this code in your project and where to find examples
+
+    If you contribute to this code, Please add your name
+    and email address to the AUTHORS list below so that
+    we know who to thank!
+
+    AUTHORS
+
+    Adam Rosenberg <adam@sirspot.com>
+
+    LICENSE
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+    ******************************************************
+
+*/
+/** \file test_number.c
+
+    application to test conversion between numbers and text
+
+*/
+#include "ACR/number.h"
+
+#include <stdio.h>
+#include <errno.h>
+#include <math.h>
+
+//
+// PROTOTYPES
+//
+
+/** check ACR_StringToInt64() and ACR_StringToUInt64() with
+    examples and against strtoll() and strtoull()
+*/
+int IntegerParseTest(void);
+
+/** check that ACR_StringToDouble() gives exactly the same
+    double as strtod() for examples and random numbers
+*/
+int DoubleParseTest(void);
+
+/** compare the speed of ACR_StringToDouble() and
+    ACR_StringToInt64() with strtod() and strtoll()
+*/
+int ParseBenchmark(void);
+
+/** check ACR_VarBufferAppendInt64() and
+    ACR_VarBufferAppendUInt64() against snprintf()
+*/
+int IntegerFormatTest(void);
+
+/** check that ACR_VarBufferAppendDouble() and
+    ACR_VarBufferAppendDecimal() write the shortest text
+	that converts back to the same value
+*/
+int DoubleFormatTest(void);
+
+/** compare the speed of ACR_VarBufferAppendDouble() and
+    ACR_VarBufferAppendInt64() with snprintf()
+*/
+int FormatBenchmark(void);
+
+//
+// MAIN
+//
+
+int main(int argc, char** argv)
+{
+	int result = ACR_SUCCESS;
+
+	ACR_UNUSED(argc);
+	ACR_UNUSED(argv);
+
+	#if ACR_USE_64BIT == ACR_BOOL_TRUE
+	result |= IntegerParseTest();
+	result |= DoubleParseTest();
+	result |= IntegerFormatTest();
+	result |= DoubleFormatTest();
+
+	result |= ParseBenchmark();
+	result |= FormatBenchmark();
+	#endif
+
+	return result;
+}
+
+//
+// IMPLEMENTATION
+//
+
+#if ACR_USE_64BIT == ACR_BOOL_TRUE
+
+/** get a string that references null-terminated text
+*/
+static ACR_String_t TestString(
+	const char* text)
+{
+	ACR_STRING(string);
+	ACR_STRING_REFERENCE(string, text, strlen(text), ACR_EMPTY_VALUE);
+	return string;
+}
+
+/**********************************************************/
+int IntegerParseTest(void)
+{
+	const char* texts[] = {
+		"0", "-0", "+7", "123abc", "-9223372036854775808", "9223372036854775807",
+		"9223372036854775808", "-9223372036854775809", "18446744073709551615", "18446744073709551616",
+		"000000000000000000000000000042", "99999999999999999999", "12345678", "1234567890123456789",
+		"-", "+", "", "x1", " 1", "1 ", "12345678a", "0x10"
+	};
+	char text[64];
+	ACR_Int64_t value;
+	ACR_UInt64_t unsignedValue;
+	ACR_Length_t consumed;
+	ACR_Info_t result;
+	ACR_Info_t expected;
+	long long expectedValue;
+	unsigned long long expectedUnsigned;
+	char* end;
+	int test;
+	int i;
+	int length;
+
+	srand(40);
+	for(test = 0; test < 20000; test++)
+	{
+		if(test < (int)(sizeof(texts) / sizeof(texts[0])))
+		{
+			strcpy(text, texts[test]);
+		}
+		else
+		{
+			// random digits with an optional sign and some
+			// text after them
+			length = rand() % 24;
+			i = 0;
+			if((rand() % 3) == 0)
+			{
+				text[i++] = ((rand() % 2) == 0) ? '-' : '+';
+			}
+			while(i < length)
+			{
+				text[i++] = (char)('0' + (rand() % 10));
+			}
+			text[i++] = ((rand() % 2) == 0) ? ',' : 0;
+			text[i] = 0;
+		}
+
+		// strtoll() skips white space and allows an empty
+		// number so skip those cases for the comparison
+		errno = 0;
+		expectedValue = strtoll(text, &end, 10);
+		if((end == text) || (text[0] == ' '))
+		{
+			expected = ACR_INFO_INVALID;
+		}
+		else if(errno == ERANGE)
+		{
+			expected = (expectedValue < 0) ? ACR_INFO_LESS : ACR_INFO_GREATER;
+		}
+		else
+		{
+			expected = ACR_INFO_OK;
+		}
+		result = ACR_StringToInt64(TestString(text), &value, &consumed);
+		if((result != expected) ||
+		   ((expected != ACR_INFO_INVALID) && ((value != expectedValue) || (consumed != (ACR_Length_t)(end - text)))) ||
+		   ((expected == ACR_INFO_INVALID) && (consumed != 0)))
+		{
+			ACR_DEBUG_PRINT(1, "FAIL \"%s\" is %lld (%d) with %d bytes instead of %lld (%d) with %d bytes",
+				text, value, (int)result, (int)consumed, expectedValue, (int)expected, (int)(end - text));
+			return ACR_FAILURE;
+		}
+
+		errno = 0;
+		expectedUnsigned = strtoull(text, &end, 10);
+		if((end == text) || (text[0] == ' ') || (text[0] == '-'))
+		{
+			expected = ACR_INFO_INVALID;
+		}
+		else if(errno == ERANGE)
+		{
+			expected = ACR_INFO_GREATER;
+		}
+		else
+		{
+			expected = ACR_INFO_OK;
+		}
+		result = ACR_StringToUInt64(TestString(text), &unsignedValue, &consumed);
+		if((result != expected) ||
+		   ((expected != ACR_INFO_INVALID) && ((unsignedValue != expectedUnsigned) || (consumed != (ACR_Length_t)(end - text)))))
+		{
+			ACR_DEBUG_PRINT(2, "FAIL \"%s\" is %llu (%d) instead of %llu (%d)",
+				text, unsignedValue, (int)result, expectedUnsigned, (int)expected);
+			return ACR_FAILURE;
+		}
+	}
+
+	return ACR_SUCCESS;
+}
+
+/** check one double against strtod()
+*/
+static int DoubleParseTestText(
+	const char* text)
+{
+	double value = 0;
+	double expected;
+	ACR_Length_t consumed;
+	ACR_Info_t result;
+	char* end;
+
+	expected = strtod(text, &end);
+	result = ACR_StringToDouble(TestString(text), &value, &consumed);
+	if(end == text)
+	{
+		if(result != ACR_INFO_INVALID)
+		{
+			ACR_DEBUG_PRINT(3, "FAIL \"%s\" is not a number", text);
+			return ACR_FAILURE;
+		}
+		return ACR_SUCCESS;
+	}
+	if((result != ACR_INFO_OK) || (consumed != (ACR_Length_t)(end - text)) ||
+	   ((memcmp(&value, &expected, sizeof(double)) != 0) && ((value == value) || (expected == expected))))
+	{
+		ACR_DEBUG_PRINT(4, "FAIL \"%s\" is %.17g with %d bytes instead of %.17g with %d bytes",
+			text, value, (int)consumed, expected, (int)(end - text));
+		return ACR_FAILURE;
+	}
+	return ACR_SUCCESS;
+}
+
+/** get a random double from random bits
+*/
+static double DoubleParseTestRandom(void)
+{
+	ACR_UInt64_t bits = 0;
+	double value;
+	int i;
+	for(i = 0; i < 4; i++)
+	{
+		bits = (bits << 16) ^ (ACR_UInt64_t)(rand() & 0xFFFF);
+	}
+	memcpy(&value, &bits, sizeof(value));
+	return value;
+}
+
+/**********************************************************/
+int DoubleParseTest(void)
+{
+	const char* texts[] = {
+		"0", "-0", "0.0", ".5", "5.", ".", "-.e1", "1e", "1e+", "1e-5x", "1E5", "+1.5e+3",
+		"inf", "-Infinity", "INFINITE", "nan", "NaN", "-nan", "in", "1.7976931348623157e308",
+		"1.7976931348623159e308", "2.2250738585072011e-308", "2.2250738585072014e-308",
+		"4.9406564584124654e-324", "2.4703282292062327e-324", "2.4703282292062328e-324",
+		"9007199254740993", "9007199254740993.0000000000000000000001", "9007199254740992.9999999999999999999999",
+		"123456789012345678901234567890", "0.000000000000000000000000000000000000001",
+		"1e-400", "1e400", "1e99999999999999999999", "1e-99999999999999999999", "0e999999",
+		"7.2057594037927933e16", "1.00000000000000011102230246251565404236316680908203125",
+		"1.00000000000000011102230246251565404236316680908203124",
+		"1.00000000000000011102230246251565404236316680908203126",
+		"0.1", "0.2", "0.3", "3.14159265358979323846", "1,5", "12345678.12345678e-8"
+	};
+	char text[1200];
+	double value;
+	long double half;
+	double next;
+	int test;
+	int length;
+	int i;
+
+	for(test = 0; test < (int)(sizeof(texts) / sizeof(texts[0])); test++)
+	{
+		if(DoubleParseTestText(texts[test]) != ACR_SUCCESS)
+		{
+			return ACR_FAILURE;
+		}
+	}
+
+	srand(40);
+	for(test = 0; test < 200000; test++)
+	{
+		switch(test % 4)
+		{
+			case 0:
+				// shortest and full precision text of random
+				// doubles
+				value = DoubleParseTestRandom();
+				snprintf(text, sizeof(text), "%.*g", 1 + (rand() % 17), value);
+				break;
+			case 1:
+				// random digits and exponents
+				length = 1 + (rand() % 30);
+				for(i = 0; i < length; i++)
+				{
+					text[i] = (char)('0' + (rand() % 10));
+				}
+				if((rand() % 2) == 0)
+				{
+					text[rand() % length] = '.';
+				}
+				snprintf(text + length, sizeof(text) - (size_t)length, "e%d", (rand() % 700) - 350);
+				break;
+			case 2:
+				// exactly half way between two doubles, which
+				// needs the exact method
+				value = DoubleParseTestRandom();
+				if((value != value) || (value == 0) || ((value - value) != 0))
+				{
+					value = 1.5;
+				}
+				next = nextafter(value, (double)HUGE_VAL);
+				half = ((long double)value + (long double)next) / 2;
+				snprintf(text, sizeof(text), "%.800Lg", half);
+				break;
+			default:
+				// a little above or below half way
+				value = DoubleParseTestRandom();
+				if((value != value) || (value == 0) || ((value - value) != 0))
+				{
+					value = 1.5;
+				}
+				next = nextafter(value, (double)HUGE_VAL);
+				half = ((long double)value + (long double)next) / 2;
+				snprintf(text, sizeof(text), "%.40Le", half);
+				break;
+		}
+		if(DoubleParseTestText(text) != ACR_SUCCESS)
+		{
+			return ACR_FAILURE;
+		}
+	}
+
+	return ACR_SUCCESS;
+}
+
+/** check that the buffer holds the text
+*/
+static int FormatTestCheck(
+	ACR_VarBuffer_t* buffer,
+	const char* expected)
+{
+	if((buffer->m_Buffer.m_Length != (ACR_Length_t)strlen(expected)) ||
+	   (memcmp(buffer->m_Buffer.m_Pointer, expected, strlen(expected)) != 0))
+	{
+		ACR_DEBUG_PRINT(7, "FAIL \"%.*s\" instead of \"%s\"",
+			(int)buffer->m_Buffer.m_Length, (const char*)buffer->m_Buffer.m_Pointer, expected);
+		return ACR_FAILURE;
+	}
+	return ACR_SUCCESS;
+}
+
+/**********************************************************/
+int IntegerFormatTest(void)
+{
+	ACR_Int64_t values[] = {
+		0, 1, -1, 9, 10, 99, 100, -100, 12345678, 123456789, 4294967295LL, 4294967296LL,
+		999999999999999999LL, 1000000000000000000LL, ACR_INT64_MAX, ACR_INT64_MIN
+	};
+	ACR_VarBuffer_t buffer;
+	char expected[128];
+	ACR_Int64_t value;
+	int result = ACR_SUCCESS;
+	int test;
+	int i;
+
+	ACR_VarBufferInit(&buffer);
+	ACR_VarBufferReserve(&buffer, 16);
+	srand(41);
+	for(test = 0; (test < 100000) && (result == ACR_SUCCESS); test++)
+	{
+		if(test < (int)(sizeof(values) / sizeof(values[0])))
+		{
+			value = values[test];
+		}
+		else
+		{
+			// random values with all numbers of digits
+			value = 0;
+			for(i = 0; i < 4; i++)
+			{
+				value = (ACR_Int64_t)(((ACR_UInt64_t)value << 16) ^ (ACR_UInt64_t)(rand() & 0xFFFF));
+			}
+			value = (ACR_Int64_t)((ACR_UInt64_t)value >> (rand() % 64));
+		}
+
+		// add to text that is already in the buffer
+		buffer.m_Buffer.m_Length = 0;
+		ACR_VarBufferAppend(&buffer, "x=", 2);
+		if((ACR_VarBufferAppendInt64(&buffer, value) != ACR_INFO_OK) ||
+		   (ACR_VarBufferAppend(&buffer, " ", 1) != ACR_INFO_OK) ||
+		   (ACR_VarBufferAppendUInt64(&buffer, (ACR_UInt64_t)value) != ACR_INFO_OK))
+		{
+			ACR_DEBUG_PRINT(8, "FAIL could not add %lld", (long long)value);
+			result = ACR_FAILURE;
+			break;
+		}
+		snprintf(expected, sizeof(expected), "x=%lld %llu", (long long)value, (unsigned long long)value);
+		result = FormatTestCheck(&buffer, expected);
+	}
+	ACR_VarBufferDeInit(&buffer);
+
+	if(ACR_VarBufferAppendInt64(ACR_NULL, 1) != ACR_INFO_ERROR)
+	{
+		ACR_DEBUG_PRINT(9, "FAIL no error without a buffer");
+		result = ACR_FAILURE;
+	}
+	return result;
+}
+
+/** count the significant digits in the text of a number
+*/
+static int FormatTestDigits(
+	const char* text)
+{
+	ACR_Length_t pos;
+	int digits = 0;
+	int started = 0;
+	for(pos = 0; (text[pos] != '\0') && (text[pos] != 'e'); pos++)
+	{
+		if((text[pos] >= '1') && (text[pos] <= '9'))
+		{
+			started = 1;
+		}
+		if((started != 0) && (text[pos] >= '0') && (text[pos] <= '9'))
+		{
+			digits++;
+		}
+	}
+	if((strchr(text, '.') == ACR_NULL) && (strchr(text, 'e') == ACR_NULL))
+	{
+		// zeros at the end of an integer are not digits
+		while((pos > 1) && (text[pos - 1] == '0'))
+		{
+			digits--;
+			pos--;
+		}
+	}
+	return digits;
+}
+
+/** check that the text of a double converts back to the
+    same double and that no text with fewer digits does
+*/
+static int DoubleFormatTestValue(
+	ACR_VarBuffer_t* buffer,
+	double value)
+{
+	char text[64];
+	char shorter[400];
+	double check;
+	ACR_Length_t consumed;
+	int digits;
+
+	buffer->m_Buffer.m_Length = 0;
+	if((ACR_VarBufferAppendDouble(buffer, value) != ACR_INFO_OK) ||
+	   (buffer->m_Buffer.m_Length >= (ACR_Length_t)sizeof(text)))
+	{
+		ACR_DEBUG_PRINT(10, "FAIL could not add %.17g", value);
+		return ACR_FAILURE;
+	}
+	memcpy(text, buffer->m_Buffer.m_Pointer, buffer->m_Buffer.m_Length);
+	text[buffer->m_Buffer.m_Length] = '\0';
+
+	if((ACR_StringToDouble(TestString(text), &check, &consumed) != ACR_INFO_OK) ||
+	   (consumed != buffer->m_Buffer.m_Length) || (memcmp(&check, &value, sizeof(double)) != 0) ||
+	   (strtod(text, ACR_NULL) != value))
+	{
+		ACR_DEBUG_PRINT(11, "FAIL \"%s\" is not %.17g", text, value);
+		return ACR_FAILURE;
+	}
+
+	digits = FormatTestDigits(text);
+	if((value != 0) && (digits > 1))
+	{
+		snprintf(shorter, sizeof(shorter), "%.*g", digits - 1, value);
+		if(strtod(shorter, ACR_NULL) == value)
+		{
+			ACR_DEBUG_PRINT(12, "FAIL \"%s\" is shorter than \"%s\"", shorter, text);
+			return ACR_FAILURE;
+		}
+	}
+	return ACR_SUCCESS;
+}
+
+/**********************************************************/
+int DoubleFormatTest(void)
+{
+	const double values[] = {
+		0.1, 0.3, -2.5, 100, 123.456, 1.0 / 3.0, 1e21, 1e20, 123456789012345678901.0, 1e-7, 1e-6,
+		5e-324, 1.7976931348623157e308, 2.2250738585072014e-308, 9007199254740992.0, 1e23, 4.35
+	};
+	const char* texts[] = {
+		"0.1", "0.3", "-2.5", "100", "123.456", "0.3333333333333333", "1e+21", "100000000000000000000",
+		"123456789012345680000", "1e-7", "0.000001", "5e-324", "1.7976931348623157e+308",
+		"2.2250738585072014e-308", "9007199254740992", "1e+23", "4.35"
+	};
+	const float decimals[] = {
+		0.1f, 0.3f, 1e-45f, 3.4028235e38f, 1.17549435e-38f, 16777216.0f, 1e10f
+	};
+	const char* decimalTexts[] = {
+		"0.1", "0.3", "1e-45", "3.4028235e+38", "1.1754944e-38", "16777216", "10000000000"
+	};
+	ACR_VarBuffer_t buffer;
+	char text[64];
+	char shorter[400];
+	double value;
+	float single;
+	float check;
+	unsigned int bits;
+	int result = ACR_SUCCESS;
+	int test;
+	int digits;
+
+	ACR_VarBufferInit(&buffer);
+
+	for(test = 0; (test < (int)(sizeof(values) / sizeof(values[0]))) && (result == ACR_SUCCESS); test++)
+	{
+		buffer.m_Buffer.m_Length = 0;
+		ACR_VarBufferAppendDouble(&buffer, values[test]);
+		result = FormatTestCheck(&buffer, texts[test]);
+	}
+	for(test = 0; (test < (int)(sizeof(decimals) / sizeof(decimals[0]))) && (result == ACR_SUCCESS); test++)
+	{
+		buffer.m_Buffer.m_Length = 0;
+		ACR_VarBufferAppendDecimal(&buffer, (ACR_Decimal_t)decimals[test]);
+		result = FormatTestCheck(&buffer, decimalTexts[test]);
+	}
+	if(result == ACR_SUCCESS)
+	{
+		buffer.m_Buffer.m_Length = 0;
+		ACR_VarBufferAppendDouble(&buffer, 0.0);
+		ACR_VarBufferAppendDouble(&buffer, -0.0);
+		ACR_VarBufferAppendDouble(&buffer, (double)HUGE_VAL);
+		ACR_VarBufferAppendDouble(&buffer, -(double)HUGE_VAL);
+		value = 0;
+		ACR_VarBufferAppendDouble(&buffer, value / value);
+		result = FormatTestCheck(&buffer, "0-0inf-infnan");
+	}
+
+	srand(410);
+	for(test = 0; (test < 100000) && (result == ACR_SUCCESS); test++)
+	{
+		value = DoubleParseTestRandom();
+		if((value != value) || ((value - value) != 0))
+		{
+			continue;
+		}
+		if((test % 4) == 0)
+		{
+			// numbers that are close to integers and small
+			// fractions
+			value = floor(fmod(value, 1e6) * 100) / 100;
+		}
+		result = DoubleFormatTestValue(&buffer, value);
+	}
+
+	// random floats must only use the digits a float needs
+	for(test = 0; (test < 100000) && (result == ACR_SUCCESS); test++)
+	{
+		bits = ((unsigned int)(rand() & 0xFFFF) << 16) ^ (unsigned int)(rand() & 0xFFFF);
+		memcpy(&single, &bits, sizeof(single));
+		if((single != single) || ((single - single) != 0))
+		{
+			continue;
+		}
+		buffer.m_Buffer.m_Length = 0;
+		ACR_VarBufferAppendDecimal(&buffer, (ACR_Decimal_t)single);
+		memcpy(text, buffer.m_Buffer.m_Pointer, buffer.m_Buffer.m_Length);
+		text[buffer.m_Buffer.m_Length] = '\0';
+		check = strtof(text, ACR_NULL);
+		for(digits = 1; digits < 9; digits++)
+		{
+			snprintf(shorter, sizeof(shorter), "%.*g", digits, (double)single);
+			if(strtof(shorter, ACR_NULL) == single)
+			{
+				break;
+			}
+		}
+		if((memcmp(&check, &single, sizeof(single)) != 0) ||
+		   ((single != 0) && (FormatTestDigits(text) > digits)))
+		{
+			ACR_DEBUG_PRINT(13, "FAIL \"%s\" is not %.9g", text, (double)single);
+			result = ACR_FAILURE;
+		}
+	}
+
+	ACR_VarBufferDeInit(&buffer);
+	return result;
+}
+
+/**********************************************************/
+int ParseBenchmark(void)
+{
+	char* memory;
+	ACR_Length_t* offsets;
+	int count = 200000;
+	int i;
+	int repeat;
+	char* end;
+	size_t pos = 0;
+	double simpleTotal = 0;
+	double total = 0;
+	double value;
+	long long simpleSum = 0;
+	long long sum = 0;
+	ACR_Int64_t integer;
+	ACR_Length_t consumed;
+	ACR_STRING(string);
+	double start;
+	double simpleTime;
+	double time;
+	double megabytes;
+	int kind;
+
+	memory = (char*)malloc((size_t)count * 32);
+	offsets = (ACR_Length_t*)malloc(((size_t)count + 1) * sizeof(ACR_Length_t));
+	if((memory == ACR_NULL) || (offsets == ACR_NULL))
+	{
+		// not enough memory to run the benchmark
+		free(memory);
+		free(offsets);
+		return ACR_SUCCESS;
+	}
+
+	srand(400);
+	for(kind = 0; kind < 2; kind++)
+	{
+		// each number is null-terminated for strtod() and
+		// strtoll()
+		pos = 0;
+		for(i = 0; i < count; i++)
+		{
+			offsets[i] = (ACR_Length_t)pos;
+			if(kind == 0)
+			{
+				pos += (size_t)snprintf(memory + pos, 32, "%.17g", ((double)rand() / (double)RAND_MAX) * 1000.0) + 1;
+			}
+			else
+			{
+				pos += (size_t)snprintf(memory + pos, 32, "%d", rand() - (RAND_MAX / 2)) + 1;
+			}
+		}
+		offsets[count] = (ACR_Length_t)pos;
+		megabytes = (4.0 * (double)pos) / (1024.0 * 1024.0);
+		ACR_UNUSED(megabytes);
+
+		start = ACR_TimerSeconds();
+		for(repeat = 0; repeat < 4; repeat++)
+		{
+			for(i = 0; i < count; i++)
+			{
+				if(kind == 0)
+				{
+					simpleTotal += strtod(memory + offsets[i], &end);
+				}
+				else
+				{
+					simpleSum += strtoll(memory + offsets[i], &end, 10);
+				}
+			}
+		}
+		simpleTime = ACR_TimerSeconds() - start;
+
+		start = ACR_TimerSeconds();
+		for(repeat = 0; repeat < 4; repeat++)
+		{
+			for(i = 0; i < count; i++)
+			{
+				ACR_STRING_REFERENCE(string, (memory + offsets[i]), offsets[i + 1] - offsets[i] - 1, ACR_EMPTY_VALUE);
+				if(kind == 0)
+				{
+					ACR_StringToDouble(string, &value, &consumed);
+					total += value;
+				}
+				else
+				{
+					ACR_StringToInt64(string, &integer, &consumed);
+					sum += integer;
+				}
+			}
+		}
+		time = ACR_TimerSeconds() - start;
+
+		if((simpleTime > 0) && (time > 0))
+		{
+			ACR_DEBUG_PRINT(5, "BENCHMARK %s MB/s %s %.0f %s %.0f", (kind == 0) ? "double" : "integer",
+				(kind == 0) ? "strtod" : "strtoll", megabytes / simpleTime,
+				(kind == 0) ? "ACR_StringToDouble" : "ACR_StringToInt64", megabytes / time);
+		}
+	}
+
+	free(memory);
+	free(offsets);
+
+	if((total != simpleTotal) || (sum != simpleSum))
+	{
+		ACR_DEBUG_PRINT(6, "FAIL benchmark totals are not the same");
+		return ACR_FAILURE;
+	}
+	return ACR_SUCCESS;
+}
+
+/**********************************************************/
+int FormatBenchmark(void)
+{
+	double* values;
+	int count = 200000;
+	int i;
+	int repeat;
+	int kind;
+	char text[64];
+	size_t simpleLength = 0;
+	ACR_Length_t length = 0;
+	ACR_VarBuffer_t buffer;
+	double start;
+	double simpleTime;
+	double time;
+	double millions;
+
+	values = (double*)malloc((size_t)count * sizeof(double));
+	if(values == ACR_NULL)
+	{
+		// not enough memory to run the benchmark
+		return ACR_SUCCESS;
+	}
+	ACR_VarBufferInit(&buffer);
+
+	srand(401);
+	for(kind = 0; kind < 2; kind++)
+	{
+		for(i = 0; i < count; i++)
+		{
+			if(kind == 0)
+			{
+				values[i] = ((double)rand() / (double)RAND_MAX) * 1000.0;
+			}
+			else
+			{
+				values[i] = (double)(rand() - (RAND_MAX / 2));
+			}
+		}
+		millions = (4.0 * (double)count) / 1000000.0;
+		ACR_UNUSED(millions);
+
+		start = ACR_TimerSeconds();
+		for(repeat = 0; repeat < 4; repeat++)
+		{
+			for(i = 0; i < count; i++)
+			{
+				if(kind == 0)
+				{
+					simpleLength += (size_t)snprintf(text, sizeof(text), "%.17g", values[i]);
+				}
+				else
+				{
+					simpleLength += (size_t)snprintf(text, sizeof(text), "%lld", (long long)values[i]);
+				}
+			}
+		}
+		simpleTime = ACR_TimerSeconds() - start;
+
+		start = ACR_TimerSeconds();
+		for(repeat = 0; repeat < 4; repeat++)
+		{
+			buffer.m_Buffer.m_Length = 0;
+			for(i = 0; i < count; i++)
+			{
+				if(kind == 0)
+				{
+					ACR_VarBufferAppendDouble(&buffer, values[i]);
+				}
+				else
+				{
+					ACR_VarBufferAppendInt64(&buffer, (ACR_Int64_t)values[i]);
+				}
+			}
+			length += buffer.m_Buffer.m_Length;
+		}
+		time = ACR_TimerSeconds() - start;
+
+		if((simpleTime > 0) && (time > 0))
+		{
+			ACR_DEBUG_PRINT(14, "BENCHMARK %s millions per second %s %.1f %s %.1f", (kind == 0) ? "double" : "integer",
+				(kind == 0) ? "snprintf(%.17g)" : "snprintf(%lld)", millions / simpleTime,
+				(kind == 0) ? "ACR_VarBufferAppendDouble" : "ACR_VarBufferAppendInt64", millions / time);
+		}
+	}
+
+	ACR_VarBufferDeInit(&buffer);
+	free(values);
+
+	if((simpleLength == 0) || (length == 0))
+	{
+		ACR_DEBUG_PRINT(15, "FAIL benchmark did not write anything");
+		return ACR_FAILURE;
+	}
+	return ACR_SUCCESS;
+}
+
+#endif // #if ACR_USE_64BIT == ACR_BOOL_TRUE
@@ -0,0 +1,706 @@
+/*
+
+    ********** DO NOT REMOVE THIS INFORMATION ************
+
+    ACR - A set of C functions in a git Repository
+    Copyright (C) 2018 - 2020 Adam C. Rosenberg
+
+    Please read LICENSE before using this code
+
+    Please read README.md for instructions on including
+    this code in your project and where to find examples
+
+    If you contribute to this code, Please add your name
+    and email address to the AUTHORS list below so that
+    we know who to thank!
+
+    AUTHORS
+
+    Adam Rosenberg <adam@sirspot.com>
+
+    LICENSE
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+    ******************************************************
+
+*/
+/** \file test_radixtree.c
+
+    application to test the ACR_RadixTree_t type
+
+*/
+#include "ACR/radixtree.h"
+#include "ACR/hashmap.h"
+
+#include <stdio.h>
+// included for memcmp() and strlen()
+#include <string.h>
+
+// the number of keys used by the tests
+#define TEST_KEY_COUNT 20000
+
+// the number of random changes in the random test
+#define TEST_RANDOM_COUNT 200000
+
+// the largest number of keys in the benchmark. build with
+// -D TEST_RADIXTREE_MAX_COUNT=10000000 to also run 10M keys
+// on a machine with enough memory
+#ifndef TEST_RADIXTREE_MAX_COUNT
+#define TEST_RADIXTREE_MAX_COUNT 1000000
+#endif
+
+//
+// PROTOTYPES
+//
+
+/** check adding, finding, removing, and listing keys in
+    order
+*/
+int RadixTreeTest(void);
+
+/** check longest prefix and prefix range queries on routes
+*/
+int RadixTreePrefixTest(void);
+
+/** check random changes with keys of every byte value
+    against ACR_HashMap_t
+*/
+int RadixTreeRandomTest(void);
+
+/** compare the speed and memory of ACR_RadixTree_t with
+    ACR_HashMap_t from 1K to TEST_RADIXTREE_MAX_COUNT keys,
+    and longest prefix lookups with a linear scan
+*/
+int RadixTreeBenchmark(void);
+
+//
+// MAIN
+//
+
+int main(int argc, char** argv)
+{
+	int result = ACR_SUCCESS;
+
+	ACR_UNUSED(argc);
+	ACR_UNUSED(argv);
+
+	#if ACR_HAS_MALLOC == ACR_BOOL_TRUE
+	result |= RadixTreeTest();
+	result |= RadixTreePrefixTest();
+	result |= RadixTreeRandomTest();
+
+	result |= RadixTreeBenchmark();
+	#endif
+
+	return result;
+}
+
+//
+// IMPLEMENTATION
+//
+
+/** write the key for a number into memory. many keys are
+    prefixes of other keys
+*/
+static ACR_String_t TestKey(
+	char* memory,
+	int i)
+{
+	const char* prefixes[] = {"", "k", "key_", "caf\xC3\xA9_", "key_1_", "a much longer key that needs a long prefix and more than 64 bytes_"};
+	sprintf(memory, "%s%d", prefixes[i % 6], i / 6);
+	return ACR_StringFromMemory((ACR_Byte_t*)memory, ACR_MAX_LENGTH, ACR_MAX_COUNT);
+}
+
+/** compare two keys in byte order for qsort()
+*/
+static int TestKeyCompare(
+	const void* a,
+	const void* b)
+{
+	const ACR_String_t* first = (const ACR_String_t*)a;
+	const ACR_String_t* second = (const ACR_String_t*)b;
+	ACR_Length_t length = (first->m_Buffer.m_Length < second->m_Buffer.m_Length) ? first->m_Buffer.m_Length : second->m_Buffer.m_Length;
+	int result = (length > 0) ? memcmp(first->m_Buffer.m_Pointer, second->m_Buffer.m_Pointer, (size_t)length) : 0;
+	if(result != 0)
+	{
+		return result;
+	}
+	return (first->m_Buffer.m_Length < second->m_Buffer.m_Length) ? -1 : ((first->m_Buffer.m_Length > second->m_Buffer.m_Length) ? 1 : 0);
+}
+
+/** check that an iterator lists the keys in order
+    \returns the number of keys or -1 if they are wrong
+*/
+static int TestListKeys(
+	const ACR_RadixTree_t* tree,
+	ACR_String_t prefix,
+	const ACR_String_t* expected,
+	int count)
+{
+	ACR_RadixTreeIterator_t iterator;
+	ACR_String_t key;
+	void* value;
+	void* found;
+	int listed = 0;
+
+	if(ACR_RadixTreeIteratorInit(&iterator, tree, prefix) != ACR_INFO_OK)
+	{
+		return -1;
+	}
+	while(ACR_RadixTreeNext(&iterator, &key, &value) == ACR_INFO_OK)
+	{
+		if((listed >= count) || (TestKeyCompare(&key, &expected[listed]) != 0) || (key.m_Count != expected[listed].m_Count) ||
+		   (ACR_RadixTreeFind(tree, key, &found) != ACR_INFO_OK) || (found != value))
+		{
+			ACR_RadixTreeIteratorDeInit(&iterator);
+			return -1;
+		}
+		listed++;
+	}
+	ACR_RadixTreeIteratorDeInit(&iterator);
+	return listed;
+}
+
+/**********************************************************/
+int RadixTreeTest(void)
+{
+	ACR_RadixTree_t tree;
+	ACR_String_t* keys;
+	ACR_String_t empty = ACR_StringFromMemory((ACR_Byte_t*)"", ACR_MAX_LENGTH, ACR_MAX_COUNT);
+	char* memory;
+	int* value;
+	int count = 0;
+	int i;
+
+	keys = (ACR_String_t*)malloc(TEST_KEY_COUNT * sizeof(ACR_String_t));
+	memory = (char*)malloc(TEST_KEY_COUNT * 96);
+	if((keys == ACR_NULL) || (memory == ACR_NULL))
+	{
+		free(keys);
+		free(memory);
+		return ACR_SUCCESS;
+	}
+
+	ACR_RadixTreeInit(&tree, sizeof(int));
+	for(i = 0; i < TEST_KEY_COUNT; i++)
+	{
+		keys[i] = TestKey(memory + (i * 96), i);
+		if((ACR_RadixTreeAdd(&tree, keys[i], (void**)&value) != ACR_INFO_NEW) || ((*value) != 0))
+		{
+			ACR_DEBUG_PRINT(1, "FAIL key %s was not added", memory + (i * 96));
+			ACR_RadixTreeDeInit(&tree);
+			free(keys);
+			free(memory);
+			return ACR_FAILURE;
+		}
+		(*value) = i;
+	}
+
+	// values stay with their keys while the tree changes
+	for(i = 0; i < TEST_KEY_COUNT; i++)
+	{
+		if((ACR_RadixTreeAdd(&tree, keys[i], (void**)&value) != ACR_INFO_OLD) || ((*value) != i) ||
+		   (ACR_RadixTreeFind(&tree, keys[i], (void**)&value) != ACR_INFO_OK) || ((*value) != i))
+		{
+			ACR_DEBUG_PRINT(2, "FAIL key %s does not have its value", memory + (i * 96));
+			ACR_RadixTreeDeInit(&tree);
+			free(keys);
+			free(memory);
+			return ACR_FAILURE;
+		}
+	}
+	if((tree.m_Count != TEST_KEY_COUNT) || (ACR_RadixTreeFind(&tree, empty, ACR_NULL) != ACR_INFO_UNKNOWN))
+	{
+		ACR_DEBUG_PRINT(3, "FAIL tree has %d keys instead of %d", (int)tree.m_Count, TEST_KEY_COUNT);
+		ACR_RadixTreeDeInit(&tree);
+		free(keys);
+		free(memory);
+		return ACR_FAILURE;
+	}
+
+	// remove every third key, then check every key and the
+	// order of the rest
+	for(i = 0; i < TEST_KEY_COUNT; i += 3)
+	{
+		if((ACR_RadixTreeRemove(&tree, keys[i]) != ACR_INFO_OK) || (ACR_RadixTreeRemove(&tree, keys[i]) != ACR_INFO_UNKNOWN))
+		{
+			ACR_DEBUG_PRINT(4, "FAIL key %s was not removed once", memory + (i * 96));
+			ACR_RadixTreeDeInit(&tree);
+			free(keys);
+			free(memory);
+			return ACR_FAILURE;
+		}
+	}
+	for(i = 0; i < TEST_KEY_COUNT; i++)
+	{
+		if((i % 3) == 0)
+		{
+			if(ACR_RadixTreeFind(&tree, keys[i], ACR_NULL) != ACR_INFO_UNKNOWN)
+			{
+				ACR_DEBUG_PRINT(5, "FAIL removed key %s was found", memory + (i * 96));
+				ACR_RadixTreeDeInit(&tree);
+				free(keys);
+				free(memory);
+				return ACR_FAILURE;
+			}
+		}
+		else
+		{
+			if((ACR_RadixTreeFind(&tree, keys[i], (void**)&value) != ACR_INFO_OK) || ((*value) != i))
+			{
+				ACR_DEBUG_PRINT(6, "FAIL key %s was lost when other keys were removed", memory + (i * 96));
+				ACR_RadixTreeDeInit(&tree);
+				free(keys);
+				free(memory);
+				return ACR_FAILURE;
+			}
+			keys[count++] = keys[i];
+		}
+	}
+	qsort(keys, (size_t)count, sizeof(ACR_String_t), TestKeyCompare);
+	if(TestListKeys(&tree, empty, keys, count) != count)
+	{
+		ACR_DEBUG_PRINT(7, "FAIL keys are not listed in order");
+		ACR_RadixTreeDeInit(&tree);
+		free(keys);
+		free(memory);
+		return ACR_FAILURE;
+	}
+
+	// removing every key frees the nodes for reuse
+	for(i = 0; i < count; i++)
+	{
+		if(ACR_RadixTreeRemove(&tree, keys[i]) != ACR_INFO_OK)
+		{
+			ACR_DEBUG_PRINT(8, "FAIL key %d was not removed", i);
+			ACR_RadixTreeDeInit(&tree);
+			free(keys);
+			free(memory);
+			return ACR_FAILURE;
+		}
+	}
+	if((tree.m_Count != 0) || (tree.m_Root != ACR_NULL) || (TestListKeys(&tree, empty, keys, 0) != 0))
+	{
+		ACR_DEBUG_PRINT(9, "FAIL tree is not empty");
+		ACR_RadixTreeDeInit(&tree);
+		free(keys);
+		free(memory);
+		return ACR_FAILURE;
+	}
+
+	ACR_RadixTreeDeInit(&tree);
+	free(keys);
+	free(memory);
+	return ACR_SUCCESS;
+}
+
+/**********************************************************/
+int RadixTreePrefixTest(void)
+{
+	const char* routes[] = {"/", "/api", "/api/v1", "/api/v1/users", "/api/v2/users", "/static/", "/static/css/"};
+	const char* paths[][2] =
+	{
+		{"/api/v1/users/42", "/api/v1/users"},
+		{"/api/v1/items", "/api/v1"},
+		{"/api/v2/user", "/api"},
+		{"/apix", "/api"},
+		{"/static/css/site.css", "/static/css/"},
+		{"/static", "/"},
+		{"/", "/"},
+		{"api", ACR_NULL},
+		{"", ACR_NULL}
+	};
+	const char* ranges[][4] =
+	{
+		{"/api/", "/api/v1", "/api/v1/users", "/api/v2/users"},
+		{"/api/v1", "/api/v1", "/api/v1/users", ACR_NULL},
+		{"/st", "/static/", "/static/css/", ACR_NULL},
+		{"/api/v3", ACR_NULL, ACR_NULL, ACR_NULL},
+		{"/static/c", "/static/css/", ACR_NULL, ACR_NULL},
+		{"/static/css/x", ACR_NULL, ACR_NULL, ACR_NULL}
+	};
+	ACR_String_t expected[3];
+	ACR_RadixTree_t tree;
+	ACR_Length_t length;
+	int* value;
+	int count;
+	int i;
+	int j;
+
+	ACR_RadixTreeInit(&tree, sizeof(int));
+	for(i = 0; i < 7; i++)
+	{
+		if(ACR_RadixTreeAdd(&tree, ACR_StringFromMemory((ACR_Byte_t*)routes[i], ACR_MAX_LENGTH, ACR_MAX_COUNT), (void**)&value) != ACR_INFO_NEW)
+		{
+			ACR_DEBUG_PRINT(10, "FAIL route %s was not added", routes[i]);
+			ACR_RadixTreeDeInit(&tree);
+			return ACR_FAILURE;
+		}
+		(*value) = i;
+	}
+
+	for(i = 0; i < 9; i++)
+	{
+		if(ACR_RadixTreeLongestPrefix(&tree, ACR_StringFromMemory((ACR_Byte_t*)paths[i][0], ACR_MAX_LENGTH, ACR_MAX_COUNT), &length, (void**)&value) != ACR_INFO_OK)
+		{
+			if(paths[i][1] == ACR_NULL)
+			{
+				continue;
+			}
+			ACR_DEBUG_PRINT(11, "FAIL no route for %s", paths[i][0]);
+			ACR_RadixTreeDeInit(&tree);
+			return ACR_FAILURE;
+		}
+		if((paths[i][1] == ACR_NULL) || (length != strlen(paths[i][1])) || (strcmp(routes[*value], paths[i][1]) != 0))
+		{
+			ACR_DEBUG_PRINT(12, "FAIL wrong route %s for %s", routes[*value], paths[i][0]);
+			ACR_RadixTreeDeInit(&tree);
+			return ACR_FAILURE;
+		}
+	}
+
+	for(i = 0; i < 6; i++)
+	{
+		for(count = 0; (count < 3) && (ranges[i][count + 1] != ACR_NULL); count++)
+		{
+			expected[count] = ACR_StringFromMemory((ACR_Byte_t*)ranges[i][count + 1], ACR_MAX_LENGTH, ACR_MAX_COUNT);
+		}
+		j = TestListKeys(&tree, ACR_StringFromMemory((ACR_Byte_t*)ranges[i][0], ACR_MAX_LENGTH, ACR_MAX_COUNT), expected, count);
+		if(j != count)
+		{
+			ACR_DEBUG_PRINT(13, "FAIL %d routes start with %s instead of %d", j, ranges[i][0], count);
+			ACR_RadixTreeDeInit(&tree);
+			return ACR_FAILURE;
+		}
+	}
+
+	ACR_RadixTreeDeInit(&tree);
+	return ACR_SUCCESS;
+}
+
+/**********************************************************/
+int RadixTreeRandomTest(void)
+{
+	ACR_RadixTree_t tree;
+	ACR_HashMap_t map;
+	ACR_Byte_t bytes[8];
+	ACR_STRING(key);
+	ACR_String_t* keys;
+	ACR_Length_t* treeValue;
+	ACR_Length_t* mapValue;
+	ACR_Info_t treeResult;
+	ACR_Info_t mapResult;
+	ACR_Count_t position = 0;
+	unsigned int seed = 1;
+	int length;
+	int count = 0;
+	int n;
+	int i;
+
+	ACR_RadixTreeInit(&tree, sizeof(ACR_Length_t));
+	ACR_HashMapInit(&map, ACR_HASHMAP_KEYS_STRING, sizeof(ACR_Length_t));
+	for(n = 0; n < TEST_RANDOM_COUNT; n++)
+	{
+		// short keys whose first byte has any value and whose
+		// other bytes have few, so that nodes of every kind
+		// grow and shrink
+		seed = (seed * 1103515245U) + 12345U;
+		length = (int)((seed >> 16) % 6);
+		for(i = 0; i < length; i++)
+		{
+			seed = (seed * 1103515245U) + 12345U;
+			bytes[i] = (ACR_Byte_t)((i == 0) ? (seed >> 16) : ((seed >> 16) % 5));
+		}
+		ACR_BUFFER_REFERENCE(key.m_Buffer, bytes, (ACR_Length_t)length);
+		key.m_Count = (ACR_Count_t)length;
+		seed = (seed * 1103515245U) + 12345U;
+		if(((seed >> 16) % 3) != 0)
+		{
+			treeResult = ACR_RadixTreeAdd(&tree, key, (void**)&treeValue);
+			mapResult = ACR_HashMapAddString(&map, key, (void**)&mapValue);
+			if(treeResult == ACR_INFO_NEW)
+			{
+				(*treeValue) = (ACR_Length_t)n;
+				(*mapValue) = (ACR_Length_t)n;
+			}
+		}
+		else
+		{
+			treeResult = ACR_RadixTreeRemove(&tree, key);
+			mapResult = ACR_HashMapRemoveString(&map, key);
+		}
+		if((treeResult != mapResult) || (treeResult == ACR_INFO_ERROR))
+		{
+			ACR_DEBUG_PRINT(14, "FAIL change %d was different for the tree and the map", n);
+			ACR_HashMapDeInit(&map);
+			ACR_RadixTreeDeInit(&tree);
+			return ACR_FAILURE;
+		}
+	}
+
+	keys = (ACR_String_t*)malloc((size_t)(map.m_Count + 1) * sizeof(ACR_String_t));
+	if(keys == ACR_NULL)
+	{
+		ACR_HashMapDeInit(&map);
+		ACR_RadixTreeDeInit(&tree);
+		return ACR_SUCCESS;
+	}
+	while(ACR_HashMapNextString(&map, &position, &key, (void**)&mapValue) == ACR_INFO_OK)
+	{
+		if((ACR_RadixTreeFind(&tree, key, (void**)&treeValue) != ACR_INFO_OK) || ((*treeValue) != (*mapValue)))
+		{
+			ACR_DEBUG_PRINT(15, "FAIL the tree and the map have different values");
+			free(keys);
+			ACR_HashMapDeInit(&map);
+			ACR_RadixTreeDeInit(&tree);
+			return ACR_FAILURE;
+		}
+		keys[count++] = key;
+	}
+	qsort(keys, (size_t)count, sizeof(ACR_String_t), TestKeyCompare);
+	for(i = 0; i < count; i++)
+	{
+		// the bytes are not all UTF8, so count them the way the
+		// iterator does
+		keys[i].m_Count = 0;
+		for(n = 0; n < (int)keys[i].m_Buffer.m_Length; n++)
+		{
+			if((((const ACR_Byte_t*)keys[i].m_Buffer.m_Pointer)[n] & 0xC0) != 0x80)
+			{
+				keys[i].m_Count++;
+			}
+		}
+	}
+	ACR_BUFFER_REFERENCE(key.m_Buffer, bytes, 0);
+	if((tree.m_Count != map.m_Count) || (TestListKeys(&tree, key, keys, count) != count))
+	{
+		ACR_DEBUG_PRINT(16, "FAIL the tree has %d keys and the map %d", (int)tree.m_Count, (int)map.m_Count);
+		free(keys);
+		ACR_HashMapDeInit(&map);
+		ACR_RadixTreeDeInit(&tree);
+		return ACR_FAILURE;
+	}
+
+	// removing every key shrinks every node down to nothing
+	for(i = 0; i < count; i++)
+	{
+		if((ACR_RadixTreeRemove(&tree, keys[i]) != ACR_INFO_OK) ||
+		   ((i < (count - 1)) && (ACR_RadixTreeFind(&tree, keys[count - 1], ACR_NULL) != ACR_INFO_OK)))
+		{
+			ACR_DEBUG_PRINT(17, "FAIL key %d was not removed", i);
+			free(keys);
+			ACR_HashMapDeInit(&map);
+			ACR_RadixTreeDeInit(&tree);
+			return ACR_FAILURE;
+		}
+	}
+	if((tree.m_Count != 0) || (tree.m_Root != ACR_NULL))
+	{
+		ACR_DEBUG_PRINT(18, "FAIL tree is not empty");
+		free(keys);
+		ACR_HashMapDeInit(&map);
+		ACR_RadixTreeDeInit(&tree);
+		return ACR_FAILURE;
+	}
+
+	free(keys);
+	ACR_HashMapDeInit(&map);
+	ACR_RadixTreeDeInit(&tree);
+	return ACR_SUCCESS;
+}
+
+/** write a benchmark key for a number into memory, like
+    routes and identifiers that share long prefixes
+*/
+static ACR_String_t TestBenchmarkKey(
+	char* memory,
+	ACR_Length_t i)
+{
+	const char* prefixes[] = {"/api/v1/users/", "/api/v1/orders/", "session:", "com.example.service."};
+	sprintf(memory, "%s%lu", prefixes[i % 4], (unsigned long)(i / 4));
+	return ACR_StringFromMemory((ACR_Byte_t*)memory, ACR_MAX_LENGTH, ACR_MAX_COUNT);
+}
+
+/**********************************************************/
+int RadixTreeBenchmark(void)
+{
+	ACR_RadixTree_t tree;
+	ACR_HashMap_t map;
+	ACR_String_t* keys;
+	ACR_String_t path;
+	ACR_Length_t* value;
+	ACR_Length_t treeSum;
+	ACR_Length_t mapSum;
+	ACR_Length_t count;
+	ACR_Length_t length;
+	ACR_Length_t best;
+	ACR_Length_t i;
+	ACR_Length_t j;
+	char* memory;
+	char route[64];
+	double start;
+	double treeAdd;
+	double treeFind;
+	double mapAdd;
+	double mapFind;
+	double treeTime;
+	double scanTime;
+
+	keys = (ACR_String_t*)malloc(TEST_RADIXTREE_MAX_COUNT * sizeof(ACR_String_t));
+	memory = (char*)malloc(TEST_RADIXTREE_MAX_COUNT * 40);
+	if((keys == ACR_NULL) || (memory == ACR_NULL))
+	{
+		free(keys);
+		free(memory);
+		return ACR_SUCCESS;
+	}
+	for(i = 0; i < TEST_RADIXTREE_MAX_COUNT; i++)
+	{
+		keys[i] = TestBenchmarkKey(memory + (i * 40), i);
+	}
+
+	for(count = 1000; count <= TEST_RADIXTREE_MAX_COUNT; count *= 10)
+	{
+		ACR_RadixTreeInit(&tree, sizeof(ACR_Length_t));
+		ACR_HashMapInit(&map, ACR_HASHMAP_KEYS_STRING, sizeof(ACR_Length_t));
+		treeSum = 0;
+		mapSum = 0;
+
+		start = ACR_TimerSeconds();
+		for(i = 0; i < count; i++)
+		{
+			if(ACR_RadixTreeAdd(&tree, keys[i], (void**)&value) != ACR_INFO_NEW)
+			{
+				break;
+			}
+			(*value) = i;
+		}
+		treeAdd = ACR_TimerSeconds() - start;
+		start = ACR_TimerSeconds();
+		for(i = 0; i < count; i++)
+		{
+			if(ACR_HashMapAddString(&map, keys[i], (void**)&value) != ACR_INFO_NEW)
+			{
+				break;
+			}
+			(*value) = i;
+		}
+		mapAdd = ACR_TimerSeconds() - start;
+
+		start = ACR_TimerSeconds();
+		for(i = 0; i < count; i++)
+		{
+			if(ACR_RadixTreeFind(&tree, keys[(i * 7919) % count], (void**)&value) == ACR_INFO_OK)
+			{
+				treeSum += (*value);
+			}
+		}
+		treeFind = ACR_TimerSeconds() - start;
+		start = ACR_TimerSeconds();
+		for(i = 0; i < count; i++)
+		{
+			if(ACR_HashMapFindString(&map, keys[(i * 7919) % count], (void**)&value) == ACR_INFO_OK)
+			{
+				mapSum += (*value);
+			}
+		}
+		mapFind = ACR_TimerSeconds() - start;
+
+		if((treeAdd > 0) && (treeFind > 0) && (mapAdd > 0) && (mapFind > 0))
+		{
+			ACR_DEBUG_PRINT(19, "BENCHMARK %lu keys M/s add, find, bytes per key ACR_RadixTree_t %.1f %.1f %.1f ACR_HashMap_t %.1f %.1f %.1f",
+				(unsigned long)count,
+				(double)count / (treeAdd * 1000000.0), (double)count / (treeFind * 1000000.0), (double)tree.m_MemoryLength / (double)count,
+				(double)count / (mapAdd * 1000000.0), (double)count / (mapFind * 1000000.0),
+				(double)(map.m_Memory.m_Length + map.m_Keys.m_Length) / (double)count);
+		}
+
+		ACR_HashMapDeInit(&map);
+		ACR_RadixTreeDeInit(&tree);
+
+		if((treeSum != mapSum) || (treeSum != ((count * (count - 1)) / 2)))
+		{
+			ACR_DEBUG_PRINT(20, "FAIL benchmark found different values with %lu keys", (unsigned long)count);
+			free(keys);
+			free(memory);
+			return ACR_FAILURE;
+		}
+	}
+
+	// the longest of 1000 routes that is a prefix of a path,
+	// found with the tree and with a scan of every route
+	ACR_RadixTreeInit(&tree, sizeof(ACR_Length_t));
+	for(i = 0; i < 1000; i++)
+	{
+		sprintf(route, "/api/v%lu/resource%lu", (unsigned long)(i % 10), (unsigned long)(i / 10));
+		if(ACR_RadixTreeAdd(&tree, ACR_StringFromMemory((ACR_Byte_t*)route, ACR_MAX_LENGTH, ACR_MAX_COUNT), (void**)&value) != ACR_INFO_NEW)
+		{
+			break;
+		}
+		(*value) = i;
+		strcpy(memory + (i * 40), route);
+		keys[i] = ACR_StringFromMemory((ACR_Byte_t*)(memory + (i * 40)), ACR_MAX_LENGTH, ACR_MAX_COUNT);
+	}
+	treeSum = 0;
+	mapSum = 0;
+	start = ACR_TimerSeconds();
+	for(j = 0; j < 20000; j++)
+	{
+		sprintf(route, "/api/v%lu/resource%lu/items/%lu", (unsigned long)(j % 10), (unsigned long)((j * 7) % 100), (unsigned long)j);
+		path = ACR_StringFromMemory((ACR_Byte_t*)route, ACR_MAX_LENGTH, ACR_MAX_COUNT);
+		if(ACR_RadixTreeLongestPrefix(&tree, path, &length, (void**)&value) == ACR_INFO_OK)
+		{
+			treeSum += (*value) + length;
+		}
+	}
+	treeTime = ACR_TimerSeconds() - start;
+	start = ACR_TimerSeconds();
+	for(j = 0; j < 20000; j++)
+	{
+		sprintf(route, "/api/v%lu/resource%lu/items/%lu", (unsigned long)(j % 10), (unsigned long)((j * 7) % 100), (unsigned long)j);
+		path = ACR_StringFromMemory((ACR_Byte_t*)route, ACR_MAX_LENGTH, ACR_MAX_COUNT);
+		best = 1000;
+		for(i = 0; i < 1000; i++)
+		{
+			if((keys[i].m_Buffer.m_Length <= path.m_Buffer.m_Length) &&
+			   ((best == 1000) || (keys[i].m_Buffer.m_Length > keys[best].m_Buffer.m_Length)) &&
+			   (ACR_StringCompareToMemory(keys[i], (const ACR_Byte_t*)path.m_Buffer.m_Pointer, keys[i].m_Buffer.m_Length, ACR_MAX_COUNT, ACR_INFO_YES) == ACR_INFO_EQUAL))
+			{
+				best = i;
+			}
+		}
+		if(best != 1000)
+		{
+			mapSum += best + keys[best].m_Buffer.m_Length;
+		}
+	}
+	scanTime = ACR_TimerSeconds() - start;
+	ACR_RadixTreeDeInit(&tree);
+	free(keys);
+	free(memory);
+
+	if((treeTime > 0) && (scanTime > 0))
+	{
+		ACR_DEBUG_PRINT(21, "BENCHMARK longest of 1000 routes K/s ACR_RadixTreeLongestPrefix %.0f scan with ACR_StringCompareToMemory %.1f",
+			20000.0 / (treeTime * 1000.0), 20000.0 / (scanTime * 1000.0));
+	}
+	if((treeSum != mapSum) || (treeSum == 0))
+	{
+		ACR_DEBUG_PRINT(22, "FAIL longest prefix of the tree and the scan are different");
+		return ACR_FAILURE;
+	}
+	return ACR_SUCCESS;
+}
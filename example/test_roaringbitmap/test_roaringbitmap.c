@@ -0,0 +1,506 @@
+/*
+
+    ********** DO NOT REMOVE THIS INFORMATION ************
+
+    ACR - A set of C functions in a git Repository
+    Copyright (C) 2018 - 2020 Adam C. Rosenberg
+
+    Please read LICENSE before using this code
+
+    Please read README.md for instructions on including
+    this code in your project and where to find examples
+
+    If you contribute to this code, Please add your name
+    and email address to the AUTHORS list below so that
+    we know who to thank!
+
+    AUTHORS
+
+    Adam Rosenberg <adam@sirspot.com>
+
+    LICENSE
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+    ******************************************************
+
+*/
+/** \file test_roaringbitmap.c
+
+    application to test roaring bitmap struct and functions
+
+*/
+#include "ACR/roaringbitmap.h"
+
+//
+// PROTOTYPES
+//
+
+/** simple example to use a roaring bitmap on the stack
+*/
+int StackTest(void);
+
+/** simple example to use a roaring bitmap on the heap
+*/
+int HeapTest(void);
+
+/** example to add and remove enough values to change
+    between array and bitmap containers
+*/
+int ContainerTest(void);
+
+/** example to combine bitmaps with logic operations
+*/
+int LogicTest(void);
+
+/** example to save a bitmap and use the saved data in place
+*/
+int SerializeTest(void);
+
+/** example to show that saved data that has been changed is
+    rejected instead of being used in place
+*/
+int CorruptTest(void);
+
+//
+// MAIN
+//
+
+int main(int argc, char** argv)
+{
+	int result = ACR_SUCCESS;
+
+	ACR_UNUSED(argc);
+	ACR_UNUSED(argv);
+
+	result |= StackTest();
+	result |= HeapTest();
+
+	result |= ContainerTest();
+	result |= LogicTest();
+	result |= SerializeTest();
+	result |= CorruptTest();
+
+	return result;
+}
+
+//
+// IMPLEMENTATION
+//
+
+/**********************************************************/
+int StackTest(void)
+{
+	int result = ACR_SUCCESS;
+	ACR_RoaringBitmap_t bitmap;
+
+	ACR_RoaringBitmapInit(&bitmap);
+	if(ACR_RoaringBitmapAdd(&bitmap, 4000000000UL) == ACR_INFO_OK)
+	{
+		//
+		// OK - the value is stored
+		//
+
+		if(ACR_RoaringBitmapContains(&bitmap, 4000000000UL) != ACR_INFO_TRUE)
+		{
+			result = ACR_FAILURE;
+		}
+		if(ACR_RoaringBitmapContains(&bitmap, 5) != ACR_INFO_FALSE)
+		{
+			result = ACR_FAILURE;
+		}
+	}
+	else
+	{
+		// failed to allocate memory
+		result = ACR_FAILURE;
+	}
+	ACR_RoaringBitmapDeInit(&bitmap);
+
+	return result;
+}
+
+/**********************************************************/
+int HeapTest(void)
+{
+	int result = ACR_SUCCESS;
+	ACR_RoaringBitmap_t* bitmapPtr;
+
+	ACR_RoaringBitmapNew(&bitmapPtr);
+	if(ACR_RoaringBitmapAdd(bitmapPtr, 7) == ACR_INFO_OK)
+	{
+		//
+		// OK - the value is stored
+		//
+
+		ACR_RoaringBitmapAdd(bitmapPtr, 7);
+		if(ACR_RoaringBitmapCardinality(bitmapPtr) != 1)
+		{
+			result = ACR_FAILURE;
+		}
+	}
+	else
+	{
+		// failed to allocate memory
+		result = ACR_FAILURE;
+	}
+	ACR_RoaringBitmapDelete(&bitmapPtr);
+
+	return result;
+}
+
+/**********************************************************/
+int ContainerTest(void)
+{
+	int result = ACR_SUCCESS;
+	ACR_RoaringBitmap_t bitmap;
+	ACR_RoaringValue_t value;
+	ACR_RoaringValue_t found;
+
+	ACR_RoaringBitmapInit(&bitmap);
+
+	// 10000 even values in the second chunk becomes a bitmap container
+	for(value = 65536; value < 65536 + 20000; value += 2)
+	{
+		ACR_RoaringBitmapAdd(&bitmap, value);
+	}
+	if(ACR_RoaringBitmapCardinality(&bitmap) != 10000)
+	{
+		ACR_DEBUG_PRINT(1, "FAIL ADD found %d values", (int)ACR_RoaringBitmapCardinality(&bitmap));
+		result = ACR_FAILURE;
+	}
+
+	// removing most of the values changes it back to an array container
+	for(value = 65536; value < 65536 + 19000; value += 2)
+	{
+		ACR_RoaringBitmapRemove(&bitmap, value);
+	}
+	if((ACR_RoaringBitmapCardinality(&bitmap) != 500) ||
+	   (ACR_RoaringBitmapContains(&bitmap, 65536 + 19000) != ACR_INFO_TRUE) ||
+	   (ACR_RoaringBitmapContains(&bitmap, 65536 + 18998) != ACR_INFO_FALSE))
+	{
+		ACR_DEBUG_PRINT(2, "FAIL REMOVE found %d values", (int)ACR_RoaringBitmapCardinality(&bitmap));
+		result = ACR_FAILURE;
+	}
+
+	// a long run of values becomes a single run pair
+	for(value = 0; value < 30000; value++)
+	{
+		ACR_RoaringBitmapAdd(&bitmap, value);
+	}
+	if(ACR_RoaringBitmapRunOptimize(&bitmap) != ACR_INFO_OK ||
+	   (ACR_RoaringBitmapContains(&bitmap, 29999) != ACR_INFO_TRUE) ||
+	   (ACR_RoaringBitmapContains(&bitmap, 30000) != ACR_INFO_FALSE))
+	{
+		ACR_DEBUG_PRINT(3, "FAIL RUN");
+		result = ACR_FAILURE;
+	}
+
+	// iterate across the containers
+	if((ACR_RoaringBitmapFindNext(&bitmap, 29999, &found) != ACR_INFO_OK) || (found != 29999) ||
+	   (ACR_RoaringBitmapFindNext(&bitmap, 30000, &found) != ACR_INFO_OK) || (found != 65536 + 19000) ||
+	   (ACR_RoaringBitmapFindNext(&bitmap, 65536 + 19999, &found) != ACR_INFO_ERROR))
+	{
+		ACR_DEBUG_PRINT(4, "FAIL FIND NEXT");
+		result = ACR_FAILURE;
+	}
+
+	// changing a run container is allowed
+	ACR_RoaringBitmapRemove(&bitmap, 100);
+	if((ACR_RoaringBitmapCardinality(&bitmap) != 30499) ||
+	   (ACR_RoaringBitmapContains(&bitmap, 100) != ACR_INFO_FALSE))
+	{
+		ACR_DEBUG_PRINT(5, "FAIL RUN REMOVE found %d values", (int)ACR_RoaringBitmapCardinality(&bitmap));
+		result = ACR_FAILURE;
+	}
+
+	ACR_RoaringBitmapDeInit(&bitmap);
+
+	return result;
+}
+
+/**********************************************************/
+int LogicTest(void)
+{
+	int result = ACR_SUCCESS;
+	ACR_RoaringBitmap_t evens;
+	ACR_RoaringBitmap_t threes;
+	ACR_RoaringBitmap_t sparse;
+	ACR_RoaringBitmap_t both;
+	ACR_RoaringValue_t value;
+
+	ACR_RoaringBitmapInit(&evens);
+	ACR_RoaringBitmapInit(&threes);
+	ACR_RoaringBitmapInit(&sparse);
+	ACR_RoaringBitmapInit(&both);
+	for(value = 0; value < 300000; value++)
+	{
+		if((value % 2) == 0)
+		{
+			ACR_RoaringBitmapAdd(&evens, value);
+		}
+		if((value % 3) == 0)
+		{
+			ACR_RoaringBitmapAdd(&threes, value);
+		}
+		if((value % 300) == 0)
+		{
+			ACR_RoaringBitmapAdd(&sparse, value);
+		}
+	}
+
+	// multiples of 6 from two bitmap containers
+	ACR_RoaringBitmapAnd(&both, &evens, &threes);
+	if(ACR_RoaringBitmapCardinality(&both) != 50000)
+	{
+		ACR_DEBUG_PRINT(1, "FAIL AND found %d values", (int)ACR_RoaringBitmapCardinality(&both));
+		result = ACR_FAILURE;
+	}
+
+	// multiples of 2 or 3
+	ACR_RoaringBitmapOr(&both, &evens, &threes);
+	if(ACR_RoaringBitmapCardinality(&both) != 200000)
+	{
+		ACR_DEBUG_PRINT(2, "FAIL OR found %d values", (int)ACR_RoaringBitmapCardinality(&both));
+		result = ACR_FAILURE;
+	}
+
+	// array container AND bitmap container
+	ACR_RoaringBitmapAnd(&evens, &sparse, &both);
+	if(ACR_RoaringBitmapCardinality(&evens) != 1000)
+	{
+		ACR_DEBUG_PRINT(3, "FAIL SPARSE AND found %d values", (int)ACR_RoaringBitmapCardinality(&evens));
+		result = ACR_FAILURE;
+	}
+
+	// array container AND array container
+	ACR_RoaringBitmapAnd(&threes, &sparse, &evens);
+	if(ACR_RoaringBitmapCardinality(&threes) != 1000)
+	{
+		ACR_DEBUG_PRINT(4, "FAIL ARRAY AND found %d values", (int)ACR_RoaringBitmapCardinality(&threes));
+		result = ACR_FAILURE;
+	}
+
+	ACR_RoaringBitmapDeInit(&evens);
+	ACR_RoaringBitmapDeInit(&threes);
+	ACR_RoaringBitmapDeInit(&sparse);
+	ACR_RoaringBitmapDeInit(&both);
+
+	return result;
+}
+
+/**********************************************************/
+int SerializeTest(void)
+{
+	int result = ACR_SUCCESS;
+	ACR_RoaringBitmap_t bitmap;
+	ACR_RoaringBitmap_t mapped;
+	ACR_RoaringBitmap_t copy;
+	ACR_VarBuffer_t data;
+	ACR_RoaringValue_t value;
+	union
+	{
+		unsigned short m_Value;
+		ACR_Byte_t m_Bytes[2];
+	} order;
+
+	ACR_RoaringBitmapInit(&bitmap);
+	ACR_RoaringBitmapInit(&mapped);
+	ACR_RoaringBitmapInit(&copy);
+	ACR_VarBufferInit(&data);
+	for(value = 0; value < 200000; value += 3)
+	{
+		ACR_RoaringBitmapAdd(&bitmap, value);
+	}
+	ACR_RoaringBitmapAdd(&bitmap, ACR_ROARING_MAX_VALUE);
+
+	if(ACR_RoaringBitmapSerialize(&bitmap, &data) != ACR_INFO_OK ||
+	   (data.m_Buffer.m_Length != ACR_RoaringBitmapSerializedLength(&bitmap)))
+	{
+		ACR_DEBUG_PRINT(1, "FAIL SERIALIZE");
+		result = ACR_FAILURE;
+	}
+
+	// the data can only be used in place on a little endian
+	// system, so check that ACR_IS_BIG_ENDIAN is right before
+	// relying on it
+	order.m_Value = 1;
+	if(ACR_IS_BIG_ENDIAN != ((order.m_Bytes[0] == 0) ? ACR_BOOL_TRUE : ACR_BOOL_FALSE))
+	{
+		ACR_DEBUG_PRINT(6, "FAIL ACR_IS_BIG_ENDIAN is %d", (int)ACR_IS_BIG_ENDIAN);
+		result = ACR_FAILURE;
+	}
+
+	// use the data in place like a memory mapped file
+	if(ACR_RoaringBitmapRefSerialized(&mapped, data.m_Buffer.m_Pointer, data.m_Buffer.m_Length) != ACR_INFO_OK)
+	{
+		#ifdef ACR_COMPILER_VS2017
+		#pragma warning(suppress: 4127)
+		#endif
+		if(ACR_IS_BIG_ENDIAN == ACR_BOOL_FALSE)
+		{
+			ACR_DEBUG_PRINT(2, "FAIL REF");
+			result = ACR_FAILURE;
+		}
+	}
+	else
+	{
+		if((ACR_RoaringBitmapCardinality(&mapped) != ACR_RoaringBitmapCardinality(&bitmap)) ||
+		   (ACR_RoaringBitmapContains(&mapped, 199998) != ACR_INFO_TRUE) ||
+		   (ACR_RoaringBitmapContains(&mapped, ACR_ROARING_MAX_VALUE) != ACR_INFO_TRUE) ||
+		   (ACR_RoaringBitmapContains(&mapped, 199999) != ACR_INFO_FALSE))
+		{
+			ACR_DEBUG_PRINT(3, "FAIL REF VALUES");
+			result = ACR_FAILURE;
+		}
+
+		// read-only
+		if(ACR_RoaringBitmapAdd(&mapped, 1) != ACR_INFO_ERROR)
+		{
+			ACR_DEBUG_PRINT(4, "FAIL REF READ-ONLY");
+			result = ACR_FAILURE;
+		}
+
+		// make a copy that can be changed
+		ACR_RoaringBitmapOr(&copy, &mapped, &mapped);
+		if((ACR_RoaringBitmapAdd(&copy, 1) != ACR_INFO_OK) ||
+		   (ACR_RoaringBitmapCardinality(&copy) != ACR_RoaringBitmapCardinality(&bitmap) + 1))
+		{
+			ACR_DEBUG_PRINT(5, "FAIL COPY");
+			result = ACR_FAILURE;
+		}
+	}
+
+	ACR_RoaringBitmapDeInit(&bitmap);
+	ACR_RoaringBitmapDeInit(&mapped);
+	ACR_RoaringBitmapDeInit(&copy);
+	ACR_VarBufferDeInit(&data);
+
+	return result;
+}
+
+/**********************************************************/
+int CorruptTest(void)
+{
+	int result = ACR_SUCCESS;
+	ACR_RoaringBitmap_t bitmap;
+	ACR_RoaringBitmap_t mapped;
+	ACR_VarBuffer_t data;
+	ACR_VarBuffer_t changed;
+	ACR_RoaringValue_t value;
+	ACR_Byte_t* bytes;
+	ACR_Byte_t* descriptor;
+	ACR_Byte_t* values;
+	int test;
+
+	// one array, one bitmap, and one run container
+	ACR_RoaringBitmapInit(&bitmap);
+	ACR_RoaringBitmapInit(&mapped);
+	ACR_VarBufferInit(&data);
+	ACR_VarBufferInit(&changed);
+	ACR_RoaringBitmapAdd(&bitmap, 1);
+	ACR_RoaringBitmapAdd(&bitmap, 5);
+	ACR_RoaringBitmapAdd(&bitmap, 9);
+	for(value = 65536; value < (65536 + 10000); value += 2)
+	{
+		ACR_RoaringBitmapAdd(&bitmap, value);
+	}
+	for(value = 131072; value < (131072 + 100); value++)
+	{
+		ACR_RoaringBitmapAdd(&bitmap, value);
+	}
+	ACR_RoaringBitmapRunOptimize(&bitmap);
+	if((ACR_RoaringBitmapSerialize(&bitmap, &data) != ACR_INFO_OK) ||
+	   (ACR_VarBufferReserve(&changed, data.m_Buffer.m_Length) != ACR_INFO_OK))
+	{
+		ACR_DEBUG_PRINT(3, "FAIL CORRUPT SERIALIZE");
+		result = ACR_FAILURE;
+	}
+
+	#ifdef ACR_COMPILER_VS2017
+	#pragma warning(suppress: 4127)
+	#endif
+	if(ACR_IS_BIG_ENDIAN != ACR_BOOL_FALSE)
+	{
+		// the data cannot be used in place
+		test = 6;
+	}
+	else
+	{
+		test = 0;
+	}
+
+	// the descriptors are 16 bytes each after an 8 byte header
+	// with the key, the type, the length, the cardinality and
+	// the offset of the data
+	for(; (test < 6) && (result == ACR_SUCCESS); test++)
+	{
+		changed.m_Buffer.m_Length = 0;
+		ACR_VarBufferAppend(&changed, data.m_Buffer.m_Pointer, data.m_Buffer.m_Length);
+		bytes = (ACR_Byte_t*)changed.m_Buffer.m_Pointer;
+		if((bytes[8 + 2] != ACR_ROARING_ARRAY) || (bytes[24 + 2] != ACR_ROARING_BITMAP) || (bytes[40 + 2] != ACR_ROARING_RUN))
+		{
+			ACR_DEBUG_PRINT(1, "FAIL CORRUPT containers are not array, bitmap, and run");
+			result = ACR_FAILURE;
+			break;
+		}
+		descriptor = bytes + 8;
+		values = bytes + (descriptor[12] | (descriptor[13] << 8));
+		switch(test)
+		{
+			case 0:
+				// unchanged data is valid
+				break;
+			case 1:
+				// the array cardinality does not match its length
+				descriptor[8]++;
+				break;
+			case 2:
+				// the array values are not sorted
+				values[0] = 10;
+				break;
+			case 3:
+				// the array has more than ACR_ROARING_ARRAY_MAX values
+				descriptor[4] = (ACR_Byte_t)((ACR_ROARING_ARRAY_MAX + 1) & 0xFF);
+				descriptor[5] = (ACR_Byte_t)((ACR_ROARING_ARRAY_MAX + 1) >> 8);
+				descriptor[8] = descriptor[4];
+				descriptor[9] = descriptor[5];
+				break;
+			case 4:
+				// the bitmap cardinality does not match its bits
+				descriptor[16 + 8]++;
+				break;
+			default:
+				// the run goes past the end of the chunk
+				descriptor = bytes + 40;
+				values = bytes + (descriptor[12] | (descriptor[13] << 8));
+				values[0] = 0xFF;
+				values[1] = 0xFF;
+				break;
+		}
+		if(ACR_RoaringBitmapRefSerialized(&mapped, changed.m_Buffer.m_Pointer, changed.m_Buffer.m_Length) != ((test == 0) ? ACR_INFO_OK : ACR_INFO_ERROR))
+		{
+			ACR_DEBUG_PRINT(2, "FAIL CORRUPT test %d", test);
+			result = ACR_FAILURE;
+		}
+		ACR_RoaringBitmapDeInit(&mapped);
+	}
+
+	ACR_RoaringBitmapDeInit(&bitmap);
+	ACR_VarBufferDeInit(&data);
+	ACR_VarBufferDeInit(&changed);
+
+	return result;
+}
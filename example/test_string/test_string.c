@@ -50,6 +50,59 @@
 */
 int StackTest(void);
 
+/** check that ACR_StringFromMemory() counts characters correctly
+    at every alignment, length, and max number of characters
+*/
+int FromMemoryTest(void);
+
+/** compare the speed of ACR_StringFromMemory() with one
+    character at a time counting
+*/
+int FromMemoryBenchmark(void);
+
+/** check that ACR_StringCompareToMemory() gives the same
+    results as comparing one character at a time
+*/
+int CompareTest(void);
+
+/** compare the speed of ACR_StringCompareToMemory() with
+    comparing one character at a time
+*/
+int CompareBenchmark(void);
+
+/** check that ACR_StringCharAt() and ACR_StringSubstringChars()
+    find the same characters with and without an index and
+	after the index is invalidated
+*/
+int IndexTest(void);
+
+/** compare the speed of ACR_StringSubstringChars() with and
+    without an index
+*/
+int IndexBenchmark(void);
+
+/** check that ACR_StringTokenizerNext(), ACR_StringTokenizerNextBatch(),
+    and ACR_StringSplit() find the same tokens as splitting
+	one character at a time
+*/
+int SplitTest(void);
+
+/** compare the speed of ACR_StringTokenizerNext() with
+    finding each delimiter and then counting the characters
+	of each token with ACR_StringFromMemory()
+*/
+int SplitBenchmark(void);
+
+/** check that ACR_EnumTableFind() finds every name of a
+    table without checking case and nothing else
+*/
+int EnumTableTest(void);
+
+/** compare the speed of ACR_InfoFromString() with comparing
+    each name until one is equal
+*/
+int EnumTableBenchmark(void);
+
 //
 // MAIN
 //
@@ -63,6 +116,21 @@ int main(int argc, char** argv)
 
 	result |= StackTest();
 
+	result |= FromMemoryTest();
+	result |= FromMemoryBenchmark();
+
+	result |= CompareTest();
+	result |= CompareBenchmark();
+
+	result |= IndexTest();
+	result |= IndexBenchmark();
+
+	result |= SplitTest();
+	result |= SplitBenchmark();
+
+	result |= EnumTableTest();
+	result |= EnumTableBenchmark();
+
 	return result;
 }
 
@@ -82,3 +150,1070 @@ int StackTest(void)
 	return result;
 }
 
+/** count characters one at a time the simple way
+*/
+static ACR_Count_t FromMemoryTestCount(
+	const ACR_Byte_t* src,
+	ACR_Length_t srcLength,
+	ACR_Count_t maxCharacters,
+	ACR_Length_t* length)
+{
+	ACR_Length_t pos = 0;
+	ACR_Count_t count = 0;
+	while((pos < srcLength) && (count < maxCharacters) && (src[pos] != 0))
+	{
+		ACR_Length_t bytes = ACR_UTF8_BYTE_COUNT(src[pos]);
+		if(bytes > (srcLength - pos))
+		{
+			break;
+		}
+		count++;
+		pos += bytes;
+	}
+	(*length) = pos;
+	return count;
+}
+
+/** fill memory with repeated text and a null-terminator
+*/
+static void FromMemoryTestFill(
+	ACR_Byte_t* dst,
+	ACR_Length_t length,
+	const char* text)
+{
+	ACR_Length_t textLength = (ACR_Length_t)strlen(text);
+	ACR_Length_t pos = 0;
+	while((pos + textLength) < length)
+	{
+		memcpy(dst + pos, text, textLength);
+		pos += textLength;
+	}
+	dst[pos] = 0;
+}
+
+/**********************************************************/
+int FromMemoryTest(void)
+{
+	int result = ACR_SUCCESS;
+	ACR_Byte_t memory[256];
+	const char* texts[] = {"plain ascii text ", "caf\xC3\xA9 ", "\xE6\x97\xA5\xE6\x9C\xAC\xE8\xAA\x9E", "smile \xF0\x9F\x99\x82"};
+	ACR_String_t str;
+	ACR_Length_t expectedLength;
+	ACR_Count_t expectedCount;
+	ACR_Length_t offset;
+	ACR_Length_t srcLength;
+	ACR_Count_t maxCharacters;
+	int text;
+
+	for(text = 0; text < (int)(sizeof(texts) / sizeof(texts[0])); text++)
+	{
+		FromMemoryTestFill(memory, sizeof(memory), texts[text]);
+		for(offset = 0; offset < 16; offset++)
+		{
+			for(srcLength = 0; srcLength < 100; srcLength += 7)
+			{
+				for(maxCharacters = 0; maxCharacters < 60; maxCharacters += 5)
+				{
+					// start at the beginning of a character
+					if((memory[offset] & 0xC0) == 0x80)
+					{
+						continue;
+					}
+					expectedCount = FromMemoryTestCount(memory + offset, srcLength, maxCharacters, &expectedLength);
+					str = ACR_StringFromMemory(memory + offset, srcLength, maxCharacters);
+					if((str.m_Count != expectedCount) || (str.m_Buffer.m_Length != expectedLength))
+					{
+						ACR_DEBUG_PRINT(1, "FAIL text %d offset %d length %d max %d has %d characters in %d bytes instead of %d in %d",
+							text, (int)offset, (int)srcLength, (int)maxCharacters,
+							(int)str.m_Count, (int)str.m_Buffer.m_Length, (int)expectedCount, (int)expectedLength);
+						return ACR_FAILURE;
+					}
+				}
+			}
+		}
+
+		// null-terminated with no limits
+		expectedCount = FromMemoryTestCount(memory, ACR_MAX_LENGTH, ACR_MAX_COUNT, &expectedLength);
+		str = ACR_StringFromMemory(memory, ACR_MAX_LENGTH, ACR_MAX_COUNT);
+		if((str.m_Count != expectedCount) || (str.m_Buffer.m_Length != expectedLength))
+		{
+			ACR_DEBUG_PRINT(2, "FAIL text %d has %d characters instead of %d", text, (int)str.m_Count, (int)expectedCount);
+			result = ACR_FAILURE;
+		}
+	}
+
+	return result;
+}
+
+/**********************************************************/
+int FromMemoryBenchmark(void)
+{
+	ACR_Byte_t* memory;
+	ACR_Length_t length = 4 * 1024 * 1024;
+	const char* texts[] = {
+		"2020-01-01 12:00:00 INFO request complete in 12ms path=/index.html\n",
+		"\xE6\x97\xA5\xE6\x9C\xAC\xE8\xAA\x9E\xE3\x81\xAE\xE3\x83\x86\xE3\x82\xAD\xE3\x82\xB9\xE3\x83\x88 "
+	};
+	const char* names[] = {"ascii", "cjk"};
+	ACR_String_t str;
+	ACR_Length_t simpleLength;
+	ACR_Count_t simpleCount = 0;
+	ACR_Count_t count = 0;
+	double start;
+	double simpleTime;
+	double time;
+	double megabytes = (4.0 * (double)length) / (1024.0 * 1024.0);
+	int text;
+	int repeat;
+
+	memory = (ACR_Byte_t*)malloc((size_t)length);
+	if(memory == ACR_NULL)
+	{
+		// not enough memory to run the benchmark
+		return ACR_SUCCESS;
+	}
+
+	ACR_UNUSED(megabytes);
+	ACR_UNUSED(names);
+	for(text = 0; text < 2; text++)
+	{
+		FromMemoryTestFill(memory, length, texts[text]);
+
+		start = ACR_TimerSeconds();
+		for(repeat = 0; repeat < 4; repeat++)
+		{
+			simpleCount += FromMemoryTestCount(memory, ACR_MAX_LENGTH, ACR_MAX_COUNT, &simpleLength);
+		}
+		simpleTime = ACR_TimerSeconds() - start;
+
+		start = ACR_TimerSeconds();
+		for(repeat = 0; repeat < 4; repeat++)
+		{
+			str = ACR_StringFromMemory(memory, ACR_MAX_LENGTH, ACR_MAX_COUNT);
+			count += str.m_Count;
+		}
+		time = ACR_TimerSeconds() - start;
+
+		if((simpleTime > 0) && (time > 0))
+		{
+			ACR_DEBUG_PRINT(1, "BENCHMARK %s string from memory MB/s one at a time %.0f ACR_StringFromMemory %.0f",
+				names[text], megabytes / simpleTime, megabytes / time);
+		}
+	}
+
+	free(memory);
+
+	if(count != simpleCount)
+	{
+		ACR_DEBUG_PRINT(2, "FAIL benchmark counted %d characters instead of %d", (int)count, (int)simpleCount);
+		return ACR_FAILURE;
+	}
+	return ACR_SUCCESS;
+}
+
+/** compare one character at a time the simple way
+*/
+static ACR_Info_t CompareTestSimple(
+	ACR_String_t string,
+	const ACR_Byte_t* src,
+	ACR_Length_t srcLength,
+	ACR_Count_t maxCharacters,
+	ACR_Info_t caseSensitive)
+{
+	const ACR_Byte_t* str = (const ACR_Byte_t*)string.m_Buffer.m_Pointer;
+	ACR_Count_t count = 0;
+	ACR_Length_t bytes[2];
+	ACR_Unicode_t c[2];
+	while((srcLength > 0) && (src[0] != 0))
+	{
+		if(count == maxCharacters)
+		{
+			return ACR_INFO_EQUAL;
+		}
+		bytes[1] = ACR_UTF8_BYTE_COUNT(src[0]);
+		if(bytes[1] > srcLength)
+		{
+			break;
+		}
+		count++;
+		if(count > string.m_Count)
+		{
+			return ACR_INFO_GREATER;
+		}
+		bytes[0] = ACR_UTF8_BYTE_COUNT(str[0]);
+		c[0] = ACR_Utf8ToUnicode(str, (int)bytes[0]);
+		c[1] = ACR_Utf8ToUnicode(src, (int)bytes[1]);
+		if(caseSensitive != ACR_INFO_YES)
+		{
+			c[0] = ACR_UnicodeFold(c[0]);
+			c[1] = ACR_UnicodeFold(c[1]);
+		}
+		if(c[0] > c[1])
+		{
+			return ACR_INFO_LESS;
+		}
+		else if(c[0] < c[1])
+		{
+			return ACR_INFO_GREATER;
+		}
+		str += bytes[0];
+		src += bytes[1];
+		srcLength -= bytes[1];
+	}
+	if(count < string.m_Count)
+	{
+		return ACR_INFO_LESS;
+	}
+	return ACR_INFO_EQUAL;
+}
+
+/** write random characters that are mostly ASCII letters
+    and return the number of bytes written
+*/
+static ACR_Length_t CompareTestRandomText(
+	ACR_Byte_t* dst,
+	ACR_Length_t length)
+{
+	const char* pieces[] = {"a", "b", "z", "A", "B", "Z", "@", "[", "`", "{", " ", "\xC3\xA9", "\xC3\x89", "\xE2\x82\xAC"};
+	ACR_Length_t pos = 0;
+	const char* piece;
+	while(pos < length)
+	{
+		if((rand() % 4) != 0)
+		{
+			piece = pieces[rand() % 10];
+		}
+		else
+		{
+			piece = pieces[rand() % 14];
+		}
+		if((pos + strlen(piece)) > length)
+		{
+			break;
+		}
+		memcpy(dst + pos, piece, strlen(piece));
+		pos += (ACR_Length_t)strlen(piece);
+	}
+	return pos;
+}
+
+/**********************************************************/
+int CompareTest(void)
+{
+	ACR_Byte_t a[160];
+	ACR_Byte_t b[160];
+	ACR_String_t string;
+	ACR_Length_t aLength;
+	ACR_Length_t bLength;
+	ACR_Length_t offset;
+	ACR_Length_t srcLength;
+	ACR_Count_t maxCharacters;
+	ACR_Info_t caseSensitive;
+	ACR_Info_t expected;
+	ACR_Info_t actual;
+	int i;
+	int test;
+
+	// case-insensitive greek and cyrillic
+	string = ACR_StringFromMemory((ACR_Byte_t*)"\xCE\xA3\xCE\x9F\xCE\xA6\xCE\x99\xCE\x91 \xD0\x9C\xD0\x98\xD0\xA0", ACR_MAX_LENGTH, ACR_MAX_COUNT);
+	if(ACR_StringCompareToMemory(string, (const ACR_Byte_t*)"\xCF\x83\xCE\xBF\xCF\x86\xCE\xB9\xCE\xB1 \xD0\xBC\xD0\xB8\xD1\x80", ACR_MAX_LENGTH, ACR_MAX_COUNT, ACR_INFO_NO) != ACR_INFO_EQUAL)
+	{
+		ACR_DEBUG_PRINT(6, "FAIL case-insensitive compare of greek and cyrillic");
+		return ACR_FAILURE;
+	}
+
+	srand(4);
+	for(test = 0; test < 20000; test++)
+	{
+		// the string starts anywhere and src is copied
+		// from it to an offset and then changed a little
+		offset = (ACR_Length_t)(rand() % 16);
+		aLength = CompareTestRandomText(a + 8, (ACR_Length_t)(rand() % 120));
+		a[8 + aLength] = 0;
+		bLength = aLength;
+		memcpy(b + offset, a + 8, aLength + 1);
+		switch(rand() % 4)
+		{
+			case 0:
+				// flip the case of ASCII letters
+				for(i = 0; i < (int)bLength; i++)
+				{
+					if(((b[offset + i] | 0x20) >= 'a') && ((b[offset + i] | 0x20) <= 'z') && ((rand() % 3) == 0))
+					{
+						b[offset + i] ^= 0x20;
+					}
+				}
+				break;
+			case 1:
+				// change one ASCII byte
+				if(bLength > 0)
+				{
+					i = rand() % (int)bLength;
+					if(b[offset + i] < 0x80)
+					{
+						b[offset + i] = (ACR_Byte_t)('!' + (rand() % 90));
+					}
+				}
+				break;
+			case 2:
+				// make src shorter
+				if(bLength > 0)
+				{
+					bLength = (ACR_Length_t)(rand() % (int)bLength);
+					b[offset + bLength] = 0;
+				}
+				break;
+			default:
+				// make src longer
+				bLength += CompareTestRandomText(b + offset + bLength, (ACR_Length_t)(rand() % 20));
+				b[offset + bLength] = 0;
+				break;
+		}
+
+		string = ACR_StringFromMemory(a + 8, aLength, ACR_MAX_COUNT);
+		srcLength = ((rand() % 2) == 0) ? ACR_MAX_LENGTH : (ACR_Length_t)(rand() % 140);
+		maxCharacters = ((rand() % 2) == 0) ? ACR_MAX_COUNT : (ACR_Count_t)(rand() % 140);
+		caseSensitive = ((rand() % 2) == 0) ? ACR_INFO_YES : ACR_INFO_NO;
+
+		expected = CompareTestSimple(string, b + offset, srcLength, maxCharacters, caseSensitive);
+		actual = ACR_StringCompareToMemory(string, b + offset, srcLength, maxCharacters, caseSensitive);
+		if(actual != expected)
+		{
+			ACR_DEBUG_PRINT(3, "FAIL compare test %d is %d instead of %d", test, (int)actual, (int)expected);
+			return ACR_FAILURE;
+		}
+	}
+
+	return ACR_SUCCESS;
+}
+
+/**********************************************************/
+int CompareBenchmark(void)
+{
+	ACR_Byte_t* a;
+	ACR_Byte_t* b;
+	ACR_Length_t length = 1024 * 1024;
+	ACR_String_t string;
+	ACR_Info_t caseSensitive;
+	ACR_Info_t simpleResult = ACR_INFO_EQUAL;
+	ACR_Info_t result = ACR_INFO_EQUAL;
+	double start;
+	double simpleTime;
+	double time;
+	double megabytes = (8.0 * (double)length) / (1024.0 * 1024.0);
+	int repeat;
+
+	a = (ACR_Byte_t*)malloc((size_t)length);
+	b = (ACR_Byte_t*)malloc((size_t)length);
+	if((a == ACR_NULL) || (b == ACR_NULL))
+	{
+		// not enough memory to run the benchmark
+		free(a);
+		free(b);
+		return ACR_SUCCESS;
+	}
+
+	ACR_UNUSED(megabytes);
+	FromMemoryTestFill(a, length, "The Quick Brown Fox Jumps Over The Lazy Dog. ");
+	FromMemoryTestFill(b, length, "the quick brown fox jumps over the lazy dog. ");
+	string = ACR_StringFromMemory(a, length, ACR_MAX_COUNT);
+
+	for(caseSensitive = ACR_INFO_YES; caseSensitive <= ACR_INFO_NO; caseSensitive++)
+	{
+		// compare a string with itself or with a
+		// lowercase copy of itself
+		const ACR_Byte_t* src = (caseSensitive == ACR_INFO_YES) ? a : b;
+
+		start = ACR_TimerSeconds();
+		for(repeat = 0; repeat < 8; repeat++)
+		{
+			simpleResult |= CompareTestSimple(string, src, ACR_MAX_LENGTH, ACR_MAX_COUNT, caseSensitive);
+		}
+		simpleTime = ACR_TimerSeconds() - start;
+
+		start = ACR_TimerSeconds();
+		for(repeat = 0; repeat < 8; repeat++)
+		{
+			result |= ACR_StringCompareToMemory(string, src, ACR_MAX_LENGTH, ACR_MAX_COUNT, caseSensitive);
+		}
+		time = ACR_TimerSeconds() - start;
+
+		if((simpleTime > 0) && (time > 0))
+		{
+			ACR_DEBUG_PRINT(4, "BENCHMARK %s compare MB/s one at a time %.0f ACR_StringCompareToMemory %.0f",
+				(caseSensitive == ACR_INFO_YES) ? "case-sensitive" : "case-insensitive", megabytes / simpleTime, megabytes / time);
+		}
+	}
+
+	free(a);
+	free(b);
+
+	if((result != ACR_INFO_EQUAL) || (simpleResult != ACR_INFO_EQUAL))
+	{
+		ACR_DEBUG_PRINT(5, "FAIL benchmark strings are not equal");
+		return ACR_FAILURE;
+	}
+	return ACR_SUCCESS;
+}
+
+/** write random characters of every UTF8 length and return
+    the number of bytes written
+*/
+static ACR_Length_t IndexTestRandomText(
+	ACR_Byte_t* dst,
+	ACR_Length_t length)
+{
+	const char* pieces[] = {"a", "Z", " ", "\xC3\xA9", "\xD0\x96", "\xE2\x82\xAC", "\xE6\x97\xA5", "\xF0\x9F\x99\x82"};
+	ACR_Length_t pos = 0;
+	const char* piece;
+	while(pos < length)
+	{
+		// use long runs of ASCII sometimes so that whole
+		// chunks are skipped
+		if((rand() % 64) == 0)
+		{
+			ACR_Length_t run = (ACR_Length_t)(rand() % 200);
+			while((run > 0) && (pos < length))
+			{
+				dst[pos] = (ACR_Byte_t)('a' + (rand() % 26));
+				pos++;
+				run--;
+			}
+			continue;
+		}
+		piece = pieces[rand() % 8];
+		if((pos + strlen(piece)) > length)
+		{
+			break;
+		}
+		memcpy(dst + pos, piece, strlen(piece));
+		pos += (ACR_Length_t)strlen(piece);
+	}
+	return pos;
+}
+
+/** check every character position of the string against
+    the byte offsets found one character at a time
+*/
+static int IndexTestCheck(
+	ACR_String_t string,
+	ACR_StringIndex_t* index)
+{
+	const ACR_Byte_t* src = (const ACR_Byte_t*)string.m_Buffer.m_Pointer;
+	ACR_Length_t* offsets;
+	ACR_Length_t pos = 0;
+	ACR_Count_t count = 0;
+	ACR_Count_t start;
+	ACR_Count_t length;
+	ACR_Unicode_t character;
+	ACR_STRING(part);
+	int test;
+
+	offsets = (ACR_Length_t*)malloc(((size_t)string.m_Buffer.m_Length + 1) * sizeof(ACR_Length_t));
+	if(offsets == ACR_NULL)
+	{
+		return ACR_FAILURE;
+	}
+	while(pos < string.m_Buffer.m_Length)
+	{
+		offsets[count] = pos;
+		count++;
+		pos += ACR_UTF8_BYTE_COUNT(src[pos]);
+	}
+	offsets[count] = pos;
+
+	for(start = 0; start < count; start++)
+	{
+		if((ACR_StringCharAt(string, index, start, &character) != ACR_INFO_OK) ||
+		   (character != ACR_Utf8ToUnicode(src + offsets[start], ACR_UTF8_BYTE_COUNT(src[offsets[start]]))))
+		{
+			ACR_DEBUG_PRINT(6, "FAIL character %d is wrong", (int)start);
+			free(offsets);
+			return ACR_FAILURE;
+		}
+	}
+	if(ACR_StringCharAt(string, index, count, &character) != ACR_INFO_ERROR)
+	{
+		ACR_DEBUG_PRINT(7, "FAIL found a character past the end of the string");
+		free(offsets);
+		return ACR_FAILURE;
+	}
+
+	for(test = 0; test < 2000; test++)
+	{
+		start = (ACR_Count_t)(rand() % (int)(count + 1));
+		length = (ACR_Count_t)(rand() % ((test % 2) ? 8 : 2000));
+		if(test == 0)
+		{
+			// a part that goes to the end of the string
+			start = 0;
+			length = ACR_MAX_COUNT;
+		}
+		if((ACR_StringSubstringChars(string, index, start, length, &part) != ACR_INFO_OK))
+		{
+			ACR_DEBUG_PRINT(8, "FAIL substring %d of %d characters from %d", test, (int)length, (int)start);
+			free(offsets);
+			return ACR_FAILURE;
+		}
+		if(length > (count - start))
+		{
+			length = count - start;
+		}
+		if((part.m_Count != length) ||
+		   (part.m_Buffer.m_Length != (offsets[start + length] - offsets[start])) ||
+		   ((length > 0) && (part.m_Buffer.m_Pointer != (void*)(src + offsets[start]))))
+		{
+			ACR_DEBUG_PRINT(9, "FAIL substring %d has %d characters in %d bytes instead of %d in %d", test,
+				(int)part.m_Count, (int)part.m_Buffer.m_Length, (int)length, (int)(offsets[start + length] - offsets[start]));
+			free(offsets);
+			return ACR_FAILURE;
+		}
+	}
+	if(ACR_StringSubstringChars(string, index, count + 1, 1, &part) != ACR_INFO_ERROR)
+	{
+		ACR_DEBUG_PRINT(10, "FAIL substring past the end of the string");
+		free(offsets);
+		return ACR_FAILURE;
+	}
+
+	free(offsets);
+	return ACR_SUCCESS;
+}
+
+/**********************************************************/
+int IndexTest(void)
+{
+	ACR_Byte_t memory[4096];
+	ACR_Length_t length;
+	ACR_Length_t change;
+	ACR_StringIndex_t index;
+	ACR_STRING(str);
+	int test;
+
+	srand(38);
+	ACR_StringIndexInit(&index);
+
+	// an empty string has one position, which is its end
+	if((IndexTestCheck(str, &index) != ACR_SUCCESS) ||
+	   (IndexTestCheck(str, ACR_NULL) != ACR_SUCCESS))
+	{
+		ACR_StringIndexDeInit(&index);
+		return ACR_FAILURE;
+	}
+
+	for(test = 0; test < 8; test++)
+	{
+		length = IndexTestRandomText(memory, (ACR_Length_t)(rand() % (int)sizeof(memory)));
+		ACR_STRING_REFERENCE(str, memory, length, ACR_EMPTY_VALUE);
+		if((IndexTestCheck(str, &index) != ACR_SUCCESS) ||
+		   (IndexTestCheck(str, ACR_NULL) != ACR_SUCCESS))
+		{
+			ACR_StringIndexDeInit(&index);
+			return ACR_FAILURE;
+		}
+
+		// change the characters in place without changing
+		// the length so that only invalidating the index
+		// will update it
+		change = (length > 64) ? 64 : length;
+		while((change < length) && ((memory[change] & 0xC0) == 0x80))
+		{
+			change++;
+		}
+		memset(memory, 'x', change);
+		ACR_StringIndexInvalidate(&index);
+		if(IndexTestCheck(str, &index) != ACR_SUCCESS)
+		{
+			ACR_StringIndexDeInit(&index);
+			return ACR_FAILURE;
+		}
+	}
+
+	ACR_StringIndexDeInit(&index);
+	return ACR_SUCCESS;
+}
+
+/**********************************************************/
+int IndexBenchmark(void)
+{
+	ACR_Byte_t* memory;
+	ACR_Length_t length = 4 * 1024 * 1024;
+	ACR_StringIndex_t index;
+	ACR_STRING(str);
+	ACR_STRING(part);
+	ACR_Length_t simpleTotal = 0;
+	ACR_Length_t total = 0;
+	ACR_Count_t count;
+	double start;
+	double simpleTime;
+	double buildTime;
+	double time;
+	int repeat;
+
+	memory = (ACR_Byte_t*)malloc((size_t)length);
+	if(memory == ACR_NULL)
+	{
+		// not enough memory to run the benchmark
+		return ACR_SUCCESS;
+	}
+
+	srand(38);
+	length = IndexTestRandomText(memory, length);
+	ACR_STRING_REFERENCE(str, memory, length, ACR_EMPTY_VALUE);
+	ACR_StringIndexInit(&index);
+
+	start = ACR_TimerSeconds();
+	ACR_StringIndexBuild(&index, str);
+	buildTime = ACR_TimerSeconds() - start;
+	count = index.m_Count;
+
+	// pick the same parts from across the whole string with
+	// and without the index
+	srand(380);
+	start = ACR_TimerSeconds();
+	for(repeat = 0; repeat < 200; repeat++)
+	{
+		ACR_StringSubstringChars(str, ACR_NULL, (ACR_Count_t)(((double)rand() / (double)RAND_MAX) * (double)(count - 16)), 16, &part);
+		simpleTotal += part.m_Buffer.m_Length;
+	}
+	simpleTime = ACR_TimerSeconds() - start;
+
+	srand(380);
+	start = ACR_TimerSeconds();
+	for(repeat = 0; repeat < 200; repeat++)
+	{
+		ACR_StringSubstringChars(str, &index, (ACR_Count_t)(((double)rand() / (double)RAND_MAX) * (double)(count - 16)), 16, &part);
+		total += part.m_Buffer.m_Length;
+	}
+	time = ACR_TimerSeconds() - start;
+
+	if((simpleTime > 0) && (time > 0))
+	{
+		ACR_DEBUG_PRINT(11, "BENCHMARK substrings per second of a %d character string without index %.0f with index %.0f (built in %.1f ms)",
+			(int)count, 200.0 / simpleTime, 200.0 / time, buildTime * 1000.0);
+	}
+	ACR_UNUSED(buildTime);
+
+	ACR_StringIndexDeInit(&index);
+	free(memory);
+
+	if(total != simpleTotal)
+	{
+		ACR_DEBUG_PRINT(12, "FAIL benchmark substrings are not the same");
+		return ACR_FAILURE;
+	}
+	return ACR_SUCCESS;
+}
+
+/** split one character at a time the simple way and return
+    the number of tokens
+*/
+static ACR_Count_t SplitTestSimple(
+	ACR_String_t source,
+	ACR_String_t delimiters,
+	ACR_Info_t skipEmpty,
+	ACR_String_t* tokens,
+	ACR_Count_t tokensCount)
+{
+	const ACR_Byte_t* src = (const ACR_Byte_t*)source.m_Buffer.m_Pointer;
+	const ACR_Byte_t* delimiter = (const ACR_Byte_t*)delimiters.m_Buffer.m_Pointer;
+	ACR_Length_t pos = 0;
+	ACR_Length_t start = 0;
+	ACR_Length_t d;
+	ACR_Length_t bytes;
+	ACR_Count_t characters = 0;
+	ACR_Count_t count = 0;
+	int found;
+
+	while(count < tokensCount)
+	{
+		found = 0;
+		if(pos < source.m_Buffer.m_Length)
+		{
+			bytes = ACR_UTF8_BYTE_COUNT(src[pos]);
+			for(d = 0; d < delimiters.m_Buffer.m_Length; d += ACR_UTF8_BYTE_COUNT(delimiter[d]))
+			{
+				if((bytes == ACR_UTF8_BYTE_COUNT(delimiter[d])) && (memcmp(src + pos, delimiter + d, bytes) == 0))
+				{
+					found = 1;
+					break;
+				}
+			}
+			if(found == 0)
+			{
+				characters++;
+				pos += bytes;
+				continue;
+			}
+		}
+
+		if((pos != start) || (skipEmpty == ACR_INFO_NO))
+		{
+			tokens[count].m_Buffer.m_Pointer = (void*)(src + start);
+			tokens[count].m_Buffer.m_Length = pos - start;
+			tokens[count].m_Count = characters;
+			count++;
+		}
+		if(found == 0)
+		{
+			break;
+		}
+		pos += bytes;
+		start = pos;
+		characters = 0;
+	}
+	return count;
+}
+
+/** check that two tokens are the same
+*/
+static int SplitTestSame(
+	ACR_String_t a,
+	ACR_String_t b)
+{
+	return (a.m_Buffer.m_Length == b.m_Buffer.m_Length) &&
+	       (a.m_Count == b.m_Count) &&
+	       ((a.m_Buffer.m_Length == 0) || (a.m_Buffer.m_Pointer == b.m_Buffer.m_Pointer));
+}
+
+/**********************************************************/
+int SplitTest(void)
+{
+	ACR_Byte_t memory[2048];
+	const char* delimiterTexts[] = {",", " Z", "a,;:!Z", "\xE2\x82\xAC,", "\xE2\x80\x94", ""};
+	ACR_String_t expected[1024];
+	ACR_String_t tokens[1024];
+	ACR_String_t batch[3];
+	ACR_StringTokenizer_t tokenizer;
+	ACR_STRING(source);
+	ACR_STRING(delimiters);
+	ACR_Info_t skipEmpty;
+	ACR_Length_t length;
+	ACR_Count_t expectedCount;
+	ACR_Count_t count;
+	ACR_Count_t batchCount;
+	ACR_Count_t i;
+	ACR_Count_t n;
+	int text;
+	int test;
+
+	srand(39);
+	for(test = 0; test < 600; test++)
+	{
+		text = test % 6;
+		skipEmpty = ((test / 6) % 2) ? ACR_INFO_YES : ACR_INFO_NO;
+		length = IndexTestRandomText(memory, (ACR_Length_t)(rand() % (int)sizeof(memory)));
+		if((test % 5) == 0)
+		{
+			// add commas to get some short and empty tokens
+			for(i = 0; i < length; i += (ACR_Count_t)(1 + (rand() % 16)))
+			{
+				if(memory[i] < 0x80)
+				{
+					memory[i] = ',';
+				}
+			}
+		}
+		ACR_STRING_REFERENCE(source, memory, length, ACR_EMPTY_VALUE);
+		ACR_STRING_REFERENCE(delimiters, delimiterTexts[text], strlen(delimiterTexts[text]), ACR_EMPTY_VALUE);
+		expectedCount = SplitTestSimple(source, delimiters, skipEmpty, expected, 1024);
+
+		// one at a time
+		ACR_StringTokenizerInit(&tokenizer, source, delimiters, skipEmpty);
+		count = 0;
+		while((count < 1024) && (ACR_StringTokenizerNext(&tokenizer, &tokens[count]) == ACR_INFO_OK))
+		{
+			count++;
+		}
+		if(count != expectedCount)
+		{
+			ACR_DEBUG_PRINT(13, "FAIL split test %d found %d tokens instead of %d", test, (int)count, (int)expectedCount);
+			return ACR_FAILURE;
+		}
+		for(i = 0; i < count; i++)
+		{
+			if(SplitTestSame(tokens[i], expected[i]) == 0)
+			{
+				ACR_DEBUG_PRINT(14, "FAIL split test %d token %d has %d characters in %d bytes instead of %d in %d", test, (int)i,
+					(int)tokens[i].m_Count, (int)tokens[i].m_Buffer.m_Length, (int)expected[i].m_Count, (int)expected[i].m_Buffer.m_Length);
+				return ACR_FAILURE;
+			}
+		}
+
+		// in batches
+		ACR_StringTokenizerInit(&tokenizer, source, delimiters, skipEmpty);
+		batchCount = 0;
+		while((n = ACR_StringTokenizerNextBatch(&tokenizer, batch, 3)) != 0)
+		{
+			for(i = 0; i < n; i++)
+			{
+				if(((batchCount + i) >= count) || (SplitTestSame(batch[i], expected[batchCount + i]) == 0))
+				{
+					ACR_DEBUG_PRINT(15, "FAIL split test %d batch token %d is wrong", test, (int)(batchCount + i));
+					return ACR_FAILURE;
+				}
+			}
+			batchCount += n;
+		}
+		if(batchCount != count)
+		{
+			ACR_DEBUG_PRINT(16, "FAIL split test %d found %d tokens in batches instead of %d", test, (int)batchCount, (int)count);
+			return ACR_FAILURE;
+		}
+
+		// into a fixed number of fields where the last one
+		// has the rest of the string
+		if(skipEmpty == ACR_INFO_NO)
+		{
+			n = (ACR_Count_t)(1 + (rand() % 8));
+			count = ACR_StringSplit(source, delimiters, tokens, n);
+			if(count != ((expectedCount < n) ? expectedCount : n))
+			{
+				ACR_DEBUG_PRINT(17, "FAIL split test %d has %d fields instead of %d", test, (int)count, (int)n);
+				return ACR_FAILURE;
+			}
+			for(i = 0; (i + 1) < count; i++)
+			{
+				if(SplitTestSame(tokens[i], expected[i]) == 0)
+				{
+					ACR_DEBUG_PRINT(18, "FAIL split test %d field %d is wrong", test, (int)i);
+					return ACR_FAILURE;
+				}
+			}
+			if(((ACR_Byte_t*)tokens[i].m_Buffer.m_Pointer + tokens[i].m_Buffer.m_Length != memory + length) ||
+			   (tokens[i].m_Count != (ACR_StringFromMemory(tokens[i].m_Buffer.m_Pointer, tokens[i].m_Buffer.m_Length, ACR_MAX_COUNT)).m_Count))
+			{
+				ACR_DEBUG_PRINT(19, "FAIL split test %d last field is not the rest of the string", test);
+				return ACR_FAILURE;
+			}
+		}
+	}
+
+	return ACR_SUCCESS;
+}
+
+/**********************************************************/
+int SplitBenchmark(void)
+{
+	ACR_Byte_t* memory;
+	ACR_Length_t length = 4 * 1024 * 1024;
+	const char* line = "2020-01-01,12:00:00,INFO,caf\xC3\xA9,42,/index.html,\xE6\x97\xA5\xE6\x9C\xAC\xE8\xAA\x9E,12.5\n";
+	ACR_StringTokenizer_t tokenizer;
+	ACR_STRING(source);
+	ACR_STRING(delimiters);
+	ACR_STRING(token);
+	ACR_Count_t simpleCount = 0;
+	ACR_Count_t count = 0;
+	ACR_Length_t pos;
+	ACR_Length_t start;
+	double startTime;
+	double simpleTime;
+	double time;
+	double megabytes = (4.0 * (double)length) / (1024.0 * 1024.0);
+	int repeat;
+
+	memory = (ACR_Byte_t*)malloc((size_t)length);
+	if(memory == ACR_NULL)
+	{
+		// not enough memory to run the benchmark
+		return ACR_SUCCESS;
+	}
+
+	ACR_UNUSED(megabytes);
+	FromMemoryTestFill(memory, length, line);
+	length = (ACR_Length_t)strlen((const char*)memory);
+	ACR_STRING_REFERENCE(source, memory, length, ACR_EMPTY_VALUE);
+	ACR_STRING_REFERENCE(delimiters, ",\n", 2, ACR_EMPTY_VALUE);
+
+	startTime = ACR_TimerSeconds();
+	for(repeat = 0; repeat < 4; repeat++)
+	{
+		start = 0;
+		for(pos = 0; pos <= length; pos++)
+		{
+			if((pos == length) || (memory[pos] == ',') || (memory[pos] == '\n'))
+			{
+				token = ACR_StringFromMemory(memory + start, pos - start, ACR_MAX_COUNT);
+				simpleCount += token.m_Count;
+				start = pos + 1;
+			}
+		}
+	}
+	simpleTime = ACR_TimerSeconds() - startTime;
+
+	startTime = ACR_TimerSeconds();
+	for(repeat = 0; repeat < 4; repeat++)
+	{
+		ACR_StringTokenizerInit(&tokenizer, source, delimiters, ACR_INFO_NO);
+		while(ACR_StringTokenizerNext(&tokenizer, &token) == ACR_INFO_OK)
+		{
+			count += token.m_Count;
+		}
+	}
+	time = ACR_TimerSeconds() - startTime;
+
+	if((simpleTime > 0) && (time > 0))
+	{
+		ACR_DEBUG_PRINT(20, "BENCHMARK split MB/s find then count %.0f ACR_StringTokenizerNext %.0f",
+			megabytes / simpleTime, megabytes / time);
+	}
+
+	free(memory);
+
+	if(count != simpleCount)
+	{
+		ACR_DEBUG_PRINT(21, "FAIL benchmark counted %d characters instead of %d", (int)count, (int)simpleCount);
+		return ACR_FAILURE;
+	}
+	return ACR_SUCCESS;
+}
+
+/**********************************************************/
+int EnumTableTest(void)
+{
+	const char* names[] = {"red", "green", "blue", "caf\xC3\xA9", "\xC3\x9C" "ber", "", "x", "red green", "gr\xC3\xBCn", "\xE6\x97\xA5\xE6\x9C\xAC"};
+	const char* same[] = {"RED", "Green", "bLUE", "CAF\xC3\x89", "\xC3\xBC" "BER", "", "X", "Red Green", "GR\xC3\x9CN", "\xE6\x97\xA5\xE6\x9C\xAC"};
+	const char* missing[] = {"re", "redd", "blue ", "cafe", "ber", "y", "red  green", "\xE6\x97\xA5"};
+	const char* duplicates[] = {"one", "two", "TWO"};
+	char longNames[200][8];
+	const char* longNamePointers[200];
+	ACR_EnumTable_t table;
+	ACR_Count_t count = (ACR_Count_t)(sizeof(names) / sizeof(names[0]));
+	ACR_Count_t value;
+	ACR_Count_t i;
+
+	ACR_EnumTableInit(&table);
+	if(ACR_EnumTableBuild(&table, names, count) != ACR_INFO_OK)
+	{
+		ACR_DEBUG_PRINT(22, "FAIL enum table was not built");
+		return ACR_FAILURE;
+	}
+	for(i = 0; i < count; i++)
+	{
+		if((ACR_EnumTableFind(&table, ACR_StringFromMemory((ACR_Byte_t*)names[i], ACR_MAX_LENGTH, ACR_MAX_COUNT), &value) != ACR_INFO_OK) || (value != i) ||
+		   (ACR_EnumTableFind(&table, ACR_StringFromMemory((ACR_Byte_t*)same[i], ACR_MAX_LENGTH, ACR_MAX_COUNT), &value) != ACR_INFO_OK) || (value != i))
+		{
+			ACR_DEBUG_PRINT(23, "FAIL enum table did not find name %d", (int)i);
+			return ACR_FAILURE;
+		}
+	}
+	for(i = 0; i < (ACR_Count_t)(sizeof(missing) / sizeof(missing[0])); i++)
+	{
+		if(ACR_EnumTableFind(&table, ACR_StringFromMemory((ACR_Byte_t*)missing[i], ACR_MAX_LENGTH, ACR_MAX_COUNT), &value) != ACR_INFO_UNKNOWN)
+		{
+			ACR_DEBUG_PRINT(24, "FAIL enum table found missing name %d", (int)i);
+			return ACR_FAILURE;
+		}
+	}
+
+	if(ACR_EnumTableBuild(&table, duplicates, 3) != ACR_INFO_INVALID)
+	{
+		ACR_DEBUG_PRINT(25, "FAIL enum table allowed the same name twice");
+		return ACR_FAILURE;
+	}
+
+	// a larger table reuses the memory of the table
+	for(i = 0; i < 200; i++)
+	{
+		longNames[i][0] = 'v';
+		longNames[i][1] = (char)('0' + ((i * 7) / 1000));
+		longNames[i][2] = (char)('0' + (((i * 7) / 100) % 10));
+		longNames[i][3] = (char)('0' + (((i * 7) / 10) % 10));
+		longNames[i][4] = (char)('0' + ((i * 7) % 10));
+		longNames[i][5] = 0;
+		longNamePointers[i] = longNames[i];
+	}
+	if(ACR_EnumTableBuild(&table, longNamePointers, 200) != ACR_INFO_OK)
+	{
+		ACR_DEBUG_PRINT(26, "FAIL large enum table was not built");
+		return ACR_FAILURE;
+	}
+	for(i = 0; i < 200; i++)
+	{
+		if((ACR_EnumTableFind(&table, ACR_StringFromMemory((ACR_Byte_t*)longNames[i], ACR_MAX_LENGTH, ACR_MAX_COUNT), &value) != ACR_INFO_OK) || (value != i))
+		{
+			ACR_DEBUG_PRINT(27, "FAIL large enum table did not find name %d", (int)i);
+			return ACR_FAILURE;
+		}
+	}
+	ACR_EnumTableDeInit(&table);
+
+	// the built in tables
+	for(i = 0; i < ACR_INFO_COUNT; i++)
+	{
+		if(ACR_InfoFromString(ACR_InfoToString((ACR_Info_t)i)) != (ACR_Info_t)i)
+		{
+			ACR_DEBUG_PRINT(28, "FAIL ACR_InfoFromString() did not find %d", (int)i);
+			return ACR_FAILURE;
+		}
+	}
+	if((ACR_DayOfWeekFromString(ACR_StringFromMemory((ACR_Byte_t*)"sunday", ACR_MAX_LENGTH, ACR_MAX_COUNT)) != ACR_DAY_SUNDAY) ||
+	   (ACR_DayOfWeekFromString(ACR_StringFromMemory((ACR_Byte_t*)"up", ACR_MAX_LENGTH, ACR_MAX_COUNT)) != ACR_DAY_OF_WEEK_UNKNOWN) ||
+	   (ACR_MonthFromString(ACR_StringFromMemory((ACR_Byte_t*)"December", ACR_MAX_LENGTH, ACR_MAX_COUNT)) != ACR_MONTH_DECEMBER) ||
+	   (ACR_MonthFromString(ACR_StringFromMemory((ACR_Byte_t*)"monday", ACR_MAX_LENGTH, ACR_MAX_COUNT)) != ACR_MONTH_UNKNOWN))
+	{
+		ACR_DEBUG_PRINT(29, "FAIL day of week or month lookup is wrong");
+		return ACR_FAILURE;
+	}
+
+	return ACR_SUCCESS;
+}
+
+/**********************************************************/
+int EnumTableBenchmark(void)
+{
+	ACR_String_t names[ACR_INFO_COUNT];
+	ACR_Count_t simpleTotal = 0;
+	ACR_Count_t total = 0;
+	ACR_Count_t i;
+	ACR_Count_t j;
+	double start;
+	double simpleTime;
+	double time;
+	int repeat;
+
+	for(i = 0; i < ACR_INFO_COUNT; i++)
+	{
+		names[i] = ACR_InfoToString((ACR_Info_t)i);
+	}
+
+	start = ACR_TimerSeconds();
+	for(repeat = 0; repeat < 20000; repeat++)
+	{
+		for(i = 0; i < ACR_INFO_COUNT; i++)
+		{
+			for(j = 0; j < ACR_INFO_COUNT; j++)
+			{
+				if(ACR_StringCompareToMemory(names[i], (const ACR_Byte_t*)names[j].m_Buffer.m_Pointer, ACR_MAX_LENGTH, ACR_MAX_COUNT, ACR_INFO_NO) == ACR_INFO_EQUAL)
+				{
+					break;
+				}
+			}
+			simpleTotal += j;
+		}
+	}
+	simpleTime = ACR_TimerSeconds() - start;
+
+	start = ACR_TimerSeconds();
+	for(repeat = 0; repeat < 20000; repeat++)
+	{
+		for(i = 0; i < ACR_INFO_COUNT; i++)
+		{
+			total += (ACR_Count_t)ACR_InfoFromString(names[i]);
+		}
+	}
+	time = ACR_TimerSeconds() - start;
+
+	if((simpleTime > 0) && (time > 0))
+	{
+		ACR_DEBUG_PRINT(30, "BENCHMARK ACR_Info_t names M/s compare each name %.1f ACR_InfoFromString %.1f",
+			(20000.0 * ACR_INFO_COUNT) / (simpleTime * 1000000.0), (20000.0 * ACR_INFO_COUNT) / (time * 1000000.0));
+	}
+
+	if(total != simpleTotal)
+	{
+		ACR_DEBUG_PRINT(31, "FAIL benchmark found different values");
+		return ACR_FAILURE;
+	}
+	return ACR_SUCCESS;
+}
@@ -0,0 +1,588 @@
+/*
+
+    ********** DO NOT REMOVE THIS INFORMATION ************
+
+    ACR - A set of C functions in a git Repository
+    Copyright (C) 2018 - 2020 Adam C. Rosenberg
+
+    Please read LICENSE before using this code
+
+    Please read README.md for instructions on including
+    this code in your project and where to find examples
+
+    If you contribute to this code, Please add your name
+    and email address to the AUTHORS list below so that
+    we know who to thank!
+
+    AUTHORS
+
+    Adam Rosenberg <adam@sirspot.com>
+
+    LICENSE
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+    ******************************************************
+
+*/
+/** \file test_stringdictionary.c
+
+    application to test the ACR_StringDictionary_t type
+
+*/
+#include "ACR/stringdictionary.h"
+
+#include <stdio.h>
+// included for memcmp()
+#include <string.h>
+
+// the number of strings used by the tests
+#define TEST_STRING_COUNT 20000
+
+// the largest number of strings in the benchmark. build with
+// -D TEST_STRINGDICTIONARY_MAX_COUNT=10000000 to also run 10M
+// strings on a machine with enough memory
+#ifndef TEST_STRINGDICTIONARY_MAX_COUNT
+#define TEST_STRINGDICTIONARY_MAX_COUNT 1000000
+#endif
+
+//
+// PROTOTYPES
+//
+
+/** check adding, finding, and getting strings with several
+    block sizes, and using the data in place
+*/
+int StringDictionaryTest(void);
+
+/** check that data that is not valid is not used
+*/
+int StringDictionaryRefTest(void);
+
+/** compare the memory and speed of ACR_StringDictionary_t
+    with an array of ACR_String_t from 1K to
+    TEST_STRINGDICTIONARY_MAX_COUNT strings
+*/
+int StringDictionaryBenchmark(void);
+
+//
+// MAIN
+//
+
+int main(int argc, char** argv)
+{
+	int result = ACR_SUCCESS;
+
+	ACR_UNUSED(argc);
+	ACR_UNUSED(argv);
+
+	#if ACR_HAS_MALLOC == ACR_BOOL_TRUE
+	result |= StringDictionaryTest();
+	result |= StringDictionaryRefTest();
+
+	result |= StringDictionaryBenchmark();
+	#endif
+
+	return result;
+}
+
+//
+// IMPLEMENTATION
+//
+
+/** write the string for a number into memory. many strings
+    are prefixes of other strings
+*/
+static ACR_String_t TestString(
+	char* memory,
+	int i)
+{
+	const char* prefixes[] = {"", "k", "key_", "caf\xC3\xA9_", "key_1_", "a much longer string that needs a long prefix and more than 128 bytes so that the length uses two bytes_____________________________"};
+	sprintf(memory, "%s%d", prefixes[i % 6], i / 6);
+	return ACR_StringFromMemory((ACR_Byte_t*)memory, ACR_MAX_LENGTH, ACR_MAX_COUNT);
+}
+
+/** compare two strings in byte order for qsort()
+*/
+static int TestStringCompare(
+	const void* a,
+	const void* b)
+{
+	const ACR_String_t* first = (const ACR_String_t*)a;
+	const ACR_String_t* second = (const ACR_String_t*)b;
+	ACR_Length_t length = (first->m_Buffer.m_Length < second->m_Buffer.m_Length) ? first->m_Buffer.m_Length : second->m_Buffer.m_Length;
+	int result = (length > 0) ? memcmp(first->m_Buffer.m_Pointer, second->m_Buffer.m_Pointer, (size_t)length) : 0;
+	if(result != 0)
+	{
+		return result;
+	}
+	return (first->m_Buffer.m_Length < second->m_Buffer.m_Length) ? -1 : ((first->m_Buffer.m_Length > second->m_Buffer.m_Length) ? 1 : 0);
+}
+
+/** check that every string is found with its id and that
+    every id gets its string
+    \returns ACR_SUCCESS or ACR_FAILURE
+*/
+static int TestCheckStrings(
+	const ACR_StringDictionary_t* dictionary,
+	const ACR_String_t* strings,
+	int count)
+{
+	ACR_String_t string;
+	ACR_Byte_t memory[256];
+	char missing[256];
+	ACR_Count_t id;
+	int i;
+
+	if(dictionary->m_Count != (ACR_Count_t)count)
+	{
+		return ACR_FAILURE;
+	}
+	for(i = 0; i < count; i++)
+	{
+		if((ACR_StringDictionaryFind(dictionary, strings[i], &id) != ACR_INFO_OK) || (id != (ACR_Count_t)i))
+		{
+			ACR_DEBUG_PRINT(1, "FAIL find %d", i);
+			return ACR_FAILURE;
+		}
+		if((ACR_StringDictionaryGet(dictionary, (ACR_Count_t)i, memory, sizeof(memory), &string) != ACR_INFO_OK) ||
+		   (TestStringCompare(&string, &strings[i]) != 0) || (string.m_Count != strings[i].m_Count))
+		{
+			ACR_DEBUG_PRINT(2, "FAIL get %d", i);
+			return ACR_FAILURE;
+		}
+
+		// a string with a byte after it is between this string
+		// and the next one, since no string has that byte
+		memcpy(missing, strings[i].m_Buffer.m_Pointer, (size_t)strings[i].m_Buffer.m_Length);
+		missing[strings[i].m_Buffer.m_Length] = '~';
+		string = ACR_StringFromMemory((ACR_Byte_t*)missing, strings[i].m_Buffer.m_Length + 1, ACR_MAX_COUNT);
+		if(ACR_StringDictionaryFind(dictionary, string, &id) != ACR_INFO_UNKNOWN)
+		{
+			ACR_DEBUG_PRINT(3, "FAIL find missing %d", i);
+			return ACR_FAILURE;
+		}
+
+		// the string without its last byte is only there if it
+		// is the string before it
+		if(strings[i].m_Buffer.m_Length > 0)
+		{
+			string = ACR_StringFromMemory((ACR_Byte_t*)missing, strings[i].m_Buffer.m_Length - 1, ACR_MAX_COUNT);
+			if((ACR_StringDictionaryFind(dictionary, string, &id) == ACR_INFO_OK) &&
+			   ((id >= (ACR_Count_t)i) || (TestStringCompare(&string, &strings[id]) != 0)))
+			{
+				ACR_DEBUG_PRINT(4, "FAIL find shorter %d", i);
+				return ACR_FAILURE;
+			}
+		}
+	}
+
+	string = ACR_StringFromMemory((ACR_Byte_t*)"\x7F", 1, ACR_MAX_COUNT);
+	if((ACR_StringDictionaryFind(dictionary, string, &id) != ACR_INFO_UNKNOWN) ||
+	   (ACR_StringDictionaryGet(dictionary, (ACR_Count_t)count, memory, sizeof(memory), &string) != ACR_INFO_UNKNOWN))
+	{
+		ACR_DEBUG_PRINT(5, "FAIL find or get after the last string");
+		return ACR_FAILURE;
+	}
+	return ACR_SUCCESS;
+}
+
+/**********************************************************/
+int StringDictionaryTest(void)
+{
+	ACR_StringDictionary_t dictionary;
+	ACR_StringDictionary_t copy;
+	ACR_String_t* strings;
+	ACR_String_t empty = ACR_StringFromMemory((ACR_Byte_t*)"", ACR_MAX_LENGTH, ACR_MAX_COUNT);
+	ACR_Count_t blockSizes[] = {1, 3, 0, 100};
+	ACR_Count_t id;
+	ACR_Byte_t* data;
+	ACR_Byte_t memory[256];
+	char* stringMemory;
+	int count = 1;
+	int first;
+	int i;
+	int j;
+
+	strings = (ACR_String_t*)malloc((TEST_STRING_COUNT + 1) * sizeof(ACR_String_t));
+	stringMemory = (char*)malloc(TEST_STRING_COUNT * 256);
+	if((strings == ACR_NULL) || (stringMemory == ACR_NULL))
+	{
+		free(strings);
+		free(stringMemory);
+		return ACR_SUCCESS;
+	}
+
+	// sorted strings without duplicates that start with the
+	// empty string
+	strings[0] = empty;
+	for(i = 0; i < TEST_STRING_COUNT; i++)
+	{
+		strings[i + 1] = TestString(stringMemory + (i * 256), i);
+	}
+	qsort(strings + 1, TEST_STRING_COUNT, sizeof(ACR_String_t), TestStringCompare);
+	for(i = 1; i <= TEST_STRING_COUNT; i++)
+	{
+		if(TestStringCompare(&strings[i], &strings[count - 1]) != 0)
+		{
+			strings[count] = strings[i];
+			count++;
+		}
+	}
+
+	for(j = 0; j < (int)(sizeof(blockSizes) / sizeof(blockSizes[0])); j++)
+	{
+		// only some of the dictionaries have the empty string
+		first = (int)(j % 2);
+
+		ACR_StringDictionaryInit(&dictionary, blockSizes[j]);
+		if((ACR_StringDictionaryFind(&dictionary, strings[1], &id) != ACR_INFO_UNKNOWN) ||
+		   (ACR_StringDictionaryGet(&dictionary, 0, memory, sizeof(memory), ACR_NULL) != ACR_INFO_UNKNOWN))
+		{
+			ACR_DEBUG_PRINT(6, "FAIL use before finish");
+			ACR_StringDictionaryDeInit(&dictionary);
+			free(strings);
+			free(stringMemory);
+			return ACR_FAILURE;
+		}
+		for(i = first; i < count; i++)
+		{
+			if(ACR_StringDictionaryAdd(&dictionary, strings[i]) != ACR_INFO_OK)
+			{
+				ACR_DEBUG_PRINT(7, "FAIL add %d", i);
+				ACR_StringDictionaryDeInit(&dictionary);
+				free(strings);
+				free(stringMemory);
+				return ACR_FAILURE;
+			}
+			if((i > first) &&
+			   ((ACR_StringDictionaryAdd(&dictionary, strings[i]) != ACR_INFO_ERROR) ||
+			    (ACR_StringDictionaryAdd(&dictionary, strings[i - 1]) != ACR_INFO_ERROR)))
+			{
+				ACR_DEBUG_PRINT(8, "FAIL add a string that is not after the last one %d", i);
+				ACR_StringDictionaryDeInit(&dictionary);
+				free(strings);
+				free(stringMemory);
+				return ACR_FAILURE;
+			}
+		}
+		if((ACR_StringDictionaryFinish(&dictionary) != ACR_INFO_OK) ||
+		   (ACR_StringDictionaryAdd(&dictionary, ACR_StringFromMemory((ACR_Byte_t*)"\x7F", 1, ACR_MAX_COUNT)) != ACR_INFO_ERROR) ||
+		   (TestCheckStrings(&dictionary, strings + first, count - first) != ACR_SUCCESS))
+		{
+			ACR_DEBUG_PRINT(9, "FAIL block size %lu", (unsigned long)blockSizes[j]);
+			ACR_StringDictionaryDeInit(&dictionary);
+			free(strings);
+			free(stringMemory);
+			return ACR_FAILURE;
+		}
+		if((first == 1) && (ACR_StringDictionaryFind(&dictionary, empty, &id) != ACR_INFO_UNKNOWN))
+		{
+			ACR_DEBUG_PRINT(10, "FAIL find the empty string that was not added");
+			ACR_StringDictionaryDeInit(&dictionary);
+			free(strings);
+			free(stringMemory);
+			return ACR_FAILURE;
+		}
+		if((dictionary.m_MaxLength > 0) &&
+		   (ACR_StringDictionaryGet(&dictionary, (ACR_Count_t)(count - first - 1), memory, 4, ACR_NULL) != ACR_INFO_ERROR))
+		{
+			ACR_DEBUG_PRINT(11, "FAIL get into memory that is too small");
+			ACR_StringDictionaryDeInit(&dictionary);
+			free(strings);
+			free(stringMemory);
+			return ACR_FAILURE;
+		}
+
+		// use a copy of the data in place at an address that
+		// is not aligned, as if it was mapped from a file
+		data = (ACR_Byte_t*)malloc((size_t)dictionary.m_Data.m_Buffer.m_Length + 1);
+		if(data != ACR_NULL)
+		{
+			memcpy(data + 1, dictionary.m_Data.m_Buffer.m_Pointer, (size_t)dictionary.m_Data.m_Buffer.m_Length);
+			ACR_StringDictionaryInit(&copy, 0);
+			if((ACR_StringDictionaryRef(&copy, data + 1, dictionary.m_Data.m_Buffer.m_Length) != ACR_INFO_OK) ||
+			   (copy.m_BlockSize != dictionary.m_BlockSize) || (copy.m_MaxLength != dictionary.m_MaxLength) ||
+			   (TestCheckStrings(&copy, strings + first, count - first) != ACR_SUCCESS))
+			{
+				ACR_DEBUG_PRINT(12, "FAIL use data in place with block size %lu", (unsigned long)blockSizes[j]);
+				ACR_StringDictionaryDeInit(&copy);
+				ACR_StringDictionaryDeInit(&dictionary);
+				free(data);
+				free(strings);
+				free(stringMemory);
+				return ACR_FAILURE;
+			}
+			ACR_StringDictionaryDeInit(&copy);
+			free(data);
+		}
+
+		ACR_DEBUG_PRINT(13, "%d strings in %lu bytes with block size %lu",
+			count - first, (unsigned long)dictionary.m_Data.m_Buffer.m_Length, (unsigned long)dictionary.m_BlockSize);
+		ACR_StringDictionaryDeInit(&dictionary);
+	}
+
+	// a dictionary without strings
+	ACR_StringDictionaryInit(&dictionary, 0);
+	if((ACR_StringDictionaryFinish(&dictionary) != ACR_INFO_OK) || (dictionary.m_Count != 0) ||
+	   (ACR_StringDictionaryFind(&dictionary, empty, &id) != ACR_INFO_UNKNOWN) ||
+	   (ACR_StringDictionaryGet(&dictionary, 0, memory, sizeof(memory), ACR_NULL) != ACR_INFO_UNKNOWN))
+	{
+		ACR_DEBUG_PRINT(14, "FAIL empty dictionary");
+		ACR_StringDictionaryDeInit(&dictionary);
+		free(strings);
+		free(stringMemory);
+		return ACR_FAILURE;
+	}
+	ACR_StringDictionaryDeInit(&dictionary);
+
+	free(strings);
+	free(stringMemory);
+	return ACR_SUCCESS;
+}
+
+/**********************************************************/
+int StringDictionaryRefTest(void)
+{
+	ACR_StringDictionary_t dictionary;
+	ACR_StringDictionary_t copy;
+	ACR_String_t string;
+	ACR_Byte_t* data;
+	ACR_Byte_t memory[64];
+	ACR_Length_t length;
+	ACR_Length_t pos;
+	ACR_Count_t id;
+	char text[32];
+	int result = ACR_SUCCESS;
+	int i;
+
+	ACR_StringDictionaryInit(&dictionary, 4);
+	for(i = 0; i < 10; i++)
+	{
+		sprintf(text, "item%d", i);
+		ACR_StringDictionaryAdd(&dictionary, ACR_StringFromMemory((ACR_Byte_t*)text, ACR_MAX_LENGTH, ACR_MAX_COUNT));
+	}
+	if((ACR_StringDictionaryFinish(&dictionary) != ACR_INFO_OK) || (dictionary.m_Count != 10))
+	{
+		ACR_StringDictionaryDeInit(&dictionary);
+		return ACR_FAILURE;
+	}
+	length = dictionary.m_Data.m_Buffer.m_Length;
+	data = (ACR_Byte_t*)malloc((size_t)length);
+	if(data == ACR_NULL)
+	{
+		ACR_StringDictionaryDeInit(&dictionary);
+		return ACR_SUCCESS;
+	}
+	ACR_StringDictionaryInit(&copy, 0);
+
+	// a header that is not valid is found without reading the
+	// strings
+	memcpy(data, dictionary.m_Data.m_Buffer.m_Pointer, (size_t)length);
+	data[0] = 'X';
+	if(ACR_StringDictionaryRef(&copy, data, length) != ACR_INFO_ERROR)
+	{
+		ACR_DEBUG_PRINT(15, "FAIL use data with a bad magic value");
+		result = ACR_FAILURE;
+	}
+	data[0] = dictionary.m_Data.m_Buffer.m_Pointer == ACR_NULL ? 0 : ((ACR_Byte_t*)dictionary.m_Data.m_Buffer.m_Pointer)[0];
+	if((ACR_StringDictionaryRef(&copy, data, length - 1) != ACR_INFO_ERROR) ||
+	   (ACR_StringDictionaryRef(&copy, data, 8) != ACR_INFO_ERROR))
+	{
+		ACR_DEBUG_PRINT(16, "FAIL use data that is too short");
+		result = ACR_FAILURE;
+	}
+	data[12]++;
+	if(ACR_StringDictionaryRef(&copy, data, length) != ACR_INFO_ERROR)
+	{
+		ACR_DEBUG_PRINT(17, "FAIL use data with the wrong block count");
+		result = ACR_FAILURE;
+	}
+	data[12]--;
+
+	// strings that are not valid are found when they are read
+	for(pos = 24; pos < length; pos++)
+	{
+		data[pos] ^= 0xFF;
+		if(ACR_StringDictionaryRef(&copy, data, length) != ACR_INFO_OK)
+		{
+			ACR_DEBUG_PRINT(18, "FAIL use data with a valid header");
+			result = ACR_FAILURE;
+		}
+		for(i = 0; i < 11; i++)
+		{
+			ACR_StringDictionaryGet(&copy, (ACR_Count_t)i, memory, sizeof(memory), &string);
+			sprintf(text, "item%d", i);
+			ACR_StringDictionaryFind(&copy, ACR_StringFromMemory((ACR_Byte_t*)text, ACR_MAX_LENGTH, ACR_MAX_COUNT), &id);
+		}
+		data[pos] ^= 0xFF;
+	}
+
+	ACR_StringDictionaryDeInit(&copy);
+	ACR_StringDictionaryDeInit(&dictionary);
+	free(data);
+	return result;
+}
+
+/** write the string for a number into memory. the strings
+    are in order and share long prefixes like paths or URLs
+*/
+static ACR_String_t TestBenchmarkString(
+	char* memory,
+	ACR_Length_t i)
+{
+	const char* types[] = {"documents", "images", "music", "videos"};
+	sprintf(memory, "https://example.com/users/%06lu/%s/file%02lu.dat",
+		(unsigned long)(i / 64), types[(i / 16) % 4], (unsigned long)(i % 16));
+	return ACR_StringFromMemory((ACR_Byte_t*)memory, ACR_MAX_LENGTH, ACR_MAX_COUNT);
+}
+
+/**********************************************************/
+int StringDictionaryBenchmark(void)
+{
+	ACR_StringDictionary_t dictionary;
+	ACR_String_t* strings;
+	ACR_String_t string;
+	ACR_Byte_t memory[64];
+	ACR_Length_t arrayLength;
+	ACR_Length_t dictionarySum;
+	ACR_Length_t arraySum;
+	ACR_Length_t count;
+	ACR_Length_t low;
+	ACR_Length_t high;
+	ACR_Length_t middle;
+	ACR_Length_t i;
+	ACR_Count_t id;
+	char* stringMemory;
+	double start;
+	double dictionaryFind;
+	double dictionaryGet;
+	double arrayFind;
+	int compare;
+
+	strings = (ACR_String_t*)malloc(TEST_STRINGDICTIONARY_MAX_COUNT * sizeof(ACR_String_t));
+	stringMemory = (char*)malloc(TEST_STRINGDICTIONARY_MAX_COUNT * 64);
+	if((strings == ACR_NULL) || (stringMemory == ACR_NULL))
+	{
+		free(strings);
+		free(stringMemory);
+		return ACR_SUCCESS;
+	}
+	for(i = 0; i < TEST_STRINGDICTIONARY_MAX_COUNT; i++)
+	{
+		strings[i] = TestBenchmarkString(stringMemory + (i * 64), i);
+	}
+
+	for(count = 1000; count <= TEST_STRINGDICTIONARY_MAX_COUNT; count *= 10)
+	{
+		ACR_StringDictionaryInit(&dictionary, 0);
+		for(i = 0; i < count; i++)
+		{
+			if(ACR_StringDictionaryAdd(&dictionary, strings[i]) != ACR_INFO_OK)
+			{
+				break;
+			}
+		}
+		if(ACR_StringDictionaryFinish(&dictionary) != ACR_INFO_OK)
+		{
+			ACR_StringDictionaryDeInit(&dictionary);
+			break;
+		}
+
+		// each string as its own allocation is the ACR_String_t,
+		// the bytes, and about 16 bytes of allocator overhead
+		// rounded up to 16 bytes
+		arrayLength = 0;
+		for(i = 0; i < count; i++)
+		{
+			arrayLength += sizeof(ACR_String_t) + ((strings[i].m_Buffer.m_Length + 8 + 15) & ~((ACR_Length_t)15));
+		}
+
+		dictionarySum = 0;
+		start = ACR_TimerSeconds();
+		for(i = 0; i < count; i++)
+		{
+			if(ACR_StringDictionaryFind(&dictionary, strings[(i * 7919) % count], &id) == ACR_INFO_OK)
+			{
+				dictionarySum += id;
+			}
+		}
+		dictionaryFind = ACR_TimerSeconds() - start;
+
+		start = ACR_TimerSeconds();
+		for(i = 0; i < count; i++)
+		{
+			if(ACR_StringDictionaryGet(&dictionary, (ACR_Count_t)((i * 7919) % count), memory, sizeof(memory), &string) == ACR_INFO_OK)
+			{
+				dictionarySum += string.m_Buffer.m_Length;
+			}
+		}
+		dictionaryGet = ACR_TimerSeconds() - start;
+
+		arraySum = 0;
+		start = ACR_TimerSeconds();
+		for(i = 0; i < count; i++)
+		{
+			string = strings[(i * 7919) % count];
+			low = 0;
+			high = count;
+			while(low < high)
+			{
+				middle = low + ((high - low) / 2);
+				compare = TestStringCompare(&strings[middle], &string);
+				if(compare == 0)
+				{
+					arraySum += middle;
+					break;
+				}
+				if(compare < 0)
+				{
+					low = middle + 1;
+				}
+				else
+				{
+					high = middle;
+				}
+			}
+		}
+		arrayFind = ACR_TimerSeconds() - start;
+		for(i = 0; i < count; i++)
+		{
+			arraySum += strings[i].m_Buffer.m_Length;
+		}
+
+		if((dictionaryFind > 0) && (dictionaryGet > 0) && (arrayFind > 0))
+		{
+			ACR_DEBUG_PRINT(19, "BENCHMARK %lu strings bytes per string, M/s find, get ACR_StringDictionary_t %.1f %.1f %.1f ACR_String_t array %.1f %.1f",
+				(unsigned long)count,
+				(double)dictionary.m_Data.m_Buffer.m_Length / (double)count, (double)count / (dictionaryFind * 1000000.0), (double)count / (dictionaryGet * 1000000.0),
+				(double)arrayLength / (double)count, (double)count / (arrayFind * 1000000.0));
+		}
+
+		ACR_StringDictionaryDeInit(&dictionary);
+
+		if(dictionarySum != arraySum)
+		{
+			ACR_DEBUG_PRINT(20, "FAIL benchmark found different ids with %lu strings", (unsigned long)count);
+			free(strings);
+			free(stringMemory);
+			return ACR_FAILURE;
+		}
+	}
+
+	free(strings);
+	free(stringMemory);
+	return ACR_SUCCESS;
+}
@@ -0,0 +1,488 @@
+/*
+
+    ********** DO NOT REMOVE THIS INFORMATION ************
+
+    ACR - A set of C functions in a git Repository
+    Copyright (C) 2018 - 2020 Adam C. Rosenberg
+
+    Please read LICENSE before using this code
+
+    Please read README.md for instructions on including
+    this code in your project and where to find examples
+
+    If you contribute to this code, Please add your name
+    and email address to the AUTHORS list below so that
+    we know who to thank!
+
+    AUTHORS
+
+    Adam Rosenberg <adam@sirspot.com>
+
+    LICENSE
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+    ******************************************************
+
+*/
+/** \file test_stringintern.c
+
+    application to test the global string intern tables
+
+*/
+#include "ACR/stringintern.h"
+
+#include <stdio.h>
+// included for strlen()
+#include <string.h>
+
+// the threaded test starts threads with the native thread
+// functions when they are available
+#ifndef ACR_NO_THREADS
+#if defined(_WIN32)
+// included for CreateThread()
+#include <windows.h>
+#define TEST_HAS_THREADS ACR_BOOL_TRUE
+#define TEST_THREAD_FUNC DWORD WINAPI
+#define TEST_THREAD_RETURN 0
+typedef HANDLE TestThread_t;
+#elif defined(ACR_COMPILER_GCC) || defined(ACR_COMPILER_CLANG) || defined(ACR_COMPILER_MINGW)
+// included for pthread_create()
+#include <pthread.h>
+#define TEST_HAS_THREADS ACR_BOOL_TRUE
+#define TEST_THREAD_FUNC void*
+#define TEST_THREAD_RETURN ACR_NULL
+typedef pthread_t TestThread_t;
+#endif
+#endif // #ifndef ACR_NO_THREADS
+
+#ifndef TEST_HAS_THREADS
+#define TEST_HAS_THREADS ACR_BOOL_FALSE
+#endif
+
+// the number of different identifiers used by the tests
+#define TEST_IDENTIFIER_COUNT 4000
+
+// the number of threads in the threaded test
+#define TEST_THREAD_COUNT 4
+
+//
+// PROTOTYPES
+//
+
+/** check that equal strings get the same memory and that
+    different strings do not
+*/
+int InternTest(void);
+
+/** check that strings that are only different by case get
+    the same memory from the case-insensitive table
+*/
+int InternIgnoreCaseTest(void);
+
+/** check that threads adding the same strings at the same
+    time all get the same memory
+*/
+int InternThreadTest(void);
+
+/** compare the speed of comparing identifiers with
+    ACR_StringCompareToMemory() and ACR_STRING_INTERN_EQUAL()
+*/
+int InternBenchmark(void);
+
+//
+// MAIN
+//
+
+int main(int argc, char** argv)
+{
+	int result = ACR_SUCCESS;
+
+	ACR_UNUSED(argc);
+	ACR_UNUSED(argv);
+
+	#if ACR_HAS_MALLOC == ACR_BOOL_TRUE
+	result |= InternTest();
+	result |= InternIgnoreCaseTest();
+	result |= InternThreadTest();
+
+	result |= InternBenchmark();
+	ACR_StringInternFree();
+	#endif
+
+	return result;
+}
+
+//
+// IMPLEMENTATION
+//
+
+/** the text of the identifiers used by the tests
+*/
+static char g_TestIdentifiers[TEST_IDENTIFIER_COUNT][24];
+
+/** fill in the identifiers that look like names from a
+    program
+*/
+static void TestIdentifiersFill(void)
+{
+	const char* prefixes[] = {"m_", "g_", "ACR_", "Test", "caf\xC3\xA9_", ""};
+	int i;
+	for(i = 0; i < TEST_IDENTIFIER_COUNT; i++)
+	{
+		sprintf(g_TestIdentifiers[i], "%sName%d", prefixes[i % 6], i);
+	}
+}
+
+/** get an identifier as a string in memory of its own so
+    that its pointer is different every time
+*/
+static ACR_String_t TestIdentifierCopy(
+	char* memory,
+	int i)
+{
+	strcpy(memory, g_TestIdentifiers[i]);
+	return ACR_StringFromMemory((ACR_Byte_t*)memory, ACR_MAX_LENGTH, ACR_MAX_COUNT);
+}
+
+/**********************************************************/
+int InternTest(void)
+{
+	ACR_String_t* interned;
+	ACR_String_t again;
+	ACR_String_t empty;
+	ACR_StringInternStats_t before;
+	ACR_StringInternStats_t after;
+	char memory[24];
+	int i;
+
+	interned = (ACR_String_t*)malloc(TEST_IDENTIFIER_COUNT * sizeof(ACR_String_t));
+	if(interned == ACR_NULL)
+	{
+		return ACR_SUCCESS;
+	}
+
+	TestIdentifiersFill();
+	ACR_StringInternGetStats(ACR_INFO_YES, &before);
+	for(i = 0; i < TEST_IDENTIFIER_COUNT; i++)
+	{
+		interned[i] = ACR_StringIntern(TestIdentifierCopy(memory, i), ACR_INFO_YES);
+		if((interned[i].m_Buffer.m_Pointer == ACR_NULL) || (interned[i].m_Buffer.m_Pointer == (void*)memory) ||
+		   (strcmp((const char*)interned[i].m_Buffer.m_Pointer, g_TestIdentifiers[i]) != 0) ||
+		   (interned[i].m_Count != ACR_StringFromMemory((ACR_Byte_t*)g_TestIdentifiers[i], ACR_MAX_LENGTH, ACR_MAX_COUNT).m_Count))
+		{
+			ACR_DEBUG_PRINT(1, "FAIL identifier %d was not interned", i);
+			free(interned);
+			return ACR_FAILURE;
+		}
+	}
+
+	// interning again finds the same memory
+	for(i = 0; i < TEST_IDENTIFIER_COUNT; i++)
+	{
+		again = ACR_StringIntern(TestIdentifierCopy(memory, i), ACR_INFO_YES);
+		if((ACR_STRING_INTERN_EQUAL(again, interned[i]) == 0) ||
+		   ((i > 0) && (ACR_STRING_INTERN_EQUAL(interned[i], interned[i - 1]) != 0)))
+		{
+			ACR_DEBUG_PRINT(2, "FAIL identifier %d is not the same when interned again", i);
+			free(interned);
+			return ACR_FAILURE;
+		}
+	}
+
+	// the case-sensitive table keeps different cases apart
+	again = ACR_StringIntern(ACR_StringFromMemory((ACR_Byte_t*)"m_name0", ACR_MAX_LENGTH, ACR_MAX_COUNT), ACR_INFO_YES);
+	if(ACR_STRING_INTERN_EQUAL(again, interned[0]) != 0)
+	{
+		ACR_DEBUG_PRINT(3, "FAIL m_name0 is the same as m_Name0");
+		free(interned);
+		return ACR_FAILURE;
+	}
+
+	empty = ACR_StringIntern(ACR_StringFromMemory((ACR_Byte_t*)"", ACR_MAX_LENGTH, ACR_MAX_COUNT), ACR_INFO_YES);
+	again = ACR_StringIntern(ACR_StringFromMemory((ACR_Byte_t*)"", ACR_MAX_LENGTH, ACR_MAX_COUNT), ACR_INFO_YES);
+	if((empty.m_Buffer.m_Pointer == ACR_NULL) || (empty.m_Buffer.m_Length != 0) || (ACR_STRING_INTERN_EQUAL(empty, again) == 0))
+	{
+		ACR_DEBUG_PRINT(4, "FAIL the empty string was not interned");
+		free(interned);
+		return ACR_FAILURE;
+	}
+
+	ACR_StringInternGetStats(ACR_INFO_YES, &after);
+	if(((after.m_Count - before.m_Count) != (TEST_IDENTIFIER_COUNT + 2)) || (after.m_Capacity < (2 * after.m_Count)) ||
+	   (after.m_ArenaBytes < after.m_StringBytes) || (after.m_TableBytes < (after.m_Capacity * sizeof(void*))))
+	{
+		ACR_DEBUG_PRINT(5, "FAIL stats have %d strings in %d slots", (int)after.m_Count, (int)after.m_Capacity);
+		free(interned);
+		return ACR_FAILURE;
+	}
+	#if ACR_STRING_INTERN_LOOKUP_STATS == ACR_BOOL_TRUE
+	if(((after.m_Lookups - before.m_Lookups) != ((2 * TEST_IDENTIFIER_COUNT) + 3)) || (after.m_Probes < after.m_Lookups))
+	{
+		ACR_DEBUG_PRINT(6, "FAIL stats have %d lookups", (int)(after.m_Lookups - before.m_Lookups));
+		free(interned);
+		return ACR_FAILURE;
+	}
+	#else
+	if((after.m_Lookups != 0) || (after.m_Probes != 0))
+	{
+		ACR_DEBUG_PRINT(6, "FAIL stats have %d lookups when they are not counted", (int)after.m_Lookups);
+		free(interned);
+		return ACR_FAILURE;
+	}
+	#endif
+
+	free(interned);
+	return ACR_SUCCESS;
+}
+
+/**********************************************************/
+int InternIgnoreCaseTest(void)
+{
+	const char* same[][3] =
+	{
+		{"Name", "NAME", "name"},
+		{"caf\xC3\xA9", "CAF\xC3\x89", "Caf\xC3\xA9"},
+		// final sigma and sigma are the same when case is ignored
+		{"\xCE\xA3\xCE\xA3", "\xCF\x83\xCF\x82", "\xCF\x83\xCF\x83"},
+		// kelvin sign is three bytes and k is one
+		{"\xE2\x84\xAA" "elvin", "Kelvin", "kELVIN"}
+	};
+	ACR_String_t first;
+	ACR_String_t other;
+	ACR_String_t exact;
+	int i;
+	int j;
+
+	for(i = 0; i < 4; i++)
+	{
+		first = ACR_StringIntern(ACR_StringFromMemory((ACR_Byte_t*)same[i][0], ACR_MAX_LENGTH, ACR_MAX_COUNT), ACR_INFO_NO);
+		if((first.m_Buffer.m_Pointer == ACR_NULL) || (strcmp((const char*)first.m_Buffer.m_Pointer, same[i][0]) != 0))
+		{
+			ACR_DEBUG_PRINT(7, "FAIL %s was not interned", same[i][0]);
+			return ACR_FAILURE;
+		}
+		for(j = 1; j < 3; j++)
+		{
+			other = ACR_StringIntern(ACR_StringFromMemory((ACR_Byte_t*)same[i][j], ACR_MAX_LENGTH, ACR_MAX_COUNT), ACR_INFO_NO);
+			exact = ACR_StringIntern(ACR_StringFromMemory((ACR_Byte_t*)same[i][j], ACR_MAX_LENGTH, ACR_MAX_COUNT), ACR_INFO_YES);
+			if((ACR_STRING_INTERN_EQUAL(first, other) == 0) || (ACR_STRING_INTERN_EQUAL(first, exact) != 0))
+			{
+				ACR_DEBUG_PRINT(8, "FAIL %s is not the same as %s when case is ignored", same[i][j], same[i][0]);
+				return ACR_FAILURE;
+			}
+		}
+	}
+
+	other = ACR_StringIntern(ACR_StringFromMemory((ACR_Byte_t*)"Names", ACR_MAX_LENGTH, ACR_MAX_COUNT), ACR_INFO_NO);
+	first = ACR_StringIntern(ACR_StringFromMemory((ACR_Byte_t*)"name", ACR_MAX_LENGTH, ACR_MAX_COUNT), ACR_INFO_NO);
+	if(ACR_STRING_INTERN_EQUAL(first, other) != 0)
+	{
+		ACR_DEBUG_PRINT(9, "FAIL Names is the same as name");
+		return ACR_FAILURE;
+	}
+
+	return ACR_SUCCESS;
+}
+
+#if TEST_HAS_THREADS == ACR_BOOL_TRUE
+/** the identifiers interned by one thread of the threaded
+    test
+*/
+typedef struct TestThreadResult_s
+{
+	ACR_String_t m_Interned[TEST_IDENTIFIER_COUNT];
+	int m_Offset;
+} TestThreadResult_t;
+
+/** intern every identifier starting at a different one for
+    each thread, after the table is cleared
+*/
+static TEST_THREAD_FUNC InternTestThread(
+	void* param)
+{
+	TestThreadResult_t* result = (TestThreadResult_t*)param;
+	char memory[24];
+	int i;
+	int n;
+	for(n = 0; n < TEST_IDENTIFIER_COUNT; n++)
+	{
+		i = (n + result->m_Offset) % TEST_IDENTIFIER_COUNT;
+		result->m_Interned[i] = ACR_StringIntern(TestIdentifierCopy(memory, i), (i % 2) ? ACR_INFO_YES : ACR_INFO_NO);
+	}
+	return TEST_THREAD_RETURN;
+}
+#endif
+
+/**********************************************************/
+int InternThreadTest(void)
+{
+	#if TEST_HAS_THREADS == ACR_BOOL_TRUE
+	TestThread_t threads[TEST_THREAD_COUNT];
+	TestThreadResult_t* results;
+	int round;
+	int t;
+	int i;
+
+	results = (TestThreadResult_t*)malloc(TEST_THREAD_COUNT * sizeof(TestThreadResult_t));
+	if(results == ACR_NULL)
+	{
+		return ACR_SUCCESS;
+	}
+
+	TestIdentifiersFill();
+	for(round = 0; round < 10; round++)
+	{
+		// start with empty tables so that the threads add
+		// strings and grow the table at the same time
+		ACR_StringInternFree();
+		for(t = 0; t < TEST_THREAD_COUNT; t++)
+		{
+			results[t].m_Offset = (t * TEST_IDENTIFIER_COUNT) / TEST_THREAD_COUNT;
+			#if defined(_WIN32)
+			threads[t] = CreateThread(ACR_NULL, 0, InternTestThread, &results[t], 0, ACR_NULL);
+			#else
+			pthread_create(&threads[t], ACR_NULL, InternTestThread, &results[t]);
+			#endif
+		}
+		for(t = 0; t < TEST_THREAD_COUNT; t++)
+		{
+			#if defined(_WIN32)
+			WaitForSingleObject(threads[t], INFINITE);
+			CloseHandle(threads[t]);
+			#else
+			pthread_join(threads[t], ACR_NULL);
+			#endif
+		}
+
+		for(i = 0; i < TEST_IDENTIFIER_COUNT; i++)
+		{
+			for(t = 1; t < TEST_THREAD_COUNT; t++)
+			{
+				if((results[t].m_Interned[i].m_Buffer.m_Pointer == ACR_NULL) ||
+				   (ACR_STRING_INTERN_EQUAL(results[t].m_Interned[i], results[0].m_Interned[i]) == 0))
+				{
+					ACR_DEBUG_PRINT(10, "FAIL threads got different memory for identifier %d", i);
+					free(results);
+					return ACR_FAILURE;
+				}
+			}
+		}
+	}
+
+	free(results);
+	#endif
+	return ACR_SUCCESS;
+}
+
+/**********************************************************/
+int InternBenchmark(void)
+{
+	ACR_String_t* strings;
+	ACR_String_t* interned;
+	ACR_StringInternStats_t stats;
+	int compareCount = 0;
+	int internCount = 0;
+	int lookups = 0;
+	int repeat;
+	int i;
+	int j;
+	double start;
+	double compareTime;
+	double internTime;
+	double lookupTime;
+	double comparisons = 200.0 * TEST_IDENTIFIER_COUNT;
+
+	strings = (ACR_String_t*)malloc(TEST_IDENTIFIER_COUNT * sizeof(ACR_String_t));
+	interned = (ACR_String_t*)malloc(TEST_IDENTIFIER_COUNT * sizeof(ACR_String_t));
+	if((strings == ACR_NULL) || (interned == ACR_NULL))
+	{
+		free(strings);
+		free(interned);
+		return ACR_SUCCESS;
+	}
+
+	ACR_UNUSED(comparisons);
+	TestIdentifiersFill();
+	ACR_StringInternFree();
+	for(i = 0; i < TEST_IDENTIFIER_COUNT; i++)
+	{
+		strings[i] = ACR_StringFromMemory((ACR_Byte_t*)g_TestIdentifiers[i], ACR_MAX_LENGTH, ACR_MAX_COUNT);
+		interned[i] = ACR_StringIntern(strings[i], ACR_INFO_YES);
+	}
+
+	// look for each identifier in a list of nearby ones like
+	// checking a name against a few candidates
+	start = ACR_TimerSeconds();
+	for(repeat = 0; repeat < 200; repeat++)
+	{
+		for(i = 0; i < TEST_IDENTIFIER_COUNT; i++)
+		{
+			j = (i + repeat) % TEST_IDENTIFIER_COUNT;
+			if(ACR_StringCompareToMemory(strings[i], (const ACR_Byte_t*)strings[j].m_Buffer.m_Pointer, strings[j].m_Buffer.m_Length, ACR_MAX_COUNT, ACR_INFO_YES) == ACR_INFO_EQUAL)
+			{
+				compareCount++;
+			}
+		}
+	}
+	compareTime = ACR_TimerSeconds() - start;
+
+	start = ACR_TimerSeconds();
+	for(repeat = 0; repeat < 200; repeat++)
+	{
+		for(i = 0; i < TEST_IDENTIFIER_COUNT; i++)
+		{
+			j = (i + repeat) % TEST_IDENTIFIER_COUNT;
+			if(ACR_STRING_INTERN_EQUAL(interned[i], interned[j]))
+			{
+				internCount++;
+			}
+		}
+	}
+	internTime = ACR_TimerSeconds() - start;
+
+	start = ACR_TimerSeconds();
+	for(repeat = 0; repeat < 50; repeat++)
+	{
+		for(i = 0; i < TEST_IDENTIFIER_COUNT; i++)
+		{
+			if(ACR_STRING_INTERN_EQUAL(ACR_StringIntern(strings[i], ACR_INFO_YES), interned[i]))
+			{
+				lookups++;
+			}
+		}
+	}
+	lookupTime = ACR_TimerSeconds() - start;
+
+	ACR_StringInternGetStats(ACR_INFO_YES, &stats);
+	if((compareTime > 0) && (internTime > 0) && (lookupTime > 0))
+	{
+		ACR_DEBUG_PRINT(11, "BENCHMARK identifier compares M/s ACR_StringCompareToMemory %.0f ACR_STRING_INTERN_EQUAL %.0f",
+			comparisons / (compareTime * 1000000.0), comparisons / (internTime * 1000000.0));
+		ACR_DEBUG_PRINT(12, "BENCHMARK ACR_StringIntern M/s %.1f with %d strings, %d slots, %d arena bytes, %.2f probes per lookup",
+			(50.0 * TEST_IDENTIFIER_COUNT) / (lookupTime * 1000000.0), (int)stats.m_Count, (int)stats.m_Capacity, (int)stats.m_ArenaBytes,
+			(stats.m_Lookups > 0) ? ((double)stats.m_Probes / (double)stats.m_Lookups) : 0.0);
+	}
+
+	free(strings);
+	free(interned);
+
+	if((compareCount != internCount) || (lookups != (50 * TEST_IDENTIFIER_COUNT)))
+	{
+		ACR_DEBUG_PRINT(13, "FAIL benchmark found %d equal identifiers instead of %d", internCount, compareCount);
+		return ACR_FAILURE;
+	}
+	return ACR_SUCCESS;
+}
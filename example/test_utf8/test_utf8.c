@@ -0,0 +1,902 @@
+/*
+
+    ********** DO NOT REMOVE THIS INFORMATION ************
+
+    ACR - A set of C functions in a git Repository
+    Copyright (C) 2018 - 2020 Adam C. Rosenberg
+
+    Please read LICENSE before using this code
+
+    Please read README.md for instructions on including
+    this code in your project and where to find examples
+
+    If you contribute to this code, Please add your name
+    and email address to the AUTHORS list below so that
+    we know who to thank!
+
+    AUTHORS
+
+    Adam Rosenberg <adam@sirspot.com>
+
+    LICENSE
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+    ******************************************************
+
+*/
+/** \file test_utf8.c
+
+    application to test UTF8 functions
+
+*/
+#include "ACR/utf8.h"
+#include "ACR/buffer.h"
+
+//
+// PROTOTYPES
+//
+
+/** example to check UTF8 data
+*/
+int ValidateTest(void);
+
+/** check random data against a simple decoder to make sure
+    every position in each 64 byte block is checked correctly
+*/
+int RandomValidateTest(void);
+
+/** example to replace invalid UTF8 data
+*/
+int SanitizeTest(void);
+
+/** measure the speed of ACR_Utf8Validate()
+*/
+int ValidateBenchmark(void);
+
+/** example to change the case of unicode characters
+*/
+int CaseTest(void);
+
+/** compare the speed of ACR_UnicodeToLower() with a binary
+    search of the characters that have a lower-case mapping
+*/
+int CaseBenchmark(void);
+
+/** example to convert between UTF8, UTF16LE, and UTF32LE
+*/
+int TranscodeTest(void);
+
+/** convert random characters from UTF32LE to UTF8 to
+    UTF16LE and back again
+*/
+int RandomTranscodeTest(void);
+
+/** measure the speed of converting UTF8 to UTF16LE and back
+*/
+int TranscodeBenchmark(void);
+
+/** decode random data in random sized chunks and compare
+    with decoding all of the data at once
+*/
+int DecoderTest(void);
+
+//
+// MAIN
+//
+
+int main(int argc, char** argv)
+{
+	int result = ACR_SUCCESS;
+
+	ACR_UNUSED(argc);
+	ACR_UNUSED(argv);
+
+	result |= ValidateTest();
+	result |= RandomValidateTest();
+	result |= SanitizeTest();
+	result |= CaseTest();
+	result |= TranscodeTest();
+	result |= RandomTranscodeTest();
+	result |= DecoderTest();
+
+	result |= ValidateBenchmark();
+	result |= CaseBenchmark();
+	result |= TranscodeBenchmark();
+
+	return result;
+}
+
+//
+// IMPLEMENTATION
+//
+
+/**********************************************************/
+int ValidateTest(void)
+{
+	int result = ACR_SUCCESS;
+	ACR_Length_t errorOffset;
+	int i;
+
+	// valid
+	const char* valid[] = {
+		"",
+		"hello",
+		"caf\xC3\xA9",                 // U+00E9
+		"\xE2\x82\xAC 100",            // U+20AC
+		"\xED\x9F\xBF",                // U+D7FF before the surrogates
+		"\xEE\x80\x80",                // U+E000 after the surrogates
+		"\xF0\x9F\x98\x80",            // U+1F600
+		"\xF4\x8F\xBF\xBF"             // U+10FFFF
+	};
+
+	// invalid with the offset of the error
+	const char* invalid[] = {
+		"\x80",                        // continuation without a lead
+		"ab\xC0\x80",                  // overlong U+0000
+		"\xC3",                        // missing continuation
+		"\xE0\x80\x80",                // overlong
+		"abc\xED\xA0\x80",             // surrogate U+D800
+		"\xF4\x90\x80\x80",            // U+110000
+		"a\xF5\x80\x80\x80",           // invalid lead
+		"\xE2\x82 ",                   // missing continuation
+		"\xC3\xA9\xFF"                 // invalid byte
+	};
+	ACR_Length_t invalidOffset[] = {0, 2, 0, 0, 3, 0, 1, 0, 2};
+
+	for(i = 0; i < (int)(sizeof(valid) / sizeof(valid[0])); i++)
+	{
+		if(ACR_Utf8Validate((const ACR_Byte_t*)valid[i], (ACR_Length_t)strlen(valid[i]), &errorOffset) != ACR_INFO_VALID)
+		{
+			ACR_DEBUG_PRINT(1, "FAIL valid string %d is invalid at %d", i, (int)errorOffset);
+			result = ACR_FAILURE;
+		}
+	}
+
+	for(i = 0; i < (int)(sizeof(invalid) / sizeof(invalid[0])); i++)
+	{
+		errorOffset = 99;
+		if((ACR_Utf8Validate((const ACR_Byte_t*)invalid[i], (ACR_Length_t)strlen(invalid[i]), &errorOffset) != ACR_INFO_INVALID) ||
+		   (errorOffset != invalidOffset[i]))
+		{
+			ACR_DEBUG_PRINT(2, "FAIL invalid string %d error offset %d", i, (int)errorOffset);
+			result = ACR_FAILURE;
+		}
+	}
+
+	return result;
+}
+
+/** find the first error one character at a time the simple way
+    by decoding each character and checking its value
+*/
+static ACR_Length_t RandomValidateTestFirstError(
+	const ACR_Byte_t* src,
+	ACR_Length_t length)
+{
+	ACR_Length_t pos = 0;
+	while(pos < length)
+	{
+		ACR_Length_t bytes = 1;
+		ACR_Unicode_t value;
+		ACR_Length_t i;
+		if(src[pos] >= 0xF0) bytes = 4;
+		else if(src[pos] >= 0xE0) bytes = 3;
+		else if(src[pos] >= 0xC0) bytes = 2;
+		else if(src[pos] >= 0x80) return pos;
+		if((src[pos] >= 0xF8) || ((pos + bytes) > length))
+		{
+			return pos;
+		}
+		for(i = 1; i < bytes; i++)
+		{
+			if((src[pos + i] & 0xC0) != 0x80)
+			{
+				return pos;
+			}
+		}
+		value = ACR_Utf8ToUnicode(src + pos, (int)bytes);
+		if(((bytes == 2) && (value < 0x80)) || ((bytes == 3) && (value < 0x800)) || ((bytes == 4) && (value < 0x10000)) ||
+		   ((value >= 0xD800) && (value <= 0xDFFF)) || (value > 0x10FFFF))
+		{
+			return pos;
+		}
+		pos += bytes;
+	}
+	return length;
+}
+
+/**********************************************************/
+int RandomValidateTest(void)
+{
+	int result = ACR_SUCCESS;
+	ACR_Byte_t data[300];
+	unsigned long random = 12345;
+	ACR_Length_t length;
+	ACR_Length_t expected;
+	ACR_Length_t errorOffset;
+	ACR_Info_t info;
+	int test;
+	const char* pieces[] = {"a", "\xC3\xA9", "\xE2\x82\xAC", "\xF0\x9F\x98\x80", "\xED\x9F\xBF", "\x80", "\xC0", "\xED\xA0", "\xF4\x90", "\xE0\xA0"};
+
+	for(test = 0; test < 20000; test++)
+	{
+		// mostly valid characters with an occasional invalid piece
+		length = 0;
+		while(length < (sizeof(data) - 4))
+		{
+			const char* piece;
+			random = (random * 1103515245UL + 12345UL) & 0x7FFFFFFFUL;
+			if((random % 512) < 3)
+			{
+				piece = pieces[5 + ((random >> 9) % 5)];
+			}
+			else if(((random >> 9) % 4) == 0)
+			{
+				piece = pieces[(random >> 11) % 5];
+			}
+			else
+			{
+				piece = pieces[0];
+			}
+			memcpy(data + length, piece, strlen(piece));
+			length += (ACR_Length_t)strlen(piece);
+		}
+		length -= (ACR_Length_t)(random % 4);
+
+		expected = RandomValidateTestFirstError(data, length);
+		errorOffset = length;
+		info = ACR_Utf8Validate(data, length, &errorOffset);
+		if(((expected == length) && (info != ACR_INFO_VALID)) ||
+		   ((expected < length) && ((info != ACR_INFO_INVALID) || (errorOffset != expected))))
+		{
+			ACR_DEBUG_PRINT(1, "FAIL random test %d error at %d instead of %d", test, (int)errorOffset, (int)expected);
+			result = ACR_FAILURE;
+			break;
+		}
+	}
+
+	return result;
+}
+
+/**********************************************************/
+int SanitizeTest(void)
+{
+	int result = ACR_SUCCESS;
+	ACR_VarBuffer_t dst;
+	ACR_Count_t replaced;
+	const char* src = "a\xE1\x80" "b\xF0\x9F\x98\x80\xF0\x9F\x98" "c\xFF\xFE";
+	const char* expected = "a\xEF\xBF\xBD" "b\xF0\x9F\x98\x80\xEF\xBF\xBD" "c\xEF\xBF\xBD\xEF\xBF\xBD";
+
+	ACR_VarBufferInit(&dst);
+	if((ACR_Utf8Sanitize(&dst, (const ACR_Byte_t*)src, (ACR_Length_t)strlen(src), &replaced) != ACR_INFO_OK) ||
+	   (replaced != 4) ||
+	   (dst.m_Buffer.m_Length != (ACR_Length_t)strlen(expected)) ||
+	   (memcmp(dst.m_Buffer.m_Pointer, expected, strlen(expected)) != 0))
+	{
+		ACR_DEBUG_PRINT(1, "FAIL sanitize replaced %d", (int)replaced);
+		result = ACR_FAILURE;
+	}
+
+	// the result is always valid
+	if(ACR_Utf8Validate((const ACR_Byte_t*)dst.m_Buffer.m_Pointer, dst.m_Buffer.m_Length, ACR_NULL) != ACR_INFO_VALID)
+	{
+		ACR_DEBUG_PRINT(2, "FAIL sanitize result is not valid");
+		result = ACR_FAILURE;
+	}
+	ACR_VarBufferDeInit(&dst);
+
+	return result;
+}
+
+/**********************************************************/
+int ValidateBenchmark(void)
+{
+	ACR_Buffer_t data;
+	ACR_Length_t length = 16 * 1024 * 1024;
+	ACR_Length_t i;
+	ACR_Byte_t* bytes;
+	double start;
+	double asciiTime;
+	double mixedTime;
+	double gigabytes = ((double)length) / (1024.0 * 1024.0 * 1024.0);
+	int repeat;
+	int valid = 0;
+
+	ACR_BufferInit(&data);
+	if(ACR_BufferAllocate(&data, length) != ACR_INFO_OK)
+	{
+		// not enough memory to run the benchmark
+		return ACR_SUCCESS;
+	}
+	bytes = (ACR_Byte_t*)data.m_Pointer;
+
+	// ASCII text
+	for(i = 0; i < length; i++)
+	{
+		bytes[i] = (ACR_Byte_t)('a' + (i % 26));
+	}
+	start = ACR_TimerSeconds();
+	for(repeat = 0; repeat < 4; repeat++)
+	{
+		valid += (ACR_Utf8Validate(bytes, length, ACR_NULL) == ACR_INFO_VALID);
+	}
+	asciiTime = ACR_TimerSeconds() - start;
+
+	// text with a 2, 3, or 4 byte character in every 8 bytes
+	for(i = 0; (i + 8) <= length; i += 8)
+	{
+		switch((i / 8) % 3)
+		{
+			case 0: memcpy(bytes + i, "abcdef\xC3\xA9", 8); break;
+			case 1: memcpy(bytes + i, "abcde\xE2\x82\xAC", 8); break;
+			default: memcpy(bytes + i, "abcd\xF0\x9F\x98\x80", 8); break;
+		}
+	}
+	start = ACR_TimerSeconds();
+	for(repeat = 0; repeat < 4; repeat++)
+	{
+		valid += (ACR_Utf8Validate(bytes, length, ACR_NULL) == ACR_INFO_VALID);
+	}
+	mixedTime = ACR_TimerSeconds() - start;
+
+	ACR_UNUSED(gigabytes);
+	if((asciiTime > 0) && (mixedTime > 0))
+	{
+		ACR_DEBUG_PRINT(1, "BENCHMARK validate GB/s ascii %.2f mixed %.2f (SSSE3 %d)", (4.0 * gigabytes) / asciiTime, (4.0 * gigabytes) / mixedTime, (int)ACR_HAS_SSSE3);
+	}
+
+	ACR_BufferDeInit(&data);
+
+	if(valid != 8)
+	{
+		ACR_DEBUG_PRINT(2, "FAIL benchmark data is not valid");
+		return ACR_FAILURE;
+	}
+	return ACR_SUCCESS;
+}
+
+/**********************************************************/
+int CaseTest(void)
+{
+	int result = ACR_SUCCESS;
+	int i;
+
+	// character, lower-case, upper-case, case folded
+	const ACR_Unicode_t cases[][4] = {
+		{0x0041, 0x0061, 0x0041, 0x0061}, // A
+		{0x007A, 0x007A, 0x005A, 0x007A}, // z
+		{0x0040, 0x0040, 0x0040, 0x0040}, // @
+		{0x00C4, 0x00E4, 0x00C4, 0x00E4}, // A with diaeresis
+		{0x00DF, 0x00DF, 0x00DF, 0x00DF}, // sharp s has no simple upper-case
+		{0x1E9E, 0x00DF, 0x1E9E, 0x00DF}, // capital sharp s
+		{0x0130, 0x0069, 0x0130, 0x0130}, // I with dot above
+		{0x0131, 0x0131, 0x0049, 0x0131}, // dotless i
+		{0x017F, 0x017F, 0x0053, 0x0073}, // long s
+		{0x03A3, 0x03C3, 0x03A3, 0x03C3}, // capital sigma
+		{0x03C2, 0x03C2, 0x03A3, 0x03C3}, // final sigma
+		{0x0416, 0x0436, 0x0416, 0x0436}, // cyrillic zhe
+		{0x01C5, 0x01C6, 0x01C4, 0x01C6}, // title-case dz with caron
+		{0x1F80, 0x1F80, 0x1F88, 0x1F80}, // greek alpha with psili and ypogegrammeni
+		{0x212A, 0x006B, 0x212A, 0x006B}, // kelvin sign
+		{0x2C62, 0x026B, 0x2C62, 0x026B}, // L with middle tilde
+		{0xA7AD, 0x026C, 0xA7AD, 0x026C}, // L with belt
+		{0xAB70, 0xAB70, 0x13A0, 0x13A0}, // cherokee folds to upper-case
+		{0xFF21, 0xFF41, 0xFF21, 0xFF41}, // fullwidth A
+		{0x4E2D, 0x4E2D, 0x4E2D, 0x4E2D}, // CJK
+		{0x10400, 0x10428, 0x10400, 0x10428}, // deseret
+		{0x1E922, 0x1E922, 0x1E900, 0x1E922}, // adlam
+		{0x1F600, 0x1F600, 0x1F600, 0x1F600}, // emoji
+		{0x10FFFF, 0x10FFFF, 0x10FFFF, 0x10FFFF}
+	};
+
+	for(i = 0; i < (int)(sizeof(cases) / sizeof(cases[0])); i++)
+	{
+		if((ACR_UnicodeToLower(cases[i][0]) != cases[i][1]) ||
+		   (ACR_UnicodeToUpper(cases[i][0]) != cases[i][2]) ||
+		   (ACR_UnicodeFold(cases[i][0]) != cases[i][3]))
+		{
+			ACR_DEBUG_PRINT(1, "FAIL case of U+%04lX lower U+%04lX upper U+%04lX fold U+%04lX", cases[i][0],
+				ACR_UnicodeToLower(cases[i][0]), ACR_UnicodeToUpper(cases[i][0]), ACR_UnicodeFold(cases[i][0]));
+			result = ACR_FAILURE;
+		}
+	}
+
+	return result;
+}
+
+/** a character and its lower-case representation
+*/
+typedef struct CaseBenchmarkPair_s
+{
+	ACR_Unicode_t m_Character;
+	ACR_Unicode_t m_Lower;
+} CaseBenchmarkPair_t;
+
+/** find the lower-case representation of a character in a
+    sorted array of pairs
+*/
+static ACR_Unicode_t CaseBenchmarkSearch(
+	const CaseBenchmarkPair_t* pairs,
+	ACR_Count_t count,
+	ACR_Unicode_t u)
+{
+	ACR_Count_t low = 0;
+	ACR_Count_t high = count;
+	ACR_Count_t mid;
+	while(low < high)
+	{
+		mid = low + ((high - low) / 2);
+		if(pairs[mid].m_Character < u)
+		{
+			low = mid + 1;
+		}
+		else
+		{
+			high = mid;
+		}
+	}
+	if((low < count) && (pairs[low].m_Character == u))
+	{
+		return pairs[low].m_Lower;
+	}
+	return u;
+}
+
+/**********************************************************/
+int CaseBenchmark(void)
+{
+	CaseBenchmarkPair_t* pairs;
+	ACR_Unicode_t* text;
+	ACR_Count_t pairCount = 0;
+	ACR_Count_t textCount = 1024 * 1024;
+	ACR_Unicode_t u;
+	ACR_Unicode_t searchSum = 0;
+	ACR_Unicode_t tableSum = 0;
+	double start;
+	double searchTime;
+	double tableTime;
+	ACR_Count_t i;
+	int repeat;
+
+	// the characters in the text are mostly latin, greek and
+	// cyrillic letters with some CJK
+	const ACR_Unicode_t ranges[][2] = {
+		{0x0041, 0x007A},
+		{0x00C0, 0x017F},
+		{0x0391, 0x03C9},
+		{0x0410, 0x044F},
+		{0x4E00, 0x4FFF}
+	};
+
+	pairs = (CaseBenchmarkPair_t*)malloc(sizeof(CaseBenchmarkPair_t) * 4096);
+	text = (ACR_Unicode_t*)malloc(sizeof(ACR_Unicode_t) * textCount);
+	if((pairs == ACR_NULL) || (text == ACR_NULL))
+	{
+		// not enough memory to run the benchmark
+		free(pairs);
+		free(text);
+		return ACR_SUCCESS;
+	}
+
+	// build the sorted array for the binary search
+	for(u = 0; (u < ACR_UNICODE_CASE_LIMIT) && (pairCount < 4096); u++)
+	{
+		if(ACR_UnicodeToLower(u) != u)
+		{
+			pairs[pairCount].m_Character = u;
+			pairs[pairCount].m_Lower = ACR_UnicodeToLower(u);
+			pairCount++;
+		}
+	}
+
+	srand(7);
+	for(i = 0; i < textCount; i++)
+	{
+		int r = rand() % 5;
+		text[i] = ranges[r][0] + (ACR_Unicode_t)(rand() % (int)(ranges[r][1] - ranges[r][0] + 1));
+	}
+
+	start = ACR_TimerSeconds();
+	for(repeat = 0; repeat < 8; repeat++)
+	{
+		for(i = 0; i < textCount; i++)
+		{
+			searchSum += CaseBenchmarkSearch(pairs, pairCount, text[i]);
+		}
+	}
+	searchTime = ACR_TimerSeconds() - start;
+
+	start = ACR_TimerSeconds();
+	for(repeat = 0; repeat < 8; repeat++)
+	{
+		for(i = 0; i < textCount; i++)
+		{
+			tableSum += ACR_UnicodeToLower(text[i]);
+		}
+	}
+	tableTime = ACR_TimerSeconds() - start;
+
+	if((searchTime > 0) && (tableTime > 0))
+	{
+		ACR_DEBUG_PRINT(1, "BENCHMARK lower-case of %d mappings million characters/s binary search %.0f ACR_UnicodeToLower %.0f",
+			(int)pairCount, (8.0 * (double)textCount) / (searchTime * 1000000.0), (8.0 * (double)textCount) / (tableTime * 1000000.0));
+	}
+
+	free(pairs);
+	free(text);
+
+	if(searchSum != tableSum)
+	{
+		ACR_DEBUG_PRINT(2, "FAIL benchmark lower-case results are different");
+		return ACR_FAILURE;
+	}
+	return ACR_SUCCESS;
+}
+
+/**********************************************************/
+int TranscodeTest(void)
+{
+	int result = ACR_SUCCESS;
+	ACR_VarBuffer_t utf16;
+	ACR_VarBuffer_t utf32;
+	ACR_VarBuffer_t utf8;
+	ACR_Length_t length;
+	ACR_Length_t errorOffset;
+	int i;
+
+	// "a" U+00E9 U+20AC U+1F600 then 20 ASCII characters
+	const char* src = "a\xC3\xA9\xE2\x82\xAC\xF0\x9F\x98\x80" "abcdefghijklmnopqrst";
+	const ACR_Byte_t expected16[] = {
+		0x61, 0x00, 0xE9, 0x00, 0xAC, 0x20, 0x3D, 0xD8, 0x00, 0xDE
+	};
+	const ACR_Byte_t expected32[] = {
+		0x61, 0x00, 0x00, 0x00, 0xE9, 0x00, 0x00, 0x00, 0xAC, 0x20, 0x00, 0x00, 0x00, 0xF6, 0x01, 0x00
+	};
+
+	// invalid UTF16LE and UTF32LE and the offset of the error
+	const ACR_Byte_t unpairedHigh[] = {0x61, 0x00, 0x3D, 0xD8, 0x61, 0x00};
+	const ACR_Byte_t unpairedLow[] = {0x00, 0xDE, 0x61, 0x00};
+	const ACR_Byte_t oddLength[] = {0x61, 0x00, 0x61};
+	const ACR_Byte_t surrogate32[] = {0x61, 0x00, 0x00, 0x00, 0x00, 0xD8, 0x00, 0x00};
+	const ACR_Byte_t tooLarge32[] = {0x00, 0x00, 0x11, 0x00};
+	const struct
+	{
+		const ACR_Byte_t* m_Data;
+		ACR_Length_t m_Length;
+		ACR_Length_t m_UnitBytes;
+		ACR_Length_t m_ErrorOffset;
+	} invalid[] = {
+		{unpairedHigh, sizeof(unpairedHigh), 2, 2},
+		{unpairedLow, sizeof(unpairedLow), 2, 0},
+		{oddLength, sizeof(oddLength), 2, 2},
+		{surrogate32, sizeof(surrogate32), 4, 4},
+		{tooLarge32, sizeof(tooLarge32), 4, 0},
+		{oddLength, sizeof(oddLength), 4, 0}
+	};
+
+	ACR_VarBufferInit(&utf16);
+	ACR_VarBufferInit(&utf32);
+	ACR_VarBufferInit(&utf8);
+
+	if((ACR_Utf8ToUtf16Length((const ACR_Byte_t*)src, (ACR_Length_t)strlen(src), &length) != ACR_INFO_VALID) ||
+	   (length != (ACR_Length_t)(sizeof(expected16) + 40)) ||
+	   (ACR_Utf8ToUtf16(&utf16, (const ACR_Byte_t*)src, (ACR_Length_t)strlen(src), ACR_NULL) != ACR_INFO_VALID) ||
+	   (utf16.m_Buffer.m_Length != length) ||
+	   (memcmp(utf16.m_Buffer.m_Pointer, expected16, sizeof(expected16)) != 0) ||
+	   (((ACR_Byte_t*)utf16.m_Buffer.m_Pointer)[length - 2] != 't'))
+	{
+		ACR_DEBUG_PRINT(1, "FAIL UTF8 to UTF16 length %d", (int)utf16.m_Buffer.m_Length);
+		result = ACR_FAILURE;
+	}
+
+	if((ACR_Utf8ToUtf32Length((const ACR_Byte_t*)src, (ACR_Length_t)strlen(src), &length) != ACR_INFO_VALID) ||
+	   (length != (ACR_Length_t)(sizeof(expected32) + 80)) ||
+	   (ACR_Utf8ToUtf32(&utf32, (const ACR_Byte_t*)src, (ACR_Length_t)strlen(src), ACR_NULL) != ACR_INFO_VALID) ||
+	   (utf32.m_Buffer.m_Length != length) ||
+	   (memcmp(utf32.m_Buffer.m_Pointer, expected32, sizeof(expected32)) != 0) ||
+	   (((ACR_Byte_t*)utf32.m_Buffer.m_Pointer)[length - 4] != 't'))
+	{
+		ACR_DEBUG_PRINT(2, "FAIL UTF8 to UTF32 length %d", (int)utf32.m_Buffer.m_Length);
+		result = ACR_FAILURE;
+	}
+
+	// convert both back to UTF8
+	if((ACR_Utf16ToUtf8Length((const ACR_Byte_t*)utf16.m_Buffer.m_Pointer, utf16.m_Buffer.m_Length, &length) != ACR_INFO_VALID) ||
+	   (length != (ACR_Length_t)strlen(src)) ||
+	   (ACR_Utf16ToUtf8(&utf8, (const ACR_Byte_t*)utf16.m_Buffer.m_Pointer, utf16.m_Buffer.m_Length, ACR_NULL) != ACR_INFO_VALID) ||
+	   (ACR_Utf32ToUtf8Length((const ACR_Byte_t*)utf32.m_Buffer.m_Pointer, utf32.m_Buffer.m_Length, &length) != ACR_INFO_VALID) ||
+	   (length != (ACR_Length_t)strlen(src)) ||
+	   (ACR_Utf32ToUtf8(&utf8, (const ACR_Byte_t*)utf32.m_Buffer.m_Pointer, utf32.m_Buffer.m_Length, ACR_NULL) != ACR_INFO_VALID) ||
+	   (utf8.m_Buffer.m_Length != (2 * strlen(src))) ||
+	   (memcmp(utf8.m_Buffer.m_Pointer, src, strlen(src)) != 0) ||
+	   (memcmp(((ACR_Byte_t*)utf8.m_Buffer.m_Pointer) + strlen(src), src, strlen(src)) != 0))
+	{
+		ACR_DEBUG_PRINT(3, "FAIL UTF16 and UTF32 to UTF8 length %d", (int)utf8.m_Buffer.m_Length);
+		result = ACR_FAILURE;
+	}
+
+	// invalid data adds nothing to the buffer
+	ACR_VarBufferSetLength(&utf8, 0);
+	for(i = 0; i < (int)(sizeof(invalid) / sizeof(invalid[0])); i++)
+	{
+		errorOffset = 0;
+		if(((invalid[i].m_UnitBytes == 2) ?
+			ACR_Utf16ToUtf8(&utf8, invalid[i].m_Data, invalid[i].m_Length, &errorOffset) :
+			ACR_Utf32ToUtf8(&utf8, invalid[i].m_Data, invalid[i].m_Length, &errorOffset)) != ACR_INFO_INVALID)
+		{
+			ACR_DEBUG_PRINT(4, "FAIL invalid data %d was converted", i);
+			result = ACR_FAILURE;
+		}
+		else if((errorOffset != invalid[i].m_ErrorOffset) || (utf8.m_Buffer.m_Length != 0))
+		{
+			ACR_DEBUG_PRINT(5, "FAIL invalid data %d error offset %d", i, (int)errorOffset);
+			result = ACR_FAILURE;
+		}
+	}
+	if((ACR_Utf8ToUtf16(&utf16, (const ACR_Byte_t*)"ab\xC3", 3, &errorOffset) != ACR_INFO_INVALID) ||
+	   (errorOffset != 2))
+	{
+		ACR_DEBUG_PRINT(6, "FAIL invalid UTF8 was converted");
+		result = ACR_FAILURE;
+	}
+
+	ACR_VarBufferDeInit(&utf16);
+	ACR_VarBufferDeInit(&utf32);
+	ACR_VarBufferDeInit(&utf8);
+
+	return result;
+}
+
+/**********************************************************/
+int RandomTranscodeTest(void)
+{
+	int result = ACR_SUCCESS;
+	ACR_Byte_t utf32[4 * 200];
+	ACR_VarBuffer_t utf8;
+	ACR_VarBuffer_t utf16;
+	ACR_VarBuffer_t back8;
+	ACR_VarBuffer_t back32;
+	ACR_Unicode_t u;
+	int count;
+	int test;
+	int i;
+
+	ACR_VarBufferInit(&utf8);
+	ACR_VarBufferInit(&utf16);
+	ACR_VarBufferInit(&back8);
+	ACR_VarBufferInit(&back32);
+
+	srand(3);
+	for(test = 0; (test < 2000) && (result == ACR_SUCCESS); test++)
+	{
+		// mostly runs of ASCII with some characters of every
+		// UTF8 length
+		count = rand() % 200;
+		for(i = 0; i < count; i++)
+		{
+			switch(rand() % 8)
+			{
+				case 0: u = 0x80 + (ACR_Unicode_t)(rand() % 0x780); break;
+				case 1: u = 0x800 + (ACR_Unicode_t)(rand() % 0xD000); break;
+				case 2: u = 0x10000 + ((((ACR_Unicode_t)rand()) << 8) ^ (ACR_Unicode_t)rand()) % 0x100000; break;
+				default: u = (ACR_Unicode_t)(rand() % 0x80); break;
+			}
+			if((u >= 0xD800) && (u <= 0xDFFF))
+			{
+				u = 0xFFFD;
+			}
+			utf32[(i * 4) + 0] = (ACR_Byte_t)(u & 0xFF);
+			utf32[(i * 4) + 1] = (ACR_Byte_t)((u >> 8) & 0xFF);
+			utf32[(i * 4) + 2] = (ACR_Byte_t)((u >> 16) & 0xFF);
+			utf32[(i * 4) + 3] = 0;
+		}
+
+		ACR_VarBufferSetLength(&utf8, 0);
+		ACR_VarBufferSetLength(&utf16, 0);
+		ACR_VarBufferSetLength(&back8, 0);
+		ACR_VarBufferSetLength(&back32, 0);
+		if((ACR_Utf32ToUtf8(&utf8, utf32, (ACR_Length_t)(count * 4), ACR_NULL) != ACR_INFO_VALID) ||
+		   (ACR_Utf8Validate((const ACR_Byte_t*)utf8.m_Buffer.m_Pointer, utf8.m_Buffer.m_Length, ACR_NULL) != ACR_INFO_VALID) ||
+		   (ACR_Utf8ToUtf16(&utf16, (const ACR_Byte_t*)utf8.m_Buffer.m_Pointer, utf8.m_Buffer.m_Length, ACR_NULL) != ACR_INFO_VALID) ||
+		   (ACR_Utf16ToUtf8(&back8, (const ACR_Byte_t*)utf16.m_Buffer.m_Pointer, utf16.m_Buffer.m_Length, ACR_NULL) != ACR_INFO_VALID) ||
+		   (ACR_Utf8ToUtf32(&back32, (const ACR_Byte_t*)back8.m_Buffer.m_Pointer, back8.m_Buffer.m_Length, ACR_NULL) != ACR_INFO_VALID) ||
+		   (back8.m_Buffer.m_Length != utf8.m_Buffer.m_Length) ||
+		   (back32.m_Buffer.m_Length != (ACR_Length_t)(count * 4)) ||
+		   ((count > 0) && (memcmp(back8.m_Buffer.m_Pointer, utf8.m_Buffer.m_Pointer, utf8.m_Buffer.m_Length) != 0)) ||
+		   ((count > 0) && (memcmp(back32.m_Buffer.m_Pointer, utf32, (size_t)(count * 4)) != 0)))
+		{
+			ACR_DEBUG_PRINT(1, "FAIL random transcode test %d", test);
+			result = ACR_FAILURE;
+		}
+	}
+
+	ACR_VarBufferDeInit(&utf8);
+	ACR_VarBufferDeInit(&utf16);
+	ACR_VarBufferDeInit(&back8);
+	ACR_VarBufferDeInit(&back32);
+
+	return result;
+}
+
+/**********************************************************/
+int TranscodeBenchmark(void)
+{
+	int result = ACR_SUCCESS;
+	ACR_VarBuffer_t src;
+	ACR_VarBuffer_t utf16;
+	ACR_VarBuffer_t utf8;
+	const char* texts[] = {
+		"The quick brown fox jumps over the lazy dog. ",
+		"Caf\xC3\xA9 \xCE\xBA\xCF\x8C\xCF\x83\xCE\xBC\xCE\xB5 \xE6\x97\xA5\xE6\x9C\xAC\xE8\xAA\x9E \xF0\x9F\x98\x80 "
+	};
+	const char* names[] = {"ascii", "mixed"};
+	double start;
+	double toTime;
+	double fromTime;
+	double megabytes;
+	int text;
+	int repeat;
+
+	ACR_VarBufferInit(&src);
+	ACR_VarBufferInit(&utf16);
+	ACR_VarBufferInit(&utf8);
+	ACR_UNUSED(names);
+
+	for(text = 0; (text < 2) && (result == ACR_SUCCESS); text++)
+	{
+		ACR_VarBufferSetLength(&src, 0);
+		while(src.m_Buffer.m_Length < (4 * 1024 * 1024))
+		{
+			if(ACR_VarBufferReserve(&src, src.m_Buffer.m_Length + (ACR_Length_t)strlen(texts[text])) != ACR_INFO_OK)
+			{
+				// not enough memory to run the benchmark
+				result = ACR_FAILURE;
+				break;
+			}
+			ACR_VarBufferAppend(&src, (void*)texts[text], (ACR_Length_t)strlen(texts[text]));
+		}
+		megabytes = (4.0 * (double)src.m_Buffer.m_Length) / (1024.0 * 1024.0);
+		ACR_UNUSED(megabytes);
+
+		toTime = 0;
+		fromTime = 0;
+		for(repeat = 0; (repeat < 4) && (result == ACR_SUCCESS); repeat++)
+		{
+			ACR_VarBufferSetLength(&utf16, 0);
+			ACR_VarBufferSetLength(&utf8, 0);
+
+			start = ACR_TimerSeconds();
+			result |= (ACR_Utf8ToUtf16(&utf16, (const ACR_Byte_t*)src.m_Buffer.m_Pointer, src.m_Buffer.m_Length, ACR_NULL) == ACR_INFO_VALID) ? ACR_SUCCESS : ACR_FAILURE;
+			toTime += ACR_TimerSeconds() - start;
+
+			start = ACR_TimerSeconds();
+			result |= (ACR_Utf16ToUtf8(&utf8, (const ACR_Byte_t*)utf16.m_Buffer.m_Pointer, utf16.m_Buffer.m_Length, ACR_NULL) == ACR_INFO_VALID) ? ACR_SUCCESS : ACR_FAILURE;
+			fromTime += ACR_TimerSeconds() - start;
+		}
+
+		if((result == ACR_SUCCESS) &&
+		   ((utf8.m_Buffer.m_Length != src.m_Buffer.m_Length) ||
+		    (memcmp(utf8.m_Buffer.m_Pointer, src.m_Buffer.m_Pointer, src.m_Buffer.m_Length) != 0)))
+		{
+			result = ACR_FAILURE;
+		}
+		if(result != ACR_SUCCESS)
+		{
+			ACR_DEBUG_PRINT(1, "FAIL %s transcode benchmark", names[text]);
+		}
+		else if((toTime > 0) && (fromTime > 0))
+		{
+			ACR_DEBUG_PRINT(2, "BENCHMARK %s UTF8 MB/s to UTF16 %.0f from UTF16 %.0f", names[text], megabytes / toTime, megabytes / fromTime);
+		}
+	}
+
+	ACR_VarBufferDeInit(&src);
+	ACR_VarBufferDeInit(&utf16);
+	ACR_VarBufferDeInit(&utf8);
+
+	return result;
+}
+
+/**********************************************************/
+int DecoderTest(void)
+{
+	int result = ACR_SUCCESS;
+	ACR_Byte_t src[300];
+	ACR_Unicode_t decoded[300];
+	ACR_Unicode_t expected[300];
+	ACR_VarBuffer_t sanitized;
+	ACR_VarBuffer_t utf32;
+	ACR_Utf8Decoder_t decoder;
+	ACR_Utf8Decoder_t counter;
+	ACR_Count_t replaced;
+	ACR_Count_t expectedCount;
+	ACR_Count_t decodedCount;
+	ACR_Count_t counted;
+	ACR_Count_t stored;
+	ACR_Length_t length;
+	ACR_Length_t pos;
+	ACR_Length_t chunk;
+	ACR_Length_t used;
+	ACR_Count_t i;
+	int test;
+
+	// bytes that make valid and invalid sequences
+	const ACR_Byte_t bytes[] = {0x41, 0x7F, 0x80, 0x8F, 0x90, 0x9F, 0xA0, 0xBF, 0xC0, 0xC2, 0xDF, 0xE0, 0xE1, 0xED, 0xEF, 0xF0, 0xF1, 0xF4, 0xF5, 0xFF};
+
+	ACR_VarBufferInit(&sanitized);
+	ACR_VarBufferInit(&utf32);
+
+	srand(5);
+	for(test = 0; (test < 5000) && (result == ACR_SUCCESS); test++)
+	{
+		length = (ACR_Length_t)(rand() % 100);
+		for(pos = 0; pos < length; pos++)
+		{
+			src[pos] = bytes[rand() % (int)sizeof(bytes)];
+		}
+
+		// decode all of the data at once
+		ACR_VarBufferSetLength(&sanitized, 0);
+		ACR_VarBufferSetLength(&utf32, 0);
+		ACR_Utf8Sanitize(&sanitized, src, length, &replaced);
+		ACR_Utf8ToUtf32(&utf32, (const ACR_Byte_t*)sanitized.m_Buffer.m_Pointer, sanitized.m_Buffer.m_Length, ACR_NULL);
+		expectedCount = (ACR_Count_t)(utf32.m_Buffer.m_Length / 4);
+		for(i = 0; i < expectedCount; i++)
+		{
+			const ACR_Byte_t* c = ((const ACR_Byte_t*)utf32.m_Buffer.m_Pointer) + (i * 4);
+			expected[i] = ((ACR_Unicode_t)c[0]) | (((ACR_Unicode_t)c[1]) << 8) | (((ACR_Unicode_t)c[2]) << 16);
+		}
+
+		// decode the data in chunks of 1 to 7 bytes into space
+		// for 1 to 4 characters at a time
+		ACR_Utf8DecoderInit(&decoder);
+		ACR_Utf8DecoderInit(&counter);
+		decodedCount = 0;
+		counted = 0;
+		pos = 0;
+		while(pos < length)
+		{
+			chunk = 1 + (ACR_Length_t)(rand() % 7);
+			if(chunk > (length - pos))
+			{
+				chunk = length - pos;
+			}
+			counted += ACR_Utf8DecoderCount(&counter, src + pos, chunk);
+			used = 0;
+			while(used < chunk)
+			{
+				used += ACR_Utf8DecoderDecode(&decoder, src + pos + used, chunk - used, decoded + decodedCount, 1 + (ACR_Count_t)(rand() % 4), &stored);
+				decodedCount += stored;
+			}
+			pos += chunk;
+		}
+		decodedCount += ACR_Utf8DecoderFinish(&decoder, decoded + decodedCount);
+		counted += ACR_Utf8DecoderFinish(&counter, ACR_NULL);
+
+		if((decodedCount != expectedCount) || (counted != expectedCount) ||
+		   (decoder.m_ErrorCount != replaced) || (counter.m_ErrorCount != replaced) ||
+		   ((expectedCount > 0) && (memcmp(decoded, expected, sizeof(ACR_Unicode_t) * expectedCount) != 0)))
+		{
+			ACR_DEBUG_PRINT(1, "FAIL decoder test %d decoded %d counted %d instead of %d", test, (int)decodedCount, (int)counted, (int)expectedCount);
+			result = ACR_FAILURE;
+		}
+	}
+
+	ACR_VarBufferDeInit(&sanitized);
+	ACR_VarBufferDeInit(&utf32);
+
+	return result;
+}
@@ -101,7 +101,19 @@ void ACR_AlignedBufferInit(
 void ACR_AlignedBufferDeInit(
 	ACR_AlignedBuffer_t* me);
 
-/// \todo ACR_AlignedBufferAllocate
+/** allocate memory for the aligned buffer
+	\param me the aligned buffer
+	\param length value 1 to ACR_MAX_LENGTH
+	\returns ACR_INFO_OK or ACR_INFO_ERROR
+
+	Note: the memory starts on a block boundary and the full
+	      length is available. if the buffer already has memory
+		  allocated, the memory will be freed before any new
+		  memory is allocated
+*/
+ACR_Info_t ACR_AlignedBufferAllocate(
+	ACR_AlignedBuffer_t* me,
+	ACR_Length_t length);
 
 /** set aligned memory by reference
 	\param ptr pointer to the start of the memory to access
@@ -0,0 +1,350 @@
+/*
+
+    ********** DO NOT REMOVE THIS INFORMATION ************
+
+    ACR - A set of C functions in a git Repository
+    Copyright (C) 2018 - 2020 Adam C. Rosenberg
+
+    Please read LICENSE before using this code
+
+    Please read README.md for instructions on including
+    this code in your project and where to find examples
+
+    If you contribute to this code, Please add your name
+    and email address to the AUTHORS list below so that
+    we know who to thank!
+
+    AUTHORS
+
+    Adam Rosenberg <adam@sirspot.com>
+
+    LICENSE
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+    ******************************************************
+
+*/
+/** \file bitset.h
+
+    functions for access to the ACR_Bitset_t type
+
+    a bitset stores a large number of true/false values as
+    single bits packed into ACR_Block_t aligned memory so that
+    bulk logic operations and counting work on an entire
+    block (or more with SIMD) at a time
+
+*/
+#ifndef _ACR_BITSET_H_
+#define _ACR_BITSET_H_
+
+#include "ACR/public.h"
+
+////////////////////////////////////////////////////////////
+//
+// TYPES AND DEFINES
+//
+////////////////////////////////////////////////////////////
+
+#ifndef ACR_BITSET_RANK_SAMPLE_BLOCKS
+/** this is used by ACR_BitsetBuildRankIndex() to determine
+    how many blocks are between each sample of the rank index.
+	8 blocks of 64 bits is a single cache line so that each
+	rank query reads one sample and at most one cache line
+*/
+#define ACR_BITSET_RANK_SAMPLE_BLOCKS 8
+#endif
+
+#ifdef ACR_COMPILER_VS2017
+#pragma warning(push)
+// disable warning C4820: padding added after data member
+#pragma warning(disable:4820)
+#endif
+/** type for a set of bits
+	- include "ACR/bitset.h" for easy and safe functions
+	- see ACR_BITSET defines for fast access via macros
+*/
+typedef struct ACR_Bitset_s
+{
+	/** block aligned memory that stores the bits
+
+	    Note: bits after m_BitCount in the last block are
+		      always kept as zero so that they never change
+			  the result of counting
+	*/
+	ACR_AlignedBuffer_t m_Memory;
+
+	/** the number of bits in the set
+	*/
+	ACR_Length_t m_BitCount;
+
+	/** the number of blocks used to store the bits
+	*/
+	ACR_Length_t m_BlockCount;
+
+	/** ACR_Length_t samples of the number of bits set before
+	    every ACR_BITSET_RANK_SAMPLE_BLOCKS blocks
+		\see ACR_BitsetBuildRankIndex()
+	*/
+	ACR_Buffer_t m_RankIndex;
+
+	/** see enum ACR_BitsetFlags_e
+	*/
+	ACR_Flags_t m_Flags;
+
+} ACR_Bitset_t;
+#ifdef ACR_COMPILER_VS2017
+#pragma warning(pop)
+#endif
+
+/** bitset flags
+*/
+enum ACR_BitsetFlags_e
+{
+	ACR_BITSET_FLAGS_NONE      = 0x00,
+	ACR_BITSET_HAS_RANK_INDEX  = 0x01
+};
+
+/** get a pointer to the blocks of the bitset
+*/
+#define ACR_BITSET_BLOCKS(name) ((ACR_Block_t*)name.m_Memory.m_AlignedBuffer.m_Pointer)
+
+/** get the index of the block that stores the specified bit
+*/
+#define ACR_BITSET_BLOCK_INDEX(bit) ((bit) / ACR_BITS_PER_BLOCK)
+
+/** get the mask for the specified bit within its block
+*/
+#define ACR_BITSET_BLOCK_MASK(bit) (((ACR_Block_t)1) << ((bit) % ACR_BITS_PER_BLOCK))
+
+/** set, clear, or test a single bit without any checks
+
+    IMPORTANT: these macros do not check that the bit is less
+	           than m_BitCount and do not invalidate the rank
+			   index. use ACR_BitsetSet(), ACR_BitsetClear(),
+			   and ACR_BitsetTest() if unsure
+*/
+#define ACR_BITSET_SET(name, bit) (ACR_BITSET_BLOCKS(name)[ACR_BITSET_BLOCK_INDEX(bit)] |= ACR_BITSET_BLOCK_MASK(bit))
+#define ACR_BITSET_CLEAR(name, bit) (ACR_BITSET_BLOCKS(name)[ACR_BITSET_BLOCK_INDEX(bit)] &= (~ACR_BITSET_BLOCK_MASK(bit)))
+#define ACR_BITSET_TEST(name, bit) ((ACR_BITSET_BLOCKS(name)[ACR_BITSET_BLOCK_INDEX(bit)] & ACR_BITSET_BLOCK_MASK(bit)) != 0)
+
+////////////////////////////////////////////////////////////
+// ALLOW FUNCTIONS TO BE CALLED FROM C++                  //
+////////////////////////////////////////////////////////////
+#ifdef __cplusplus                                        //
+extern "C" {                                              //
+#endif                                                    //
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+//
+// PUBLIC FUNCTIONS
+//
+////////////////////////////////////////////////////////////
+
+/** prepare a bitset allocated on the heap
+	Note: this automatically calls ACR_BitsetInit() on the
+	      new bitset after allocating its memory
+	\param mePtr location to store the pointer for the new bitset
+	\returns ACR_INFO_OK or ACR_INFO_ERROR
+*/
+ACR_Info_t ACR_BitsetNew(
+	ACR_Bitset_t** mePtr);
+
+/** free a bitset allocated on the heap
+    Note: this automatically calls ACR_BitsetDeInit() on
+	      the bitset before freeing its memory
+	\param mePtr location of the pointer for the bitset, which will
+	       be set to ACR_NULL after the memory is freed
+*/
+void ACR_BitsetDelete(
+	ACR_Bitset_t** mePtr);
+
+/** prepare a bitset
+
+	Note: memory for the bits must be allocated
+		  by calling ACR_BitsetAllocate()
+		  before the bitset can be used effectively.
+*/
+void ACR_BitsetInit(
+	ACR_Bitset_t* me);
+
+/** free bitset memory
+*/
+void ACR_BitsetDeInit(
+	ACR_Bitset_t* me);
+
+/** allocate memory for the specified number of bits
+    and clear all of them
+	\param me the bitset
+	\param bitCount value 1 to ACR_MAX_LENGTH
+	\returns ACR_INFO_OK or ACR_INFO_ERROR
+
+	IMPORTANT: if the bitset already has memory allocated,
+	           the memory will be freed before any new memory is allocated
+*/
+ACR_Info_t ACR_BitsetAllocate(
+	ACR_Bitset_t* me,
+	ACR_Length_t bitCount);
+
+/** get the number of bits in the set
+*/
+ACR_Length_t ACR_BitsetGetBitCount(
+	ACR_Bitset_t* me);
+
+/** set a single bit to 1
+	\returns ACR_INFO_OK or ACR_INFO_ERROR if the bit is out of range
+*/
+ACR_Info_t ACR_BitsetSet(
+	ACR_Bitset_t* me,
+	ACR_Length_t bit);
+
+/** clear a single bit to 0
+	\returns ACR_INFO_OK or ACR_INFO_ERROR if the bit is out of range
+*/
+ACR_Info_t ACR_BitsetClear(
+	ACR_Bitset_t* me,
+	ACR_Length_t bit);
+
+/** test a single bit
+	\returns ACR_INFO_TRUE if the bit is 1 or ACR_INFO_FALSE if
+	         the bit is 0 or out of range
+*/
+ACR_Info_t ACR_BitsetTest(
+	ACR_Bitset_t* me,
+	ACR_Length_t bit);
+
+/** set all bits to 1
+*/
+void ACR_BitsetSetAll(
+	ACR_Bitset_t* me);
+
+/** clear all bits to 0
+*/
+void ACR_BitsetClearAll(
+	ACR_Bitset_t* me);
+
+/** me = me AND other
+	\param me the bitset to change
+	\param other a bitset with the same number of bits
+	\returns ACR_INFO_OK or ACR_INFO_ERROR
+*/
+ACR_Info_t ACR_BitsetAnd(
+	ACR_Bitset_t* me,
+	ACR_Bitset_t* other);
+
+/** me = me OR other
+	\param me the bitset to change
+	\param other a bitset with the same number of bits
+	\returns ACR_INFO_OK or ACR_INFO_ERROR
+*/
+ACR_Info_t ACR_BitsetOr(
+	ACR_Bitset_t* me,
+	ACR_Bitset_t* other);
+
+/** me = me XOR other
+	\param me the bitset to change
+	\param other a bitset with the same number of bits
+	\returns ACR_INFO_OK or ACR_INFO_ERROR
+*/
+ACR_Info_t ACR_BitsetXor(
+	ACR_Bitset_t* me,
+	ACR_Bitset_t* other);
+
+/** me = me AND (NOT other)
+	\param me the bitset to change
+	\param other a bitset with the same number of bits
+	\returns ACR_INFO_OK or ACR_INFO_ERROR
+*/
+ACR_Info_t ACR_BitsetAndNot(
+	ACR_Bitset_t* me,
+	ACR_Bitset_t* other);
+
+/** count the number of bits set to 1
+*/
+ACR_Length_t ACR_BitsetCount(
+	ACR_Bitset_t* me);
+
+/** find the next bit set to 1
+	\param me the bitset
+	\param from the first bit to check
+	\param found location to store the bit that was found
+	\returns ACR_INFO_OK or ACR_INFO_ERROR if there are no
+	         more bits set
+
+	example:
+
+	ACR_Length_t bit = 0;
+	while(ACR_BitsetFindNext(&bitset, bit, &bit) == ACR_INFO_OK)
+	{
+		// bit is set
+		bit++;
+	}
+*/
+ACR_Info_t ACR_BitsetFindNext(
+	ACR_Bitset_t* me,
+	ACR_Length_t from,
+	ACR_Length_t* found);
+
+/** build the rank index so that ACR_BitsetRank() takes
+    constant time and ACR_BitsetSelect() only needs to
+	search the samples
+	\returns ACR_INFO_OK or ACR_INFO_ERROR
+
+	Note: the rank index is invalidated by any function
+	      that changes the bits so it must be built again
+		  after the changes are complete. the ACR_BITSET_SET
+		  and ACR_BITSET_CLEAR macros do not invalidate the
+		  rank index so it must be built again after using them
+*/
+ACR_Info_t ACR_BitsetBuildRankIndex(
+	ACR_Bitset_t* me);
+
+/** count the number of bits set to 1 before the specified bit
+	\param me the bitset
+	\param bit value 0 to the number of bits in the set
+	\returns the number of bits set in the range [0, bit)
+
+	Note: without a rank index this must count every block
+	      before the bit \see ACR_BitsetBuildRankIndex()
+*/
+ACR_Length_t ACR_BitsetRank(
+	ACR_Bitset_t* me,
+	ACR_Length_t bit);
+
+/** find the position of the nth bit set to 1
+	\param me the bitset
+	\param n the number of set bits to skip (0 for the first)
+	\param found location to store the bit that was found
+	\returns ACR_INFO_OK or ACR_INFO_ERROR if fewer than
+	         n+1 bits are set
+
+	Note: without a rank index this must count every block
+	      before the bit \see ACR_BitsetBuildRankIndex()
+*/
+ACR_Info_t ACR_BitsetSelect(
+	ACR_Bitset_t* me,
+	ACR_Length_t n,
+	ACR_Length_t* found);
+
+////////////////////////////////////////////////////////////
+// ALLOW FUNCTIONS TO BE CALLED FROM C++                  //
+////////////////////////////////////////////////////////////
+#ifdef __cplusplus                                        //
+}                                                         //
+#endif                                                    //
+////////////////////////////////////////////////////////////
+
+#endif
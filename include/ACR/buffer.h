@@ -57,6 +57,90 @@
 #define ACR_BUFFER_BYTE_COUNT_PER_SHIFT 256
 #endif
 
+#ifndef ACR_BUFFER_BLOCKS_PER_CALL
+/** this is used by ACR_BufferForEachBlock() when 0 is specified
+    for the number of blocks to pass to each call of the blocks
+    function. 4 to 8 blocks allows the blocks function to unroll
+    its loop without making the calls too far apart for the
+    prefetch to be useful
+*/
+#define ACR_BUFFER_BLOCKS_PER_CALL 4
+#endif
+
+#ifndef ACR_BUFFER_PREFETCH_DISTANCE
+/** this is used by ACR_BufferForEachBlock() to determine how
+    many bytes ahead of the current blocks to prefetch into
+    the cpu cache. use 0 to disable the prefetch
+*/
+#define ACR_BUFFER_PREFETCH_DISTANCE (8*ACR_CACHE_LINE_SIZE)
+#endif
+
+#ifndef ACR_BUFFER_STREAMING_THRESHOLD
+/** this is used by ACR_BufferCopyStreaming() and ACR_BufferFillStreaming()
+    to decide when to write around the cpu cache with non-temporal
+	stores. smaller buffers are written with normal stores since they
+	fit in the cache without evicting everything else. set this to
+	about the size of the last level cache of the target cpu
+*/
+#define ACR_BUFFER_STREAMING_THRESHOLD (4*1024*1024)
+#endif
+
+#ifndef ACR_BUFFER_PARALLEL_THRESHOLD
+/** this is used by the parallel buffer functions. buffers smaller
+    than this are handled by the calling thread alone since handing
+	the work to other threads would take longer than the work itself
+*/
+#define ACR_BUFFER_PARALLEL_THRESHOLD (16*1024*1024)
+#endif
+
+#ifndef ACR_BUFFER_PARALLEL_ALIGN
+/** the parallel buffer functions split the work into chunks that
+    start on this boundary, which is the usual size of a memory
+	page, so that each page is only used by one thread
+*/
+#define ACR_BUFFER_PARALLEL_ALIGN 4096
+#endif
+
+#ifndef ACR_BUFFER_MAX_THREADS
+/** the max number of threads used by the parallel buffer functions
+    including the calling thread. this is also the number of
+	threads used when 0 is specified. the threads are started the
+	first time they are needed and are then reused by every call
+*/
+#define ACR_BUFFER_MAX_THREADS 8
+#endif
+
+/** type for a CRC-32 value using the same polynomial as
+    zip, png, and ethernet
+*/
+typedef unsigned long ACR_Crc32_t;
+
+/** function called by ACR_BufferForEachBlock() for the unaligned
+    bytes at the head and tail of the buffer
+	\param context the context passed to ACR_BufferForEachBlock()
+	\param bytes pointer to the first byte
+	\param length the number of bytes 1 to (ACR_BYTES_PER_BLOCK-1)
+	\returns ACR_INFO_OK to continue or ACR_INFO_STOP to stop early
+*/
+typedef ACR_Info_t (*ACR_BufferBytesFunc_t)(
+	void* context,
+	ACR_Byte_t* bytes,
+	ACR_Length_t length);
+
+/** function called by ACR_BufferForEachBlock() for the aligned
+    blocks in the body of the buffer
+	\param context the context passed to ACR_BufferForEachBlock()
+	\param blocks pointer to the first aligned block
+	\param count the number of blocks, which is always the
+	       blocksPerCall passed to ACR_BufferForEachBlock()
+		   except for the last call that may have less
+	\returns ACR_INFO_OK to continue or ACR_INFO_STOP to stop early
+*/
+typedef ACR_Info_t (*ACR_BufferBlocksFunc_t)(
+	void* context,
+	ACR_Block_t* blocks,
+	ACR_Length_t count);
+
 ////////////////////////////////////////////////////////////
 // ALLOW FUNCTIONS TO BE CALLED FROM C++                  //
 ////////////////////////////////////////////////////////////
@@ -152,6 +236,135 @@ void ACR_BufferShiftRight(
 	ACR_Buffer_t* me,
 	ACR_Length_t length);
 
+/** copy all of the data from src to the start of the buffer
+    without filling the cpu cache with the data when src is
+	at least ACR_BUFFER_STREAMING_THRESHOLD bytes
+	\param me the buffer
+	\param src the data to copy, which must not overlap the buffer
+	\returns ACR_INFO_OK or ACR_INFO_ERROR if the buffer is smaller
+	         than src
+
+	Note: the copy uses non-temporal stores when ACR_HAS_SSE2 is
+	      ACR_BOOL_TRUE. this is faster for very large buffers
+		  and keeps other data in the cache, but the data must
+		  be read from memory again if it is used right away
+*/
+ACR_Info_t ACR_BufferCopyStreaming(
+	ACR_Buffer_t* me,
+	ACR_Buffer_t* src);
+
+/** fill the entire buffer with a value without filling the
+    cpu cache when the buffer is at least
+	ACR_BUFFER_STREAMING_THRESHOLD bytes
+	\param me the buffer
+	\param value the value for every byte
+	\returns ACR_INFO_OK or ACR_INFO_ERROR
+	\see ACR_BufferCopyStreaming()
+*/
+ACR_Info_t ACR_BufferFillStreaming(
+	ACR_Buffer_t* me,
+	ACR_Byte_t value);
+
+/** copy all of the data from src to the start of the buffer
+    using several threads
+	\param me the buffer
+	\param src the data to copy, which must not overlap the buffer
+	\param threadCount the max number of threads including the
+	       calling thread. use 0 for ACR_BUFFER_MAX_THREADS
+	\returns ACR_INFO_OK or ACR_INFO_ERROR if the buffer is smaller
+	         than src
+
+	Note: buffers smaller than ACR_BUFFER_PARALLEL_THRESHOLD are
+	      copied by the calling thread. each thread uses
+		  ACR_BufferCopyStreaming() for its part of the buffer
+*/
+ACR_Info_t ACR_BufferCopyParallel(
+	ACR_Buffer_t* me,
+	ACR_Buffer_t* src,
+	ACR_Count_t threadCount);
+
+/** fill the entire buffer with a value using several threads
+	\param me the buffer
+	\param value the value for every byte
+	\param threadCount the max number of threads including the
+	       calling thread. use 0 for ACR_BUFFER_MAX_THREADS
+	\returns ACR_INFO_OK or ACR_INFO_ERROR
+	\see ACR_BufferCopyParallel()
+*/
+ACR_Info_t ACR_BufferFillParallel(
+	ACR_Buffer_t* me,
+	ACR_Byte_t value,
+	ACR_Count_t threadCount);
+
+/** compare the data in two buffers byte by byte using several threads
+	\param me the buffer
+	\param other the buffer to compare with
+	\param threadCount the max number of threads including the
+	       calling thread. use 0 for ACR_BUFFER_MAX_THREADS
+	\returns ACR_INFO_EQUAL, ACR_INFO_LESS if me is less than other,
+	         ACR_INFO_GREATER if me is greater than other, or
+			 ACR_INFO_ERROR
+
+	Note: when one buffer is the start of the other buffer, the
+	      shorter buffer is less
+*/
+ACR_Info_t ACR_BufferCompareParallel(
+	ACR_Buffer_t* me,
+	ACR_Buffer_t* other,
+	ACR_Count_t threadCount);
+
+/** calculate the CRC-32 of the data in the buffer using several
+    threads. each thread calculates the CRC-32 of one part of the
+	buffer 8 bytes at a time, or with carry-less multiply when
+	ACR_HAS_PCLMUL is true, and then the results are combined
+	\param me the buffer
+	\param threadCount the max number of threads including the
+	       calling thread. use 0 for ACR_BUFFER_MAX_THREADS
+	\param crc location to store the CRC-32 value
+	\returns ACR_INFO_OK or ACR_INFO_ERROR
+*/
+ACR_Info_t ACR_BufferCrc32Parallel(
+	ACR_Buffer_t* me,
+	ACR_Count_t threadCount,
+	ACR_Crc32_t* crc);
+
+/** walk the buffer one ACR_Block_t at a time by splitting it
+    into an unaligned head, a body of aligned blocks, and a tail
+	\see ACR_BlockSplit_t
+	\param me the buffer
+	\param bytesFunc called for the head bytes and then again for
+	       the tail bytes when there are any. use ACR_NULL to skip
+		   the head and tail
+	\param blocksFunc called for each group of blocks in the body
+	\param context passed to bytesFunc and blocksFunc as is
+	\param blocksPerCall the number of blocks passed to each call
+	       of blocksFunc. use 0 for ACR_BUFFER_BLOCKS_PER_CALL
+	\param prefetchDistance the number of bytes ahead of each group
+	       of blocks to prefetch. use ACR_BUFFER_PREFETCH_DISTANCE
+		   if unsure or 0 to disable the prefetch
+	\returns ACR_INFO_OK when the entire buffer was walked,
+	         ACR_INFO_STOP when a function stopped early, or
+			 ACR_INFO_ERROR
+
+	example:
+
+	ACR_Info_t CountBlocks(void* context, ACR_Block_t* blocks, ACR_Length_t count)
+	{
+		(*(ACR_Length_t*)context) += count;
+		return ACR_INFO_OK;
+	}
+
+	ACR_Length_t total = 0;
+	ACR_BufferForEachBlock(&buffer, ACR_NULL, CountBlocks, &total, 0, ACR_BUFFER_PREFETCH_DISTANCE);
+*/
+ACR_Info_t ACR_BufferForEachBlock(
+	ACR_Buffer_t* me,
+	ACR_BufferBytesFunc_t bytesFunc,
+	ACR_BufferBlocksFunc_t blocksFunc,
+	void* context,
+	ACR_Count_t blocksPerCall,
+	ACR_Length_t prefetchDistance);
+
 ////////////////////////////////////////////////////////////
 // ALLOW FUNCTIONS TO BE CALLED FROM C++                  //
 ////////////////////////////////////////////////////////////
@@ -160,4 +373,75 @@ void ACR_BufferShiftRight(
 #endif                                                    //
 ////////////////////////////////////////////////////////////
 
+#ifdef __cplusplus
+
+/** C++ version of ACR_BufferForEachBlock() where the functions
+    are inlined and the body loop is unrolled at compile time
+	\param BlocksPerLoop the number of blocks to unroll 1 to 8
+	\param buffer the buffer
+	\param bytesFunc called as bytesFunc(ACR_Byte_t* bytes, ACR_Length_t length)
+	       for the head bytes and then again for the tail bytes
+	\param blockFunc called as blockFunc(ACR_Block_t& block) for
+	       each aligned block in the body
+	\param prefetchDistance the number of bytes ahead to prefetch
+	       or 0 to disable the prefetch
+
+	example:
+
+	ACR_Block_t x = 0;
+	ACR_BufferForEachBlock<8>(buffer,
+		[&](ACR_Byte_t* bytes, ACR_Length_t length) { ... },
+		[&](ACR_Block_t& block) { x ^= block; });
+*/
+template<int BlocksPerLoop, typename BytesFunc, typename BlockFunc>
+inline void ACR_BufferForEachBlock(
+	ACR_Buffer_t& buffer,
+	BytesFunc bytesFunc,
+	BlockFunc blockFunc,
+	ACR_Length_t prefetchDistance = ACR_BUFFER_PREFETCH_DISTANCE)
+{
+	ACR_BlockSplit_t split;
+	ACR_Block_t* block;
+	ACR_Length_t remaining;
+	int i;
+
+	if(ACR_BUFFER_IS_VALID(buffer) == ACR_BOOL_FALSE)
+	{
+		return;
+	}
+
+	ACR_BLOCK_SPLIT(split, buffer.m_Pointer, buffer.m_Length);
+	if(split.m_HeadLength > 0)
+	{
+		bytesFunc(split.m_Head, split.m_HeadLength);
+	}
+	block = split.m_Body;
+	remaining = split.m_BodyBlocks;
+	while(remaining >= (ACR_Length_t)BlocksPerLoop)
+	{
+		if(prefetchDistance > 0)
+		{
+			ACR_PREFETCH(((ACR_Byte_t*)block) + prefetchDistance);
+		}
+		for(i = 0; i < BlocksPerLoop; i++)
+		{
+			blockFunc(block[i]);
+		}
+		block += BlocksPerLoop;
+		remaining -= BlocksPerLoop;
+	}
+	while(remaining > 0)
+	{
+		blockFunc((*block));
+		block++;
+		remaining--;
+	}
+	if(split.m_TailLength > 0)
+	{
+		bytesFunc(split.m_Tail, split.m_TailLength);
+	}
+}
+
+#endif // #ifdef __cplusplus
+
 #endif
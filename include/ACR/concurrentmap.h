@@ -0,0 +1,235 @@
+/*
+
+    ********** DO NOT REMOVE THIS INFORMATION ************
+
+    ACR - A set of C functions in a git Repository
+    Copyright (C) 2018 - 2020 Adam C. Rosenberg
+
+    Please read LICENSE before using this code
+
+    Please read README.md for instructions on including
+    this code in your project and where to find examples
+
+    If you contribute to this code, Please add your name
+    and email address to the AUTHORS list below so that
+    we know who to thank!
+
+    AUTHORS
+
+    Adam Rosenberg <adam@sirspot.com>
+
+    LICENSE
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+    ******************************************************
+
+*/
+/** \file concurrentmap.h
+
+    functions for access to the ACR_ConcurrentMap_t type
+
+    a hash map of ACR_String_t keys to values of a fixed size
+    that many threads can use at the same time:
+
+    - the keys are split between shards by the high bits of
+      their hash, and each shard has its own lock for writers
+      so writers of different shards do not wait for each
+      other
+    - readers do not lock. each shard has a sequence number
+      that writers make odd while they change the shard, and
+      a reader that sees the number change while it reads
+      tries again. a reader that keeps failing reads with the
+      lock so it cannot starve
+    - a shard grows by filling in a larger table while its
+      readers keep using the current one, so growing never
+      stops the other shards or the readers
+    - entry and table memory is only freed by
+      ACR_ConcurrentMapDeInit(), so a reader never touches
+      freed memory. removed entries are reused by later keys
+      of a similar length
+
+    Note: when ACR_NO_THREADS is defined the map works the
+          same way without locks for a single thread
+
+*/
+#ifndef _ACR_CONCURRENTMAP_H_
+#define _ACR_CONCURRENTMAP_H_
+
+#include "ACR/public.h"
+
+////////////////////////////////////////////////////////////
+//
+// TYPES AND DEFINES
+//
+////////////////////////////////////////////////////////////
+
+/** the number of shards when 0 is given to
+    ACR_ConcurrentMapInit()
+*/
+#define ACR_CONCURRENT_MAP_DEFAULT_SHARDS 64
+
+/** the most shards a map can have
+*/
+#define ACR_CONCURRENT_MAP_MAX_SHARDS 256
+
+#ifndef ACR_CONCURRENT_MAP_BLOCK_LENGTH
+/** the number of bytes allocated at a time for the entries
+    of a shard. entries that are larger get a block of their
+    own
+*/
+#define ACR_CONCURRENT_MAP_BLOCK_LENGTH 16384
+#endif
+
+#ifdef ACR_COMPILER_VS2017
+#pragma warning(push)
+// disable warning C4820: padding added after data member
+#pragma warning(disable:4820)
+#endif
+/** type for a concurrent hash map
+*/
+typedef struct ACR_ConcurrentMap_s
+{
+	/** the memory of the shards
+	*/
+	void* m_Memory;
+
+	/** the first shard, which is aligned to a cache line
+	*/
+	void* m_Shards;
+
+	/** the number of bytes from one shard to the next
+	*/
+	ACR_Length_t m_ShardLength;
+
+	/** the number of bytes of each value
+	*/
+	ACR_Length_t m_ValueLength;
+
+	/** the number of shards, which is a power of 2
+	*/
+	ACR_Count_t m_ShardCount;
+} ACR_ConcurrentMap_t;
+#ifdef ACR_COMPILER_VS2017
+#pragma warning(pop)
+#endif
+
+////////////////////////////////////////////////////////////
+// ALLOW FUNCTIONS TO BE CALLED FROM C++                  //
+////////////////////////////////////////////////////////////
+#ifdef __cplusplus                                        //
+extern "C" {                                              //
+#endif                                                    //
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+//
+// PUBLIC FUNCTIONS
+//
+////////////////////////////////////////////////////////////
+
+/** prepare a concurrent map before any thread uses it
+	\param me the map
+	\param valueLength the number of bytes of each value,
+	       which can be 0 for a set of keys
+	\param shardCount the number of shards, which is rounded
+	       up to a power of 2 up to
+		   ACR_CONCURRENT_MAP_MAX_SHARDS, or 0 for
+		   ACR_CONCURRENT_MAP_DEFAULT_SHARDS. a few times the
+		   number of writer threads is a good choice
+	\returns ACR_INFO_OK or ACR_INFO_ERROR if memory could not
+	         be allocated
+*/
+ACR_Info_t ACR_ConcurrentMapInit(
+	ACR_ConcurrentMap_t* me,
+	ACR_Length_t valueLength,
+	ACR_Count_t shardCount);
+
+/** free concurrent map memory after every thread is done
+    using it
+*/
+void ACR_ConcurrentMapDeInit(
+	ACR_ConcurrentMap_t* me);
+
+/** find a key and copy its value
+	\param me the map
+	\param key the key
+	\param value location to copy the value to or ACR_NULL
+	\returns ACR_INFO_OK or ACR_INFO_UNKNOWN if not found
+*/
+ACR_Info_t ACR_ConcurrentMapFind(
+	const ACR_ConcurrentMap_t* me,
+	ACR_String_t key,
+	void* value);
+
+/** add a key or replace the value of a key that is already
+    there
+	\param me the map
+	\param key the key, which is copied into the map
+	\param value the value to copy into the map or ACR_NULL
+	       for a value of zeros
+	\returns - ACR_INFO_NEW if the key was added
+	         - ACR_INFO_OLD if the value was replaced
+	         - ACR_INFO_ERROR if memory could not be allocated
+*/
+ACR_Info_t ACR_ConcurrentMapSet(
+	ACR_ConcurrentMap_t* me,
+	ACR_String_t key,
+	const void* value);
+
+/** add a key only if it is not already there
+	\param me the map
+	\param key the key, which is copied into the map
+	\param value the value to copy into the map or ACR_NULL
+	       for a value of zeros
+	\returns - ACR_INFO_NEW if the key was added
+	         - ACR_INFO_OLD if the key was already there and
+			   its value was not changed
+	         - ACR_INFO_ERROR if memory could not be allocated
+*/
+ACR_Info_t ACR_ConcurrentMapAdd(
+	ACR_ConcurrentMap_t* me,
+	ACR_String_t key,
+	const void* value);
+
+/** remove a key
+	\param me the map
+	\param key the key
+	\returns ACR_INFO_OK or ACR_INFO_UNKNOWN if not found
+*/
+ACR_Info_t ACR_ConcurrentMapRemove(
+	ACR_ConcurrentMap_t* me,
+	ACR_String_t key);
+
+/** get the number of keys
+
+	Note: the count of each shard is read at a different
+	      time, so it may be off while other threads add and
+		  remove keys
+	\param me the map
+	\returns the number of keys
+*/
+ACR_Count_t ACR_ConcurrentMapCount(
+	const ACR_ConcurrentMap_t* me);
+
+////////////////////////////////////////////////////////////
+// ALLOW FUNCTIONS TO BE CALLED FROM C++                  //
+////////////////////////////////////////////////////////////
+#ifdef __cplusplus                                        //
+}                                                         //
+#endif                                                    //
+////////////////////////////////////////////////////////////
+
+#endif
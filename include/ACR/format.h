@@ -0,0 +1,187 @@
+/*
+
+    ********** DO NOT REMOVE THIS INFORMATION ************
+
+    ACR - A set of C functions in a git Repository
+    Copyright (C) 2018 - 2020 Adam C. Rosenberg
+
+    Please read LICENSE before using this code
+
+    Please read README.md for instructions on including
+    this code in your project and where to find examples
+
+    If you contribute to this code, Please add your name
+    and email address to the AUTHORS list below so that
+    we know who to thank!
+
+    AUTHORS
+
+    Adam Rosenberg <adam@sirspot.com>
+
+    LICENSE
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+    ******************************************************
+
+*/
+/** \file format.h
+
+    printf style formatting where the format text is
+    compiled once into a list of segments and the text is
+    added to an ACR_VarBuffer_t without using the locale
+
+    Note: these functions are only available when
+          ACR_USE_64BIT is ACR_BOOL_TRUE
+
+*/
+#ifndef _ACR_FORMAT_H_
+#define _ACR_FORMAT_H_
+
+#include "ACR/number.h"
+
+#include <stdarg.h>
+
+#if ACR_USE_64BIT == ACR_BOOL_TRUE
+
+////////////////////////////////////////////////////////////
+//
+// TYPES AND DEFINES
+//
+////////////////////////////////////////////////////////////
+
+#ifdef ACR_COMPILER_VS2017
+#pragma warning(push)
+// disable warning C4820: padding added after data member
+#pragma warning(disable:4820)
+#endif
+
+/** type for a compiled format
+
+	Note: the format text is referenced and not copied so it
+	      must not change while it is used by the format
+*/
+typedef struct ACR_Format_s
+{
+	ACR_String_t m_Text;
+	ACR_Buffer_t m_Segments;
+	ACR_Count_t m_SegmentCount;
+	ACR_Length_t m_LiteralLength;
+} ACR_Format_t;
+
+#ifdef ACR_COMPILER_VS2017
+#pragma warning(pop)
+#endif
+
+////////////////////////////////////////////////////////////
+// ALLOW FUNCTIONS TO BE CALLED FROM C++                  //
+////////////////////////////////////////////////////////////
+#ifdef __cplusplus                                        //
+extern "C" {                                              //
+#endif                                                    //
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+//
+// PUBLIC FUNCTIONS
+//
+////////////////////////////////////////////////////////////
+
+/** prepare a format
+*/
+void ACR_FormatInit(
+	ACR_Format_t* me);
+
+/** free format memory
+*/
+void ACR_FormatDeInit(
+	ACR_Format_t* me);
+
+/** compile format text so that it only needs to be read
+    once instead of every time it is used
+
+	Note: each conversion is "%" followed by optional flags
+	      "-" to align left, "0" to pad integers with zeros,
+		  and "+" to show the sign of positive integers, an
+		  optional width, an optional "." and precision, an
+		  optional size of "hh", "h", "l", "ll", or "z" for
+		  integers, and a type
+	      - "d" or "i" for a signed integer
+		  - "u" for an unsigned integer
+		  - "x" or "X" for an unsigned integer in hex
+		  - "c" for a single byte
+		  - "s" for null-terminated text where the precision
+		    is the most bytes to use
+		  - "S" for an ACR_String_t where the precision is
+		    the most UTF8 characters to use, so a character
+			is never split
+		  - "I" for the name of an ACR_Info_t, which is the
+		    name of ACR_INFO_UNKNOWN for values that are not
+			in the enum
+		  - "g" for a double with the shortest text that
+		    converts back to the same value
+		    \see ACR_VarBufferAppendDouble()
+		  - "%" for a "%"
+		  the precision of an integer is the least number of
+		  digits and the "0" flag is ignored when there is a
+		  precision, the same as printf. the width and
+		  precision can be "*" to take them from an int
+		  argument before the value
+	\param me the format
+	\param text the format text
+	\returns ACR_INFO_OK, ACR_INFO_INVALID if the text has a
+	         conversion that is not supported, or
+			 ACR_INFO_ERROR if memory could not be allocated
+*/
+ACR_Info_t ACR_FormatCompile(
+	ACR_Format_t* me,
+	ACR_String_t text);
+
+/** add the text for the arguments to the end of the buffer
+
+	Note: the length of the text is found before any of it is
+	      written so the buffer grows at most once
+	\param me the compiled format
+	\param buffer the buffer
+	\param ... the arguments for the conversions
+	\returns ACR_INFO_OK or ACR_INFO_ERROR
+*/
+ACR_Info_t ACR_FormatAppend(
+	const ACR_Format_t* me,
+	ACR_VarBuffer_t* buffer,
+	...);
+
+/** the same as ACR_FormatAppend() with a va_list
+	\param me the compiled format
+	\param buffer the buffer
+	\param args the arguments for the conversions
+	\returns ACR_INFO_OK or ACR_INFO_ERROR
+*/
+ACR_Info_t ACR_FormatAppendList(
+	const ACR_Format_t* me,
+	ACR_VarBuffer_t* buffer,
+	va_list args);
+
+////////////////////////////////////////////////////////////
+// ALLOW FUNCTIONS TO BE CALLED FROM C++                  //
+////////////////////////////////////////////////////////////
+#ifdef __cplusplus                                        //
+}                                                         //
+#endif                                                    //
+////////////////////////////////////////////////////////////
+
+#endif // #if ACR_USE_64BIT == ACR_BOOL_TRUE
+
+#endif
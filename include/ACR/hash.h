@@ -0,0 +1,260 @@
+/*
+
+    ********** DO NOT REMOVE THIS INFORMATION ************
+
+    ACR - A set of C functions in a git Repository
+    Copyright (C) 2018 - 2020 Adam C. Rosenberg
+
+    Please read LICENSE before using this code
+
+    Please read README.md for instructions on including
+    this code in your project and where to find examples
+
+    If you contribute to this code, Please add your name
+    and email address to the AUTHORS list below so that
+    we know who to thank!
+
+    AUTHORS
+
+    Adam Rosenberg <adam@sirspot.com>
+
+    LICENSE
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+    ******************************************************
+
+*/
+/** \file hash.h
+
+    fast non-cryptographic 64bit and 128bit hashes of memory,
+    buffers, and strings for hash tables and sharding
+
+    the hash is in the style of wyhash and XXH3 but does not
+    produce the same values as either of them:
+
+    - keys up to 16 bytes are read with at most four loads
+      and mixed with one 128bit multiply
+    - keys up to ACR_HASH_LONG_LENGTH bytes are mixed 48
+      bytes at a time with three independent multiplies
+    - longer keys are accumulated 64 bytes at a time in eight
+      lanes with SSE2 when ACR_HAS_SSE2 is ACR_BOOL_TRUE. the
+      portable code gives the same values
+    - data that arrives in chunks can be hashed with
+      ACR_HashInit(), ACR_HashUpdate(), and ACR_HashFinal64()
+      or ACR_HashFinal128() and gives the same values as
+      hashing all of the data at once
+
+    the values are the same on every platform and do not
+    depend on the byte order, so they can be stored and used
+    for sharding between machines
+
+    Note: these functions are only available when
+          ACR_USE_64BIT is ACR_BOOL_TRUE
+
+*/
+#ifndef _ACR_HASH_H_
+#define _ACR_HASH_H_
+
+#include "ACR/public.h"
+
+#if ACR_USE_64BIT == ACR_BOOL_TRUE
+
+////////////////////////////////////////////////////////////
+//
+// TYPES AND DEFINES
+//
+////////////////////////////////////////////////////////////
+
+/** the longest data that is hashed without the lanes used
+    for long data
+*/
+#define ACR_HASH_LONG_LENGTH 256
+
+/** the number of bytes accumulated by the lanes at a time
+*/
+#define ACR_HASH_STRIPE_LENGTH 64
+
+/** type for a 64bit hash value
+*/
+typedef unsigned long long ACR_Hash64_t;
+
+/** type for a 128bit hash value
+*/
+typedef struct ACR_Hash128_s
+{
+	ACR_Hash64_t m_Low;
+	ACR_Hash64_t m_High;
+} ACR_Hash128_t;
+
+#ifdef ACR_COMPILER_VS2017
+#pragma warning(push)
+// disable warning C4820: padding added after data member
+#pragma warning(disable:4820)
+#endif
+/** type for hashing data that arrives in chunks
+*/
+typedef struct ACR_HashState_s
+{
+	/** the lanes for long data
+	*/
+	ACR_Hash64_t m_Lanes[8];
+
+	/** the keys of the lanes with the seed mixed in
+	*/
+	ACR_Hash64_t m_Secret[48];
+
+	/** the data that has not been accumulated yet. the data
+	    of a full buffer is only accumulated once more data
+	    arrives so that the last stripe is always here
+	*/
+	ACR_Byte_t m_Buffer[ACR_HASH_LONG_LENGTH];
+
+	/** the seed
+	*/
+	ACR_Hash64_t m_Seed;
+
+	/** the number of bytes hashed so far
+	*/
+	ACR_Length_t m_Length;
+
+	/** the number of bytes in m_Buffer
+	*/
+	ACR_Length_t m_BufferUsed;
+
+	/** the number of stripes accumulated since the lanes
+	    were last scrambled
+	*/
+	ACR_Count_t m_Stripes;
+} ACR_HashState_t;
+#ifdef ACR_COMPILER_VS2017
+#pragma warning(pop)
+#endif
+
+////////////////////////////////////////////////////////////
+// ALLOW FUNCTIONS TO BE CALLED FROM C++                  //
+////////////////////////////////////////////////////////////
+#ifdef __cplusplus                                        //
+extern "C" {                                              //
+#endif                                                    //
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+//
+// PUBLIC FUNCTIONS
+//
+////////////////////////////////////////////////////////////
+
+/** get the 64bit hash of data in memory
+	\param src the data, which can be ACR_NULL when length
+	       is 0
+	\param length the number of bytes
+	\param seed a value that changes every hash, such as a
+	       random value chosen when a table is created, or 0
+	\returns the hash
+*/
+ACR_Hash64_t ACR_Hash64(
+	const ACR_Byte_t* src,
+	ACR_Length_t length,
+	ACR_Hash64_t seed);
+
+/** get the 128bit hash of data in memory
+	\param src the data, which can be ACR_NULL when length
+	       is 0
+	\param length the number of bytes
+	\param seed a value that changes every hash or 0
+	\returns the hash
+*/
+ACR_Hash128_t ACR_Hash128(
+	const ACR_Byte_t* src,
+	ACR_Length_t length,
+	ACR_Hash64_t seed);
+
+/** get the 64bit hash of the data in a buffer
+	\param src the buffer
+	\param seed a value that changes every hash or 0
+	\returns the hash
+*/
+ACR_Hash64_t ACR_HashBuffer(
+	ACR_Buffer_t src,
+	ACR_Hash64_t seed);
+
+/** get the 64bit hash of a string
+
+	Note: when case is ignored the hash is the same as the
+	      hash of the string after each character is
+		  replaced with ACR_UnicodeFold(), so strings that
+		  ACR_StringCompareToMemory() finds equal when
+		  ignoring case have the same hash. the folded
+		  characters are hashed in chunks without allocating
+		  memory
+	\param src the string
+	\param caseSensitive ACR_INFO_NO to ignore case or
+	       ACR_INFO_YES
+	\param seed a value that changes every hash or 0
+	\returns the hash
+*/
+ACR_Hash64_t ACR_HashString(
+	ACR_String_t src,
+	ACR_Info_t caseSensitive,
+	ACR_Hash64_t seed);
+
+/** prepare to hash data that arrives in chunks
+	\param me the state
+	\param seed a value that changes every hash or 0
+*/
+void ACR_HashInit(
+	ACR_HashState_t* me,
+	ACR_Hash64_t seed);
+
+/** hash the next chunk of data
+	\param me the state
+	\param src the data, which can be ACR_NULL when length
+	       is 0
+	\param length the number of bytes
+*/
+void ACR_HashUpdate(
+	ACR_HashState_t* me,
+	const ACR_Byte_t* src,
+	ACR_Length_t length);
+
+/** get the 64bit hash of all of the chunks so far, which is
+    the same as ACR_Hash64() of all of the data at once. more
+	chunks can be hashed after this
+	\param me the state
+	\returns the hash
+*/
+ACR_Hash64_t ACR_HashFinal64(
+	const ACR_HashState_t* me);
+
+/** get the 128bit hash of all of the chunks so far, which
+    is the same as ACR_Hash128() of all of the data at once
+	\param me the state
+	\returns the hash
+*/
+ACR_Hash128_t ACR_HashFinal128(
+	const ACR_HashState_t* me);
+
+////////////////////////////////////////////////////////////
+// ALLOW FUNCTIONS TO BE CALLED FROM C++                  //
+////////////////////////////////////////////////////////////
+#ifdef __cplusplus                                        //
+}                                                         //
+#endif                                                    //
+////////////////////////////////////////////////////////////
+
+#endif // #if ACR_USE_64BIT == ACR_BOOL_TRUE
+
+#endif
@@ -0,0 +1,326 @@
+/*
+
+    ********** DO NOT REMOVE THIS INFORMATION ************
+
+    ACR - A set of C functions in a git Repository
+    Copyright (C) 2018 - 2020 Adam C. Rosenberg
+
+    Please read LICENSE before using this code
+
+    Please read README.md for instructions on including
+    this code in your project and where to find examples
+
+    If you contribute to this code, Please add your name
+    and email address to the AUTHORS list below so that
+    we know who to thank!
+
+    AUTHORS
+
+    Adam Rosenberg <adam@sirspot.com>
+
+    LICENSE
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+    ******************************************************
+
+*/
+/** \file hashmap.h
+
+    functions for access to the ACR_HashMap_t type
+
+    a hash map of integer or ACR_String_t keys to values of a
+    fixed size stored in the map. it is a swiss table:
+
+    - slots are in groups of ACR_HASHMAP_GROUP_SIZE with one
+      control byte per slot that is either empty or 7 bits
+      of the hash of the key in the slot
+    - a lookup checks all of the control bytes of a group at
+      once, with SSE2 when ACR_HAS_SSE2 is ACR_BOOL_TRUE, and
+      only compares the keys whose 7 bits match
+    - each group counts the keys that were placed after it
+      because it was full, so lookups stop at the first group
+      with a count of 0 and removing a key leaves an empty
+      slot instead of a tombstone
+    - string keys are copied into memory of the map so that
+      the caller does not need to keep them
+
+*/
+#ifndef _ACR_HASHMAP_H_
+#define _ACR_HASHMAP_H_
+
+#include "ACR/public.h"
+
+////////////////////////////////////////////////////////////
+//
+// TYPES AND DEFINES
+//
+////////////////////////////////////////////////////////////
+
+/** the number of slots whose control bytes are checked at
+    the same time
+*/
+#define ACR_HASHMAP_GROUP_SIZE 16
+
+/** the most keys per ACR_HASHMAP_GROUP_SIZE slots before
+    the map grows
+*/
+#define ACR_HASHMAP_MAX_LOAD 14
+
+/** values are aligned to this many bytes in the map
+*/
+#define ACR_HASHMAP_VALUE_ALIGN 8
+
+/** the kinds of keys of a map
+*/
+enum ACR_HashMapKeys_e
+{
+	ACR_HASHMAP_KEYS_INTEGER = 0,
+	ACR_HASHMAP_KEYS_STRING
+};
+
+#ifdef ACR_COMPILER_VS2017
+#pragma warning(push)
+// disable warning C4820: padding added after data member
+#pragma warning(disable:4820)
+#endif
+/** type for a hash map
+*/
+typedef struct ACR_HashMap_s
+{
+	/** the control bytes, the group overflow counts, and the
+	    slots
+	*/
+	ACR_Buffer_t m_Memory;
+
+	/** the bytes of the string keys
+	*/
+	ACR_Buffer_t m_Keys;
+
+	/** the number of bytes used in m_Keys including the keys
+	    that were removed
+	*/
+	ACR_Length_t m_KeysUsed;
+
+	/** the number of bytes in m_Keys of removed keys, which
+	    are reused when the map grows
+	*/
+	ACR_Length_t m_KeysRemoved;
+
+	/** the number of bytes of each slot
+	*/
+	ACR_Length_t m_SlotLength;
+
+	/** the number of bytes of each value
+	*/
+	ACR_Length_t m_ValueLength;
+
+	/** the number of keys in the map
+	*/
+	ACR_Count_t m_Count;
+
+	/** the number of slots, which is 0 or a power of 2 that
+	    is at least ACR_HASHMAP_GROUP_SIZE
+	*/
+	ACR_Count_t m_Capacity;
+
+	/** the kind of keys, see enum ACR_HashMapKeys_e
+	*/
+	int m_KeyType;
+} ACR_HashMap_t;
+#ifdef ACR_COMPILER_VS2017
+#pragma warning(pop)
+#endif
+
+////////////////////////////////////////////////////////////
+// ALLOW FUNCTIONS TO BE CALLED FROM C++                  //
+////////////////////////////////////////////////////////////
+#ifdef __cplusplus                                        //
+extern "C" {                                              //
+#endif                                                    //
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+//
+// PUBLIC FUNCTIONS
+//
+////////////////////////////////////////////////////////////
+
+/** prepare a hash map
+	\param me the map
+	\param keyType ACR_HASHMAP_KEYS_INTEGER or
+	       ACR_HASHMAP_KEYS_STRING
+	\param valueLength the number of bytes of each value,
+	       which can be 0 for a set of keys
+*/
+void ACR_HashMapInit(
+	ACR_HashMap_t* me,
+	int keyType,
+	ACR_Length_t valueLength);
+
+/** free hash map memory
+*/
+void ACR_HashMapDeInit(
+	ACR_HashMap_t* me);
+
+/** remove every key without freeing memory
+*/
+void ACR_HashMapClear(
+	ACR_HashMap_t* me);
+
+/** make room for a number of keys so that adding them does
+    not grow the map
+	\param me the map
+	\param count the number of keys
+	\returns ACR_INFO_OK or ACR_INFO_ERROR if memory could not
+	         be allocated
+*/
+ACR_Info_t ACR_HashMapReserve(
+	ACR_HashMap_t* me,
+	ACR_Count_t count);
+
+/** add an integer key or find it if it is already there
+
+	Note: the value pointer is valid until the next key is
+	      added or memory is reserved
+	\param me a map with ACR_HASHMAP_KEYS_INTEGER
+	\param key the key
+	\param value location to store a pointer to the value
+	       in the map, which is filled with zeros when the
+		   key is new, or ACR_NULL
+	\returns - ACR_INFO_NEW if the key was added
+	         - ACR_INFO_OLD if the key was already there
+	         - ACR_INFO_ERROR if memory could not be allocated
+*/
+ACR_Info_t ACR_HashMapAddInteger(
+	ACR_HashMap_t* me,
+	ACR_Length_t key,
+	void** value);
+
+/** find an integer key
+	\param me a map with ACR_HASHMAP_KEYS_INTEGER
+	\param key the key
+	\param value location to store a pointer to the value
+	       in the map or ACR_NULL
+	\returns ACR_INFO_OK or ACR_INFO_UNKNOWN if not found
+*/
+ACR_Info_t ACR_HashMapFindInteger(
+	const ACR_HashMap_t* me,
+	ACR_Length_t key,
+	void** value);
+
+/** remove an integer key
+	\param me a map with ACR_HASHMAP_KEYS_INTEGER
+	\param key the key
+	\returns ACR_INFO_OK or ACR_INFO_UNKNOWN if not found
+*/
+ACR_Info_t ACR_HashMapRemoveInteger(
+	ACR_HashMap_t* me,
+	ACR_Length_t key);
+
+/** add a string key or find it if it is already there
+
+	Note: the key bytes are copied into the map the first
+	      time. the keys are compared byte by byte, so use
+		  normalized strings if different byte sequences
+		  should be the same key
+	\param me a map with ACR_HASHMAP_KEYS_STRING
+	\param key the key
+	\param value location to store a pointer to the value
+	       in the map, which is filled with zeros when the
+		   key is new, or ACR_NULL
+	\returns - ACR_INFO_NEW if the key was added
+	         - ACR_INFO_OLD if the key was already there
+	         - ACR_INFO_ERROR if memory could not be allocated
+*/
+ACR_Info_t ACR_HashMapAddString(
+	ACR_HashMap_t* me,
+	ACR_String_t key,
+	void** value);
+
+/** find a string key
+	\param me a map with ACR_HASHMAP_KEYS_STRING
+	\param key the key
+	\param value location to store a pointer to the value
+	       in the map or ACR_NULL
+	\returns ACR_INFO_OK or ACR_INFO_UNKNOWN if not found
+*/
+ACR_Info_t ACR_HashMapFindString(
+	const ACR_HashMap_t* me,
+	ACR_String_t key,
+	void** value);
+
+/** remove a string key
+	\param me a map with ACR_HASHMAP_KEYS_STRING
+	\param key the key
+	\returns ACR_INFO_OK or ACR_INFO_UNKNOWN if not found
+*/
+ACR_Info_t ACR_HashMapRemoveString(
+	ACR_HashMap_t* me,
+	ACR_String_t key);
+
+/** get the next key of an integer map in no order
+
+    example:
+
+	ACR_Count_t position = 0;
+	ACR_Length_t key;
+	void* value;
+	while(ACR_HashMapNextInteger(&map, &position, &key, &value) == ACR_INFO_OK)
+	{
+		// use key and value
+	}
+	\param me a map with ACR_HASHMAP_KEYS_INTEGER
+	\param position the slot to start looking at, which is
+	       moved past the key that is found. start at 0
+	\param key location to store the key
+	\param value location to store a pointer to the value or
+	       ACR_NULL
+	\returns ACR_INFO_OK or ACR_INFO_END when there are no
+	         more keys
+*/
+ACR_Info_t ACR_HashMapNextInteger(
+	const ACR_HashMap_t* me,
+	ACR_Count_t* position,
+	ACR_Length_t* key,
+	void** value);
+
+/** get the next key of a string map in no order
+	\param me a map with ACR_HASHMAP_KEYS_STRING
+	\param position the slot to start looking at, which is
+	       moved past the key that is found. start at 0
+	\param key location to store a reference to the key in
+	       the map, which is valid until the next key is
+		   added or memory is reserved
+	\param value location to store a pointer to the value or
+	       ACR_NULL
+	\returns ACR_INFO_OK or ACR_INFO_END when there are no
+	         more keys
+*/
+ACR_Info_t ACR_HashMapNextString(
+	const ACR_HashMap_t* me,
+	ACR_Count_t* position,
+	ACR_String_t* key,
+	void** value);
+
+////////////////////////////////////////////////////////////
+// ALLOW FUNCTIONS TO BE CALLED FROM C++                  //
+////////////////////////////////////////////////////////////
+#ifdef __cplusplus                                        //
+}                                                         //
+#endif                                                    //
+////////////////////////////////////////////////////////////
+
+#endif
@@ -0,0 +1,143 @@
+/*
+
+    ********** DO NOT REMOVE THIS INFORMATION ************
+
+    ACR - A set of C functions in a git Repository
+    Copyright (C) 2018 - 2020 Adam C. Rosenberg
+
+    Please read LICENSE before using this code
+
+    Please read README.md for instructions on including
+    this code in your project and where to find examples
+
+    If you contribute to this code, Please add your name
+    and email address to the AUTHORS list below so that
+    we know who to thank!
+
+    AUTHORS
+
+    Adam Rosenberg <adam@sirspot.com>
+
+    LICENSE
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+    ******************************************************
+
+*/
+/** \file normalize.h
+
+    unicode normalization of UTF8 strings to NFC (composed)
+    or NFD (decomposed) form so that canonically equivalent
+    strings have the same bytes. for example "e" followed by
+    U+0301 COMBINING ACUTE ACCENT and U+00E9 are the same
+    character
+
+*/
+#ifndef _ACR_NORMALIZE_H_
+#define _ACR_NORMALIZE_H_
+
+#include "ACR/varbuffer.h"
+
+////////////////////////////////////////////////////////////
+//
+// TYPES AND DEFINES
+//
+////////////////////////////////////////////////////////////
+
+/** unicode normalization forms
+*/
+typedef enum ACR_NormalForm_e
+{
+	/** canonical decomposition followed by canonical
+	    composition, which is the shortest form and the
+		form most text is already in
+	*/
+	ACR_NORMAL_FORM_NFC = 0,
+
+	/** canonical decomposition
+	*/
+	ACR_NORMAL_FORM_NFD
+
+} ACR_NormalForm_t;
+
+////////////////////////////////////////////////////////////
+// ALLOW FUNCTIONS TO BE CALLED FROM C++                  //
+////////////////////////////////////////////////////////////
+#ifdef __cplusplus                                        //
+extern "C" {                                              //
+#endif                                                    //
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+//
+// PUBLIC FUNCTIONS
+//
+////////////////////////////////////////////////////////////
+
+/** check if a string is normalized without changing it
+	\param src the UTF8 string to check
+	\param form ACR_NORMAL_FORM_NFC or ACR_NORMAL_FORM_NFD
+	\returns - ACR_INFO_YES if src is normalized
+	         - ACR_INFO_NO if src is not normalized
+	         - ACR_INFO_UNKNOWN if src has characters that may
+	           compose with the character before them, so only
+	           ACR_StringNormalize() can tell
+	         - ACR_INFO_INVALID if src is not valid UTF8
+
+	Note: this is the quick check algorithm from unicode
+	      standard annex #15. bytes that can only be part of
+		  characters below U+0300 for NFC or U+00C0 for NFD
+		  are skipped 16 bytes at a time with SSE2 or one
+		  block at a time otherwise
+*/
+ACR_Info_t ACR_StringIsNormalized(
+	ACR_String_t src,
+	ACR_NormalForm_t form);
+
+/** normalize a string
+	\param src the UTF8 string to normalize
+	\param form ACR_NORMAL_FORM_NFC or ACR_NORMAL_FORM_NFD
+	\param dst a buffer for the normalized string if src is not
+	       already normalized. the normalized string is added to
+		   the end of the buffer and the buffer grows if needed
+	\param result location to store a reference to the
+	       normalized string
+	\returns - ACR_INFO_EQUAL if src is already normalized, then
+	           result references the memory of src and nothing
+	           is added to dst
+	         - ACR_INFO_NOT_EQUAL if the normalized string is
+	           different, then result references the memory
+	           added to the end of dst
+	         - ACR_INFO_INVALID if src is not valid UTF8
+	         - ACR_INFO_ERROR if memory could not be allocated
+
+	Note: result is only valid until dst is changed again
+*/
+ACR_Info_t ACR_StringNormalize(
+	ACR_String_t src,
+	ACR_NormalForm_t form,
+	ACR_VarBuffer_t* dst,
+	ACR_String_t* result);
+
+////////////////////////////////////////////////////////////
+// ALLOW FUNCTIONS TO BE CALLED FROM C++                  //
+////////////////////////////////////////////////////////////
+#ifdef __cplusplus                                        //
+}                                                         //
+#endif                                                    //
+////////////////////////////////////////////////////////////
+
+#endif
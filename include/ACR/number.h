@@ -0,0 +1,244 @@
+/*
+
+    ********** DO NOT REMOVE THIS INFORMATION ************
+
+    ACR - A set of C functions in a git Repository
+    Copyright (C) 2018 - 2020 Adam C. Rosenberg
+
+    Please read LICENSE before using this code
+
+    Please read README.md for instructions on including
+    this code in your project and where to find examples
+
+    If you contribute to this code, Please add your name
+    and email address to the AUTHORS list below so that
+    we know who to thank!
+
+    AUTHORS
+
+    Adam Rosenberg <adam@sirspot.com>
+
+    LICENSE
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+    ******************************************************
+
+*/
+/** \file number.h
+
+    conversion between numbers and their text in UTF8
+    strings without copying and without using the locale,
+    so "." is always the decimal point
+
+    Note: these functions are only available when
+          ACR_USE_64BIT is ACR_BOOL_TRUE
+
+*/
+#ifndef _ACR_NUMBER_H_
+#define _ACR_NUMBER_H_
+
+#include "ACR/varbuffer.h"
+
+#if ACR_USE_64BIT == ACR_BOOL_TRUE
+
+////////////////////////////////////////////////////////////
+//
+// TYPES AND DEFINES
+//
+////////////////////////////////////////////////////////////
+
+/** type for a signed 64 bit integer
+*/
+typedef long long ACR_Int64_t;
+
+/** type for an unsigned 64 bit integer
+*/
+typedef unsigned long long ACR_UInt64_t;
+
+/** max value that can be stored by the ACR_Int64_t type
+*/
+#define ACR_INT64_MAX 9223372036854775807LL
+
+/** min value that can be stored by the ACR_Int64_t type
+*/
+#define ACR_INT64_MIN (-ACR_INT64_MAX - 1)
+
+/** max value that can be stored by the ACR_UInt64_t type
+*/
+#define ACR_UINT64_MAX 18446744073709551615ULL
+
+/** the most bytes that the ACR_VarBufferAppend functions
+    for numbers write, which they make sure are available
+	in the buffer before writing
+*/
+#define ACR_NUMBER_TEXT_MAX_LENGTH 32
+
+////////////////////////////////////////////////////////////
+// ALLOW FUNCTIONS TO BE CALLED FROM C++                  //
+////////////////////////////////////////////////////////////
+#ifdef __cplusplus                                        //
+extern "C" {                                              //
+#endif                                                    //
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+//
+// PUBLIC FUNCTIONS - PARSE
+//
+////////////////////////////////////////////////////////////
+
+/** get the signed integer at the start of a string
+
+	Note: the text is an optional "+" or "-" followed by
+	      decimal digits. white space is not skipped and
+		  the number ends at the first byte that is not a
+		  digit. digits are converted 8 at a time
+	\param string the UTF8 string
+	\param value location to store the value, which is set
+	       to the nearest value that fits when the number
+		   is out of range
+	\param consumed location to store the number of bytes
+	       used by the number or ACR_NULL
+	\returns - ACR_INFO_OK if the value was found
+	         - ACR_INFO_GREATER if the number is more than
+	           ACR_INT64_MAX
+	         - ACR_INFO_LESS if the number is less than
+	           ACR_INT64_MIN
+	         - ACR_INFO_INVALID if the string does not
+	           start with a number
+*/
+ACR_Info_t ACR_StringToInt64(
+	ACR_String_t string,
+	ACR_Int64_t* value,
+	ACR_Length_t* consumed);
+
+/** get the unsigned integer at the start of a string
+
+	Note: the same as ACR_StringToInt64() except that only
+	      an optional "+" sign is allowed
+	\param string the UTF8 string
+	\param value location to store the value, which is set
+	       to ACR_UINT64_MAX when the number is too large
+	\param consumed location to store the number of bytes
+	       used by the number or ACR_NULL
+	\returns - ACR_INFO_OK if the value was found
+	         - ACR_INFO_GREATER if the number is more than
+	           ACR_UINT64_MAX
+	         - ACR_INFO_INVALID if the string does not
+	           start with a number
+*/
+ACR_Info_t ACR_StringToUInt64(
+	ACR_String_t string,
+	ACR_UInt64_t* value,
+	ACR_Length_t* consumed);
+
+/** get the floating point number at the start of a string
+
+	Note: the text is an optional sign, decimal digits with
+	      an optional ".", and an optional exponent such as
+		  "e-5". "inf", "infinity", and "nan" in any case are
+		  also allowed. hexadecimal is not supported
+	Note: the result is always the nearest double to the
+	      number. most numbers are converted with 64 bit
+		  integer math and a table of powers of five, and
+		  only numbers that are too close to half way
+		  between two doubles use the slower exact method
+	\param string the UTF8 string
+	\param value location to store the value. numbers that
+	       are too large are stored as infinity
+	\param consumed location to store the number of bytes
+	       used by the number or ACR_NULL
+	\returns ACR_INFO_OK or ACR_INFO_INVALID if the string
+	         does not start with a number
+*/
+ACR_Info_t ACR_StringToDouble(
+	ACR_String_t string,
+	double* value,
+	ACR_Length_t* consumed);
+
+////////////////////////////////////////////////////////////
+//
+// PUBLIC FUNCTIONS - FORMAT
+//
+////////////////////////////////////////////////////////////
+
+/** add the text of a signed integer to the end of the
+    buffer
+
+	Note: the digits are written two at a time directly
+	      into the memory after the current length
+	\param me the buffer
+	\param value the value
+	\returns ACR_INFO_OK or ACR_INFO_ERROR
+*/
+ACR_Info_t ACR_VarBufferAppendInt64(
+	ACR_VarBuffer_t* me,
+	ACR_Int64_t value);
+
+/** add the text of an unsigned integer to the end of the
+    buffer
+	\param me the buffer
+	\param value the value
+	\returns ACR_INFO_OK or ACR_INFO_ERROR
+*/
+ACR_Info_t ACR_VarBufferAppendUInt64(
+	ACR_VarBuffer_t* me,
+	ACR_UInt64_t value);
+
+/** add the shortest text that converts back to exactly the
+    same double to the end of the buffer
+
+	Note: the digits are found with the Schubfach algorithm
+	      and written the same way as JavaScript, so values
+		  with a magnitude of at least 1e-6 and less than 1e21
+		  use no exponent, such as "0.000001", "-2.5", and
+		  "100", and others use one, such as "1e+21" and
+		  "1e-7". infinity is written as "inf" and not a
+		  number as "nan"
+	\param me the buffer
+	\param value the value
+	\returns ACR_INFO_OK or ACR_INFO_ERROR
+	\see ACR_StringToDouble() to convert the text back
+*/
+ACR_Info_t ACR_VarBufferAppendDouble(
+	ACR_VarBuffer_t* me,
+	double value);
+
+/** add the shortest text that converts back to exactly the
+    same ACR_Decimal_t to the end of the buffer
+
+	Note: the same as ACR_VarBufferAppendDouble() except that
+	      the digits only need to identify a float, so 0.1f
+		  is "0.1" instead of "0.10000000149011612"
+	\param me the buffer
+	\param value the value
+	\returns ACR_INFO_OK or ACR_INFO_ERROR
+*/
+ACR_Info_t ACR_VarBufferAppendDecimal(
+	ACR_VarBuffer_t* me,
+	ACR_Decimal_t value);
+
+////////////////////////////////////////////////////////////
+// ALLOW FUNCTIONS TO BE CALLED FROM C++                  //
+////////////////////////////////////////////////////////////
+#ifdef __cplusplus                                        //
+}                                                         //
+#endif                                                    //
+////////////////////////////////////////////////////////////
+
+#endif // #if ACR_USE_64BIT == ACR_BOOL_TRUE
+
+#endif
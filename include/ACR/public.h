@@ -100,6 +100,16 @@
                               see "TYPES AND DEFINES - MEMORY LENGTHS"
                               for details
 
+    ACR_NO_SIMD         do not use SIMD instructions such as SSE2
+                        even when the compiler supports them
+                        Note: see "TYPES AND DEFINES - SIMD" for details
+
+    ACR_NO_THREADS      do not start threads in the parallel buffer
+                        functions such as ACR_BufferCopyParallel()
+                        and do not lock the string intern tables,
+                        so ACR_StringIntern() must only be called
+                        from one thread
+
     --- Top Uses ---
 
     ACR_DEBUG_PRINT     interface to printf() that only
@@ -518,13 +528,48 @@
 // ACR_BOOL_FALSE if not previously defined
 //
 #ifndef ACR_IS_BIG_ENDIAN
-#ifdef BIG_ENDIAN
+#if defined(__BYTE_ORDER__) && defined(__ORDER_BIG_ENDIAN__)
+// Note: GCC and Clang always define __BYTE_ORDER__ for the
+//       target, which does not depend on the system headers
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+/** the system is big endian because the compiler says so
+*/
+#define ACR_IS_BIG_ENDIAN ACR_BOOL_TRUE
+#else
+/** the system is NOT big endian because the compiler says so
+*/
+#define ACR_IS_BIG_ENDIAN ACR_BOOL_FALSE
+#endif // #if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+#else
+#ifdef _WIN32
+/** the system is NOT big endian because every Windows target
+    is little endian
+*/
+#define ACR_IS_BIG_ENDIAN ACR_BOOL_FALSE
+#else
+#if defined(BYTE_ORDER) && defined(BIG_ENDIAN) && defined(LITTLE_ENDIAN)
+// Note: system headers such as <endian.h> define BIG_ENDIAN
+//       and LITTLE_ENDIAN as the possible values of BYTE_ORDER
+//       so only BYTE_ORDER says which one the system uses
+#if BYTE_ORDER == BIG_ENDIAN
+/** the system is big endian because BYTE_ORDER
+    is BIG_ENDIAN
+*/
+#define ACR_IS_BIG_ENDIAN ACR_BOOL_TRUE
+#else
+/** the system is NOT big endian because BYTE_ORDER
+    is not BIG_ENDIAN
+*/
+#define ACR_IS_BIG_ENDIAN ACR_BOOL_FALSE
+#endif // #if BYTE_ORDER == BIG_ENDIAN
+#else
+#if defined(BIG_ENDIAN) && !defined(LITTLE_ENDIAN)
 /** the system is big endian because BIG_ENDIAN
     was set in the preprocessor
 */
 #define ACR_IS_BIG_ENDIAN ACR_BOOL_TRUE
 #else
-#ifdef LITTLE_ENDIAN
+#if defined(LITTLE_ENDIAN) && !defined(BIG_ENDIAN)
 /** the system is NOT big endian because LITTLE_ENDIAN
     was set in the preprocessor
 */
@@ -534,8 +579,11 @@
 //       ignored in project settings to use dynamic endianess detection
 #define ACR_IS_BIG_ENDIAN (*(unsigned short *)"\0\xff" < 0x100)
 #define ACR_ENDIAN_DYNAMIC ACR_BOOL_TRUE
-#endif // #ifdef LITTLE_ENDIAN
-#endif // #ifdef BIG_ENDIAN
+#endif // #if defined(LITTLE_ENDIAN) && !defined(BIG_ENDIAN)
+#endif // #if defined(BIG_ENDIAN) && !defined(LITTLE_ENDIAN)
+#endif // #if defined(BYTE_ORDER) && defined(BIG_ENDIAN) && defined(LITTLE_ENDIAN)
+#endif // #ifdef _WIN32
+#endif // #if defined(__BYTE_ORDER__) && defined(__ORDER_BIG_ENDIAN__)
 #endif // #ifndef ACR_IS_BIG_ENDIAN
 
 //
@@ -712,6 +760,187 @@ typedef struct ACR_Blocks_s
 */
 #define ACR_LENGTH_TO_BLOCKS(blocks, length) { blocks.m_Blocks = (length / ACR_BYTES_PER_BLOCK); blocks.m_Bytes = (length % ACR_BYTES_PER_BLOCK); }
 
+/** type that stores a memory area split into an unaligned
+    head of bytes, a body of ACR_Block_t aligned blocks, and
+    a tail of the remaining bytes
+
+    memory = [ head bytes | body blocks ... | tail bytes ]
+
+    - the head is always less than ACR_BYTES_PER_BLOCK bytes
+    - the tail is always less than ACR_BYTES_PER_BLOCK bytes
+    - the body may have zero blocks when the memory is small
+*/
+typedef struct ACR_BlockSplit_s
+{
+	ACR_Byte_t* m_Head;
+	ACR_Length_t m_HeadLength;
+	ACR_Block_t* m_Body;
+	ACR_Length_t m_BodyBlocks;
+	ACR_Byte_t* m_Tail;
+	ACR_Length_t m_TailLength;
+} ACR_BlockSplit_t;
+
+/** split the specified memory into head, body, and tail
+    \see ACR_BlockSplit_t
+
+    example:
+
+    ACR_BlockSplit_t split;
+    ACR_BLOCK_SPLIT(split, buffer.m_Pointer, buffer.m_Length);
+*/
+#define ACR_BLOCK_SPLIT(split, memory, length) \
+        { \
+            ACR_PointerValue_t splitStart = (ACR_PointerValue_t)(memory); \
+            ACR_PointerValue_t splitBody = ((splitStart + (ACR_BYTES_PER_BLOCK-1)) & (~((ACR_PointerValue_t)ACR_BYTES_PER_BLOCK-1))); \
+            split.m_Head = (ACR_Byte_t*)(memory); \
+            split.m_HeadLength = (ACR_Length_t)(splitBody - splitStart); \
+            if(split.m_HeadLength > (length)) \
+            { \
+                split.m_HeadLength = (length); \
+            } \
+            split.m_Body = (ACR_Block_t*)(split.m_Head + split.m_HeadLength); \
+            split.m_BodyBlocks = (((length) - split.m_HeadLength) / ACR_BYTES_PER_BLOCK); \
+            split.m_Tail = (ACR_Byte_t*)(split.m_Body + split.m_BodyBlocks); \
+            split.m_TailLength = ((length) - split.m_HeadLength - (split.m_BodyBlocks * ACR_BYTES_PER_BLOCK)); \
+        }
+
+////////////////////////////////////////////////////////////
+//
+// TYPES AND DEFINES - CPU CACHE
+//
+////////////////////////////////////////////////////////////
+
+#ifndef ACR_CACHE_LINE_SIZE
+/** number of bytes in a single line of the cpu data cache.
+    64 is correct for most modern desktop and mobile cpus
+    but it can be changed in the preprocessor if needed
+*/
+#define ACR_CACHE_LINE_SIZE 64
+#endif
+
+/** hint to the cpu that the memory at the specified pointer
+    will be read soon so that it can be loaded into the
+    cache before it is needed
+
+    Note: this is only a hint and it has no effect when the
+          compiler is unknown. it is always safe to prefetch
+          an invalid pointer because the memory is never
+          accessed directly
+*/
+#if defined(ACR_COMPILER_GCC) || defined(ACR_COMPILER_CLANG) || defined(ACR_COMPILER_MINGW)
+#define ACR_PREFETCH(p) __builtin_prefetch((const void*)(p), 0, 3)
+#else
+#ifdef ACR_COMPILER_MSVC
+// included for _mm_prefetch
+#include <xmmintrin.h>
+#define ACR_PREFETCH(p) _mm_prefetch((const char*)(p), _MM_HINT_T0)
+#else
+#define ACR_PREFETCH(p)
+#endif // #ifdef ACR_COMPILER_MSVC
+#endif // #if defined(ACR_COMPILER_GCC) || defined(ACR_COMPILER_CLANG) || defined(ACR_COMPILER_MINGW)
+
+////////////////////////////////////////////////////////////
+//
+// TYPES AND DEFINES - SIMD
+//
+// SIMD (single instruction, multiple data) instructions
+// operate on 16 bytes or more at a time. they are used
+// automatically when the compiler is targeting a cpu that
+// supports them. define ACR_NO_SIMD in the preprocessor to
+// always use the portable code instead.
+//
+// ACR_HAS_SSE2 is ACR_BOOL_TRUE when SSE2 is available,
+// which is always the case for 64bit x86 cpus
+//
+// ACR_HAS_SSSE3 is ACR_BOOL_TRUE when SSSE3 is available,
+// which requires a compiler option such as -mssse3,
+// -march=native, or /arch:AVX
+//
+// ACR_HAS_PCLMUL is ACR_BOOL_TRUE when the carry-less
+// multiply and SSE4.1 instructions are available, which
+// requires compiler options such as -mpclmul -msse4.1 or
+// -march=native
+//
+////////////////////////////////////////////////////////////
+
+#ifndef ACR_NO_SIMD
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+// included for SSE2 instructions
+#include <emmintrin.h>
+#define ACR_HAS_SSE2 ACR_BOOL_TRUE
+#endif
+#endif // #ifndef ACR_NO_SIMD
+
+#ifndef ACR_HAS_SSE2
+#define ACR_HAS_SSE2 ACR_BOOL_FALSE
+#endif
+
+#ifndef ACR_NO_SIMD
+#if defined(__SSSE3__) || defined(__AVX__)
+// included for SSSE3 instructions
+#include <tmmintrin.h>
+#define ACR_HAS_SSSE3 ACR_BOOL_TRUE
+#endif
+#endif // #ifndef ACR_NO_SIMD
+
+#ifndef ACR_HAS_SSSE3
+#define ACR_HAS_SSSE3 ACR_BOOL_FALSE
+#endif
+
+#ifndef ACR_NO_SIMD
+#if defined(__PCLMUL__) && defined(__SSE4_1__)
+// included for SSE4.1 and carry-less multiply instructions
+#include <smmintrin.h>
+#include <wmmintrin.h>
+#define ACR_HAS_PCLMUL ACR_BOOL_TRUE
+#endif
+#endif // #ifndef ACR_NO_SIMD
+
+#ifndef ACR_HAS_PCLMUL
+#define ACR_HAS_PCLMUL ACR_BOOL_FALSE
+#endif
+
+////////////////////////////////////////////////////////////
+//
+// TYPES AND DEFINES - BIT OPERATIONS
+//
+////////////////////////////////////////////////////////////
+
+/** ACR_BLOCK_POPCOUNT counts the number of bits set in a
+    single ACR_Block_t
+
+    example:
+
+    ACR_Block_t block = 0x0F;
+    int bits = ACR_BLOCK_POPCOUNT(block); // bits is 4
+
+    \see ACR_BlockPopCount()
+
+    ACR_BLOCK_TRAILING_ZEROS counts the number of zero bits
+    below the lowest set bit in a single ACR_Block_t
+
+    IMPORTANT: the result is undefined when the block is 0
+
+    example:
+
+    ACR_Block_t block = 0x08;
+    int zeros = ACR_BLOCK_TRAILING_ZEROS(block); // zeros is 3
+
+    \see ACR_BlockTrailingZeros()
+*/
+#if defined(ACR_COMPILER_GCC) || defined(ACR_COMPILER_CLANG) || defined(ACR_COMPILER_MINGW)
+#if ACR_USE_64BIT == ACR_BOOL_TRUE
+#define ACR_BLOCK_POPCOUNT(x) __builtin_popcountll(x)
+#define ACR_BLOCK_TRAILING_ZEROS(x) __builtin_ctzll(x)
+#else
+#define ACR_BLOCK_POPCOUNT(x) __builtin_popcountl(x)
+#define ACR_BLOCK_TRAILING_ZEROS(x) __builtin_ctzl(x)
+#endif // #if ACR_USE_64BIT == ACR_BOOL_TRUE
+#else
+#define ACR_BLOCK_POPCOUNT(x) ACR_BlockPopCount(x)
+#define ACR_BLOCK_TRAILING_ZEROS(x) ACR_BlockTrailingZeros(x)
+#endif // #if defined(ACR_COMPILER_GCC) || defined(ACR_COMPILER_CLANG) || defined(ACR_COMPILER_MINGW)
+
 ////////////////////////////////////////////////////////////
 //
 // TYPES AND DEFINES - COMMMON VALUES AND FLAGS
@@ -1118,7 +1347,7 @@ typedef struct ACR_VarBuffer_s
 /** define a variable sized buffer on the stack with the
     specified name
 */
-#define ACR_VAR_BUFFER(name) ACR_VarBuffer_t name = {{ACR_NULL,ACR_ZERO_LENGTH,ACR_BUFFER_FLAGS_NONE},ACR_LENGTH_ZERO};
+#define ACR_VAR_BUFFER(name) ACR_VarBuffer_t name = {{ACR_NULL,ACR_ZERO_LENGTH,ACR_BUFFER_FLAGS_NONE},ACR_ZERO_LENGTH};
 
 /** get the max length of the buffer
 */
@@ -1292,6 +1521,32 @@ typedef struct ACR_AlignedBuffer_s
 			} \
         }
 
+/** allocate memory for the buffer aligned on a block boundary
+
+    Note: up to ACR_BITS_PER_BLOCK extra bytes are allocated so
+          that the full length is available after alignment
+*/
+#define ACR_ALIGNED_BUFFER_ALLOC(name, length) \
+        { \
+			ACR_BUFFER_ALLOC(name.m_UnalignedBuffer, ((length) + ACR_BITS_PER_BLOCK)); \
+			if(name.m_UnalignedBuffer.m_Pointer != ACR_NULL) \
+			{ \
+				ACR_PointerValue_t alignMask = (~(ACR_BITS_PER_BLOCK-1)); \
+				ACR_PointerValue_t memValue = (ACR_PointerValue_t)name.m_UnalignedBuffer.m_Pointer; \
+				memValue += (ACR_BITS_PER_BLOCK-1); \
+				memValue &= alignMask; \
+				name.m_AlignedBuffer.m_Pointer = (void*)memValue; \
+				name.m_AlignedBuffer.m_Length = (length); \
+				ACR_ADD_FLAGS(name.m_AlignedBuffer.m_Flags, ACR_BUFFER_IS_REF); \
+			} \
+			else \
+			{ \
+				name.m_AlignedBuffer.m_Pointer = ACR_NULL; \
+				name.m_AlignedBuffer.m_Length = ACR_ZERO_LENGTH; \
+				ACR_REMOVE_FLAGS(name.m_AlignedBuffer.m_Flags, ACR_BUFFER_IS_REF); \
+			} \
+        }
+
 /** free memory used by the buffer
 */
 #define ACR_ALIGNED_BUFFER_FREE(name) \
@@ -1526,15 +1781,105 @@ typedef struct ACR_String_s
 */
 #define ACR_STRING_REFERENCE(name, memory, length, count) ACR_BUFFER_REFERENCE(name.m_Buffer, memory, length); name.m_Count = count;
 
+/** initialize a constant string from a string literal and
+    its number of UTF8 characters so that the length and
+    character count are known when compiling
+
+        static const ACR_String_t g_Euro = ACR_STRING_LITERAL_UTF8("5 \xE2\x82\xAC", 3);
+*/
+#define ACR_STRING_LITERAL_UTF8(text, count) {{(void*)(text), (ACR_Length_t)(sizeof(text) - 1), ACR_BUFFER_IS_REF}, (ACR_Count_t)(count)}
+
+#if defined(__cplusplus) && ((__cplusplus >= 201103L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 201402L)))
+/** count the UTF8 characters of a string literal when
+    compiling
+*/
+static constexpr ACR_Count_t ACR_StringLiteralCount(
+    const char* text,
+    ACR_Count_t count)
+{
+    return (*text == 0) ? count : ACR_StringLiteralCount(text + 1, count + ((((unsigned char)*text & 0xC0) != 0x80) ? 1 : 0));
+}
+
+/** initialize a constant string from a string literal so
+    that the length and character count are known when
+    compiling
+
+        static const ACR_String_t g_Hello = ACR_STRING_LITERAL("hello");
+
+    Note: in C++ the characters are counted by a constexpr
+          function so any UTF8 literal can be used
+*/
+#define ACR_STRING_LITERAL(text) ACR_STRING_LITERAL_UTF8(text, ACR_StringLiteralCount(text, 0))
+#else
+/** initialize a constant string from a string literal so
+    that the length and character count are known when
+    compiling
+
+        static const ACR_String_t g_Hello = ACR_STRING_LITERAL("hello");
+
+    in an expression use a compound literal
+
+        ACR_String_t hello = (ACR_String_t)ACR_STRING_LITERAL("hello");
+
+    Note: C can not count UTF8 characters when compiling so
+          every byte is counted as a character and the
+          literal must be ASCII, use ACR_STRING_LITERAL_UTF8()
+          for other literals
+*/
+#define ACR_STRING_LITERAL(text) ACR_STRING_LITERAL_UTF8(text, sizeof(text) - 1)
+#endif
+
 /** type for unicode characters
 */
 typedef unsigned long ACR_Unicode_t;
 
+/** unicode characters at or above this value have no
+    case mapping
+    \see ACR_UnicodeToLower()
+*/
+#define ACR_UNICODE_CASE_LIMIT 0x20000
+
 /** given the first UTF8 byte value determine the number of
     bytes uses to encode the character
 */
 #define ACR_UTF8_BYTE_COUNT(c) (((c & 0x80) != 0)?((c & 0x40) != 0)?((c & 0x20) != 0)?((c & 0x10) != 0)?4:3:2:1:1)
 
+////////////////////////////////////////////////////////////
+//
+// TYPES AND DEFINES - STRING TO ENUM LOOKUP
+//
+////////////////////////////////////////////////////////////
+
+#ifdef ACR_COMPILER_VS2017
+#pragma warning(push)
+// disable warning C4820: padding added after data member
+#pragma warning(disable:4820)
+#endif
+/** type for finding an enum value from its name with a
+    minimal perfect hash of the case folded name, so a
+    lookup is one hash and one compare no matter how many
+    names there are
+
+    Note: m_Names[value] is the null-terminated UTF8 name of
+          each value from 0 to m_Count - 1. the hash finds
+          the position in m_Slots that holds the only value
+          that can match, using m_Displacements to place the
+          names of each bucket of m_BucketCount buckets
+          without collisions
+*/
+typedef struct ACR_EnumTable_s
+{
+    const char* const* m_Names;
+    const unsigned short* m_Displacements;
+    const ACR_Count_t* m_Slots;
+    ACR_Count_t m_Count;
+    ACR_Count_t m_BucketCount;
+    ACR_Buffer_t m_Memory;
+} ACR_EnumTable_t;
+#ifdef ACR_COMPILER_VS2017
+#pragma warning(pop)
+#endif
+
 /////////////////////////////////////////////////////////
 //                                                     //
 // TYPES AND DEFINES - UNIQUE STRING VALUES            //
@@ -1735,6 +2080,66 @@ ACR_String_t ACR_MonthToString(
 ACR_Month_t ACR_MonthFromString(
     ACR_String_t src);
 
+/** get the number of seconds since an unspecified point in
+    time from the highest resolution clock available. this is
+    only useful to measure elapsed time
+
+    example:
+    double start = ACR_TimerSeconds();
+    // do something
+    double elapsed = ACR_TimerSeconds() - start;
+
+    \note this is in src/ACR/timer.c
+    \returns seconds or 0 when ACR_HAS_RTC is ACR_BOOL_FALSE
+*/
+double ACR_TimerSeconds(void);
+
+////////////////////////////////////////////////////////////
+//
+// PUBLIC FUNCTIONS - STRING TO ENUM LOOKUP
+//
+////////////////////////////////////////////////////////////
+
+/** prepare an enum table
+*/
+void ACR_EnumTableInit(
+    ACR_EnumTable_t* me);
+
+/** free enum table memory
+*/
+void ACR_EnumTableDeInit(
+    ACR_EnumTable_t* me);
+
+/** find a minimal perfect hash for a list of names
+
+    Note: the names are referenced and not copied so they
+          must not change while the table is used
+    \param me the enum table
+    \param names the null-terminated UTF8 name of each value
+           from 0 to count - 1
+    \param count the number of names
+    \returns - ACR_INFO_OK if the table is ready
+             - ACR_INFO_INVALID if two names are the same
+               when case is ignored
+             - ACR_INFO_ERROR if memory could not be
+               allocated or no hash was found
+*/
+ACR_Info_t ACR_EnumTableBuild(
+    ACR_EnumTable_t* me,
+    const char* const* names,
+    ACR_Count_t count);
+
+/** find the value with a name without checking case
+    \param me the enum table
+    \param src a reference to a string
+    \param value location to store the value
+    \returns ACR_INFO_OK or ACR_INFO_UNKNOWN if not found
+*/
+ACR_Info_t ACR_EnumTableFind(
+    const ACR_EnumTable_t* me,
+    ACR_String_t src,
+    ACR_Count_t* value);
+
 ////////////////////////////////////////////////////////////
 //
 // PUBLIC FUNCTIONS - SIMPLE UTF8 STRINGS
@@ -1770,16 +2175,34 @@ ACR_Info_t ACR_Utf8PrevChar(
 
 /** convert a unicode charcter to its lower-case
     representation
+
+    Note: uses the simple one character mappings from the
+          unicode character database so characters like
+          U+0130 map to 'i' without a combining dot
 */
 ACR_Unicode_t ACR_UnicodeToLower(
     ACR_Unicode_t u);
 
 /** convert a unicode charcter to its upper-case
     representation
+
+    Note: uses the simple one character mappings from the
+          unicode character database so characters like
+          U+00DF that become two characters in upper-case
+          are not changed
 */
 ACR_Unicode_t ACR_UnicodeToUpper(
     ACR_Unicode_t u);
 
+/** convert a unicode character to its case folded
+    representation for case-insensitive comparison.
+    this is usually the lower-case representation but also
+    maps characters like final sigma U+03C2 and long s
+    U+017F to the same value as their other forms
+*/
+ACR_Unicode_t ACR_UnicodeFold(
+    ACR_Unicode_t u);
+
 /** convert UTF8 encoded data to a unicode value
     \param mem a valid pointer to the UTF8 encoded character
            in memory
@@ -1792,6 +2215,16 @@ ACR_Unicode_t ACR_Utf8ToUnicode(
     const ACR_Byte_t* mem,
     int bytes);
 
+/** convert a unicode value to UTF8 encoded data
+    \param u a unicode value up to U+10FFFF
+    \param mem a valid pointer to memory with space for at
+           least 4 bytes
+    \returns the number of bytes written to mem
+*/
+int ACR_UnicodeToUtf8(
+    ACR_Unicode_t u,
+    ACR_Byte_t* mem);
+
 /** get a reference to a null-terminated string in memory 
     with support for UTF8 encoding
     \param src a pointer to a null-terminated string in
@@ -1802,6 +2235,13 @@ ACR_Unicode_t ACR_Utf8ToUnicode(
     \param maxCharacters the max number of characters this
            function will count. use ACR_MAX_COUNT if unsure
     \returns a string referennce
+
+    Note: characters are counted 16 bytes at a time with SSE2
+          or one ACR_Block_t at a time by counting the bytes
+          that are not UTF8 continuation bytes, so the count
+          is only exact for valid UTF8. a character at the end
+          that is missing some of its bytes is not included.
+          \see ACR_Utf8Validate() in "ACR/utf8.h"
 */
 ACR_String_t ACR_StringFromMemory(
     ACR_Byte_t* src,
@@ -1829,6 +2269,11 @@ ACR_String_t ACR_StringFromMemory(
              - ACR_INFO_GREATER if src has more characters
                or is greater than string
              - ACR_INFO_INVALID if src is invalid
+
+    Note: ASCII characters are compared 16 bytes (or one
+          block) at a time whenever src is aligned, and
+          characters are only decoded from UTF8 where either
+          side is not ASCII
 */
 ACR_Info_t ACR_StringCompareToMemory(
     ACR_String_t string,
@@ -1837,6 +2282,31 @@ ACR_Info_t ACR_StringCompareToMemory(
     ACR_Count_t maxCharacters,
     ACR_Info_t caseSensitive);
 
+////////////////////////////////////////////////////////////
+//
+// PUBLIC FUNCTIONS - BIT OPERATIONS
+//
+////////////////////////////////////////////////////////////
+
+/** count the number of bits set in a block
+    Note: use ACR_BLOCK_POPCOUNT() instead to use the
+          cpu instruction when it is available
+    \param block the block
+    \returns the number of bits set 0 to ACR_BITS_PER_BLOCK
+*/
+int ACR_BlockPopCount(
+    ACR_Block_t block);
+
+/** count the number of zero bits below the lowest set bit
+    Note: use ACR_BLOCK_TRAILING_ZEROS() instead to use the
+          cpu instruction when it is available
+    \param block the block
+    \returns the number of trailing zero bits or
+             ACR_BITS_PER_BLOCK if the block is 0
+*/
+int ACR_BlockTrailingZeros(
+    ACR_Block_t block);
+
 ////////////////////////////////////////////////////////////
 //
 // PUBLIC FUNCTIONS - OTHER
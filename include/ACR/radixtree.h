@@ -0,0 +1,310 @@
+/*
+
+    ********** DO NOT REMOVE THIS INFORMATION ************
+
+    ACR - A set of C functions in a git Repository
+    Copyright (C) 2018 - 2020 Adam C. Rosenberg
+
+    Please read LICENSE before using this code
+
+    Please read README.md for instructions on including
+    this code in your project and where to find examples
+
+    If you contribute to this code, Please add your name
+    and email address to the AUTHORS list below so that
+    we know who to thank!
+
+    AUTHORS
+
+    Adam Rosenberg <adam@sirspot.com>
+
+    LICENSE
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+    ******************************************************
+
+*/
+/** \file radixtree.h
+
+    functions for access to the ACR_RadixTree_t type
+
+    an adaptive radix tree of ACR_String_t keys to values of
+    a fixed size stored in the tree. keys are kept in byte
+    order, so the tree can find the longest key that is a
+    prefix of a string and list every key with a prefix:
+
+    - each node has 4, 16, 48, or 256 children depending on
+      how many it needs, and grows or shrinks as keys are
+      added and removed
+    - a node with 16 children finds a child by comparing all
+      16 key bytes at once, with SSE2 when ACR_HAS_SSE2 is
+      ACR_BOOL_TRUE
+    - the bytes that all of the keys below a node share are
+      stored once in the node (path compression), and a key
+      only stores the bytes after its place in the tree
+    - a key that ends at a node is stored in the node, so a
+      key can be a prefix of other keys
+    - nodes and keys are allocated from blocks of the tree
+      and removed ones are reused
+
+*/
+#ifndef _ACR_RADIXTREE_H_
+#define _ACR_RADIXTREE_H_
+
+#include "ACR/public.h"
+
+////////////////////////////////////////////////////////////
+//
+// TYPES AND DEFINES
+//
+////////////////////////////////////////////////////////////
+
+/** values are aligned to this many bytes in the tree
+*/
+#define ACR_RADIX_TREE_VALUE_ALIGN 8
+
+/** memory that is at most this many bytes is allocated from
+    the blocks of the tree
+*/
+#define ACR_RADIX_TREE_SMALL_LENGTH 512
+
+#ifndef ACR_RADIX_TREE_BLOCK_LENGTH
+/** the number of bytes allocated at a time for small nodes
+    and keys
+*/
+#define ACR_RADIX_TREE_BLOCK_LENGTH 65536
+#endif
+
+#ifdef ACR_COMPILER_VS2017
+#pragma warning(push)
+// disable warning C4820: padding added after data member
+#pragma warning(disable:4820)
+#endif
+/** type for an adaptive radix tree
+*/
+typedef struct ACR_RadixTree_s
+{
+	/** the root node or key
+	*/
+	void* m_Root;
+
+	/** the blocks of memory for small nodes and keys, the
+	    newest first
+	*/
+	void* m_Blocks;
+
+	/** the nodes and keys that are larger than
+	    ACR_RADIX_TREE_SMALL_LENGTH
+	*/
+	void* m_Large;
+
+	/** removed nodes and keys of each size that can be
+	    reused
+	*/
+	void* m_Free[ACR_RADIX_TREE_SMALL_LENGTH / ACR_RADIX_TREE_VALUE_ALIGN];
+
+	/** the number of bytes used in the newest block
+	*/
+	ACR_Length_t m_BlockUsed;
+
+	/** the number of bytes allocated by the tree
+	*/
+	ACR_Length_t m_MemoryLength;
+
+	/** the number of bytes of each value
+	*/
+	ACR_Length_t m_ValueLength;
+
+	/** the number of keys in the tree
+	*/
+	ACR_Count_t m_Count;
+} ACR_RadixTree_t;
+
+/** type to list the keys of a tree in order
+*/
+typedef struct ACR_RadixTreeIterator_s
+{
+	/** the tree
+	*/
+	const ACR_RadixTree_t* m_Tree;
+
+	/** the node or key whose keys are listed next, or ACR_NULL
+	*/
+	const void* m_Start;
+
+	/** the nodes being listed and the next child of each
+	*/
+	ACR_Buffer_t m_Stack;
+
+	/** the bytes of the current key
+	*/
+	ACR_Buffer_t m_Key;
+
+	/** the number of nodes on m_Stack
+	*/
+	ACR_Count_t m_Depth;
+
+	/** the number of bytes of the key of m_Start before its
+	    own bytes
+	*/
+	ACR_Length_t m_StartLength;
+} ACR_RadixTreeIterator_t;
+#ifdef ACR_COMPILER_VS2017
+#pragma warning(pop)
+#endif
+
+////////////////////////////////////////////////////////////
+// ALLOW FUNCTIONS TO BE CALLED FROM C++                  //
+////////////////////////////////////////////////////////////
+#ifdef __cplusplus                                        //
+extern "C" {                                              //
+#endif                                                    //
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+//
+// PUBLIC FUNCTIONS
+//
+////////////////////////////////////////////////////////////
+
+/** prepare a radix tree
+	\param me the tree
+	\param valueLength the number of bytes of each value,
+	       which can be 0 for a set of keys
+*/
+void ACR_RadixTreeInit(
+	ACR_RadixTree_t* me,
+	ACR_Length_t valueLength);
+
+/** free radix tree memory
+*/
+void ACR_RadixTreeDeInit(
+	ACR_RadixTree_t* me);
+
+/** add a key or find it if it is already there
+
+	Note: the value pointer is valid until the next key is
+	      added or removed
+	\param me the tree
+	\param key the key, whose bytes are copied into the tree
+	\param value location to store a pointer to the value
+	       in the tree, which is filled with zeros when the
+		   key is new, or ACR_NULL
+	\returns - ACR_INFO_NEW if the key was added
+	         - ACR_INFO_OLD if the key was already there
+	         - ACR_INFO_ERROR if memory could not be allocated
+*/
+ACR_Info_t ACR_RadixTreeAdd(
+	ACR_RadixTree_t* me,
+	ACR_String_t key,
+	void** value);
+
+/** find a key
+	\param me the tree
+	\param key the key
+	\param value location to store a pointer to the value
+	       in the tree or ACR_NULL
+	\returns ACR_INFO_OK or ACR_INFO_UNKNOWN if not found
+*/
+ACR_Info_t ACR_RadixTreeFind(
+	const ACR_RadixTree_t* me,
+	ACR_String_t key,
+	void** value);
+
+/** remove a key
+	\param me the tree
+	\param key the key
+	\returns ACR_INFO_OK or ACR_INFO_UNKNOWN if not found
+*/
+ACR_Info_t ACR_RadixTreeRemove(
+	ACR_RadixTree_t* me,
+	ACR_String_t key);
+
+/** find the longest key in the tree that is a prefix of a
+    string, such as the route for a path
+	\param me the tree
+	\param string the string
+	\param length location to store the number of bytes of
+	       the key that was found or ACR_NULL
+	\param value location to store a pointer to the value
+	       in the tree or ACR_NULL
+	\returns ACR_INFO_OK or ACR_INFO_UNKNOWN if no key is a
+	         prefix of the string
+*/
+ACR_Info_t ACR_RadixTreeLongestPrefix(
+	const ACR_RadixTree_t* me,
+	ACR_String_t string,
+	ACR_Length_t* length,
+	void** value);
+
+/** prepare to list the keys of a tree that start with a
+    prefix in byte order
+
+	example:
+
+	ACR_RadixTreeIterator_t iterator;
+	ACR_String_t key;
+	void* value;
+	ACR_RadixTreeIteratorInit(&iterator, &tree, prefix);
+	while(ACR_RadixTreeNext(&iterator, &key, &value) == ACR_INFO_OK)
+	{
+	    // use key and value
+	}
+	ACR_RadixTreeIteratorDeInit(&iterator);
+
+	Note: the tree must not be changed while its keys are
+	      listed
+	\param me the iterator
+	\param tree the tree
+	\param prefix the prefix, or an empty string for every
+	       key
+	\returns ACR_INFO_OK or ACR_INFO_ERROR if memory could not
+	         be allocated
+*/
+ACR_Info_t ACR_RadixTreeIteratorInit(
+	ACR_RadixTreeIterator_t* me,
+	const ACR_RadixTree_t* tree,
+	ACR_String_t prefix);
+
+/** free iterator memory
+*/
+void ACR_RadixTreeIteratorDeInit(
+	ACR_RadixTreeIterator_t* me);
+
+/** get the next key of an iterator
+	\param me the iterator
+	\param key location to store the key, whose bytes are in
+	       memory of the iterator until the next call
+	\param value location to store a pointer to the value
+	       in the tree or ACR_NULL
+	\returns - ACR_INFO_OK if there was a key
+	         - ACR_INFO_UNKNOWN if there are no more keys
+	         - ACR_INFO_ERROR if memory could not be allocated
+*/
+ACR_Info_t ACR_RadixTreeNext(
+	ACR_RadixTreeIterator_t* me,
+	ACR_String_t* key,
+	void** value);
+
+////////////////////////////////////////////////////////////
+// ALLOW FUNCTIONS TO BE CALLED FROM C++                  //
+////////////////////////////////////////////////////////////
+#ifdef __cplusplus                                        //
+}                                                         //
+#endif                                                    //
+////////////////////////////////////////////////////////////
+
+#endif
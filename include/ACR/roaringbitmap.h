@@ -0,0 +1,355 @@
+/*
+
+    ********** DO NOT REMOVE THIS INFORMATION ************
+
+    ACR - A set of C functions in a git Repository
+    Copyright (C) 2018 - 2020 Adam C. Rosenberg
+
+    Please read LICENSE before using this code
+
+    Please read README.md for instructions on including
+    this code in your project and where to find examples
+
+    If you contribute to this code, Please add your name
+    and email address to the AUTHORS list below so that
+    we know who to thank!
+
+    AUTHORS
+
+    Adam Rosenberg <adam@sirspot.com>
+
+    LICENSE
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+    ******************************************************
+
+*/
+/** \file roaringbitmap.h
+
+    functions for access to the ACR_RoaringBitmap_t type
+
+    a roaring bitmap is a compressed set of 32bit values. the
+    values are split into chunks of 65536 values by their upper
+    16 bits and each chunk is stored in the smallest of three
+    kinds of containers:
+
+    - array   a sorted list of the lower 16 bits of each value
+              used when the chunk has 4096 values or less
+    - bitmap  65536 bits stored in ACR_Block_t values
+              used when the chunk has more than 4096 values
+    - run     a sorted list of (start, length - 1) pairs
+              used after ACR_RoaringBitmapRunOptimize() when
+              the values are mostly consecutive
+
+    so a sparse set costs about 2 bytes per value and a dense
+    set costs at most 1 bit per value
+
+*/
+#ifndef _ACR_ROARINGBITMAP_H_
+#define _ACR_ROARINGBITMAP_H_
+
+#include "ACR/varbuffer.h"
+
+////////////////////////////////////////////////////////////
+//
+// TYPES AND DEFINES
+//
+////////////////////////////////////////////////////////////
+
+/** the number of values in each chunk
+*/
+#define ACR_ROARING_CHUNK_SIZE 65536
+
+/** the max number of values stored by an array container
+    before it is converted to a bitmap container
+*/
+#define ACR_ROARING_ARRAY_MAX 4096
+
+/** the number of blocks used by a bitmap container
+*/
+#define ACR_ROARING_BITMAP_BLOCKS (ACR_ROARING_CHUNK_SIZE / ACR_BITS_PER_BLOCK)
+
+#ifndef ACR_ROARING_GALLOP_RATIO
+/** this is used when intersecting two array containers.
+    when one array is this many times larger than the other
+	each value of the small array is found in the large array
+	with a galloping (exponential) search instead of comparing
+	both arrays from start to end
+*/
+#define ACR_ROARING_GALLOP_RATIO 32
+#endif
+
+/** type for a value stored in a roaring bitmap
+    0 to ACR_ROARING_MAX_VALUE
+*/
+typedef unsigned long ACR_RoaringValue_t;
+
+/** max value that can be stored by a roaring bitmap
+*/
+#define ACR_ROARING_MAX_VALUE 4294967295UL // hex value 0xFFFFFFFF
+
+/** kinds of containers
+*/
+enum ACR_RoaringContainerType_e
+{
+	ACR_ROARING_ARRAY = 1,
+	ACR_ROARING_BITMAP,
+	ACR_ROARING_RUN
+};
+
+#ifdef ACR_COMPILER_VS2017
+#pragma warning(push)
+// disable warning C4820: padding added after data member
+#pragma warning(disable:4820)
+#endif
+/** type for a single chunk of a roaring bitmap
+*/
+typedef struct ACR_RoaringContainer_s
+{
+	/** the container data
+	    - array:  unsigned short values
+		- bitmap: ACR_Block_t values
+		- run:    unsigned short (start, length - 1) pairs
+	*/
+	ACR_Buffer_t m_Data;
+
+	/** the number of values or run pairs currently used in m_Data
+	*/
+	ACR_Count_t m_Length;
+
+	/** the number of values in the chunk 1 to ACR_ROARING_CHUNK_SIZE
+	*/
+	ACR_Count_t m_Cardinality;
+
+	/** the upper 16 bits of all values in the chunk
+	*/
+	unsigned short m_Key;
+
+	/** see enum ACR_RoaringContainerType_e
+	*/
+	ACR_Byte_t m_Type;
+
+} ACR_RoaringContainer_t;
+
+/** type for a compressed bitmap
+	- include "ACR/roaringbitmap.h" for easy and safe functions
+*/
+typedef struct ACR_RoaringBitmap_s
+{
+	/** ACR_RoaringContainer_t values sorted by m_Key
+	*/
+	ACR_Buffer_t m_Containers;
+
+	/** the number of containers in use
+	*/
+	ACR_Count_t m_ContainerCount;
+
+	/** see enum ACR_RoaringBitmapFlags_e
+	*/
+	ACR_Flags_t m_Flags;
+
+} ACR_RoaringBitmap_t;
+#ifdef ACR_COMPILER_VS2017
+#pragma warning(pop)
+#endif
+
+/** roaring bitmap flags
+*/
+enum ACR_RoaringBitmapFlags_e
+{
+	ACR_ROARING_FLAGS_NONE    = 0x00,
+	/** the container data references memory from
+	    ACR_RoaringBitmapRefSerialized() so it cannot change
+	*/
+	ACR_ROARING_IS_READ_ONLY  = 0x01
+};
+
+////////////////////////////////////////////////////////////
+// ALLOW FUNCTIONS TO BE CALLED FROM C++                  //
+////////////////////////////////////////////////////////////
+#ifdef __cplusplus                                        //
+extern "C" {                                              //
+#endif                                                    //
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+//
+// PUBLIC FUNCTIONS
+//
+////////////////////////////////////////////////////////////
+
+/** prepare a roaring bitmap allocated on the heap
+	Note: this automatically calls ACR_RoaringBitmapInit() on the
+	      new bitmap after allocating its memory
+	\param mePtr location to store the pointer for the new bitmap
+	\returns ACR_INFO_OK or ACR_INFO_ERROR
+*/
+ACR_Info_t ACR_RoaringBitmapNew(
+	ACR_RoaringBitmap_t** mePtr);
+
+/** free a roaring bitmap allocated on the heap
+    Note: this automatically calls ACR_RoaringBitmapDeInit() on
+	      the bitmap before freeing its memory
+	\param mePtr location of the pointer for the bitmap, which will
+	       be set to ACR_NULL after the memory is freed
+*/
+void ACR_RoaringBitmapDelete(
+	ACR_RoaringBitmap_t** mePtr);
+
+/** prepare an empty roaring bitmap
+*/
+void ACR_RoaringBitmapInit(
+	ACR_RoaringBitmap_t* me);
+
+/** free roaring bitmap memory
+*/
+void ACR_RoaringBitmapDeInit(
+	ACR_RoaringBitmap_t* me);
+
+/** add a value
+	\returns ACR_INFO_OK or ACR_INFO_ERROR
+*/
+ACR_Info_t ACR_RoaringBitmapAdd(
+	ACR_RoaringBitmap_t* me,
+	ACR_RoaringValue_t value);
+
+/** remove a value
+	\returns ACR_INFO_OK or ACR_INFO_ERROR
+*/
+ACR_Info_t ACR_RoaringBitmapRemove(
+	ACR_RoaringBitmap_t* me,
+	ACR_RoaringValue_t value);
+
+/** check for a value
+	\returns ACR_INFO_TRUE or ACR_INFO_FALSE
+*/
+ACR_Info_t ACR_RoaringBitmapContains(
+	ACR_RoaringBitmap_t* me,
+	ACR_RoaringValue_t value);
+
+/** get the number of values in the bitmap
+*/
+ACR_Length_t ACR_RoaringBitmapCardinality(
+	ACR_RoaringBitmap_t* me);
+
+/** find the next value in the bitmap
+	\param me the bitmap
+	\param from the first value to check
+	\param found location to store the value that was found
+	\returns ACR_INFO_OK or ACR_INFO_ERROR if there are no
+	         more values
+
+	example:
+
+	ACR_RoaringValue_t value = 0;
+	while(ACR_RoaringBitmapFindNext(&bitmap, value, &value) == ACR_INFO_OK)
+	{
+		// value is in the bitmap
+		if(value == ACR_ROARING_MAX_VALUE) break;
+		value++;
+	}
+*/
+ACR_Info_t ACR_RoaringBitmapFindNext(
+	ACR_RoaringBitmap_t* me,
+	ACR_RoaringValue_t from,
+	ACR_RoaringValue_t* found);
+
+/** convert containers to run containers when that uses less memory
+	\returns ACR_INFO_OK or ACR_INFO_ERROR
+
+	Note: run containers are converted back to array or
+	      bitmap containers as soon as they are changed
+*/
+ACR_Info_t ACR_RoaringBitmapRunOptimize(
+	ACR_RoaringBitmap_t* me);
+
+/** result = a OR b
+	\param result an initialized bitmap that will be replaced
+	       with the result. it must not be a or b
+	\param a
+	\param b
+	\returns ACR_INFO_OK or ACR_INFO_ERROR
+*/
+ACR_Info_t ACR_RoaringBitmapOr(
+	ACR_RoaringBitmap_t* result,
+	ACR_RoaringBitmap_t* a,
+	ACR_RoaringBitmap_t* b);
+
+/** result = a AND b
+	\param result an initialized bitmap that will be replaced
+	       with the result. it must not be a or b
+	\param a
+	\param b
+	\returns ACR_INFO_OK or ACR_INFO_ERROR
+*/
+ACR_Info_t ACR_RoaringBitmapAnd(
+	ACR_RoaringBitmap_t* result,
+	ACR_RoaringBitmap_t* a,
+	ACR_RoaringBitmap_t* b);
+
+/** get the exact number of bytes needed by
+    ACR_RoaringBitmapSerialize()
+*/
+ACR_Length_t ACR_RoaringBitmapSerializedLength(
+	ACR_RoaringBitmap_t* me);
+
+/** append the bitmap to the end of a variable length buffer
+	\param me the bitmap
+	\param dst the buffer will grow if needed
+	\returns ACR_INFO_OK or ACR_INFO_ERROR
+
+	Note: the serialized data is always little endian and the
+	      container data is aligned on 8 byte boundaries from
+		  the start of the serialized data so that it can be
+		  used in place by ACR_RoaringBitmapRefSerialized()
+*/
+ACR_Info_t ACR_RoaringBitmapSerialize(
+	ACR_RoaringBitmap_t* me,
+	ACR_VarBuffer_t* dst);
+
+/** use serialized data in place without copying the
+    container data. this is intended for memory mapped files
+	\param me the bitmap, which becomes read-only
+	\param src the serialized data, which must stay valid and
+	       unchanged as long as the bitmap is used
+	\param length the length of src
+	\returns ACR_INFO_OK or ACR_INFO_ERROR if the data is not
+	         valid, src is not aligned on an 8 byte boundary,
+			 or the system is big endian
+
+	Note: only the container list is allocated. use
+	      ACR_RoaringBitmapOr() with an empty bitmap to make a
+		  copy that can be changed
+
+	Note: every container is checked once so that later calls
+	      cannot read past it. the cardinality must match the
+		  values, array values must be sorted and unique, and
+		  runs must be sorted and must not overlap
+*/
+ACR_Info_t ACR_RoaringBitmapRefSerialized(
+	ACR_RoaringBitmap_t* me,
+	const void* src,
+	ACR_Length_t length);
+
+////////////////////////////////////////////////////////////
+// ALLOW FUNCTIONS TO BE CALLED FROM C++                  //
+////////////////////////////////////////////////////////////
+#ifdef __cplusplus                                        //
+}                                                         //
+#endif                                                    //
+////////////////////////////////////////////////////////////
+
+#endif
@@ -47,6 +47,132 @@
 
 #include "ACR/public.h"
 
+////////////////////////////////////////////////////////////
+//
+// TYPES AND DEFINES
+//
+////////////////////////////////////////////////////////////
+
+#ifndef ACR_STRING_INDEX_INTERVAL
+/** this is used by ACR_StringIndexBuild() to determine how
+    many characters are between each sample of the index, so
+    finding a character never steps over more than this many
+	characters after reading its sample
+*/
+#define ACR_STRING_INDEX_INTERVAL 256
+#endif
+
+#ifdef ACR_COMPILER_VS2017
+#pragma warning(push)
+// disable warning C4820: padding added after data member
+#pragma warning(disable:4820)
+#endif
+/** type for an index of the character positions in a long
+    UTF8 string
+	- the index is optional and only worth building for
+	  strings that are accessed by character position many
+	  times
+	- see ACR_StringCharAt() and ACR_StringSubstringChars()
+*/
+typedef struct ACR_StringIndex_s
+{
+	/** ACR_Length_t samples of the byte offset of every
+	    ACR_STRING_INDEX_INTERVAL characters
+	*/
+	ACR_Buffer_t m_Samples;
+
+	/** the number of samples in m_Samples
+	*/
+	ACR_Count_t m_SampleCount;
+
+	/** the string data the index was built for, or ACR_NULL
+	    when the index needs to be built
+	*/
+	const void* m_Pointer;
+
+	/** the length in bytes of the indexed string data
+	*/
+	ACR_Length_t m_Length;
+
+	/** the number of characters in the indexed string data
+	*/
+	ACR_Count_t m_Count;
+} ACR_StringIndex_t;
+#ifdef ACR_COMPILER_VS2017
+#pragma warning(pop)
+#endif
+
+#ifndef ACR_STRING_TOKENIZER_SIMD_BYTES
+/** the tokenizer looks for the first byte of each delimiter
+    a chunk at a time when ACR_HAS_SSE2 is ACR_BOOL_TRUE and
+	the delimiters start with no more than this many
+	different bytes. otherwise it checks one byte at a time
+*/
+#define ACR_STRING_TOKENIZER_SIMD_BYTES 4
+#endif
+
+#ifdef ACR_COMPILER_VS2017
+#pragma warning(push)
+// disable warning C4820: padding added after data member
+#pragma warning(disable:4820)
+#endif
+/** type to split a UTF8 string into tokens that reference
+    the string memory without copying
+	- see ACR_StringTokenizerInit() and ACR_StringSplit()
+*/
+typedef struct ACR_StringTokenizer_s
+{
+	/** the string being split
+	*/
+	ACR_String_t m_Source;
+
+	/** the UTF8 delimiter characters
+	*/
+	ACR_String_t m_Delimiters;
+
+	/** byte offset of the next token in m_Source
+	*/
+	ACR_Length_t m_Position;
+
+	/** ACR_INFO_YES to skip tokens that have no characters
+	*/
+	ACR_Info_t m_SkipEmpty;
+
+	/** ACR_INFO_END after the last token
+	*/
+	ACR_Info_t m_State;
+
+	/** the number of values in m_SimdBytes or 0 if there are
+	    too many to check a chunk at a time
+	*/
+	int m_SimdCount;
+
+	/** the different first bytes of the delimiters
+	*/
+	ACR_Byte_t m_SimdBytes[ACR_STRING_TOKENIZER_SIMD_BYTES];
+
+	/** one bit for every value of the first byte of the
+	    delimiters
+	*/
+	ACR_Byte_t m_ByteSet[32];
+
+	/** byte offset of the chunk that had the last delimiter
+	*/
+	ACR_Length_t m_MaskPosition;
+
+	/** one bit for each byte of that chunk that may still be
+	    the start of a delimiter
+	*/
+	unsigned int m_Mask;
+
+	/** one bit for each continuation byte of that chunk
+	*/
+	unsigned int m_Continuation;
+} ACR_StringTokenizer_t;
+#ifdef ACR_COMPILER_VS2017
+#pragma warning(pop)
+#endif
+
 ////////////////////////////////////////////////////////////
 // ALLOW FUNCTIONS TO BE CALLED FROM C++                  //
 ////////////////////////////////////////////////////////////
@@ -89,6 +215,152 @@ void ACR_StringInit(
 void ACR_StringDeInit(
 	ACR_String_t* me);
 
+/** prepare a string index
+*/
+void ACR_StringIndexInit(
+	ACR_StringIndex_t* me);
+
+/** free string index memory
+*/
+void ACR_StringIndexDeInit(
+	ACR_StringIndex_t* me);
+
+/** sample the byte offset of every ACR_STRING_INDEX_INTERVAL
+    characters in the string
+
+	Note: the characters are counted a chunk of bytes at a
+	      time when ACR_HAS_SSE2 is ACR_BOOL_TRUE
+	Note: ACR_StringCharAt() and ACR_StringSubstringChars()
+	      call this automatically when the string memory or
+		  length no longer match the index, so this only
+		  needs to be called directly to build the index
+		  ahead of time
+	\param me the index
+	\param string the UTF8 string to index
+	\returns ACR_INFO_OK or ACR_INFO_ERROR
+*/
+ACR_Info_t ACR_StringIndexBuild(
+	ACR_StringIndex_t* me,
+	ACR_String_t string);
+
+/** mark the index as out of date so that it is rebuilt the
+    next time it is used
+
+	Note: call this after changing the bytes of an indexed
+	      string in place, since that does not change the
+		  string memory or length that the index checks
+*/
+void ACR_StringIndexInvalidate(
+	ACR_StringIndex_t* me);
+
+/** get the character at a character position in the string
+	\param string the UTF8 string
+	\param index an index for the string or ACR_NULL to
+	       count the characters from the start of the string
+	\param position the character position starting at 0
+	\param character location to store the unicode value
+	\returns ACR_INFO_OK or ACR_INFO_ERROR if the position is
+	         past the end of the string
+*/
+ACR_Info_t ACR_StringCharAt(
+	ACR_String_t string,
+	ACR_StringIndex_t* index,
+	ACR_Count_t position,
+	ACR_Unicode_t* character);
+
+/** get a reference to part of the string by character
+    position without copying the string data
+
+	Note: the part is shortened if it goes past the end of
+	      the string
+	\param string the UTF8 string
+	\param index an index for the string or ACR_NULL to
+	       count the characters from the start of the string
+	\param start the position of the first character of the
+	       part starting at 0
+	\param count the number of characters in the part
+	\param result location to store the reference
+	\returns ACR_INFO_OK or ACR_INFO_ERROR if start is past the
+	         end of the string
+*/
+ACR_Info_t ACR_StringSubstringChars(
+	ACR_String_t string,
+	ACR_StringIndex_t* index,
+	ACR_Count_t start,
+	ACR_Count_t count,
+	ACR_String_t* result);
+
+/** prepare to split a string into tokens
+
+	Note: tokens reference the memory of the source string,
+	      and the memory of the delimiters is used until the
+		  last token is found, so both must stay valid
+	\param me the tokenizer
+	\param source the UTF8 string to split
+	\param delimiters a UTF8 string where each character is a
+	       delimiter, which can be more than one byte long
+	\param skipEmpty ACR_INFO_YES to skip tokens with no
+	       characters, such as between two delimiters in a
+		   row, or ACR_INFO_NO to keep them
+	\returns ACR_INFO_OK or ACR_INFO_ERROR
+*/
+ACR_Info_t ACR_StringTokenizerInit(
+	ACR_StringTokenizer_t* me,
+	ACR_String_t source,
+	ACR_String_t delimiters,
+	ACR_Info_t skipEmpty);
+
+/** get the next token
+
+	Note: the bytes are only read once, and the character
+	      count of the token is found at the same time as
+		  the delimiter after it
+	\param me the tokenizer
+	\param token location to store the reference to the
+	       token, which includes its length and count
+	\returns ACR_INFO_OK or ACR_INFO_END when there are no
+	         more tokens
+*/
+ACR_Info_t ACR_StringTokenizerNext(
+	ACR_StringTokenizer_t* me,
+	ACR_String_t* token);
+
+/** get as many of the next tokens as will fit
+	\param me the tokenizer
+	\param tokens array to store the token references
+	\param tokensCount the number of items in tokens
+	\returns the number of tokens stored, which is less than
+	         tokensCount only when there are no more tokens
+*/
+ACR_Count_t ACR_StringTokenizerNextBatch(
+	ACR_StringTokenizer_t* me,
+	ACR_String_t* tokens,
+	ACR_Count_t tokensCount);
+
+/** split a string into tokens that reference its memory
+
+	Note: if there are more tokens than fit then the last
+	      item is the rest of the string after the delimiter
+		  that ends the item before it. empty tokens are
+		  always kept so that each item is a field
+
+    example:
+
+	ACR_String_t fields[3];
+	count = ACR_StringSplit(line, comma, fields, 3);
+	// for line "a,b,c,d" the fields are "a", "b", and "c,d"
+	\param source the UTF8 string to split
+	\param delimiters a UTF8 string where each character is a
+	       delimiter
+	\param tokens array to store the token references
+	\param tokensCount the number of items in tokens
+	\returns the number of tokens stored
+*/
+ACR_Count_t ACR_StringSplit(
+	ACR_String_t source,
+	ACR_String_t delimiters,
+	ACR_String_t* tokens,
+	ACR_Count_t tokensCount);
 
 
 ////////////////////////////////////////////////////////////
@@ -0,0 +1,259 @@
+/*
+
+    ********** DO NOT REMOVE THIS INFORMATION ************
+
+    ACR - A set of C functions in a git Repository
+    Copyright (C) 2018 - 2020 Adam C. Rosenberg
+
+    Please read LICENSE before using this code
+
+    Please read README.md for instructions on including
+    this code in your project and where to find examples
+
+    If you contribute to this code, Please add your name
+    and email address to the AUTHORS list below so that
+    we know who to thank!
+
+    AUTHORS
+
+    Adam Rosenberg <adam@sirspot.com>
+
+    LICENSE
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+    ******************************************************
+
+*/
+/** \file stringdictionary.h
+
+    functions for access to the ACR_StringDictionary_t type
+
+    a read-only set of sorted strings in one buffer, where
+    each string has an id that is its position in the sort
+    order. the strings are front coded:
+
+    - the strings are in blocks of a fixed number of strings
+    - the first string of a block is stored in full so that
+      a lookup can binary search the first strings in place
+    - every other string is stored as the number of bytes it
+      shares with the string before it and the bytes after
+      those
+
+    so a list of similar strings such as paths, URLs, or
+    identifiers costs a few bytes per string instead of an
+    allocation for each one
+
+    the buffer has a small header, the blocks, and the offset
+    of each block. all numbers are little endian and are read
+    a byte at a time, so the buffer can be written to a file
+    and used in place from a memory mapped file on any system
+    with ACR_StringDictionaryRef()
+
+*/
+#ifndef _ACR_STRINGDICTIONARY_H_
+#define _ACR_STRINGDICTIONARY_H_
+
+#include "ACR/varbuffer.h"
+
+////////////////////////////////////////////////////////////
+//
+// TYPES AND DEFINES
+//
+////////////////////////////////////////////////////////////
+
+/** the number of strings in each block when 0 is given to
+    ACR_StringDictionaryInit(). larger blocks use less memory
+    and make ACR_StringDictionaryGet() slower
+*/
+#define ACR_STRING_DICTIONARY_DEFAULT_BLOCK_SIZE 16
+
+/** string dictionary flags
+*/
+enum ACR_StringDictionaryFlags_e
+{
+	ACR_STRING_DICTIONARY_FLAGS_NONE   = 0x00,
+	/** set by ACR_StringDictionaryFinish() or
+	    ACR_StringDictionaryRef() so strings cannot be added
+	*/
+	ACR_STRING_DICTIONARY_IS_READ_ONLY = 0x01
+};
+
+#ifdef ACR_COMPILER_VS2017
+#pragma warning(push)
+// disable warning C4820: padding added after data member
+#pragma warning(disable:4820)
+#endif
+/** type for a front coded string dictionary
+*/
+typedef struct ACR_StringDictionary_s
+{
+	/** the header, the blocks, and the block offsets, which
+	    can be written to a file once the dictionary is read
+		only
+	*/
+	ACR_VarBuffer_t m_Data;
+
+	/** the block offsets while strings are added
+	*/
+	ACR_VarBuffer_t m_Offsets;
+
+	/** the last string added
+	*/
+	ACR_VarBuffer_t m_Last;
+
+	/** the first block
+	*/
+	const ACR_Byte_t* m_Blocks;
+
+	/** the offset of each block from m_Blocks
+	*/
+	const ACR_Byte_t* m_BlockOffsets;
+
+	/** the number of bytes of all of the blocks
+	*/
+	ACR_Length_t m_BlocksLength;
+
+	/** the number of bytes of the longest string
+	*/
+	ACR_Length_t m_MaxLength;
+
+	/** the number of strings
+	*/
+	ACR_Count_t m_Count;
+
+	/** the number of blocks
+	*/
+	ACR_Count_t m_BlockCount;
+
+	/** the number of strings in each block
+	*/
+	ACR_Count_t m_BlockSize;
+
+	/** see ACR_STRING_DICTIONARY_IS_READ_ONLY
+	*/
+	ACR_Flags_t m_Flags;
+} ACR_StringDictionary_t;
+#ifdef ACR_COMPILER_VS2017
+#pragma warning(pop)
+#endif
+
+////////////////////////////////////////////////////////////
+// ALLOW FUNCTIONS TO BE CALLED FROM C++                  //
+////////////////////////////////////////////////////////////
+#ifdef __cplusplus                                        //
+extern "C" {                                              //
+#endif                                                    //
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+//
+// PUBLIC FUNCTIONS
+//
+////////////////////////////////////////////////////////////
+
+/** prepare a string dictionary to add strings
+	\param me the dictionary
+	\param blockSize the number of strings in each block or
+	       0 for ACR_STRING_DICTIONARY_DEFAULT_BLOCK_SIZE
+*/
+void ACR_StringDictionaryInit(
+	ACR_StringDictionary_t* me,
+	ACR_Count_t blockSize);
+
+/** free string dictionary memory. memory that was used in
+    place by ACR_StringDictionaryRef() is not freed
+*/
+void ACR_StringDictionaryDeInit(
+	ACR_StringDictionary_t* me);
+
+/** add the next string. the id of the string is the number
+    of strings added before it
+	\param me the dictionary
+	\param string the string, which must be after the last
+	       string added in byte order
+	\returns ACR_INFO_OK or ACR_INFO_ERROR if the string is
+	         not after the last one, the dictionary is read
+			 only, it would be larger than 4GB, or memory
+			 could not be allocated
+*/
+ACR_Info_t ACR_StringDictionaryAdd(
+	ACR_StringDictionary_t* me,
+	ACR_String_t string);
+
+/** finish adding strings and make the dictionary read only
+	\param me the dictionary
+	\returns ACR_INFO_OK or ACR_INFO_ERROR if memory could not
+	         be allocated
+*/
+ACR_Info_t ACR_StringDictionaryFinish(
+	ACR_StringDictionary_t* me);
+
+/** use the buffer of a finished dictionary in place without
+    copying or reading the strings. this is intended for
+	memory mapped files
+	\param me the dictionary, which becomes read only
+	\param src the buffer, which must stay valid and unchanged
+	       as long as the dictionary is used
+	\param length the length of src
+	\returns ACR_INFO_OK or ACR_INFO_ERROR if the header is not
+	         valid
+*/
+ACR_Info_t ACR_StringDictionaryRef(
+	ACR_StringDictionary_t* me,
+	const void* src,
+	ACR_Length_t length);
+
+/** find the id of a string
+	\param me a read only dictionary
+	\param string the string
+	\param id location to store the id or ACR_NULL
+	\returns ACR_INFO_OK or ACR_INFO_UNKNOWN if not found
+*/
+ACR_Info_t ACR_StringDictionaryFind(
+	const ACR_StringDictionary_t* me,
+	ACR_String_t string,
+	ACR_Count_t* id);
+
+/** get the string of an id
+	\param me a read only dictionary
+	\param id the id
+	\param memory location to write the bytes of the string,
+	       with room for m_MaxLength bytes
+	\param memoryLength the number of bytes of memory
+	\param string location to store a reference to the string
+	       in memory
+	\returns - ACR_INFO_OK if the string was written
+	         - ACR_INFO_UNKNOWN if there is no string with the
+			   id
+	         - ACR_INFO_ERROR if memory is too small or the
+			   dictionary data is not valid
+*/
+ACR_Info_t ACR_StringDictionaryGet(
+	const ACR_StringDictionary_t* me,
+	ACR_Count_t id,
+	ACR_Byte_t* memory,
+	ACR_Length_t memoryLength,
+	ACR_String_t* string);
+
+////////////////////////////////////////////////////////////
+// ALLOW FUNCTIONS TO BE CALLED FROM C++                  //
+////////////////////////////////////////////////////////////
+#ifdef __cplusplus                                        //
+}                                                         //
+#endif                                                    //
+////////////////////////////////////////////////////////////
+
+#endif
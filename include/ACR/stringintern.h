@@ -0,0 +1,201 @@
+/*
+
+    ********** DO NOT REMOVE THIS INFORMATION ************
+
+    ACR - A set of C functions in a git Repository
+    Copyright (C) 2018 - 2020 Adam C. Rosenberg
+
+    Please read LICENSE before using this code
+
+    Please read README.md for instructions on including
+    this code in your project and where to find examples
+
+    If you contribute to this code, Please add your name
+    and email address to the AUTHORS list below so that
+    we know who to thank!
+
+    AUTHORS
+
+    Adam Rosenberg <adam@sirspot.com>
+
+    LICENSE
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+    ******************************************************
+
+*/
+/** \file stringintern.h
+
+    global tables of unique strings so that equal strings
+    share the same memory and can be compared by pointer
+
+    Note: when ACR_NO_THREADS is not defined the tables can
+          be used from many threads at the same time. finding
+          a string that is already in a table does not lock
+          and only adding a new string locks the table
+
+*/
+#ifndef _ACR_STRINGINTERN_H_
+#define _ACR_STRINGINTERN_H_
+
+#include "ACR/public.h"
+
+////////////////////////////////////////////////////////////
+//
+// TYPES AND DEFINES
+//
+////////////////////////////////////////////////////////////
+
+#ifndef ACR_STRING_INTERN_BLOCK_LENGTH
+/** the number of bytes allocated at a time for the memory
+    of the interned strings. longer strings get a block of
+    their own
+*/
+#define ACR_STRING_INTERN_BLOCK_LENGTH 65536
+#endif
+
+#ifndef ACR_STRING_INTERN_LOOKUP_STATS
+/** set to ACR_BOOL_TRUE to count lookups and probes. this
+    is off by default since every thread adds to the same
+	counters, which slows down lookups from many threads
+*/
+#define ACR_STRING_INTERN_LOOKUP_STATS ACR_BOOL_FALSE
+#endif
+
+/** check if two strings returned by ACR_StringIntern() with
+    the same caseSensitive value are equal
+*/
+#define ACR_STRING_INTERN_EQUAL(a, b) ((a).m_Buffer.m_Pointer == (b).m_Buffer.m_Pointer)
+
+#ifdef ACR_COMPILER_VS2017
+#pragma warning(push)
+// disable warning C4820: padding added after data member
+#pragma warning(disable:4820)
+#endif
+/** type for the memory use and lookups of a string intern
+    table
+*/
+typedef struct ACR_StringInternStats_s
+{
+	/** the number of unique strings
+	*/
+	ACR_Count_t m_Count;
+
+	/** the number of slots in the hash table
+	*/
+	ACR_Count_t m_Capacity;
+
+	/** the number of bytes of string data
+	*/
+	ACR_Length_t m_StringBytes;
+
+	/** the number of bytes allocated for strings including
+	    unused space at the end of each block
+	*/
+	ACR_Length_t m_ArenaBytes;
+
+	/** the number of bytes allocated for the hash table,
+	    including smaller tables kept for threads that may
+		still be reading them
+	*/
+	ACR_Length_t m_TableBytes;
+
+	/** the number of calls to ACR_StringIntern(), which is
+	    always 0 unless ACR_STRING_INTERN_LOOKUP_STATS is true
+	*/
+	ACR_Length_t m_Lookups;
+
+	/** the number of slots checked by those lookups, which
+	    is always 0 unless ACR_STRING_INTERN_LOOKUP_STATS is
+		true
+	*/
+	ACR_Length_t m_Probes;
+} ACR_StringInternStats_t;
+#ifdef ACR_COMPILER_VS2017
+#pragma warning(pop)
+#endif
+
+////////////////////////////////////////////////////////////
+// ALLOW FUNCTIONS TO BE CALLED FROM C++                  //
+////////////////////////////////////////////////////////////
+#ifdef __cplusplus                                        //
+extern "C" {                                              //
+#endif                                                    //
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+//
+// PUBLIC FUNCTIONS
+//
+////////////////////////////////////////////////////////////
+
+/** get the one copy of a string that is shared by every
+    equal string
+
+    example:
+
+	ACR_String_t a = ACR_StringIntern(name, ACR_INFO_YES);
+	ACR_String_t b = ACR_StringIntern(otherName, ACR_INFO_YES);
+	if(ACR_STRING_INTERN_EQUAL(a, b))
+	{
+		// name and otherName are the same
+	}
+
+	Note: the string data is copied the first time and is
+	      null-terminated. it is never moved or freed until
+		  ACR_StringInternFree() is called
+	Note: strings that are equal when case is ignored get
+	      the first one added to the case-insensitive table,
+		  which is separate from the case-sensitive table
+	\param src the UTF8 string
+	\param caseSensitive set to ACR_INFO_YES to intern the
+	       exact bytes or ACR_INFO_NO to ignore case
+	\returns the interned string or an empty string with
+	         m_Buffer.m_Pointer set to ACR_NULL if memory
+			 could not be allocated
+*/
+ACR_String_t ACR_StringIntern(
+	ACR_String_t src,
+	ACR_Info_t caseSensitive);
+
+/** get the memory use and lookup counts of a table
+
+	Note: the counts are not read at the same time, so they
+	      may not agree while other threads add strings
+	\param caseSensitive ACR_INFO_YES for the case-sensitive
+	       table or ACR_INFO_NO for the case-insensitive table
+	\param stats location to store the stats
+*/
+void ACR_StringInternGetStats(
+	ACR_Info_t caseSensitive,
+	ACR_StringInternStats_t* stats);
+
+/** free the memory of both tables
+
+	Note: every interned string is invalid after this, and
+	      no other thread can use the tables while this runs
+*/
+void ACR_StringInternFree(void);
+
+////////////////////////////////////////////////////////////
+// ALLOW FUNCTIONS TO BE CALLED FROM C++                  //
+////////////////////////////////////////////////////////////
+#ifdef __cplusplus                                        //
+}                                                         //
+#endif                                                    //
+////////////////////////////////////////////////////////////
+
+#endif
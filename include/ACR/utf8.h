@@ -0,0 +1,335 @@
+/*
+
+    ********** DO NOT REMOVE THIS INFORMATION ************
+
+    ACR - A set of C functions in a git Repository
+    Copyright (C) 2018 - 2020 Adam C. Rosenberg
+
+    Please read LICENSE before using this code
+
+    Please read README.md for instructions on including
+    this code in your project and where to find examples
+
+    If you contribute to this code, Please add your name
+    and email address to the AUTHORS list below so that
+    we know who to thank!
+
+    AUTHORS
+
+    Adam Rosenberg <adam@sirspot.com>
+
+    LICENSE
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+    ******************************************************
+
+*/
+/** \file utf8.h
+
+    functions to check and convert UTF8 encoded data
+
+    UTF16 and UTF32 data is always little-endian (UTF16LE
+    and UTF32LE) stored as bytes, no matter the byte order
+    of the system, and has no byte order mark
+
+    valid UTF8 follows the "well-formed byte sequences" table
+    of the unicode standard, which means:
+
+    - no overlong encodings such as C0 80 for U+0000
+    - no surrogates U+D800 to U+DFFF
+    - no values above U+10FFFF
+    - no missing or extra continuation bytes
+
+*/
+#ifndef _ACR_UTF8_H_
+#define _ACR_UTF8_H_
+
+#include "ACR/varbuffer.h"
+
+////////////////////////////////////////////////////////////
+//
+// TYPES AND DEFINES
+//
+////////////////////////////////////////////////////////////
+
+/** the unicode replacement character used in place of
+    invalid UTF8 data
+*/
+#define ACR_UNICODE_REPLACEMENT 0xFFFD
+
+/** the UTF8 encoding of ACR_UNICODE_REPLACEMENT
+*/
+#define ACR_UTF8_REPLACEMENT "\xEF\xBF\xBD"
+#define ACR_UTF8_REPLACEMENT_LENGTH 3
+
+#ifdef ACR_COMPILER_VS2017
+#pragma warning(push)
+// disable warning C4820: padding added after data member
+#pragma warning(disable:4820)
+#endif
+/** state for decoding UTF8 data that arrives in chunks,
+    such as from a file or socket, where a character can be
+	split between two chunks
+	\see ACR_Utf8DecoderInit()
+*/
+typedef struct ACR_Utf8Decoder_s
+{
+	/** the bits of the character decoded so far
+	*/
+	ACR_Unicode_t m_Codepoint;
+
+	/** the number of invalid sequences that were replaced
+	    with ACR_UNICODE_REPLACEMENT
+	*/
+	ACR_Count_t m_ErrorCount;
+
+	/** the position in the current character
+	*/
+	ACR_Byte_t m_State;
+
+} ACR_Utf8Decoder_t;
+#ifdef ACR_COMPILER_VS2017
+#pragma warning(pop)
+#endif
+
+////////////////////////////////////////////////////////////
+// ALLOW FUNCTIONS TO BE CALLED FROM C++                  //
+////////////////////////////////////////////////////////////
+#ifdef __cplusplus                                        //
+extern "C" {                                              //
+#endif                                                    //
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+//
+// PUBLIC FUNCTIONS
+//
+////////////////////////////////////////////////////////////
+
+/** check that data is valid UTF8
+	\param src the data to check
+	\param length the number of bytes to check
+	\param errorOffset location to store the offset of the first
+	       byte of the first invalid sequence or ACR_NULL
+	\returns ACR_INFO_VALID, ACR_INFO_INVALID, or ACR_INFO_ERROR
+
+	Note: when ACR_HAS_SSSE3 is ACR_BOOL_TRUE the data is checked
+	      64 bytes at a time with lookup tables for each 4 bit
+		  part of each pair of bytes, otherwise runs of ASCII
+		  are skipped with SSE2 or one ACR_Block_t at a time and
+		  the rest is checked one character at a time
+*/
+ACR_Info_t ACR_Utf8Validate(
+	const ACR_Byte_t* src,
+	ACR_Length_t length,
+	ACR_Length_t* errorOffset);
+
+/** append data to the end of a variable length buffer and replace
+    invalid UTF8 data with ACR_UTF8_REPLACEMENT
+	\param dst the buffer will grow if needed
+	\param src the data to copy
+	\param length the number of bytes to copy
+	\param replacedCount location to store the number of
+	       replacements or ACR_NULL
+	\returns ACR_INFO_OK or ACR_INFO_ERROR
+
+	Note: each maximal part of an invalid sequence is replaced
+	      by a single ACR_UTF8_REPLACEMENT as recommended by the
+		  unicode standard. for example E1 80 41 becomes EF BF BD 41
+*/
+ACR_Info_t ACR_Utf8Sanitize(
+	ACR_VarBuffer_t* dst,
+	const ACR_Byte_t* src,
+	ACR_Length_t length,
+	ACR_Count_t* replacedCount);
+
+/** get the number of bytes needed to convert UTF8 data
+    to UTF16LE
+	\param src the UTF8 data
+	\param length the number of bytes of UTF8 data
+	\param utf16Length location to store the number of bytes
+	       of UTF16LE data
+	\returns ACR_INFO_VALID, ACR_INFO_INVALID, or ACR_INFO_ERROR
+*/
+ACR_Info_t ACR_Utf8ToUtf16Length(
+	const ACR_Byte_t* src,
+	ACR_Length_t length,
+	ACR_Length_t* utf16Length);
+
+/** get the number of bytes needed to convert UTF8 data
+    to UTF32LE
+	\param src the UTF8 data
+	\param length the number of bytes of UTF8 data
+	\param utf32Length location to store the number of bytes
+	       of UTF32LE data
+	\returns ACR_INFO_VALID, ACR_INFO_INVALID, or ACR_INFO_ERROR
+*/
+ACR_Info_t ACR_Utf8ToUtf32Length(
+	const ACR_Byte_t* src,
+	ACR_Length_t length,
+	ACR_Length_t* utf32Length);
+
+/** get the number of bytes needed to convert UTF16LE data
+    to UTF8
+	\param src the UTF16LE data
+	\param length the number of bytes of UTF16LE data
+	\param utf8Length location to store the number of bytes
+	       of UTF8 data
+	\returns ACR_INFO_VALID, ACR_INFO_INVALID if there is an
+	         unpaired surrogate or an odd number of bytes, or
+			 ACR_INFO_ERROR
+*/
+ACR_Info_t ACR_Utf16ToUtf8Length(
+	const ACR_Byte_t* src,
+	ACR_Length_t length,
+	ACR_Length_t* utf8Length);
+
+/** get the number of bytes needed to convert UTF32LE data
+    to UTF8
+	\param src the UTF32LE data
+	\param length the number of bytes of UTF32LE data
+	\param utf8Length location to store the number of bytes
+	       of UTF8 data
+	\returns ACR_INFO_VALID, ACR_INFO_INVALID if there is a
+	         surrogate, a value above U+10FFFF, or the length is
+			 not a multiple of 4, or ACR_INFO_ERROR
+*/
+ACR_Info_t ACR_Utf32ToUtf8Length(
+	const ACR_Byte_t* src,
+	ACR_Length_t length,
+	ACR_Length_t* utf8Length);
+
+/** convert UTF8 data to UTF16LE at the end of a variable
+    length buffer
+	\param dst the buffer will grow to the exact size needed
+	\param src the UTF8 data
+	\param length the number of bytes of UTF8 data
+	\param errorOffset location to store the offset of the first
+	       invalid byte of src or ACR_NULL
+	\returns ACR_INFO_VALID, ACR_INFO_INVALID, or ACR_INFO_ERROR.
+	         nothing is added to dst unless ACR_INFO_VALID
+
+	Note: src is checked with ACR_Utf8Validate() before it is
+	      converted and runs of ASCII are converted 16 bytes at
+		  a time when ACR_HAS_SSE2 is ACR_BOOL_TRUE
+*/
+ACR_Info_t ACR_Utf8ToUtf16(
+	ACR_VarBuffer_t* dst,
+	const ACR_Byte_t* src,
+	ACR_Length_t length,
+	ACR_Length_t* errorOffset);
+
+/** convert UTF8 data to UTF32LE at the end of a variable
+    length buffer
+	\see ACR_Utf8ToUtf16()
+*/
+ACR_Info_t ACR_Utf8ToUtf32(
+	ACR_VarBuffer_t* dst,
+	const ACR_Byte_t* src,
+	ACR_Length_t length,
+	ACR_Length_t* errorOffset);
+
+/** convert UTF16LE data to UTF8 at the end of a variable
+    length buffer
+	\param dst the buffer will grow to the exact size needed
+	\param src the UTF16LE data
+	\param length the number of bytes of UTF16LE data
+	\param errorOffset location to store the offset of the first
+	       invalid byte of src or ACR_NULL
+	\returns ACR_INFO_VALID, ACR_INFO_INVALID, or ACR_INFO_ERROR.
+	         nothing is added to dst unless ACR_INFO_VALID
+*/
+ACR_Info_t ACR_Utf16ToUtf8(
+	ACR_VarBuffer_t* dst,
+	const ACR_Byte_t* src,
+	ACR_Length_t length,
+	ACR_Length_t* errorOffset);
+
+/** convert UTF32LE data to UTF8 at the end of a variable
+    length buffer
+	\see ACR_Utf16ToUtf8()
+*/
+ACR_Info_t ACR_Utf32ToUtf8(
+	ACR_VarBuffer_t* dst,
+	const ACR_Byte_t* src,
+	ACR_Length_t length,
+	ACR_Length_t* errorOffset);
+
+/** prepare a decoder for the start of the data
+*/
+void ACR_Utf8DecoderInit(
+	ACR_Utf8Decoder_t* me);
+
+/** decode the next chunk of UTF8 data
+	\param me the decoder keeps any unfinished character
+	       from the end of src for the next chunk
+	\param src the next chunk of data
+	\param length the number of bytes in src
+	\param dst location to store the characters
+	\param dstCount the max number of characters to store
+	\param decodedCount location to store the number of
+	       characters stored in dst or ACR_NULL
+	\returns the number of bytes of src that were used, which
+	         is less than length only when dst is full
+
+	Note: invalid data is decoded as ACR_UNICODE_REPLACEMENT
+	      the same way as ACR_Utf8Sanitize() and counted in
+		  m_ErrorCount. each byte goes through a table driven
+		  state machine so there are no branches for the
+		  length of each character
+*/
+ACR_Length_t ACR_Utf8DecoderDecode(
+	ACR_Utf8Decoder_t* me,
+	const ACR_Byte_t* src,
+	ACR_Length_t length,
+	ACR_Unicode_t* dst,
+	ACR_Count_t dstCount,
+	ACR_Count_t* decodedCount);
+
+/** count the characters that are finished by the next chunk
+    of UTF8 data without storing them
+	\param me the decoder
+	\param src the next chunk of data
+	\param length the number of bytes in src
+	\returns the number of characters including replacements
+	         for invalid data, \see ACR_Utf8DecoderDecode()
+*/
+ACR_Count_t ACR_Utf8DecoderCount(
+	ACR_Utf8Decoder_t* me,
+	const ACR_Byte_t* src,
+	ACR_Length_t length);
+
+/** finish the data and prepare the decoder for new data
+	\param me the decoder
+	\param dst location to store ACR_UNICODE_REPLACEMENT if
+	       the data ended in the middle of a character or
+		   ACR_NULL
+	\returns 1 if the data ended in the middle of a character
+	         or 0
+*/
+ACR_Count_t ACR_Utf8DecoderFinish(
+	ACR_Utf8Decoder_t* me,
+	ACR_Unicode_t* dst);
+
+////////////////////////////////////////////////////////////
+// ALLOW FUNCTIONS TO BE CALLED FROM C++                  //
+////////////////////////////////////////////////////////////
+#ifdef __cplusplus                                        //
+}                                                         //
+#endif                                                    //
+////////////////////////////////////////////////////////////
+
+#endif
@@ -123,6 +123,22 @@ ACR_Info_t ACR_VarBufferAllocate(
 	ACR_VarBuffer_t* me,
 	ACR_Length_t length);
 
+/** make sure the max length is at least the specified length
+    without losing any of the data currently in the buffer
+	\param me the buffer
+	\param length value 1 to ACR_MAX_LENGTH
+	\returns ACR_INFO_OK or ACR_INFO_ERROR
+
+	Note: when more memory is needed the max length is at
+	      least doubled so that a series of small appends
+		  only allocates memory a few times. memory that was
+		  set with ACR_VarBufferRef() is copied to new memory
+		  and is no longer referenced
+*/
+ACR_Info_t ACR_VarBufferReserve(
+	ACR_VarBuffer_t* me,
+	ACR_Length_t length);
+
 /** set memory reference then reset the variable
     length buffer to ACR_ZERO_LENGTH
 	\param ptr pointer to the start of the memory to access
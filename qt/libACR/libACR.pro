@@ -20,16 +20,42 @@ DEFINES += ACR_PLATFORM_MAC ACR_IDE_QTCREATOR ACR_COMPILER_CLANG
 
 SOURCES += \
     $$PWD/../../src/ACR/alignedbuffer.c\
+    $$PWD/../../src/ACR/bitset.c\
     $$PWD/../../src/ACR/buffer.c\
+    $$PWD/../../src/ACR/concurrentmap.c\
+    $$PWD/../../src/ACR/format.c\
+    $$PWD/../../src/ACR/hash.c\
+    $$PWD/../../src/ACR/hashmap.c\
+    $$PWD/../../src/ACR/normalize.c\
+    $$PWD/../../src/ACR/number.c\
     $$PWD/../../src/ACR/public.c\
+    $$PWD/../../src/ACR/radixtree.c\
+    $$PWD/../../src/ACR/roaringbitmap.c\
     $$PWD/../../src/ACR/string.c\
+    $$PWD/../../src/ACR/stringdictionary.c\
+    $$PWD/../../src/ACR/stringintern.c\
+    $$PWD/../../src/ACR/timer.c\
+    $$PWD/../../src/ACR/unicodecase.c\
+    $$PWD/../../src/ACR/utf8.c\
     $$PWD/../../src/ACR/varbuffer.c\
 
 HEADERS += \
     $$PWD/../../include/ACR/alignedbuffer.h\
+    $$PWD/../../include/ACR/bitset.h\
     $$PWD/../../include/ACR/buffer.h\
+    $$PWD/../../include/ACR/concurrentmap.h\
+    $$PWD/../../include/ACR/format.h\
+    $$PWD/../../include/ACR/hash.h\
+    $$PWD/../../include/ACR/hashmap.h\
+    $$PWD/../../include/ACR/normalize.h\
+    $$PWD/../../include/ACR/number.h\
     $$PWD/../../include/ACR/public.h\
+    $$PWD/../../include/ACR/radixtree.h\
+    $$PWD/../../include/ACR/roaringbitmap.h\
     $$PWD/../../include/ACR/string.h\
+    $$PWD/../../include/ACR/stringdictionary.h\
+    $$PWD/../../include/ACR/stringintern.h\
+    $$PWD/../../include/ACR/utf8.h\
     $$PWD/../../include/ACR/varbuffer.h\
 
 # Default rules for deployment.
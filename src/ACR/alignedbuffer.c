@@ -114,6 +114,31 @@ void ACR_AlignedBufferDeInit(
 	ACR_ALIGNED_BUFFER_FREE((*me));
 }
 
+/**********************************************************/
+ACR_Info_t ACR_AlignedBufferAllocate(
+	ACR_AlignedBuffer_t* me,
+	ACR_Length_t length)
+{
+	if(me == ACR_NULL)
+	{
+		return ACR_INFO_ERROR;
+	}
+
+	if(length == 0)
+	{
+		ACR_ALIGNED_BUFFER_FREE((*me));
+		return ACR_INFO_ERROR;
+	}
+
+	ACR_ALIGNED_BUFFER_ALLOC((*me), length);
+	if(ACR_ALIGNED_BUFFER_IS_VALID((*me)))
+	{
+		return ACR_INFO_OK;
+	}
+
+	return ACR_INFO_ERROR;
+}
+
 /**********************************************************/
 ACR_Info_t ACR_AlignedBufferRef(
 	ACR_AlignedBuffer_t* me,
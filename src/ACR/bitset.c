@@ -0,0 +1,699 @@
+/*
+
+    ********** DO NOT REMOVE THIS INFORMATION ************
+
+    ACR - A set of C functions in a git Repository
+    Copyright (C) 2018 - 2020 Adam C. Rosenberg
+
+    Please read LICENSE before using this code
+
+    Please read README.md for instructions on including
+    this code in your project and where to find examples
+
+    If you contribute to this code, Please add your name
+    and email address to the AUTHORS list below so that
+    we know who to thank!
+
+    AUTHORS
+
+    Adam Rosenberg <adam@sirspot.com>
+
+    LICENSE
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+    ******************************************************
+
+*/
+/** \file bitset.c
+
+    functions for access to the ACR_Bitset_t type
+
+*/
+#include "ACR/bitset.h"
+
+////////////////////////////////////////////////////////////
+//
+// PRIVATE DEFINES
+//
+////////////////////////////////////////////////////////////
+
+/** number of blocks in a single SSE2 register
+*/
+#define ACR_BITSET_BLOCKS_PER_SIMD (16 / ACR_BYTES_PER_BLOCK)
+
+/** apply a logic operation to all blocks of two bitsets where
+    simdOp is the SSE2 function and blockOp is the C operation
+	for a single block. this loops over 4 SSE2 registers at a
+	time (or 4 blocks at a time without SSE2) and then finishes
+	any remaining blocks one at a time
+*/
+#if ACR_HAS_SSE2 == ACR_BOOL_TRUE
+#define ACR_BITSET_OPERATION(dst, src, blocks, simdOp, blockOp) \
+		{ \
+			ACR_Length_t simdLoops = (blocks) / (4 * ACR_BITSET_BLOCKS_PER_SIMD); \
+			ACR_Length_t done = simdLoops * (4 * ACR_BITSET_BLOCKS_PER_SIMD); \
+			__m128i* d = (__m128i*)(dst); \
+			const __m128i* s = (const __m128i*)(src); \
+			while(simdLoops > 0) \
+			{ \
+				_mm_store_si128(d, simdOp(_mm_load_si128(d), _mm_load_si128(s))); \
+				_mm_store_si128(d+1, simdOp(_mm_load_si128(d+1), _mm_load_si128(s+1))); \
+				_mm_store_si128(d+2, simdOp(_mm_load_si128(d+2), _mm_load_si128(s+2))); \
+				_mm_store_si128(d+3, simdOp(_mm_load_si128(d+3), _mm_load_si128(s+3))); \
+				d += 4; \
+				s += 4; \
+				simdLoops--; \
+			} \
+			while(done < (blocks)) \
+			{ \
+				(dst)[done] = blockOp((dst)[done], (src)[done]); \
+				done++; \
+			} \
+		}
+#else
+#define ACR_BITSET_OPERATION(dst, src, blocks, simdOp, blockOp) \
+		{ \
+			ACR_Length_t done = 0; \
+			ACR_Length_t unrolled = (blocks) & (~((ACR_Length_t)3)); \
+			while(done < unrolled) \
+			{ \
+				(dst)[done] = blockOp((dst)[done], (src)[done]); \
+				(dst)[done+1] = blockOp((dst)[done+1], (src)[done+1]); \
+				(dst)[done+2] = blockOp((dst)[done+2], (src)[done+2]); \
+				(dst)[done+3] = blockOp((dst)[done+3], (src)[done+3]); \
+				done += 4; \
+			} \
+			while(done < (blocks)) \
+			{ \
+				(dst)[done] = blockOp((dst)[done], (src)[done]); \
+				done++; \
+			} \
+		}
+#endif // #if ACR_HAS_SSE2 == ACR_BOOL_TRUE
+
+#define ACR_BITSET_BLOCK_AND(a, b) ((a) & (b))
+#define ACR_BITSET_BLOCK_OR(a, b) ((a) | (b))
+#define ACR_BITSET_BLOCK_XOR(a, b) ((a) ^ (b))
+#define ACR_BITSET_BLOCK_AND_NOT(a, b) ((a) & (~(b)))
+
+/** _mm_andnot_si128 is (NOT a) AND b so swap the order
+*/
+#define ACR_BITSET_SIMD_AND_NOT(a, b) _mm_andnot_si128(b, a)
+
+////////////////////////////////////////////////////////////
+//
+// PRIVATE FUNCTIONS
+//
+////////////////////////////////////////////////////////////
+
+/** check that two bitsets can be used together
+	\returns ACR_INFO_OK or ACR_INFO_ERROR
+*/
+static ACR_Info_t ACR_BitsetCheckPair(
+	ACR_Bitset_t* me,
+	ACR_Bitset_t* other)
+{
+	if((me == ACR_NULL) || (other == ACR_NULL))
+	{
+		return ACR_INFO_ERROR;
+	}
+
+	if((ACR_ALIGNED_BUFFER_IS_VALID(me->m_Memory) == ACR_BOOL_FALSE) ||
+	   (ACR_ALIGNED_BUFFER_IS_VALID(other->m_Memory) == ACR_BOOL_FALSE))
+	{
+		return ACR_INFO_ERROR;
+	}
+
+	if(me->m_BitCount != other->m_BitCount)
+	{
+		return ACR_INFO_ERROR;
+	}
+
+	// the bits are about to change
+	ACR_REMOVE_FLAGS(me->m_Flags, ACR_BITSET_HAS_RANK_INDEX);
+	return ACR_INFO_OK;
+}
+
+/** count the bits set in a range of blocks
+*/
+static ACR_Length_t ACR_BitsetCountBlocks(
+	const ACR_Block_t* blocks,
+	ACR_Length_t count)
+{
+	ACR_Length_t total0 = 0;
+	ACR_Length_t total1 = 0;
+	ACR_Length_t total2 = 0;
+	ACR_Length_t total3 = 0;
+
+	// use separate totals so that the popcount of each
+	// block does not have to wait for the previous add
+	while(count >= 4)
+	{
+		total0 += (ACR_Length_t)ACR_BLOCK_POPCOUNT(blocks[0]);
+		total1 += (ACR_Length_t)ACR_BLOCK_POPCOUNT(blocks[1]);
+		total2 += (ACR_Length_t)ACR_BLOCK_POPCOUNT(blocks[2]);
+		total3 += (ACR_Length_t)ACR_BLOCK_POPCOUNT(blocks[3]);
+		blocks += 4;
+		count -= 4;
+	}
+	while(count > 0)
+	{
+		total0 += (ACR_Length_t)ACR_BLOCK_POPCOUNT(blocks[0]);
+		blocks++;
+		count--;
+	}
+
+	return total0 + total1 + total2 + total3;
+}
+
+/** find the position of the nth set bit within a single block
+    Note: the block must have more than n bits set
+*/
+static int ACR_BitsetSelectInBlock(
+	ACR_Block_t block,
+	ACR_Length_t n)
+{
+	while(n > 0)
+	{
+		// clear the lowest set bit
+		block &= (block - 1);
+		n--;
+	}
+	return ACR_BLOCK_TRAILING_ZEROS(block);
+}
+
+////////////////////////////////////////////////////////////
+//
+// PUBLIC FUNCTIONS
+//
+////////////////////////////////////////////////////////////
+
+/**********************************************************/
+ACR_Info_t ACR_BitsetNew(
+	ACR_Bitset_t** mePtr)
+{
+	ACR_Info_t result = ACR_INFO_ERROR;
+	if(mePtr != ACR_NULL)
+	{
+		ACR_BUFFER(buffer);
+
+		ACR_BUFFER_ALLOC(buffer, sizeof(ACR_Bitset_t));
+		if(ACR_BUFFER_IS_VALID(buffer))
+		{
+			ACR_BitsetInit((ACR_Bitset_t*)buffer.m_Pointer);
+			result = ACR_INFO_OK;
+		}
+		(*mePtr) = (ACR_Bitset_t*)buffer.m_Pointer;
+	}
+	return result;
+}
+
+/**********************************************************/
+void ACR_BitsetDelete(
+	ACR_Bitset_t** mePtr)
+{
+	if(mePtr != ACR_NULL)
+	{
+		ACR_BUFFER(buffer);
+
+		ACR_BitsetDeInit((*mePtr));
+		ACR_BUFFER_REFERENCE(buffer, (*mePtr), sizeof(ACR_Bitset_t));
+		ACR_BUFFER_FORCE_FREE(buffer);
+		(*mePtr) = ACR_NULL;
+	}
+}
+
+/**********************************************************/
+void ACR_BitsetInit(
+	ACR_Bitset_t* me)
+{
+	if(me == ACR_NULL)
+	{
+		return;
+	}
+
+	me->m_Memory.m_UnalignedBuffer.m_Length = ACR_ZERO_LENGTH;
+	me->m_Memory.m_UnalignedBuffer.m_Pointer = ACR_NULL;
+	me->m_Memory.m_UnalignedBuffer.m_Flags = ACR_BUFFER_FLAGS_NONE;
+	me->m_Memory.m_AlignedBuffer.m_Length = ACR_ZERO_LENGTH;
+	me->m_Memory.m_AlignedBuffer.m_Pointer = ACR_NULL;
+	me->m_Memory.m_AlignedBuffer.m_Flags = ACR_BUFFER_FLAGS_NONE;
+	me->m_BitCount = ACR_ZERO_LENGTH;
+	me->m_BlockCount = ACR_ZERO_LENGTH;
+	me->m_RankIndex.m_Length = ACR_ZERO_LENGTH;
+	me->m_RankIndex.m_Pointer = ACR_NULL;
+	me->m_RankIndex.m_Flags = ACR_BUFFER_FLAGS_NONE;
+	me->m_Flags = ACR_BITSET_FLAGS_NONE;
+}
+
+/**********************************************************/
+void ACR_BitsetDeInit(
+	ACR_Bitset_t* me)
+{
+	if(me == ACR_NULL)
+	{
+		return;
+	}
+
+	ACR_ALIGNED_BUFFER_FREE(me->m_Memory);
+	ACR_BUFFER_FREE(me->m_RankIndex);
+	me->m_BitCount = ACR_ZERO_LENGTH;
+	me->m_BlockCount = ACR_ZERO_LENGTH;
+	me->m_Flags = ACR_BITSET_FLAGS_NONE;
+}
+
+/**********************************************************/
+ACR_Info_t ACR_BitsetAllocate(
+	ACR_Bitset_t* me,
+	ACR_Length_t bitCount)
+{
+	ACR_Length_t blockCount;
+
+	if(me == ACR_NULL)
+	{
+		return ACR_INFO_ERROR;
+	}
+
+	ACR_BitsetDeInit(me);
+	if(bitCount == 0)
+	{
+		return ACR_INFO_ERROR;
+	}
+
+	blockCount = (bitCount / ACR_BITS_PER_BLOCK) + ((bitCount % ACR_BITS_PER_BLOCK) != 0);
+	ACR_ALIGNED_BUFFER_ALLOC(me->m_Memory, (blockCount * ACR_BYTES_PER_BLOCK));
+	if(ACR_ALIGNED_BUFFER_IS_VALID(me->m_Memory) == ACR_BOOL_FALSE)
+	{
+		return ACR_INFO_ERROR;
+	}
+
+	me->m_BitCount = bitCount;
+	me->m_BlockCount = blockCount;
+	ACR_BUFFER_CLEAR(me->m_Memory.m_AlignedBuffer);
+	return ACR_INFO_OK;
+}
+
+/**********************************************************/
+ACR_Length_t ACR_BitsetGetBitCount(
+	ACR_Bitset_t* me)
+{
+	if(me == ACR_NULL)
+	{
+		return ACR_ZERO_LENGTH;
+	}
+
+	return me->m_BitCount;
+}
+
+/**********************************************************/
+ACR_Info_t ACR_BitsetSet(
+	ACR_Bitset_t* me,
+	ACR_Length_t bit)
+{
+	if(me == ACR_NULL)
+	{
+		return ACR_INFO_ERROR;
+	}
+
+	if(bit >= me->m_BitCount)
+	{
+		return ACR_INFO_ERROR;
+	}
+
+	ACR_BITSET_SET((*me), bit);
+	ACR_REMOVE_FLAGS(me->m_Flags, ACR_BITSET_HAS_RANK_INDEX);
+	return ACR_INFO_OK;
+}
+
+/**********************************************************/
+ACR_Info_t ACR_BitsetClear(
+	ACR_Bitset_t* me,
+	ACR_Length_t bit)
+{
+	if(me == ACR_NULL)
+	{
+		return ACR_INFO_ERROR;
+	}
+
+	if(bit >= me->m_BitCount)
+	{
+		return ACR_INFO_ERROR;
+	}
+
+	ACR_BITSET_CLEAR((*me), bit);
+	ACR_REMOVE_FLAGS(me->m_Flags, ACR_BITSET_HAS_RANK_INDEX);
+	return ACR_INFO_OK;
+}
+
+/**********************************************************/
+ACR_Info_t ACR_BitsetTest(
+	ACR_Bitset_t* me,
+	ACR_Length_t bit)
+{
+	if(me == ACR_NULL)
+	{
+		return ACR_INFO_FALSE;
+	}
+
+	if(bit >= me->m_BitCount)
+	{
+		return ACR_INFO_FALSE;
+	}
+
+	return ACR_BITSET_TEST((*me), bit) ? ACR_INFO_TRUE : ACR_INFO_FALSE;
+}
+
+/**********************************************************/
+void ACR_BitsetSetAll(
+	ACR_Bitset_t* me)
+{
+	ACR_Length_t extraBits;
+
+	if(me == ACR_NULL)
+	{
+		return;
+	}
+
+	if(ACR_ALIGNED_BUFFER_IS_VALID(me->m_Memory) == ACR_BOOL_FALSE)
+	{
+		return;
+	}
+
+	ACR_MEMSET(me->m_Memory.m_AlignedBuffer.m_Pointer, 0xFF, (size_t)me->m_Memory.m_AlignedBuffer.m_Length);
+
+	// keep the bits after m_BitCount cleared
+	extraBits = (me->m_BlockCount * ACR_BITS_PER_BLOCK) - me->m_BitCount;
+	if(extraBits > 0)
+	{
+		ACR_BITSET_BLOCKS((*me))[me->m_BlockCount-1] = ((~((ACR_Block_t)0)) >> extraBits);
+	}
+	ACR_REMOVE_FLAGS(me->m_Flags, ACR_BITSET_HAS_RANK_INDEX);
+}
+
+/**********************************************************/
+void ACR_BitsetClearAll(
+	ACR_Bitset_t* me)
+{
+	if(me == ACR_NULL)
+	{
+		return;
+	}
+
+	if(ACR_ALIGNED_BUFFER_IS_VALID(me->m_Memory) == ACR_BOOL_FALSE)
+	{
+		return;
+	}
+
+	ACR_BUFFER_CLEAR(me->m_Memory.m_AlignedBuffer);
+	ACR_REMOVE_FLAGS(me->m_Flags, ACR_BITSET_HAS_RANK_INDEX);
+}
+
+/**********************************************************/
+ACR_Info_t ACR_BitsetAnd(
+	ACR_Bitset_t* me,
+	ACR_Bitset_t* other)
+{
+	if(ACR_BitsetCheckPair(me, other) != ACR_INFO_OK)
+	{
+		return ACR_INFO_ERROR;
+	}
+
+	ACR_BITSET_OPERATION(ACR_BITSET_BLOCKS((*me)), ACR_BITSET_BLOCKS((*other)), me->m_BlockCount, _mm_and_si128, ACR_BITSET_BLOCK_AND);
+	return ACR_INFO_OK;
+}
+
+/**********************************************************/
+ACR_Info_t ACR_BitsetOr(
+	ACR_Bitset_t* me,
+	ACR_Bitset_t* other)
+{
+	if(ACR_BitsetCheckPair(me, other) != ACR_INFO_OK)
+	{
+		return ACR_INFO_ERROR;
+	}
+
+	ACR_BITSET_OPERATION(ACR_BITSET_BLOCKS((*me)), ACR_BITSET_BLOCKS((*other)), me->m_BlockCount, _mm_or_si128, ACR_BITSET_BLOCK_OR);
+	return ACR_INFO_OK;
+}
+
+/**********************************************************/
+ACR_Info_t ACR_BitsetXor(
+	ACR_Bitset_t* me,
+	ACR_Bitset_t* other)
+{
+	if(ACR_BitsetCheckPair(me, other) != ACR_INFO_OK)
+	{
+		return ACR_INFO_ERROR;
+	}
+
+	ACR_BITSET_OPERATION(ACR_BITSET_BLOCKS((*me)), ACR_BITSET_BLOCKS((*other)), me->m_BlockCount, _mm_xor_si128, ACR_BITSET_BLOCK_XOR);
+	return ACR_INFO_OK;
+}
+
+/**********************************************************/
+ACR_Info_t ACR_BitsetAndNot(
+	ACR_Bitset_t* me,
+	ACR_Bitset_t* other)
+{
+	if(ACR_BitsetCheckPair(me, other) != ACR_INFO_OK)
+	{
+		return ACR_INFO_ERROR;
+	}
+
+	ACR_BITSET_OPERATION(ACR_BITSET_BLOCKS((*me)), ACR_BITSET_BLOCKS((*other)), me->m_BlockCount, ACR_BITSET_SIMD_AND_NOT, ACR_BITSET_BLOCK_AND_NOT);
+	return ACR_INFO_OK;
+}
+
+/**********************************************************/
+ACR_Length_t ACR_BitsetCount(
+	ACR_Bitset_t* me)
+{
+	if(me == ACR_NULL)
+	{
+		return ACR_ZERO_LENGTH;
+	}
+
+	if(ACR_ALIGNED_BUFFER_IS_VALID(me->m_Memory) == ACR_BOOL_FALSE)
+	{
+		return ACR_ZERO_LENGTH;
+	}
+
+	return ACR_BitsetCountBlocks(ACR_BITSET_BLOCKS((*me)), me->m_BlockCount);
+}
+
+/**********************************************************/
+ACR_Info_t ACR_BitsetFindNext(
+	ACR_Bitset_t* me,
+	ACR_Length_t from,
+	ACR_Length_t* found)
+{
+	ACR_Block_t* blocks;
+	ACR_Length_t blockIndex;
+	ACR_Block_t block;
+
+	if((me == ACR_NULL) || (found == ACR_NULL))
+	{
+		return ACR_INFO_ERROR;
+	}
+
+	if(from >= me->m_BitCount)
+	{
+		return ACR_INFO_ERROR;
+	}
+
+	blocks = ACR_BITSET_BLOCKS((*me));
+	blockIndex = ACR_BITSET_BLOCK_INDEX(from);
+
+	// ignore the bits before from in the first block
+	block = blocks[blockIndex] & (~(ACR_BITSET_BLOCK_MASK(from) - 1));
+	while(block == 0)
+	{
+		blockIndex++;
+		if(blockIndex >= me->m_BlockCount)
+		{
+			return ACR_INFO_ERROR;
+		}
+		block = blocks[blockIndex];
+	}
+
+	(*found) = (blockIndex * ACR_BITS_PER_BLOCK) + (ACR_Length_t)ACR_BLOCK_TRAILING_ZEROS(block);
+	return ACR_INFO_OK;
+}
+
+/**********************************************************/
+ACR_Info_t ACR_BitsetBuildRankIndex(
+	ACR_Bitset_t* me)
+{
+	ACR_Length_t sampleCount;
+	ACR_Length_t* samples;
+	ACR_Length_t total;
+	ACR_Length_t i;
+
+	if(me == ACR_NULL)
+	{
+		return ACR_INFO_ERROR;
+	}
+
+	if(ACR_ALIGNED_BUFFER_IS_VALID(me->m_Memory) == ACR_BOOL_FALSE)
+	{
+		return ACR_INFO_ERROR;
+	}
+
+	// one sample at the start of each group of blocks plus
+	// one more sample for the total at the end
+	sampleCount = (me->m_BlockCount / ACR_BITSET_RANK_SAMPLE_BLOCKS) + 2;
+	if(me->m_RankIndex.m_Length != (sampleCount * sizeof(ACR_Length_t)))
+	{
+		ACR_BUFFER_ALLOC(me->m_RankIndex, (sampleCount * sizeof(ACR_Length_t)));
+		if(ACR_BUFFER_IS_VALID(me->m_RankIndex) == ACR_BOOL_FALSE)
+		{
+			ACR_REMOVE_FLAGS(me->m_Flags, ACR_BITSET_HAS_RANK_INDEX);
+			return ACR_INFO_ERROR;
+		}
+	}
+
+	samples = (ACR_Length_t*)me->m_RankIndex.m_Pointer;
+	total = 0;
+	for(i = 0; i < (sampleCount - 1); i++)
+	{
+		ACR_Length_t first = i * ACR_BITSET_RANK_SAMPLE_BLOCKS;
+		ACR_Length_t count = ACR_BITSET_RANK_SAMPLE_BLOCKS;
+		samples[i] = total;
+		if(first >= me->m_BlockCount)
+		{
+			count = 0;
+		}
+		else if((first + count) > me->m_BlockCount)
+		{
+			count = me->m_BlockCount - first;
+		}
+		total += ACR_BitsetCountBlocks(ACR_BITSET_BLOCKS((*me)) + first, count);
+	}
+	samples[sampleCount - 1] = total;
+
+	ACR_ADD_FLAGS(me->m_Flags, ACR_BITSET_HAS_RANK_INDEX);
+	return ACR_INFO_OK;
+}
+
+/**********************************************************/
+ACR_Length_t ACR_BitsetRank(
+	ACR_Bitset_t* me,
+	ACR_Length_t bit)
+{
+	ACR_Block_t* blocks;
+	ACR_Length_t blockIndex;
+	ACR_Length_t firstBlock;
+	ACR_Length_t rank;
+
+	if(me == ACR_NULL)
+	{
+		return ACR_ZERO_LENGTH;
+	}
+
+	if(ACR_ALIGNED_BUFFER_IS_VALID(me->m_Memory) == ACR_BOOL_FALSE)
+	{
+		return ACR_ZERO_LENGTH;
+	}
+
+	if(bit >= me->m_BitCount)
+	{
+		return ACR_BitsetCount(me);
+	}
+
+	blocks = ACR_BITSET_BLOCKS((*me));
+	blockIndex = ACR_BITSET_BLOCK_INDEX(bit);
+	if(ACR_HAS_FLAG(me->m_Flags, ACR_BITSET_HAS_RANK_INDEX))
+	{
+		ACR_Length_t sample = blockIndex / ACR_BITSET_RANK_SAMPLE_BLOCKS;
+		firstBlock = sample * ACR_BITSET_RANK_SAMPLE_BLOCKS;
+		rank = ((ACR_Length_t*)me->m_RankIndex.m_Pointer)[sample];
+	}
+	else
+	{
+		firstBlock = 0;
+		rank = 0;
+	}
+
+	rank += ACR_BitsetCountBlocks(blocks + firstBlock, blockIndex - firstBlock);
+	rank += (ACR_Length_t)ACR_BLOCK_POPCOUNT(blocks[blockIndex] & (ACR_BITSET_BLOCK_MASK(bit) - 1));
+	return rank;
+}
+
+/**********************************************************/
+ACR_Info_t ACR_BitsetSelect(
+	ACR_Bitset_t* me,
+	ACR_Length_t n,
+	ACR_Length_t* found)
+{
+	ACR_Block_t* blocks;
+	ACR_Length_t blockIndex;
+	ACR_Length_t bits;
+
+	if((me == ACR_NULL) || (found == ACR_NULL))
+	{
+		return ACR_INFO_ERROR;
+	}
+
+	if(ACR_ALIGNED_BUFFER_IS_VALID(me->m_Memory) == ACR_BOOL_FALSE)
+	{
+		return ACR_INFO_ERROR;
+	}
+
+	blocks = ACR_BITSET_BLOCKS((*me));
+	blockIndex = 0;
+	if(ACR_HAS_FLAG(me->m_Flags, ACR_BITSET_HAS_RANK_INDEX))
+	{
+		// binary search for the last sample that is not
+		// greater than n
+		ACR_Length_t* samples = (ACR_Length_t*)me->m_RankIndex.m_Pointer;
+		ACR_Length_t sampleCount = me->m_RankIndex.m_Length / sizeof(ACR_Length_t);
+		ACR_Length_t low = 0;
+		ACR_Length_t high = sampleCount - 1;
+		if(n >= samples[high])
+		{
+			// not enough bits are set
+			return ACR_INFO_ERROR;
+		}
+		while((high - low) > 1)
+		{
+			ACR_Length_t middle = low + ((high - low) / 2);
+			if(samples[middle] <= n)
+			{
+				low = middle;
+			}
+			else
+			{
+				high = middle;
+			}
+		}
+		blockIndex = low * ACR_BITSET_RANK_SAMPLE_BLOCKS;
+		n -= samples[low];
+	}
+
+	while(blockIndex < me->m_BlockCount)
+	{
+		bits = (ACR_Length_t)ACR_BLOCK_POPCOUNT(blocks[blockIndex]);
+		if(n < bits)
+		{
+			(*found) = (blockIndex * ACR_BITS_PER_BLOCK) + (ACR_Length_t)ACR_BitsetSelectInBlock(blocks[blockIndex], n);
+			return ACR_INFO_OK;
+		}
+		n -= bits;
+		blockIndex++;
+	}
+
+	return ACR_INFO_ERROR;
+}
@@ -0,0 +1,917 @@
+/*
+
+    ********** DO NOT REMOVE THIS INFORMATION ************
+
+    ACR - A set of C functions in a git Repository
+    Copyright (C) 2018 - 2020 Adam C. Rosenberg
+
+    Please read LICENSE before using this code
+
+    Please read README.md for instructions on including
+    this code in your project and where to find examples
+
+    If you contribute to this code, Please add your name
+    and email address to the AUTHORS list below so that
+    we know who to thank!
+
+    AUTHORS
+
+    Adam Rosenberg <adam@sirspot.com>
+
+    LICENSE
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+    ******************************************************
+
+*/
+/** \file concurrentmap.c
+
+    functions for access to the ACR_ConcurrentMap_t type
+
+    Each shard is an open addressing hash table of the hash
+    of each key and a pointer to its entry, and each entry is
+    a header followed by the value and the key as words.
+
+    Readers use a sequence lock: they read the sequence
+    number, read the table without locking, and check that
+    the sequence number did not change. Writers make the
+    number odd while they change the entries or the table,
+    and every word a reader may see at the same time is read
+    and written atomically, so a reader that races a writer
+    only ever wastes its read. Growing a shard fills in a new
+    table that readers see only when it is complete, so the
+    sequence number does not change for it.
+
+*/
+#include "ACR/concurrentmap.h"
+#include "ACR/hash.h"
+
+// included for memcmp(), memcpy(), and memset()
+#include <string.h>
+
+////////////////////////////////////////////////////////////
+//
+// PRIVATE DEFINES
+//
+////////////////////////////////////////////////////////////
+
+// the shards are locked with the native lock functions and
+// read with atomic loads when threads are available
+#ifndef ACR_NO_THREADS
+#if defined(ACR_COMPILER_GCC) || defined(ACR_COMPILER_CLANG) || defined(ACR_COMPILER_MINGW)
+#define ACR_CONCURRENT_MAP_HAS_THREADS ACR_BOOL_TRUE
+#define ACR_CONCURRENT_MAP_LOAD(word) __atomic_load_n(&(word), __ATOMIC_RELAXED)
+#define ACR_CONCURRENT_MAP_STORE(word, value) __atomic_store_n(&(word), (value), __ATOMIC_RELAXED);
+#define ACR_CONCURRENT_MAP_ACQUIRE(word) __atomic_load_n(&(word), __ATOMIC_ACQUIRE)
+#define ACR_CONCURRENT_MAP_RELEASE(word, value) __atomic_store_n(&(word), (value), __ATOMIC_RELEASE);
+#define ACR_CONCURRENT_MAP_ACQUIRE_POINTER(ptr) __atomic_load_n(&(ptr), __ATOMIC_ACQUIRE)
+#define ACR_CONCURRENT_MAP_RELEASE_POINTER(ptr, value) __atomic_store_n(&(ptr), (value), __ATOMIC_RELEASE);
+#define ACR_CONCURRENT_MAP_FENCE_ACQUIRE() __atomic_thread_fence(__ATOMIC_ACQUIRE);
+#define ACR_CONCURRENT_MAP_FENCE_RELEASE() __atomic_thread_fence(__ATOMIC_RELEASE);
+#elif defined(_WIN32)
+// included for _ReadWriteBarrier()
+#include <intrin.h>
+#define ACR_CONCURRENT_MAP_HAS_THREADS ACR_BOOL_TRUE
+// volatile loads and stores are ordered on x86 and x64, so
+// only the compiler needs to be stopped from moving them
+#define ACR_CONCURRENT_MAP_LOAD(word) (*((volatile ACR_Length_t*)&(word)))
+#define ACR_CONCURRENT_MAP_STORE(word, value) *((volatile ACR_Length_t*)&(word)) = (value);
+#define ACR_CONCURRENT_MAP_ACQUIRE(word) ACR_ConcurrentMapAcquire((volatile ACR_Length_t*)&(word))
+#define ACR_CONCURRENT_MAP_RELEASE(word, value) _ReadWriteBarrier(); *((volatile ACR_Length_t*)&(word)) = (value);
+#define ACR_CONCURRENT_MAP_ACQUIRE_POINTER(ptr) ACR_ConcurrentMapAcquirePointer((void* volatile*)&(ptr))
+#define ACR_CONCURRENT_MAP_RELEASE_POINTER(ptr, value) _ReadWriteBarrier(); *((void* volatile*)&(ptr)) = (value);
+#define ACR_CONCURRENT_MAP_FENCE_ACQUIRE() _ReadWriteBarrier();
+#define ACR_CONCURRENT_MAP_FENCE_RELEASE() _ReadWriteBarrier();
+#endif
+#endif // #ifndef ACR_NO_THREADS
+
+#ifndef ACR_CONCURRENT_MAP_HAS_THREADS
+#define ACR_CONCURRENT_MAP_HAS_THREADS ACR_BOOL_FALSE
+#define ACR_CONCURRENT_MAP_LOAD(word) (word)
+#define ACR_CONCURRENT_MAP_STORE(word, value) (word) = (value);
+#define ACR_CONCURRENT_MAP_ACQUIRE(word) (word)
+#define ACR_CONCURRENT_MAP_RELEASE(word, value) (word) = (value);
+#define ACR_CONCURRENT_MAP_ACQUIRE_POINTER(ptr) (ptr)
+#define ACR_CONCURRENT_MAP_RELEASE_POINTER(ptr, value) (ptr) = (value);
+#define ACR_CONCURRENT_MAP_FENCE_ACQUIRE()
+#define ACR_CONCURRENT_MAP_FENCE_RELEASE()
+#endif
+
+#if ACR_CONCURRENT_MAP_HAS_THREADS == ACR_BOOL_TRUE
+#if defined(_WIN32)
+// included for AcquireSRWLockExclusive()
+#include <windows.h>
+typedef SRWLOCK ACR_ConcurrentMapLock_t;
+#define ACR_CONCURRENT_MAP_LOCK_INIT(lock) InitializeSRWLock(&(lock));
+#define ACR_CONCURRENT_MAP_LOCK_DEINIT(lock)
+#define ACR_CONCURRENT_MAP_LOCK(lock) AcquireSRWLockExclusive(&(lock));
+#define ACR_CONCURRENT_MAP_UNLOCK(lock) ReleaseSRWLockExclusive(&(lock));
+#else
+// included for pthread_mutex_lock()
+#include <pthread.h>
+typedef pthread_mutex_t ACR_ConcurrentMapLock_t;
+#define ACR_CONCURRENT_MAP_LOCK_INIT(lock) pthread_mutex_init(&(lock), ACR_NULL);
+#define ACR_CONCURRENT_MAP_LOCK_DEINIT(lock) pthread_mutex_destroy(&(lock));
+#define ACR_CONCURRENT_MAP_LOCK(lock) pthread_mutex_lock(&(lock));
+#define ACR_CONCURRENT_MAP_UNLOCK(lock) pthread_mutex_unlock(&(lock));
+#endif
+#else
+typedef int ACR_ConcurrentMapLock_t;
+#define ACR_CONCURRENT_MAP_LOCK_INIT(lock) (lock) = 0;
+#define ACR_CONCURRENT_MAP_LOCK_DEINIT(lock)
+#define ACR_CONCURRENT_MAP_LOCK(lock)
+#define ACR_CONCURRENT_MAP_UNLOCK(lock)
+#endif
+
+// the number of bits of the hash of a key
+#if ACR_USE_64BIT == ACR_BOOL_TRUE
+#define ACR_CONCURRENT_MAP_HASH_BITS 64
+#else
+#define ACR_CONCURRENT_MAP_HASH_BITS 32
+#endif
+
+// the number of times a reader tries without the lock
+// before it waits for the lock
+#define ACR_CONCURRENT_MAP_READ_ATTEMPTS 4
+
+// the number of slots in the first table of a shard
+#define ACR_CONCURRENT_MAP_MIN_CAPACITY 16
+
+// entries have room for a power of 2 key words, so an entry
+// of a removed key can be reused for a key of a similar
+// length. this is the number of different sizes
+#define ACR_CONCURRENT_MAP_CLASSES 32
+
+// the number of bytes of a word
+#define ACR_CONCURRENT_MAP_WORD sizeof(ACR_Length_t)
+
+// round a length up to a whole number of words
+#define ACR_CONCURRENT_MAP_ROUND(length) ((((length) + ACR_CONCURRENT_MAP_WORD - 1) / ACR_CONCURRENT_MAP_WORD) * ACR_CONCURRENT_MAP_WORD)
+
+// the value words of an entry, which are followed by the
+// key words
+#define ACR_CONCURRENT_MAP_WORDS(entry) ((ACR_Length_t*)(((ACR_Byte_t*)(entry)) + ACR_CONCURRENT_MAP_ROUND(sizeof(ACR_ConcurrentMapEntry_t))))
+
+// the shard of a hash
+#define ACR_CONCURRENT_MAP_SHARD(me, hash) ((ACR_ConcurrentMapShard_t*)(((ACR_Byte_t*)(me)->m_Shards) + \
+	(((ACR_Count_t)((hash) >> (ACR_CONCURRENT_MAP_HASH_BITS - 8)) & ((me)->m_ShardCount - 1)) * (me)->m_ShardLength)))
+
+////////////////////////////////////////////////////////////
+//
+// PRIVATE TYPES
+//
+////////////////////////////////////////////////////////////
+
+#ifdef ACR_COMPILER_VS2017
+#pragma warning(push)
+// disable warning C4820: padding added after data member
+#pragma warning(disable:4820)
+#endif
+/** a key and its value, which are the words after this
+    header
+*/
+typedef struct ACR_ConcurrentMapEntry_s
+{
+	/** the next removed entry of the same size
+	*/
+	struct ACR_ConcurrentMapEntry_s* m_Next;
+
+	/** the number of bytes of the key
+	*/
+	ACR_Length_t m_Length;
+
+	/** the number of key words the entry has room for, which
+	    never changes so readers can trust it
+	*/
+	ACR_Length_t m_Words;
+} ACR_ConcurrentMapEntry_t;
+
+/** the table of a shard, which is followed by m_Capacity
+    hashes and m_Capacity entry pointers
+*/
+typedef struct ACR_ConcurrentMapTable_s
+{
+	struct ACR_ConcurrentMapTable_s* m_Replaced;
+	ACR_Length_t* m_Hashes;
+	ACR_ConcurrentMapEntry_t** m_Entries;
+	ACR_Count_t m_Capacity;
+} ACR_ConcurrentMapTable_t;
+
+/** a block of memory for entries
+*/
+typedef struct ACR_ConcurrentMapBlock_s
+{
+	struct ACR_ConcurrentMapBlock_s* m_Previous;
+	ACR_Length_t m_Used;
+	ACR_Length_t m_Length;
+} ACR_ConcurrentMapBlock_t;
+
+/** a shard of the map. the members readers use come first
+    and the lock is last so that it is on another cache line
+*/
+typedef struct ACR_ConcurrentMapShard_s
+{
+	ACR_Length_t m_Sequence;
+	ACR_ConcurrentMapTable_t* m_Table;
+	ACR_Length_t m_Count;
+	ACR_ConcurrentMapEntry_t* m_Free[ACR_CONCURRENT_MAP_CLASSES];
+	ACR_ConcurrentMapBlock_t* m_Block;
+	ACR_ConcurrentMapLock_t m_Lock;
+} ACR_ConcurrentMapShard_t;
+#ifdef ACR_COMPILER_VS2017
+#pragma warning(pop)
+#endif
+
+////////////////////////////////////////////////////////////
+//
+// PRIVATE FUNCTIONS
+//
+////////////////////////////////////////////////////////////
+
+#if (ACR_CONCURRENT_MAP_HAS_THREADS == ACR_BOOL_TRUE) && !defined(ACR_COMPILER_GCC) && !defined(ACR_COMPILER_CLANG) && !defined(ACR_COMPILER_MINGW)
+/** load a word before any of the loads after it
+*/
+static ACR_Length_t ACR_ConcurrentMapAcquire(
+	volatile ACR_Length_t* word)
+{
+	ACR_Length_t value = *word;
+	_ReadWriteBarrier();
+	return value;
+}
+
+/** load a pointer before any of the loads after it
+*/
+static void* ACR_ConcurrentMapAcquirePointer(
+	void* volatile* ptr)
+{
+	void* value = *ptr;
+	_ReadWriteBarrier();
+	return value;
+}
+#endif
+
+/** hash the bytes of a key
+*/
+static ACR_Length_t ACR_ConcurrentMapHash(
+	ACR_String_t key)
+{
+	#if ACR_USE_64BIT == ACR_BOOL_TRUE
+	return ACR_Hash64((const ACR_Byte_t*)key.m_Buffer.m_Pointer, key.m_Buffer.m_Length, 0);
+	#else
+	const ACR_Byte_t* src = (const ACR_Byte_t*)key.m_Buffer.m_Pointer;
+	ACR_Length_t hash = 2166136261UL;
+	ACR_Length_t pos;
+	for(pos = 0; pos < key.m_Buffer.m_Length; pos++)
+	{
+		hash = ((hash ^ src[pos]) * 16777619UL) & 0xFFFFFFFFUL;
+	}
+	// mix so the high bits that pick the shard depend on
+	// every byte
+	hash ^= hash >> 16;
+	hash = (hash * 0x85EBCA6BUL) & 0xFFFFFFFFUL;
+	hash ^= hash >> 13;
+	hash = (hash * 0xC2B2AE35UL) & 0xFFFFFFFFUL;
+	hash ^= hash >> 16;
+	return hash;
+	#endif
+}
+
+/** check if an entry has the key while a writer may be
+    changing the entry
+*/
+static int ACR_ConcurrentMapKeyEqual(
+	const ACR_ConcurrentMapEntry_t* entry,
+	ACR_Length_t valueWords,
+	ACR_String_t key)
+{
+	const ACR_Byte_t* src = (const ACR_Byte_t*)key.m_Buffer.m_Pointer;
+	const ACR_Length_t* words;
+	ACR_Length_t count;
+	ACR_Length_t remaining;
+	ACR_Length_t word;
+	ACR_Length_t i;
+
+	if(ACR_CONCURRENT_MAP_LOAD(((ACR_ConcurrentMapEntry_t*)entry)->m_Length) != key.m_Buffer.m_Length)
+	{
+		return 0;
+	}
+	count = ACR_CONCURRENT_MAP_ROUND(key.m_Buffer.m_Length) / ACR_CONCURRENT_MAP_WORD;
+	if(count > entry->m_Words)
+	{
+		return 0;
+	}
+	words = ACR_CONCURRENT_MAP_WORDS(entry) + valueWords;
+	for(i = 0; i < count; i++)
+	{
+		remaining = key.m_Buffer.m_Length - (i * ACR_CONCURRENT_MAP_WORD);
+		word = 0;
+		memcpy(&word, src + (i * ACR_CONCURRENT_MAP_WORD), (size_t)((remaining < ACR_CONCURRENT_MAP_WORD) ? remaining : ACR_CONCURRENT_MAP_WORD));
+		if(ACR_CONCURRENT_MAP_LOAD(((ACR_Length_t*)words)[i]) != word)
+		{
+			return 0;
+		}
+	}
+	return 1;
+}
+
+/** find a key in a table and copy its value, while a writer
+    may be changing the table
+    \returns ACR_INFO_OK or ACR_INFO_UNKNOWN
+*/
+static ACR_Info_t ACR_ConcurrentMapRead(
+	const ACR_ConcurrentMap_t* me,
+	ACR_ConcurrentMapTable_t* table,
+	ACR_String_t key,
+	ACR_Length_t hash,
+	void* value)
+{
+	ACR_ConcurrentMapEntry_t* entry;
+	ACR_Length_t* words;
+	ACR_Length_t valueWords = ACR_CONCURRENT_MAP_ROUND(me->m_ValueLength) / ACR_CONCURRENT_MAP_WORD;
+	ACR_Length_t remaining;
+	ACR_Length_t word;
+	ACR_Length_t i;
+	ACR_Count_t mask = table->m_Capacity - 1;
+	ACR_Count_t pos = (ACR_Count_t)hash & mask;
+	ACR_Count_t probes;
+
+	// a table that is changing may not have an empty slot to
+	// stop at, so never look at more slots than there are
+	for(probes = 0; probes < table->m_Capacity; probes++)
+	{
+		entry = (ACR_ConcurrentMapEntry_t*)ACR_CONCURRENT_MAP_ACQUIRE_POINTER(table->m_Entries[pos]);
+		if(entry == ACR_NULL)
+		{
+			break;
+		}
+		if((ACR_CONCURRENT_MAP_LOAD(table->m_Hashes[pos]) == hash) && (ACR_ConcurrentMapKeyEqual(entry, valueWords, key) != 0))
+		{
+			if(value != ACR_NULL)
+			{
+				words = ACR_CONCURRENT_MAP_WORDS(entry);
+				for(i = 0; i < valueWords; i++)
+				{
+					remaining = me->m_ValueLength - (i * ACR_CONCURRENT_MAP_WORD);
+					word = ACR_CONCURRENT_MAP_LOAD(words[i]);
+					memcpy(((ACR_Byte_t*)value) + (i * ACR_CONCURRENT_MAP_WORD), &word,
+						(size_t)((remaining < ACR_CONCURRENT_MAP_WORD) ? remaining : ACR_CONCURRENT_MAP_WORD));
+				}
+			}
+			return ACR_INFO_OK;
+		}
+		pos = (pos + 1) & mask;
+	}
+	return ACR_INFO_UNKNOWN;
+}
+
+/** find the slot of a key while the shard is locked
+    \returns the slot or m_Capacity if not found
+*/
+static ACR_Count_t ACR_ConcurrentMapFindSlot(
+	const ACR_ConcurrentMapTable_t* table,
+	ACR_Length_t valueWords,
+	ACR_String_t key,
+	ACR_Length_t hash)
+{
+	const ACR_ConcurrentMapEntry_t* entry;
+	ACR_Count_t mask = table->m_Capacity - 1;
+	ACR_Count_t pos = (ACR_Count_t)hash & mask;
+	while(1)
+	{
+		entry = table->m_Entries[pos];
+		if(entry == ACR_NULL)
+		{
+			return table->m_Capacity;
+		}
+		if((table->m_Hashes[pos] == hash) && (entry->m_Length == key.m_Buffer.m_Length) &&
+		   ((key.m_Buffer.m_Length == 0) ||
+		    (memcmp(ACR_CONCURRENT_MAP_WORDS(entry) + valueWords, key.m_Buffer.m_Pointer, (size_t)key.m_Buffer.m_Length) == 0)))
+		{
+			return pos;
+		}
+		pos = (pos + 1) & mask;
+	}
+}
+
+#if ACR_HAS_MALLOC == ACR_BOOL_TRUE
+
+/** make the value of an entry the bytes given, or
+    zeros, while the sequence number is odd
+*/
+static void ACR_ConcurrentMapStoreValue(
+	ACR_Length_t* words,
+	ACR_Length_t valueLength,
+	const void* value)
+{
+	ACR_Length_t remaining;
+	ACR_Length_t word;
+	ACR_Length_t i;
+	for(i = 0; (i * ACR_CONCURRENT_MAP_WORD) < valueLength; i++)
+	{
+		remaining = valueLength - (i * ACR_CONCURRENT_MAP_WORD);
+		word = 0;
+		if(value != ACR_NULL)
+		{
+			memcpy(&word, ((const ACR_Byte_t*)value) + (i * ACR_CONCURRENT_MAP_WORD),
+				(size_t)((remaining < ACR_CONCURRENT_MAP_WORD) ? remaining : ACR_CONCURRENT_MAP_WORD));
+		}
+		ACR_CONCURRENT_MAP_STORE(words[i], word)
+	}
+}
+
+/** make the table of a shard larger while the shard is
+    locked. readers keep using the current table until the
+    larger one is filled in
+    \returns ACR_INFO_OK or ACR_INFO_ERROR
+*/
+static ACR_Info_t ACR_ConcurrentMapGrow(
+	ACR_ConcurrentMapShard_t* shard)
+{
+	ACR_ConcurrentMapTable_t* table = shard->m_Table;
+	ACR_ConcurrentMapTable_t* larger;
+	ACR_Count_t capacity = (table == ACR_NULL) ? ACR_CONCURRENT_MAP_MIN_CAPACITY : (table->m_Capacity * 2);
+	ACR_Length_t length = ACR_CONCURRENT_MAP_ROUND(sizeof(ACR_ConcurrentMapTable_t)) +
+	                      ((ACR_Length_t)capacity * (sizeof(ACR_Length_t) + sizeof(ACR_ConcurrentMapEntry_t*)));
+	ACR_Count_t i;
+	ACR_Count_t pos;
+
+	if((table != ACR_NULL) && (capacity < table->m_Capacity))
+	{
+		return ACR_INFO_ERROR;
+	}
+	larger = (ACR_ConcurrentMapTable_t*)ACR_MALLOC(length);
+	if(larger == ACR_NULL)
+	{
+		return ACR_INFO_ERROR;
+	}
+	larger->m_Replaced = table;
+	larger->m_Hashes = (ACR_Length_t*)(((ACR_Byte_t*)larger) + ACR_CONCURRENT_MAP_ROUND(sizeof(ACR_ConcurrentMapTable_t)));
+	larger->m_Entries = (ACR_ConcurrentMapEntry_t**)(larger->m_Hashes + capacity);
+	larger->m_Capacity = capacity;
+	memset(larger->m_Entries, 0, (size_t)capacity * sizeof(ACR_ConcurrentMapEntry_t*));
+
+	if(table != ACR_NULL)
+	{
+		for(i = 0; i < table->m_Capacity; i++)
+		{
+			if(table->m_Entries[i] != ACR_NULL)
+			{
+				pos = (ACR_Count_t)table->m_Hashes[i] & (capacity - 1);
+				while(larger->m_Entries[pos] != ACR_NULL)
+				{
+					pos = (pos + 1) & (capacity - 1);
+				}
+				larger->m_Hashes[pos] = table->m_Hashes[i];
+				larger->m_Entries[pos] = table->m_Entries[i];
+			}
+		}
+	}
+
+	// readers see the larger table only after it is full. the
+	// replaced table is kept since a reader may still be
+	// using it
+	ACR_CONCURRENT_MAP_RELEASE_POINTER(shard->m_Table, larger)
+	return ACR_INFO_OK;
+}
+
+/** get an entry with room for a key while the shard is
+    locked, reusing the entry of a removed key if there is
+    one
+    \returns the entry or ACR_NULL
+*/
+static ACR_ConcurrentMapEntry_t* ACR_ConcurrentMapNewEntry(
+	ACR_ConcurrentMapShard_t* shard,
+	ACR_Length_t valueWords,
+	ACR_Length_t keyLength)
+{
+	ACR_ConcurrentMapBlock_t* block = shard->m_Block;
+	ACR_ConcurrentMapEntry_t* entry;
+	ACR_Length_t header = ACR_CONCURRENT_MAP_ROUND(sizeof(ACR_ConcurrentMapBlock_t));
+	ACR_Length_t words = ACR_CONCURRENT_MAP_ROUND(keyLength) / ACR_CONCURRENT_MAP_WORD;
+	ACR_Length_t length;
+	ACR_Length_t blockLength;
+	int size = 0;
+
+	while((((ACR_Length_t)1) << size) < words)
+	{
+		size++;
+		if(size == ACR_CONCURRENT_MAP_CLASSES)
+		{
+			return ACR_NULL;
+		}
+	}
+	entry = shard->m_Free[size];
+	if(entry != ACR_NULL)
+	{
+		shard->m_Free[size] = entry->m_Next;
+		return entry;
+	}
+
+	words = ((ACR_Length_t)1) << size;
+	length = ACR_CONCURRENT_MAP_ROUND(sizeof(ACR_ConcurrentMapEntry_t)) + ((valueWords + words) * ACR_CONCURRENT_MAP_WORD);
+	if((block == ACR_NULL) || ((block->m_Length - block->m_Used) < length))
+	{
+		blockLength = (length > (ACR_CONCURRENT_MAP_BLOCK_LENGTH - header)) ? (header + length) : ACR_CONCURRENT_MAP_BLOCK_LENGTH;
+		block = (ACR_ConcurrentMapBlock_t*)ACR_MALLOC(blockLength);
+		if(block == ACR_NULL)
+		{
+			return ACR_NULL;
+		}
+		block->m_Previous = shard->m_Block;
+		block->m_Used = header;
+		block->m_Length = blockLength;
+		shard->m_Block = block;
+	}
+	entry = (ACR_ConcurrentMapEntry_t*)(((ACR_Byte_t*)block) + block->m_Used);
+	block->m_Used += length;
+	entry->m_Next = ACR_NULL;
+	entry->m_Length = 0;
+	entry->m_Words = words;
+	return entry;
+}
+
+/** add a key or replace its value
+    \returns ACR_INFO_NEW, ACR_INFO_OLD, or ACR_INFO_ERROR
+*/
+static ACR_Info_t ACR_ConcurrentMapWrite(
+	ACR_ConcurrentMap_t* me,
+	ACR_String_t key,
+	const void* value,
+	int replace)
+{
+	ACR_ConcurrentMapShard_t* shard;
+	ACR_ConcurrentMapTable_t* table;
+	ACR_ConcurrentMapEntry_t* entry;
+	ACR_Length_t valueWords = ACR_CONCURRENT_MAP_ROUND(me->m_ValueLength) / ACR_CONCURRENT_MAP_WORD;
+	ACR_Length_t hash;
+	ACR_Length_t sequence;
+	ACR_Length_t* words;
+	ACR_Length_t word;
+	ACR_Length_t remaining;
+	ACR_Length_t i;
+	ACR_Count_t pos;
+	ACR_Info_t result = ACR_INFO_ERROR;
+
+	if((me->m_Shards == ACR_NULL) || ((key.m_Buffer.m_Pointer == ACR_NULL) && (key.m_Buffer.m_Length != 0)))
+	{
+		return ACR_INFO_ERROR;
+	}
+
+	hash = ACR_ConcurrentMapHash(key);
+	shard = ACR_CONCURRENT_MAP_SHARD(me, hash);
+	ACR_CONCURRENT_MAP_LOCK(shard->m_Lock)
+	table = shard->m_Table;
+	pos = (table != ACR_NULL) ? ACR_ConcurrentMapFindSlot(table, valueWords, key, hash) : 0;
+	if((table != ACR_NULL) && (pos != table->m_Capacity))
+	{
+		result = ACR_INFO_OLD;
+		if(replace != 0)
+		{
+			sequence = shard->m_Sequence + 1;
+			ACR_CONCURRENT_MAP_STORE(shard->m_Sequence, sequence)
+			ACR_CONCURRENT_MAP_FENCE_RELEASE()
+			ACR_ConcurrentMapStoreValue(ACR_CONCURRENT_MAP_WORDS(table->m_Entries[pos]), me->m_ValueLength, value);
+			ACR_CONCURRENT_MAP_RELEASE(shard->m_Sequence, sequence + 1)
+		}
+	}
+	else
+	{
+		// keep the table at most half full so that probes
+		// stay short and there is always an empty slot
+		if((table == ACR_NULL) || ((shard->m_Count + 1) > (table->m_Capacity / 2)))
+		{
+			if(ACR_ConcurrentMapGrow(shard) != ACR_INFO_OK)
+			{
+				ACR_CONCURRENT_MAP_UNLOCK(shard->m_Lock)
+				return ACR_INFO_ERROR;
+			}
+			table = shard->m_Table;
+		}
+		entry = ACR_ConcurrentMapNewEntry(shard, valueWords, key.m_Buffer.m_Length);
+		if(entry != ACR_NULL)
+		{
+			pos = (ACR_Count_t)hash & (table->m_Capacity - 1);
+			while(table->m_Entries[pos] != ACR_NULL)
+			{
+				pos = (pos + 1) & (table->m_Capacity - 1);
+			}
+
+			// a reused entry may still be read by a reader that
+			// found it before it was removed
+			sequence = shard->m_Sequence + 1;
+			ACR_CONCURRENT_MAP_STORE(shard->m_Sequence, sequence)
+			ACR_CONCURRENT_MAP_FENCE_RELEASE()
+			words = ACR_CONCURRENT_MAP_WORDS(entry);
+			ACR_ConcurrentMapStoreValue(words, me->m_ValueLength, value);
+			words += valueWords;
+			for(i = 0; (i * ACR_CONCURRENT_MAP_WORD) < key.m_Buffer.m_Length; i++)
+			{
+				remaining = key.m_Buffer.m_Length - (i * ACR_CONCURRENT_MAP_WORD);
+				word = 0;
+				memcpy(&word, ((const ACR_Byte_t*)key.m_Buffer.m_Pointer) + (i * ACR_CONCURRENT_MAP_WORD),
+					(size_t)((remaining < ACR_CONCURRENT_MAP_WORD) ? remaining : ACR_CONCURRENT_MAP_WORD));
+				ACR_CONCURRENT_MAP_STORE(words[i], word)
+			}
+			ACR_CONCURRENT_MAP_STORE(entry->m_Length, key.m_Buffer.m_Length)
+			ACR_CONCURRENT_MAP_STORE(table->m_Hashes[pos], hash)
+			ACR_CONCURRENT_MAP_RELEASE_POINTER(table->m_Entries[pos], entry)
+			ACR_CONCURRENT_MAP_STORE(shard->m_Count, shard->m_Count + 1)
+			ACR_CONCURRENT_MAP_RELEASE(shard->m_Sequence, sequence + 1)
+			result = ACR_INFO_NEW;
+		}
+	}
+	ACR_CONCURRENT_MAP_UNLOCK(shard->m_Lock)
+	return result;
+}
+
+#endif // #if ACR_HAS_MALLOC == ACR_BOOL_TRUE
+
+////////////////////////////////////////////////////////////
+//
+// PUBLIC FUNCTIONS
+//
+////////////////////////////////////////////////////////////
+
+/**********************************************************/
+ACR_Info_t ACR_ConcurrentMapInit(
+	ACR_ConcurrentMap_t* me,
+	ACR_Length_t valueLength,
+	ACR_Count_t shardCount)
+{
+	ACR_ConcurrentMapShard_t* shard;
+	ACR_Count_t count = 1;
+	ACR_Count_t i;
+
+	if(me == ACR_NULL)
+	{
+		return ACR_INFO_ERROR;
+	}
+
+	if(shardCount == 0)
+	{
+		shardCount = ACR_CONCURRENT_MAP_DEFAULT_SHARDS;
+	}
+	while((count < shardCount) && (count < ACR_CONCURRENT_MAP_MAX_SHARDS))
+	{
+		count *= 2;
+	}
+	me->m_ValueLength = valueLength;
+	me->m_ShardCount = count;
+	// each shard starts on its own cache line so that threads
+	// using different shards do not slow each other down
+	me->m_ShardLength = ((sizeof(ACR_ConcurrentMapShard_t) + ACR_CACHE_LINE_SIZE - 1) / ACR_CACHE_LINE_SIZE) * ACR_CACHE_LINE_SIZE;
+	me->m_Memory = ACR_NULL;
+	me->m_Shards = ACR_NULL;
+
+	#if ACR_HAS_MALLOC == ACR_BOOL_TRUE
+	me->m_Memory = ACR_MALLOC((me->m_ShardLength * count) + ACR_CACHE_LINE_SIZE);
+	if(me->m_Memory == ACR_NULL)
+	{
+		return ACR_INFO_ERROR;
+	}
+	me->m_Shards = (void*)((((ACR_PointerValue_t)me->m_Memory) + ACR_CACHE_LINE_SIZE - 1) & ~((ACR_PointerValue_t)ACR_CACHE_LINE_SIZE - 1));
+	for(i = 0; i < count; i++)
+	{
+		shard = (ACR_ConcurrentMapShard_t*)(((ACR_Byte_t*)me->m_Shards) + (i * me->m_ShardLength));
+		memset(shard, 0, sizeof(ACR_ConcurrentMapShard_t));
+		ACR_CONCURRENT_MAP_LOCK_INIT(shard->m_Lock)
+	}
+	return ACR_INFO_OK;
+	#else
+	ACR_UNUSED(shard);
+	ACR_UNUSED(i);
+	return ACR_INFO_ERROR;
+	#endif
+}
+
+/**********************************************************/
+void ACR_ConcurrentMapDeInit(
+	ACR_ConcurrentMap_t* me)
+{
+	#if ACR_HAS_MALLOC == ACR_BOOL_TRUE
+	ACR_ConcurrentMapShard_t* shard;
+	ACR_ConcurrentMapTable_t* table;
+	ACR_ConcurrentMapBlock_t* block;
+	ACR_Count_t i;
+
+	if((me == ACR_NULL) || (me->m_Shards == ACR_NULL))
+	{
+		return;
+	}
+
+	for(i = 0; i < me->m_ShardCount; i++)
+	{
+		shard = (ACR_ConcurrentMapShard_t*)(((ACR_Byte_t*)me->m_Shards) + (i * me->m_ShardLength));
+		while(shard->m_Table != ACR_NULL)
+		{
+			table = shard->m_Table;
+			shard->m_Table = table->m_Replaced;
+			ACR_FREE(table);
+		}
+		while(shard->m_Block != ACR_NULL)
+		{
+			block = shard->m_Block;
+			shard->m_Block = block->m_Previous;
+			ACR_FREE(block);
+		}
+		ACR_CONCURRENT_MAP_LOCK_DEINIT(shard->m_Lock)
+	}
+	ACR_FREE(me->m_Memory);
+	me->m_Memory = ACR_NULL;
+	me->m_Shards = ACR_NULL;
+	#else
+	ACR_UNUSED(me);
+	#endif
+}
+
+/**********************************************************/
+ACR_Info_t ACR_ConcurrentMapFind(
+	const ACR_ConcurrentMap_t* me,
+	ACR_String_t key,
+	void* value)
+{
+	ACR_ConcurrentMapShard_t* shard;
+	ACR_ConcurrentMapTable_t* table;
+	ACR_Length_t hash;
+	ACR_Length_t sequence;
+	ACR_Info_t result = ACR_INFO_UNKNOWN;
+	int attempt;
+
+	if((me == ACR_NULL) || (me->m_Shards == ACR_NULL) || ((key.m_Buffer.m_Pointer == ACR_NULL) && (key.m_Buffer.m_Length != 0)))
+	{
+		return ACR_INFO_UNKNOWN;
+	}
+
+	hash = ACR_ConcurrentMapHash(key);
+	shard = ACR_CONCURRENT_MAP_SHARD(me, hash);
+	for(attempt = 0; attempt < ACR_CONCURRENT_MAP_READ_ATTEMPTS; attempt++)
+	{
+		sequence = ACR_CONCURRENT_MAP_ACQUIRE(shard->m_Sequence);
+		if((sequence & 1) == 0)
+		{
+			table = (ACR_ConcurrentMapTable_t*)ACR_CONCURRENT_MAP_ACQUIRE_POINTER(shard->m_Table);
+			result = (table != ACR_NULL) ? ACR_ConcurrentMapRead(me, table, key, hash, value) : ACR_INFO_UNKNOWN;
+			ACR_CONCURRENT_MAP_FENCE_ACQUIRE()
+			if(ACR_CONCURRENT_MAP_LOAD(shard->m_Sequence) == sequence)
+			{
+				return result;
+			}
+		}
+	}
+
+	// a writer kept changing the shard, so wait for it
+	ACR_CONCURRENT_MAP_LOCK(shard->m_Lock)
+	table = shard->m_Table;
+	result = (table != ACR_NULL) ? ACR_ConcurrentMapRead(me, table, key, hash, value) : ACR_INFO_UNKNOWN;
+	ACR_CONCURRENT_MAP_UNLOCK(shard->m_Lock)
+	return result;
+}
+
+/**********************************************************/
+ACR_Info_t ACR_ConcurrentMapSet(
+	ACR_ConcurrentMap_t* me,
+	ACR_String_t key,
+	const void* value)
+{
+	#if ACR_HAS_MALLOC == ACR_BOOL_TRUE
+	if(me == ACR_NULL)
+	{
+		return ACR_INFO_ERROR;
+	}
+	return ACR_ConcurrentMapWrite(me, key, value, 1);
+	#else
+	ACR_UNUSED(me);
+	ACR_UNUSED(key);
+	ACR_UNUSED(value);
+	return ACR_INFO_ERROR;
+	#endif
+}
+
+/**********************************************************/
+ACR_Info_t ACR_ConcurrentMapAdd(
+	ACR_ConcurrentMap_t* me,
+	ACR_String_t key,
+	const void* value)
+{
+	#if ACR_HAS_MALLOC == ACR_BOOL_TRUE
+	if(me == ACR_NULL)
+	{
+		return ACR_INFO_ERROR;
+	}
+	return ACR_ConcurrentMapWrite(me, key, value, 0);
+	#else
+	ACR_UNUSED(me);
+	ACR_UNUSED(key);
+	ACR_UNUSED(value);
+	return ACR_INFO_ERROR;
+	#endif
+}
+
+/**********************************************************/
+ACR_Info_t ACR_ConcurrentMapRemove(
+	ACR_ConcurrentMap_t* me,
+	ACR_String_t key)
+{
+	ACR_ConcurrentMapShard_t* shard;
+	ACR_ConcurrentMapTable_t* table;
+	ACR_ConcurrentMapEntry_t* entry;
+	ACR_Length_t valueWords;
+	ACR_Length_t hash;
+	ACR_Length_t sequence;
+	ACR_Count_t mask;
+	ACR_Count_t pos;
+	ACR_Count_t next;
+	ACR_Count_t home;
+	int size = 0;
+
+	if((me == ACR_NULL) || (me->m_Shards == ACR_NULL) || ((key.m_Buffer.m_Pointer == ACR_NULL) && (key.m_Buffer.m_Length != 0)))
+	{
+		return ACR_INFO_UNKNOWN;
+	}
+
+	valueWords = ACR_CONCURRENT_MAP_ROUND(me->m_ValueLength) / ACR_CONCURRENT_MAP_WORD;
+	hash = ACR_ConcurrentMapHash(key);
+	shard = ACR_CONCURRENT_MAP_SHARD(me, hash);
+	ACR_CONCURRENT_MAP_LOCK(shard->m_Lock)
+	table = shard->m_Table;
+	pos = (table != ACR_NULL) ? ACR_ConcurrentMapFindSlot(table, valueWords, key, hash) : 0;
+	if((table == ACR_NULL) || (pos == table->m_Capacity))
+	{
+		ACR_CONCURRENT_MAP_UNLOCK(shard->m_Lock)
+		return ACR_INFO_UNKNOWN;
+	}
+
+	entry = table->m_Entries[pos];
+	mask = table->m_Capacity - 1;
+	sequence = shard->m_Sequence + 1;
+	ACR_CONCURRENT_MAP_STORE(shard->m_Sequence, sequence)
+	ACR_CONCURRENT_MAP_FENCE_RELEASE()
+	// move the keys after the removed one back so that no
+	// tombstone is needed
+	next = pos;
+	while(1)
+	{
+		next = (next + 1) & mask;
+		if(table->m_Entries[next] == ACR_NULL)
+		{
+			break;
+		}
+		home = (ACR_Count_t)table->m_Hashes[next] & mask;
+		// the key can move to pos if its home is not between
+		// pos and next
+		if(((next > pos) && ((home <= pos) || (home > next))) ||
+		   ((next < pos) && ((home <= pos) && (home > next))))
+		{
+			ACR_CONCURRENT_MAP_STORE(table->m_Hashes[pos], table->m_Hashes[next])
+			ACR_CONCURRENT_MAP_RELEASE_POINTER(table->m_Entries[pos], table->m_Entries[next])
+			pos = next;
+		}
+	}
+	ACR_CONCURRENT_MAP_RELEASE_POINTER(table->m_Entries[pos], ACR_NULL)
+	ACR_CONCURRENT_MAP_STORE(shard->m_Count, shard->m_Count - 1)
+	ACR_CONCURRENT_MAP_RELEASE(shard->m_Sequence, sequence + 1)
+
+	// the entry can be reused by a key of the same size
+	while((((ACR_Length_t)1) << size) < entry->m_Words)
+	{
+		size++;
+	}
+	entry->m_Next = shard->m_Free[size];
+	shard->m_Free[size] = entry;
+	ACR_CONCURRENT_MAP_UNLOCK(shard->m_Lock)
+	return ACR_INFO_OK;
+}
+
+/**********************************************************/
+ACR_Count_t ACR_ConcurrentMapCount(
+	const ACR_ConcurrentMap_t* me)
+{
+	ACR_ConcurrentMapShard_t* shard;
+	ACR_Count_t count = 0;
+	ACR_Count_t i;
+
+	if((me == ACR_NULL) || (me->m_Shards == ACR_NULL))
+	{
+		return 0;
+	}
+
+	for(i = 0; i < me->m_ShardCount; i++)
+	{
+		shard = (ACR_ConcurrentMapShard_t*)(((ACR_Byte_t*)me->m_Shards) + (i * me->m_ShardLength));
+		count += (ACR_Count_t)ACR_CONCURRENT_MAP_LOAD(shard->m_Count);
+	}
+	return count;
+}
@@ -0,0 +1,1003 @@
+/*
+
+    ********** DO NOT REMOVE THIS INFORMATION ************
+
+    ACR - A set of C functions in a git Repository
+    Copyright (C) 2018 - 2020 Adam C. Rosenberg
+
+    Please read LICENSE before using this code
+
+    Please read README.md for instructions on including
+    this code in your project and where to find examples
+
+    If you contribute to this code, Please add your name
+    and email address to the AUTHORS list below so that
+    we know who to thank!
+
+    AUTHORS
+
+    Adam Rosenberg <adam@sirspot.com>
+
+    LICENSE
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+    ******************************************************
+
+*/
+/** \file format.c
+
+    printf style formatting with compiled format text
+
+    Compiling splits the text into segments that are each
+    literal text followed by one conversion. Adding text
+    reads the arguments twice, first to find the length so
+    the buffer grows at most once and then to write it.
+
+*/
+#include "ACR/format.h"
+
+#if ACR_USE_64BIT == ACR_BOOL_TRUE
+
+////////////////////////////////////////////////////////////
+//
+// PRIVATE DEFINES
+//
+////////////////////////////////////////////////////////////
+
+// the type of conversion at the end of a segment
+#define ACR_FORMAT_TYPE_NONE 0
+#define ACR_FORMAT_TYPE_SIGNED 1
+#define ACR_FORMAT_TYPE_UNSIGNED 2
+#define ACR_FORMAT_TYPE_HEX 3
+#define ACR_FORMAT_TYPE_HEX_UPPER 4
+#define ACR_FORMAT_TYPE_CHAR 5
+#define ACR_FORMAT_TYPE_TEXT 6
+#define ACR_FORMAT_TYPE_STRING 7
+#define ACR_FORMAT_TYPE_INFO 8
+#define ACR_FORMAT_TYPE_DOUBLE 9
+
+// the size of an integer argument
+#define ACR_FORMAT_SIZE_INT 0
+#define ACR_FORMAT_SIZE_LONG 1
+#define ACR_FORMAT_SIZE_LONG_LONG 2
+#define ACR_FORMAT_SIZE_SIZE_T 3
+#define ACR_FORMAT_SIZE_SHORT 4
+#define ACR_FORMAT_SIZE_CHAR 5
+
+// conversion flags
+#define ACR_FORMAT_FLAG_LEFT 0x01
+#define ACR_FORMAT_FLAG_ZERO 0x02
+#define ACR_FORMAT_FLAG_PLUS 0x04
+#define ACR_FORMAT_FLAG_WIDTH_ARGUMENT 0x08
+#define ACR_FORMAT_FLAG_PRECISION 0x10
+#define ACR_FORMAT_FLAG_PRECISION_ARGUMENT 0x20
+
+// the largest width or precision in the format text
+#define ACR_FORMAT_MAX_WIDTH 65535
+
+// the number of arguments that are kept from finding the
+// length so they do not need to be read again for writing
+#define ACR_FORMAT_SAVED_ARGUMENTS 16
+
+#define ACR_FORMAT_IS_DIGIT(c) (((c) >= '0') && ((c) <= '9'))
+
+// a byte that continues a UTF8 character instead of
+// starting one
+#define ACR_FORMAT_IS_UTF8_CONTINUATION(c) (((c) & 0xC0) == 0x80)
+
+////////////////////////////////////////////////////////////
+//
+// PRIVATE TYPES
+//
+////////////////////////////////////////////////////////////
+
+#ifdef ACR_COMPILER_VS2017
+#pragma warning(push)
+// disable warning C4820: padding added after data member
+#pragma warning(disable:4820)
+#endif
+
+/** literal text in the format followed by a conversion
+*/
+typedef struct ACR_FormatSegment_s
+{
+	ACR_Length_t m_Offset;
+	ACR_Length_t m_Length;
+	ACR_Length_t m_Width;
+	ACR_Length_t m_Precision;
+	int m_Type;
+	int m_Size;
+	int m_Flags;
+} ACR_FormatSegment_t;
+
+/** the value of an argument and the space it needs
+*/
+typedef struct ACR_FormatArgument_s
+{
+	ACR_UInt64_t m_Integer;
+	double m_Double;
+	ACR_String_t m_String;
+	ACR_Length_t m_Width;
+	ACR_Length_t m_Length;
+	ACR_Length_t m_Zeros;
+	ACR_Length_t m_Total;
+	ACR_Byte_t m_Sign;
+	ACR_Byte_t m_Char;
+	int m_Left;
+} ACR_FormatArgument_t;
+
+#ifdef ACR_COMPILER_VS2017
+#pragma warning(pop)
+#endif
+
+////////////////////////////////////////////////////////////
+//
+// PRIVATE TABLES
+//
+////////////////////////////////////////////////////////////
+
+/** the digits of 0 to 99 so that two digits can be written
+    at once
+*/
+static const char g_ACRFormatDigitPairs[201] =
+	"00010203040506070809"
+	"10111213141516171819"
+	"20212223242526272829"
+	"30313233343536373839"
+	"40414243444546474849"
+	"50515253545556575859"
+	"60616263646566676869"
+	"70717273747576777879"
+	"80818283848586878889"
+	"90919293949596979899";
+
+/** hex digits for "x" and "X"
+*/
+static const char g_ACRFormatHexDigits[2][17] =
+{
+	"0123456789abcdef",
+	"0123456789ABCDEF"
+};
+
+////////////////////////////////////////////////////////////
+//
+// PRIVATE FUNCTIONS - COMPILE
+//
+////////////////////////////////////////////////////////////
+
+/** read a width or precision from the format text
+	\returns the position after the number or 0 if it is
+	         too large
+*/
+static ACR_Length_t ACR_FormatParseNumber(
+	const ACR_Byte_t* src,
+	ACR_Length_t length,
+	ACR_Length_t pos,
+	ACR_Length_t* value)
+{
+	ACR_Length_t number = 0;
+	while((pos < length) && ACR_FORMAT_IS_DIGIT(src[pos]))
+	{
+		number = (number * 10) + (ACR_Length_t)(src[pos] - '0');
+		if(number > ACR_FORMAT_MAX_WIDTH)
+		{
+			return 0;
+		}
+		pos++;
+	}
+	(*value) = number;
+	return pos;
+}
+
+/** split the format text into segments
+	\param src the format text
+	\param length the length of src
+	\param segments location to store the segments or
+	       ACR_NULL to only count them
+	\param segmentCount location to store the number of
+	       segments
+	\param literalLength location to store the total length
+	       of the literal text
+	\returns ACR_INFO_OK or ACR_INFO_INVALID
+*/
+static ACR_Info_t ACR_FormatParse(
+	const ACR_Byte_t* src,
+	ACR_Length_t length,
+	ACR_FormatSegment_t* segments,
+	ACR_Count_t* segmentCount,
+	ACR_Length_t* literalLength)
+{
+	ACR_FormatSegment_t segment;
+	ACR_Length_t pos = 0;
+	ACR_Count_t count = 0;
+	ACR_Length_t literal = 0;
+
+	while(pos < length)
+	{
+		segment.m_Offset = pos;
+		segment.m_Width = 0;
+		segment.m_Precision = 0;
+		segment.m_Type = ACR_FORMAT_TYPE_NONE;
+		segment.m_Size = ACR_FORMAT_SIZE_INT;
+		segment.m_Flags = 0;
+		while((pos < length) && (src[pos] != '%'))
+		{
+			pos++;
+		}
+		segment.m_Length = pos - segment.m_Offset;
+
+		if(pos < length)
+		{
+			pos++;
+			if((pos < length) && (src[pos] == '%'))
+			{
+				// "%%" is a "%" at the end of the literal text
+				segment.m_Length++;
+				pos++;
+			}
+			else
+			{
+				// flags
+				while(pos < length)
+				{
+					if(src[pos] == '-')
+					{
+						ACR_ADD_FLAGS(segment.m_Flags, ACR_FORMAT_FLAG_LEFT);
+					}
+					else if(src[pos] == '0')
+					{
+						ACR_ADD_FLAGS(segment.m_Flags, ACR_FORMAT_FLAG_ZERO);
+					}
+					else if(src[pos] == '+')
+					{
+						ACR_ADD_FLAGS(segment.m_Flags, ACR_FORMAT_FLAG_PLUS);
+					}
+					else
+					{
+						break;
+					}
+					pos++;
+				}
+
+				// width
+				if((pos < length) && (src[pos] == '*'))
+				{
+					ACR_ADD_FLAGS(segment.m_Flags, ACR_FORMAT_FLAG_WIDTH_ARGUMENT);
+					pos++;
+				}
+				else
+				{
+					pos = ACR_FormatParseNumber(src, length, pos, &segment.m_Width);
+					if(pos == 0)
+					{
+						return ACR_INFO_INVALID;
+					}
+				}
+
+				// precision
+				if((pos < length) && (src[pos] == '.'))
+				{
+					ACR_ADD_FLAGS(segment.m_Flags, ACR_FORMAT_FLAG_PRECISION);
+					pos++;
+					if((pos < length) && (src[pos] == '*'))
+					{
+						ACR_ADD_FLAGS(segment.m_Flags, ACR_FORMAT_FLAG_PRECISION_ARGUMENT);
+						pos++;
+					}
+					else
+					{
+						pos = ACR_FormatParseNumber(src, length, pos, &segment.m_Precision);
+						if(pos == 0)
+						{
+							return ACR_INFO_INVALID;
+						}
+					}
+				}
+
+				// size
+				if((pos < length) && (src[pos] == 'h'))
+				{
+					segment.m_Size = ACR_FORMAT_SIZE_SHORT;
+					pos++;
+					if((pos < length) && (src[pos] == 'h'))
+					{
+						segment.m_Size = ACR_FORMAT_SIZE_CHAR;
+						pos++;
+					}
+				}
+				else if((pos < length) && (src[pos] == 'l'))
+				{
+					segment.m_Size = ACR_FORMAT_SIZE_LONG;
+					pos++;
+					if((pos < length) && (src[pos] == 'l'))
+					{
+						segment.m_Size = ACR_FORMAT_SIZE_LONG_LONG;
+						pos++;
+					}
+				}
+				else if((pos < length) && (src[pos] == 'z'))
+				{
+					segment.m_Size = ACR_FORMAT_SIZE_SIZE_T;
+					pos++;
+				}
+
+				// type
+				if(pos >= length)
+				{
+					return ACR_INFO_INVALID;
+				}
+				switch(src[pos])
+				{
+					case 'd':
+					case 'i':
+						segment.m_Type = ACR_FORMAT_TYPE_SIGNED;
+						break;
+					case 'u':
+						segment.m_Type = ACR_FORMAT_TYPE_UNSIGNED;
+						break;
+					case 'x':
+						segment.m_Type = ACR_FORMAT_TYPE_HEX;
+						break;
+					case 'X':
+						segment.m_Type = ACR_FORMAT_TYPE_HEX_UPPER;
+						break;
+					case 'c':
+						segment.m_Type = ACR_FORMAT_TYPE_CHAR;
+						break;
+					case 's':
+						segment.m_Type = ACR_FORMAT_TYPE_TEXT;
+						break;
+					case 'S':
+						segment.m_Type = ACR_FORMAT_TYPE_STRING;
+						break;
+					case 'I':
+						segment.m_Type = ACR_FORMAT_TYPE_INFO;
+						break;
+					case 'g':
+						segment.m_Type = ACR_FORMAT_TYPE_DOUBLE;
+						break;
+					default:
+						return ACR_INFO_INVALID;
+				}
+				pos++;
+
+				// only integers have a size and only integers and
+				// text have a precision
+				if((segment.m_Size != ACR_FORMAT_SIZE_INT) && (segment.m_Type > ACR_FORMAT_TYPE_HEX_UPPER))
+				{
+					return ACR_INFO_INVALID;
+				}
+				if((ACR_HAS_FLAG(segment.m_Flags, ACR_FORMAT_FLAG_PRECISION) != ACR_BOOL_FALSE) &&
+				   (segment.m_Type > ACR_FORMAT_TYPE_HEX_UPPER) &&
+				   (segment.m_Type != ACR_FORMAT_TYPE_TEXT) && (segment.m_Type != ACR_FORMAT_TYPE_STRING))
+				{
+					return ACR_INFO_INVALID;
+				}
+			}
+		}
+
+		if(segments != ACR_NULL)
+		{
+			segments[count] = segment;
+		}
+		count++;
+		literal += segment.m_Length;
+	}
+
+	(*segmentCount) = count;
+	(*literalLength) = literal;
+	return ACR_INFO_OK;
+}
+
+////////////////////////////////////////////////////////////
+//
+// PRIVATE FUNCTIONS - ARGUMENTS
+//
+////////////////////////////////////////////////////////////
+
+/** the number of digits in a value
+	\param value the value
+	\param hex 0 for decimal or 1 for hex
+*/
+static ACR_Length_t ACR_FormatDigitCount(
+	ACR_UInt64_t value,
+	int hex)
+{
+	ACR_Length_t count = 1;
+	if(hex != 0)
+	{
+		while(value >= 16)
+		{
+			value >>= 4;
+			count++;
+		}
+		return count;
+	}
+	while(value >= 10000)
+	{
+		value /= 10000;
+		count += 4;
+	}
+	if(value >= 100)
+	{
+		value /= 100;
+		count += 2;
+	}
+	if(value >= 10)
+	{
+		count++;
+	}
+	return count;
+}
+
+/** get the length of text up to a maximum without reading
+    past the maximum
+*/
+static ACR_Length_t ACR_FormatTextLength(
+	const char* text,
+	ACR_Length_t maxLength)
+{
+	const char* end = (const char*)memchr(text, 0, (size_t)maxLength);
+	if(end == ACR_NULL)
+	{
+		return maxLength;
+	}
+	return (ACR_Length_t)(end - text);
+}
+
+/** get the length of the first characters of UTF8 text so
+    that a character is never split
+	\param text the text
+	\param length the length of the text in bytes
+	\param maxCount the most characters to include
+	\returns the length in bytes
+*/
+static ACR_Length_t ACR_FormatCharacterLength(
+	const ACR_Byte_t* text,
+	ACR_Length_t length,
+	ACR_Length_t maxCount)
+{
+	ACR_Length_t pos = 0;
+	while((pos < length) && (maxCount > 0))
+	{
+		pos++;
+		while((pos < length) && ACR_FORMAT_IS_UTF8_CONTINUATION(text[pos]))
+		{
+			pos++;
+		}
+		maxCount--;
+	}
+	return pos;
+}
+
+/** read the next argument and find the space it needs
+	\param segment the segment with the conversion
+	\param args the arguments
+	\param argument location to store the argument
+*/
+static void ACR_FormatGetArgument(
+	const ACR_FormatSegment_t* segment,
+	va_list* args,
+	ACR_FormatArgument_t* argument)
+{
+	ACR_STRING(string);
+	ACR_Length_t precision = ACR_MAX_LENGTH;
+	ACR_Length_t digits;
+	ACR_Int64_t value;
+	const char* text;
+	int number;
+
+	argument->m_Width = segment->m_Width;
+	argument->m_Zeros = 0;
+	argument->m_Sign = 0;
+	argument->m_Left = (ACR_HAS_FLAG(segment->m_Flags, ACR_FORMAT_FLAG_LEFT) != ACR_BOOL_FALSE) ? 1 : 0;
+	if(ACR_HAS_FLAG(segment->m_Flags, ACR_FORMAT_FLAG_WIDTH_ARGUMENT) != ACR_BOOL_FALSE)
+	{
+		// a negative width aligns left the same as printf
+		number = va_arg(*args, int);
+		if(number < 0)
+		{
+			argument->m_Left = 1;
+			argument->m_Width = (ACR_Length_t)(0 - (unsigned int)number);
+		}
+		else
+		{
+			argument->m_Width = (ACR_Length_t)number;
+		}
+	}
+	if(ACR_HAS_FLAG(segment->m_Flags, ACR_FORMAT_FLAG_PRECISION_ARGUMENT) != ACR_BOOL_FALSE)
+	{
+		// a negative precision is the same as none
+		number = va_arg(*args, int);
+		if(number >= 0)
+		{
+			precision = (ACR_Length_t)number;
+		}
+	}
+	else if(ACR_HAS_FLAG(segment->m_Flags, ACR_FORMAT_FLAG_PRECISION) != ACR_BOOL_FALSE)
+	{
+		precision = segment->m_Precision;
+	}
+
+	switch(segment->m_Type)
+	{
+		case ACR_FORMAT_TYPE_SIGNED:
+			switch(segment->m_Size)
+			{
+				case ACR_FORMAT_SIZE_LONG:
+					value = va_arg(*args, long);
+					break;
+				case ACR_FORMAT_SIZE_LONG_LONG:
+					value = va_arg(*args, long long);
+					break;
+				case ACR_FORMAT_SIZE_SIZE_T:
+					value = (ACR_Int64_t)va_arg(*args, size_t);
+					break;
+				case ACR_FORMAT_SIZE_SHORT:
+					// short and char arguments are passed as int and
+					// converted back the same as printf
+					value = (short)va_arg(*args, int);
+					break;
+				case ACR_FORMAT_SIZE_CHAR:
+					value = (signed char)va_arg(*args, int);
+					break;
+				default:
+					value = va_arg(*args, int);
+					break;
+			}
+			argument->m_Integer = (ACR_UInt64_t)value;
+			if(value < 0)
+			{
+				argument->m_Sign = '-';
+				argument->m_Integer = 0 - argument->m_Integer;
+			}
+			else if(ACR_HAS_FLAG(segment->m_Flags, ACR_FORMAT_FLAG_PLUS) != ACR_BOOL_FALSE)
+			{
+				argument->m_Sign = '+';
+			}
+			argument->m_Length = ACR_FormatDigitCount(argument->m_Integer, 0) + ((argument->m_Sign != 0) ? 1 : 0);
+			break;
+		case ACR_FORMAT_TYPE_UNSIGNED:
+		case ACR_FORMAT_TYPE_HEX:
+		case ACR_FORMAT_TYPE_HEX_UPPER:
+			switch(segment->m_Size)
+			{
+				case ACR_FORMAT_SIZE_LONG:
+					argument->m_Integer = va_arg(*args, unsigned long);
+					break;
+				case ACR_FORMAT_SIZE_LONG_LONG:
+					argument->m_Integer = va_arg(*args, unsigned long long);
+					break;
+				case ACR_FORMAT_SIZE_SIZE_T:
+					argument->m_Integer = va_arg(*args, size_t);
+					break;
+				case ACR_FORMAT_SIZE_SHORT:
+					argument->m_Integer = (unsigned short)va_arg(*args, unsigned int);
+					break;
+				case ACR_FORMAT_SIZE_CHAR:
+					argument->m_Integer = (unsigned char)va_arg(*args, unsigned int);
+					break;
+				default:
+					argument->m_Integer = va_arg(*args, unsigned int);
+					break;
+			}
+			argument->m_Length = ACR_FormatDigitCount(argument->m_Integer, (segment->m_Type == ACR_FORMAT_TYPE_UNSIGNED) ? 0 : 1);
+			break;
+		case ACR_FORMAT_TYPE_CHAR:
+			argument->m_Char = (ACR_Byte_t)va_arg(*args, int);
+			argument->m_Length = 1;
+			break;
+		case ACR_FORMAT_TYPE_TEXT:
+			text = va_arg(*args, const char*);
+			if(text == ACR_NULL)
+			{
+				text = "(null)";
+			}
+			ACR_STRING_REFERENCE(string, text, ACR_FormatTextLength(text, precision), ACR_EMPTY_VALUE);
+			argument->m_String = string;
+			argument->m_Length = argument->m_String.m_Buffer.m_Length;
+			break;
+		case ACR_FORMAT_TYPE_STRING:
+			argument->m_String = va_arg(*args, ACR_String_t);
+			if(argument->m_String.m_Buffer.m_Pointer == ACR_NULL)
+			{
+				argument->m_String.m_Buffer.m_Length = ACR_ZERO_LENGTH;
+			}
+			if(argument->m_String.m_Buffer.m_Length > precision)
+			{
+				// the precision is a number of characters
+				argument->m_String.m_Buffer.m_Length = ACR_FormatCharacterLength(
+					(const ACR_Byte_t*)argument->m_String.m_Buffer.m_Pointer,
+					argument->m_String.m_Buffer.m_Length, precision);
+			}
+			argument->m_Length = argument->m_String.m_Buffer.m_Length;
+			break;
+		case ACR_FORMAT_TYPE_INFO:
+			// values that are not in the enum have no name
+			number = va_arg(*args, int);
+			if((number < 0) || (number >= (int)ACR_INFO_COUNT))
+			{
+				number = (int)ACR_INFO_UNKNOWN;
+			}
+			argument->m_String = ACR_InfoToString((ACR_Info_t)number);
+			argument->m_Length = argument->m_String.m_Buffer.m_Length;
+			break;
+		default:
+			// the exact length is only known after writing
+			argument->m_Double = va_arg(*args, double);
+			argument->m_Length = ACR_NUMBER_TEXT_MAX_LENGTH;
+			break;
+	}
+
+	// integers can be padded with zeros after the sign
+	if(segment->m_Type <= ACR_FORMAT_TYPE_HEX_UPPER)
+	{
+		if(precision != ACR_MAX_LENGTH)
+		{
+			// the precision is the least number of digits, so a
+			// precision of 0 writes no digits for 0, and the "0"
+			// flag is ignored the same as printf
+			digits = argument->m_Length - ((argument->m_Sign != 0) ? 1 : 0);
+			if((precision == 0) && (argument->m_Integer == 0))
+			{
+				argument->m_Length -= digits;
+			}
+			else if(precision > digits)
+			{
+				argument->m_Zeros = precision - digits;
+			}
+		}
+		else if((ACR_HAS_FLAG(segment->m_Flags, ACR_FORMAT_FLAG_ZERO) != ACR_BOOL_FALSE) && (argument->m_Left == 0) &&
+		   (argument->m_Width > argument->m_Length))
+		{
+			argument->m_Zeros = argument->m_Width - argument->m_Length;
+		}
+	}
+	argument->m_Total = argument->m_Length + argument->m_Zeros;
+	if(argument->m_Width > argument->m_Total)
+	{
+		argument->m_Total = argument->m_Width;
+	}
+}
+
+/** write the digits of an integer
+*/
+static void ACR_FormatWriteDigits(
+	ACR_Byte_t* dst,
+	ACR_UInt64_t value,
+	ACR_Length_t count,
+	int type)
+{
+	ACR_Byte_t* pos = dst + count;
+	const char* hexDigits;
+	ACR_UInt64_t pair;
+
+	if((type != ACR_FORMAT_TYPE_SIGNED) && (type != ACR_FORMAT_TYPE_UNSIGNED))
+	{
+		hexDigits = g_ACRFormatHexDigits[(type == ACR_FORMAT_TYPE_HEX_UPPER) ? 1 : 0];
+		while(pos != dst)
+		{
+			pos--;
+			(*pos) = (ACR_Byte_t)hexDigits[value & 0xF];
+			value >>= 4;
+		}
+		return;
+	}
+
+	while(value >= 100)
+	{
+		pair = (value % 100) * 2;
+		value /= 100;
+		pos -= 2;
+		pos[0] = (ACR_Byte_t)g_ACRFormatDigitPairs[pair];
+		pos[1] = (ACR_Byte_t)g_ACRFormatDigitPairs[pair + 1];
+	}
+	if(value >= 10)
+	{
+		pair = value * 2;
+		pos -= 2;
+		pos[0] = (ACR_Byte_t)g_ACRFormatDigitPairs[pair];
+		pos[1] = (ACR_Byte_t)g_ACRFormatDigitPairs[pair + 1];
+	}
+	else
+	{
+		pos[-1] = (ACR_Byte_t)('0' + value);
+	}
+}
+
+/** write an argument to the end of the buffer, which must
+    already have room for the total length of the argument
+*/
+static void ACR_FormatWriteArgument(
+	ACR_VarBuffer_t* buffer,
+	const ACR_FormatArgument_t* argument,
+	int type)
+{
+	ACR_Byte_t* start = ((ACR_Byte_t*)buffer->m_Buffer.m_Pointer) + buffer->m_Buffer.m_Length;
+	ACR_Byte_t* dst = start;
+	ACR_Length_t length = argument->m_Length + argument->m_Zeros;
+	ACR_Length_t padding = 0;
+	ACR_Length_t digits;
+
+	if(type == ACR_FORMAT_TYPE_DOUBLE)
+	{
+		// the buffer has room for the longest text so the
+		// padding is moved after the length is known
+		ACR_VarBufferAppendDouble(buffer, argument->m_Double);
+		length = (ACR_Length_t)((((ACR_Byte_t*)buffer->m_Buffer.m_Pointer) + buffer->m_Buffer.m_Length) - start);
+		if(argument->m_Width > length)
+		{
+			padding = argument->m_Width - length;
+			if(argument->m_Left == 0)
+			{
+				memmove(start + padding, start, (size_t)length);
+				memset(start, ' ', (size_t)padding);
+			}
+			else
+			{
+				memset(start + length, ' ', (size_t)padding);
+			}
+			ACR_VarBufferAppend(buffer, ACR_NULL, padding);
+		}
+		return;
+	}
+
+	if(argument->m_Width > length)
+	{
+		padding = argument->m_Width - length;
+	}
+	if((argument->m_Left == 0) && (padding > 0))
+	{
+		memset(dst, ' ', (size_t)padding);
+		dst += padding;
+	}
+
+	switch(type)
+	{
+		case ACR_FORMAT_TYPE_SIGNED:
+		case ACR_FORMAT_TYPE_UNSIGNED:
+		case ACR_FORMAT_TYPE_HEX:
+		case ACR_FORMAT_TYPE_HEX_UPPER:
+			digits = argument->m_Length;
+			if(argument->m_Sign != 0)
+			{
+				(*dst) = argument->m_Sign;
+				dst++;
+				digits--;
+			}
+			if(argument->m_Zeros > 0)
+			{
+				memset(dst, '0', (size_t)argument->m_Zeros);
+				dst += argument->m_Zeros;
+			}
+			if(digits > 0)
+			{
+				ACR_FormatWriteDigits(dst, argument->m_Integer, digits, type);
+				dst += digits;
+			}
+			break;
+		case ACR_FORMAT_TYPE_CHAR:
+			(*dst) = argument->m_Char;
+			dst++;
+			break;
+		default:
+			if(argument->m_Length > 0)
+			{
+				memcpy(dst, argument->m_String.m_Buffer.m_Pointer, (size_t)argument->m_Length);
+				dst += argument->m_Length;
+			}
+			break;
+	}
+
+	if((argument->m_Left != 0) && (padding > 0))
+	{
+		memset(dst, ' ', (size_t)padding);
+		dst += padding;
+	}
+	ACR_VarBufferAppend(buffer, ACR_NULL, (ACR_Length_t)(dst - start));
+}
+
+////////////////////////////////////////////////////////////
+//
+// PUBLIC FUNCTIONS
+//
+////////////////////////////////////////////////////////////
+
+/**********************************************************/
+void ACR_FormatInit(
+	ACR_Format_t* me)
+{
+	if(me == ACR_NULL)
+	{
+		return;
+	}
+
+	me->m_Text.m_Buffer.m_Pointer = ACR_NULL;
+	me->m_Text.m_Buffer.m_Length = ACR_ZERO_LENGTH;
+	me->m_Text.m_Buffer.m_Flags = ACR_BUFFER_FLAGS_NONE;
+	me->m_Text.m_Count = ACR_ZERO_COUNT;
+	me->m_Segments.m_Pointer = ACR_NULL;
+	me->m_Segments.m_Length = ACR_ZERO_LENGTH;
+	me->m_Segments.m_Flags = ACR_BUFFER_FLAGS_NONE;
+	me->m_SegmentCount = 0;
+	me->m_LiteralLength = ACR_ZERO_LENGTH;
+}
+
+/**********************************************************/
+void ACR_FormatDeInit(
+	ACR_Format_t* me)
+{
+	if(me == ACR_NULL)
+	{
+		return;
+	}
+
+	ACR_BUFFER_FREE(me->m_Segments);
+	ACR_FormatInit(me);
+}
+
+/**********************************************************/
+ACR_Info_t ACR_FormatCompile(
+	ACR_Format_t* me,
+	ACR_String_t text)
+{
+	const ACR_Byte_t* src = (const ACR_Byte_t*)text.m_Buffer.m_Pointer;
+	ACR_Length_t length = text.m_Buffer.m_Length;
+	ACR_Length_t segmentsLength;
+	ACR_Length_t literalLength;
+	ACR_Count_t count;
+	ACR_Info_t result;
+
+	if(me == ACR_NULL)
+	{
+		return ACR_INFO_ERROR;
+	}
+	me->m_SegmentCount = 0;
+	me->m_LiteralLength = ACR_ZERO_LENGTH;
+	if(src == ACR_NULL)
+	{
+		length = ACR_ZERO_LENGTH;
+	}
+
+	// count the segments first so the memory is only
+	// allocated once
+	result = ACR_FormatParse(src, length, ACR_NULL, &count, &literalLength);
+	if(result != ACR_INFO_OK)
+	{
+		return result;
+	}
+	segmentsLength = (ACR_Length_t)(count * sizeof(ACR_FormatSegment_t));
+	if(me->m_Segments.m_Length < segmentsLength)
+	{
+		ACR_BUFFER_ALLOC(me->m_Segments, segmentsLength);
+		if(ACR_BUFFER_IS_VALID(me->m_Segments) == ACR_BOOL_FALSE)
+		{
+			return ACR_INFO_ERROR;
+		}
+	}
+	ACR_FormatParse(src, length, (ACR_FormatSegment_t*)me->m_Segments.m_Pointer, &count, &literalLength);
+
+	me->m_Text = text;
+	me->m_SegmentCount = count;
+	me->m_LiteralLength = literalLength;
+	return ACR_INFO_OK;
+}
+
+/**********************************************************/
+ACR_Info_t ACR_FormatAppend(
+	const ACR_Format_t* me,
+	ACR_VarBuffer_t* buffer,
+	...)
+{
+	ACR_Info_t result;
+	va_list args;
+
+	va_start(args, buffer);
+	result = ACR_FormatAppendList(me, buffer, args);
+	va_end(args);
+	return result;
+}
+
+/**********************************************************/
+ACR_Info_t ACR_FormatAppendList(
+	const ACR_Format_t* me,
+	ACR_VarBuffer_t* buffer,
+	va_list args)
+{
+	const ACR_FormatSegment_t* segments;
+	const ACR_Byte_t* text;
+	ACR_FormatArgument_t saved[ACR_FORMAT_SAVED_ARGUMENTS];
+	ACR_FormatArgument_t argument;
+	ACR_FormatArgument_t* current;
+	ACR_Length_t total;
+	ACR_Count_t i;
+	ACR_Count_t count = 0;
+	int reread;
+	va_list list;
+
+	if((me == ACR_NULL) || (buffer == ACR_NULL))
+	{
+		return ACR_INFO_ERROR;
+	}
+	segments = (const ACR_FormatSegment_t*)me->m_Segments.m_Pointer;
+	text = (const ACR_Byte_t*)me->m_Text.m_Buffer.m_Pointer;
+
+	// find the length of the text
+	total = buffer->m_Buffer.m_Length + me->m_LiteralLength;
+	if(total < buffer->m_Buffer.m_Length)
+	{
+		return ACR_INFO_ERROR;
+	}
+	va_copy(list, args);
+	for(i = 0; i < me->m_SegmentCount; i++)
+	{
+		if(segments[i].m_Type != ACR_FORMAT_TYPE_NONE)
+		{
+			current = (count < ACR_FORMAT_SAVED_ARGUMENTS) ? &saved[count] : &argument;
+			ACR_FormatGetArgument(&segments[i], &list, current);
+			if((total + current->m_Total) < total)
+			{
+				break;
+			}
+			total += current->m_Total;
+			count++;
+		}
+	}
+	va_end(list);
+	if((i != me->m_SegmentCount) || (ACR_VarBufferReserve(buffer, total) != ACR_INFO_OK))
+	{
+		return ACR_INFO_ERROR;
+	}
+
+	// write the text, only reading the arguments again if
+	// there were too many to save
+	reread = (count > ACR_FORMAT_SAVED_ARGUMENTS) ? 1 : 0;
+	if(reread != 0)
+	{
+		va_copy(list, args);
+	}
+	count = 0;
+	for(i = 0; i < me->m_SegmentCount; i++)
+	{
+		if(segments[i].m_Length > 0)
+		{
+			memcpy(((ACR_Byte_t*)buffer->m_Buffer.m_Pointer) + buffer->m_Buffer.m_Length,
+				text + segments[i].m_Offset, (size_t)segments[i].m_Length);
+			buffer->m_Buffer.m_Length += segments[i].m_Length;
+		}
+		if(segments[i].m_Type != ACR_FORMAT_TYPE_NONE)
+		{
+			if(reread != 0)
+			{
+				ACR_FormatGetArgument(&segments[i], &list, &argument);
+				ACR_FormatWriteArgument(buffer, &argument, segments[i].m_Type);
+			}
+			else
+			{
+				ACR_FormatWriteArgument(buffer, &saved[count], segments[i].m_Type);
+				count++;
+			}
+		}
+	}
+	if(reread != 0)
+	{
+		va_end(list);
+	}
+
+	return ACR_INFO_OK;
+}
+
+#endif // #if ACR_USE_64BIT == ACR_BOOL_TRUE
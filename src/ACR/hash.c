@@ -0,0 +1,700 @@
+/*
+
+    ********** DO NOT REMOVE THIS INFORMATION ************
+
+    ACR - A set of C functions in a git Repository
+    Copyright (C) 2018 - 2020 Adam C. Rosenberg
+
+    Please read LICENSE before using this code
+
+    Please read README.md for instructions on including
+    this code in your project and where to find examples
+
+    If you contribute to this code, Please add your name
+    and email address to the AUTHORS list below so that
+    we know who to thank!
+
+    AUTHORS
+
+    Adam Rosenberg <adam@sirspot.com>
+
+    LICENSE
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+    ******************************************************
+
+*/
+/** \file hash.c
+
+    functions for fast non-cryptographic hashes
+
+    multi-byte values are always read as little endian from
+    bytes so the hash is the same on every platform. the
+    compilers that matter combine the byte reads into one
+    load
+
+*/
+#include "ACR/hash.h"
+
+#if ACR_USE_64BIT == ACR_BOOL_TRUE
+
+// included for memcpy()
+#include <string.h>
+
+#if defined(_MSC_VER) && defined(_M_X64)
+// included for _umul128()
+#include <intrin.h>
+#endif
+
+////////////////////////////////////////////////////////////
+//
+// PRIVATE DEFINES
+//
+////////////////////////////////////////////////////////////
+
+// the constants of the short and medium length hash
+#define ACR_HASH_P0 0x2D358DCCAA6C78A5ULL
+#define ACR_HASH_P1 0x8BB84B93962EACC9ULL
+#define ACR_HASH_P2 0x4B33A62ED433D4A3ULL
+#define ACR_HASH_P3 0x4D5A2DA51DE1AA47ULL
+
+// the constants of the long hash
+#define ACR_HASH_PRIME32 0x9E3779B1ULL
+#define ACR_HASH_PRIME64_1 0x9E3779B185EBCA87ULL
+#define ACR_HASH_PRIME64_2 0xC2B2AE3D27D4EB4FULL
+#define ACR_HASH_AVALANCHE 0x165667919E3779F9ULL
+
+// the number of stripes accumulated before the lanes are
+// scrambled
+#define ACR_HASH_BLOCK_STRIPES 16
+
+// where the keys of the last stripe, the scramble, and the
+// two merges start in the secret
+#define ACR_HASH_SECRET_LAST 16
+#define ACR_HASH_SECRET_SCRAMBLE 24
+#define ACR_HASH_SECRET_LOW 32
+#define ACR_HASH_SECRET_HIGH 40
+#define ACR_HASH_SECRET_COUNT 48
+
+// the number of folded bytes hashed at a time by
+// ACR_HashString() when case is ignored
+#define ACR_HASH_FOLD_LENGTH 128
+
+#if defined(__SIZEOF_INT128__)
+// the compiler has a 128bit integer type
+__extension__ typedef unsigned __int128 ACR_HashUInt128_t;
+#define ACR_HASH_HAS_UINT128 ACR_BOOL_TRUE
+#else
+#define ACR_HASH_HAS_UINT128 ACR_BOOL_FALSE
+#endif
+
+////////////////////////////////////////////////////////////
+//
+// PRIVATE TABLES
+//
+////////////////////////////////////////////////////////////
+
+/** the keys of the lanes of the long hash when the seed is
+    0. with another seed the seed is added to the even keys
+	and subtracted from the odd keys
+*/
+static const ACR_Hash64_t g_ACRHashSecret[ACR_HASH_SECRET_COUNT] =
+{
+	0x2CB0F69F4ABEA221ULL, 0x9417034723148989ULL, 0xDD555950609DFE03ULL,
+	0xDBAFB150DEB12800ULL, 0x7E789B2E6C442CB6ULL, 0xF41E5636C7E4F8C4ULL,
+	0x0959D150F8FBA7E4ULL, 0xA97316F13CDB9EEAULL, 0x74CD8258F9520068ULL,
+	0x55C74A62E116868BULL, 0xD2F4C799A2023CBDULL, 0xDF98CB79A37B51B9ULL,
+	0x396F5885524F3905ULL, 0xAF1D56386CA3B276ULL, 0xA9FFBE6B5104E85AULL,
+	0x6BD0C51B9FD533B3ULL, 0x980CE91C50AB4B56ULL, 0x28AC395780FE62C5ULL,
+	0x768912E3A6BCEDC7ULL, 0x50B3E8C9332C7C88ULL, 0xCE3BBFE520BD47DAULL,
+	0xCBA6C8E8E0BB7C4FULL, 0xBF194DB8434A346DULL, 0x7D8F2A7B60416D7FULL,
+	0x0849D1F6E0E10A5EULL, 0x7654B590D064E22FULL, 0x16D1DA9507DF3AF2ULL,
+	0xF63AEF1089EA30E4ULL, 0x9ADE6673CC6C522BULL, 0x4C75BC274E37087CULL,
+	0xD35E12B49F51F27BULL, 0x22DDF2FFCEE481EAULL, 0x06007FB13C59A1F1ULL,
+	0x8966A38C651EA4DAULL, 0x25242F018FC01AC6ULL, 0xA73EC74FA31B717CULL,
+	0x7EE0ABDD9797D3A2ULL, 0x5C06FF7DC4AC1880ULL, 0x8434E41042C28A7DULL,
+	0x770A372D64327351ULL, 0xEED940DAD9E9C06DULL, 0x8977E93646524825ULL,
+	0xA9897F0A62A51616ULL, 0xA35D4250C53F2B3AULL, 0x4072542A94B9C33EULL,
+	0x3154A7A62447E8ABULL, 0x686865712A1A245EULL, 0x0FBA67727D7B3B98ULL
+};
+
+/** the starting values of the lanes of the long hash
+*/
+static const ACR_Hash64_t g_ACRHashLanes[8] =
+{
+	0x000000009E3779B1ULL, 0x9E3779B185EBCA87ULL, 0xC2B2AE3D27D4EB4FULL, 0x165667B19E3779F9ULL,
+	0x85EBCA77C2B2AE63ULL, 0x0000000085EBCA77ULL, 0x27D4EB2F165667C5ULL, 0x00000000C2B2AE3DULL
+};
+
+////////////////////////////////////////////////////////////
+//
+// PRIVATE FUNCTIONS
+//
+////////////////////////////////////////////////////////////
+
+/** read 8 bytes as a little endian value
+*/
+static ACR_Hash64_t ACR_HashRead64(
+	const ACR_Byte_t* src)
+{
+	return ((ACR_Hash64_t)src[0]) | (((ACR_Hash64_t)src[1]) << 8) | (((ACR_Hash64_t)src[2]) << 16) | (((ACR_Hash64_t)src[3]) << 24) |
+	       (((ACR_Hash64_t)src[4]) << 32) | (((ACR_Hash64_t)src[5]) << 40) | (((ACR_Hash64_t)src[6]) << 48) | (((ACR_Hash64_t)src[7]) << 56);
+}
+
+/** read 4 bytes as a little endian value
+*/
+static ACR_Hash64_t ACR_HashRead32(
+	const ACR_Byte_t* src)
+{
+	return ((ACR_Hash64_t)src[0]) | (((ACR_Hash64_t)src[1]) << 8) | (((ACR_Hash64_t)src[2]) << 16) | (((ACR_Hash64_t)src[3]) << 24);
+}
+
+/** multiply two values into a 128bit value and store the
+    low 64bits in (*a) and the high 64bits in (*b)
+*/
+static void ACR_HashMultiply(
+	ACR_Hash64_t* a,
+	ACR_Hash64_t* b)
+{
+	#if ACR_HASH_HAS_UINT128 == ACR_BOOL_TRUE
+	ACR_HashUInt128_t r = ((ACR_HashUInt128_t)(*a)) * (*b);
+	(*a) = (ACR_Hash64_t)r;
+	(*b) = (ACR_Hash64_t)(r >> 64);
+	#elif defined(_MSC_VER) && defined(_M_X64)
+	(*a) = _umul128((*a), (*b), b);
+	#else
+	ACR_Hash64_t hh = ((*a) >> 32) * ((*b) >> 32);
+	ACR_Hash64_t hl = ((*a) >> 32) * ((*b) & 0xFFFFFFFFULL);
+	ACR_Hash64_t lh = ((*a) & 0xFFFFFFFFULL) * ((*b) >> 32);
+	ACR_Hash64_t ll = ((*a) & 0xFFFFFFFFULL) * ((*b) & 0xFFFFFFFFULL);
+	ACR_Hash64_t t = ll + (hl << 32);
+	ACR_Hash64_t carry = (t < ll) ? 1 : 0;
+	ACR_Hash64_t low = t + (lh << 32);
+	carry += (low < t) ? 1 : 0;
+	(*a) = low;
+	(*b) = hh + (hl >> 32) + (lh >> 32) + carry;
+	#endif
+}
+
+/** multiply two values into a 128bit value and mix the low
+    and high 64bits together
+*/
+static ACR_Hash64_t ACR_HashMix(
+	ACR_Hash64_t a,
+	ACR_Hash64_t b)
+{
+	ACR_HashMultiply(&a, &b);
+	return a ^ b;
+}
+
+/** hash data of up to ACR_HASH_LONG_LENGTH bytes into two
+    values that are mixed differently for the 64bit and the
+	128bit hash
+*/
+static void ACR_HashShort(
+	const ACR_Byte_t* src,
+	ACR_Length_t length,
+	ACR_Hash64_t seed,
+	ACR_Hash64_t* a,
+	ACR_Hash64_t* b)
+{
+	ACR_Hash64_t see1;
+	ACR_Hash64_t see2;
+	ACR_Length_t remaining = length;
+	ACR_Length_t middle;
+
+	seed ^= ACR_HashMix(seed ^ ACR_HASH_P0, ACR_HASH_P1);
+	if(length <= 16)
+	{
+		if(length >= 4)
+		{
+			// two overlapping reads from each end cover every
+			// byte of 4 to 16 bytes
+			middle = (length >> 3) << 2;
+			(*a) = (ACR_HashRead32(src) << 32) | ACR_HashRead32(src + middle);
+			(*b) = (ACR_HashRead32(src + length - 4) << 32) | ACR_HashRead32(src + length - 4 - middle);
+		}
+		else if(length > 0)
+		{
+			(*a) = (((ACR_Hash64_t)src[0]) << 16) | (((ACR_Hash64_t)src[length >> 1]) << 8) | src[length - 1];
+			(*b) = 0;
+		}
+		else
+		{
+			(*a) = 0;
+			(*b) = 0;
+		}
+	}
+	else
+	{
+		if(remaining > 48)
+		{
+			// three independent multiplies at a time
+			see1 = seed;
+			see2 = seed;
+			do
+			{
+				seed = ACR_HashMix(ACR_HashRead64(src) ^ ACR_HASH_P1, ACR_HashRead64(src + 8) ^ seed);
+				see1 = ACR_HashMix(ACR_HashRead64(src + 16) ^ ACR_HASH_P2, ACR_HashRead64(src + 24) ^ see1);
+				see2 = ACR_HashMix(ACR_HashRead64(src + 32) ^ ACR_HASH_P3, ACR_HashRead64(src + 40) ^ see2);
+				src += 48;
+				remaining -= 48;
+			} while(remaining > 48);
+			seed ^= see1 ^ see2;
+		}
+		while(remaining > 16)
+		{
+			seed = ACR_HashMix(ACR_HashRead64(src) ^ ACR_HASH_P1, ACR_HashRead64(src + 8) ^ seed);
+			src += 16;
+			remaining -= 16;
+		}
+		// the last 16 bytes, which can overlap bytes that were
+		// already hashed
+		(*a) = ACR_HashRead64(src + remaining - 16);
+		(*b) = ACR_HashRead64(src + remaining - 8);
+	}
+	(*a) ^= ACR_HASH_P1;
+	(*b) ^= seed;
+	ACR_HashMultiply(a, b);
+}
+
+/** get the keys of the long hash for a seed
+*/
+static void ACR_HashSecret(
+	ACR_Hash64_t* secret,
+	ACR_Hash64_t seed)
+{
+	int i;
+	for(i = 0; i < ACR_HASH_SECRET_COUNT; i += 2)
+	{
+		secret[i] = g_ACRHashSecret[i] + seed;
+		secret[i + 1] = g_ACRHashSecret[i + 1] - seed;
+	}
+}
+
+/** accumulate stripes of data into the lanes. stripe n uses
+    the keys starting at keys[n]
+*/
+static void ACR_HashAccumulate(
+	ACR_Hash64_t* lanes,
+	const ACR_Byte_t* src,
+	ACR_Count_t stripes,
+	const ACR_Hash64_t* keys)
+{
+	#if ACR_HAS_SSE2 == ACR_BOOL_TRUE
+	__m128i acc[4];
+	__m128i data;
+	__m128i key;
+	ACR_Count_t n;
+	int i;
+	for(i = 0; i < 4; i++)
+	{
+		acc[i] = _mm_loadu_si128((const __m128i*)(lanes + (i * 2)));
+	}
+	for(n = 0; n < stripes; n++)
+	{
+		for(i = 0; i < 4; i++)
+		{
+			data = _mm_loadu_si128((const __m128i*)(src + (i * 16)));
+			key = _mm_xor_si128(data, _mm_loadu_si128((const __m128i*)(keys + n + (i * 2))));
+			// the low 32bits of each 64bit lane times the high
+			// 32bits, plus the data of the other lane
+			key = _mm_mul_epu32(key, _mm_shuffle_epi32(key, _MM_SHUFFLE(0, 3, 0, 1)));
+			acc[i] = _mm_add_epi64(acc[i], _mm_add_epi64(key, _mm_shuffle_epi32(data, _MM_SHUFFLE(1, 0, 3, 2))));
+		}
+		src += ACR_HASH_STRIPE_LENGTH;
+	}
+	for(i = 0; i < 4; i++)
+	{
+		_mm_storeu_si128((__m128i*)(lanes + (i * 2)), acc[i]);
+	}
+	#else
+	ACR_Hash64_t data;
+	ACR_Hash64_t key;
+	ACR_Count_t n;
+	int i;
+	for(n = 0; n < stripes; n++)
+	{
+		for(i = 0; i < 8; i++)
+		{
+			data = ACR_HashRead64(src + (i * 8));
+			key = data ^ keys[n + i];
+			lanes[i ^ 1] += data;
+			lanes[i] += (key & 0xFFFFFFFFULL) * (key >> 32);
+		}
+		src += ACR_HASH_STRIPE_LENGTH;
+	}
+	#endif
+}
+
+/** scramble the lanes after a block of stripes so that the
+    high bits of each lane affect the low bits
+*/
+static void ACR_HashScramble(
+	ACR_Hash64_t* lanes,
+	const ACR_Hash64_t* keys)
+{
+	#if ACR_HAS_SSE2 == ACR_BOOL_TRUE
+	const __m128i prime = _mm_set1_epi32((int)ACR_HASH_PRIME32);
+	__m128i acc;
+	int i;
+	for(i = 0; i < 8; i += 2)
+	{
+		acc = _mm_loadu_si128((const __m128i*)(lanes + i));
+		acc = _mm_xor_si128(acc, _mm_srli_epi64(acc, 47));
+		acc = _mm_xor_si128(acc, _mm_loadu_si128((const __m128i*)(keys + i)));
+		// 64bit times 32bit from two 32bit multiplies
+		acc = _mm_add_epi64(_mm_mul_epu32(acc, prime), _mm_slli_epi64(_mm_mul_epu32(_mm_srli_epi64(acc, 32), prime), 32));
+		_mm_storeu_si128((__m128i*)(lanes + i), acc);
+	}
+	#else
+	int i;
+	for(i = 0; i < 8; i++)
+	{
+		lanes[i] ^= lanes[i] >> 47;
+		lanes[i] ^= keys[i];
+		lanes[i] *= ACR_HASH_PRIME32;
+	}
+	#endif
+}
+
+/** accumulate stripes, scrambling the lanes after each
+    ACR_HASH_BLOCK_STRIPES stripes
+	\param stripes the number of stripes accumulated since
+	       the last scramble, which is updated
+*/
+static void ACR_HashConsume(
+	ACR_Hash64_t* lanes,
+	const ACR_Hash64_t* secret,
+	ACR_Count_t* stripes,
+	const ACR_Byte_t* src,
+	ACR_Count_t count)
+{
+	ACR_Count_t n;
+	while(count > 0)
+	{
+		n = ACR_HASH_BLOCK_STRIPES - (*stripes);
+		if(n > count)
+		{
+			n = count;
+		}
+		ACR_HashAccumulate(lanes, src, n, secret + (*stripes));
+		src += n * ACR_HASH_STRIPE_LENGTH;
+		count -= n;
+		(*stripes) += n;
+		if((*stripes) == ACR_HASH_BLOCK_STRIPES)
+		{
+			ACR_HashScramble(lanes, secret + ACR_HASH_SECRET_SCRAMBLE);
+			(*stripes) = 0;
+		}
+	}
+}
+
+/** mix the lanes into one value
+*/
+static ACR_Hash64_t ACR_HashMerge(
+	const ACR_Hash64_t* lanes,
+	const ACR_Hash64_t* keys,
+	ACR_Hash64_t start)
+{
+	int i;
+	for(i = 0; i < 8; i += 2)
+	{
+		start += ACR_HashMix(lanes[i] ^ keys[i], lanes[i + 1] ^ keys[i + 1]);
+	}
+	start ^= start >> 37;
+	start *= ACR_HASH_AVALANCHE;
+	start ^= start >> 32;
+	return start;
+}
+
+/** hash data longer than ACR_HASH_LONG_LENGTH bytes
+*/
+static ACR_Hash128_t ACR_HashLong(
+	const ACR_Byte_t* src,
+	ACR_Length_t length,
+	ACR_Hash64_t seed,
+	int wantHigh)
+{
+	ACR_Hash64_t lanes[8];
+	ACR_Hash64_t seeded[ACR_HASH_SECRET_COUNT];
+	const ACR_Hash64_t* secret = g_ACRHashSecret;
+	ACR_Hash128_t result;
+	ACR_Count_t stripes = 0;
+
+	if(seed != 0)
+	{
+		ACR_HashSecret(seeded, seed);
+		secret = seeded;
+	}
+	memcpy(lanes, g_ACRHashLanes, sizeof(lanes));
+	// the last stripe always ends at the last byte, so the
+	// stripes before it stop at least one byte before that
+	ACR_HashConsume(lanes, secret, &stripes, src, (ACR_Count_t)((length - 1) / ACR_HASH_STRIPE_LENGTH));
+	ACR_HashAccumulate(lanes, src + length - ACR_HASH_STRIPE_LENGTH, 1, secret + ACR_HASH_SECRET_LAST);
+	result.m_Low = ACR_HashMerge(lanes, secret + ACR_HASH_SECRET_LOW, length * ACR_HASH_PRIME64_1);
+	result.m_High = (wantHigh != 0) ? ACR_HashMerge(lanes, secret + ACR_HASH_SECRET_HIGH, ~(length * ACR_HASH_PRIME64_2)) : 0;
+	return result;
+}
+
+/** fold the case of as many characters as fit in memory
+    \returns the number of bytes written to dst and the
+	         number of bytes read from src in (*read)
+*/
+static ACR_Length_t ACR_HashFold(
+	const ACR_Byte_t* src,
+	ACR_Length_t length,
+	ACR_Byte_t* dst,
+	ACR_Length_t* read)
+{
+	ACR_Length_t pos = 0;
+	ACR_Length_t used = 0;
+	ACR_Length_t bytes;
+	ACR_Byte_t c;
+	// leave room for the longest UTF8 character
+	while((pos < length) && (used <= (ACR_HASH_FOLD_LENGTH - 4)))
+	{
+		c = src[pos];
+		if(c < 0x80)
+		{
+			// ASCII characters do not need to be decoded
+			dst[used++] = ((c >= 'A') && (c <= 'Z')) ? (ACR_Byte_t)(c + ('a' - 'A')) : c;
+			pos++;
+		}
+		else
+		{
+			bytes = ACR_UTF8_BYTE_COUNT(c);
+			if((bytes == 1) || (bytes > (length - pos)))
+			{
+				// bytes that are not a whole character are
+				// hashed as they are
+				dst[used++] = c;
+				pos++;
+			}
+			else
+			{
+				used += (ACR_Length_t)ACR_UnicodeToUtf8(ACR_UnicodeFold(ACR_Utf8ToUnicode(src + pos, (int)bytes)), dst + used);
+				pos += bytes;
+			}
+		}
+	}
+	(*read) = pos;
+	return used;
+}
+
+////////////////////////////////////////////////////////////
+//
+// PUBLIC FUNCTIONS
+//
+////////////////////////////////////////////////////////////
+
+/**********************************************************/
+ACR_Hash64_t ACR_Hash64(
+	const ACR_Byte_t* src,
+	ACR_Length_t length,
+	ACR_Hash64_t seed)
+{
+	ACR_Hash64_t a;
+	ACR_Hash64_t b;
+
+	if(length > ACR_HASH_LONG_LENGTH)
+	{
+		return ACR_HashLong(src, length, seed, 0).m_Low;
+	}
+	ACR_HashShort(src, length, seed, &a, &b);
+	return ACR_HashMix(a ^ ACR_HASH_P0 ^ length, b ^ ACR_HASH_P1);
+}
+
+/**********************************************************/
+ACR_Hash128_t ACR_Hash128(
+	const ACR_Byte_t* src,
+	ACR_Length_t length,
+	ACR_Hash64_t seed)
+{
+	ACR_Hash128_t result;
+	ACR_Hash64_t a;
+	ACR_Hash64_t b;
+
+	if(length > ACR_HASH_LONG_LENGTH)
+	{
+		return ACR_HashLong(src, length, seed, 1);
+	}
+	ACR_HashShort(src, length, seed, &a, &b);
+	result.m_Low = ACR_HashMix(a ^ ACR_HASH_P0 ^ length, b ^ ACR_HASH_P1);
+	result.m_High = ACR_HashMix(a ^ ACR_HASH_P2, b ^ ACR_HASH_P3 ^ length);
+	return result;
+}
+
+/**********************************************************/
+ACR_Hash64_t ACR_HashBuffer(
+	ACR_Buffer_t src,
+	ACR_Hash64_t seed)
+{
+	return ACR_Hash64((const ACR_Byte_t*)src.m_Pointer, src.m_Length, seed);
+}
+
+/**********************************************************/
+ACR_Hash64_t ACR_HashString(
+	ACR_String_t src,
+	ACR_Info_t caseSensitive,
+	ACR_Hash64_t seed)
+{
+	ACR_HashState_t state;
+	ACR_Byte_t folded[ACR_HASH_FOLD_LENGTH];
+	const ACR_Byte_t* pos = (const ACR_Byte_t*)src.m_Buffer.m_Pointer;
+	ACR_Length_t remaining = src.m_Buffer.m_Length;
+	ACR_Length_t used;
+	ACR_Length_t read;
+
+	if(caseSensitive != ACR_INFO_NO)
+	{
+		return ACR_Hash64(pos, remaining, seed);
+	}
+
+	used = ACR_HashFold(pos, remaining, folded, &read);
+	if(read == remaining)
+	{
+		// short strings fold into memory all at once
+		return ACR_Hash64(folded, used, seed);
+	}
+	ACR_HashInit(&state, seed);
+	while(1)
+	{
+		ACR_HashUpdate(&state, folded, used);
+		pos += read;
+		remaining -= read;
+		if(remaining == 0)
+		{
+			break;
+		}
+		used = ACR_HashFold(pos, remaining, folded, &read);
+	}
+	return ACR_HashFinal64(&state);
+}
+
+/**********************************************************/
+void ACR_HashInit(
+	ACR_HashState_t* me,
+	ACR_Hash64_t seed)
+{
+	if(me == ACR_NULL)
+	{
+		return;
+	}
+
+	memcpy(me->m_Lanes, g_ACRHashLanes, sizeof(me->m_Lanes));
+	ACR_HashSecret(me->m_Secret, seed);
+	me->m_Seed = seed;
+	me->m_Length = 0;
+	me->m_BufferUsed = 0;
+	me->m_Stripes = 0;
+}
+
+/**********************************************************/
+void ACR_HashUpdate(
+	ACR_HashState_t* me,
+	const ACR_Byte_t* src,
+	ACR_Length_t length)
+{
+	ACR_Length_t fill;
+
+	if((me == ACR_NULL) || (length == 0))
+	{
+		return;
+	}
+
+	me->m_Length += length;
+	if((me->m_BufferUsed + length) <= ACR_HASH_LONG_LENGTH)
+	{
+		memcpy(me->m_Buffer + me->m_BufferUsed, src, (size_t)length);
+		me->m_BufferUsed += length;
+		return;
+	}
+
+	// there is more data, so the full buffer is not the end
+	if(me->m_BufferUsed > 0)
+	{
+		fill = ACR_HASH_LONG_LENGTH - me->m_BufferUsed;
+		memcpy(me->m_Buffer + me->m_BufferUsed, src, (size_t)fill);
+		src += fill;
+		length -= fill;
+		ACR_HashConsume(me->m_Lanes, me->m_Secret, &me->m_Stripes, me->m_Buffer, ACR_HASH_LONG_LENGTH / ACR_HASH_STRIPE_LENGTH);
+		me->m_BufferUsed = 0;
+	}
+	if(length > ACR_HASH_LONG_LENGTH)
+	{
+		// hash most of the data where it is and keep the last
+		// stripe in case the rest is shorter than a stripe
+		fill = ((length - 1) / ACR_HASH_LONG_LENGTH) * ACR_HASH_LONG_LENGTH;
+		ACR_HashConsume(me->m_Lanes, me->m_Secret, &me->m_Stripes, src, (ACR_Count_t)(fill / ACR_HASH_STRIPE_LENGTH));
+		memcpy(me->m_Buffer + ACR_HASH_LONG_LENGTH - ACR_HASH_STRIPE_LENGTH, src + fill - ACR_HASH_STRIPE_LENGTH, ACR_HASH_STRIPE_LENGTH);
+		src += fill;
+		length -= fill;
+	}
+	memcpy(me->m_Buffer, src, (size_t)length);
+	me->m_BufferUsed = length;
+}
+
+/**********************************************************/
+ACR_Hash64_t ACR_HashFinal64(
+	const ACR_HashState_t* me)
+{
+	return ACR_HashFinal128(me).m_Low;
+}
+
+/**********************************************************/
+ACR_Hash128_t ACR_HashFinal128(
+	const ACR_HashState_t* me)
+{
+	ACR_Hash128_t result;
+	ACR_Hash64_t lanes[8];
+	ACR_Byte_t last[ACR_HASH_STRIPE_LENGTH];
+	ACR_Count_t stripes;
+	ACR_Length_t before;
+
+	if(me == ACR_NULL)
+	{
+		result.m_Low = 0;
+		result.m_High = 0;
+		return result;
+	}
+	if(me->m_Length <= ACR_HASH_LONG_LENGTH)
+	{
+		return ACR_Hash128(me->m_Buffer, me->m_Length, me->m_Seed);
+	}
+
+	memcpy(lanes, me->m_Lanes, sizeof(lanes));
+	stripes = me->m_Stripes;
+	ACR_HashConsume(lanes, me->m_Secret, &stripes, me->m_Buffer, (ACR_Count_t)((me->m_BufferUsed - 1) / ACR_HASH_STRIPE_LENGTH));
+	if(me->m_BufferUsed >= ACR_HASH_STRIPE_LENGTH)
+	{
+		ACR_HashAccumulate(lanes, me->m_Buffer + me->m_BufferUsed - ACR_HASH_STRIPE_LENGTH, 1, me->m_Secret + ACR_HASH_SECRET_LAST);
+	}
+	else
+	{
+		// the last stripe starts in the data that was already
+		// accumulated, which is still at the end of the buffer
+		before = ACR_HASH_STRIPE_LENGTH - me->m_BufferUsed;
+		memcpy(last, me->m_Buffer + ACR_HASH_LONG_LENGTH - before, (size_t)before);
+		memcpy(last + before, me->m_Buffer, (size_t)me->m_BufferUsed);
+		ACR_HashAccumulate(lanes, last, 1, me->m_Secret + ACR_HASH_SECRET_LAST);
+	}
+	result.m_Low = ACR_HashMerge(lanes, me->m_Secret + ACR_HASH_SECRET_LOW, me->m_Length * ACR_HASH_PRIME64_1);
+	result.m_High = ACR_HashMerge(lanes, me->m_Secret + ACR_HASH_SECRET_HIGH, ~(me->m_Length * ACR_HASH_PRIME64_2));
+	return result;
+}
+
+#endif // #if ACR_USE_64BIT == ACR_BOOL_TRUE
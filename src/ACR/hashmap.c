@@ -0,0 +1,798 @@
+/*
+
+    ********** DO NOT REMOVE THIS INFORMATION ************
+
+    ACR - A set of C functions in a git Repository
+    Copyright (C) 2018 - 2020 Adam C. Rosenberg
+
+    Please read LICENSE before using this code
+
+    Please read README.md for instructions on including
+    this code in your project and where to find examples
+
+    If you contribute to this code, Please add your name
+    and email address to the AUTHORS list below so that
+    we know who to thank!
+
+    AUTHORS
+
+    Adam Rosenberg <adam@sirspot.com>
+
+    LICENSE
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+    ******************************************************
+
+*/
+/** \file hashmap.c
+
+    functions for access to the ACR_HashMap_t type
+
+    The memory of a map is the control bytes of every slot,
+    then the overflow count of every group, then the slots.
+    Each slot is the key followed by the value. String keys
+    are stored as an offset into m_Keys, so the key bytes can
+    move when m_Keys grows, with the full hash so the map can
+    grow without hashing the keys again.
+
+*/
+#include "ACR/hashmap.h"
+#include "ACR/hash.h"
+
+// included for memcmp(), memcpy(), and memset()
+#include <string.h>
+
+////////////////////////////////////////////////////////////
+//
+// PRIVATE DEFINES
+//
+////////////////////////////////////////////////////////////
+
+// the control byte of an empty slot. the control byte of a
+// used slot is 7 bits of the hash so the high bit is clear
+#define ACR_HASHMAP_EMPTY 0x80
+
+// the bits of the hash used for the control byte
+#define ACR_HASHMAP_H2(hash) ((ACR_Byte_t)((hash) & 0x7F))
+
+// the bits of the hash used to find the first group
+#define ACR_HASHMAP_H1(hash) ((hash) >> 7)
+
+// round a length up to a multiple of ACR_HASHMAP_VALUE_ALIGN
+#define ACR_HASHMAP_ROUND(length) ((((length) + ACR_HASHMAP_VALUE_ALIGN - 1) / ACR_HASHMAP_VALUE_ALIGN) * ACR_HASHMAP_VALUE_ALIGN)
+
+// the most keys that fit in the capacity before growing
+#define ACR_HASHMAP_MAX_COUNT(capacity) (((capacity) / ACR_HASHMAP_GROUP_SIZE) * ACR_HASHMAP_MAX_LOAD)
+
+// the overflow counts of the groups
+#define ACR_HASHMAP_OVERFLOW(me) ((ACR_Count_t*)(((ACR_Byte_t*)(me)->m_Memory.m_Pointer) + (me)->m_Capacity))
+
+// the first byte of a slot
+#define ACR_HASHMAP_SLOT(me, index) (((ACR_Byte_t*)(me)->m_Memory.m_Pointer) + ACR_HashMapSlotsOffset((me)->m_Capacity) + ((ACR_Length_t)(index) * (me)->m_SlotLength))
+
+////////////////////////////////////////////////////////////
+//
+// PRIVATE TYPES
+//
+////////////////////////////////////////////////////////////
+
+#ifdef ACR_COMPILER_VS2017
+#pragma warning(push)
+// disable warning C4820: padding added after data member
+#pragma warning(disable:4820)
+#endif
+/** the key of a slot of a string map
+*/
+typedef struct ACR_HashMapStringKey_s
+{
+	ACR_Length_t m_Offset;
+	ACR_Length_t m_Length;
+	ACR_Length_t m_Hash;
+	ACR_Count_t m_Count;
+} ACR_HashMapStringKey_t;
+#ifdef ACR_COMPILER_VS2017
+#pragma warning(pop)
+#endif
+
+////////////////////////////////////////////////////////////
+//
+// PRIVATE FUNCTIONS
+//
+////////////////////////////////////////////////////////////
+
+/** get the offset of the slots from the start of the memory
+*/
+static ACR_Length_t ACR_HashMapSlotsOffset(
+	ACR_Count_t capacity)
+{
+	return ACR_HASHMAP_ROUND((ACR_Length_t)capacity + (((ACR_Length_t)capacity / ACR_HASHMAP_GROUP_SIZE) * sizeof(ACR_Count_t)));
+}
+
+/** mix the bits of an integer key so that every bit of the
+    key changes the low bits and the high bits of the hash
+*/
+static ACR_Length_t ACR_HashMapHashInteger(
+	ACR_Length_t key)
+{
+	#if ACR_USE_64BIT == ACR_BOOL_TRUE
+	key ^= key >> 33;
+	key *= 0xFF51AFD7ED558CCDULL;
+	key ^= key >> 33;
+	key *= 0xC4CEB9FE1A85EC53ULL;
+	key ^= key >> 33;
+	#else
+	key &= 0xFFFFFFFFUL;
+	key ^= key >> 16;
+	key = (key * 0x85EBCA6BUL) & 0xFFFFFFFFUL;
+	key ^= key >> 13;
+	key = (key * 0xC2B2AE35UL) & 0xFFFFFFFFUL;
+	key ^= key >> 16;
+	#endif
+	return key;
+}
+
+/** hash the bytes of a string key
+*/
+static ACR_Length_t ACR_HashMapHashString(
+	ACR_String_t key)
+{
+	#if ACR_USE_64BIT == ACR_BOOL_TRUE
+	return ACR_Hash64((const ACR_Byte_t*)key.m_Buffer.m_Pointer, key.m_Buffer.m_Length, 0);
+	#else
+	const ACR_Byte_t* src = (const ACR_Byte_t*)key.m_Buffer.m_Pointer;
+	ACR_Length_t hash = 2166136261UL;
+	ACR_Length_t pos;
+	for(pos = 0; pos < key.m_Buffer.m_Length; pos++)
+	{
+		hash = ((hash ^ src[pos]) * 16777619UL) & 0xFFFFFFFFUL;
+	}
+	// FNV-1a only mixes each byte into the bits above it, so
+	// mix again for the control byte from the low bits
+	return ACR_HashMapHashInteger(hash);
+	#endif
+}
+
+/** get a mask with one bit for each control byte of a group
+    that has the specified value
+*/
+static unsigned int ACR_HashMapMatch(
+	const ACR_Byte_t* control,
+	ACR_Byte_t value)
+{
+	#if ACR_HAS_SSE2 == ACR_BOOL_TRUE
+	__m128i group = _mm_loadu_si128((const __m128i*)control);
+	return (unsigned int)_mm_movemask_epi8(_mm_cmpeq_epi8(group, _mm_set1_epi8((char)value)));
+	#else
+	unsigned int mask = 0;
+	int i;
+	for(i = 0; i < ACR_HASHMAP_GROUP_SIZE; i++)
+	{
+		if(control[i] == value)
+		{
+			mask |= (1U << i);
+		}
+	}
+	return mask;
+	#endif
+}
+
+/** check if the key of a slot is the key being looked for
+*/
+static int ACR_HashMapKeyEqual(
+	const ACR_HashMap_t* me,
+	const ACR_Byte_t* slot,
+	ACR_Length_t hash,
+	ACR_Length_t integer,
+	const ACR_String_t* string)
+{
+	const ACR_HashMapStringKey_t* key;
+	if(me->m_KeyType == ACR_HASHMAP_KEYS_INTEGER)
+	{
+		return (*((const ACR_Length_t*)slot)) == integer;
+	}
+	key = (const ACR_HashMapStringKey_t*)slot;
+	return (key->m_Hash == hash) && (key->m_Length == string->m_Buffer.m_Length) &&
+	       ((key->m_Length == 0) || (memcmp(((const ACR_Byte_t*)me->m_Keys.m_Pointer) + key->m_Offset, string->m_Buffer.m_Pointer, (size_t)key->m_Length) == 0));
+}
+
+/** find the slot of a key
+    \returns the index of the slot or m_Capacity if the key
+	         is not in the map
+*/
+static ACR_Count_t ACR_HashMapFindIndex(
+	const ACR_HashMap_t* me,
+	ACR_Length_t hash,
+	ACR_Length_t integer,
+	const ACR_String_t* string)
+{
+	const ACR_Byte_t* control = (const ACR_Byte_t*)me->m_Memory.m_Pointer;
+	const ACR_Byte_t* slots;
+	const ACR_Count_t* overflow;
+	ACR_Count_t groupMask;
+	ACR_Count_t group;
+	ACR_Count_t index;
+	ACR_Byte_t h2 = ACR_HASHMAP_H2(hash);
+	unsigned int match;
+
+	if(me->m_Count == 0)
+	{
+		return me->m_Capacity;
+	}
+
+	slots = ACR_HASHMAP_SLOT(me, 0);
+	overflow = ACR_HASHMAP_OVERFLOW(me);
+	groupMask = (me->m_Capacity / ACR_HASHMAP_GROUP_SIZE) - 1;
+	group = (ACR_Count_t)ACR_HASHMAP_H1(hash) & groupMask;
+	while(1)
+	{
+		match = ACR_HashMapMatch(control + (group * ACR_HASHMAP_GROUP_SIZE), h2);
+		while(match != 0)
+		{
+			index = (group * ACR_HASHMAP_GROUP_SIZE) + (ACR_Count_t)ACR_BLOCK_TRAILING_ZEROS((ACR_Block_t)match);
+			if(ACR_HashMapKeyEqual(me, slots + ((ACR_Length_t)index * me->m_SlotLength), hash, integer, string) != 0)
+			{
+				return index;
+			}
+			match &= match - 1;
+		}
+		// no key that starts at or before this group was
+		// placed after it
+		if(overflow[group] == 0)
+		{
+			return me->m_Capacity;
+		}
+		group = (group + 1) & groupMask;
+	}
+}
+
+/** use the first empty slot for a key that is not in the
+    map, counting the full groups that were skipped
+    \returns the index of the slot
+*/
+static ACR_Count_t ACR_HashMapPlace(
+	ACR_HashMap_t* me,
+	ACR_Length_t hash)
+{
+	ACR_Byte_t* control = (ACR_Byte_t*)me->m_Memory.m_Pointer;
+	ACR_Count_t* overflow = ACR_HASHMAP_OVERFLOW(me);
+	ACR_Count_t groupMask = (me->m_Capacity / ACR_HASHMAP_GROUP_SIZE) - 1;
+	ACR_Count_t group = (ACR_Count_t)ACR_HASHMAP_H1(hash) & groupMask;
+	ACR_Count_t index;
+	unsigned int empty;
+	while(1)
+	{
+		empty = ACR_HashMapMatch(control + (group * ACR_HASHMAP_GROUP_SIZE), ACR_HASHMAP_EMPTY);
+		if(empty != 0)
+		{
+			index = (group * ACR_HASHMAP_GROUP_SIZE) + (ACR_Count_t)ACR_BLOCK_TRAILING_ZEROS((ACR_Block_t)empty);
+			control[index] = ACR_HASHMAP_H2(hash);
+			return index;
+		}
+		overflow[group]++;
+		group = (group + 1) & groupMask;
+	}
+}
+
+/** empty the slot of a key and undo the overflow counts of
+    the groups before it
+*/
+static void ACR_HashMapEmpty(
+	ACR_HashMap_t* me,
+	ACR_Count_t index,
+	ACR_Length_t hash)
+{
+	ACR_Byte_t* control = (ACR_Byte_t*)me->m_Memory.m_Pointer;
+	ACR_Count_t* overflow = ACR_HASHMAP_OVERFLOW(me);
+	ACR_Count_t groupMask = (me->m_Capacity / ACR_HASHMAP_GROUP_SIZE) - 1;
+	ACR_Count_t group = (ACR_Count_t)ACR_HASHMAP_H1(hash) & groupMask;
+	ACR_Count_t last = index / ACR_HASHMAP_GROUP_SIZE;
+	while(group != last)
+	{
+		overflow[group]--;
+		group = (group + 1) & groupMask;
+	}
+	control[index] = ACR_HASHMAP_EMPTY;
+	me->m_Count--;
+}
+
+/** move every key to memory with a new number of slots, and
+    move the bytes of string keys together to reuse the bytes
+	of removed keys
+    \returns ACR_INFO_OK or ACR_INFO_ERROR
+*/
+static ACR_Info_t ACR_HashMapRehash(
+	ACR_HashMap_t* me,
+	ACR_Count_t capacity)
+{
+	ACR_HashMap_t larger = (*me);
+	ACR_HashMapStringKey_t* key;
+	const ACR_Byte_t* control = (const ACR_Byte_t*)me->m_Memory.m_Pointer;
+	ACR_Byte_t* slot;
+	ACR_Length_t length = ACR_HashMapSlotsOffset(capacity) + ((ACR_Length_t)capacity * me->m_SlotLength);
+	ACR_Count_t i;
+	ACR_Count_t index;
+	ACR_BUFFER(keys);
+
+	larger.m_Memory.m_Pointer = ACR_NULL;
+	larger.m_Memory.m_Length = ACR_ZERO_LENGTH;
+	larger.m_Memory.m_Flags = ACR_BUFFER_FLAGS_NONE;
+	ACR_BUFFER_ALLOC(larger.m_Memory, length);
+	ACR_UNUSED(length);
+	if(ACR_BUFFER_IS_VALID(larger.m_Memory) == ACR_BOOL_FALSE)
+	{
+		return ACR_INFO_ERROR;
+	}
+	if((me->m_KeyType == ACR_HASHMAP_KEYS_STRING) && (me->m_KeysRemoved > 0))
+	{
+		ACR_BUFFER_ALLOC(keys, me->m_KeysUsed - me->m_KeysRemoved);
+		if(ACR_BUFFER_IS_VALID(keys) == ACR_BOOL_FALSE)
+		{
+			ACR_BUFFER_FREE(larger.m_Memory);
+			return ACR_INFO_ERROR;
+		}
+		larger.m_Keys = keys;
+		larger.m_KeysUsed = 0;
+		larger.m_KeysRemoved = 0;
+	}
+	larger.m_Capacity = capacity;
+	memset(larger.m_Memory.m_Pointer, ACR_HASHMAP_EMPTY, (size_t)capacity);
+	memset(ACR_HASHMAP_OVERFLOW(&larger), 0, (size_t)(capacity / ACR_HASHMAP_GROUP_SIZE) * sizeof(ACR_Count_t));
+
+	for(i = 0; i < me->m_Capacity; i++)
+	{
+		if(control[i] == ACR_HASHMAP_EMPTY)
+		{
+			continue;
+		}
+		slot = ACR_HASHMAP_SLOT(me, i);
+		if(me->m_KeyType == ACR_HASHMAP_KEYS_INTEGER)
+		{
+			index = ACR_HashMapPlace(&larger, ACR_HashMapHashInteger(*((const ACR_Length_t*)slot)));
+		}
+		else
+		{
+			index = ACR_HashMapPlace(&larger, ((const ACR_HashMapStringKey_t*)slot)->m_Hash);
+		}
+		memcpy(ACR_HASHMAP_SLOT(&larger, index), slot, (size_t)me->m_SlotLength);
+		if(ACR_BUFFER_IS_VALID(keys) == ACR_BOOL_TRUE)
+		{
+			key = (ACR_HashMapStringKey_t*)ACR_HASHMAP_SLOT(&larger, index);
+			memcpy(((ACR_Byte_t*)keys.m_Pointer) + larger.m_KeysUsed, ((const ACR_Byte_t*)me->m_Keys.m_Pointer) + key->m_Offset, (size_t)key->m_Length);
+			key->m_Offset = larger.m_KeysUsed;
+			larger.m_KeysUsed += key->m_Length;
+		}
+	}
+
+	ACR_BUFFER_FREE(me->m_Memory);
+	if(ACR_BUFFER_IS_VALID(keys) == ACR_BOOL_TRUE)
+	{
+		ACR_BUFFER_FREE(me->m_Keys);
+	}
+	(*me) = larger;
+	return ACR_INFO_OK;
+}
+
+/** make sure there is room to add one more key
+    \returns ACR_INFO_OK or ACR_INFO_ERROR
+*/
+static ACR_Info_t ACR_HashMapGrow(
+	ACR_HashMap_t* me)
+{
+	if((me->m_Capacity > 0) && (me->m_Count < ACR_HASHMAP_MAX_COUNT(me->m_Capacity)))
+	{
+		return ACR_INFO_OK;
+	}
+	return ACR_HashMapReserve(me, me->m_Count + 1);
+}
+
+/** copy the bytes of a string key to the end of m_Keys
+    \returns ACR_INFO_OK or ACR_INFO_ERROR
+*/
+static ACR_Info_t ACR_HashMapCopyKey(
+	ACR_HashMap_t* me,
+	ACR_String_t key)
+{
+	ACR_Length_t length;
+	ACR_BUFFER(keys);
+
+	if((me->m_KeysUsed + key.m_Buffer.m_Length) > me->m_Keys.m_Length)
+	{
+		// double the memory each time more is needed
+		length = me->m_Keys.m_Length * 2;
+		if(length < (me->m_KeysUsed + key.m_Buffer.m_Length))
+		{
+			length = me->m_KeysUsed + key.m_Buffer.m_Length;
+		}
+		if(length < 256)
+		{
+			length = 256;
+		}
+		ACR_BUFFER_ALLOC(keys, length);
+		ACR_UNUSED(length);
+		if(ACR_BUFFER_IS_VALID(keys) == ACR_BOOL_FALSE)
+		{
+			return ACR_INFO_ERROR;
+		}
+		if(me->m_KeysUsed > 0)
+		{
+			memcpy(keys.m_Pointer, me->m_Keys.m_Pointer, (size_t)me->m_KeysUsed);
+		}
+		ACR_BUFFER_FREE(me->m_Keys);
+		me->m_Keys = keys;
+	}
+	if(key.m_Buffer.m_Length > 0)
+	{
+		memcpy(((ACR_Byte_t*)me->m_Keys.m_Pointer) + me->m_KeysUsed, key.m_Buffer.m_Pointer, (size_t)key.m_Buffer.m_Length);
+	}
+	me->m_KeysUsed += key.m_Buffer.m_Length;
+	return ACR_INFO_OK;
+}
+
+////////////////////////////////////////////////////////////
+//
+// PUBLIC FUNCTIONS
+//
+////////////////////////////////////////////////////////////
+
+/**********************************************************/
+void ACR_HashMapInit(
+	ACR_HashMap_t* me,
+	int keyType,
+	ACR_Length_t valueLength)
+{
+	if(me == ACR_NULL)
+	{
+		return;
+	}
+
+	me->m_Memory.m_Pointer = ACR_NULL;
+	me->m_Memory.m_Length = ACR_ZERO_LENGTH;
+	me->m_Memory.m_Flags = ACR_BUFFER_FLAGS_NONE;
+	me->m_Keys.m_Pointer = ACR_NULL;
+	me->m_Keys.m_Length = ACR_ZERO_LENGTH;
+	me->m_Keys.m_Flags = ACR_BUFFER_FLAGS_NONE;
+	me->m_KeysUsed = 0;
+	me->m_KeysRemoved = 0;
+	me->m_KeyType = (keyType == ACR_HASHMAP_KEYS_STRING) ? ACR_HASHMAP_KEYS_STRING : ACR_HASHMAP_KEYS_INTEGER;
+	me->m_ValueLength = valueLength;
+	me->m_SlotLength = ACR_HASHMAP_ROUND((me->m_KeyType == ACR_HASHMAP_KEYS_STRING) ? sizeof(ACR_HashMapStringKey_t) : sizeof(ACR_Length_t)) +
+	                   ACR_HASHMAP_ROUND(valueLength);
+	me->m_Count = 0;
+	me->m_Capacity = 0;
+}
+
+/**********************************************************/
+void ACR_HashMapDeInit(
+	ACR_HashMap_t* me)
+{
+	if(me == ACR_NULL)
+	{
+		return;
+	}
+
+	ACR_BUFFER_FREE(me->m_Memory);
+	ACR_BUFFER_FREE(me->m_Keys);
+	ACR_HashMapInit(me, me->m_KeyType, me->m_ValueLength);
+}
+
+/**********************************************************/
+void ACR_HashMapClear(
+	ACR_HashMap_t* me)
+{
+	if((me == ACR_NULL) || (me->m_Capacity == 0))
+	{
+		return;
+	}
+
+	memset(me->m_Memory.m_Pointer, ACR_HASHMAP_EMPTY, (size_t)me->m_Capacity);
+	memset(ACR_HASHMAP_OVERFLOW(me), 0, (size_t)(me->m_Capacity / ACR_HASHMAP_GROUP_SIZE) * sizeof(ACR_Count_t));
+	me->m_Count = 0;
+	me->m_KeysUsed = 0;
+	me->m_KeysRemoved = 0;
+}
+
+/**********************************************************/
+ACR_Info_t ACR_HashMapReserve(
+	ACR_HashMap_t* me,
+	ACR_Count_t count)
+{
+	ACR_Count_t capacity = ACR_HASHMAP_GROUP_SIZE;
+
+	if(me == ACR_NULL)
+	{
+		return ACR_INFO_ERROR;
+	}
+	if((me->m_Capacity > 0) && (count <= ACR_HASHMAP_MAX_COUNT(me->m_Capacity)))
+	{
+		return ACR_INFO_OK;
+	}
+
+	while(ACR_HASHMAP_MAX_COUNT(capacity) < count)
+	{
+		if(capacity > (ACR_MAX_COUNT / 4))
+		{
+			return ACR_INFO_ERROR;
+		}
+		capacity *= 2;
+	}
+	return ACR_HashMapRehash(me, capacity);
+}
+
+/**********************************************************/
+ACR_Info_t ACR_HashMapAddInteger(
+	ACR_HashMap_t* me,
+	ACR_Length_t key,
+	void** value)
+{
+	ACR_Length_t hash;
+	ACR_Count_t index;
+	ACR_Byte_t* slot;
+
+	if((me == ACR_NULL) || (me->m_KeyType != ACR_HASHMAP_KEYS_INTEGER))
+	{
+		return ACR_INFO_ERROR;
+	}
+
+	hash = ACR_HashMapHashInteger(key);
+	index = ACR_HashMapFindIndex(me, hash, key, ACR_NULL);
+	if(index != me->m_Capacity)
+	{
+		if(value != ACR_NULL)
+		{
+			(*value) = ACR_HASHMAP_SLOT(me, index) + ACR_HASHMAP_ROUND(sizeof(ACR_Length_t));
+		}
+		return ACR_INFO_OLD;
+	}
+
+	if(ACR_HashMapGrow(me) != ACR_INFO_OK)
+	{
+		return ACR_INFO_ERROR;
+	}
+	index = ACR_HashMapPlace(me, hash);
+	me->m_Count++;
+	slot = ACR_HASHMAP_SLOT(me, index);
+	(*((ACR_Length_t*)slot)) = key;
+	slot += ACR_HASHMAP_ROUND(sizeof(ACR_Length_t));
+	memset(slot, 0, (size_t)me->m_ValueLength);
+	if(value != ACR_NULL)
+	{
+		(*value) = slot;
+	}
+	return ACR_INFO_NEW;
+}
+
+/**********************************************************/
+ACR_Info_t ACR_HashMapFindInteger(
+	const ACR_HashMap_t* me,
+	ACR_Length_t key,
+	void** value)
+{
+	ACR_Count_t index;
+
+	if((me == ACR_NULL) || (me->m_KeyType != ACR_HASHMAP_KEYS_INTEGER))
+	{
+		return ACR_INFO_UNKNOWN;
+	}
+
+	index = ACR_HashMapFindIndex(me, ACR_HashMapHashInteger(key), key, ACR_NULL);
+	if(index == me->m_Capacity)
+	{
+		return ACR_INFO_UNKNOWN;
+	}
+	if(value != ACR_NULL)
+	{
+		(*value) = ACR_HASHMAP_SLOT(me, index) + ACR_HASHMAP_ROUND(sizeof(ACR_Length_t));
+	}
+	return ACR_INFO_OK;
+}
+
+/**********************************************************/
+ACR_Info_t ACR_HashMapRemoveInteger(
+	ACR_HashMap_t* me,
+	ACR_Length_t key)
+{
+	ACR_Length_t hash;
+	ACR_Count_t index;
+
+	if((me == ACR_NULL) || (me->m_KeyType != ACR_HASHMAP_KEYS_INTEGER))
+	{
+		return ACR_INFO_UNKNOWN;
+	}
+
+	hash = ACR_HashMapHashInteger(key);
+	index = ACR_HashMapFindIndex(me, hash, key, ACR_NULL);
+	if(index == me->m_Capacity)
+	{
+		return ACR_INFO_UNKNOWN;
+	}
+	ACR_HashMapEmpty(me, index, hash);
+	return ACR_INFO_OK;
+}
+
+/**********************************************************/
+ACR_Info_t ACR_HashMapAddString(
+	ACR_HashMap_t* me,
+	ACR_String_t key,
+	void** value)
+{
+	ACR_HashMapStringKey_t* slotKey;
+	ACR_Length_t hash;
+	ACR_Count_t index;
+	ACR_Byte_t* slot;
+
+	if((me == ACR_NULL) || (me->m_KeyType != ACR_HASHMAP_KEYS_STRING) ||
+	   ((key.m_Buffer.m_Pointer == ACR_NULL) && (key.m_Buffer.m_Length != 0)))
+	{
+		return ACR_INFO_ERROR;
+	}
+
+	hash = ACR_HashMapHashString(key);
+	index = ACR_HashMapFindIndex(me, hash, 0, &key);
+	if(index != me->m_Capacity)
+	{
+		if(value != ACR_NULL)
+		{
+			(*value) = ACR_HASHMAP_SLOT(me, index) + ACR_HASHMAP_ROUND(sizeof(ACR_HashMapStringKey_t));
+		}
+		return ACR_INFO_OLD;
+	}
+
+	if((ACR_HashMapGrow(me) != ACR_INFO_OK) || (ACR_HashMapCopyKey(me, key) != ACR_INFO_OK))
+	{
+		return ACR_INFO_ERROR;
+	}
+	index = ACR_HashMapPlace(me, hash);
+	me->m_Count++;
+	slot = ACR_HASHMAP_SLOT(me, index);
+	slotKey = (ACR_HashMapStringKey_t*)slot;
+	slotKey->m_Offset = me->m_KeysUsed - key.m_Buffer.m_Length;
+	slotKey->m_Length = key.m_Buffer.m_Length;
+	slotKey->m_Hash = hash;
+	slotKey->m_Count = key.m_Count;
+	slot += ACR_HASHMAP_ROUND(sizeof(ACR_HashMapStringKey_t));
+	memset(slot, 0, (size_t)me->m_ValueLength);
+	if(value != ACR_NULL)
+	{
+		(*value) = slot;
+	}
+	return ACR_INFO_NEW;
+}
+
+/**********************************************************/
+ACR_Info_t ACR_HashMapFindString(
+	const ACR_HashMap_t* me,
+	ACR_String_t key,
+	void** value)
+{
+	ACR_Count_t index;
+
+	if((me == ACR_NULL) || (me->m_KeyType != ACR_HASHMAP_KEYS_STRING))
+	{
+		return ACR_INFO_UNKNOWN;
+	}
+
+	index = ACR_HashMapFindIndex(me, ACR_HashMapHashString(key), 0, &key);
+	if(index == me->m_Capacity)
+	{
+		return ACR_INFO_UNKNOWN;
+	}
+	if(value != ACR_NULL)
+	{
+		(*value) = ACR_HASHMAP_SLOT(me, index) + ACR_HASHMAP_ROUND(sizeof(ACR_HashMapStringKey_t));
+	}
+	return ACR_INFO_OK;
+}
+
+/**********************************************************/
+ACR_Info_t ACR_HashMapRemoveString(
+	ACR_HashMap_t* me,
+	ACR_String_t key)
+{
+	ACR_Length_t hash;
+	ACR_Count_t index;
+
+	if((me == ACR_NULL) || (me->m_KeyType != ACR_HASHMAP_KEYS_STRING))
+	{
+		return ACR_INFO_UNKNOWN;
+	}
+
+	hash = ACR_HashMapHashString(key);
+	index = ACR_HashMapFindIndex(me, hash, 0, &key);
+	if(index == me->m_Capacity)
+	{
+		return ACR_INFO_UNKNOWN;
+	}
+	me->m_KeysRemoved += key.m_Buffer.m_Length;
+	ACR_HashMapEmpty(me, index, hash);
+	if(me->m_Count == 0)
+	{
+		// all of the key bytes can be used again
+		me->m_KeysUsed = 0;
+		me->m_KeysRemoved = 0;
+	}
+	return ACR_INFO_OK;
+}
+
+/**********************************************************/
+ACR_Info_t ACR_HashMapNextInteger(
+	const ACR_HashMap_t* me,
+	ACR_Count_t* position,
+	ACR_Length_t* key,
+	void** value)
+{
+	const ACR_Byte_t* control;
+	ACR_Count_t i;
+
+	if((me == ACR_NULL) || (position == ACR_NULL) || (key == ACR_NULL) || (me->m_KeyType != ACR_HASHMAP_KEYS_INTEGER))
+	{
+		return ACR_INFO_END;
+	}
+
+	control = (const ACR_Byte_t*)me->m_Memory.m_Pointer;
+	for(i = (*position); i < me->m_Capacity; i++)
+	{
+		if(control[i] != ACR_HASHMAP_EMPTY)
+		{
+			(*key) = *((const ACR_Length_t*)ACR_HASHMAP_SLOT(me, i));
+			if(value != ACR_NULL)
+			{
+				(*value) = ACR_HASHMAP_SLOT(me, i) + ACR_HASHMAP_ROUND(sizeof(ACR_Length_t));
+			}
+			(*position) = i + 1;
+			return ACR_INFO_OK;
+		}
+	}
+	(*position) = me->m_Capacity;
+	return ACR_INFO_END;
+}
+
+/**********************************************************/
+ACR_Info_t ACR_HashMapNextString(
+	const ACR_HashMap_t* me,
+	ACR_Count_t* position,
+	ACR_String_t* key,
+	void** value)
+{
+	const ACR_HashMapStringKey_t* slotKey;
+	const ACR_Byte_t* control;
+	ACR_Count_t i;
+
+	if((me == ACR_NULL) || (position == ACR_NULL) || (key == ACR_NULL) || (me->m_KeyType != ACR_HASHMAP_KEYS_STRING))
+	{
+		return ACR_INFO_END;
+	}
+
+	control = (const ACR_Byte_t*)me->m_Memory.m_Pointer;
+	for(i = (*position); i < me->m_Capacity; i++)
+	{
+		if(control[i] != ACR_HASHMAP_EMPTY)
+		{
+			slotKey = (const ACR_HashMapStringKey_t*)ACR_HASHMAP_SLOT(me, i);
+			key->m_Buffer.m_Pointer = ((ACR_Byte_t*)me->m_Keys.m_Pointer) + slotKey->m_Offset;
+			key->m_Buffer.m_Length = slotKey->m_Length;
+			key->m_Buffer.m_Flags = ACR_BUFFER_IS_REF;
+			key->m_Count = slotKey->m_Count;
+			if(value != ACR_NULL)
+			{
+				(*value) = ACR_HASHMAP_SLOT(me, i) + ACR_HASHMAP_ROUND(sizeof(ACR_HashMapStringKey_t));
+			}
+			(*position) = i + 1;
+			return ACR_INFO_OK;
+		}
+	}
+	(*position) = me->m_Capacity;
+	return ACR_INFO_END;
+}
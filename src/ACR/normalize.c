@@ -0,0 +1,3111 @@
+/*
+
+    ********** DO NOT REMOVE THIS INFORMATION ************
+
+    ACR - A set of C functions in a git Repository
+    Copyright (C) 2018 - 2020 Adam C. Rosenberg
+
+    Please read LICENSE before using this code
+
+    Please read README.md for instructions on including
+    this code in your project and where to find examples
+
+    If you contribute to this code, Please add your name
+    and email address to the AUTHORS list below so that
+    we know who to thank!
+
+    AUTHORS
+
+    Adam Rosenberg <adam@sirspot.com>
+
+    LICENSE
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+    ******************************************************
+
+*/
+/** \file normalize.c
+
+    unicode normalization using compact two stage lookup
+    tables
+
+    The tables hold the canonical combining classes, the
+    full canonical decompositions, the canonical compositions
+    that are not excluded, and the NFC and NFD quick check
+    values for Unicode 14.0.0. Hangul syllables are
+    decomposed and composed by calculation instead.
+
+    The tables are generated from the Unicode 14.0.0 data
+    in the unicodedata module of Python 3.11 by running
+    this from the root of the repository:
+
+        python3 tools/normalize.py
+
+*/
+#include "ACR/normalize.h"
+#include "ACR/utf8.h"
+
+////////////////////////////////////////////////////////////
+//
+// PRIVATE DEFINES
+//
+////////////////////////////////////////////////////////////
+
+/** characters at or above this value have no combining
+    class, decomposition, or composition
+*/
+#define ACR_NORMALIZE_LIMIT 0x30000
+
+/** the number of characters in each block of the second
+    stage tables
+*/
+#define ACR_NORMALIZE_BLOCK_BITS 6
+#define ACR_NORMALIZE_BLOCK_MASK ((1 << ACR_NORMALIZE_BLOCK_BITS) - 1)
+
+/** quick check flags
+*/
+#define ACR_NORMALIZE_NFC_NO    0x01
+#define ACR_NORMALIZE_NFC_MAYBE 0x02
+#define ACR_NORMALIZE_NFD_NO    0x04
+
+/** the first byte of the first UTF8 character that can be
+    anything other than a normalized starter. NFC starts at
+	U+0300 (CC 80) and NFD starts at U+00C0 (C3 80)
+*/
+#define ACR_NORMALIZE_NFC_FIRST_BYTE 0xCC
+#define ACR_NORMALIZE_NFD_FIRST_BYTE 0xC3
+
+/** hangul syllable values from the unicode standard
+*/
+#define ACR_HANGUL_S_BASE  0xAC00
+#define ACR_HANGUL_L_BASE  0x1100
+#define ACR_HANGUL_V_BASE  0x1161
+#define ACR_HANGUL_T_BASE  0x11A7
+#define ACR_HANGUL_L_COUNT 19
+#define ACR_HANGUL_V_COUNT 21
+#define ACR_HANGUL_T_COUNT 28
+#define ACR_HANGUL_N_COUNT (ACR_HANGUL_V_COUNT * ACR_HANGUL_T_COUNT)
+#define ACR_HANGUL_S_COUNT (ACR_HANGUL_L_COUNT * ACR_HANGUL_N_COUNT)
+
+////////////////////////////////////////////////////////////
+//
+// PRIVATE TABLES
+//
+////////////////////////////////////////////////////////////
+
+/** first stage: the block of g_ACRNormalizeBlocks for
+    each 64 characters
+*/
+static const ACR_Byte_t g_ACRNormalizePages[3072] =
+{
+	  0,   0,   0,   1,   2,   3,   4,   5,   6,   0,   0,   0,   7,   8,   9,  10,
+	 11,  12,  13,  14,   0,   0,  15,  16,  17,  18,   0,  19,  20,  21,   0,  22,
+	 23,  24,  25,  26,  27,  28,  29,  30,  31,  32,  33,  34,  35,  36,  37,  38,
+	 33,  39,  33,  40,  41,  42,   0,  43,  44,  45,  46,  47,  48,  49,  50,  51,
+	 52,   0,  53,   0,   0,  54,  55,  56,   0,   0,   0,   0,   0,  57,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  58,   0,   0,  59,
+	  0,   0,  60,   0,  61,   0,   0,   0,  62,  63,  64,  65,  66,  67,  68,  69,
+	 70,   0,   0,  71,   0,   0,   0,  72,  73,  73,  74,  75,  76,  77,  78,  79,
+	 80,   0,   0,  81,  82,   0,  83,  84,  85,  86,  87,  88,  89,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  90,   0,   0,   0,   0,
+	  0,   0,   0,  91,   0,  92,   0,  93,   0,   0,   0,   0,   0,   0,   0,   0,
+	 94,  95,  96,  97,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,  98,  99, 100,   0,   0,   0,   0,
+	101,   0,   0, 102, 103, 104, 105, 106,   0,   0, 107, 108,   0,   0,   0, 109,
+	 73,  73,  73,  73,  73,  73,  73,  73,  73,  73,  73,  73,  73,  73,  73,  73,
+	 73,  73,  73,  73,  73,  73,  73,  73,  73,  73,  73,  73,  73,  73,  73,  73,
+	 73,  73,  73,  73,  73,  73,  73,  73,  73,  73,  73,  73,  73,  73,  73,  73,
+	 73,  73,  73,  73,  73,  73,  73,  73,  73,  73,  73,  73,  73,  73,  73,  73,
+	 73,  73,  73,  73,  73,  73,  73,  73,  73,  73,  73,  73,  73,  73,  73,  73,
+	 73,  73,  73,  73,  73,  73,  73,  73,  73,  73,  73,  73,  73,  73,  73,  73,
+	 73,  73,  73,  73,  73,  73,  73,  73,  73,  73,  73,  73,  73,  73,  73,  73,
+	 73,  73,  73,  73,  73,  73,  73,  73,  73,  73,  73,  73,  73,  73,  73,  73,
+	 73,  73,  73,  73,  73,  73,  73,  73,  73,  73,  73,  73,  73,  73,  73,  73,
+	 73,  73,  73,  73,  73,  73,  73,  73,  73,  73,  73,  73,  73,  73,  73,  73,
+	 73,  73,  73,  73,  73,  73,  73,  73,  73,  73,  73,  73,  73,  73, 110,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0, 111, 111, 111, 111, 112, 113, 111, 114, 115, 116,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0, 117,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0, 118,   0,   0,   0, 119,   0, 120,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0, 121,   0,   0, 122,   0,   0,   0,   0,
+	  0,   0,   0,   0, 123,   0,   0,   0,   0,   0, 124,   0,   0, 125, 126,   0,
+	  0, 127, 128,   0, 129, 105,   0, 130, 131,   0,   0, 132, 133, 134,   0,   0,
+	  0, 135, 136, 137,   0,   0, 138, 139,  92,   0, 140,   0, 141,   0,   0,   0,
+	142,   0,   0,   0, 143, 144,   0, 145, 146, 147, 148,   0,   0,   0,   0,   0,
+	 92,   0,   0,   0,   0, 149, 150,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 151, 152,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 153,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0, 154,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0, 155, 156, 157,   0, 158,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	159,   0,   0,   0, 152,   0,   0,   0,   0,   0, 160, 161,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0, 162,   0, 163,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	111, 111, 111, 111, 111, 111, 111, 111, 164,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0
+};
+
+/** second stage: the index into the property tables for
+    each character, with blocks that are the same stored once
+*/
+static const ACR_Byte_t g_ACRNormalizeBlocks[10560] =
+{
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  1,   1,   1,   1,   1,   1,   0,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+	  0,   1,   1,   1,   1,   1,   1,   0,   0,   1,   1,   1,   1,   1,   0,   0,
+	  1,   1,   1,   1,   1,   1,   0,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+	  0,   1,   1,   1,   1,   1,   1,   0,   0,   1,   1,   1,   1,   1,   0,   1,
+	  1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+	  0,   0,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+	  1,   1,   1,   1,   1,   1,   0,   0,   1,   1,   1,   1,   1,   1,   1,   1,
+	  1,   0,   0,   0,   1,   1,   1,   1,   0,   1,   1,   1,   1,   1,   1,   0,
+	  0,   0,   0,   1,   1,   1,   1,   1,   1,   0,   0,   0,   1,   1,   1,   1,
+	  1,   1,   0,   0,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+	  1,   1,   1,   1,   1,   1,   0,   0,   1,   1,   1,   1,   1,   1,   1,   1,
+	  1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  1,   1,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,
+	  1,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   1,   1,
+	  1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   0,   1,   1,
+	  1,   1,   1,   1,   0,   0,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+	  1,   0,   0,   0,   1,   1,   0,   0,   1,   1,   1,   1,   1,   1,   1,   1,
+	  1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+	  1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   0,   0,   1,   1,
+	  0,   0,   0,   0,   0,   0,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+	  1,   1,   1,   1,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,   7,   7,  15,
+	  7,  16,   7,  17,  18,  19,  20,  20,  20,  20,  19,  21,  20,  20,  20,  20,
+	 20,  22,  22,  23,  24,  25,  26,  27,  28,  20,  20,  20,  20,  29,  30,  20,
+	 31,  32,  20,  20,  33,  33,  33,  33,  34,  20,  20,  20,  20,   7,   7,   7,
+	 35,  35,  36,  35,  35,  37,   7,  20,  20,  20,   7,   7,   7,  20,  20,   0,
+	  7,   7,   7,  20,  20,  20,  20,   7,  19,  20,  20,   7,  38,  39,  39,  38,
+	 39,  39,  38,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,
+	  0,   0,   0,   0,  40,   0,   0,   0,   0,   0,   0,   0,   0,   0,  40,   0,
+	  0,   0,   0,   0,   0,   1,   1,  40,   1,   1,   1,   0,   1,   0,   1,   1,
+	  1,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   1,   1,   1,   1,   1,
+	  1,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   1,   1,   1,   1,   0,
+	  0,   0,   0,   1,   1,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  1,   1,   0,   1,   0,   0,   0,   1,   0,   0,   0,   0,   1,   1,   1,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  1,   1,   0,   1,   0,   0,   0,   1,   0,   0,   0,   0,   1,   1,   1,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   1,   1,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   7,   7,   7,   7,   7,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   1,   1,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  1,   1,   1,   1,   0,   0,   1,   1,   0,   0,   1,   1,   1,   1,   1,   1,
+	  0,   0,   1,   1,   1,   1,   1,   1,   0,   0,   1,   1,   1,   1,   1,   1,
+	  1,   1,   1,   1,   1,   1,   0,   0,   1,   1,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,  20,   7,   7,   7,   7,  20,   7,   7,   7,  41,  20,   7,   7,   7,   7,
+	  7,   7,  20,  20,  20,  20,  20,  20,   7,   7,  20,   7,   7,  41,  42,   7,
+	 43,  44,  45,  46,  47,  48,  49,  50,  51,  52,  52,  53,  54,  55,   0,  56,
+	  0,  57,  58,   0,   7,  20,   0,  51,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  7,   7,   7,   7,   7,   7,   7,   7,  59,  60,  61,   0,   0,   0,   0,   0,
+	  0,   0,   1,   1,   1,   1,   1,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  62,  63,  64,  59,  60,
+	 61,  65,  66,  67,  68,  69,  20,   7,   7,   7,   7,   7,  20,   7,   7,  20,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	 70,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  1,   0,   1,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   1,   0,   0,   7,   7,   7,   7,   7,   7,   7,   0,   0,   7,
+	  7,   7,   7,  20,   7,   0,   0,   7,   7,   0,  20,   7,   7,  20,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,  71,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  7,  20,   7,   7,  20,   7,   7,  20,  20,  20,   7,  20,  20,   7,  20,   7,
+	  7,   7,  20,   7,  20,   7,  20,   7,  20,   7,   7,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   7,   7,   7,   7,   7,
+	  7,   7,  20,   7,   0,   0,   0,   0,   0,   0,   0,   0,   0,  20,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   7,   7,   7,   7,   0,   7,   7,   7,   7,   7,
+	  7,   7,   7,   7,   0,   7,   7,   7,   0,   7,   7,   7,   7,   7,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,  20,  20,  20,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   7,  20,  20,  20,   7,   7,   7,   7,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   7,   7,   7,   7,   7,  20,
+	 20,  20,  20,  20,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,
+	  7,   7,   0,  20,   7,   7,  20,   7,   7,  20,   7,   7,   7,  20,  20,  20,
+	 62,  63,  64,   7,   7,   7,  20,   7,   7,  20,  20,   7,   7,   7,   7,   7,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,   0,   0,   0,   0,   0,
+	  0,   1,   0,   0,   1,   0,   0,   0,   0,   0,   0,   0,  72,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  73,   0,   0,
+	  0,   7,  20,   7,   7,   0,   0,   0,  40,  40,  40,  40,  40,  40,  40,  40,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  74,   0,  75,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   1,  73,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,  76,   0,   0,   0,   0,  40,  40,   0,  40,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   7,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,  40,   0,   0,  40,   0,   0,   0,   0,   0,  74,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  73,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,  40,  40,  40,   0,   0,  40,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  74,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  73,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  74,   0,  77,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   1,   0,   0,   1,   1,  73,   0,   0,
+	  0,   0,   0,   0,   0,   0,  78,  79,   0,   0,   0,   0,  40,  40,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   1,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  80,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   1,   1,  73,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,  81,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   1,   0,   0,   0,   0,  73,   0,   0,
+	  0,   0,   0,   0,   0,  82,  83,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  1,   0,  84,   0,   0,   0,   0,   1,   1,   0,   1,   1,   0,  73,   0,   0,
+	  0,   0,   0,   0,   0,  85,  86,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  73,  73,   0,  87,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   1,   1,  73,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,  88,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  89,   0,   0,   0,   0,  90,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,   1,   1,   1,  91,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,  92,  92,  73,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,  93,  93,  93,  93,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,  94,  94,  73,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,  95,  95,  95,  95,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,  20,  20,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,  20,   0,  20,   0,  96,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,  40,   0,   0,   0,   0,   0,   0,   0,   0,   0,  40,   0,   0,
+	  0,   0,  40,   0,   0,   0,   0,  40,   0,   0,   0,   0,  40,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,  40,   0,   0,   0,   0,   0,   0,
+	  0,  97,  98,  40,  99,  40,  40,   0,  40,   0,  98,  98,  98,  98,   0,   0,
+	 98,  40,   7,   7,  73,   0,   7,   7,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,  40,   0,   0,   0,   0,   0,   0,   0,   0,   0,  40,   0,   0,
+	  0,   0,  40,   0,   0,   0,   0,  40,   0,   0,   0,   0,  40,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,  40,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,  20,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   1,   0,   0,   0,   0,   0,   0,   0, 100,   0,
+	  0,   0,   0,   0,   0,   0,   0,  74,   0,  73,  73,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  20,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+	101, 101, 101, 101, 101, 101,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0, 101, 101, 101, 101, 101, 101, 101, 101,
+	101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+	101, 101, 101,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   7,   7,   7,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,  73,  73,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,  73,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,  73,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   7,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,  42,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,  41,   7,  20,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   7,  20,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	 73,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   7,   7,   7,   7,   7,   7,   7,   7,   0,   0,  20,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  7,   7,   7,   7,   7,  20,  20,  20,  20,  20,  20,   7,   7,  20,   0,  20,
+	 20,   7,   7,  20,  20,   7,   7,   7,   7,   7,  20,   7,   7,   7,   7,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   1,   0,   1,   0,   1,   0,   1,   0,   1,   0,
+	  0,   0,   1,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,  74, 102,   0,   0,   0,   0,   0,   1,   0,   1,   0,   0,
+	  1,   1,   0,   1,  73,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   7,  20,   7,   7,   7,
+	  7,   7,   7,   7,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  73,  73,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,  74,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,  73,  73,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,  74,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  7,   7,   7,   0,  33,  20,  20,  20,  20,  20,   7,   7,  20,  20,  20,  20,
+	  7,   0,  33,  33,  33,  33,  33,  33,  33,   0,   0,   0,   0,  20,   0,   0,
+	  0,   0,   0,   0,   7,   0,   0,   0,   7,   7,   0,   0,   0,   0,   0,   0,
+	  7,   7,  20,   7,   7,   7,   7,   7,   7,   7,  20,   7,   7,  39, 103,  20,
+	 22,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,
+	  7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,
+	  7,   7,   7,   7,   7,   7,  19,  42,  42,  20, 104,   7,  38,  20,   7,  20,
+	  1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+	  1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+	  1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+	  1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+	  1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+	  1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   0,   1,   0,   0,   0,   0,
+	  1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+	  1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+	  1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+	  1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+	  1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+	  1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   0,   0,   0,   0,   0,   0,
+	  1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+	  1,   1,   1,   1,   1,   1,   0,   0,   1,   1,   1,   1,   1,   1,   0,   0,
+	  1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+	  1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+	  1,   1,   1,   1,   1,   1,   0,   0,   1,   1,   1,   1,   1,   1,   0,   0,
+	  1,   1,   1,   1,   1,   1,   1,   1,   0,   1,   0,   1,   0,   1,   0,   1,
+	  1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+	  1,  40,   1,  40,   1,  40,   1,  40,   1,  40,   1,  40,   1,  40,   0,   0,
+	  1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+	  1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+	  1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+	  1,   1,   1,   1,   1,   0,   1,   1,   1,   1,   1,  40,   1,   0,  40,   0,
+	  0,   1,   1,   1,   1,   0,   1,   1,   1,  40,   1,  40,   1,   1,   1,   1,
+	  1,   1,   1,  40,   0,   0,   1,   1,   1,   1,   1,  40,   0,   1,   1,   1,
+	  1,   1,   1,  40,   1,   1,   1,   1,   1,   1,   1,  40,   1,   1,  40,  40,
+	  0,   0,   1,   1,   1,   0,   1,   1,   1,  40,   1,  40,   1,  40,   0,   0,
+	 40,  40,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  7,   7,  33,  33,   7,   7,   7,   7,  33,  33,  33,   7,   7,   0,   0,   0,
+	  0,   7,   0,   0,   0,  33,  33,   7,  20,   7,  33,  33,  20,  20,  20,  20,
+	  7,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,  40,   0,   0,   0,  40,  40,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   1,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   1,   1,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   1,   0,   0,   0,   0,   1,   0,   0,   1,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   1,   0,   1,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   1,   0,   0,   1,   0,   0,   1,   0,   1,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  1,   0,   1,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   1,   1,
+	  1,   1,   0,   0,   1,   1,   0,   0,   1,   1,   0,   0,   0,   0,   0,   0,
+	  1,   1,   0,   0,   1,   1,   0,   0,   1,   1,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   1,   1,   1,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  1,   1,   1,   1,   0,   0,   0,   0,   0,   0,   1,   1,   1,   1,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,  40,  40,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  40,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   7,
+	  7,   7,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  73,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,
+	  7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 104,  42,  19,  41, 105, 105,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,   1,   0,
+	  1,   0,   1,   0,   1,   0,   1,   0,   1,   0,   1,   0,   1,   0,   1,   0,
+	  1,   0,   1,   0,   0,   1,   0,   1,   0,   1,   0,   0,   0,   0,   0,   0,
+	  1,   1,   0,   1,   1,   0,   1,   1,   0,   1,   1,   0,   1,   1,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   1,   0,   0,   0,   0, 106, 107,   0,   0,   0,   1,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,   1,   0,
+	  1,   0,   1,   0,   1,   0,   1,   0,   1,   0,   1,   0,   1,   0,   1,   0,
+	  1,   0,   1,   0,   0,   1,   0,   1,   0,   1,   0,   0,   0,   0,   0,   0,
+	  1,   1,   0,   1,   1,   0,   1,   1,   0,   1,   1,   0,   1,   1,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   1,   0,   0,   1,   1,   1,   1,   0,   0,   0,   1,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   7,
+	  0,   0,   0,   0,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   7,   7,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  7,   7,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,  73,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  73,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,  73,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,
+	  7,   7,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  20,  20,  20,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,  73,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,  74,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	 73,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  7,   0,   7,   7,  20,   0,   0,   7,   7,   0,   0,   0,   0,   0,   7,   7,
+	  0,   7,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,  73,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  73,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+	  1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+	  1,   1,   1,   1,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	 40,  40,  40,  40,  40,  40,  40,  40,  40,  40,  40,  40,  40,  40,  40,  40,
+	 40,  40,  40,  40,  40,  40,  40,  40,  40,  40,  40,  40,  40,  40,  40,  40,
+	 40,  40,  40,  40,  40,  40,  40,  40,  40,  40,  40,  40,  40,  40,  40,  40,
+	 40,  40,  40,  40,  40,  40,  40,  40,  40,  40,  40,  40,  40,  40,  40,  40,
+	 40,  40,  40,  40,  40,  40,  40,  40,  40,  40,  40,  40,  40,  40,   0,   0,
+	 40,   0,  40,   0,   0,  40,  40,  40,  40,  40,  40,  40,  40,  40,  40,   0,
+	 40,   0,  40,   0,   0,  40,  40,   0,   0,   0,  40,  40,  40,  40,  40,  40,
+	 40,  40,  40,  40,  40,  40,  40,  40,  40,  40,  40,  40,  40,  40,  40,  40,
+	 40,  40,  40,  40,  40,  40,  40,  40,  40,  40,  40,  40,  40,  40,  40,  40,
+	 40,  40,  40,  40,  40,  40,  40,  40,  40,  40,  40,  40,  40,  40,  40,  40,
+	 40,  40,  40,  40,  40,  40,  40,  40,  40,  40,  40,  40,  40,  40,   0,   0,
+	 40,  40,  40,  40,  40,  40,  40,  40,  40,  40,  40,  40,  40,  40,  40,  40,
+	 40,  40,  40,  40,  40,  40,  40,  40,  40,  40,  40,  40,  40,  40,  40,  40,
+	 40,  40,  40,  40,  40,  40,  40,  40,  40,  40,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  40, 108,  40,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  40,  40,  40,  40,  40,  40,
+	 40,  40,  40,  40,  40,  40,  40,   0,  40,  40,  40,  40,  40,   0,  40,   0,
+	 40,  40,   0,  40,  40,   0,  40,  40,  40,  40,  40,  40,  40,  40,  40,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  7,   7,   7,   7,   7,   7,   7,  20,  20,  20,  20,  20,  20,  20,   7,   7,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  20,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	 20,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   7,   7,   7,   7,   7,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  20,   0,   7,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   7,  33,  20,   0,   0,   0,   0,  73,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   7,  20,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   7,   7,   7,   7,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   7,   7,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,  20,  20,   7,   7,   7,  20,   7,  20,  20,  20,
+	 20,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   7,  20,   7,  20,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,  73,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	 73,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  73,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,   1,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,  73, 109,   0,   0,   0,   0,   0,
+	  7,   7,   7,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0, 110,   0,   0,   0,   0,   0,   0,   1,   1,
+	  0,   0,   0,  73,  73,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	 73,   0,   0,   0,   0,   0,   0,   0,   0,   0,  74,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,  73,  74,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,  74,  73,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  74,  74,   0, 111,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   1,  73,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0, 112,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   7,   7,   7,   7,   7,   7,   7,   0,   0,   0,
+	  7,   7,   7,   7,   7,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,  73,   0,   0,   0,  74,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   7,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	113,   0,   0,   0,   0,   0,   0,   0,   0,   0, 114,   1,   1, 115,   1,   0,
+	  0,   0,  73,  74,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 116,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   1,   0,   0,   0,  73,
+	 74,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,  73,  74,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  73,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,  73,  74,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	117,   0,   0,   0,   0,   0,   0,   0,   1,   0,   0,   0,   0,  73,  73,   0,
+	  0,   0,   0,  74,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	 73,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,  73,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,  73,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,  73,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,  74,   0,  73,  73,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,  73,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	 33,  33,  33,  33,  33,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  7,   7,   7,   7,   7,   7,   7,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	118, 118,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  33,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  40,  40,
+	 40,  40,  40,  40,  40,  96,  96,  33,  33,  33,   0,   0,   0, 119,  96,  96,
+	 96,  96,  96,   0,   0,   0,   0,   0,   0,   0,   0,  20,  20,  20,  20,  20,
+	 20,  20,  20,   0,   0,   7,   7,   7,   7,   7,  20,  20,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   7,   7,   7,   7,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  40,  40,  40,  40,  40,
+	 40,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   7,   7,   7,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  7,   7,   7,   7,   7,   7,   7,   0,   7,   7,   7,   7,   7,   7,   7,   7,
+	  7,   7,   7,   7,   7,   7,   7,   7,   7,   0,   0,   7,   7,   7,   7,   7,
+	  7,   7,   0,   7,   7,   0,   7,   7,   7,   7,   7,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   7,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   7,   7,   7,   7,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	 20,  20,  20,  20,  20,  20,  20,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   7,   7,   7,   7,   7,   7,  74,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	 40,  40,  40,  40,  40,  40,  40,  40,  40,  40,  40,  40,  40,  40,  40,  40,
+	 40,  40,  40,  40,  40,  40,  40,  40,  40,  40,  40,  40,  40,  40,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0
+};
+
+/** the canonical combining class of each property index
+*/
+static const ACR_Byte_t g_ACRNormalizeCombiningClass[120] =
+{
+	  0,   0, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230,
+	230, 230, 230, 232, 220, 216, 202, 220, 220, 220, 220, 202, 202, 220, 220, 220,
+	220,   1,   1, 230, 230, 240, 233, 234,   0, 222, 228,  10,  11,  12,  13,  14,
+	 15,  16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  30,  31,  32,  27,  28,
+	 29,  33,  34, 230, 230, 220,  35,  36,   7,   9,   7,   0,   0,   0,   0,   0,
+	  0,   0,  84,  91,   0,   0,   0,   0,   0,   9,   0,   0, 103, 107, 118, 122,
+	216, 129, 130, 132,   0,   0,   0, 214, 218, 224,   8,   8,  26,   7,   0,   0,
+	  0,   0,   0,   0,   0,   0,   6, 226
+};
+
+/** the quick check flags of each property index
+*/
+static const ACR_Byte_t g_ACRNormalizeFlags[120] =
+{
+	  0,   4,   2,   2,   2,   2,   2,   0,   2,   2,   2,   2,   2,   2,   2,   2,
+	  2,   2,   2,   0,   0,   2,   0,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+	  2,   0,   2,   5,   2,   2,   0,   0,   5,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   2,   2,   2,   0,   0,   2,   0,   0,   2,   2,   2,   2,   2,
+	  2,   2,   0,   2,   2,   2,   2,   2,   2,   2,   2,   2,   0,   0,   0,   0,
+	  0,   0,   0,   0,   2,   2,   2,   0,   0,   0,   2,   2,   0,   2,   2,   2,
+	  2,   2,   2,   2,   2,   2,   0,   0
+};
+
+/** 1 plus the index of each character that can be the
+    second character of a composition or 0
+*/
+static const ACR_Byte_t g_ACRNormalizeSecond[120] =
+{
+	  0,   0,   1,   2,   3,   4,   5,   0,   6,   7,   8,   9,  10,  11,  12,  13,
+	 14,  15,  16,   0,   0,  17,   0,  18,  19,  20,  21,  22,  23,  24,  25,  26,
+	 27,   0,  28,   0,  29,  30,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,  31,  32,  33,   0,   0,  34,   0,   0,  35,  36,  37,  38,  39,
+	 40,  41,   0,  42,  43,  44,  45,  46,  47,  48,  49,  50,   0,   0,   0,   0,
+	  0,   0,   0,   0,  51,   0,  52,   0,   0,   0,  53,  54,   0,  55,  56,  57,
+	 58,  59,  60,  61,  62,  63,   0,   0
+};
+
+/** first stage: the block of g_ACRNormalizeDecompositionBlocks
+    for each 64 characters
+*/
+static const ACR_Byte_t g_ACRNormalizeDecompositionPages[3072] =
+{
+	  0,   0,   0,   1,   2,   3,   4,   5,   6,   0,   0,   0,   0,   7,   8,   9,
+	 10,  11,   0,  12,   0,   0,   0,   0,  13,   0,   0,  14,   0,   0,   0,   0,
+	  0,   0,   0,   0,  15,  16,   0,  17,  18,  19,   0,   0,   0,  20,  21,  22,
+	  0,  23,   0,  24,   0,  25,   0,  26,   0,   0,   0,   0,   0,  27,  28,   0,
+	 29,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  30,  31,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,  32,  33,  34,  35,  36,  37,  38,  39,
+	 40,   0,   0,   0,  41,   0,  42,  43,  44,  45,  46,  47,  48,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  49,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,  50,  51,  52,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,  53,  54,  55,  56,  57,  58,  59,  60,  61,  62,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,  63,   0,  64,   0,   0,   0,   0,   0,   0,   0,   0,  65,   0,   0,
+	  0,   0,  66,   0,   0,   0,  67,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,  68,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,  69,  70,  71,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	 72,  73,  74,  75,  76,  77,  78,  79,  80,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0
+};
+
+/** second stage: the offset of the decomposition of each
+    character in g_ACRNormalizeDecompositionData or 0
+*/
+static const unsigned short g_ACRNormalizeDecompositionBlocks[5184] =
+{
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     1,     5,     9,    13,    17,    21,     0,    25,
+	   29,    33,    37,    41,    45,    49,    53,    57,     0,    61,    65,    69,
+	   73,    77,    81,     0,     0,    85,    89,    93,    97,   101,     0,     0,
+	  105,   109,   113,   117,   121,   125,     0,   129,   133,   137,   141,   145,
+	  149,   153,   157,   161,     0,   165,   169,   173,   177,   181,   185,     0,
+	    0,   189,   193,   197,   201,   205,     0,   209,   213,   217,   221,   225,
+	  229,   233,   237,   241,   245,   249,   253,   257,   261,   265,   269,   273,
+	    0,     0,   277,   281,   285,   289,   293,   297,   301,   305,   309,   313,
+	  317,   321,   325,   329,   333,   337,   341,   345,   349,   353,     0,     0,
+	  357,   361,   365,   369,   373,   377,   381,   385,   389,     0,     0,     0,
+	  393,   397,   401,   405,     0,   409,   413,   417,   421,   425,   429,     0,
+	    0,     0,     0,   433,   437,   441,   445,   449,   453,     0,     0,     0,
+	  457,   461,   465,   469,   473,   477,     0,     0,   481,   485,   489,   493,
+	  497,   501,   505,   509,   513,   517,   521,   525,   529,   533,   537,   541,
+	  545,   549,     0,     0,   553,   557,   561,   565,   569,   573,   577,   581,
+	  585,   589,   593,   597,   601,   605,   609,   613,   617,   621,   625,   629,
+	  633,   637,   641,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	  645,   649,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,   653,   657,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,   661,   665,   669,
+	  673,   677,   681,   685,   689,   693,   699,   705,   711,   717,   723,   729,
+	  735,     0,   741,   747,   753,   759,   765,   770,     0,     0,   775,   779,
+	  783,   787,   791,   795,   799,   805,   811,   816,   821,     0,     0,     0,
+	  825,   829,     0,     0,   833,   837,   841,   847,   853,   858,   863,   868,
+	  873,   877,   881,   885,   889,   893,   897,   901,   905,   909,   913,   917,
+	  921,   925,   929,   933,   937,   941,   945,   949,   953,   957,   961,   965,
+	  969,   973,   977,   981,     0,     0,   985,   989,     0,     0,     0,     0,
+	    0,     0,   993,   997,  1001,  1005,  1009,  1015,  1021,  1027,  1033,  1037,
+	 1041,  1047,  1053,  1057,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,  1061,  1064,     0,  1067,  1070,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,  1075,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,  1078,     0,     0,     0,     0,     0,
+	    0,  1080,  1085,  1090,  1093,  1098,  1103,     0,  1108,     0,  1113,  1118,
+	 1123,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,  1130,  1135,  1140,  1145,  1150,  1155,  1160,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,  1167,  1172,
+	 1177,  1182,  1187,     0,     0,     0,     0,  1192,  1197,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,  1202,  1207,     0,  1212,     0,     0,     0,  1217,
+	    0,     0,     0,     0,  1222,  1227,  1232,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,  1237,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,  1242,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	 1247,  1252,     0,  1257,     0,     0,     0,  1262,     0,     0,     0,     0,
+	 1267,  1272,  1277,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,  1282,  1287,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,  1292,  1297,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,  1302,  1307,  1312,  1317,     0,     0,  1322,  1327,
+	    0,     0,  1332,  1337,  1342,  1347,  1352,  1357,     0,     0,  1362,  1367,
+	 1372,  1377,  1382,  1387,     0,     0,  1392,  1397,  1402,  1407,  1412,  1417,
+	 1422,  1427,  1432,  1437,  1442,  1447,     0,     0,  1452,  1457,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,  1462,  1467,  1472,  1477,  1482,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,  1487,     0,  1492,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,  1497,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,  1502,     0,     0,     0,     0,     0,     0,
+	    0,  1509,     0,     0,  1516,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,  1523,  1530,  1537,  1544,  1551,  1558,  1565,  1572,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,  1579,  1586,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	 1593,  1600,     0,  1607,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,  1614,     0,     0,  1621,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,  1628,  1635,  1642,     0,     0,  1649,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,  1656,     0,     0,  1663,  1670,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	 1677,  1684,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,  1691,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,  1698,  1705,  1712,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,  1719,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	 1726,     0,     0,     0,     0,     0,     0,  1733,  1740,     0,  1747,  1754,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,  1764,  1771,  1778,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,  1785,     0,
+	 1792,  1799,  1809,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,  1816,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,  1823,     0,     0,     0,     0,  1830,     0,     0,     0,     0,  1837,
+	    0,     0,     0,     0,  1844,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,  1851,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,  1858,     0,  1865,  1872,     0,  1879,     0,     0,     0,
+	    0,     0,     0,     0,     0,  1886,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,  1893,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,  1900,     0,     0,
+	    0,     0,  1907,     0,     0,     0,     0,  1914,     0,     0,     0,     0,
+	 1921,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,  1928,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,  1935,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,  1942,     0,  1949,     0,  1956,     0,
+	 1963,     0,  1970,     0,     0,     0,  1977,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,  1984,
+	    0,  1991,     0,     0,  1998,  2005,     0,  2012,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,  2019,  2023,  2027,  2031,
+	 2035,  2039,  2043,  2047,  2051,  2057,  2063,  2067,  2071,  2075,  2079,  2083,
+	 2087,  2091,  2095,  2099,  2103,  2109,  2115,  2121,  2127,  2131,  2135,  2139,
+	 2143,  2149,  2155,  2159,  2163,  2167,  2171,  2175,  2179,  2183,  2187,  2191,
+	 2195,  2199,  2203,  2207,  2211,  2215,  2219,  2225,  2231,  2235,  2239,  2243,
+	 2247,  2251,  2255,  2259,  2263,  2269,  2275,  2279,  2283,  2287,  2291,  2295,
+	 2299,  2303,  2307,  2311,  2315,  2319,  2323,  2327,  2331,  2335,  2339,  2343,
+	 2347,  2353,  2359,  2365,  2371,  2377,  2383,  2389,  2395,  2399,  2403,  2407,
+	 2411,  2415,  2419,  2423,  2427,  2433,  2439,  2443,  2447,  2451,  2455,  2459,
+	 2463,  2469,  2475,  2481,  2487,  2493,  2499,  2503,  2507,  2511,  2515,  2519,
+	 2523,  2527,  2531,  2535,  2539,  2543,  2547,  2551,  2555,  2561,  2567,  2573,
+	 2579,  2583,  2587,  2591,  2595,  2599,  2603,  2607,  2611,  2615,  2619,  2623,
+	 2627,  2631,  2635,  2639,  2643,  2647,  2651,  2655,  2659,  2663,  2667,  2671,
+	 2675,  2679,  2683,  2687,  2691,  2695,     0,  2699,     0,     0,     0,     0,
+	 2704,  2708,  2712,  2716,  2720,  2726,  2732,  2738,  2744,  2750,  2756,  2762,
+	 2768,  2774,  2780,  2786,  2792,  2798,  2804,  2810,  2816,  2822,  2828,  2834,
+	 2840,  2844,  2848,  2852,  2856,  2860,  2864,  2870,  2876,  2882,  2888,  2894,
+	 2900,  2906,  2912,  2918,  2924,  2928,  2932,  2936,  2940,  2944,  2948,  2952,
+	 2956,  2962,  2968,  2974,  2980,  2986,  2992,  2998,  3004,  3010,  3016,  3022,
+	 3028,  3034,  3040,  3046,  3052,  3058,  3064,  3070,  3076,  3080,  3084,  3088,
+	 3092,  3098,  3104,  3110,  3116,  3122,  3128,  3134,  3140,  3146,  3152,  3156,
+	 3160,  3164,  3168,  3172,  3176,  3180,     0,     0,     0,     0,     0,     0,
+	 3184,  3189,  3194,  3201,  3208,  3215,  3222,  3229,  3236,  3241,  3246,  3253,
+	 3260,  3267,  3274,  3281,  3288,  3293,  3298,  3305,  3312,  3319,     0,     0,
+	 3326,  3331,  3336,  3343,  3350,  3357,     0,     0,  3364,  3369,  3374,  3381,
+	 3388,  3395,  3402,  3409,  3416,  3421,  3426,  3433,  3440,  3447,  3454,  3461,
+	 3468,  3473,  3478,  3485,  3492,  3499,  3506,  3513,  3520,  3525,  3530,  3537,
+	 3544,  3551,  3558,  3565,  3572,  3577,  3582,  3589,  3596,  3603,     0,     0,
+	 3610,  3615,  3620,  3627,  3634,  3641,     0,     0,  3648,  3653,  3658,  3665,
+	 3672,  3679,  3686,  3693,     0,  3700,     0,  3705,     0,  3712,     0,  3719,
+	 3726,  3731,  3736,  3743,  3750,  3757,  3764,  3771,  3778,  3783,  3788,  3795,
+	 3802,  3809,  3816,  3823,  3830,  3835,  3840,  3845,  3850,  3855,  3860,  3865,
+	 3870,  3875,  3880,  3885,  3890,  3895,     0,     0,  3900,  3907,  3914,  3923,
+	 3932,  3941,  3950,  3959,  3968,  3975,  3982,  3991,  4000,  4009,  4018,  4027,
+	 4036,  4043,  4050,  4059,  4068,  4077,  4086,  4095,  4104,  4111,  4118,  4127,
+	 4136,  4145,  4154,  4163,  4172,  4179,  4186,  4195,  4204,  4213,  4222,  4231,
+	 4240,  4247,  4254,  4263,  4272,  4281,  4290,  4299,  4308,  4313,  4318,  4325,
+	 4330,     0,  4337,  4342,  4349,  4354,  4359,  4364,  4369,     0,  4374,     0,
+	    0,  4377,  4382,  4389,  4394,     0,  4401,  4406,  4413,  4418,  4423,  4428,
+	 4433,  4438,  4444,  4450,  4456,  4461,  4466,  4473,     0,     0,  4480,  4485,
+	 4492,  4497,  4502,  4507,     0,  4512,  4518,  4524,  4530,  4535,  4540,  4547,
+	 4554,  4559,  4564,  4569,  4576,  4581,  4586,  4591,  4596,  4601,  4606,  4611,
+	    0,     0,  4613,  4620,  4625,     0,  4632,  4637,  4644,  4649,  4654,  4659,
+	 4664,  4669,     0,     0,  4672,  4676,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,  4680,     0,
+	    0,     0,  4683,  4685,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,  4689,  4695,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,  4701,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,  4707,  4713,  4719,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	 4725,     0,     0,     0,     0,  4731,     0,     0,  4737,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,  4743,     0,  4749,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,  4755,     0,     0,  4761,     0,     0,  4767,     0,  4773,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,  4779,     0,  4783,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,  4789,  4795,  4799,
+	 4803,  4809,     0,     0,  4815,  4821,     0,     0,  4827,  4833,     0,     0,
+	    0,     0,     0,     0,  4839,  4845,     0,     0,  4851,  4857,     0,     0,
+	 4863,  4869,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	 4875,  4881,  4887,  4893,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,  4899,  4905,  4911,  4917,     0,     0,     0,     0,
+	    0,     0,  4923,  4929,  4935,  4941,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,  4947,  4951,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,  4955,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,  4961,     0,  4968,     0,
+	 4975,     0,  4982,     0,  4989,     0,  4996,     0,  5003,     0,  5010,     0,
+	 5017,     0,  5024,     0,  5031,     0,  5038,     0,     0,  5045,     0,  5052,
+	    0,  5059,     0,     0,     0,     0,     0,     0,  5066,  5073,     0,  5080,
+	 5087,     0,  5094,  5101,     0,  5108,  5115,     0,  5122,  5129,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,  5136,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,  5143,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,  5150,     0,  5157,     0,
+	 5164,     0,  5171,     0,  5178,     0,  5185,     0,  5192,     0,  5199,     0,
+	 5206,     0,  5213,     0,  5220,     0,  5227,     0,     0,  5234,     0,  5241,
+	    0,  5248,     0,     0,     0,     0,     0,     0,  5255,  5262,     0,  5269,
+	 5276,     0,  5283,  5290,     0,  5297,  5304,     0,  5311,  5318,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,  5325,     0,     0,  5332,
+	 5339,  5346,  5353,     0,     0,     0,  5360,     0,  5367,  5371,  5375,  5379,
+	 5383,  5387,  5391,  5395,  5399,  5403,  5407,  5411,  5415,  5419,  5423,  5427,
+	 5431,  5435,  5439,  5443,  5447,  5451,  5455,  5459,  5463,  5467,  5471,  5475,
+	 5479,  5483,  5487,  5491,  5495,  5499,  5503,  5507,  5511,  5515,  5519,  5523,
+	 5527,  5531,  5535,  5539,  5543,  5547,  5551,  5555,  5559,  5563,  5567,  5571,
+	 5575,  5579,  5583,  5587,  5591,  5595,  5599,  5603,  5607,  5611,  5615,  5619,
+	 5623,  5627,  5631,  5635,  5639,  5643,  5647,  5651,  5655,  5659,  5663,  5667,
+	 5671,  5675,  5679,  5683,  5687,  5691,  5695,  5699,  5703,  5707,  5711,  5715,
+	 5719,  5723,  5727,  5731,  5735,  5739,  5743,  5747,  5751,  5755,  5759,  5763,
+	 5767,  5771,  5775,  5779,  5783,  5787,  5791,  5795,  5799,  5803,  5807,  5811,
+	 5815,  5819,  5823,  5827,  5831,  5835,  5839,  5843,  5847,  5851,  5855,  5859,
+	 5863,  5867,  5871,  5875,  5879,  5883,  5887,  5891,  5895,  5899,  5903,  5907,
+	 5911,  5915,  5919,  5923,  5927,  5931,  5935,  5939,  5943,  5947,  5951,  5955,
+	 5959,  5963,  5967,  5971,  5975,  5979,  5983,  5987,  5991,  5995,  5999,  6003,
+	 6007,  6011,  6015,  6019,  6023,  6027,  6031,  6035,  6039,  6043,  6047,  6051,
+	 6055,  6059,  6063,  6067,  6071,  6075,  6079,  6083,  6087,  6091,  6095,  6099,
+	 6103,  6107,  6111,  6115,  6119,  6123,  6127,  6131,  6135,  6139,  6143,  6147,
+	 6151,  6155,  6159,  6163,  6167,  6171,  6175,  6179,  6183,  6187,  6191,  6195,
+	 6199,  6203,  6207,  6211,  6215,  6219,  6223,  6227,  6231,  6235,  6239,  6243,
+	 6247,  6251,  6255,  6259,  6263,  6267,  6271,  6275,  6279,  6283,  6287,  6291,
+	 6295,  6299,  6303,  6307,  6311,  6315,  6319,  6323,  6327,  6331,  6335,  6339,
+	 6343,  6347,  6351,  6355,  6359,  6363,  6367,  6371,  6375,  6379,  6383,  6387,
+	 6391,  6395,  6399,  6403,  6407,  6411,  6415,  6419,  6423,  6427,  6431,  6435,
+	 6439,  6443,     0,     0,  6447,     0,  6451,     0,     0,  6455,  6459,  6463,
+	 6467,  6471,  6475,  6479,  6483,  6487,  6491,     0,  6495,     0,  6499,     0,
+	    0,  6503,  6507,     0,     0,     0,  6511,  6515,  6519,  6523,  6527,  6531,
+	 6535,  6539,  6543,  6547,  6551,  6555,  6559,  6563,  6567,  6571,  6575,  6579,
+	 6583,  6587,  6591,  6595,  6599,  6603,  6607,  6611,  6615,  6619,  6623,  6627,
+	 6631,  6635,  6639,  6643,  6647,  6651,  6655,  6659,  6663,  6667,  6671,  6675,
+	 6679,  6683,  6687,  6691,  6695,  6699,  6703,  6707,  6711,  6715,  6719,  6723,
+	 6727,  6731,  6735,  6739,  6743,  6747,  6751,  6755,  6759,  6763,  6767,  6771,
+	 6775,  6780,     0,     0,  6784,  6788,  6792,  6796,  6800,  6804,  6808,  6812,
+	 6816,  6820,  6824,  6828,  6832,  6836,  6840,  6844,  6848,  6852,  6856,  6860,
+	 6864,  6868,  6872,  6876,  6880,  6884,  6888,  6892,  6896,  6900,  6904,  6908,
+	 6912,  6916,  6920,  6924,  6928,  6932,  6936,  6940,  6944,  6948,  6952,  6956,
+	 6960,  6964,  6968,  6972,  6976,  6980,  6984,  6988,  6992,  6996,  7000,  7004,
+	 7008,  7012,  7016,  7020,  7024,  7028,  7032,  7036,  7040,  7044,  7048,  7052,
+	 7056,  7060,  7064,  7068,  7072,  7076,  7080,  7084,  7088,  7092,  7096,  7100,
+	 7104,  7108,  7112,  7116,  7120,  7124,  7128,  7132,  7136,  7140,  7144,  7148,
+	 7152,  7156,  7160,  7164,  7169,  7174,  7179,  7183,  7187,  7191,  7196,  7201,
+	 7206,  7210,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,  7214,     0,  7219,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,  7224,  7229,
+	 7234,  7241,  7248,  7253,  7258,  7263,  7268,  7273,  7278,  7283,  7288,     0,
+	 7293,  7298,  7303,  7308,  7313,     0,  7318,     0,  7323,  7328,     0,  7333,
+	 7338,     0,  7343,  7348,  7353,  7358,  7363,  7368,  7373,  7378,  7383,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,  7388,     0,  7397,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,  7406,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,  7415,  7424,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,  7433,  7442,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,  7451,
+	 7460,     0,  7469,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,  7478,  7487,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,  7496,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,  7505,  7514,  7523,  7536,  7549,  7562,
+	 7575,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,  7588,  7597,  7606,  7619,  7632,  7645,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	 7658,  7662,  7666,  7670,  7675,  7679,  7683,  7687,  7691,  7695,  7699,  7703,
+	 7707,  7711,  7716,  7720,  7724,  7728,  7732,  7737,  7741,  7745,  7749,  7754,
+	 7758,  7762,  7766,  7770,  7774,  7779,  7783,  7787,  7791,  7795,  7799,  7803,
+	 7807,  7811,  7815,  7819,  7823,  7827,  7831,  7835,  7839,  7843,  7847,  7851,
+	 7855,  7859,  7863,  7867,  7871,  7876,  7880,  7884,  7888,  7893,  7897,  7901,
+	 7905,  7909,  7913,  7917,  7921,  7925,  7929,  7933,  7937,  7941,  7945,  7949,
+	 7953,  7957,  7961,  7965,  7969,  7973,  7977,  7981,  7985,  7989,  7993,  7997,
+	 8001,  8005,  8009,  8013,  8017,  8021,  8026,  8030,  8034,  8038,  8042,  8046,
+	 8050,  8055,  8060,  8064,  8068,  8072,  8076,  8080,  8084,  8088,  8092,  8096,
+	 8100,  8105,  8109,  8113,  8117,  8121,  8126,  8130,  8134,  8138,  8142,  8146,
+	 8150,  8154,  8158,  8162,  8167,  8171,  8176,  8180,  8184,  8188,  8192,  8196,
+	 8200,  8204,  8208,  8212,  8216,  8220,  8225,  8229,  8233,  8237,  8241,  8245,
+	 8250,  8254,  8259,  8264,  8268,  8272,  8276,  8280,  8285,  8290,  8294,  8298,
+	 8302,  8306,  8310,  8314,  8318,  8322,  8326,  8330,  8334,  8339,  8343,  8347,
+	 8351,  8355,  8359,  8363,  8367,  8371,  8375,  8379,  8383,  8387,  8391,  8395,
+	 8399,  8403,  8407,  8411,  8415,  8420,  8424,  8428,  8432,  8436,  8440,  8445,
+	 8449,  8453,  8457,  8461,  8465,  8469,  8473,  8477,  8481,  8485,  8489,  8494,
+	 8498,  8502,  8506,  8510,  8514,  8518,  8522,  8526,  8530,  8534,  8538,  8542,
+	 8546,  8550,  8554,  8558,  8562,  8566,  8571,  8575,  8579,  8583,  8587,  8591,
+	 8596,  8600,  8604,  8608,  8612,  8616,  8620,  8624,  8628,  8633,  8637,  8641,
+	 8645,  8650,  8654,  8658,  8662,  8666,  8670,  8674,  8679,  8684,  8689,  8693,
+	 8698,  8702,  8706,  8710,  8714,  8718,  8722,  8726,  8730,  8734,  8738,  8743,
+	 8747,  8751,  8755,  8759,  8763,  8767,  8772,  8776,  8780,  8785,  8790,  8794,
+	 8798,  8802,  8806,  8810,  8814,  8818,  8822,  8826,  8831,  8835,  8840,  8844,
+	 8849,  8853,  8857,  8861,  8866,  8870,  8874,  8879,  8884,  8888,  8892,  8896,
+	 8900,  8904,  8908,  8912,  8916,  8920,  8924,  8928,  8932,  8936,  8941,  8945,
+	 8950,  8954,  8959,  8963,  8968,  8973,  8978,  8982,  8986,  8990,  8995,  9000,
+	 9005,  9010,  9014,  9018,  9022,  9026,  9030,  9034,  9038,  9042,  9047,  9051,
+	 9055,  9059,  9063,  9068,  9072,  9077,  9082,  9086,  9090,  9094,  9098,  9102,
+	 9106,  9111,  9116,  9121,  9125,  9129,  9134,  9138,  9142,  9146,  9151,  9155,
+	 9159,  9163,  9167,  9171,  9176,  9180,  9184,  9188,  9192,  9196,  9200,  9205,
+	 9210,  9214,  9219,  9223,  9228,  9232,  9236,  9240,  9245,  9250,  9254,  9259,
+	 9263,  9268,  9272,  9276,  9280,  9284,  9288,  9292,  9297,  9302,  9307,  9312,
+	 9316,  9320,  9324,  9328,  9332,  9336,  9340,  9344,  9348,  9352,  9356,  9360,
+	 9365,  9369,  9373,  9377,  9381,  9385,  9389,  9393,  9397,  9401,  9405,  9409,
+	 9413,  9418,  9423,  9428,  9432,  9436,  9440,  9444,  9449,  9453,  9458,  9462,
+	 9466,  9471,  9476,  9480,  9484,  9488,  9492,  9496,  9500,  9504,  9508,  9512,
+	 9516,  9520,  9524,  9528,  9532,  9536,  9540,  9544,  9548,  9552,  9557,  9561,
+	 9565,  9569,  9573,  9577,  9582,  9587,  9591,  9595,  9599,  9603,  9607,  9611,
+	 9616,  9620,  9624,  9628,  9632,  9637,  9642,  9646,  9650,  9654,  9659,  9663,
+	 9667,  9672,  9677,  9681,  9685,  9689,  9694,  9698,  9702,  9706,  9710,  9714,
+	 9718,  9722,  9727,  9731,  9735,  9739,  9744,  9748,  9752,  9756,  9760,  9765,
+	 9770,  9774,  9778,  9782,  9787,  9791,  9796,  9800,  9804,  9808,  9813,  9817,
+	 9821,  9825,  9829,  9833,  9837,  9841,  9846,  9850,  9854,  9858,  9862,  9866,
+	 9870,  9875,  9879,  9884,  9889,  9894,  9898,  9902,  9906,  9910,  9914,  9918,
+	 9922,  9926,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0
+};
+
+/** the full canonical decomposition of each character as
+    a length byte followed by that many bytes of UTF8
+*/
+static const ACR_Byte_t g_ACRNormalizeDecompositionData[9931] =
+{
+	0x00, 0x03, 0x41, 0xCC, 0x80, 0x03, 0x41, 0xCC, 0x81, 0x03, 0x41, 0xCC,
+	0x82, 0x03, 0x41, 0xCC, 0x83, 0x03, 0x41, 0xCC, 0x88, 0x03, 0x41, 0xCC,
+	0x8A, 0x03, 0x43, 0xCC, 0xA7, 0x03, 0x45, 0xCC, 0x80, 0x03, 0x45, 0xCC,
+	0x81, 0x03, 0x45, 0xCC, 0x82, 0x03, 0x45, 0xCC, 0x88, 0x03, 0x49, 0xCC,
+	0x80, 0x03, 0x49, 0xCC, 0x81, 0x03, 0x49, 0xCC, 0x82, 0x03, 0x49, 0xCC,
+	0x88, 0x03, 0x4E, 0xCC, 0x83, 0x03, 0x4F, 0xCC, 0x80, 0x03, 0x4F, 0xCC,
+	0x81, 0x03, 0x4F, 0xCC, 0x82, 0x03, 0x4F, 0xCC, 0x83, 0x03, 0x4F, 0xCC,
+	0x88, 0x03, 0x55, 0xCC, 0x80, 0x03, 0x55, 0xCC, 0x81, 0x03, 0x55, 0xCC,
+	0x82, 0x03, 0x55, 0xCC, 0x88, 0x03, 0x59, 0xCC, 0x81, 0x03, 0x61, 0xCC,
+	0x80, 0x03, 0x61, 0xCC, 0x81, 0x03, 0x61, 0xCC, 0x82, 0x03, 0x61, 0xCC,
+	0x83, 0x03, 0x61, 0xCC, 0x88, 0x03, 0x61, 0xCC, 0x8A, 0x03, 0x63, 0xCC,
+	0xA7, 0x03, 0x65, 0xCC, 0x80, 0x03, 0x65, 0xCC, 0x81, 0x03, 0x65, 0xCC,
+	0x82, 0x03, 0x65, 0xCC, 0x88, 0x03, 0x69, 0xCC, 0x80, 0x03, 0x69, 0xCC,
+	0x81, 0x03, 0x69, 0xCC, 0x82, 0x03, 0x69, 0xCC, 0x88, 0x03, 0x6E, 0xCC,
+	0x83, 0x03, 0x6F, 0xCC, 0x80, 0x03, 0x6F, 0xCC, 0x81, 0x03, 0x6F, 0xCC,
+	0x82, 0x03, 0x6F, 0xCC, 0x83, 0x03, 0x6F, 0xCC, 0x88, 0x03, 0x75, 0xCC,
+	0x80, 0x03, 0x75, 0xCC, 0x81, 0x03, 0x75, 0xCC, 0x82, 0x03, 0x75, 0xCC,
+	0x88, 0x03, 0x79, 0xCC, 0x81, 0x03, 0x79, 0xCC, 0x88, 0x03, 0x41, 0xCC,
+	0x84, 0x03, 0x61, 0xCC, 0x84, 0x03, 0x41, 0xCC, 0x86, 0x03, 0x61, 0xCC,
+	0x86, 0x03, 0x41, 0xCC, 0xA8, 0x03, 0x61, 0xCC, 0xA8, 0x03, 0x43, 0xCC,
+	0x81, 0x03, 0x63, 0xCC, 0x81, 0x03, 0x43, 0xCC, 0x82, 0x03, 0x63, 0xCC,
+	0x82, 0x03, 0x43, 0xCC, 0x87, 0x03, 0x63, 0xCC, 0x87, 0x03, 0x43, 0xCC,
+	0x8C, 0x03, 0x63, 0xCC, 0x8C, 0x03, 0x44, 0xCC, 0x8C, 0x03, 0x64, 0xCC,
+	0x8C, 0x03, 0x45, 0xCC, 0x84, 0x03, 0x65, 0xCC, 0x84, 0x03, 0x45, 0xCC,
+	0x86, 0x03, 0x65, 0xCC, 0x86, 0x03, 0x45, 0xCC, 0x87, 0x03, 0x65, 0xCC,
+	0x87, 0x03, 0x45, 0xCC, 0xA8, 0x03, 0x65, 0xCC, 0xA8, 0x03, 0x45, 0xCC,
+	0x8C, 0x03, 0x65, 0xCC, 0x8C, 0x03, 0x47, 0xCC, 0x82, 0x03, 0x67, 0xCC,
+	0x82, 0x03, 0x47, 0xCC, 0x86, 0x03, 0x67, 0xCC, 0x86, 0x03, 0x47, 0xCC,
+	0x87, 0x03, 0x67, 0xCC, 0x87, 0x03, 0x47, 0xCC, 0xA7, 0x03, 0x67, 0xCC,
+	0xA7, 0x03, 0x48, 0xCC, 0x82, 0x03, 0x68, 0xCC, 0x82, 0x03, 0x49, 0xCC,
+	0x83, 0x03, 0x69, 0xCC, 0x83, 0x03, 0x49, 0xCC, 0x84, 0x03, 0x69, 0xCC,
+	0x84, 0x03, 0x49, 0xCC, 0x86, 0x03, 0x69, 0xCC, 0x86, 0x03, 0x49, 0xCC,
+	0xA8, 0x03, 0x69, 0xCC, 0xA8, 0x03, 0x49, 0xCC, 0x87, 0x03, 0x4A, 0xCC,
+	0x82, 0x03, 0x6A, 0xCC, 0x82, 0x03, 0x4B, 0xCC, 0xA7, 0x03, 0x6B, 0xCC,
+	0xA7, 0x03, 0x4C, 0xCC, 0x81, 0x03, 0x6C, 0xCC, 0x81, 0x03, 0x4C, 0xCC,
+	0xA7, 0x03, 0x6C, 0xCC, 0xA7, 0x03, 0x4C, 0xCC, 0x8C, 0x03, 0x6C, 0xCC,
+	0x8C, 0x03, 0x4E, 0xCC, 0x81, 0x03, 0x6E, 0xCC, 0x81, 0x03, 0x4E, 0xCC,
+	0xA7, 0x03, 0x6E, 0xCC, 0xA7, 0x03, 0x4E, 0xCC, 0x8C, 0x03, 0x6E, 0xCC,
+	0x8C, 0x03, 0x4F, 0xCC, 0x84, 0x03, 0x6F, 0xCC, 0x84, 0x03, 0x4F, 0xCC,
+	0x86, 0x03, 0x6F, 0xCC, 0x86, 0x03, 0x4F, 0xCC, 0x8B, 0x03, 0x6F, 0xCC,
+	0x8B, 0x03, 0x52, 0xCC, 0x81, 0x03, 0x72, 0xCC, 0x81, 0x03, 0x52, 0xCC,
+	0xA7, 0x03, 0x72, 0xCC, 0xA7, 0x03, 0x52, 0xCC, 0x8C, 0x03, 0x72, 0xCC,
+	0x8C, 0x03, 0x53, 0xCC, 0x81, 0x03, 0x73, 0xCC, 0x81, 0x03, 0x53, 0xCC,
+	0x82, 0x03, 0x73, 0xCC, 0x82, 0x03, 0x53, 0xCC, 0xA7, 0x03, 0x73, 0xCC,
+	0xA7, 0x03, 0x53, 0xCC, 0x8C, 0x03, 0x73, 0xCC, 0x8C, 0x03, 0x54, 0xCC,
+	0xA7, 0x03, 0x74, 0xCC, 0xA7, 0x03, 0x54, 0xCC, 0x8C, 0x03, 0x74, 0xCC,
+	0x8C, 0x03, 0x55, 0xCC, 0x83, 0x03, 0x75, 0xCC, 0x83, 0x03, 0x55, 0xCC,
+	0x84, 0x03, 0x75, 0xCC, 0x84, 0x03, 0x55, 0xCC, 0x86, 0x03, 0x75, 0xCC,
+	0x86, 0x03, 0x55, 0xCC, 0x8A, 0x03, 0x75, 0xCC, 0x8A, 0x03, 0x55, 0xCC,
+	0x8B, 0x03, 0x75, 0xCC, 0x8B, 0x03, 0x55, 0xCC, 0xA8, 0x03, 0x75, 0xCC,
+	0xA8, 0x03, 0x57, 0xCC, 0x82, 0x03, 0x77, 0xCC, 0x82, 0x03, 0x59, 0xCC,
+	0x82, 0x03, 0x79, 0xCC, 0x82, 0x03, 0x59, 0xCC, 0x88, 0x03, 0x5A, 0xCC,
+	0x81, 0x03, 0x7A, 0xCC, 0x81, 0x03, 0x5A, 0xCC, 0x87, 0x03, 0x7A, 0xCC,
+	0x87, 0x03, 0x5A, 0xCC, 0x8C, 0x03, 0x7A, 0xCC, 0x8C, 0x03, 0x4F, 0xCC,
+	0x9B, 0x03, 0x6F, 0xCC, 0x9B, 0x03, 0x55, 0xCC, 0x9B, 0x03, 0x75, 0xCC,
+	0x9B, 0x03, 0x41, 0xCC, 0x8C, 0x03, 0x61, 0xCC, 0x8C, 0x03, 0x49, 0xCC,
+	0x8C, 0x03, 0x69, 0xCC, 0x8C, 0x03, 0x4F, 0xCC, 0x8C, 0x03, 0x6F, 0xCC,
+	0x8C, 0x03, 0x55, 0xCC, 0x8C, 0x03, 0x75, 0xCC, 0x8C, 0x05, 0x55, 0xCC,
+	0x88, 0xCC, 0x84, 0x05, 0x75, 0xCC, 0x88, 0xCC, 0x84, 0x05, 0x55, 0xCC,
+	0x88, 0xCC, 0x81, 0x05, 0x75, 0xCC, 0x88, 0xCC, 0x81, 0x05, 0x55, 0xCC,
+	0x88, 0xCC, 0x8C, 0x05, 0x75, 0xCC, 0x88, 0xCC, 0x8C, 0x05, 0x55, 0xCC,
+	0x88, 0xCC, 0x80, 0x05, 0x75, 0xCC, 0x88, 0xCC, 0x80, 0x05, 0x41, 0xCC,
+	0x88, 0xCC, 0x84, 0x05, 0x61, 0xCC, 0x88, 0xCC, 0x84, 0x05, 0x41, 0xCC,
+	0x87, 0xCC, 0x84, 0x05, 0x61, 0xCC, 0x87, 0xCC, 0x84, 0x04, 0xC3, 0x86,
+	0xCC, 0x84, 0x04, 0xC3, 0xA6, 0xCC, 0x84, 0x03, 0x47, 0xCC, 0x8C, 0x03,
+	0x67, 0xCC, 0x8C, 0x03, 0x4B, 0xCC, 0x8C, 0x03, 0x6B, 0xCC, 0x8C, 0x03,
+	0x4F, 0xCC, 0xA8, 0x03, 0x6F, 0xCC, 0xA8, 0x05, 0x4F, 0xCC, 0xA8, 0xCC,
+	0x84, 0x05, 0x6F, 0xCC, 0xA8, 0xCC, 0x84, 0x04, 0xC6, 0xB7, 0xCC, 0x8C,
+	0x04, 0xCA, 0x92, 0xCC, 0x8C, 0x03, 0x6A, 0xCC, 0x8C, 0x03, 0x47, 0xCC,
+	0x81, 0x03, 0x67, 0xCC, 0x81, 0x03, 0x4E, 0xCC, 0x80, 0x03, 0x6E, 0xCC,
+	0x80, 0x05, 0x41, 0xCC, 0x8A, 0xCC, 0x81, 0x05, 0x61, 0xCC, 0x8A, 0xCC,
+	0x81, 0x04, 0xC3, 0x86, 0xCC, 0x81, 0x04, 0xC3, 0xA6, 0xCC, 0x81, 0x04,
+	0xC3, 0x98, 0xCC, 0x81, 0x04, 0xC3, 0xB8, 0xCC, 0x81, 0x03, 0x41, 0xCC,
+	0x8F, 0x03, 0x61, 0xCC, 0x8F, 0x03, 0x41, 0xCC, 0x91, 0x03, 0x61, 0xCC,
+	0x91, 0x03, 0x45, 0xCC, 0x8F, 0x03, 0x65, 0xCC, 0x8F, 0x03, 0x45, 0xCC,
+	0x91, 0x03, 0x65, 0xCC, 0x91, 0x03, 0x49, 0xCC, 0x8F, 0x03, 0x69, 0xCC,
+	0x8F, 0x03, 0x49, 0xCC, 0x91, 0x03, 0x69, 0xCC, 0x91, 0x03, 0x4F, 0xCC,
+	0x8F, 0x03, 0x6F, 0xCC, 0x8F, 0x03, 0x4F, 0xCC, 0x91, 0x03, 0x6F, 0xCC,
+	0x91, 0x03, 0x52, 0xCC, 0x8F, 0x03, 0x72, 0xCC, 0x8F, 0x03, 0x52, 0xCC,
+	0x91, 0x03, 0x72, 0xCC, 0x91, 0x03, 0x55, 0xCC, 0x8F, 0x03, 0x75, 0xCC,
+	0x8F, 0x03, 0x55, 0xCC, 0x91, 0x03, 0x75, 0xCC, 0x91, 0x03, 0x53, 0xCC,
+	0xA6, 0x03, 0x73, 0xCC, 0xA6, 0x03, 0x54, 0xCC, 0xA6, 0x03, 0x74, 0xCC,
+	0xA6, 0x03, 0x48, 0xCC, 0x8C, 0x03, 0x68, 0xCC, 0x8C, 0x03, 0x41, 0xCC,
+	0x87, 0x03, 0x61, 0xCC, 0x87, 0x03, 0x45, 0xCC, 0xA7, 0x03, 0x65, 0xCC,
+	0xA7, 0x05, 0x4F, 0xCC, 0x88, 0xCC, 0x84, 0x05, 0x6F, 0xCC, 0x88, 0xCC,
+	0x84, 0x05, 0x4F, 0xCC, 0x83, 0xCC, 0x84, 0x05, 0x6F, 0xCC, 0x83, 0xCC,
+	0x84, 0x03, 0x4F, 0xCC, 0x87, 0x03, 0x6F, 0xCC, 0x87, 0x05, 0x4F, 0xCC,
+	0x87, 0xCC, 0x84, 0x05, 0x6F, 0xCC, 0x87, 0xCC, 0x84, 0x03, 0x59, 0xCC,
+	0x84, 0x03, 0x79, 0xCC, 0x84, 0x02, 0xCC, 0x80, 0x02, 0xCC, 0x81, 0x02,
+	0xCC, 0x93, 0x04, 0xCC, 0x88, 0xCC, 0x81, 0x02, 0xCA, 0xB9, 0x01, 0x3B,
+	0x04, 0xC2, 0xA8, 0xCC, 0x81, 0x04, 0xCE, 0x91, 0xCC, 0x81, 0x02, 0xC2,
+	0xB7, 0x04, 0xCE, 0x95, 0xCC, 0x81, 0x04, 0xCE, 0x97, 0xCC, 0x81, 0x04,
+	0xCE, 0x99, 0xCC, 0x81, 0x04, 0xCE, 0x9F, 0xCC, 0x81, 0x04, 0xCE, 0xA5,
+	0xCC, 0x81, 0x04, 0xCE, 0xA9, 0xCC, 0x81, 0x06, 0xCE, 0xB9, 0xCC, 0x88,
+	0xCC, 0x81, 0x04, 0xCE, 0x99, 0xCC, 0x88, 0x04, 0xCE, 0xA5, 0xCC, 0x88,
+	0x04, 0xCE, 0xB1, 0xCC, 0x81, 0x04, 0xCE, 0xB5, 0xCC, 0x81, 0x04, 0xCE,
+	0xB7, 0xCC, 0x81, 0x04, 0xCE, 0xB9, 0xCC, 0x81, 0x06, 0xCF, 0x85, 0xCC,
+	0x88, 0xCC, 0x81, 0x04, 0xCE, 0xB9, 0xCC, 0x88, 0x04, 0xCF, 0x85, 0xCC,
+	0x88, 0x04, 0xCE, 0xBF, 0xCC, 0x81, 0x04, 0xCF, 0x85, 0xCC, 0x81, 0x04,
+	0xCF, 0x89, 0xCC, 0x81, 0x04, 0xCF, 0x92, 0xCC, 0x81, 0x04, 0xCF, 0x92,
+	0xCC, 0x88, 0x04, 0xD0, 0x95, 0xCC, 0x80, 0x04, 0xD0, 0x95, 0xCC, 0x88,
+	0x04, 0xD0, 0x93, 0xCC, 0x81, 0x04, 0xD0, 0x86, 0xCC, 0x88, 0x04, 0xD0,
+	0x9A, 0xCC, 0x81, 0x04, 0xD0, 0x98, 0xCC, 0x80, 0x04, 0xD0, 0xA3, 0xCC,
+	0x86, 0x04, 0xD0, 0x98, 0xCC, 0x86, 0x04, 0xD0, 0xB8, 0xCC, 0x86, 0x04,
+	0xD0, 0xB5, 0xCC, 0x80, 0x04, 0xD0, 0xB5, 0xCC, 0x88, 0x04, 0xD0, 0xB3,
+	0xCC, 0x81, 0x04, 0xD1, 0x96, 0xCC, 0x88, 0x04, 0xD0, 0xBA, 0xCC, 0x81,
+	0x04, 0xD0, 0xB8, 0xCC, 0x80, 0x04, 0xD1, 0x83, 0xCC, 0x86, 0x04, 0xD1,
+	0xB4, 0xCC, 0x8F, 0x04, 0xD1, 0xB5, 0xCC, 0x8F, 0x04, 0xD0, 0x96, 0xCC,
+	0x86, 0x04, 0xD0, 0xB6, 0xCC, 0x86, 0x04, 0xD0, 0x90, 0xCC, 0x86, 0x04,
+	0xD0, 0xB0, 0xCC, 0x86, 0x04, 0xD0, 0x90, 0xCC, 0x88, 0x04, 0xD0, 0xB0,
+	0xCC, 0x88, 0x04, 0xD0, 0x95, 0xCC, 0x86, 0x04, 0xD0, 0xB5, 0xCC, 0x86,
+	0x04, 0xD3, 0x98, 0xCC, 0x88, 0x04, 0xD3, 0x99, 0xCC, 0x88, 0x04, 0xD0,
+	0x96, 0xCC, 0x88, 0x04, 0xD0, 0xB6, 0xCC, 0x88, 0x04, 0xD0, 0x97, 0xCC,
+	0x88, 0x04, 0xD0, 0xB7, 0xCC, 0x88, 0x04, 0xD0, 0x98, 0xCC, 0x84, 0x04,
+	0xD0, 0xB8, 0xCC, 0x84, 0x04, 0xD0, 0x98, 0xCC, 0x88, 0x04, 0xD0, 0xB8,
+	0xCC, 0x88, 0x04, 0xD0, 0x9E, 0xCC, 0x88, 0x04, 0xD0, 0xBE, 0xCC, 0x88,
+	0x04, 0xD3, 0xA8, 0xCC, 0x88, 0x04, 0xD3, 0xA9, 0xCC, 0x88, 0x04, 0xD0,
+	0xAD, 0xCC, 0x88, 0x04, 0xD1, 0x8D, 0xCC, 0x88, 0x04, 0xD0, 0xA3, 0xCC,
+	0x84, 0x04, 0xD1, 0x83, 0xCC, 0x84, 0x04, 0xD0, 0xA3, 0xCC, 0x88, 0x04,
+	0xD1, 0x83, 0xCC, 0x88, 0x04, 0xD0, 0xA3, 0xCC, 0x8B, 0x04, 0xD1, 0x83,
+	0xCC, 0x8B, 0x04, 0xD0, 0xA7, 0xCC, 0x88, 0x04, 0xD1, 0x87, 0xCC, 0x88,
+	0x04, 0xD0, 0xAB, 0xCC, 0x88, 0x04, 0xD1, 0x8B, 0xCC, 0x88, 0x04, 0xD8,
+	0xA7, 0xD9, 0x93, 0x04, 0xD8, 0xA7, 0xD9, 0x94, 0x04, 0xD9, 0x88, 0xD9,
+	0x94, 0x04, 0xD8, 0xA7, 0xD9, 0x95, 0x04, 0xD9, 0x8A, 0xD9, 0x94, 0x04,
+	0xDB, 0x95, 0xD9, 0x94, 0x04, 0xDB, 0x81, 0xD9, 0x94, 0x04, 0xDB, 0x92,
+	0xD9, 0x94, 0x06, 0xE0, 0xA4, 0xA8, 0xE0, 0xA4, 0xBC, 0x06, 0xE0, 0xA4,
+	0xB0, 0xE0, 0xA4, 0xBC, 0x06, 0xE0, 0xA4, 0xB3, 0xE0, 0xA4, 0xBC, 0x06,
+	0xE0, 0xA4, 0x95, 0xE0, 0xA4, 0xBC, 0x06, 0xE0, 0xA4, 0x96, 0xE0, 0xA4,
+	0xBC, 0x06, 0xE0, 0xA4, 0x97, 0xE0, 0xA4, 0xBC, 0x06, 0xE0, 0xA4, 0x9C,
+	0xE0, 0xA4, 0xBC, 0x06, 0xE0, 0xA4, 0xA1, 0xE0, 0xA4, 0xBC, 0x06, 0xE0,
+	0xA4, 0xA2, 0xE0, 0xA4, 0xBC, 0x06, 0xE0, 0xA4, 0xAB, 0xE0, 0xA4, 0xBC,
+	0x06, 0xE0, 0xA4, 0xAF, 0xE0, 0xA4, 0xBC, 0x06, 0xE0, 0xA7, 0x87, 0xE0,
+	0xA6, 0xBE, 0x06, 0xE0, 0xA7, 0x87, 0xE0, 0xA7, 0x97, 0x06, 0xE0, 0xA6,
+	0xA1, 0xE0, 0xA6, 0xBC, 0x06, 0xE0, 0xA6, 0xA2, 0xE0, 0xA6, 0xBC, 0x06,
+	0xE0, 0xA6, 0xAF, 0xE0, 0xA6, 0xBC, 0x06, 0xE0, 0xA8, 0xB2, 0xE0, 0xA8,
+	0xBC, 0x06, 0xE0, 0xA8, 0xB8, 0xE0, 0xA8, 0xBC, 0x06, 0xE0, 0xA8, 0x96,
+	0xE0, 0xA8, 0xBC, 0x06, 0xE0, 0xA8, 0x97, 0xE0, 0xA8, 0xBC, 0x06, 0xE0,
+	0xA8, 0x9C, 0xE0, 0xA8, 0xBC, 0x06, 0xE0, 0xA8, 0xAB, 0xE0, 0xA8, 0xBC,
+	0x06, 0xE0, 0xAD, 0x87, 0xE0, 0xAD, 0x96, 0x06, 0xE0, 0xAD, 0x87, 0xE0,
+	0xAC, 0xBE, 0x06, 0xE0, 0xAD, 0x87, 0xE0, 0xAD, 0x97, 0x06, 0xE0, 0xAC,
+	0xA1, 0xE0, 0xAC, 0xBC, 0x06, 0xE0, 0xAC, 0xA2, 0xE0, 0xAC, 0xBC, 0x06,
+	0xE0, 0xAE, 0x92, 0xE0, 0xAF, 0x97, 0x06, 0xE0, 0xAF, 0x86, 0xE0, 0xAE,
+	0xBE, 0x06, 0xE0, 0xAF, 0x87, 0xE0, 0xAE, 0xBE, 0x06, 0xE0, 0xAF, 0x86,
+	0xE0, 0xAF, 0x97, 0x06, 0xE0, 0xB1, 0x86, 0xE0, 0xB1, 0x96, 0x06, 0xE0,
+	0xB2, 0xBF, 0xE0, 0xB3, 0x95, 0x06, 0xE0, 0xB3, 0x86, 0xE0, 0xB3, 0x95,
+	0x06, 0xE0, 0xB3, 0x86, 0xE0, 0xB3, 0x96, 0x06, 0xE0, 0xB3, 0x86, 0xE0,
+	0xB3, 0x82, 0x09, 0xE0, 0xB3, 0x86, 0xE0, 0xB3, 0x82, 0xE0, 0xB3, 0x95,
+	0x06, 0xE0, 0xB5, 0x86, 0xE0, 0xB4, 0xBE, 0x06, 0xE0, 0xB5, 0x87, 0xE0,
+	0xB4, 0xBE, 0x06, 0xE0, 0xB5, 0x86, 0xE0, 0xB5, 0x97, 0x06, 0xE0, 0xB7,
+	0x99, 0xE0, 0xB7, 0x8A, 0x06, 0xE0, 0xB7, 0x99, 0xE0, 0xB7, 0x8F, 0x09,
+	0xE0, 0xB7, 0x99, 0xE0, 0xB7, 0x8F, 0xE0, 0xB7, 0x8A, 0x06, 0xE0, 0xB7,
+	0x99, 0xE0, 0xB7, 0x9F, 0x06, 0xE0, 0xBD, 0x82, 0xE0, 0xBE, 0xB7, 0x06,
+	0xE0, 0xBD, 0x8C, 0xE0, 0xBE, 0xB7, 0x06, 0xE0, 0xBD, 0x91, 0xE0, 0xBE,
+	0xB7, 0x06, 0xE0, 0xBD, 0x96, 0xE0, 0xBE, 0xB7, 0x06, 0xE0, 0xBD, 0x9B,
+	0xE0, 0xBE, 0xB7, 0x06, 0xE0, 0xBD, 0x80, 0xE0, 0xBE, 0xB5, 0x06, 0xE0,
+	0xBD, 0xB1, 0xE0, 0xBD, 0xB2, 0x06, 0xE0, 0xBD, 0xB1, 0xE0, 0xBD, 0xB4,
+	0x06, 0xE0, 0xBE, 0xB2, 0xE0, 0xBE, 0x80, 0x06, 0xE0, 0xBE, 0xB3, 0xE0,
+	0xBE, 0x80, 0x06, 0xE0, 0xBD, 0xB1, 0xE0, 0xBE, 0x80, 0x06, 0xE0, 0xBE,
+	0x92, 0xE0, 0xBE, 0xB7, 0x06, 0xE0, 0xBE, 0x9C, 0xE0, 0xBE, 0xB7, 0x06,
+	0xE0, 0xBE, 0xA1, 0xE0, 0xBE, 0xB7, 0x06, 0xE0, 0xBE, 0xA6, 0xE0, 0xBE,
+	0xB7, 0x06, 0xE0, 0xBE, 0xAB, 0xE0, 0xBE, 0xB7, 0x06, 0xE0, 0xBE, 0x90,
+	0xE0, 0xBE, 0xB5, 0x06, 0xE1, 0x80, 0xA5, 0xE1, 0x80, 0xAE, 0x06, 0xE1,
+	0xAC, 0x85, 0xE1, 0xAC, 0xB5, 0x06, 0xE1, 0xAC, 0x87, 0xE1, 0xAC, 0xB5,
+	0x06, 0xE1, 0xAC, 0x89, 0xE1, 0xAC, 0xB5, 0x06, 0xE1, 0xAC, 0x8B, 0xE1,
+	0xAC, 0xB5, 0x06, 0xE1, 0xAC, 0x8D, 0xE1, 0xAC, 0xB5, 0x06, 0xE1, 0xAC,
+	0x91, 0xE1, 0xAC, 0xB5, 0x06, 0xE1, 0xAC, 0xBA, 0xE1, 0xAC, 0xB5, 0x06,
+	0xE1, 0xAC, 0xBC, 0xE1, 0xAC, 0xB5, 0x06, 0xE1, 0xAC, 0xBE, 0xE1, 0xAC,
+	0xB5, 0x06, 0xE1, 0xAC, 0xBF, 0xE1, 0xAC, 0xB5, 0x06, 0xE1, 0xAD, 0x82,
+	0xE1, 0xAC, 0xB5, 0x03, 0x41, 0xCC, 0xA5, 0x03, 0x61, 0xCC, 0xA5, 0x03,
+	0x42, 0xCC, 0x87, 0x03, 0x62, 0xCC, 0x87, 0x03, 0x42, 0xCC, 0xA3, 0x03,
+	0x62, 0xCC, 0xA3, 0x03, 0x42, 0xCC, 0xB1, 0x03, 0x62, 0xCC, 0xB1, 0x05,
+	0x43, 0xCC, 0xA7, 0xCC, 0x81, 0x05, 0x63, 0xCC, 0xA7, 0xCC, 0x81, 0x03,
+	0x44, 0xCC, 0x87, 0x03, 0x64, 0xCC, 0x87, 0x03, 0x44, 0xCC, 0xA3, 0x03,
+	0x64, 0xCC, 0xA3, 0x03, 0x44, 0xCC, 0xB1, 0x03, 0x64, 0xCC, 0xB1, 0x03,
+	0x44, 0xCC, 0xA7, 0x03, 0x64, 0xCC, 0xA7, 0x03, 0x44, 0xCC, 0xAD, 0x03,
+	0x64, 0xCC, 0xAD, 0x05, 0x45, 0xCC, 0x84, 0xCC, 0x80, 0x05, 0x65, 0xCC,
+	0x84, 0xCC, 0x80, 0x05, 0x45, 0xCC, 0x84, 0xCC, 0x81, 0x05, 0x65, 0xCC,
+	0x84, 0xCC, 0x81, 0x03, 0x45, 0xCC, 0xAD, 0x03, 0x65, 0xCC, 0xAD, 0x03,
+	0x45, 0xCC, 0xB0, 0x03, 0x65, 0xCC, 0xB0, 0x05, 0x45, 0xCC, 0xA7, 0xCC,
+	0x86, 0x05, 0x65, 0xCC, 0xA7, 0xCC, 0x86, 0x03, 0x46, 0xCC, 0x87, 0x03,
+	0x66, 0xCC, 0x87, 0x03, 0x47, 0xCC, 0x84, 0x03, 0x67, 0xCC, 0x84, 0x03,
+	0x48, 0xCC, 0x87, 0x03, 0x68, 0xCC, 0x87, 0x03, 0x48, 0xCC, 0xA3, 0x03,
+	0x68, 0xCC, 0xA3, 0x03, 0x48, 0xCC, 0x88, 0x03, 0x68, 0xCC, 0x88, 0x03,
+	0x48, 0xCC, 0xA7, 0x03, 0x68, 0xCC, 0xA7, 0x03, 0x48, 0xCC, 0xAE, 0x03,
+	0x68, 0xCC, 0xAE, 0x03, 0x49, 0xCC, 0xB0, 0x03, 0x69, 0xCC, 0xB0, 0x05,
+	0x49, 0xCC, 0x88, 0xCC, 0x81, 0x05, 0x69, 0xCC, 0x88, 0xCC, 0x81, 0x03,
+	0x4B, 0xCC, 0x81, 0x03, 0x6B, 0xCC, 0x81, 0x03, 0x4B, 0xCC, 0xA3, 0x03,
+	0x6B, 0xCC, 0xA3, 0x03, 0x4B, 0xCC, 0xB1, 0x03, 0x6B, 0xCC, 0xB1, 0x03,
+	0x4C, 0xCC, 0xA3, 0x03, 0x6C, 0xCC, 0xA3, 0x05, 0x4C, 0xCC, 0xA3, 0xCC,
+	0x84, 0x05, 0x6C, 0xCC, 0xA3, 0xCC, 0x84, 0x03, 0x4C, 0xCC, 0xB1, 0x03,
+	0x6C, 0xCC, 0xB1, 0x03, 0x4C, 0xCC, 0xAD, 0x03, 0x6C, 0xCC, 0xAD, 0x03,
+	0x4D, 0xCC, 0x81, 0x03, 0x6D, 0xCC, 0x81, 0x03, 0x4D, 0xCC, 0x87, 0x03,
+	0x6D, 0xCC, 0x87, 0x03, 0x4D, 0xCC, 0xA3, 0x03, 0x6D, 0xCC, 0xA3, 0x03,
+	0x4E, 0xCC, 0x87, 0x03, 0x6E, 0xCC, 0x87, 0x03, 0x4E, 0xCC, 0xA3, 0x03,
+	0x6E, 0xCC, 0xA3, 0x03, 0x4E, 0xCC, 0xB1, 0x03, 0x6E, 0xCC, 0xB1, 0x03,
+	0x4E, 0xCC, 0xAD, 0x03, 0x6E, 0xCC, 0xAD, 0x05, 0x4F, 0xCC, 0x83, 0xCC,
+	0x81, 0x05, 0x6F, 0xCC, 0x83, 0xCC, 0x81, 0x05, 0x4F, 0xCC, 0x83, 0xCC,
+	0x88, 0x05, 0x6F, 0xCC, 0x83, 0xCC, 0x88, 0x05, 0x4F, 0xCC, 0x84, 0xCC,
+	0x80, 0x05, 0x6F, 0xCC, 0x84, 0xCC, 0x80, 0x05, 0x4F, 0xCC, 0x84, 0xCC,
+	0x81, 0x05, 0x6F, 0xCC, 0x84, 0xCC, 0x81, 0x03, 0x50, 0xCC, 0x81, 0x03,
+	0x70, 0xCC, 0x81, 0x03, 0x50, 0xCC, 0x87, 0x03, 0x70, 0xCC, 0x87, 0x03,
+	0x52, 0xCC, 0x87, 0x03, 0x72, 0xCC, 0x87, 0x03, 0x52, 0xCC, 0xA3, 0x03,
+	0x72, 0xCC, 0xA3, 0x05, 0x52, 0xCC, 0xA3, 0xCC, 0x84, 0x05, 0x72, 0xCC,
+	0xA3, 0xCC, 0x84, 0x03, 0x52, 0xCC, 0xB1, 0x03, 0x72, 0xCC, 0xB1, 0x03,
+	0x53, 0xCC, 0x87, 0x03, 0x73, 0xCC, 0x87, 0x03, 0x53, 0xCC, 0xA3, 0x03,
+	0x73, 0xCC, 0xA3, 0x05, 0x53, 0xCC, 0x81, 0xCC, 0x87, 0x05, 0x73, 0xCC,
+	0x81, 0xCC, 0x87, 0x05, 0x53, 0xCC, 0x8C, 0xCC, 0x87, 0x05, 0x73, 0xCC,
+	0x8C, 0xCC, 0x87, 0x05, 0x53, 0xCC, 0xA3, 0xCC, 0x87, 0x05, 0x73, 0xCC,
+	0xA3, 0xCC, 0x87, 0x03, 0x54, 0xCC, 0x87, 0x03, 0x74, 0xCC, 0x87, 0x03,
+	0x54, 0xCC, 0xA3, 0x03, 0x74, 0xCC, 0xA3, 0x03, 0x54, 0xCC, 0xB1, 0x03,
+	0x74, 0xCC, 0xB1, 0x03, 0x54, 0xCC, 0xAD, 0x03, 0x74, 0xCC, 0xAD, 0x03,
+	0x55, 0xCC, 0xA4, 0x03, 0x75, 0xCC, 0xA4, 0x03, 0x55, 0xCC, 0xB0, 0x03,
+	0x75, 0xCC, 0xB0, 0x03, 0x55, 0xCC, 0xAD, 0x03, 0x75, 0xCC, 0xAD, 0x05,
+	0x55, 0xCC, 0x83, 0xCC, 0x81, 0x05, 0x75, 0xCC, 0x83, 0xCC, 0x81, 0x05,
+	0x55, 0xCC, 0x84, 0xCC, 0x88, 0x05, 0x75, 0xCC, 0x84, 0xCC, 0x88, 0x03,
+	0x56, 0xCC, 0x83, 0x03, 0x76, 0xCC, 0x83, 0x03, 0x56, 0xCC, 0xA3, 0x03,
+	0x76, 0xCC, 0xA3, 0x03, 0x57, 0xCC, 0x80, 0x03, 0x77, 0xCC, 0x80, 0x03,
+	0x57, 0xCC, 0x81, 0x03, 0x77, 0xCC, 0x81, 0x03, 0x57, 0xCC, 0x88, 0x03,
+	0x77, 0xCC, 0x88, 0x03, 0x57, 0xCC, 0x87, 0x03, 0x77, 0xCC, 0x87, 0x03,
+	0x57, 0xCC, 0xA3, 0x03, 0x77, 0xCC, 0xA3, 0x03, 0x58, 0xCC, 0x87, 0x03,
+	0x78, 0xCC, 0x87, 0x03, 0x58, 0xCC, 0x88, 0x03, 0x78, 0xCC, 0x88, 0x03,
+	0x59, 0xCC, 0x87, 0x03, 0x79, 0xCC, 0x87, 0x03, 0x5A, 0xCC, 0x82, 0x03,
+	0x7A, 0xCC, 0x82, 0x03, 0x5A, 0xCC, 0xA3, 0x03, 0x7A, 0xCC, 0xA3, 0x03,
+	0x5A, 0xCC, 0xB1, 0x03, 0x7A, 0xCC, 0xB1, 0x03, 0x68, 0xCC, 0xB1, 0x03,
+	0x74, 0xCC, 0x88, 0x03, 0x77, 0xCC, 0x8A, 0x03, 0x79, 0xCC, 0x8A, 0x04,
+	0xC5, 0xBF, 0xCC, 0x87, 0x03, 0x41, 0xCC, 0xA3, 0x03, 0x61, 0xCC, 0xA3,
+	0x03, 0x41, 0xCC, 0x89, 0x03, 0x61, 0xCC, 0x89, 0x05, 0x41, 0xCC, 0x82,
+	0xCC, 0x81, 0x05, 0x61, 0xCC, 0x82, 0xCC, 0x81, 0x05, 0x41, 0xCC, 0x82,
+	0xCC, 0x80, 0x05, 0x61, 0xCC, 0x82, 0xCC, 0x80, 0x05, 0x41, 0xCC, 0x82,
+	0xCC, 0x89, 0x05, 0x61, 0xCC, 0x82, 0xCC, 0x89, 0x05, 0x41, 0xCC, 0x82,
+	0xCC, 0x83, 0x05, 0x61, 0xCC, 0x82, 0xCC, 0x83, 0x05, 0x41, 0xCC, 0xA3,
+	0xCC, 0x82, 0x05, 0x61, 0xCC, 0xA3, 0xCC, 0x82, 0x05, 0x41, 0xCC, 0x86,
+	0xCC, 0x81, 0x05, 0x61, 0xCC, 0x86, 0xCC, 0x81, 0x05, 0x41, 0xCC, 0x86,
+	0xCC, 0x80, 0x05, 0x61, 0xCC, 0x86, 0xCC, 0x80, 0x05, 0x41, 0xCC, 0x86,
+	0xCC, 0x89, 0x05, 0x61, 0xCC, 0x86, 0xCC, 0x89, 0x05, 0x41, 0xCC, 0x86,
+	0xCC, 0x83, 0x05, 0x61, 0xCC, 0x86, 0xCC, 0x83, 0x05, 0x41, 0xCC, 0xA3,
+	0xCC, 0x86, 0x05, 0x61, 0xCC, 0xA3, 0xCC, 0x86, 0x03, 0x45, 0xCC, 0xA3,
+	0x03, 0x65, 0xCC, 0xA3, 0x03, 0x45, 0xCC, 0x89, 0x03, 0x65, 0xCC, 0x89,
+	0x03, 0x45, 0xCC, 0x83, 0x03, 0x65, 0xCC, 0x83, 0x05, 0x45, 0xCC, 0x82,
+	0xCC, 0x81, 0x05, 0x65, 0xCC, 0x82, 0xCC, 0x81, 0x05, 0x45, 0xCC, 0x82,
+	0xCC, 0x80, 0x05, 0x65, 0xCC, 0x82, 0xCC, 0x80, 0x05, 0x45, 0xCC, 0x82,
+	0xCC, 0x89, 0x05, 0x65, 0xCC, 0x82, 0xCC, 0x89, 0x05, 0x45, 0xCC, 0x82,
+	0xCC, 0x83, 0x05, 0x65, 0xCC, 0x82, 0xCC, 0x83, 0x05, 0x45, 0xCC, 0xA3,
+	0xCC, 0x82, 0x05, 0x65, 0xCC, 0xA3, 0xCC, 0x82, 0x03, 0x49, 0xCC, 0x89,
+	0x03, 0x69, 0xCC, 0x89, 0x03, 0x49, 0xCC, 0xA3, 0x03, 0x69, 0xCC, 0xA3,
+	0x03, 0x4F, 0xCC, 0xA3, 0x03, 0x6F, 0xCC, 0xA3, 0x03, 0x4F, 0xCC, 0x89,
+	0x03, 0x6F, 0xCC, 0x89, 0x05, 0x4F, 0xCC, 0x82, 0xCC, 0x81, 0x05, 0x6F,
+	0xCC, 0x82, 0xCC, 0x81, 0x05, 0x4F, 0xCC, 0x82, 0xCC, 0x80, 0x05, 0x6F,
+	0xCC, 0x82, 0xCC, 0x80, 0x05, 0x4F, 0xCC, 0x82, 0xCC, 0x89, 0x05, 0x6F,
+	0xCC, 0x82, 0xCC, 0x89, 0x05, 0x4F, 0xCC, 0x82, 0xCC, 0x83, 0x05, 0x6F,
+	0xCC, 0x82, 0xCC, 0x83, 0x05, 0x4F, 0xCC, 0xA3, 0xCC, 0x82, 0x05, 0x6F,
+	0xCC, 0xA3, 0xCC, 0x82, 0x05, 0x4F, 0xCC, 0x9B, 0xCC, 0x81, 0x05, 0x6F,
+	0xCC, 0x9B, 0xCC, 0x81, 0x05, 0x4F, 0xCC, 0x9B, 0xCC, 0x80, 0x05, 0x6F,
+	0xCC, 0x9B, 0xCC, 0x80, 0x05, 0x4F, 0xCC, 0x9B, 0xCC, 0x89, 0x05, 0x6F,
+	0xCC, 0x9B, 0xCC, 0x89, 0x05, 0x4F, 0xCC, 0x9B, 0xCC, 0x83, 0x05, 0x6F,
+	0xCC, 0x9B, 0xCC, 0x83, 0x05, 0x4F, 0xCC, 0x9B, 0xCC, 0xA3, 0x05, 0x6F,
+	0xCC, 0x9B, 0xCC, 0xA3, 0x03, 0x55, 0xCC, 0xA3, 0x03, 0x75, 0xCC, 0xA3,
+	0x03, 0x55, 0xCC, 0x89, 0x03, 0x75, 0xCC, 0x89, 0x05, 0x55, 0xCC, 0x9B,
+	0xCC, 0x81, 0x05, 0x75, 0xCC, 0x9B, 0xCC, 0x81, 0x05, 0x55, 0xCC, 0x9B,
+	0xCC, 0x80, 0x05, 0x75, 0xCC, 0x9B, 0xCC, 0x80, 0x05, 0x55, 0xCC, 0x9B,
+	0xCC, 0x89, 0x05, 0x75, 0xCC, 0x9B, 0xCC, 0x89, 0x05, 0x55, 0xCC, 0x9B,
+	0xCC, 0x83, 0x05, 0x75, 0xCC, 0x9B, 0xCC, 0x83, 0x05, 0x55, 0xCC, 0x9B,
+	0xCC, 0xA3, 0x05, 0x75, 0xCC, 0x9B, 0xCC, 0xA3, 0x03, 0x59, 0xCC, 0x80,
+	0x03, 0x79, 0xCC, 0x80, 0x03, 0x59, 0xCC, 0xA3, 0x03, 0x79, 0xCC, 0xA3,
+	0x03, 0x59, 0xCC, 0x89, 0x03, 0x79, 0xCC, 0x89, 0x03, 0x59, 0xCC, 0x83,
+	0x03, 0x79, 0xCC, 0x83, 0x04, 0xCE, 0xB1, 0xCC, 0x93, 0x04, 0xCE, 0xB1,
+	0xCC, 0x94, 0x06, 0xCE, 0xB1, 0xCC, 0x93, 0xCC, 0x80, 0x06, 0xCE, 0xB1,
+	0xCC, 0x94, 0xCC, 0x80, 0x06, 0xCE, 0xB1, 0xCC, 0x93, 0xCC, 0x81, 0x06,
+	0xCE, 0xB1, 0xCC, 0x94, 0xCC, 0x81, 0x06, 0xCE, 0xB1, 0xCC, 0x93, 0xCD,
+	0x82, 0x06, 0xCE, 0xB1, 0xCC, 0x94, 0xCD, 0x82, 0x04, 0xCE, 0x91, 0xCC,
+	0x93, 0x04, 0xCE, 0x91, 0xCC, 0x94, 0x06, 0xCE, 0x91, 0xCC, 0x93, 0xCC,
+	0x80, 0x06, 0xCE, 0x91, 0xCC, 0x94, 0xCC, 0x80, 0x06, 0xCE, 0x91, 0xCC,
+	0x93, 0xCC, 0x81, 0x06, 0xCE, 0x91, 0xCC, 0x94, 0xCC, 0x81, 0x06, 0xCE,
+	0x91, 0xCC, 0x93, 0xCD, 0x82, 0x06, 0xCE, 0x91, 0xCC, 0x94, 0xCD, 0x82,
+	0x04, 0xCE, 0xB5, 0xCC, 0x93, 0x04, 0xCE, 0xB5, 0xCC, 0x94, 0x06, 0xCE,
+	0xB5, 0xCC, 0x93, 0xCC, 0x80, 0x06, 0xCE, 0xB5, 0xCC, 0x94, 0xCC, 0x80,
+	0x06, 0xCE, 0xB5, 0xCC, 0x93, 0xCC, 0x81, 0x06, 0xCE, 0xB5, 0xCC, 0x94,
+	0xCC, 0x81, 0x04, 0xCE, 0x95, 0xCC, 0x93, 0x04, 0xCE, 0x95, 0xCC, 0x94,
+	0x06, 0xCE, 0x95, 0xCC, 0x93, 0xCC, 0x80, 0x06, 0xCE, 0x95, 0xCC, 0x94,
+	0xCC, 0x80, 0x06, 0xCE, 0x95, 0xCC, 0x93, 0xCC, 0x81, 0x06, 0xCE, 0x95,
+	0xCC, 0x94, 0xCC, 0x81, 0x04, 0xCE, 0xB7, 0xCC, 0x93, 0x04, 0xCE, 0xB7,
+	0xCC, 0x94, 0x06, 0xCE, 0xB7, 0xCC, 0x93, 0xCC, 0x80, 0x06, 0xCE, 0xB7,
+	0xCC, 0x94, 0xCC, 0x80, 0x06, 0xCE, 0xB7, 0xCC, 0x93, 0xCC, 0x81, 0x06,
+	0xCE, 0xB7, 0xCC, 0x94, 0xCC, 0x81, 0x06, 0xCE, 0xB7, 0xCC, 0x93, 0xCD,
+	0x82, 0x06, 0xCE, 0xB7, 0xCC, 0x94, 0xCD, 0x82, 0x04, 0xCE, 0x97, 0xCC,
+	0x93, 0x04, 0xCE, 0x97, 0xCC, 0x94, 0x06, 0xCE, 0x97, 0xCC, 0x93, 0xCC,
+	0x80, 0x06, 0xCE, 0x97, 0xCC, 0x94, 0xCC, 0x80, 0x06, 0xCE, 0x97, 0xCC,
+	0x93, 0xCC, 0x81, 0x06, 0xCE, 0x97, 0xCC, 0x94, 0xCC, 0x81, 0x06, 0xCE,
+	0x97, 0xCC, 0x93, 0xCD, 0x82, 0x06, 0xCE, 0x97, 0xCC, 0x94, 0xCD, 0x82,
+	0x04, 0xCE, 0xB9, 0xCC, 0x93, 0x04, 0xCE, 0xB9, 0xCC, 0x94, 0x06, 0xCE,
+	0xB9, 0xCC, 0x93, 0xCC, 0x80, 0x06, 0xCE, 0xB9, 0xCC, 0x94, 0xCC, 0x80,
+	0x06, 0xCE, 0xB9, 0xCC, 0x93, 0xCC, 0x81, 0x06, 0xCE, 0xB9, 0xCC, 0x94,
+	0xCC, 0x81, 0x06, 0xCE, 0xB9, 0xCC, 0x93, 0xCD, 0x82, 0x06, 0xCE, 0xB9,
+	0xCC, 0x94, 0xCD, 0x82, 0x04, 0xCE, 0x99, 0xCC, 0x93, 0x04, 0xCE, 0x99,
+	0xCC, 0x94, 0x06, 0xCE, 0x99, 0xCC, 0x93, 0xCC, 0x80, 0x06, 0xCE, 0x99,
+	0xCC, 0x94, 0xCC, 0x80, 0x06, 0xCE, 0x99, 0xCC, 0x93, 0xCC, 0x81, 0x06,
+	0xCE, 0x99, 0xCC, 0x94, 0xCC, 0x81, 0x06, 0xCE, 0x99, 0xCC, 0x93, 0xCD,
+	0x82, 0x06, 0xCE, 0x99, 0xCC, 0x94, 0xCD, 0x82, 0x04, 0xCE, 0xBF, 0xCC,
+	0x93, 0x04, 0xCE, 0xBF, 0xCC, 0x94, 0x06, 0xCE, 0xBF, 0xCC, 0x93, 0xCC,
+	0x80, 0x06, 0xCE, 0xBF, 0xCC, 0x94, 0xCC, 0x80, 0x06, 0xCE, 0xBF, 0xCC,
+	0x93, 0xCC, 0x81, 0x06, 0xCE, 0xBF, 0xCC, 0x94, 0xCC, 0x81, 0x04, 0xCE,
+	0x9F, 0xCC, 0x93, 0x04, 0xCE, 0x9F, 0xCC, 0x94, 0x06, 0xCE, 0x9F, 0xCC,
+	0x93, 0xCC, 0x80, 0x06, 0xCE, 0x9F, 0xCC, 0x94, 0xCC, 0x80, 0x06, 0xCE,
+	0x9F, 0xCC, 0x93, 0xCC, 0x81, 0x06, 0xCE, 0x9F, 0xCC, 0x94, 0xCC, 0x81,
+	0x04, 0xCF, 0x85, 0xCC, 0x93, 0x04, 0xCF, 0x85, 0xCC, 0x94, 0x06, 0xCF,
+	0x85, 0xCC, 0x93, 0xCC, 0x80, 0x06, 0xCF, 0x85, 0xCC, 0x94, 0xCC, 0x80,
+	0x06, 0xCF, 0x85, 0xCC, 0x93, 0xCC, 0x81, 0x06, 0xCF, 0x85, 0xCC, 0x94,
+	0xCC, 0x81, 0x06, 0xCF, 0x85, 0xCC, 0x93, 0xCD, 0x82, 0x06, 0xCF, 0x85,
+	0xCC, 0x94, 0xCD, 0x82, 0x04, 0xCE, 0xA5, 0xCC, 0x94, 0x06, 0xCE, 0xA5,
+	0xCC, 0x94, 0xCC, 0x80, 0x06, 0xCE, 0xA5, 0xCC, 0x94, 0xCC, 0x81, 0x06,
+	0xCE, 0xA5, 0xCC, 0x94, 0xCD, 0x82, 0x04, 0xCF, 0x89, 0xCC, 0x93, 0x04,
+	0xCF, 0x89, 0xCC, 0x94, 0x06, 0xCF, 0x89, 0xCC, 0x93, 0xCC, 0x80, 0x06,
+	0xCF, 0x89, 0xCC, 0x94, 0xCC, 0x80, 0x06, 0xCF, 0x89, 0xCC, 0x93, 0xCC,
+	0x81, 0x06, 0xCF, 0x89, 0xCC, 0x94, 0xCC, 0x81, 0x06, 0xCF, 0x89, 0xCC,
+	0x93, 0xCD, 0x82, 0x06, 0xCF, 0x89, 0xCC, 0x94, 0xCD, 0x82, 0x04, 0xCE,
+	0xA9, 0xCC, 0x93, 0x04, 0xCE, 0xA9, 0xCC, 0x94, 0x06, 0xCE, 0xA9, 0xCC,
+	0x93, 0xCC, 0x80, 0x06, 0xCE, 0xA9, 0xCC, 0x94, 0xCC, 0x80, 0x06, 0xCE,
+	0xA9, 0xCC, 0x93, 0xCC, 0x81, 0x06, 0xCE, 0xA9, 0xCC, 0x94, 0xCC, 0x81,
+	0x06, 0xCE, 0xA9, 0xCC, 0x93, 0xCD, 0x82, 0x06, 0xCE, 0xA9, 0xCC, 0x94,
+	0xCD, 0x82, 0x04, 0xCE, 0xB1, 0xCC, 0x80, 0x04, 0xCE, 0xB1, 0xCC, 0x81,
+	0x04, 0xCE, 0xB5, 0xCC, 0x80, 0x04, 0xCE, 0xB5, 0xCC, 0x81, 0x04, 0xCE,
+	0xB7, 0xCC, 0x80, 0x04, 0xCE, 0xB7, 0xCC, 0x81, 0x04, 0xCE, 0xB9, 0xCC,
+	0x80, 0x04, 0xCE, 0xB9, 0xCC, 0x81, 0x04, 0xCE, 0xBF, 0xCC, 0x80, 0x04,
+	0xCE, 0xBF, 0xCC, 0x81, 0x04, 0xCF, 0x85, 0xCC, 0x80, 0x04, 0xCF, 0x85,
+	0xCC, 0x81, 0x04, 0xCF, 0x89, 0xCC, 0x80, 0x04, 0xCF, 0x89, 0xCC, 0x81,
+	0x06, 0xCE, 0xB1, 0xCC, 0x93, 0xCD, 0x85, 0x06, 0xCE, 0xB1, 0xCC, 0x94,
+	0xCD, 0x85, 0x08, 0xCE, 0xB1, 0xCC, 0x93, 0xCC, 0x80, 0xCD, 0x85, 0x08,
+	0xCE, 0xB1, 0xCC, 0x94, 0xCC, 0x80, 0xCD, 0x85, 0x08, 0xCE, 0xB1, 0xCC,
+	0x93, 0xCC, 0x81, 0xCD, 0x85, 0x08, 0xCE, 0xB1, 0xCC, 0x94, 0xCC, 0x81,
+	0xCD, 0x85, 0x08, 0xCE, 0xB1, 0xCC, 0x93, 0xCD, 0x82, 0xCD, 0x85, 0x08,
+	0xCE, 0xB1, 0xCC, 0x94, 0xCD, 0x82, 0xCD, 0x85, 0x06, 0xCE, 0x91, 0xCC,
+	0x93, 0xCD, 0x85, 0x06, 0xCE, 0x91, 0xCC, 0x94, 0xCD, 0x85, 0x08, 0xCE,
+	0x91, 0xCC, 0x93, 0xCC, 0x80, 0xCD, 0x85, 0x08, 0xCE, 0x91, 0xCC, 0x94,
+	0xCC, 0x80, 0xCD, 0x85, 0x08, 0xCE, 0x91, 0xCC, 0x93, 0xCC, 0x81, 0xCD,
+	0x85, 0x08, 0xCE, 0x91, 0xCC, 0x94, 0xCC, 0x81, 0xCD, 0x85, 0x08, 0xCE,
+	0x91, 0xCC, 0x93, 0xCD, 0x82, 0xCD, 0x85, 0x08, 0xCE, 0x91, 0xCC, 0x94,
+	0xCD, 0x82, 0xCD, 0x85, 0x06, 0xCE, 0xB7, 0xCC, 0x93, 0xCD, 0x85, 0x06,
+	0xCE, 0xB7, 0xCC, 0x94, 0xCD, 0x85, 0x08, 0xCE, 0xB7, 0xCC, 0x93, 0xCC,
+	0x80, 0xCD, 0x85, 0x08, 0xCE, 0xB7, 0xCC, 0x94, 0xCC, 0x80, 0xCD, 0x85,
+	0x08, 0xCE, 0xB7, 0xCC, 0x93, 0xCC, 0x81, 0xCD, 0x85, 0x08, 0xCE, 0xB7,
+	0xCC, 0x94, 0xCC, 0x81, 0xCD, 0x85, 0x08, 0xCE, 0xB7, 0xCC, 0x93, 0xCD,
+	0x82, 0xCD, 0x85, 0x08, 0xCE, 0xB7, 0xCC, 0x94, 0xCD, 0x82, 0xCD, 0x85,
+	0x06, 0xCE, 0x97, 0xCC, 0x93, 0xCD, 0x85, 0x06, 0xCE, 0x97, 0xCC, 0x94,
+	0xCD, 0x85, 0x08, 0xCE, 0x97, 0xCC, 0x93, 0xCC, 0x80, 0xCD, 0x85, 0x08,
+	0xCE, 0x97, 0xCC, 0x94, 0xCC, 0x80, 0xCD, 0x85, 0x08, 0xCE, 0x97, 0xCC,
+	0x93, 0xCC, 0x81, 0xCD, 0x85, 0x08, 0xCE, 0x97, 0xCC, 0x94, 0xCC, 0x81,
+	0xCD, 0x85, 0x08, 0xCE, 0x97, 0xCC, 0x93, 0xCD, 0x82, 0xCD, 0x85, 0x08,
+	0xCE, 0x97, 0xCC, 0x94, 0xCD, 0x82, 0xCD, 0x85, 0x06, 0xCF, 0x89, 0xCC,
+	0x93, 0xCD, 0x85, 0x06, 0xCF, 0x89, 0xCC, 0x94, 0xCD, 0x85, 0x08, 0xCF,
+	0x89, 0xCC, 0x93, 0xCC, 0x80, 0xCD, 0x85, 0x08, 0xCF, 0x89, 0xCC, 0x94,
+	0xCC, 0x80, 0xCD, 0x85, 0x08, 0xCF, 0x89, 0xCC, 0x93, 0xCC, 0x81, 0xCD,
+	0x85, 0x08, 0xCF, 0x89, 0xCC, 0x94, 0xCC, 0x81, 0xCD, 0x85, 0x08, 0xCF,
+	0x89, 0xCC, 0x93, 0xCD, 0x82, 0xCD, 0x85, 0x08, 0xCF, 0x89, 0xCC, 0x94,
+	0xCD, 0x82, 0xCD, 0x85, 0x06, 0xCE, 0xA9, 0xCC, 0x93, 0xCD, 0x85, 0x06,
+	0xCE, 0xA9, 0xCC, 0x94, 0xCD, 0x85, 0x08, 0xCE, 0xA9, 0xCC, 0x93, 0xCC,
+	0x80, 0xCD, 0x85, 0x08, 0xCE, 0xA9, 0xCC, 0x94, 0xCC, 0x80, 0xCD, 0x85,
+	0x08, 0xCE, 0xA9, 0xCC, 0x93, 0xCC, 0x81, 0xCD, 0x85, 0x08, 0xCE, 0xA9,
+	0xCC, 0x94, 0xCC, 0x81, 0xCD, 0x85, 0x08, 0xCE, 0xA9, 0xCC, 0x93, 0xCD,
+	0x82, 0xCD, 0x85, 0x08, 0xCE, 0xA9, 0xCC, 0x94, 0xCD, 0x82, 0xCD, 0x85,
+	0x04, 0xCE, 0xB1, 0xCC, 0x86, 0x04, 0xCE, 0xB1, 0xCC, 0x84, 0x06, 0xCE,
+	0xB1, 0xCC, 0x80, 0xCD, 0x85, 0x04, 0xCE, 0xB1, 0xCD, 0x85, 0x06, 0xCE,
+	0xB1, 0xCC, 0x81, 0xCD, 0x85, 0x04, 0xCE, 0xB1, 0xCD, 0x82, 0x06, 0xCE,
+	0xB1, 0xCD, 0x82, 0xCD, 0x85, 0x04, 0xCE, 0x91, 0xCC, 0x86, 0x04, 0xCE,
+	0x91, 0xCC, 0x84, 0x04, 0xCE, 0x91, 0xCC, 0x80, 0x04, 0xCE, 0x91, 0xCC,
+	0x81, 0x04, 0xCE, 0x91, 0xCD, 0x85, 0x02, 0xCE, 0xB9, 0x04, 0xC2, 0xA8,
+	0xCD, 0x82, 0x06, 0xCE, 0xB7, 0xCC, 0x80, 0xCD, 0x85, 0x04, 0xCE, 0xB7,
+	0xCD, 0x85, 0x06, 0xCE, 0xB7, 0xCC, 0x81, 0xCD, 0x85, 0x04, 0xCE, 0xB7,
+	0xCD, 0x82, 0x06, 0xCE, 0xB7, 0xCD, 0x82, 0xCD, 0x85, 0x04, 0xCE, 0x95,
+	0xCC, 0x80, 0x04, 0xCE, 0x95, 0xCC, 0x81, 0x04, 0xCE, 0x97, 0xCC, 0x80,
+	0x04, 0xCE, 0x97, 0xCC, 0x81, 0x04, 0xCE, 0x97, 0xCD, 0x85, 0x05, 0xE1,
+	0xBE, 0xBF, 0xCC, 0x80, 0x05, 0xE1, 0xBE, 0xBF, 0xCC, 0x81, 0x05, 0xE1,
+	0xBE, 0xBF, 0xCD, 0x82, 0x04, 0xCE, 0xB9, 0xCC, 0x86, 0x04, 0xCE, 0xB9,
+	0xCC, 0x84, 0x06, 0xCE, 0xB9, 0xCC, 0x88, 0xCC, 0x80, 0x06, 0xCE, 0xB9,
+	0xCC, 0x88, 0xCC, 0x81, 0x04, 0xCE, 0xB9, 0xCD, 0x82, 0x06, 0xCE, 0xB9,
+	0xCC, 0x88, 0xCD, 0x82, 0x04, 0xCE, 0x99, 0xCC, 0x86, 0x04, 0xCE, 0x99,
+	0xCC, 0x84, 0x04, 0xCE, 0x99, 0xCC, 0x80, 0x04, 0xCE, 0x99, 0xCC, 0x81,
+	0x05, 0xE1, 0xBF, 0xBE, 0xCC, 0x80, 0x05, 0xE1, 0xBF, 0xBE, 0xCC, 0x81,
+	0x05, 0xE1, 0xBF, 0xBE, 0xCD, 0x82, 0x04, 0xCF, 0x85, 0xCC, 0x86, 0x04,
+	0xCF, 0x85, 0xCC, 0x84, 0x06, 0xCF, 0x85, 0xCC, 0x88, 0xCC, 0x80, 0x06,
+	0xCF, 0x85, 0xCC, 0x88, 0xCC, 0x81, 0x04, 0xCF, 0x81, 0xCC, 0x93, 0x04,
+	0xCF, 0x81, 0xCC, 0x94, 0x04, 0xCF, 0x85, 0xCD, 0x82, 0x06, 0xCF, 0x85,
+	0xCC, 0x88, 0xCD, 0x82, 0x04, 0xCE, 0xA5, 0xCC, 0x86, 0x04, 0xCE, 0xA5,
+	0xCC, 0x84, 0x04, 0xCE, 0xA5, 0xCC, 0x80, 0x04, 0xCE, 0xA5, 0xCC, 0x81,
+	0x04, 0xCE, 0xA1, 0xCC, 0x94, 0x04, 0xC2, 0xA8, 0xCC, 0x80, 0x04, 0xC2,
+	0xA8, 0xCC, 0x81, 0x01, 0x60, 0x06, 0xCF, 0x89, 0xCC, 0x80, 0xCD, 0x85,
+	0x04, 0xCF, 0x89, 0xCD, 0x85, 0x06, 0xCF, 0x89, 0xCC, 0x81, 0xCD, 0x85,
+	0x04, 0xCF, 0x89, 0xCD, 0x82, 0x06, 0xCF, 0x89, 0xCD, 0x82, 0xCD, 0x85,
+	0x04, 0xCE, 0x9F, 0xCC, 0x80, 0x04, 0xCE, 0x9F, 0xCC, 0x81, 0x04, 0xCE,
+	0xA9, 0xCC, 0x80, 0x04, 0xCE, 0xA9, 0xCC, 0x81, 0x04, 0xCE, 0xA9, 0xCD,
+	0x85, 0x02, 0xC2, 0xB4, 0x03, 0xE2, 0x80, 0x82, 0x03, 0xE2, 0x80, 0x83,
+	0x02, 0xCE, 0xA9, 0x01, 0x4B, 0x03, 0x41, 0xCC, 0x8A, 0x05, 0xE2, 0x86,
+	0x90, 0xCC, 0xB8, 0x05, 0xE2, 0x86, 0x92, 0xCC, 0xB8, 0x05, 0xE2, 0x86,
+	0x94, 0xCC, 0xB8, 0x05, 0xE2, 0x87, 0x90, 0xCC, 0xB8, 0x05, 0xE2, 0x87,
+	0x94, 0xCC, 0xB8, 0x05, 0xE2, 0x87, 0x92, 0xCC, 0xB8, 0x05, 0xE2, 0x88,
+	0x83, 0xCC, 0xB8, 0x05, 0xE2, 0x88, 0x88, 0xCC, 0xB8, 0x05, 0xE2, 0x88,
+	0x8B, 0xCC, 0xB8, 0x05, 0xE2, 0x88, 0xA3, 0xCC, 0xB8, 0x05, 0xE2, 0x88,
+	0xA5, 0xCC, 0xB8, 0x05, 0xE2, 0x88, 0xBC, 0xCC, 0xB8, 0x05, 0xE2, 0x89,
+	0x83, 0xCC, 0xB8, 0x05, 0xE2, 0x89, 0x85, 0xCC, 0xB8, 0x05, 0xE2, 0x89,
+	0x88, 0xCC, 0xB8, 0x03, 0x3D, 0xCC, 0xB8, 0x05, 0xE2, 0x89, 0xA1, 0xCC,
+	0xB8, 0x05, 0xE2, 0x89, 0x8D, 0xCC, 0xB8, 0x03, 0x3C, 0xCC, 0xB8, 0x03,
+	0x3E, 0xCC, 0xB8, 0x05, 0xE2, 0x89, 0xA4, 0xCC, 0xB8, 0x05, 0xE2, 0x89,
+	0xA5, 0xCC, 0xB8, 0x05, 0xE2, 0x89, 0xB2, 0xCC, 0xB8, 0x05, 0xE2, 0x89,
+	0xB3, 0xCC, 0xB8, 0x05, 0xE2, 0x89, 0xB6, 0xCC, 0xB8, 0x05, 0xE2, 0x89,
+	0xB7, 0xCC, 0xB8, 0x05, 0xE2, 0x89, 0xBA, 0xCC, 0xB8, 0x05, 0xE2, 0x89,
+	0xBB, 0xCC, 0xB8, 0x05, 0xE2, 0x8A, 0x82, 0xCC, 0xB8, 0x05, 0xE2, 0x8A,
+	0x83, 0xCC, 0xB8, 0x05, 0xE2, 0x8A, 0x86, 0xCC, 0xB8, 0x05, 0xE2, 0x8A,
+	0x87, 0xCC, 0xB8, 0x05, 0xE2, 0x8A, 0xA2, 0xCC, 0xB8, 0x05, 0xE2, 0x8A,
+	0xA8, 0xCC, 0xB8, 0x05, 0xE2, 0x8A, 0xA9, 0xCC, 0xB8, 0x05, 0xE2, 0x8A,
+	0xAB, 0xCC, 0xB8, 0x05, 0xE2, 0x89, 0xBC, 0xCC, 0xB8, 0x05, 0xE2, 0x89,
+	0xBD, 0xCC, 0xB8, 0x05, 0xE2, 0x8A, 0x91, 0xCC, 0xB8, 0x05, 0xE2, 0x8A,
+	0x92, 0xCC, 0xB8, 0x05, 0xE2, 0x8A, 0xB2, 0xCC, 0xB8, 0x05, 0xE2, 0x8A,
+	0xB3, 0xCC, 0xB8, 0x05, 0xE2, 0x8A, 0xB4, 0xCC, 0xB8, 0x05, 0xE2, 0x8A,
+	0xB5, 0xCC, 0xB8, 0x03, 0xE3, 0x80, 0x88, 0x03, 0xE3, 0x80, 0x89, 0x05,
+	0xE2, 0xAB, 0x9D, 0xCC, 0xB8, 0x06, 0xE3, 0x81, 0x8B, 0xE3, 0x82, 0x99,
+	0x06, 0xE3, 0x81, 0x8D, 0xE3, 0x82, 0x99, 0x06, 0xE3, 0x81, 0x8F, 0xE3,
+	0x82, 0x99, 0x06, 0xE3, 0x81, 0x91, 0xE3, 0x82, 0x99, 0x06, 0xE3, 0x81,
+	0x93, 0xE3, 0x82, 0x99, 0x06, 0xE3, 0x81, 0x95, 0xE3, 0x82, 0x99, 0x06,
+	0xE3, 0x81, 0x97, 0xE3, 0x82, 0x99, 0x06, 0xE3, 0x81, 0x99, 0xE3, 0x82,
+	0x99, 0x06, 0xE3, 0x81, 0x9B, 0xE3, 0x82, 0x99, 0x06, 0xE3, 0x81, 0x9D,
+	0xE3, 0x82, 0x99, 0x06, 0xE3, 0x81, 0x9F, 0xE3, 0x82, 0x99, 0x06, 0xE3,
+	0x81, 0xA1, 0xE3, 0x82, 0x99, 0x06, 0xE3, 0x81, 0xA4, 0xE3, 0x82, 0x99,
+	0x06, 0xE3, 0x81, 0xA6, 0xE3, 0x82, 0x99, 0x06, 0xE3, 0x81, 0xA8, 0xE3,
+	0x82, 0x99, 0x06, 0xE3, 0x81, 0xAF, 0xE3, 0x82, 0x99, 0x06, 0xE3, 0x81,
+	0xAF, 0xE3, 0x82, 0x9A, 0x06, 0xE3, 0x81, 0xB2, 0xE3, 0x82, 0x99, 0x06,
+	0xE3, 0x81, 0xB2, 0xE3, 0x82, 0x9A, 0x06, 0xE3, 0x81, 0xB5, 0xE3, 0x82,
+	0x99, 0x06, 0xE3, 0x81, 0xB5, 0xE3, 0x82, 0x9A, 0x06, 0xE3, 0x81, 0xB8,
+	0xE3, 0x82, 0x99, 0x06, 0xE3, 0x81, 0xB8, 0xE3, 0x82, 0x9A, 0x06, 0xE3,
+	0x81, 0xBB, 0xE3, 0x82, 0x99, 0x06, 0xE3, 0x81, 0xBB, 0xE3, 0x82, 0x9A,
+	0x06, 0xE3, 0x81, 0x86, 0xE3, 0x82, 0x99, 0x06, 0xE3, 0x82, 0x9D, 0xE3,
+	0x82, 0x99, 0x06, 0xE3, 0x82, 0xAB, 0xE3, 0x82, 0x99, 0x06, 0xE3, 0x82,
+	0xAD, 0xE3, 0x82, 0x99, 0x06, 0xE3, 0x82, 0xAF, 0xE3, 0x82, 0x99, 0x06,
+	0xE3, 0x82, 0xB1, 0xE3, 0x82, 0x99, 0x06, 0xE3, 0x82, 0xB3, 0xE3, 0x82,
+	0x99, 0x06, 0xE3, 0x82, 0xB5, 0xE3, 0x82, 0x99, 0x06, 0xE3, 0x82, 0xB7,
+	0xE3, 0x82, 0x99, 0x06, 0xE3, 0x82, 0xB9, 0xE3, 0x82, 0x99, 0x06, 0xE3,
+	0x82, 0xBB, 0xE3, 0x82, 0x99, 0x06, 0xE3, 0x82, 0xBD, 0xE3, 0x82, 0x99,
+	0x06, 0xE3, 0x82, 0xBF, 0xE3, 0x82, 0x99, 0x06, 0xE3, 0x83, 0x81, 0xE3,
+	0x82, 0x99, 0x06, 0xE3, 0x83, 0x84, 0xE3, 0x82, 0x99, 0x06, 0xE3, 0x83,
+	0x86, 0xE3, 0x82, 0x99, 0x06, 0xE3, 0x83, 0x88, 0xE3, 0x82, 0x99, 0x06,
+	0xE3, 0x83, 0x8F, 0xE3, 0x82, 0x99, 0x06, 0xE3, 0x83, 0x8F, 0xE3, 0x82,
+	0x9A, 0x06, 0xE3, 0x83, 0x92, 0xE3, 0x82, 0x99, 0x06, 0xE3, 0x83, 0x92,
+	0xE3, 0x82, 0x9A, 0x06, 0xE3, 0x83, 0x95, 0xE3, 0x82, 0x99, 0x06, 0xE3,
+	0x83, 0x95, 0xE3, 0x82, 0x9A, 0x06, 0xE3, 0x83, 0x98, 0xE3, 0x82, 0x99,
+	0x06, 0xE3, 0x83, 0x98, 0xE3, 0x82, 0x9A, 0x06, 0xE3, 0x83, 0x9B, 0xE3,
+	0x82, 0x99, 0x06, 0xE3, 0x83, 0x9B, 0xE3, 0x82, 0x9A, 0x06, 0xE3, 0x82,
+	0xA6, 0xE3, 0x82, 0x99, 0x06, 0xE3, 0x83, 0xAF, 0xE3, 0x82, 0x99, 0x06,
+	0xE3, 0x83, 0xB0, 0xE3, 0x82, 0x99, 0x06, 0xE3, 0x83, 0xB1, 0xE3, 0x82,
+	0x99, 0x06, 0xE3, 0x83, 0xB2, 0xE3, 0x82, 0x99, 0x06, 0xE3, 0x83, 0xBD,
+	0xE3, 0x82, 0x99, 0x03, 0xE8, 0xB1, 0x88, 0x03, 0xE6, 0x9B, 0xB4, 0x03,
+	0xE8, 0xBB, 0x8A, 0x03, 0xE8, 0xB3, 0x88, 0x03, 0xE6, 0xBB, 0x91, 0x03,
+	0xE4, 0xB8, 0xB2, 0x03, 0xE5, 0x8F, 0xA5, 0x03, 0xE9, 0xBE, 0x9C, 0x03,
+	0xE9, 0xBE, 0x9C, 0x03, 0xE5, 0xA5, 0x91, 0x03, 0xE9, 0x87, 0x91, 0x03,
+	0xE5, 0x96, 0x87, 0x03, 0xE5, 0xA5, 0x88, 0x03, 0xE6, 0x87, 0xB6, 0x03,
+	0xE7, 0x99, 0xA9, 0x03, 0xE7, 0xBE, 0x85, 0x03, 0xE8, 0x98, 0xBF, 0x03,
+	0xE8, 0x9E, 0xBA, 0x03, 0xE8, 0xA3, 0xB8, 0x03, 0xE9, 0x82, 0x8F, 0x03,
+	0xE6, 0xA8, 0x82, 0x03, 0xE6, 0xB4, 0x9B, 0x03, 0xE7, 0x83, 0x99, 0x03,
+	0xE7, 0x8F, 0x9E, 0x03, 0xE8, 0x90, 0xBD, 0x03, 0xE9, 0x85, 0xAA, 0x03,
+	0xE9, 0xA7, 0xB1, 0x03, 0xE4, 0xBA, 0x82, 0x03, 0xE5, 0x8D, 0xB5, 0x03,
+	0xE6, 0xAC, 0x84, 0x03, 0xE7, 0x88, 0x9B, 0x03, 0xE8, 0x98, 0xAD, 0x03,
+	0xE9, 0xB8, 0x9E, 0x03, 0xE5, 0xB5, 0x90, 0x03, 0xE6, 0xBF, 0xAB, 0x03,
+	0xE8, 0x97, 0x8D, 0x03, 0xE8, 0xA5, 0xA4, 0x03, 0xE6, 0x8B, 0x89, 0x03,
+	0xE8, 0x87, 0x98, 0x03, 0xE8, 0xA0, 0x9F, 0x03, 0xE5, 0xBB, 0x8A, 0x03,
+	0xE6, 0x9C, 0x97, 0x03, 0xE6, 0xB5, 0xAA, 0x03, 0xE7, 0x8B, 0xBC, 0x03,
+	0xE9, 0x83, 0x8E, 0x03, 0xE4, 0xBE, 0x86, 0x03, 0xE5, 0x86, 0xB7, 0x03,
+	0xE5, 0x8B, 0x9E, 0x03, 0xE6, 0x93, 0x84, 0x03, 0xE6, 0xAB, 0x93, 0x03,
+	0xE7, 0x88, 0x90, 0x03, 0xE7, 0x9B, 0xA7, 0x03, 0xE8, 0x80, 0x81, 0x03,
+	0xE8, 0x98, 0x86, 0x03, 0xE8, 0x99, 0x9C, 0x03, 0xE8, 0xB7, 0xAF, 0x03,
+	0xE9, 0x9C, 0xB2, 0x03, 0xE9, 0xAD, 0xAF, 0x03, 0xE9, 0xB7, 0xBA, 0x03,
+	0xE7, 0xA2, 0x8C, 0x03, 0xE7, 0xA5, 0xBF, 0x03, 0xE7, 0xB6, 0xA0, 0x03,
+	0xE8, 0x8F, 0x89, 0x03, 0xE9, 0x8C, 0x84, 0x03, 0xE9, 0xB9, 0xBF, 0x03,
+	0xE8, 0xAB, 0x96, 0x03, 0xE5, 0xA3, 0x9F, 0x03, 0xE5, 0xBC, 0x84, 0x03,
+	0xE7, 0xB1, 0xA0, 0x03, 0xE8, 0x81, 0xBE, 0x03, 0xE7, 0x89, 0xA2, 0x03,
+	0xE7, 0xA3, 0x8A, 0x03, 0xE8, 0xB3, 0x82, 0x03, 0xE9, 0x9B, 0xB7, 0x03,
+	0xE5, 0xA3, 0x98, 0x03, 0xE5, 0xB1, 0xA2, 0x03, 0xE6, 0xA8, 0x93, 0x03,
+	0xE6, 0xB7, 0x9A, 0x03, 0xE6, 0xBC, 0x8F, 0x03, 0xE7, 0xB4, 0xAF, 0x03,
+	0xE7, 0xB8, 0xB7, 0x03, 0xE9, 0x99, 0x8B, 0x03, 0xE5, 0x8B, 0x92, 0x03,
+	0xE8, 0x82, 0x8B, 0x03, 0xE5, 0x87, 0x9C, 0x03, 0xE5, 0x87, 0x8C, 0x03,
+	0xE7, 0xA8, 0x9C, 0x03, 0xE7, 0xB6, 0xBE, 0x03, 0xE8, 0x8F, 0xB1, 0x03,
+	0xE9, 0x99, 0xB5, 0x03, 0xE8, 0xAE, 0x80, 0x03, 0xE6, 0x8B, 0x8F, 0x03,
+	0xE6, 0xA8, 0x82, 0x03, 0xE8, 0xAB, 0xBE, 0x03, 0xE4, 0xB8, 0xB9, 0x03,
+	0xE5, 0xAF, 0xA7, 0x03, 0xE6, 0x80, 0x92, 0x03, 0xE7, 0x8E, 0x87, 0x03,
+	0xE7, 0x95, 0xB0, 0x03, 0xE5, 0x8C, 0x97, 0x03, 0xE7, 0xA3, 0xBB, 0x03,
+	0xE4, 0xBE, 0xBF, 0x03, 0xE5, 0xBE, 0xA9, 0x03, 0xE4, 0xB8, 0x8D, 0x03,
+	0xE6, 0xB3, 0x8C, 0x03, 0xE6, 0x95, 0xB8, 0x03, 0xE7, 0xB4, 0xA2, 0x03,
+	0xE5, 0x8F, 0x83, 0x03, 0xE5, 0xA1, 0x9E, 0x03, 0xE7, 0x9C, 0x81, 0x03,
+	0xE8, 0x91, 0x89, 0x03, 0xE8, 0xAA, 0xAA, 0x03, 0xE6, 0xAE, 0xBA, 0x03,
+	0xE8, 0xBE, 0xB0, 0x03, 0xE6, 0xB2, 0x88, 0x03, 0xE6, 0x8B, 0xBE, 0x03,
+	0xE8, 0x8B, 0xA5, 0x03, 0xE6, 0x8E, 0xA0, 0x03, 0xE7, 0x95, 0xA5, 0x03,
+	0xE4, 0xBA, 0xAE, 0x03, 0xE5, 0x85, 0xA9, 0x03, 0xE5, 0x87, 0x89, 0x03,
+	0xE6, 0xA2, 0x81, 0x03, 0xE7, 0xB3, 0xA7, 0x03, 0xE8, 0x89, 0xAF, 0x03,
+	0xE8, 0xAB, 0x92, 0x03, 0xE9, 0x87, 0x8F, 0x03, 0xE5, 0x8B, 0xB5, 0x03,
+	0xE5, 0x91, 0x82, 0x03, 0xE5, 0xA5, 0xB3, 0x03, 0xE5, 0xBB, 0xAC, 0x03,
+	0xE6, 0x97, 0x85, 0x03, 0xE6, 0xBF, 0xBE, 0x03, 0xE7, 0xA4, 0xAA, 0x03,
+	0xE9, 0x96, 0xAD, 0x03, 0xE9, 0xA9, 0xAA, 0x03, 0xE9, 0xBA, 0x97, 0x03,
+	0xE9, 0xBB, 0x8E, 0x03, 0xE5, 0x8A, 0x9B, 0x03, 0xE6, 0x9B, 0x86, 0x03,
+	0xE6, 0xAD, 0xB7, 0x03, 0xE8, 0xBD, 0xA2, 0x03, 0xE5, 0xB9, 0xB4, 0x03,
+	0xE6, 0x86, 0x90, 0x03, 0xE6, 0x88, 0x80, 0x03, 0xE6, 0x92, 0x9A, 0x03,
+	0xE6, 0xBC, 0xA3, 0x03, 0xE7, 0x85, 0x89, 0x03, 0xE7, 0x92, 0x89, 0x03,
+	0xE7, 0xA7, 0x8A, 0x03, 0xE7, 0xB7, 0xB4, 0x03, 0xE8, 0x81, 0xAF, 0x03,
+	0xE8, 0xBC, 0xA6, 0x03, 0xE8, 0x93, 0xAE, 0x03, 0xE9, 0x80, 0xA3, 0x03,
+	0xE9, 0x8D, 0x8A, 0x03, 0xE5, 0x88, 0x97, 0x03, 0xE5, 0x8A, 0xA3, 0x03,
+	0xE5, 0x92, 0xBD, 0x03, 0xE7, 0x83, 0x88, 0x03, 0xE8, 0xA3, 0x82, 0x03,
+	0xE8, 0xAA, 0xAA, 0x03, 0xE5, 0xBB, 0x89, 0x03, 0xE5, 0xBF, 0xB5, 0x03,
+	0xE6, 0x8D, 0xBB, 0x03, 0xE6, 0xAE, 0xAE, 0x03, 0xE7, 0xB0, 0xBE, 0x03,
+	0xE7, 0x8D, 0xB5, 0x03, 0xE4, 0xBB, 0xA4, 0x03, 0xE5, 0x9B, 0xB9, 0x03,
+	0xE5, 0xAF, 0xA7, 0x03, 0xE5, 0xB6, 0xBA, 0x03, 0xE6, 0x80, 0x9C, 0x03,
+	0xE7, 0x8E, 0xB2, 0x03, 0xE7, 0x91, 0xA9, 0x03, 0xE7, 0xBE, 0x9A, 0x03,
+	0xE8, 0x81, 0x86, 0x03, 0xE9, 0x88, 0xB4, 0x03, 0xE9, 0x9B, 0xB6, 0x03,
+	0xE9, 0x9D, 0x88, 0x03, 0xE9, 0xA0, 0x98, 0x03, 0xE4, 0xBE, 0x8B, 0x03,
+	0xE7, 0xA6, 0xAE, 0x03, 0xE9, 0x86, 0xB4, 0x03, 0xE9, 0x9A, 0xB8, 0x03,
+	0xE6, 0x83, 0xA1, 0x03, 0xE4, 0xBA, 0x86, 0x03, 0xE5, 0x83, 0x9A, 0x03,
+	0xE5, 0xAF, 0xAE, 0x03, 0xE5, 0xB0, 0xBF, 0x03, 0xE6, 0x96, 0x99, 0x03,
+	0xE6, 0xA8, 0x82, 0x03, 0xE7, 0x87, 0x8E, 0x03, 0xE7, 0x99, 0x82, 0x03,
+	0xE8, 0x93, 0xBC, 0x03, 0xE9, 0x81, 0xBC, 0x03, 0xE9, 0xBE, 0x8D, 0x03,
+	0xE6, 0x9A, 0x88, 0x03, 0xE9, 0x98, 0xAE, 0x03, 0xE5, 0x8A, 0x89, 0x03,
+	0xE6, 0x9D, 0xBB, 0x03, 0xE6, 0x9F, 0xB3, 0x03, 0xE6, 0xB5, 0x81, 0x03,
+	0xE6, 0xBA, 0x9C, 0x03, 0xE7, 0x90, 0x89, 0x03, 0xE7, 0x95, 0x99, 0x03,
+	0xE7, 0xA1, 0xAB, 0x03, 0xE7, 0xB4, 0x90, 0x03, 0xE9, 0xA1, 0x9E, 0x03,
+	0xE5, 0x85, 0xAD, 0x03, 0xE6, 0x88, 0xAE, 0x03, 0xE9, 0x99, 0xB8, 0x03,
+	0xE5, 0x80, 0xAB, 0x03, 0xE5, 0xB4, 0x99, 0x03, 0xE6, 0xB7, 0xAA, 0x03,
+	0xE8, 0xBC, 0xAA, 0x03, 0xE5, 0xBE, 0x8B, 0x03, 0xE6, 0x85, 0x84, 0x03,
+	0xE6, 0xA0, 0x97, 0x03, 0xE7, 0x8E, 0x87, 0x03, 0xE9, 0x9A, 0x86, 0x03,
+	0xE5, 0x88, 0xA9, 0x03, 0xE5, 0x90, 0x8F, 0x03, 0xE5, 0xB1, 0xA5, 0x03,
+	0xE6, 0x98, 0x93, 0x03, 0xE6, 0x9D, 0x8E, 0x03, 0xE6, 0xA2, 0xA8, 0x03,
+	0xE6, 0xB3, 0xA5, 0x03, 0xE7, 0x90, 0x86, 0x03, 0xE7, 0x97, 0xA2, 0x03,
+	0xE7, 0xBD, 0xB9, 0x03, 0xE8, 0xA3, 0x8F, 0x03, 0xE8, 0xA3, 0xA1, 0x03,
+	0xE9, 0x87, 0x8C, 0x03, 0xE9, 0x9B, 0xA2, 0x03, 0xE5, 0x8C, 0xBF, 0x03,
+	0xE6, 0xBA, 0xBA, 0x03, 0xE5, 0x90, 0x9D, 0x03, 0xE7, 0x87, 0x90, 0x03,
+	0xE7, 0x92, 0x98, 0x03, 0xE8, 0x97, 0xBA, 0x03, 0xE9, 0x9A, 0xA3, 0x03,
+	0xE9, 0xB1, 0x97, 0x03, 0xE9, 0xBA, 0x9F, 0x03, 0xE6, 0x9E, 0x97, 0x03,
+	0xE6, 0xB7, 0x8B, 0x03, 0xE8, 0x87, 0xA8, 0x03, 0xE7, 0xAB, 0x8B, 0x03,
+	0xE7, 0xAC, 0xA0, 0x03, 0xE7, 0xB2, 0x92, 0x03, 0xE7, 0x8B, 0x80, 0x03,
+	0xE7, 0x82, 0x99, 0x03, 0xE8, 0xAD, 0x98, 0x03, 0xE4, 0xBB, 0x80, 0x03,
+	0xE8, 0x8C, 0xB6, 0x03, 0xE5, 0x88, 0xBA, 0x03, 0xE5, 0x88, 0x87, 0x03,
+	0xE5, 0xBA, 0xA6, 0x03, 0xE6, 0x8B, 0x93, 0x03, 0xE7, 0xB3, 0x96, 0x03,
+	0xE5, 0xAE, 0x85, 0x03, 0xE6, 0xB4, 0x9E, 0x03, 0xE6, 0x9A, 0xB4, 0x03,
+	0xE8, 0xBC, 0xBB, 0x03, 0xE8, 0xA1, 0x8C, 0x03, 0xE9, 0x99, 0x8D, 0x03,
+	0xE8, 0xA6, 0x8B, 0x03, 0xE5, 0xBB, 0x93, 0x03, 0xE5, 0x85, 0x80, 0x03,
+	0xE5, 0x97, 0x80, 0x03, 0xE5, 0xA1, 0x9A, 0x03, 0xE6, 0x99, 0xB4, 0x03,
+	0xE5, 0x87, 0x9E, 0x03, 0xE7, 0x8C, 0xAA, 0x03, 0xE7, 0x9B, 0x8A, 0x03,
+	0xE7, 0xA4, 0xBC, 0x03, 0xE7, 0xA5, 0x9E, 0x03, 0xE7, 0xA5, 0xA5, 0x03,
+	0xE7, 0xA6, 0x8F, 0x03, 0xE9, 0x9D, 0x96, 0x03, 0xE7, 0xB2, 0xBE, 0x03,
+	0xE7, 0xBE, 0xBD, 0x03, 0xE8, 0x98, 0x92, 0x03, 0xE8, 0xAB, 0xB8, 0x03,
+	0xE9, 0x80, 0xB8, 0x03, 0xE9, 0x83, 0xBD, 0x03, 0xE9, 0xA3, 0xAF, 0x03,
+	0xE9, 0xA3, 0xBC, 0x03, 0xE9, 0xA4, 0xA8, 0x03, 0xE9, 0xB6, 0xB4, 0x03,
+	0xE9, 0x83, 0x9E, 0x03, 0xE9, 0x9A, 0xB7, 0x03, 0xE4, 0xBE, 0xAE, 0x03,
+	0xE5, 0x83, 0xA7, 0x03, 0xE5, 0x85, 0x8D, 0x03, 0xE5, 0x8B, 0x89, 0x03,
+	0xE5, 0x8B, 0xA4, 0x03, 0xE5, 0x8D, 0x91, 0x03, 0xE5, 0x96, 0x9D, 0x03,
+	0xE5, 0x98, 0x86, 0x03, 0xE5, 0x99, 0xA8, 0x03, 0xE5, 0xA1, 0x80, 0x03,
+	0xE5, 0xA2, 0xA8, 0x03, 0xE5, 0xB1, 0xA4, 0x03, 0xE5, 0xB1, 0xAE, 0x03,
+	0xE6, 0x82, 0x94, 0x03, 0xE6, 0x85, 0xA8, 0x03, 0xE6, 0x86, 0x8E, 0x03,
+	0xE6, 0x87, 0xB2, 0x03, 0xE6, 0x95, 0x8F, 0x03, 0xE6, 0x97, 0xA2, 0x03,
+	0xE6, 0x9A, 0x91, 0x03, 0xE6, 0xA2, 0x85, 0x03, 0xE6, 0xB5, 0xB7, 0x03,
+	0xE6, 0xB8, 0x9A, 0x03, 0xE6, 0xBC, 0xA2, 0x03, 0xE7, 0x85, 0xAE, 0x03,
+	0xE7, 0x88, 0xAB, 0x03, 0xE7, 0x90, 0xA2, 0x03, 0xE7, 0xA2, 0x91, 0x03,
+	0xE7, 0xA4, 0xBE, 0x03, 0xE7, 0xA5, 0x89, 0x03, 0xE7, 0xA5, 0x88, 0x03,
+	0xE7, 0xA5, 0x90, 0x03, 0xE7, 0xA5, 0x96, 0x03, 0xE7, 0xA5, 0x9D, 0x03,
+	0xE7, 0xA6, 0x8D, 0x03, 0xE7, 0xA6, 0x8E, 0x03, 0xE7, 0xA9, 0x80, 0x03,
+	0xE7, 0xAA, 0x81, 0x03, 0xE7, 0xAF, 0x80, 0x03, 0xE7, 0xB7, 0xB4, 0x03,
+	0xE7, 0xB8, 0x89, 0x03, 0xE7, 0xB9, 0x81, 0x03, 0xE7, 0xBD, 0xB2, 0x03,
+	0xE8, 0x80, 0x85, 0x03, 0xE8, 0x87, 0xAD, 0x03, 0xE8, 0x89, 0xB9, 0x03,
+	0xE8, 0x89, 0xB9, 0x03, 0xE8, 0x91, 0x97, 0x03, 0xE8, 0xA4, 0x90, 0x03,
+	0xE8, 0xA6, 0x96, 0x03, 0xE8, 0xAC, 0x81, 0x03, 0xE8, 0xAC, 0xB9, 0x03,
+	0xE8, 0xB3, 0x93, 0x03, 0xE8, 0xB4, 0x88, 0x03, 0xE8, 0xBE, 0xB6, 0x03,
+	0xE9, 0x80, 0xB8, 0x03, 0xE9, 0x9B, 0xA3, 0x03, 0xE9, 0x9F, 0xBF, 0x03,
+	0xE9, 0xA0, 0xBB, 0x03, 0xE6, 0x81, 0xB5, 0x04, 0xF0, 0xA4, 0x8B, 0xAE,
+	0x03, 0xE8, 0x88, 0x98, 0x03, 0xE4, 0xB8, 0xA6, 0x03, 0xE5, 0x86, 0xB5,
+	0x03, 0xE5, 0x85, 0xA8, 0x03, 0xE4, 0xBE, 0x80, 0x03, 0xE5, 0x85, 0x85,
+	0x03, 0xE5, 0x86, 0x80, 0x03, 0xE5, 0x8B, 0x87, 0x03, 0xE5, 0x8B, 0xBA,
+	0x03, 0xE5, 0x96, 0x9D, 0x03, 0xE5, 0x95, 0x95, 0x03, 0xE5, 0x96, 0x99,
+	0x03, 0xE5, 0x97, 0xA2, 0x03, 0xE5, 0xA1, 0x9A, 0x03, 0xE5, 0xA2, 0xB3,
+	0x03, 0xE5, 0xA5, 0x84, 0x03, 0xE5, 0xA5, 0x94, 0x03, 0xE5, 0xA9, 0xA2,
+	0x03, 0xE5, 0xAC, 0xA8, 0x03, 0xE5, 0xBB, 0x92, 0x03, 0xE5, 0xBB, 0x99,
+	0x03, 0xE5, 0xBD, 0xA9, 0x03, 0xE5, 0xBE, 0xAD, 0x03, 0xE6, 0x83, 0x98,
+	0x03, 0xE6, 0x85, 0x8E, 0x03, 0xE6, 0x84, 0x88, 0x03, 0xE6, 0x86, 0x8E,
+	0x03, 0xE6, 0x85, 0xA0, 0x03, 0xE6, 0x87, 0xB2, 0x03, 0xE6, 0x88, 0xB4,
+	0x03, 0xE6, 0x8F, 0x84, 0x03, 0xE6, 0x90, 0x9C, 0x03, 0xE6, 0x91, 0x92,
+	0x03, 0xE6, 0x95, 0x96, 0x03, 0xE6, 0x99, 0xB4, 0x03, 0xE6, 0x9C, 0x97,
+	0x03, 0xE6, 0x9C, 0x9B, 0x03, 0xE6, 0x9D, 0x96, 0x03, 0xE6, 0xAD, 0xB9,
+	0x03, 0xE6, 0xAE, 0xBA, 0x03, 0xE6, 0xB5, 0x81, 0x03, 0xE6, 0xBB, 0x9B,
+	0x03, 0xE6, 0xBB, 0x8B, 0x03, 0xE6, 0xBC, 0xA2, 0x03, 0xE7, 0x80, 0x9E,
+	0x03, 0xE7, 0x85, 0xAE, 0x03, 0xE7, 0x9E, 0xA7, 0x03, 0xE7, 0x88, 0xB5,
+	0x03, 0xE7, 0x8A, 0xAF, 0x03, 0xE7, 0x8C, 0xAA, 0x03, 0xE7, 0x91, 0xB1,
+	0x03, 0xE7, 0x94, 0x86, 0x03, 0xE7, 0x94, 0xBB, 0x03, 0xE7, 0x98, 0x9D,
+	0x03, 0xE7, 0x98, 0x9F, 0x03, 0xE7, 0x9B, 0x8A, 0x03, 0xE7, 0x9B, 0x9B,
+	0x03, 0xE7, 0x9B, 0xB4, 0x03, 0xE7, 0x9D, 0x8A, 0x03, 0xE7, 0x9D, 0x80,
+	0x03, 0xE7, 0xA3, 0x8C, 0x03, 0xE7, 0xAA, 0xB1, 0x03, 0xE7, 0xAF, 0x80,
+	0x03, 0xE7, 0xB1, 0xBB, 0x03, 0xE7, 0xB5, 0x9B, 0x03, 0xE7, 0xB7, 0xB4,
+	0x03, 0xE7, 0xBC, 0xBE, 0x03, 0xE8, 0x80, 0x85, 0x03, 0xE8, 0x8D, 0x92,
+	0x03, 0xE8, 0x8F, 0xAF, 0x03, 0xE8, 0x9D, 0xB9, 0x03, 0xE8, 0xA5, 0x81,
+	0x03, 0xE8, 0xA6, 0x86, 0x03, 0xE8, 0xA6, 0x96, 0x03, 0xE8, 0xAA, 0xBF,
+	0x03, 0xE8, 0xAB, 0xB8, 0x03, 0xE8, 0xAB, 0x8B, 0x03, 0xE8, 0xAC, 0x81,
+	0x03, 0xE8, 0xAB, 0xBE, 0x03, 0xE8, 0xAB, 0xAD, 0x03, 0xE8, 0xAC, 0xB9,
+	0x03, 0xE8, 0xAE, 0x8A, 0x03, 0xE8, 0xB4, 0x88, 0x03, 0xE8, 0xBC, 0xB8,
+	0x03, 0xE9, 0x81, 0xB2, 0x03, 0xE9, 0x86, 0x99, 0x03, 0xE9, 0x89, 0xB6,
+	0x03, 0xE9, 0x99, 0xBC, 0x03, 0xE9, 0x9B, 0xA3, 0x03, 0xE9, 0x9D, 0x96,
+	0x03, 0xE9, 0x9F, 0x9B, 0x03, 0xE9, 0x9F, 0xBF, 0x03, 0xE9, 0xA0, 0x8B,
+	0x03, 0xE9, 0xA0, 0xBB, 0x03, 0xE9, 0xAC, 0x92, 0x03, 0xE9, 0xBE, 0x9C,
+	0x04, 0xF0, 0xA2, 0xA1, 0x8A, 0x04, 0xF0, 0xA2, 0xA1, 0x84, 0x04, 0xF0,
+	0xA3, 0x8F, 0x95, 0x03, 0xE3, 0xAE, 0x9D, 0x03, 0xE4, 0x80, 0x98, 0x03,
+	0xE4, 0x80, 0xB9, 0x04, 0xF0, 0xA5, 0x89, 0x89, 0x04, 0xF0, 0xA5, 0xB3,
+	0x90, 0x04, 0xF0, 0xA7, 0xBB, 0x93, 0x03, 0xE9, 0xBD, 0x83, 0x03, 0xE9,
+	0xBE, 0x8E, 0x04, 0xD7, 0x99, 0xD6, 0xB4, 0x04, 0xD7, 0xB2, 0xD6, 0xB7,
+	0x04, 0xD7, 0xA9, 0xD7, 0x81, 0x04, 0xD7, 0xA9, 0xD7, 0x82, 0x06, 0xD7,
+	0xA9, 0xD6, 0xBC, 0xD7, 0x81, 0x06, 0xD7, 0xA9, 0xD6, 0xBC, 0xD7, 0x82,
+	0x04, 0xD7, 0x90, 0xD6, 0xB7, 0x04, 0xD7, 0x90, 0xD6, 0xB8, 0x04, 0xD7,
+	0x90, 0xD6, 0xBC, 0x04, 0xD7, 0x91, 0xD6, 0xBC, 0x04, 0xD7, 0x92, 0xD6,
+	0xBC, 0x04, 0xD7, 0x93, 0xD6, 0xBC, 0x04, 0xD7, 0x94, 0xD6, 0xBC, 0x04,
+	0xD7, 0x95, 0xD6, 0xBC, 0x04, 0xD7, 0x96, 0xD6, 0xBC, 0x04, 0xD7, 0x98,
+	0xD6, 0xBC, 0x04, 0xD7, 0x99, 0xD6, 0xBC, 0x04, 0xD7, 0x9A, 0xD6, 0xBC,
+	0x04, 0xD7, 0x9B, 0xD6, 0xBC, 0x04, 0xD7, 0x9C, 0xD6, 0xBC, 0x04, 0xD7,
+	0x9E, 0xD6, 0xBC, 0x04, 0xD7, 0xA0, 0xD6, 0xBC, 0x04, 0xD7, 0xA1, 0xD6,
+	0xBC, 0x04, 0xD7, 0xA3, 0xD6, 0xBC, 0x04, 0xD7, 0xA4, 0xD6, 0xBC, 0x04,
+	0xD7, 0xA6, 0xD6, 0xBC, 0x04, 0xD7, 0xA7, 0xD6, 0xBC, 0x04, 0xD7, 0xA8,
+	0xD6, 0xBC, 0x04, 0xD7, 0xA9, 0xD6, 0xBC, 0x04, 0xD7, 0xAA, 0xD6, 0xBC,
+	0x04, 0xD7, 0x95, 0xD6, 0xB9, 0x04, 0xD7, 0x91, 0xD6, 0xBF, 0x04, 0xD7,
+	0x9B, 0xD6, 0xBF, 0x04, 0xD7, 0xA4, 0xD6, 0xBF, 0x08, 0xF0, 0x91, 0x82,
+	0x99, 0xF0, 0x91, 0x82, 0xBA, 0x08, 0xF0, 0x91, 0x82, 0x9B, 0xF0, 0x91,
+	0x82, 0xBA, 0x08, 0xF0, 0x91, 0x82, 0xA5, 0xF0, 0x91, 0x82, 0xBA, 0x08,
+	0xF0, 0x91, 0x84, 0xB1, 0xF0, 0x91, 0x84, 0xA7, 0x08, 0xF0, 0x91, 0x84,
+	0xB2, 0xF0, 0x91, 0x84, 0xA7, 0x08, 0xF0, 0x91, 0x8D, 0x87, 0xF0, 0x91,
+	0x8C, 0xBE, 0x08, 0xF0, 0x91, 0x8D, 0x87, 0xF0, 0x91, 0x8D, 0x97, 0x08,
+	0xF0, 0x91, 0x92, 0xB9, 0xF0, 0x91, 0x92, 0xBA, 0x08, 0xF0, 0x91, 0x92,
+	0xB9, 0xF0, 0x91, 0x92, 0xB0, 0x08, 0xF0, 0x91, 0x92, 0xB9, 0xF0, 0x91,
+	0x92, 0xBD, 0x08, 0xF0, 0x91, 0x96, 0xB8, 0xF0, 0x91, 0x96, 0xAF, 0x08,
+	0xF0, 0x91, 0x96, 0xB9, 0xF0, 0x91, 0x96, 0xAF, 0x08, 0xF0, 0x91, 0xA4,
+	0xB5, 0xF0, 0x91, 0xA4, 0xB0, 0x08, 0xF0, 0x9D, 0x85, 0x97, 0xF0, 0x9D,
+	0x85, 0xA5, 0x08, 0xF0, 0x9D, 0x85, 0x98, 0xF0, 0x9D, 0x85, 0xA5, 0x0C,
+	0xF0, 0x9D, 0x85, 0x98, 0xF0, 0x9D, 0x85, 0xA5, 0xF0, 0x9D, 0x85, 0xAE,
+	0x0C, 0xF0, 0x9D, 0x85, 0x98, 0xF0, 0x9D, 0x85, 0xA5, 0xF0, 0x9D, 0x85,
+	0xAF, 0x0C, 0xF0, 0x9D, 0x85, 0x98, 0xF0, 0x9D, 0x85, 0xA5, 0xF0, 0x9D,
+	0x85, 0xB0, 0x0C, 0xF0, 0x9D, 0x85, 0x98, 0xF0, 0x9D, 0x85, 0xA5, 0xF0,
+	0x9D, 0x85, 0xB1, 0x0C, 0xF0, 0x9D, 0x85, 0x98, 0xF0, 0x9D, 0x85, 0xA5,
+	0xF0, 0x9D, 0x85, 0xB2, 0x08, 0xF0, 0x9D, 0x86, 0xB9, 0xF0, 0x9D, 0x85,
+	0xA5, 0x08, 0xF0, 0x9D, 0x86, 0xBA, 0xF0, 0x9D, 0x85, 0xA5, 0x0C, 0xF0,
+	0x9D, 0x86, 0xB9, 0xF0, 0x9D, 0x85, 0xA5, 0xF0, 0x9D, 0x85, 0xAE, 0x0C,
+	0xF0, 0x9D, 0x86, 0xBA, 0xF0, 0x9D, 0x85, 0xA5, 0xF0, 0x9D, 0x85, 0xAE,
+	0x0C, 0xF0, 0x9D, 0x86, 0xB9, 0xF0, 0x9D, 0x85, 0xA5, 0xF0, 0x9D, 0x85,
+	0xAF, 0x0C, 0xF0, 0x9D, 0x86, 0xBA, 0xF0, 0x9D, 0x85, 0xA5, 0xF0, 0x9D,
+	0x85, 0xAF, 0x03, 0xE4, 0xB8, 0xBD, 0x03, 0xE4, 0xB8, 0xB8, 0x03, 0xE4,
+	0xB9, 0x81, 0x04, 0xF0, 0xA0, 0x84, 0xA2, 0x03, 0xE4, 0xBD, 0xA0, 0x03,
+	0xE4, 0xBE, 0xAE, 0x03, 0xE4, 0xBE, 0xBB, 0x03, 0xE5, 0x80, 0x82, 0x03,
+	0xE5, 0x81, 0xBA, 0x03, 0xE5, 0x82, 0x99, 0x03, 0xE5, 0x83, 0xA7, 0x03,
+	0xE5, 0x83, 0x8F, 0x03, 0xE3, 0x92, 0x9E, 0x04, 0xF0, 0xA0, 0x98, 0xBA,
+	0x03, 0xE5, 0x85, 0x8D, 0x03, 0xE5, 0x85, 0x94, 0x03, 0xE5, 0x85, 0xA4,
+	0x03, 0xE5, 0x85, 0xB7, 0x04, 0xF0, 0xA0, 0x94, 0x9C, 0x03, 0xE3, 0x92,
+	0xB9, 0x03, 0xE5, 0x85, 0xA7, 0x03, 0xE5, 0x86, 0x8D, 0x04, 0xF0, 0xA0,
+	0x95, 0x8B, 0x03, 0xE5, 0x86, 0x97, 0x03, 0xE5, 0x86, 0xA4, 0x03, 0xE4,
+	0xBB, 0x8C, 0x03, 0xE5, 0x86, 0xAC, 0x03, 0xE5, 0x86, 0xB5, 0x04, 0xF0,
+	0xA9, 0x87, 0x9F, 0x03, 0xE5, 0x87, 0xB5, 0x03, 0xE5, 0x88, 0x83, 0x03,
+	0xE3, 0x93, 0x9F, 0x03, 0xE5, 0x88, 0xBB, 0x03, 0xE5, 0x89, 0x86, 0x03,
+	0xE5, 0x89, 0xB2, 0x03, 0xE5, 0x89, 0xB7, 0x03, 0xE3, 0x94, 0x95, 0x03,
+	0xE5, 0x8B, 0x87, 0x03, 0xE5, 0x8B, 0x89, 0x03, 0xE5, 0x8B, 0xA4, 0x03,
+	0xE5, 0x8B, 0xBA, 0x03, 0xE5, 0x8C, 0x85, 0x03, 0xE5, 0x8C, 0x86, 0x03,
+	0xE5, 0x8C, 0x97, 0x03, 0xE5, 0x8D, 0x89, 0x03, 0xE5, 0x8D, 0x91, 0x03,
+	0xE5, 0x8D, 0x9A, 0x03, 0xE5, 0x8D, 0xB3, 0x03, 0xE5, 0x8D, 0xBD, 0x03,
+	0xE5, 0x8D, 0xBF, 0x03, 0xE5, 0x8D, 0xBF, 0x03, 0xE5, 0x8D, 0xBF, 0x04,
+	0xF0, 0xA0, 0xA8, 0xAC, 0x03, 0xE7, 0x81, 0xB0, 0x03, 0xE5, 0x8F, 0x8A,
+	0x03, 0xE5, 0x8F, 0x9F, 0x04, 0xF0, 0xA0, 0xAD, 0xA3, 0x03, 0xE5, 0x8F,
+	0xAB, 0x03, 0xE5, 0x8F, 0xB1, 0x03, 0xE5, 0x90, 0x86, 0x03, 0xE5, 0x92,
+	0x9E, 0x03, 0xE5, 0x90, 0xB8, 0x03, 0xE5, 0x91, 0x88, 0x03, 0xE5, 0x91,
+	0xA8, 0x03, 0xE5, 0x92, 0xA2, 0x03, 0xE5, 0x93, 0xB6, 0x03, 0xE5, 0x94,
+	0x90, 0x03, 0xE5, 0x95, 0x93, 0x03, 0xE5, 0x95, 0xA3, 0x03, 0xE5, 0x96,
+	0x84, 0x03, 0xE5, 0x96, 0x84, 0x03, 0xE5, 0x96, 0x99, 0x03, 0xE5, 0x96,
+	0xAB, 0x03, 0xE5, 0x96, 0xB3, 0x03, 0xE5, 0x97, 0x82, 0x03, 0xE5, 0x9C,
+	0x96, 0x03, 0xE5, 0x98, 0x86, 0x03, 0xE5, 0x9C, 0x97, 0x03, 0xE5, 0x99,
+	0x91, 0x03, 0xE5, 0x99, 0xB4, 0x03, 0xE5, 0x88, 0x87, 0x03, 0xE5, 0xA3,
+	0xAE, 0x03, 0xE5, 0x9F, 0x8E, 0x03, 0xE5, 0x9F, 0xB4, 0x03, 0xE5, 0xA0,
+	0x8D, 0x03, 0xE5, 0x9E, 0x8B, 0x03, 0xE5, 0xA0, 0xB2, 0x03, 0xE5, 0xA0,
+	0xB1, 0x03, 0xE5, 0xA2, 0xAC, 0x04, 0xF0, 0xA1, 0x93, 0xA4, 0x03, 0xE5,
+	0xA3, 0xB2, 0x03, 0xE5, 0xA3, 0xB7, 0x03, 0xE5, 0xA4, 0x86, 0x03, 0xE5,
+	0xA4, 0x9A, 0x03, 0xE5, 0xA4, 0xA2, 0x03, 0xE5, 0xA5, 0xA2, 0x04, 0xF0,
+	0xA1, 0x9A, 0xA8, 0x04, 0xF0, 0xA1, 0x9B, 0xAA, 0x03, 0xE5, 0xA7, 0xAC,
+	0x03, 0xE5, 0xA8, 0x9B, 0x03, 0xE5, 0xA8, 0xA7, 0x03, 0xE5, 0xA7, 0x98,
+	0x03, 0xE5, 0xA9, 0xA6, 0x03, 0xE3, 0x9B, 0xAE, 0x03, 0xE3, 0x9B, 0xBC,
+	0x03, 0xE5, 0xAC, 0x88, 0x03, 0xE5, 0xAC, 0xBE, 0x03, 0xE5, 0xAC, 0xBE,
+	0x04, 0xF0, 0xA1, 0xA7, 0x88, 0x03, 0xE5, 0xAF, 0x83, 0x03, 0xE5, 0xAF,
+	0x98, 0x03, 0xE5, 0xAF, 0xA7, 0x03, 0xE5, 0xAF, 0xB3, 0x04, 0xF0, 0xA1,
+	0xAC, 0x98, 0x03, 0xE5, 0xAF, 0xBF, 0x03, 0xE5, 0xB0, 0x86, 0x03, 0xE5,
+	0xBD, 0x93, 0x03, 0xE5, 0xB0, 0xA2, 0x03, 0xE3, 0x9E, 0x81, 0x03, 0xE5,
+	0xB1, 0xA0, 0x03, 0xE5, 0xB1, 0xAE, 0x03, 0xE5, 0xB3, 0x80, 0x03, 0xE5,
+	0xB2, 0x8D, 0x04, 0xF0, 0xA1, 0xB7, 0xA4, 0x03, 0xE5, 0xB5, 0x83, 0x04,
+	0xF0, 0xA1, 0xB7, 0xA6, 0x03, 0xE5, 0xB5, 0xAE, 0x03, 0xE5, 0xB5, 0xAB,
+	0x03, 0xE5, 0xB5, 0xBC, 0x03, 0xE5, 0xB7, 0xA1, 0x03, 0xE5, 0xB7, 0xA2,
+	0x03, 0xE3, 0xA0, 0xAF, 0x03, 0xE5, 0xB7, 0xBD, 0x03, 0xE5, 0xB8, 0xA8,
+	0x03, 0xE5, 0xB8, 0xBD, 0x03, 0xE5, 0xB9, 0xA9, 0x03, 0xE3, 0xA1, 0xA2,
+	0x04, 0xF0, 0xA2, 0x86, 0x83, 0x03, 0xE3, 0xA1, 0xBC, 0x03, 0xE5, 0xBA,
+	0xB0, 0x03, 0xE5, 0xBA, 0xB3, 0x03, 0xE5, 0xBA, 0xB6, 0x03, 0xE5, 0xBB,
+	0x8A, 0x04, 0xF0, 0xAA, 0x8E, 0x92, 0x03, 0xE5, 0xBB, 0xBE, 0x04, 0xF0,
+	0xA2, 0x8C, 0xB1, 0x04, 0xF0, 0xA2, 0x8C, 0xB1, 0x03, 0xE8, 0x88, 0x81,
+	0x03, 0xE5, 0xBC, 0xA2, 0x03, 0xE5, 0xBC, 0xA2, 0x03, 0xE3, 0xA3, 0x87,
+	0x04, 0xF0, 0xA3, 0x8A, 0xB8, 0x04, 0xF0, 0xA6, 0x87, 0x9A, 0x03, 0xE5,
+	0xBD, 0xA2, 0x03, 0xE5, 0xBD, 0xAB, 0x03, 0xE3, 0xA3, 0xA3, 0x03, 0xE5,
+	0xBE, 0x9A, 0x03, 0xE5, 0xBF, 0x8D, 0x03, 0xE5, 0xBF, 0x97, 0x03, 0xE5,
+	0xBF, 0xB9, 0x03, 0xE6, 0x82, 0x81, 0x03, 0xE3, 0xA4, 0xBA, 0x03, 0xE3,
+	0xA4, 0x9C, 0x03, 0xE6, 0x82, 0x94, 0x04, 0xF0, 0xA2, 0x9B, 0x94, 0x03,
+	0xE6, 0x83, 0x87, 0x03, 0xE6, 0x85, 0x88, 0x03, 0xE6, 0x85, 0x8C, 0x03,
+	0xE6, 0x85, 0x8E, 0x03, 0xE6, 0x85, 0x8C, 0x03, 0xE6, 0x85, 0xBA, 0x03,
+	0xE6, 0x86, 0x8E, 0x03, 0xE6, 0x86, 0xB2, 0x03, 0xE6, 0x86, 0xA4, 0x03,
+	0xE6, 0x86, 0xAF, 0x03, 0xE6, 0x87, 0x9E, 0x03, 0xE6, 0x87, 0xB2, 0x03,
+	0xE6, 0x87, 0xB6, 0x03, 0xE6, 0x88, 0x90, 0x03, 0xE6, 0x88, 0x9B, 0x03,
+	0xE6, 0x89, 0x9D, 0x03, 0xE6, 0x8A, 0xB1, 0x03, 0xE6, 0x8B, 0x94, 0x03,
+	0xE6, 0x8D, 0x90, 0x04, 0xF0, 0xA2, 0xAC, 0x8C, 0x03, 0xE6, 0x8C, 0xBD,
+	0x03, 0xE6, 0x8B, 0xBC, 0x03, 0xE6, 0x8D, 0xA8, 0x03, 0xE6, 0x8E, 0x83,
+	0x03, 0xE6, 0x8F, 0xA4, 0x04, 0xF0, 0xA2, 0xAF, 0xB1, 0x03, 0xE6, 0x90,
+	0xA2, 0x03, 0xE6, 0x8F, 0x85, 0x03, 0xE6, 0x8E, 0xA9, 0x03, 0xE3, 0xA8,
+	0xAE, 0x03, 0xE6, 0x91, 0xA9, 0x03, 0xE6, 0x91, 0xBE, 0x03, 0xE6, 0x92,
+	0x9D, 0x03, 0xE6, 0x91, 0xB7, 0x03, 0xE3, 0xA9, 0xAC, 0x03, 0xE6, 0x95,
+	0x8F, 0x03, 0xE6, 0x95, 0xAC, 0x04, 0xF0, 0xA3, 0x80, 0x8A, 0x03, 0xE6,
+	0x97, 0xA3, 0x03, 0xE6, 0x9B, 0xB8, 0x03, 0xE6, 0x99, 0x89, 0x03, 0xE3,
+	0xAC, 0x99, 0x03, 0xE6, 0x9A, 0x91, 0x03, 0xE3, 0xAC, 0x88, 0x03, 0xE3,
+	0xAB, 0xA4, 0x03, 0xE5, 0x86, 0x92, 0x03, 0xE5, 0x86, 0x95, 0x03, 0xE6,
+	0x9C, 0x80, 0x03, 0xE6, 0x9A, 0x9C, 0x03, 0xE8, 0x82, 0xAD, 0x03, 0xE4,
+	0x8F, 0x99, 0x03, 0xE6, 0x9C, 0x97, 0x03, 0xE6, 0x9C, 0x9B, 0x03, 0xE6,
+	0x9C, 0xA1, 0x03, 0xE6, 0x9D, 0x9E, 0x03, 0xE6, 0x9D, 0x93, 0x04, 0xF0,
+	0xA3, 0x8F, 0x83, 0x03, 0xE3, 0xAD, 0x89, 0x03, 0xE6, 0x9F, 0xBA, 0x03,
+	0xE6, 0x9E, 0x85, 0x03, 0xE6, 0xA1, 0x92, 0x03, 0xE6, 0xA2, 0x85, 0x04,
+	0xF0, 0xA3, 0x91, 0xAD, 0x03, 0xE6, 0xA2, 0x8E, 0x03, 0xE6, 0xA0, 0x9F,
+	0x03, 0xE6, 0xA4, 0x94, 0x03, 0xE3, 0xAE, 0x9D, 0x03, 0xE6, 0xA5, 0x82,
+	0x03, 0xE6, 0xA6, 0xA3, 0x03, 0xE6, 0xA7, 0xAA, 0x03, 0xE6, 0xAA, 0xA8,
+	0x04, 0xF0, 0xA3, 0x9A, 0xA3, 0x03, 0xE6, 0xAB, 0x9B, 0x03, 0xE3, 0xB0,
+	0x98, 0x03, 0xE6, 0xAC, 0xA1, 0x04, 0xF0, 0xA3, 0xA2, 0xA7, 0x03, 0xE6,
+	0xAD, 0x94, 0x03, 0xE3, 0xB1, 0x8E, 0x03, 0xE6, 0xAD, 0xB2, 0x03, 0xE6,
+	0xAE, 0x9F, 0x03, 0xE6, 0xAE, 0xBA, 0x03, 0xE6, 0xAE, 0xBB, 0x04, 0xF0,
+	0xA3, 0xAA, 0x8D, 0x04, 0xF0, 0xA1, 0xB4, 0x8B, 0x04, 0xF0, 0xA3, 0xAB,
+	0xBA, 0x03, 0xE6, 0xB1, 0x8E, 0x04, 0xF0, 0xA3, 0xB2, 0xBC, 0x03, 0xE6,
+	0xB2, 0xBF, 0x03, 0xE6, 0xB3, 0x8D, 0x03, 0xE6, 0xB1, 0xA7, 0x03, 0xE6,
+	0xB4, 0x96, 0x03, 0xE6, 0xB4, 0xBE, 0x03, 0xE6, 0xB5, 0xB7, 0x03, 0xE6,
+	0xB5, 0x81, 0x03, 0xE6, 0xB5, 0xA9, 0x03, 0xE6, 0xB5, 0xB8, 0x03, 0xE6,
+	0xB6, 0x85, 0x04, 0xF0, 0xA3, 0xB4, 0x9E, 0x03, 0xE6, 0xB4, 0xB4, 0x03,
+	0xE6, 0xB8, 0xAF, 0x03, 0xE6, 0xB9, 0xAE, 0x03, 0xE3, 0xB4, 0xB3, 0x03,
+	0xE6, 0xBB, 0x8B, 0x03, 0xE6, 0xBB, 0x87, 0x04, 0xF0, 0xA3, 0xBB, 0x91,
+	0x03, 0xE6, 0xB7, 0xB9, 0x03, 0xE6, 0xBD, 0xAE, 0x04, 0xF0, 0xA3, 0xBD,
+	0x9E, 0x04, 0xF0, 0xA3, 0xBE, 0x8E, 0x03, 0xE6, 0xBF, 0x86, 0x03, 0xE7,
+	0x80, 0xB9, 0x03, 0xE7, 0x80, 0x9E, 0x03, 0xE7, 0x80, 0x9B, 0x03, 0xE3,
+	0xB6, 0x96, 0x03, 0xE7, 0x81, 0x8A, 0x03, 0xE7, 0x81, 0xBD, 0x03, 0xE7,
+	0x81, 0xB7, 0x03, 0xE7, 0x82, 0xAD, 0x04, 0xF0, 0xA0, 0x94, 0xA5, 0x03,
+	0xE7, 0x85, 0x85, 0x04, 0xF0, 0xA4, 0x89, 0xA3, 0x03, 0xE7, 0x86, 0x9C,
+	0x04, 0xF0, 0xA4, 0x8E, 0xAB, 0x03, 0xE7, 0x88, 0xA8, 0x03, 0xE7, 0x88,
+	0xB5, 0x03, 0xE7, 0x89, 0x90, 0x04, 0xF0, 0xA4, 0x98, 0x88, 0x03, 0xE7,
+	0x8A, 0x80, 0x03, 0xE7, 0x8A, 0x95, 0x04, 0xF0, 0xA4, 0x9C, 0xB5, 0x04,
+	0xF0, 0xA4, 0xA0, 0x94, 0x03, 0xE7, 0x8D, 0xBA, 0x03, 0xE7, 0x8E, 0x8B,
+	0x03, 0xE3, 0xBA, 0xAC, 0x03, 0xE7, 0x8E, 0xA5, 0x03, 0xE3, 0xBA, 0xB8,
+	0x03, 0xE3, 0xBA, 0xB8, 0x03, 0xE7, 0x91, 0x87, 0x03, 0xE7, 0x91, 0x9C,
+	0x03, 0xE7, 0x91, 0xB1, 0x03, 0xE7, 0x92, 0x85, 0x03, 0xE7, 0x93, 0x8A,
+	0x03, 0xE3, 0xBC, 0x9B, 0x03, 0xE7, 0x94, 0xA4, 0x04, 0xF0, 0xA4, 0xB0,
+	0xB6, 0x03, 0xE7, 0x94, 0xBE, 0x04, 0xF0, 0xA4, 0xB2, 0x92, 0x03, 0xE7,
+	0x95, 0xB0, 0x04, 0xF0, 0xA2, 0x86, 0x9F, 0x03, 0xE7, 0x98, 0x90, 0x04,
+	0xF0, 0xA4, 0xBE, 0xA1, 0x04, 0xF0, 0xA4, 0xBE, 0xB8, 0x04, 0xF0, 0xA5,
+	0x81, 0x84, 0x03, 0xE3, 0xBF, 0xBC, 0x03, 0xE4, 0x80, 0x88, 0x03, 0xE7,
+	0x9B, 0xB4, 0x04, 0xF0, 0xA5, 0x83, 0xB3, 0x04, 0xF0, 0xA5, 0x83, 0xB2,
+	0x04, 0xF0, 0xA5, 0x84, 0x99, 0x04, 0xF0, 0xA5, 0x84, 0xB3, 0x03, 0xE7,
+	0x9C, 0x9E, 0x03, 0xE7, 0x9C, 0x9F, 0x03, 0xE7, 0x9C, 0x9F, 0x03, 0xE7,
+	0x9D, 0x8A, 0x03, 0xE4, 0x80, 0xB9, 0x03, 0xE7, 0x9E, 0x8B, 0x03, 0xE4,
+	0x81, 0x86, 0x03, 0xE4, 0x82, 0x96, 0x04, 0xF0, 0xA5, 0x90, 0x9D, 0x03,
+	0xE7, 0xA1, 0x8E, 0x03, 0xE7, 0xA2, 0x8C, 0x03, 0xE7, 0xA3, 0x8C, 0x03,
+	0xE4, 0x83, 0xA3, 0x04, 0xF0, 0xA5, 0x98, 0xA6, 0x03, 0xE7, 0xA5, 0x96,
+	0x04, 0xF0, 0xA5, 0x9A, 0x9A, 0x04, 0xF0, 0xA5, 0x9B, 0x85, 0x03, 0xE7,
+	0xA6, 0x8F, 0x03, 0xE7, 0xA7, 0xAB, 0x03, 0xE4, 0x84, 0xAF, 0x03, 0xE7,
+	0xA9, 0x80, 0x03, 0xE7, 0xA9, 0x8A, 0x03, 0xE7, 0xA9, 0x8F, 0x04, 0xF0,
+	0xA5, 0xA5, 0xBC, 0x04, 0xF0, 0xA5, 0xAA, 0xA7, 0x04, 0xF0, 0xA5, 0xAA,
+	0xA7, 0x03, 0xE7, 0xAB, 0xAE, 0x03, 0xE4, 0x88, 0x82, 0x04, 0xF0, 0xA5,
+	0xAE, 0xAB, 0x03, 0xE7, 0xAF, 0x86, 0x03, 0xE7, 0xAF, 0x89, 0x03, 0xE4,
+	0x88, 0xA7, 0x04, 0xF0, 0xA5, 0xB2, 0x80, 0x03, 0xE7, 0xB3, 0x92, 0x03,
+	0xE4, 0x8A, 0xA0, 0x03, 0xE7, 0xB3, 0xA8, 0x03, 0xE7, 0xB3, 0xA3, 0x03,
+	0xE7, 0xB4, 0x80, 0x04, 0xF0, 0xA5, 0xBE, 0x86, 0x03, 0xE7, 0xB5, 0xA3,
+	0x03, 0xE4, 0x8C, 0x81, 0x03, 0xE7, 0xB7, 0x87, 0x03, 0xE7, 0xB8, 0x82,
+	0x03, 0xE7, 0xB9, 0x85, 0x03, 0xE4, 0x8C, 0xB4, 0x04, 0xF0, 0xA6, 0x88,
+	0xA8, 0x04, 0xF0, 0xA6, 0x89, 0x87, 0x03, 0xE4, 0x8D, 0x99, 0x04, 0xF0,
+	0xA6, 0x8B, 0x99, 0x03, 0xE7, 0xBD, 0xBA, 0x04, 0xF0, 0xA6, 0x8C, 0xBE,
+	0x03, 0xE7, 0xBE, 0x95, 0x03, 0xE7, 0xBF, 0xBA, 0x03, 0xE8, 0x80, 0x85,
+	0x04, 0xF0, 0xA6, 0x93, 0x9A, 0x04, 0xF0, 0xA6, 0x94, 0xA3, 0x03, 0xE8,
+	0x81, 0xA0, 0x04, 0xF0, 0xA6, 0x96, 0xA8, 0x03, 0xE8, 0x81, 0xB0, 0x04,
+	0xF0, 0xA3, 0x8D, 0x9F, 0x03, 0xE4, 0x8F, 0x95, 0x03, 0xE8, 0x82, 0xB2,
+	0x03, 0xE8, 0x84, 0x83, 0x03, 0xE4, 0x90, 0x8B, 0x03, 0xE8, 0x84, 0xBE,
+	0x03, 0xE5, 0xAA, 0xB5, 0x04, 0xF0, 0xA6, 0x9E, 0xA7, 0x04, 0xF0, 0xA6,
+	0x9E, 0xB5, 0x04, 0xF0, 0xA3, 0x8E, 0x93, 0x04, 0xF0, 0xA3, 0x8E, 0x9C,
+	0x03, 0xE8, 0x88, 0x81, 0x03, 0xE8, 0x88, 0x84, 0x03, 0xE8, 0xBE, 0x9E,
+	0x03, 0xE4, 0x91, 0xAB, 0x03, 0xE8, 0x8A, 0x91, 0x03, 0xE8, 0x8A, 0x8B,
+	0x03, 0xE8, 0x8A, 0x9D, 0x03, 0xE5, 0x8A, 0xB3, 0x03, 0xE8, 0x8A, 0xB1,
+	0x03, 0xE8, 0x8A, 0xB3, 0x03, 0xE8, 0x8A, 0xBD, 0x03, 0xE8, 0x8B, 0xA6,
+	0x04, 0xF0, 0xA6, 0xAC, 0xBC, 0x03, 0xE8, 0x8B, 0xA5, 0x03, 0xE8, 0x8C,
+	0x9D, 0x03, 0xE8, 0x8D, 0xA3, 0x03, 0xE8, 0x8E, 0xAD, 0x03, 0xE8, 0x8C,
+	0xA3, 0x03, 0xE8, 0x8E, 0xBD, 0x03, 0xE8, 0x8F, 0xA7, 0x03, 0xE8, 0x91,
+	0x97, 0x03, 0xE8, 0x8D, 0x93, 0x03, 0xE8, 0x8F, 0x8A, 0x03, 0xE8, 0x8F,
+	0x8C, 0x03, 0xE8, 0x8F, 0x9C, 0x04, 0xF0, 0xA6, 0xB0, 0xB6, 0x04, 0xF0,
+	0xA6, 0xB5, 0xAB, 0x04, 0xF0, 0xA6, 0xB3, 0x95, 0x03, 0xE4, 0x94, 0xAB,
+	0x03, 0xE8, 0x93, 0xB1, 0x03, 0xE8, 0x93, 0xB3, 0x03, 0xE8, 0x94, 0x96,
+	0x04, 0xF0, 0xA7, 0x8F, 0x8A, 0x03, 0xE8, 0x95, 0xA4, 0x04, 0xF0, 0xA6,
+	0xBC, 0xAC, 0x03, 0xE4, 0x95, 0x9D, 0x03, 0xE4, 0x95, 0xA1, 0x04, 0xF0,
+	0xA6, 0xBE, 0xB1, 0x04, 0xF0, 0xA7, 0x83, 0x92, 0x03, 0xE4, 0x95, 0xAB,
+	0x03, 0xE8, 0x99, 0x90, 0x03, 0xE8, 0x99, 0x9C, 0x03, 0xE8, 0x99, 0xA7,
+	0x03, 0xE8, 0x99, 0xA9, 0x03, 0xE8, 0x9A, 0xA9, 0x03, 0xE8, 0x9A, 0x88,
+	0x03, 0xE8, 0x9C, 0x8E, 0x03, 0xE8, 0x9B, 0xA2, 0x03, 0xE8, 0x9D, 0xB9,
+	0x03, 0xE8, 0x9C, 0xA8, 0x03, 0xE8, 0x9D, 0xAB, 0x03, 0xE8, 0x9E, 0x86,
+	0x03, 0xE4, 0x97, 0x97, 0x03, 0xE8, 0x9F, 0xA1, 0x03, 0xE8, 0xA0, 0x81,
+	0x03, 0xE4, 0x97, 0xB9, 0x03, 0xE8, 0xA1, 0xA0, 0x03, 0xE8, 0xA1, 0xA3,
+	0x04, 0xF0, 0xA7, 0x99, 0xA7, 0x03, 0xE8, 0xA3, 0x97, 0x03, 0xE8, 0xA3,
+	0x9E, 0x03, 0xE4, 0x98, 0xB5, 0x03, 0xE8, 0xA3, 0xBA, 0x03, 0xE3, 0x92,
+	0xBB, 0x04, 0xF0, 0xA7, 0xA2, 0xAE, 0x04, 0xF0, 0xA7, 0xA5, 0xA6, 0x03,
+	0xE4, 0x9A, 0xBE, 0x03, 0xE4, 0x9B, 0x87, 0x03, 0xE8, 0xAA, 0xA0, 0x03,
+	0xE8, 0xAB, 0xAD, 0x03, 0xE8, 0xAE, 0x8A, 0x03, 0xE8, 0xB1, 0x95, 0x04,
+	0xF0, 0xA7, 0xB2, 0xA8, 0x03, 0xE8, 0xB2, 0xAB, 0x03, 0xE8, 0xB3, 0x81,
+	0x03, 0xE8, 0xB4, 0x9B, 0x03, 0xE8, 0xB5, 0xB7, 0x04, 0xF0, 0xA7, 0xBC,
+	0xAF, 0x04, 0xF0, 0xA0, 0xA0, 0x84, 0x03, 0xE8, 0xB7, 0x8B, 0x03, 0xE8,
+	0xB6, 0xBC, 0x03, 0xE8, 0xB7, 0xB0, 0x04, 0xF0, 0xA0, 0xA3, 0x9E, 0x03,
+	0xE8, 0xBB, 0x94, 0x03, 0xE8, 0xBC, 0xB8, 0x04, 0xF0, 0xA8, 0x97, 0x92,
+	0x04, 0xF0, 0xA8, 0x97, 0xAD, 0x03, 0xE9, 0x82, 0x94, 0x03, 0xE9, 0x83,
+	0xB1, 0x03, 0xE9, 0x84, 0x91, 0x04, 0xF0, 0xA8, 0x9C, 0xAE, 0x03, 0xE9,
+	0x84, 0x9B, 0x03, 0xE9, 0x88, 0xB8, 0x03, 0xE9, 0x8B, 0x97, 0x03, 0xE9,
+	0x8B, 0x98, 0x03, 0xE9, 0x89, 0xBC, 0x03, 0xE9, 0x8F, 0xB9, 0x03, 0xE9,
+	0x90, 0x95, 0x04, 0xF0, 0xA8, 0xAF, 0xBA, 0x03, 0xE9, 0x96, 0x8B, 0x03,
+	0xE4, 0xA6, 0x95, 0x03, 0xE9, 0x96, 0xB7, 0x04, 0xF0, 0xA8, 0xB5, 0xB7,
+	0x03, 0xE4, 0xA7, 0xA6, 0x03, 0xE9, 0x9B, 0x83, 0x03, 0xE5, 0xB6, 0xB2,
+	0x03, 0xE9, 0x9C, 0xA3, 0x04, 0xF0, 0xA9, 0x85, 0x85, 0x04, 0xF0, 0xA9,
+	0x88, 0x9A, 0x03, 0xE4, 0xA9, 0xAE, 0x03, 0xE4, 0xA9, 0xB6, 0x03, 0xE9,
+	0x9F, 0xA0, 0x04, 0xF0, 0xA9, 0x90, 0x8A, 0x03, 0xE4, 0xAA, 0xB2, 0x04,
+	0xF0, 0xA9, 0x92, 0x96, 0x03, 0xE9, 0xA0, 0x8B, 0x03, 0xE9, 0xA0, 0x8B,
+	0x03, 0xE9, 0xA0, 0xA9, 0x04, 0xF0, 0xA9, 0x96, 0xB6, 0x03, 0xE9, 0xA3,
+	0xA2, 0x03, 0xE4, 0xAC, 0xB3, 0x03, 0xE9, 0xA4, 0xA9, 0x03, 0xE9, 0xA6,
+	0xA7, 0x03, 0xE9, 0xA7, 0x82, 0x03, 0xE9, 0xA7, 0xBE, 0x03, 0xE4, 0xAF,
+	0x8E, 0x04, 0xF0, 0xA9, 0xAC, 0xB0, 0x03, 0xE9, 0xAC, 0x92, 0x03, 0xE9,
+	0xB1, 0x80, 0x03, 0xE9, 0xB3, 0xBD, 0x03, 0xE4, 0xB3, 0x8E, 0x03, 0xE4,
+	0xB3, 0xAD, 0x03, 0xE9, 0xB5, 0xA7, 0x04, 0xF0, 0xAA, 0x83, 0x8E, 0x03,
+	0xE4, 0xB3, 0xB8, 0x04, 0xF0, 0xAA, 0x84, 0x85, 0x04, 0xF0, 0xAA, 0x88,
+	0x8E, 0x04, 0xF0, 0xAA, 0x8A, 0x91, 0x03, 0xE9, 0xBA, 0xBB, 0x03, 0xE4,
+	0xB5, 0x96, 0x03, 0xE9, 0xBB, 0xB9, 0x03, 0xE9, 0xBB, 0xBE, 0x03, 0xE9,
+	0xBC, 0x85, 0x03, 0xE9, 0xBC, 0x8F, 0x03, 0xE9, 0xBC, 0x96, 0x03, 0xE9,
+	0xBC, 0xBB, 0x04, 0xF0, 0xAA, 0x98, 0x80
+};
+
+/** the first character of each composition multiplied by
+    64 plus the index of the second character, sorted
+*/
+static const unsigned long g_ACRNormalizeCompositionKeys[941] =
+{
+	0x000F1B, 0x000F5B, 0x000F9B, 0x001040, 0x001041, 0x001042, 0x001043, 0x001044,
+	0x001045, 0x001046, 0x001047, 0x001048, 0x001049, 0x00104B, 0x00104C, 0x00104D,
+	0x001051, 0x001053, 0x001056, 0x001086, 0x001091, 0x00109A, 0x0010C1, 0x0010C2,
+	0x0010C6, 0x0010CB, 0x0010D5, 0x001106, 0x00110B, 0x001111, 0x001115, 0x001117,
+	0x00111A, 0x001140, 0x001141, 0x001142, 0x001143, 0x001144, 0x001145, 0x001146,
+	0x001147, 0x001148, 0x00114B, 0x00114C, 0x00114D, 0x001151, 0x001155, 0x001156,
+	0x001157, 0x001159, 0x001186, 0x0011C1, 0x0011C2, 0x0011C4, 0x0011C5, 0x0011C6,
+	0x0011CB, 0x0011D5, 0x001202, 0x001206, 0x001207, 0x00120B, 0x001211, 0x001215,
+	0x001218, 0x001240, 0x001241, 0x001242, 0x001243, 0x001244, 0x001245, 0x001246,
+	0x001247, 0x001248, 0x00124B, 0x00124C, 0x00124D, 0x001251, 0x001256, 0x001259,
+	0x001282, 0x0012C1, 0x0012CB, 0x0012D1, 0x0012D5, 0x0012DA, 0x001301, 0x00130B,
+	0x001311, 0x001315, 0x001317, 0x00131A, 0x001341, 0x001346, 0x001351, 0x001380,
+	0x001381, 0x001383, 0x001386, 0x00138B, 0x001391, 0x001395, 0x001397, 0x00139A,
+	0x0013C0, 0x0013C1, 0x0013C2, 0x0013C3, 0x0013C4, 0x0013C5, 0x0013C6, 0x0013C7,
+	0x0013C8, 0x0013CA, 0x0013CB, 0x0013CC, 0x0013CD, 0x0013D0, 0x0013D1, 0x0013D6,
+	0x001401, 0x001406, 0x001481, 0x001486, 0x00148B, 0x00148C, 0x00148D, 0x001491,
+	0x001495, 0x00149A, 0x0014C1, 0x0014C2, 0x0014C6, 0x0014CB, 0x0014D1, 0x0014D4,
+	0x0014D5, 0x001506, 0x00150B, 0x001511, 0x001514, 0x001515, 0x001517, 0x00151A,
+	0x001540, 0x001541, 0x001542, 0x001543, 0x001544, 0x001545, 0x001547, 0x001548,
+	0x001549, 0x00154A, 0x00154B, 0x00154C, 0x00154D, 0x001550, 0x001551, 0x001552,
+	0x001556, 0x001557, 0x001559, 0x001583, 0x001591, 0x0015C0, 0x0015C1, 0x0015C2,
+	0x0015C6, 0x0015C7, 0x0015D1, 0x001606, 0x001607, 0x001640, 0x001641, 0x001642,
+	0x001643, 0x001644, 0x001646, 0x001647, 0x001648, 0x001651, 0x001681, 0x001682,
+	0x001686, 0x00168B, 0x001691, 0x00169A, 0x001840, 0x001841, 0x001842, 0x001843,
+	0x001844, 0x001845, 0x001846, 0x001847, 0x001848, 0x001849, 0x00184B, 0x00184C,
+	0x00184D, 0x001851, 0x001853, 0x001856, 0x001886, 0x001891, 0x00189A, 0x0018C1,
+	0x0018C2, 0x0018C6, 0x0018CB, 0x0018D5, 0x001906, 0x00190B, 0x001911, 0x001915,
+	0x001917, 0x00191A, 0x001940, 0x001941, 0x001942, 0x001943, 0x001944, 0x001945,
+	0x001946, 0x001947, 0x001948, 0x00194B, 0x00194C, 0x00194D, 0x001951, 0x001955,
+	0x001956, 0x001957, 0x001959, 0x001986, 0x0019C1, 0x0019C2, 0x0019C4, 0x0019C5,
+	0x0019C6, 0x0019CB, 0x0019D5, 0x001A02, 0x001A06, 0x001A07, 0x001A0B, 0x001A11,
+	0x001A15, 0x001A18, 0x001A1A, 0x001A40, 0x001A41, 0x001A42, 0x001A43, 0x001A44,
+	0x001A45, 0x001A47, 0x001A48, 0x001A4B, 0x001A4C, 0x001A4D, 0x001A51, 0x001A56,
+	0x001A59, 0x001A82, 0x001A8B, 0x001AC1, 0x001ACB, 0x001AD1, 0x001AD5, 0x001ADA,
+	0x001B01, 0x001B0B, 0x001B11, 0x001B15, 0x001B17, 0x001B1A, 0x001B41, 0x001B46,
+	0x001B51, 0x001B80, 0x001B81, 0x001B83, 0x001B86, 0x001B8B, 0x001B91, 0x001B95,
+	0x001B97, 0x001B9A, 0x001BC0, 0x001BC1, 0x001BC2, 0x001BC3, 0x001BC4, 0x001BC5,
+	0x001BC6, 0x001BC7, 0x001BC8, 0x001BCA, 0x001BCB, 0x001BCC, 0x001BCD, 0x001BD0,
+	0x001BD1, 0x001BD6, 0x001C01, 0x001C06, 0x001C81, 0x001C86, 0x001C8B, 0x001C8C,
+	0x001C8D, 0x001C91, 0x001C95, 0x001C9A, 0x001CC1, 0x001CC2, 0x001CC6, 0x001CCB,
+	0x001CD1, 0x001CD4, 0x001CD5, 0x001D06, 0x001D07, 0x001D0B, 0x001D11, 0x001D14,
+	0x001D15, 0x001D17, 0x001D1A, 0x001D40, 0x001D41, 0x001D42, 0x001D43, 0x001D44,
+	0x001D45, 0x001D47, 0x001D48, 0x001D49, 0x001D4A, 0x001D4B, 0x001D4C, 0x001D4D,
+	0x001D50, 0x001D51, 0x001D52, 0x001D56, 0x001D57, 0x001D59, 0x001D83, 0x001D91,
+	0x001DC0, 0x001DC1, 0x001DC2, 0x001DC6, 0x001DC7, 0x001DC9, 0x001DD1, 0x001E06,
+	0x001E07, 0x001E40, 0x001E41, 0x001E42, 0x001E43, 0x001E44, 0x001E46, 0x001E47,
+	0x001E48, 0x001E49, 0x001E51, 0x001E81, 0x001E82, 0x001E86, 0x001E8B, 0x001E91,
+	0x001E9A, 0x002A00, 0x002A01, 0x002A1C, 0x003080, 0x003081, 0x003083, 0x003088,
+	0x003104, 0x003141, 0x003181, 0x003184, 0x0031C1, 0x003280, 0x003281, 0x003283,
+	0x003288, 0x0033C1, 0x003500, 0x003501, 0x003503, 0x003508, 0x003541, 0x003544,
+	0x003547, 0x003584, 0x003601, 0x003700, 0x003701, 0x003704, 0x00370B, 0x003880,
+	0x003881, 0x003883, 0x003888, 0x003904, 0x003941, 0x003981, 0x003984, 0x0039C1,
+	0x003A80, 0x003A81, 0x003A83, 0x003A88, 0x003BC1, 0x003D00, 0x003D01, 0x003D03,
+	0x003D08, 0x003D41, 0x003D44, 0x003D47, 0x003D84, 0x003E01, 0x003F00, 0x003F01,
+	0x003F04, 0x003F0B, 0x004080, 0x004081, 0x004083, 0x004088, 0x0040C0, 0x0040C1,
+	0x0040C3, 0x0040C8, 0x004480, 0x004481, 0x0044C0, 0x0044C1, 0x005300, 0x005301,
+	0x005340, 0x005341, 0x005686, 0x0056C6, 0x005806, 0x005846, 0x005A01, 0x005A41,
+	0x005A87, 0x005AC7, 0x005FC6, 0x006800, 0x006801, 0x006803, 0x006808, 0x006811,
+	0x006840, 0x006841, 0x006843, 0x006848, 0x006851, 0x006BC0, 0x006BC1, 0x006BC3,
+	0x006BC8, 0x006BD1, 0x006C00, 0x006C01, 0x006C03, 0x006C08, 0x006C11, 0x006DCB,
+	0x007A84, 0x007AC4, 0x008984, 0x0089C4, 0x008A05, 0x008A45, 0x008B84, 0x008BC4,
+	0x00A48B, 0x00E440, 0x00E441, 0x00E444, 0x00E445, 0x00E44E, 0x00E44F, 0x00E45D,
+	0x00E540, 0x00E541, 0x00E54E, 0x00E54F, 0x00E5C0, 0x00E5C1, 0x00E5CE, 0x00E5CF,
+	0x00E5DD, 0x00E640, 0x00E641, 0x00E644, 0x00E645, 0x00E647, 0x00E64E, 0x00E64F,
+	0x00E7C0, 0x00E7C1, 0x00E7CE, 0x00E7CF, 0x00E84F, 0x00E940, 0x00E941, 0x00E944,
+	0x00E945, 0x00E947, 0x00E94F, 0x00EA40, 0x00EA41, 0x00EA4E, 0x00EA4F, 0x00EA5D,
+	0x00EB1D, 0x00EB9D, 0x00EC40, 0x00EC41, 0x00EC44, 0x00EC45, 0x00EC4E, 0x00EC4F,
+	0x00EC5C, 0x00EC5D, 0x00ED40, 0x00ED41, 0x00ED4E, 0x00ED4F, 0x00EDC0, 0x00EDC1,
+	0x00EDCE, 0x00EDCF, 0x00EDDC, 0x00EDDD, 0x00EE40, 0x00EE41, 0x00EE44, 0x00EE45,
+	0x00EE47, 0x00EE4E, 0x00EE4F, 0x00EE5C, 0x00EFC0, 0x00EFC1, 0x00EFCE, 0x00EFCF,
+	0x00F04E, 0x00F04F, 0x00F140, 0x00F141, 0x00F144, 0x00F145, 0x00F147, 0x00F14E,
+	0x00F14F, 0x00F15C, 0x00F240, 0x00F241, 0x00F24E, 0x00F24F, 0x00F25C, 0x00F25D,
+	0x00F280, 0x00F281, 0x00F29C, 0x00F2C0, 0x00F2C1, 0x00F2DC, 0x00F39D, 0x00F481,
+	0x00F487, 0x010187, 0x010405, 0x010407, 0x0104C1, 0x010540, 0x010545, 0x010547,
+	0x010585, 0x010587, 0x0105C7, 0x010600, 0x010604, 0x010605, 0x010607, 0x010681,
+	0x010787, 0x0108C4, 0x0108C5, 0x0108C7, 0x0108CA, 0x0109C7, 0x010AC7, 0x010B47,
+	0x010C05, 0x010C07, 0x010CC1, 0x010D40, 0x010D45, 0x010D47, 0x010D85, 0x010D87,
+	0x010DC7, 0x010E00, 0x010E04, 0x010E05, 0x010E07, 0x010E81, 0x010F87, 0x0110C4,
+	0x0110C5, 0x0110C7, 0x0110CA, 0x0111C7, 0x0112C7, 0x011347, 0x011587, 0x011D0C,
+	0x011D4C, 0x013607, 0x013647, 0x013A07, 0x013A47, 0x0189DE, 0x0189DF, 0x0189E0,
+	0x01921F, 0x01929F, 0x01B05F, 0x01B49F, 0x01B55F, 0x024A21, 0x024C21, 0x024CE1,
+	0x0271E2, 0x0271E3, 0x02D1E4, 0x02D1E5, 0x02D1E6, 0x02E4A8, 0x02F1A7, 0x02F1A8,
+	0x02F1E7, 0x0311A9, 0x032FEB, 0x0331AA, 0x0331AB, 0x0331AC, 0x0332AB, 0x0351AD,
+	0x0351AE, 0x0351ED, 0x03766F, 0x037670, 0x037671, 0x03772F, 0x040972, 0x06C173,
+	0x06C1F3, 0x06C273, 0x06C2F3, 0x06C373, 0x06C473, 0x06CEB3, 0x06CF33, 0x06CFB3,
+	0x06CFF3, 0x06D0B3, 0x078D84, 0x078DC4, 0x079684, 0x0796C4, 0x079886, 0x0798C6,
+	0x07A802, 0x07A805, 0x07A842, 0x07A845, 0x07AE02, 0x07AE42, 0x07B302, 0x07B342,
+	0x07C000, 0x07C001, 0x07C01C, 0x07C01D, 0x07C040, 0x07C041, 0x07C05C, 0x07C05D,
+	0x07C09D, 0x07C0DD, 0x07C11D, 0x07C15D, 0x07C19D, 0x07C1DD, 0x07C200, 0x07C201,
+	0x07C21C, 0x07C21D, 0x07C240, 0x07C241, 0x07C25C, 0x07C25D, 0x07C29D, 0x07C2DD,
+	0x07C31D, 0x07C35D, 0x07C39D, 0x07C3DD, 0x07C400, 0x07C401, 0x07C440, 0x07C441,
+	0x07C600, 0x07C601, 0x07C640, 0x07C641, 0x07C800, 0x07C801, 0x07C81C, 0x07C81D,
+	0x07C840, 0x07C841, 0x07C85C, 0x07C85D, 0x07C89D, 0x07C8DD, 0x07C91D, 0x07C95D,
+	0x07C99D, 0x07C9DD, 0x07CA00, 0x07CA01, 0x07CA1C, 0x07CA1D, 0x07CA40, 0x07CA41,
+	0x07CA5C, 0x07CA5D, 0x07CA9D, 0x07CADD, 0x07CB1D, 0x07CB5D, 0x07CB9D, 0x07CBDD,
+	0x07CC00, 0x07CC01, 0x07CC1C, 0x07CC40, 0x07CC41, 0x07CC5C, 0x07CE00, 0x07CE01,
+	0x07CE1C, 0x07CE40, 0x07CE41, 0x07CE5C, 0x07D000, 0x07D001, 0x07D040, 0x07D041,
+	0x07D200, 0x07D201, 0x07D240, 0x07D241, 0x07D400, 0x07D401, 0x07D41C, 0x07D440,
+	0x07D441, 0x07D45C, 0x07D640, 0x07D641, 0x07D65C, 0x07D800, 0x07D801, 0x07D81C,
+	0x07D81D, 0x07D840, 0x07D841, 0x07D85C, 0x07D85D, 0x07D89D, 0x07D8DD, 0x07D91D,
+	0x07D95D, 0x07D99D, 0x07D9DD, 0x07DA00, 0x07DA01, 0x07DA1C, 0x07DA1D, 0x07DA40,
+	0x07DA41, 0x07DA5C, 0x07DA5D, 0x07DA9D, 0x07DADD, 0x07DB1D, 0x07DB5D, 0x07DB9D,
+	0x07DBDD, 0x07DC1D, 0x07DD1D, 0x07DF1D, 0x07ED9D, 0x07EFC0, 0x07EFC1, 0x07EFDC,
+	0x07F19D, 0x07FD9D, 0x07FF80, 0x07FF81, 0x07FF9C, 0x08641B, 0x08649B, 0x08651B,
+	0x08741B, 0x08749B, 0x08751B, 0x0880DB, 0x08821B, 0x0882DB, 0x0888DB, 0x08895B,
+	0x088F1B, 0x0890DB, 0x08915B, 0x08921B, 0x08935B, 0x08985B, 0x08991B, 0x08995B,
+	0x089C9B, 0x089CDB, 0x089D9B, 0x089DDB, 0x089E9B, 0x089EDB, 0x089F1B, 0x089F5B,
+	0x08A09B, 0x08A0DB, 0x08A19B, 0x08A1DB, 0x08A45B, 0x08A49B, 0x08A89B, 0x08AA1B,
+	0x08AA5B, 0x08AADB, 0x08AC9B, 0x08ACDB, 0x08AD1B, 0x08AD5B, 0x0C11B4, 0x0C12F4,
+	0x0C1374, 0x0C13F4, 0x0C1474, 0x0C14F4, 0x0C1574, 0x0C15F4, 0x0C1674, 0x0C16F4,
+	0x0C1774, 0x0C17F4, 0x0C1874, 0x0C1934, 0x0C19B4, 0x0C1A34, 0x0C1BF4, 0x0C1BF5,
+	0x0C1CB4, 0x0C1CB5, 0x0C1D74, 0x0C1D75, 0x0C1E34, 0x0C1E35, 0x0C1EF4, 0x0C1EF5,
+	0x0C2774, 0x0C29B4, 0x0C2AF4, 0x0C2B74, 0x0C2BF4, 0x0C2C74, 0x0C2CF4, 0x0C2D74,
+	0x0C2DF4, 0x0C2E74, 0x0C2EF4, 0x0C2F74, 0x0C2FF4, 0x0C3074, 0x0C3134, 0x0C31B4,
+	0x0C3234, 0x0C33F4, 0x0C33F5, 0x0C34B4, 0x0C34B5, 0x0C3574, 0x0C3575, 0x0C3634,
+	0x0C3635, 0x0C36F4, 0x0C36F5, 0x0C3BF4, 0x0C3C34, 0x0C3C74, 0x0C3CB4, 0x0C3F74,
+	0x442676, 0x4426F6, 0x442976, 0x444C77, 0x444CB7, 0x44D1F8, 0x44D1F9, 0x452E7A,
+	0x452E7B, 0x452E7C, 0x456E3D, 0x456E7D, 0x464D7E
+};
+
+/** the composition of each key minus its first character
+*/
+static const short g_ACRNormalizeCompositionDeltas[941] =
+{
+	 8754,  8739,  8753,   127,   128,   129,   130,   191,   193,   485,   131,  7777,
+	  132,   396,   447,   449,  7775,  7615,   195,  7616,  7618,  7620,   195,   197,
+	  199,   201,   132,  7622,   202,  7624,  7628,  7630,  7626,   131,   132,   133,
+	 7799,   205,   207,   209,   134,  7797,   213,   447,   449,  7795,   483,   211,
+	 7635,  7637,  7640,   429,   213,  7641,   215,   217,   415,   219,   220,  7642,
+	 7646,   470,  7644,  7648,  7650,   131,   132,   133,   223,   225,   227,   231,
+	  134,  7807,   390,   447,   449,  7809,   229,  7651,   234,  7653,   413,  7655,
+	  235,  7657,   237,   241,  7658,   239,  7664,  7662,  7665,  7667,  7669,   426,
+	  245,   131,  7670,   249,  7672,   247,  7676,  7674,   131,   132,   133,   134,
+	  253,   255,   479,   135,  7807,   257,   386,   445,   447,   337,  7805,   411,
+	 7684,  7686,   258,  7686,   262,   446,   448,  7688,   260,  7692,   263,   265,
+	 7693,   269,  7695,   453,   267,  7702,   272,  7704,   454,   270,  7708,  7706,
+	  132,   133,   134,   275,   277,   279,   135,  7825,   281,   283,   382,   447,
+	  449,   346,  7823,  7709,   285,  7713,  7711,  7718,  7720,  7721,  7723,   285,
+	 7727,  7725,  7729,  7730,  7732,  7833,   132,   285,  7839,   473,  7733,   287,
+	 7837,  7835,   287,  7734,   289,   291,  7736,  7738,   127,   128,   129,   130,
+	  160,   162,   454,   131,  7746,   132,   365,   416,   418,  7744,  7584,   164,
+	 7585,  7587,  7589,   164,   166,   168,   170,   132,  7591,   171,  7593,  7597,
+	 7599,  7595,   131,   132,   133,  7768,   174,   176,   178,   134,  7766,   182,
+	  416,   418,  7764,   452,   180,  7604,  7606,  7609,   398,   182,  7610,   184,
+	  186,   384,   188,   189,  7611,  7615,   439,  7613,  7617,  7619,  7726,   131,
+	  132,   133,   192,   194,   196,   134,  7776,   359,   416,   418,  7778,   198,
+	 7620,   203,   390,  7622,   382,  7624,   204,  7626,   206,   210,  7627,   208,
+	 7633,  7631,  7634,  7636,  7638,   395,   214,   131,  7639,   218,  7641,   216,
+	 7645,  7643,   131,   132,   133,   134,   222,   224,   448,   135,  7776,   226,
+	  355,   414,   416,   306,  7774,   380,  7653,  7655,   227,  7655,   231,   415,
+	  417,  7657,   229,  7661,   232,   234,  7662,   238,  7664,   422,   236,  7671,
+	 7715,   241,  7673,   423,   239,  7677,  7675,   132,   133,   134,   244,   246,
+	  248,   135,  7794,   250,   252,   351,   416,   418,   315,  7792,  7678,   254,
+	 7682,  7680,  7687,  7689,  7690,  7692,   254,  7696,  7694,  7713,  7698,  7699,
+	 7701,  7802,   132,   254,  7808,   442,  7702,   134,  7806,  7712,  7804,   256,
+	 7703,   258,   260,  7705,  7707,  8005,   733,  7961,  7652,  7650,  7656,  7654,
+	  282,   309,   310,   284,  7489,  7670,  7668,  7674,  7672,  7519,  7678,  7676,
+	 7682,  7680,  7543,   343,  7545,   340,   294,   255,   251,   249,   253,  7621,
+	 7619,  7625,  7623,   251,   278,   279,   253,  7458,  7639,  7637,  7643,  7641,
+	 7488,  7647,  7645,  7651,  7649,  7512,   312,  7514,   309,   263,   224,   220,
+	  218,   222,  7598,  7596,  7602,  7600,  7598,  7596,  7602,  7600,  7426,  7428,
+	 7426,  7428,  7428,  7430,  7428,  7430,  7434,  7434,  7430,  7430,  7440,  7440,
+	 7440,  7440,  7452,  7484,  7482,  7488,  7486,  7490,  7484,  7482,  7488,  7486,
+	 7490,  7483,  7481,  7487,  7485,  7489,  7483,  7481,  7487,  7485,  7489,    55,
+	    2,     2,   -70,   -70,  7156,  7156,     2,     2,  -163,  7209,   -11,  7208,
+	 7207,  7031,  7032,  7211,  7219,   -13,  7043,  7044,  7219,   -14,  7057,  7058,
+	 7221,  7233,   -15,  7232,  7231,    17,  7071,  7072,  7257,   -19,  7081,  7082,
+	 7243,  7237,   -23,  7236,  7235,     6,  7092,  7249,   -26,  7103,  7104,  7251,
+	 7176,  7190,  7103,    -5,  7168,  7167,  6991,  6992,  7173,  7170,  7101,    -8,
+	 7003,  7004,  7101,    -9,  7017,  7018,  7183,  7180,  7101,   -10,  7192,  7191,
+	   17,  7031,  7032,  7197,  7097,    13,  7041,  7042,  7203,  7204,  7093,     8,
+	 7196,  7195,     6,  7051,  7052,  7201,  7091,     5,  7063,  7064,  7213,  7210,
+	 7176,   -58,  7181,  7191,   -27,  7196,  7206,     1,     2,     1,   192,   194,
+	  -16,   -21,   193,   -20,   171,   198,   199,   -11,   202,     1,   204,   -14,
+	  200,   203,   -21,   205,   207,   205,   205,   191,   161,   163,    32,    27,
+	  162,    28,   140,   167,   168,    37,   171,     1,   173,    34,   169,   172,
+	   27,   174,   176,   174,   174,   160,     1,     2,     2,     2,     2,     2,
+	    2,    -5,    -4,    -2,   -36,   -36,     1,     1,   -21,     1,     1,     1,
+	    4,     5,     4,     1,     5,     2,     4,     6,     4,     2,     1,     4,
+	    1,     2,     1,     4,     6,     4,     1,     3,     5,     1,     1,     1,
+	    1,     1,     1,     1,     1,     1,     1,     2,     2,     1,     2,     2,
+	    2,     2,     6,     6,    12,    22,    12,    22,    14,    14,    12,    12,
+	    2,     4,     6,   128,     2,     4,     6,   128,   128,   128,   128,   128,
+	  128,   128,     2,     4,     6,   128,     2,     4,     6,   128,   128,   128,
+	  128,   128,   128,   128,     2,     4,     2,     4,     2,     4,     2,     4,
+	    2,     4,     6,   112,     2,     4,     6,   112,   112,   112,   112,   112,
+	  112,   112,     2,     4,     6,   112,     2,     4,     6,   112,   112,   112,
+	  112,   112,   112,   112,     2,     4,     6,     2,     4,     6,     2,     4,
+	    6,     2,     4,     6,     2,     4,     2,     4,     2,     4,     2,     4,
+	    2,     4,     6,     2,     4,     6,     2,     4,     6,     2,     4,     6,
+	   64,     2,     4,     6,    64,    64,    64,    64,    64,    64,    64,     2,
+	    4,     6,    64,     2,     4,     6,    64,    64,    64,    64,    64,    64,
+	   64,    66,    78,   118,     1,    14,    15,    16,     1,     1,   -33,   -32,
+	  -31,    10,     9,    26,    -3,    -3,    -6,     1,     1,     1,     1,     1,
+	    5,     1,     2,     1,    32,     1,    12,    12,     2,     2,     2,     2,
+	    6,     6,   100,   100,     2,     2,     2,     2,    81,    81,    10,     5,
+	    5,     4,    56,    56,    56,    56,    78,     1,     1,     1,     1,     1,
+	    1,     1,     1,     1,     1,     1,     1,     1,     1,     1,     1,     2,
+	    1,     2,     1,     2,     1,     2,     1,     2,     1,    78,     1,     1,
+	    1,     1,     1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+	    1,     1,     2,     1,     2,     1,     2,     1,     2,     1,     2,     8,
+	    8,     8,     8,     1,     1,     1,     6,    -3,    -3,     4,     5,     3,
+	    2,     5,     2,     2,     3
+};
+
+////////////////////////////////////////////////////////////
+//
+// PRIVATE FUNCTIONS
+//
+////////////////////////////////////////////////////////////
+
+/** get the property index of a character
+*/
+static ACR_Byte_t ACR_NormalizeProperties(
+	ACR_Unicode_t u)
+{
+	if(u >= ACR_NORMALIZE_LIMIT)
+	{
+		return 0;
+	}
+	return g_ACRNormalizeBlocks[(((ACR_Length_t)g_ACRNormalizePages[u >> ACR_NORMALIZE_BLOCK_BITS]) << ACR_NORMALIZE_BLOCK_BITS) | (u & ACR_NORMALIZE_BLOCK_MASK)];
+}
+
+/** get the canonical combining class of a character
+*/
+#define ACR_NORMALIZE_CCC(u) g_ACRNormalizeCombiningClass[ACR_NormalizeProperties(u)]
+
+/** get the offset of the decomposition of a character in
+    g_ACRNormalizeDecompositionData or 0
+*/
+static ACR_Length_t ACR_NormalizeDecompositionOffset(
+	ACR_Unicode_t u)
+{
+	if(u >= ACR_NORMALIZE_LIMIT)
+	{
+		return 0;
+	}
+	return g_ACRNormalizeDecompositionBlocks[(((ACR_Length_t)g_ACRNormalizeDecompositionPages[u >> ACR_NORMALIZE_BLOCK_BITS]) << ACR_NORMALIZE_BLOCK_BITS) | (u & ACR_NORMALIZE_BLOCK_MASK)];
+}
+
+/** get the number of bytes at the start of the data that
+    are less than firstByte
+*/
+static ACR_Length_t ACR_NormalizeSkip(
+	const ACR_Byte_t* src,
+	ACR_Length_t length,
+	ACR_Byte_t firstByte)
+{
+	ACR_Length_t pos = 0;
+	ACR_Block_t low = (~((ACR_Block_t)0)) / 0xFF;
+	ACR_Block_t high = low * 0x80;
+	ACR_Block_t block;
+
+	#if ACR_HAS_SSE2 == ACR_BOOL_TRUE
+	// bytes from firstByte to 0xFF are the signed values from
+	// firstByte - 256 to -1
+	__m128i below = _mm_set1_epi8((char)(firstByte - 1));
+	__m128i zero = _mm_setzero_si128();
+	while((length - pos) >= 16)
+	{
+		__m128i v = _mm_loadu_si128((const __m128i*)(src + pos));
+		if(_mm_movemask_epi8(_mm_and_si128(_mm_cmpgt_epi8(v, below), _mm_cmplt_epi8(v, zero))) != 0)
+		{
+			break;
+		}
+		pos += 16;
+	}
+	#endif // #if ACR_HAS_SSE2 == ACR_BOOL_TRUE
+
+	while((length - pos) >= ACR_BYTES_PER_BLOCK)
+	{
+		memcpy(&block, src + pos, ACR_BYTES_PER_BLOCK);
+		// adding to the low 7 bits never carries into the next
+		// byte and sets the high bit when they are at least
+		// the low 7 bits of firstByte
+		if((((block & (~high)) + (low * (0x80 - (firstByte & 0x7F)))) & block & high) != 0)
+		{
+			break;
+		}
+		pos += ACR_BYTES_PER_BLOCK;
+	}
+
+	while((pos < length) && (src[pos] < firstByte))
+	{
+		pos++;
+	}
+	return pos;
+}
+
+/** the quick check algorithm from unicode standard annex #15
+	\returns ACR_INFO_YES, ACR_INFO_NO, or ACR_INFO_UNKNOWN
+*/
+static ACR_Info_t ACR_NormalizeQuickCheck(
+	const ACR_Byte_t* src,
+	ACR_Length_t length,
+	ACR_NormalForm_t form)
+{
+	ACR_Info_t result = ACR_INFO_YES;
+	ACR_Byte_t firstByte = (form == ACR_NORMAL_FORM_NFC) ? ACR_NORMALIZE_NFC_FIRST_BYTE : ACR_NORMALIZE_NFD_FIRST_BYTE;
+	ACR_Byte_t noFlag = (form == ACR_NORMAL_FORM_NFC) ? ACR_NORMALIZE_NFC_NO : ACR_NORMALIZE_NFD_NO;
+	ACR_Byte_t lastClass = 0;
+	ACR_Byte_t properties;
+	ACR_Byte_t ccc;
+	ACR_Length_t pos = 0;
+	ACR_Length_t skip;
+	ACR_Length_t bytes;
+
+	while(pos < length)
+	{
+		// characters before the first byte are all starters
+		// that are normalized
+		skip = ACR_NormalizeSkip(src + pos, length - pos, firstByte);
+		if(skip > 0)
+		{
+			lastClass = 0;
+			pos += skip;
+			if(pos == length)
+			{
+				break;
+			}
+		}
+
+		bytes = ACR_UTF8_BYTE_COUNT(src[pos]);
+		properties = ACR_NormalizeProperties(ACR_Utf8ToUnicode(src + pos, (int)bytes));
+		ccc = g_ACRNormalizeCombiningClass[properties];
+		if(((lastClass > ccc) && (ccc != 0)) ||
+		   ((g_ACRNormalizeFlags[properties] & noFlag) != 0))
+		{
+			return ACR_INFO_NO;
+		}
+		if((form == ACR_NORMAL_FORM_NFC) && ((g_ACRNormalizeFlags[properties] & ACR_NORMALIZE_NFC_MAYBE) != 0))
+		{
+			result = ACR_INFO_UNKNOWN;
+		}
+		lastClass = ccc;
+		pos += bytes;
+	}
+	return result;
+}
+
+/** add the full canonical decomposition of valid UTF8 data
+    to a buffer of ACR_Unicode_t values in canonical order
+*/
+static ACR_Info_t ACR_NormalizeDecompose(
+	ACR_VarBuffer_t* work,
+	const ACR_Byte_t* src,
+	ACR_Length_t length)
+{
+	ACR_Unicode_t* out;
+	ACR_Unicode_t u;
+	ACR_Unicode_t moving;
+	ACR_Byte_t ccc;
+	ACR_Length_t pos = 0;
+	ACR_Length_t count = 0;
+	ACR_Length_t offset;
+	ACR_Length_t end;
+	ACR_Length_t bytes;
+	ACR_Length_t i;
+	ACR_Length_t j;
+
+	// a character decomposes to at most 4 characters that
+	// each need at least 1 byte of UTF8
+	if(ACR_VarBufferReserve(work, length * 4 * sizeof(ACR_Unicode_t)) != ACR_INFO_OK)
+	{
+		return ACR_INFO_ERROR;
+	}
+	out = (ACR_Unicode_t*)work->m_Buffer.m_Pointer;
+
+	while(pos < length)
+	{
+		bytes = ACR_UTF8_BYTE_COUNT(src[pos]);
+		u = ACR_Utf8ToUnicode(src + pos, (int)bytes);
+		pos += bytes;
+		if((u >= ACR_HANGUL_S_BASE) && (u < (ACR_HANGUL_S_BASE + ACR_HANGUL_S_COUNT)))
+		{
+			u -= ACR_HANGUL_S_BASE;
+			out[count++] = ACR_HANGUL_L_BASE + (u / ACR_HANGUL_N_COUNT);
+			out[count++] = ACR_HANGUL_V_BASE + ((u % ACR_HANGUL_N_COUNT) / ACR_HANGUL_T_COUNT);
+			if((u % ACR_HANGUL_T_COUNT) != 0)
+			{
+				out[count++] = ACR_HANGUL_T_BASE + (u % ACR_HANGUL_T_COUNT);
+			}
+			continue;
+		}
+		offset = ACR_NormalizeDecompositionOffset(u);
+		if(offset == 0)
+		{
+			out[count++] = u;
+			continue;
+		}
+		end = offset + 1 + g_ACRNormalizeDecompositionData[offset];
+		offset++;
+		while(offset < end)
+		{
+			bytes = ACR_UTF8_BYTE_COUNT(g_ACRNormalizeDecompositionData[offset]);
+			out[count++] = ACR_Utf8ToUnicode(g_ACRNormalizeDecompositionData + offset, (int)bytes);
+			offset += bytes;
+		}
+	}
+
+	// put each run of non-starters in order of combining class
+	// without changing the order of characters with the same
+	// class
+	for(i = 1; i < count; i++)
+	{
+		moving = out[i];
+		ccc = ACR_NORMALIZE_CCC(moving);
+		if(ccc == 0)
+		{
+			continue;
+		}
+		j = i;
+		while((j > 0) && (ACR_NORMALIZE_CCC(out[j - 1]) > ccc))
+		{
+			out[j] = out[j - 1];
+			j--;
+		}
+		out[j] = moving;
+	}
+
+	work->m_Buffer.m_Length = count * sizeof(ACR_Unicode_t);
+	return ACR_INFO_OK;
+}
+
+/** get the canonical composition of two characters
+	\returns the composition or 0 if there is none
+*/
+static ACR_Unicode_t ACR_NormalizeComposePair(
+	ACR_Unicode_t first,
+	ACR_Unicode_t second)
+{
+	ACR_Byte_t secondIndex;
+	unsigned long key;
+	ACR_Length_t low = 0;
+	ACR_Length_t high = sizeof(g_ACRNormalizeCompositionKeys) / sizeof(g_ACRNormalizeCompositionKeys[0]);
+	ACR_Length_t mid;
+
+	// hangul L + V and LV + T
+	if((first >= ACR_HANGUL_L_BASE) && (first < (ACR_HANGUL_L_BASE + ACR_HANGUL_L_COUNT)) &&
+	   (second >= ACR_HANGUL_V_BASE) && (second < (ACR_HANGUL_V_BASE + ACR_HANGUL_V_COUNT)))
+	{
+		return ACR_HANGUL_S_BASE + ((((first - ACR_HANGUL_L_BASE) * ACR_HANGUL_V_COUNT) + (second - ACR_HANGUL_V_BASE)) * ACR_HANGUL_T_COUNT);
+	}
+	if((first >= ACR_HANGUL_S_BASE) && (first < (ACR_HANGUL_S_BASE + ACR_HANGUL_S_COUNT)) &&
+	   (((first - ACR_HANGUL_S_BASE) % ACR_HANGUL_T_COUNT) == 0) &&
+	   (second > ACR_HANGUL_T_BASE) && (second < (ACR_HANGUL_T_BASE + ACR_HANGUL_T_COUNT)))
+	{
+		return first + (second - ACR_HANGUL_T_BASE);
+	}
+
+	secondIndex = g_ACRNormalizeSecond[ACR_NormalizeProperties(second)];
+	if((secondIndex == 0) || (first >= ACR_NORMALIZE_LIMIT))
+	{
+		return 0;
+	}
+	key = (((unsigned long)first) << 6) | (unsigned long)(secondIndex - 1);
+	while(low < high)
+	{
+		mid = low + ((high - low) / 2);
+		if(g_ACRNormalizeCompositionKeys[mid] < key)
+		{
+			low = mid + 1;
+		}
+		else
+		{
+			high = mid;
+		}
+	}
+	if((low < (sizeof(g_ACRNormalizeCompositionKeys) / sizeof(g_ACRNormalizeCompositionKeys[0]))) &&
+	   (g_ACRNormalizeCompositionKeys[low] == key))
+	{
+		return (ACR_Unicode_t)((long)first + g_ACRNormalizeCompositionDeltas[low]);
+	}
+	return 0;
+}
+
+/** canonical composition of decomposed characters in place
+	\returns the new number of characters
+*/
+static ACR_Length_t ACR_NormalizeCompose(
+	ACR_Unicode_t* chars,
+	ACR_Length_t count)
+{
+	ACR_Length_t starterPos = 0;
+	ACR_Length_t out = 1;
+	ACR_Length_t i;
+	ACR_Unicode_t composite;
+	unsigned int lastClass;
+	unsigned int ccc;
+
+	if(count == 0)
+	{
+		return 0;
+	}
+
+	// a first character that is not a starter never composes
+	lastClass = ACR_NORMALIZE_CCC(chars[0]);
+	if(lastClass != 0)
+	{
+		lastClass = 256;
+	}
+	for(i = 1; i < count; i++)
+	{
+		ccc = ACR_NORMALIZE_CCC(chars[i]);
+		// a character composes with the last starter if there
+		// is nothing between them or if everything between them
+		// has a lower combining class
+		if((lastClass < ccc) || (lastClass == 0))
+		{
+			composite = ACR_NormalizeComposePair(chars[starterPos], chars[i]);
+			if(composite != 0)
+			{
+				chars[starterPos] = composite;
+				continue;
+			}
+		}
+		if(ccc == 0)
+		{
+			starterPos = out;
+		}
+		lastClass = ccc;
+		chars[out++] = chars[i];
+	}
+	return out;
+}
+
+////////////////////////////////////////////////////////////
+//
+// PUBLIC FUNCTIONS
+//
+////////////////////////////////////////////////////////////
+
+/**********************************************************/
+ACR_Info_t ACR_StringIsNormalized(
+	ACR_String_t src,
+	ACR_NormalForm_t form)
+{
+	if(ACR_Utf8Validate((const ACR_Byte_t*)src.m_Buffer.m_Pointer, src.m_Buffer.m_Length, ACR_NULL) != ACR_INFO_VALID)
+	{
+		return ACR_INFO_INVALID;
+	}
+	return ACR_NormalizeQuickCheck((const ACR_Byte_t*)src.m_Buffer.m_Pointer, src.m_Buffer.m_Length, form);
+}
+
+/**********************************************************/
+ACR_Info_t ACR_StringNormalize(
+	ACR_String_t src,
+	ACR_NormalForm_t form,
+	ACR_VarBuffer_t* dst,
+	ACR_String_t* result)
+{
+	const ACR_Byte_t* mem = (const ACR_Byte_t*)src.m_Buffer.m_Pointer;
+	ACR_VarBuffer_t work;
+	ACR_Unicode_t* chars;
+	ACR_Byte_t* out;
+	ACR_Length_t count;
+	ACR_Length_t start;
+	ACR_Length_t length = 0;
+	ACR_Length_t i;
+	ACR_STRING(normalized);
+
+	if((dst == ACR_NULL) || (result == ACR_NULL))
+	{
+		return ACR_INFO_ERROR;
+	}
+	if(ACR_Utf8Validate(mem, src.m_Buffer.m_Length, ACR_NULL) != ACR_INFO_VALID)
+	{
+		return ACR_INFO_INVALID;
+	}
+	if(ACR_NormalizeQuickCheck(mem, src.m_Buffer.m_Length, form) == ACR_INFO_YES)
+	{
+		// nothing to copy
+		ACR_STRING_REFERENCE(normalized, mem, src.m_Buffer.m_Length, src.m_Count);
+		(*result) = normalized;
+		return ACR_INFO_EQUAL;
+	}
+
+	ACR_VarBufferInit(&work);
+	if(ACR_NormalizeDecompose(&work, mem, src.m_Buffer.m_Length) != ACR_INFO_OK)
+	{
+		ACR_VarBufferDeInit(&work);
+		return ACR_INFO_ERROR;
+	}
+	chars = (ACR_Unicode_t*)work.m_Buffer.m_Pointer;
+	count = work.m_Buffer.m_Length / sizeof(ACR_Unicode_t);
+	if(form == ACR_NORMAL_FORM_NFC)
+	{
+		count = ACR_NormalizeCompose(chars, count);
+	}
+
+	start = dst->m_Buffer.m_Length;
+	if(ACR_VarBufferReserve(dst, start + (count * 4)) != ACR_INFO_OK)
+	{
+		ACR_VarBufferDeInit(&work);
+		return ACR_INFO_ERROR;
+	}
+	out = ((ACR_Byte_t*)dst->m_Buffer.m_Pointer) + start;
+	for(i = 0; i < count; i++)
+	{
+		length += (ACR_Length_t)ACR_UnicodeToUtf8(chars[i], out + length);
+	}
+	ACR_VarBufferDeInit(&work);
+
+	if((length == src.m_Buffer.m_Length) && ((length == 0) || (memcmp(out, mem, (size_t)length) == 0)))
+	{
+		// the quick check was not sure but nothing changed
+		ACR_STRING_REFERENCE(normalized, mem, src.m_Buffer.m_Length, src.m_Count);
+		(*result) = normalized;
+		return ACR_INFO_EQUAL;
+	}
+
+	ACR_VarBufferAppend(dst, ACR_NULL, length);
+	ACR_STRING_REFERENCE(normalized, out, length, count);
+	(*result) = normalized;
+	return ACR_INFO_NOT_EQUAL;
+}
@@ -115,6 +115,71 @@ static char* g_ACRInfoStringLookup[ACR_INFO_COUNT+1] =
     ""                      // ACR_INFO_COUNT
 };
 
+/** info strings with the length and character count
+    known when compiling
+*/
+static const ACR_String_t g_ACRInfoStrings[ACR_INFO_COUNT+1] =
+{
+    //
+    // COMPARISON
+    //
+    ACR_STRING_LITERAL(ACR_INFO_STR_EQUAL),     // ACR_INFO_EQUAL
+    ACR_STRING_LITERAL(ACR_INFO_STR_NOT_EQUAL), // ACR_INFO_NOT_EQUAL
+    ACR_STRING_LITERAL(ACR_INFO_STR_LESS),      // ACR_INFO_LESS
+    ACR_STRING_LITERAL(ACR_INFO_STR_GREATER),   // ACR_INFO_GREATER
+    ACR_STRING_LITERAL(ACR_INFO_STR_UNKNOWN),   // ACR_INFO_UNKNOWN
+
+    //
+    // POSITIVE, NEGATIVE
+    //
+    ACR_STRING_LITERAL(ACR_INFO_STR_TRUE),      // ACR_INFO_TRUE
+    ACR_STRING_LITERAL(ACR_INFO_STR_FALSE),     // ACR_INFO_FALSE
+    ACR_STRING_LITERAL(ACR_INFO_STR_OK),        // ACR_INFO_OK
+    ACR_STRING_LITERAL(ACR_INFO_STR_ERROR),     // ACR_INFO_ERROR
+    ACR_STRING_LITERAL(ACR_INFO_STR_ENABLED),   // ACR_INFO_ENABLED
+    ACR_STRING_LITERAL(ACR_INFO_STR_DISABLED),  // ACR_INFO_DISABLED
+    ACR_STRING_LITERAL(ACR_INFO_STR_YES),       // ACR_INFO_YES
+    ACR_STRING_LITERAL(ACR_INFO_STR_NO),        // ACR_INFO_NO
+    ACR_STRING_LITERAL(ACR_INFO_STR_ON),        // ACR_INFO_ON
+    ACR_STRING_LITERAL(ACR_INFO_STR_OFF),       // ACR_INFO_OFF
+    ACR_STRING_LITERAL(ACR_INFO_STR_START),     // ACR_INFO_START
+    ACR_STRING_LITERAL(ACR_INFO_STR_STOP),      // ACR_INFO_STOP
+    ACR_STRING_LITERAL(ACR_INFO_STR_ACCEPT),    // ACR_INFO_ACCEPT
+    ACR_STRING_LITERAL(ACR_INFO_STR_IGNORE),    // ACR_INFO_IGNORE
+    ACR_STRING_LITERAL(ACR_INFO_STR_VALID),     // ACR_INFO_VALID
+    ACR_STRING_LITERAL(ACR_INFO_STR_INVALID),   // ACR_INFO_INVALID
+
+    //
+    // POSITION
+    //
+    ACR_STRING_LITERAL(ACR_INFO_STR_TOP),       // ACR_INFO_TOP
+    ACR_STRING_LITERAL(ACR_INFO_STR_BOTTOM),    // ACR_INFO_BOTTOM
+    ACR_STRING_LITERAL(ACR_INFO_STR_FIRST),     // ACR_INFO_FIRST
+    ACR_STRING_LITERAL(ACR_INFO_STR_LAST),      // ACR_INFO_LAST
+    ACR_STRING_LITERAL(ACR_INFO_STR_PREVIOUS),  // ACR_INFO_PREVIOUS
+    ACR_STRING_LITERAL(ACR_INFO_STR_NEXT),      // ACR_INFO_NEXT
+    ACR_STRING_LITERAL(ACR_INFO_STR_CURRENT),   // ACR_INFO_CURRENT
+
+    // DIRECTION
+    ACR_STRING_LITERAL(ACR_INFO_STR_UP),        // ACR_INFO_UP
+    ACR_STRING_LITERAL(ACR_INFO_STR_DOWN),      // ACR_INFO_DOWN
+    ACR_STRING_LITERAL(ACR_INFO_STR_LEFT),      // ACR_INFO_LEFT
+    ACR_STRING_LITERAL(ACR_INFO_STR_RIGHT),     // ACR_INFO_RIGHT
+
+    // AGE
+    ACR_STRING_LITERAL(ACR_INFO_STR_OLD),       // ACR_INFO_OLD
+    ACR_STRING_LITERAL(ACR_INFO_STR_NEW),       // ACR_INFO_NEW
+
+    // INSTRUCTION
+    ACR_STRING_LITERAL(ACR_INFO_STR_BEGIN),     // ACR_INFO_BEGIN
+    ACR_STRING_LITERAL(ACR_INFO_STR_READY),     // ACR_INFO_READY
+    ACR_STRING_LITERAL(ACR_INFO_STR_WAIT),      // ACR_INFO_WAIT
+    ACR_STRING_LITERAL(ACR_INFO_STR_GO),        // ACR_INFO_GO
+    ACR_STRING_LITERAL(ACR_INFO_STR_END),       // ACR_INFO_END
+
+    ACR_STRING_LITERAL("")                      // ACR_INFO_COUNT
+};
+
 /** day of week string lookup table
 */
 static char* g_ACRDayOfWeekStringLookup[ACR_DAY_COUNT+1] =
@@ -129,6 +194,21 @@ static char* g_ACRDayOfWeekStringLookup[ACR_DAY_COUNT+1] =
     ""                      // ACR_DAY_COUNT
 };
 
+/** day of week strings with the length and character count
+    known when compiling
+*/
+static const ACR_String_t g_ACRDayOfWeekStrings[ACR_DAY_COUNT+1] =
+{
+    ACR_STRING_LITERAL(ACR_DAY_STR_SUNDAY),     // ACR_DAY_SUNDAY
+    ACR_STRING_LITERAL(ACR_DAY_STR_MONDAY),     // ACR_DAY_MONDAY
+    ACR_STRING_LITERAL(ACR_DAY_STR_TUESDAY),    // ACR_DAY_TUESDAY
+    ACR_STRING_LITERAL(ACR_DAY_STR_WEDNESDAY),  // ACR_DAY_WEDNESDAY
+    ACR_STRING_LITERAL(ACR_DAY_STR_THURSDAY),   // ACR_DAY_THURSDAY
+    ACR_STRING_LITERAL(ACR_DAY_STR_FRIDAY),     // ACR_DAY_FRIDAY
+    ACR_STRING_LITERAL(ACR_DAY_STR_SATURDAY),   // ACR_DAY_SATURDAY
+    ACR_STRING_LITERAL("")                      // ACR_DAY_COUNT
+};
+
 /** month string lookup table
 */
 static char* g_ACRMonthStringLookup[ACR_MONTH_COUNT+1] =
@@ -148,6 +228,115 @@ static char* g_ACRMonthStringLookup[ACR_MONTH_COUNT+1] =
     ""                      // ACR_MONTH_COUNT
 };
 
+/** month strings with the length and character count
+    known when compiling
+*/
+static const ACR_String_t g_ACRMonthStrings[ACR_MONTH_COUNT+1] =
+{
+    ACR_STRING_LITERAL(ACR_MONTH_STR_JANUARY),  // ACR_MONTH_JANUARY
+    ACR_STRING_LITERAL(ACR_MONTH_STR_FEBRUARY), // ACR_MONTH_FEBRUARY
+    ACR_STRING_LITERAL(ACR_MONTH_STR_MARCH),    // ACR_MONTH_MARCH
+    ACR_STRING_LITERAL(ACR_MONTH_STR_APRIL),    // ACR_MONTH_APRIL
+    ACR_STRING_LITERAL(ACR_MONTH_STR_MAY),      // ACR_MONTH_MAY
+    ACR_STRING_LITERAL(ACR_MONTH_STR_JUNE),     // ACR_MONTH_JUNE
+    ACR_STRING_LITERAL(ACR_MONTH_STR_JULY),     // ACR_MONTH_JULY
+    ACR_STRING_LITERAL(ACR_MONTH_STR_AUGUST),   // ACR_MONTH_AUGUST
+    ACR_STRING_LITERAL(ACR_MONTH_STR_SEPTEMBER),// ACR_MONTH_SEPTEMBER
+    ACR_STRING_LITERAL(ACR_MONTH_STR_OCTOBER),  // ACR_MONTH_OCTOBER
+    ACR_STRING_LITERAL(ACR_MONTH_STR_NOVEMBER), // ACR_MONTH_NOVEMBER
+    ACR_STRING_LITERAL(ACR_MONTH_STR_DECEMBER), // ACR_MONTH_DECEMBER
+    ACR_STRING_LITERAL("")                      // ACR_MONTH_COUNT
+};
+
+/** info string minimal perfect hash displacements
+    generated with ACR_EnumTableBuild()
+*/
+static const unsigned short g_ACRInfoDisplacements[20] =
+{
+    4, 0, 0, 0, 0, 2, 5, 2, 0, 0,
+    26, 31, 0, 47, 20, 10, 3, 2, 7, 19
+};
+
+/** info string minimal perfect hash slots generated
+    with ACR_EnumTableBuild()
+*/
+static const ACR_Count_t g_ACRInfoSlots[ACR_INFO_COUNT] =
+{
+    9, 32, 35, 2, 0, 28, 38, 36, 31, 7,
+    15, 21, 22, 12, 13, 10, 27, 17, 8, 20,
+    19, 14, 33, 5, 18, 6, 1, 4, 30, 16,
+    34, 23, 25, 24, 26, 37, 29, 11, 3
+};
+
+/** info string lookup with one compare
+*/
+static const ACR_EnumTable_t g_ACRInfoTable =
+{
+    (const char* const*)g_ACRInfoStringLookup,
+    g_ACRInfoDisplacements,
+    g_ACRInfoSlots,
+    ACR_INFO_COUNT,
+    20,
+    {ACR_NULL, ACR_ZERO_LENGTH, ACR_BUFFER_FLAGS_NONE}
+};
+
+/** day of week string minimal perfect hash displacements
+    generated with ACR_EnumTableBuild()
+*/
+static const unsigned short g_ACRDayOfWeekDisplacements[4] =
+{
+    1, 0, 10, 2
+};
+
+/** day of week string minimal perfect hash slots generated
+    with ACR_EnumTableBuild()
+*/
+static const ACR_Count_t g_ACRDayOfWeekSlots[ACR_DAY_COUNT] =
+{
+    3, 4, 5, 1, 0, 6, 2
+};
+
+/** day of week string lookup with one compare
+*/
+static const ACR_EnumTable_t g_ACRDayOfWeekTable =
+{
+    (const char* const*)g_ACRDayOfWeekStringLookup,
+    g_ACRDayOfWeekDisplacements,
+    g_ACRDayOfWeekSlots,
+    ACR_DAY_COUNT,
+    4,
+    {ACR_NULL, ACR_ZERO_LENGTH, ACR_BUFFER_FLAGS_NONE}
+};
+
+/** month string minimal perfect hash displacements
+    generated with ACR_EnumTableBuild()
+*/
+static const unsigned short g_ACRMonthDisplacements[7] =
+{
+    0, 4, 0, 1, 23, 6, 0
+};
+
+/** month string minimal perfect hash slots generated
+    with ACR_EnumTableBuild()
+*/
+static const ACR_Count_t g_ACRMonthSlots[ACR_MONTH_COUNT] =
+{
+    5, 1, 8, 6, 7, 9, 3, 11, 0, 4,
+    2, 10
+};
+
+/** month string lookup with one compare
+*/
+static const ACR_EnumTable_t g_ACRMonthTable =
+{
+    (const char* const*)g_ACRMonthStringLookup,
+    g_ACRMonthDisplacements,
+    g_ACRMonthSlots,
+    ACR_MONTH_COUNT,
+    7,
+    {ACR_NULL, ACR_ZERO_LENGTH, ACR_BUFFER_FLAGS_NONE}
+};
+
 ////////////////////////////////////////////////////////////
 //
 // PUBLIC FUNCTIONS - TEST
@@ -188,6 +377,11 @@ int ACR_Test(void)
     ACR_String_t stringForInfoUp = ACR_StringFromMemory((ACR_Byte_t*)"up", ACR_MAX_LENGTH, ACR_MAX_COUNT);
     ACR_Info_t infoFromUp = ACR_InfoFromString(stringForInfoUp);
     ACR_String_t stringForEmojiSmile;
+    ACR_String_t stringForUpperCase = ACR_StringFromMemory((ACR_Byte_t*)"SEPTEMBER", ACR_MAX_LENGTH, ACR_MAX_COUNT);
+    ACR_Count_t lookup;
+    int allFound;
+    ACR_String_t stringForLiteral;
+    ACR_String_t stringForCount;
 
     // other
     #if ACR_IS_DEBUG == ACR_BOOL_TRUE
@@ -482,6 +676,76 @@ int ACR_Test(void)
     {
         ACR_DEBUG_PRINT(messageNumber+4, "OK: %.*s with a single character smile emoji", (int)stringForEmojiSmile.m_Buffer.m_Length, (const char*)stringForEmojiSmile.m_Buffer.m_Pointer);
     }
+
+    // every name must be found by its perfect hash
+    allFound = (ACR_MonthFromString(stringForUpperCase) == ACR_MONTH_SEPTEMBER) ? ACR_BOOL_TRUE : ACR_BOOL_FALSE;
+    for(lookup = 0; lookup < ACR_INFO_COUNT; lookup++)
+    {
+        if(ACR_InfoFromString(ACR_InfoToString((ACR_Info_t)lookup)) != (ACR_Info_t)lookup)
+        {
+            allFound = ACR_BOOL_FALSE;
+        }
+    }
+    for(lookup = 0; lookup < ACR_DAY_COUNT; lookup++)
+    {
+        if(ACR_DayOfWeekFromString(ACR_DayOfWeekToString((ACR_DayOfWeek_t)lookup)) != (ACR_DayOfWeek_t)lookup)
+        {
+            allFound = ACR_BOOL_FALSE;
+        }
+    }
+    for(lookup = 0; lookup < ACR_MONTH_COUNT; lookup++)
+    {
+        if(ACR_MonthFromString(ACR_MonthToString((ACR_Month_t)lookup)) != (ACR_Month_t)lookup)
+        {
+            allFound = ACR_BOOL_FALSE;
+        }
+    }
+    if(allFound == ACR_BOOL_FALSE)
+    {
+        // a lookup table does not match its names
+        ACR_DEBUG_PRINT(messageNumber+5, "ERROR: ACR_InfoFromString(), ACR_DayOfWeekFromString() or ACR_MonthFromString() did not find a name");
+        return ACR_FAILURE;
+    }
+    else
+    {
+        ACR_DEBUG_PRINT(messageNumber+6, "OK: %.*s and every other name was found with one compare", (int)stringForUpperCase.m_Buffer.m_Length, (const char*)stringForUpperCase.m_Buffer.m_Pointer);
+    }
+
+    // the strings of the names are not counted when they are
+    // used so they must be the same as counting them
+    for(lookup = 0; lookup < (ACR_INFO_COUNT + ACR_DAY_COUNT + ACR_MONTH_COUNT); lookup++)
+    {
+        if(lookup < ACR_INFO_COUNT)
+        {
+            stringForLiteral = ACR_InfoToString((ACR_Info_t)lookup);
+        }
+        else if(lookup < (ACR_INFO_COUNT + ACR_DAY_COUNT))
+        {
+            stringForLiteral = ACR_DayOfWeekToString((ACR_DayOfWeek_t)(lookup - ACR_INFO_COUNT));
+        }
+        else
+        {
+            stringForLiteral = ACR_MonthToString((ACR_Month_t)(lookup - ACR_INFO_COUNT - ACR_DAY_COUNT));
+        }
+        stringForCount = ACR_StringFromMemory((ACR_Byte_t*)stringForLiteral.m_Buffer.m_Pointer, ACR_MAX_LENGTH, ACR_MAX_COUNT);
+        if((stringForLiteral.m_Buffer.m_Length != stringForCount.m_Buffer.m_Length) || (stringForLiteral.m_Count != stringForCount.m_Count))
+        {
+            break;
+        }
+    }
+    stringForLiteral = (ACR_String_t)ACR_STRING_LITERAL_UTF8("Smile \xF0\x9F\x99\x82", 7);
+    if((lookup != (ACR_INFO_COUNT + ACR_DAY_COUNT + ACR_MONTH_COUNT)) ||
+       (stringForLiteral.m_Buffer.m_Length != stringForEmojiSmile.m_Buffer.m_Length) ||
+       (stringForLiteral.m_Count != stringForEmojiSmile.m_Count))
+    {
+        // a literal has the wrong length or character count
+        ACR_DEBUG_PRINT(messageNumber+7, "ERROR: ACR_STRING_LITERAL() does not match ACR_StringFromMemory()");
+        return ACR_FAILURE;
+    }
+    else
+    {
+        ACR_DEBUG_PRINT(messageNumber+8, "OK: %.*s and every name has its length and character count when compiled", (int)stringForLiteral.m_Buffer.m_Length, (const char*)stringForLiteral.m_Buffer.m_Pointer);
+    }
     
     //
     // ALL TESTS COMPLETE
@@ -493,6 +757,265 @@ int ACR_Test(void)
     return ACR_SUCCESS;
 }
 
+////////////////////////////////////////////////////////////
+//
+// PUBLIC FUNCTIONS - STRING TO ENUM LOOKUP
+//
+////////////////////////////////////////////////////////////
+
+/** hash the case folded characters of a name the same way
+    that ACR_StringCompareToMemory() ignores case
+    \returns a 32 bit hash
+*/
+static unsigned long ACR_EnumTableHash(
+    const ACR_Byte_t* src,
+    ACR_Length_t length)
+{
+    unsigned long hash = 2166136261UL;
+    ACR_Length_t pos = 0;
+    ACR_Length_t bytes;
+    ACR_Unicode_t c;
+    while((pos < length) && (src[pos] != 0))
+    {
+        c = src[pos];
+        if(c < 0x80)
+        {
+            // ASCII characters do not need to be decoded
+            if((c >= 'A') && (c <= 'Z'))
+            {
+                c += 'a' - 'A';
+            }
+            pos++;
+        }
+        else
+        {
+            bytes = ACR_UTF8_BYTE_COUNT(src[pos]);
+            if(bytes > (length - pos))
+            {
+                // the last character is missing some of its bytes
+                break;
+            }
+            c = ACR_UnicodeFold(ACR_Utf8ToUnicode(src + pos, (int)bytes));
+            pos += bytes;
+        }
+        // FNV-1a with one character at a time
+        hash = ((hash ^ c) * 16777619UL) & 0xFFFFFFFFUL;
+    }
+    return hash;
+}
+
+/** get the slot for a hash with the displacement of its
+    bucket
+*/
+static ACR_Count_t ACR_EnumTableSlot(
+    unsigned long hash,
+    unsigned long displacement,
+    ACR_Count_t count)
+{
+    // mix all of the bits so that each displacement moves
+    // the names of a bucket to unrelated slots
+    unsigned long x = (hash ^ (displacement * 0x9E3779B9UL)) & 0xFFFFFFFFUL;
+    x ^= x >> 16;
+    x = (x * 0x85EBCA6BUL) & 0xFFFFFFFFUL;
+    x ^= x >> 13;
+    x = (x * 0xC2B2AE35UL) & 0xFFFFFFFFUL;
+    x ^= x >> 16;
+    return (ACR_Count_t)(x % count);
+}
+
+void ACR_EnumTableInit(
+    ACR_EnumTable_t* me)
+{
+    if(me == ACR_NULL)
+    {
+        return;
+    }
+
+    me->m_Names = ACR_NULL;
+    me->m_Displacements = ACR_NULL;
+    me->m_Slots = ACR_NULL;
+    me->m_Count = 0;
+    me->m_BucketCount = 0;
+    me->m_Memory.m_Pointer = ACR_NULL;
+    me->m_Memory.m_Length = ACR_ZERO_LENGTH;
+    me->m_Memory.m_Flags = ACR_BUFFER_FLAGS_NONE;
+}
+
+void ACR_EnumTableDeInit(
+    ACR_EnumTable_t* me)
+{
+    if(me == ACR_NULL)
+    {
+        return;
+    }
+
+    ACR_BUFFER_FREE(me->m_Memory);
+    ACR_EnumTableInit(me);
+}
+
+ACR_Info_t ACR_EnumTableBuild(
+    ACR_EnumTable_t* me,
+    const char* const* names,
+    ACR_Count_t count)
+{
+    ACR_Count_t* slots;
+    ACR_Count_t* next;
+    ACR_Count_t* first;
+    ACR_Count_t* sizes;
+    unsigned long* hashes;
+    unsigned short* displacements;
+    ACR_Byte_t* used;
+    ACR_Count_t bucketCount;
+    ACR_Count_t bucket;
+    ACR_Count_t maxSize = 0;
+    ACR_Count_t size;
+    ACR_Count_t i;
+    ACR_Count_t j;
+    ACR_Count_t slot;
+    unsigned long displacement;
+    ACR_Length_t length;
+
+    if((me == ACR_NULL) || (names == ACR_NULL) || (count == 0) || (count > (ACR_MAX_COUNT / 2)))
+    {
+        return ACR_INFO_ERROR;
+    }
+
+    // about two names per bucket, and the memory after the
+    // slots and displacements is only used while building
+    bucketCount = (count / 2) + 1;
+    length = (ACR_Length_t)(((count * 2) + (bucketCount * 2)) * sizeof(ACR_Count_t)) +
+             (ACR_Length_t)(count * sizeof(unsigned long)) +
+             (ACR_Length_t)(bucketCount * sizeof(unsigned short)) + (ACR_Length_t)count;
+    if(me->m_Memory.m_Length < length)
+    {
+        ACR_BUFFER_ALLOC(me->m_Memory, length);
+        if(ACR_BUFFER_IS_VALID(me->m_Memory) == ACR_BOOL_FALSE)
+        {
+            ACR_EnumTableInit(me);
+            return ACR_INFO_ERROR;
+        }
+    }
+    slots = (ACR_Count_t*)me->m_Memory.m_Pointer;
+    next = slots + count;
+    first = next + count;
+    sizes = first + bucketCount;
+    hashes = (unsigned long*)(sizes + bucketCount);
+    displacements = (unsigned short*)(hashes + count);
+    used = (ACR_Byte_t*)(displacements + bucketCount);
+    me->m_Count = 0;
+
+    // put the names in buckets as linked lists
+    for(bucket = 0; bucket < bucketCount; bucket++)
+    {
+        first[bucket] = count;
+        sizes[bucket] = 0;
+        displacements[bucket] = 0;
+    }
+    for(i = 0; i < count; i++)
+    {
+        if(names[i] == ACR_NULL)
+        {
+            return ACR_INFO_ERROR;
+        }
+        hashes[i] = ACR_EnumTableHash((const ACR_Byte_t*)names[i], ACR_MAX_LENGTH);
+        used[i] = 0;
+        bucket = (ACR_Count_t)(hashes[i] % bucketCount);
+        next[i] = first[bucket];
+        first[bucket] = i;
+        sizes[bucket]++;
+        if(sizes[bucket] > maxSize)
+        {
+            maxSize = sizes[bucket];
+        }
+        // names with the same hash can never be placed in
+        // different slots
+        for(j = next[i]; j < count; j = next[j])
+        {
+            if(hashes[j] == hashes[i])
+            {
+                if(ACR_StringCompareToMemory(ACR_StringFromMemory((ACR_Byte_t*)names[i], ACR_MAX_LENGTH, ACR_MAX_COUNT),
+                    (const ACR_Byte_t*)names[j], ACR_MAX_LENGTH, ACR_MAX_COUNT, ACR_INFO_NO) == ACR_INFO_EQUAL)
+                {
+                    return ACR_INFO_INVALID;
+                }
+                return ACR_INFO_ERROR;
+            }
+        }
+    }
+
+    // place the buckets with the most names first while
+    // there are the most free slots
+    for(size = maxSize; size > 0; size--)
+    {
+        for(bucket = 0; bucket < bucketCount; bucket++)
+        {
+            if(sizes[bucket] != size)
+            {
+                continue;
+            }
+            for(displacement = 0; displacement <= 0xFFFF; displacement++)
+            {
+                for(i = first[bucket]; i < count; i = next[i])
+                {
+                    slot = ACR_EnumTableSlot(hashes[i], displacement, count);
+                    if(used[slot] != 0)
+                    {
+                        break;
+                    }
+                    used[slot] = 1;
+                    slots[slot] = i;
+                }
+                if(i == count)
+                {
+                    break;
+                }
+                // free the slots used by this displacement
+                for(j = first[bucket]; j != i; j = next[j])
+                {
+                    used[ACR_EnumTableSlot(hashes[j], displacement, count)] = 0;
+                }
+            }
+            if(displacement > 0xFFFF)
+            {
+                return ACR_INFO_ERROR;
+            }
+            displacements[bucket] = (unsigned short)displacement;
+        }
+    }
+
+    me->m_Names = names;
+    me->m_Displacements = displacements;
+    me->m_Slots = slots;
+    me->m_Count = count;
+    me->m_BucketCount = bucketCount;
+    return ACR_INFO_OK;
+}
+
+ACR_Info_t ACR_EnumTableFind(
+    const ACR_EnumTable_t* me,
+    ACR_String_t src,
+    ACR_Count_t* value)
+{
+    unsigned long hash;
+    ACR_Count_t found;
+
+    if((me == ACR_NULL) || (me->m_Count == 0) || (value == ACR_NULL) || (src.m_Buffer.m_Pointer == ACR_NULL))
+    {
+        return ACR_INFO_UNKNOWN;
+    }
+
+    // the hash finds the only name that can match so only
+    // one compare is needed
+    hash = ACR_EnumTableHash((const ACR_Byte_t*)src.m_Buffer.m_Pointer, src.m_Buffer.m_Length);
+    found = me->m_Slots[ACR_EnumTableSlot(hash, me->m_Displacements[hash % me->m_BucketCount], me->m_Count)];
+    if(ACR_StringCompareToMemory(src, (const ACR_Byte_t*)me->m_Names[found], ACR_MAX_LENGTH, ACR_MAX_COUNT, ACR_INFO_NO) != ACR_INFO_EQUAL)
+    {
+        return ACR_INFO_UNKNOWN;
+    }
+    (*value) = found;
+    return ACR_INFO_OK;
+}
+
 ////////////////////////////////////////////////////////////
 //
 // PUBLIC FUNCTIONS - COMMON INFORMATIONAL VALUES
@@ -502,24 +1025,17 @@ int ACR_Test(void)
 ACR_String_t ACR_InfoToString(
     ACR_Info_t info)
 {
-    return ACR_StringFromMemory((ACR_Byte_t*)g_ACRInfoStringLookup[info], ACR_MAX_LENGTH, ACR_MAX_COUNT);
+    return g_ACRInfoStrings[info];
 }
 
 ACR_Info_t ACR_InfoFromString(
     ACR_String_t src)
 {
-    ACR_Count_t i = 0;
-    ACR_Info_t x;
-    do
+    ACR_Count_t value;
+    if(ACR_EnumTableFind(&g_ACRInfoTable, src, &value) == ACR_INFO_OK)
     {
-        x = ACR_StringCompareToMemory(src, (const ACR_Byte_t*)g_ACRInfoStringLookup[i], ACR_MAX_LENGTH, ACR_MAX_COUNT, ACR_INFO_NO);
-        if(x == ACR_INFO_EQUAL)
-        {
-            return (ACR_Info_t)i;
-        }
-        i++;
+        return (ACR_Info_t)value;
     }
-    while(i < ACR_INFO_COUNT);
     return ACR_INFO_UNKNOWN;
 }
 
@@ -532,48 +1048,34 @@ ACR_Info_t ACR_InfoFromString(
 ACR_String_t ACR_DayOfWeekToString(
     ACR_DayOfWeek_t dayOfWeek)
 {
-    return ACR_StringFromMemory((ACR_Byte_t*)g_ACRDayOfWeekStringLookup[dayOfWeek], ACR_MAX_LENGTH, ACR_MAX_COUNT);
+    return g_ACRDayOfWeekStrings[dayOfWeek];
 }
 
 ACR_DayOfWeek_t ACR_DayOfWeekFromString(
     ACR_String_t src)
 {
-    ACR_Count_t i = 0;
-    ACR_Info_t x;
-    do
+    ACR_Count_t value;
+    if(ACR_EnumTableFind(&g_ACRDayOfWeekTable, src, &value) == ACR_INFO_OK)
     {
-        x = ACR_StringCompareToMemory(src, (const ACR_Byte_t*)g_ACRDayOfWeekStringLookup[i], ACR_MAX_LENGTH, ACR_MAX_COUNT, ACR_INFO_NO);
-        if(x == ACR_INFO_EQUAL)
-        {
-            return (ACR_DayOfWeek_t)i;
-        }
-        i++;
+        return (ACR_DayOfWeek_t)value;
     }
-    while(i < ACR_INFO_COUNT);
     return ACR_DAY_OF_WEEK_UNKNOWN;
 }
 
 ACR_String_t ACR_MonthToString(
     ACR_Month_t month)
 {
-    return ACR_StringFromMemory((ACR_Byte_t*)g_ACRMonthStringLookup[month], ACR_MAX_LENGTH, ACR_MAX_COUNT);
+    return g_ACRMonthStrings[month];
 }
 
 ACR_Month_t ACR_MonthFromString(
     ACR_String_t src)
 {
-    ACR_Count_t i = 0;
-    ACR_Info_t x;
-    do
+    ACR_Count_t value;
+    if(ACR_EnumTableFind(&g_ACRMonthTable, src, &value) == ACR_INFO_OK)
     {
-        x = ACR_StringCompareToMemory(src, (const ACR_Byte_t*)g_ACRMonthStringLookup[i], ACR_MAX_LENGTH, ACR_MAX_COUNT, ACR_INFO_NO);
-        if(x == ACR_INFO_EQUAL)
-        {
-            return (ACR_Month_t)i;
-        }
-        i++;
+        return (ACR_Month_t)value;
     }
-    while(i < ACR_INFO_COUNT);
     return ACR_MONTH_UNKNOWN;
 }
 
@@ -644,34 +1146,6 @@ ACR_Info_t ACR_Utf8PrevChar(
     return ACR_INFO_ERROR;
 }
 
-ACR_Unicode_t ACR_UnicodeToLower(
-    ACR_Unicode_t u)
-{
-    /// \todo use a conversion table instead to handle additional unicode characters
-    
-    // handle ASCII characters
-    if((u >= 65) && (u <= 90))
-    {
-        u += 32;
-    }
-
-    return u;
-}
-
-ACR_Unicode_t ACR_UnicodeToUpper(
-    ACR_Unicode_t u)
-{
-    /// \todo use a conversion table instead to handle additional unicode characters
-    
-    // handle ASCII characters
-    if((u >= 97) && (u <= 122))
-    {
-        u -= 32;
-    }
-
-    return u;
-}
-
 ACR_Unicode_t ACR_Utf8ToUnicode(
     const ACR_Byte_t* mem,
     int bytes)
@@ -693,6 +1167,83 @@ ACR_Unicode_t ACR_Utf8ToUnicode(
     return (ACR_Unicode_t)mem[0];
 }
 
+int ACR_UnicodeToUtf8(
+    ACR_Unicode_t u,
+    ACR_Byte_t* mem)
+{
+    if(u < 0x80)
+    {
+        mem[0] = (ACR_Byte_t)u;
+        return 1;
+    }
+    else if(u < 0x800)
+    {
+        mem[0] = (ACR_Byte_t)(0xC0 | (u >> 6));
+        mem[1] = (ACR_Byte_t)(0x80 | (u & 0x3F));
+        return 2;
+    }
+    else if(u < 0x10000)
+    {
+        mem[0] = (ACR_Byte_t)(0xE0 | (u >> 12));
+        mem[1] = (ACR_Byte_t)(0x80 | ((u >> 6) & 0x3F));
+        mem[2] = (ACR_Byte_t)(0x80 | (u & 0x3F));
+        return 3;
+    }
+    mem[0] = (ACR_Byte_t)(0xF0 | (u >> 18));
+    mem[1] = (ACR_Byte_t)(0x80 | ((u >> 12) & 0x3F));
+    mem[2] = (ACR_Byte_t)(0x80 | ((u >> 6) & 0x3F));
+    mem[3] = (ACR_Byte_t)(0x80 | (u & 0x3F));
+    return 4;
+}
+
+/** the number of bytes counted at a time by ACR_StringFromMemory()
+*/
+#if ACR_HAS_SSE2 == ACR_BOOL_TRUE
+#define ACR_STRING_CHUNK_LENGTH 16
+#else
+#define ACR_STRING_CHUNK_LENGTH ACR_BYTES_PER_BLOCK
+#endif
+
+/** count the characters in one aligned chunk of memory by
+    counting the bytes that are not UTF8 continuation bytes
+    \returns the number of characters or -1 if the chunk has
+             a null-terminator
+
+    Note: the load is aligned so it never crosses into another
+          memory page, but it can read past the end of a string
+          so address sanitizer checks are disabled
+*/
+#if defined(ACR_COMPILER_GCC) || defined(ACR_COMPILER_CLANG)
+__attribute__((no_sanitize_address))
+#endif
+static int ACR_StringCountChunk(
+    const ACR_Byte_t* chunk)
+{
+#if ACR_HAS_SSE2 == ACR_BOOL_TRUE
+    __m128i v = _mm_load_si128((const __m128i*)chunk);
+    int continuation;
+    if(_mm_movemask_epi8(_mm_cmpeq_epi8(v, _mm_setzero_si128())) != 0)
+    {
+        return -1;
+    }
+    // continuation bytes 0x80 to 0xBF are the only
+    // signed values less than -64
+    continuation = _mm_movemask_epi8(_mm_cmplt_epi8(v, _mm_set1_epi8(-64)));
+    return 16 - ACR_BLOCK_POPCOUNT((ACR_Block_t)continuation);
+#else
+    // one bit per byte
+    ACR_Block_t low = (~((ACR_Block_t)0)) / 0xFF;
+    ACR_Block_t high = low * 0x80;
+    ACR_Block_t v = (*(const ACR_Block_t*)chunk);
+    if(((v - low) & (~v) & high) != 0)
+    {
+        return -1;
+    }
+    // continuation bytes have the high bit set and the next bit clear
+    return (int)ACR_BYTES_PER_BLOCK - ACR_BLOCK_POPCOUNT(v & (~(v << 1)) & high);
+#endif
+}
+
 ACR_String_t ACR_StringFromMemory(
     ACR_Byte_t* src,
     ACR_Length_t srcLength,
@@ -701,24 +1252,140 @@ ACR_String_t ACR_StringFromMemory(
     ACR_STRING(s);
     if(src != ACR_NULL)
     {
-        ACR_Length_t remaining = srcLength;
-        ACR_Byte_t* srcPtr = src;
-        while((remaining > 0) && (s.m_Count < maxCharacters) && ((*srcPtr) != 0))
+        ACR_Length_t pos = 0;
+        ACR_Length_t lead;
+        ACR_Count_t count = 0;
+        int chunkCount;
+        while(pos < srcLength)
         {
-			ACR_Length_t bytes = ACR_UTF8_BYTE_COUNT((*srcPtr));
-            if(bytes > remaining)
+            // count a chunk at a time when the chunk is aligned and
+            // does not have the null-terminator or too many characters
+            if(((((ACR_PointerValue_t)(src + pos)) % ACR_STRING_CHUNK_LENGTH) == 0) && ((srcLength - pos) >= ACR_STRING_CHUNK_LENGTH))
+            {
+                chunkCount = ACR_StringCountChunk(src + pos);
+                if((chunkCount >= 0) && ((ACR_Count_t)chunkCount <= (maxCharacters - count)))
+                {
+                    count += (ACR_Count_t)chunkCount;
+                    pos += ACR_STRING_CHUNK_LENGTH;
+                    continue;
+                }
+            }
+            // otherwise count one byte at a time
+            if(src[pos] == 0)
             {
                 break;
             }
-            s.m_Count++;
-            srcPtr += bytes;
-            remaining -= bytes;
+            if((src[pos] & 0xC0) != 0x80)
+            {
+                if(count == maxCharacters)
+                {
+                    break;
+                }
+                count++;
+            }
+            pos++;
+        }
+        // do not count the last character if it is missing
+        // some of its bytes
+        if(pos > 0)
+        {
+            lead = pos - 1;
+            while((lead > 0) && ((pos - lead) < 4) && ((src[lead] & 0xC0) == 0x80))
+            {
+                lead--;
+            }
+            if(((src[lead] & 0xC0) != 0x80) && ((lead + ACR_UTF8_BYTE_COUNT(src[lead])) > pos))
+            {
+                count--;
+                pos = lead;
+            }
         }
-        ACR_BUFFER_REFERENCE(s.m_Buffer, src, (srcLength - remaining));
+        ACR_BUFFER_REFERENCE(s.m_Buffer, src, pos);
+        s.m_Count = count;
     }
     return s;
 }
 
+/** compare one chunk of ASCII characters where the src
+    chunk is aligned and the string chunk may not be
+    \returns - ACR_INFO_EQUAL if all of the characters are
+               equal
+             - ACR_INFO_UNKNOWN if the characters are not
+               equal, not all ASCII, or src has a
+               null-terminator so they need to be compared
+               one at a time
+
+    Note: the src load is aligned so it never crosses into
+          another memory page, but it can read past the end
+          of src so address sanitizer checks are disabled
+*/
+#if defined(ACR_COMPILER_GCC) || defined(ACR_COMPILER_CLANG)
+__attribute__((no_sanitize_address))
+#endif
+static ACR_Info_t ACR_StringCompareChunk(
+    const ACR_Byte_t* str,
+    const ACR_Byte_t* src,
+    ACR_Info_t caseSensitive)
+{
+#if ACR_HAS_SSE2 == ACR_BOOL_TRUE
+    __m128i a = _mm_loadu_si128((const __m128i*)str);
+    __m128i b = _mm_load_si128((const __m128i*)src);
+    if(_mm_movemask_epi8(_mm_or_si128(_mm_or_si128(a, b), _mm_cmpeq_epi8(b, _mm_setzero_si128()))) != 0)
+    {
+        // non-ASCII or the null-terminator
+        return ACR_INFO_UNKNOWN;
+    }
+    if(caseSensitive != ACR_INFO_YES)
+    {
+        // ASCII bytes are positive so signed comparison
+        // finds 'A' to 'Z' and adds 0x20 to them
+        __m128i belowA = _mm_set1_epi8('A' - 1);
+        __m128i aboveZ = _mm_set1_epi8('Z' + 1);
+        __m128i lower = _mm_set1_epi8(0x20);
+        a = _mm_or_si128(a, _mm_and_si128(_mm_and_si128(_mm_cmpgt_epi8(a, belowA), _mm_cmplt_epi8(a, aboveZ)), lower));
+        b = _mm_or_si128(b, _mm_and_si128(_mm_and_si128(_mm_cmpgt_epi8(b, belowA), _mm_cmplt_epi8(b, aboveZ)), lower));
+    }
+    if(_mm_movemask_epi8(_mm_cmpeq_epi8(a, b)) != 0xFFFF)
+    {
+        return ACR_INFO_UNKNOWN;
+    }
+    return ACR_INFO_EQUAL;
+#else
+    // one bit per byte
+    ACR_Block_t low = (~((ACR_Block_t)0)) / 0xFF;
+    ACR_Block_t high = low * 0x80;
+    ACR_Block_t b = (*(const ACR_Block_t*)src);
+    union
+    {
+        ACR_Block_t m_Block;
+        ACR_Byte_t m_Bytes[ACR_BYTES_PER_BLOCK];
+    } a;
+    int i;
+    for(i = 0; i < (int)ACR_BYTES_PER_BLOCK; i++)
+    {
+        a.m_Bytes[i] = str[i];
+    }
+    if((((a.m_Block | b) & high) != 0) || (((b - low) & (~b) & high) != 0))
+    {
+        // non-ASCII or the null-terminator
+        return ACR_INFO_UNKNOWN;
+    }
+    if(caseSensitive != ACR_INFO_YES)
+    {
+        // adding to ASCII bytes never carries into the next
+        // byte, so the high bit is set for bytes >= 'A' and
+        // then for bytes > 'Z'
+        a.m_Block |= (((a.m_Block + (low * (0x80 - 'A'))) & (~(a.m_Block + (low * (0x80 - 'Z' - 1)))) & high) >> 2);
+        b |= (((b + (low * (0x80 - 'A'))) & (~(b + (low * (0x80 - 'Z' - 1)))) & high) >> 2);
+    }
+    if(a.m_Block != b)
+    {
+        return ACR_INFO_UNKNOWN;
+    }
+    return ACR_INFO_EQUAL;
+#endif
+}
+
 ACR_Info_t ACR_StringCompareToMemory(
     ACR_String_t string,
     const ACR_Byte_t* src,
@@ -744,6 +1411,43 @@ ACR_Info_t ACR_StringCompareToMemory(
                 // finished comparing the max number of characters
                 return ACR_INFO_EQUAL;
             }
+            // compare a chunk of ASCII characters at a time when
+            // src is aligned and neither side can run out within
+            // the chunk
+            if(((((ACR_PointerValue_t)srcPtr[1]) % ACR_STRING_CHUNK_LENGTH) == 0) &&
+               (srcLength >= ACR_STRING_CHUNK_LENGTH) &&
+               ((maxCharacters - count) >= ACR_STRING_CHUNK_LENGTH) &&
+               ((string.m_Count - count) >= ACR_STRING_CHUNK_LENGTH) &&
+               ((string.m_Buffer.m_Length - (ACR_Length_t)(srcPtr[0] - (ACR_Byte_t*)string.m_Buffer.m_Pointer)) >= ACR_STRING_CHUNK_LENGTH) &&
+               (ACR_StringCompareChunk(srcPtr[0], srcPtr[1], caseSensitive) == ACR_INFO_EQUAL))
+            {
+                count += ACR_STRING_CHUNK_LENGTH;
+                srcPtr[0] += ACR_STRING_CHUNK_LENGTH;
+                srcPtr[1] += ACR_STRING_CHUNK_LENGTH;
+                srcLength -= ACR_STRING_CHUNK_LENGTH;
+                continue;
+            }
+            if((srcPtr[0][0] < 0x80) && (srcPtr[1][0] < 0x80) && (string.m_Count > count))
+            {
+                // ASCII characters do not need to be decoded
+                count++;
+                c[0] = srcPtr[0][0];
+                c[1] = srcPtr[1][0];
+                if(caseSensitive != ACR_INFO_YES)
+                {
+                    c[0] = ACR_UnicodeFold(c[0]);
+                    c[1] = ACR_UnicodeFold(c[1]);
+                }
+                if(c[0] != c[1])
+                {
+                    // src is a smaller or greater value than string
+                    return (c[0] > c[1]) ? ACR_INFO_LESS : ACR_INFO_GREATER;
+                }
+                srcPtr[0]++;
+                srcPtr[1]++;
+                srcLength--;
+                continue;
+            }
             // count the next character using UTF8 byte counts
             bytes[1] = ACR_UTF8_BYTE_COUNT(srcPtr[1][0]);
             if(bytes[1] > srcLength)
@@ -770,8 +1474,8 @@ ACR_Info_t ACR_StringCompareToMemory(
             while(strIndex < 2);
             if(caseSensitive != ACR_INFO_YES)
             {
-                c[0] = ACR_UnicodeToLower(c[0]);
-                c[1] = ACR_UnicodeToLower(c[1]);
+                c[0] = ACR_UnicodeFold(c[0]);
+                c[1] = ACR_UnicodeFold(c[1]);
             }
             if(c[0] > c[1])
             {
@@ -798,6 +1502,47 @@ ACR_Info_t ACR_StringCompareToMemory(
     return ACR_INFO_INVALID;
 }
 
+////////////////////////////////////////////////////////////
+//
+// PUBLIC FUNCTIONS - BIT OPERATIONS
+//
+////////////////////////////////////////////////////////////
+
+int ACR_BlockPopCount(
+    ACR_Block_t block)
+{
+    int count = 0;
+    // clear the lowest set bit until none remain so that
+    // the loop only runs once per set bit
+    while(block != 0)
+    {
+        block &= (block - 1);
+        count++;
+    }
+    return count;
+}
+
+int ACR_BlockTrailingZeros(
+    ACR_Block_t block)
+{
+    int count = 0;
+    if(block == 0)
+    {
+        return (int)ACR_BITS_PER_BLOCK;
+    }
+    while((block & 0xFF) == 0)
+    {
+        block >>= 8;
+        count += 8;
+    }
+    while((block & 1) == 0)
+    {
+        block >>= 1;
+        count++;
+    }
+    return count;
+}
+
 ////////////////////////////////////////////////////////////
 //
 // PUBLIC FUNCTIONS - OTHER
@@ -0,0 +1,1613 @@
+/*
+
+    ********** DO NOT REMOVE THIS INFORMATION ************
+
+    ACR - A set of C functions in a git Repository
+    Copyright (C) 2018 - 2020 Adam C. Rosenberg
+
+    Please read LICENSE before using this code
+
+    Please read README.md for instructions on including
+    this code in your project and where to find examples
+
+    If you contribute to this code, Please add your name
+    and email address to the AUTHORS list below so that
+    we know who to thank!
+
+    AUTHORS
+
+    Adam Rosenberg <adam@sirspot.com>
+
+    LICENSE
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+    ******************************************************
+
+*/
+/** \file radixtree.c
+
+    functions for access to the ACR_RadixTree_t type
+
+    A child pointer of a node points to either another node
+    or a key. Keys are at least ACR_RADIX_TREE_VALUE_ALIGN
+    aligned, so the lowest bit of the pointer is set for a
+    key. A key is its value, its number of bytes, and the
+    bytes of the key after its place in the tree.
+
+*/
+#include "ACR/radixtree.h"
+
+// included for memcmp(), memcpy(), memmove(), and memset()
+#include <string.h>
+
+////////////////////////////////////////////////////////////
+//
+// PRIVATE DEFINES
+//
+////////////////////////////////////////////////////////////
+
+// round a length up to ACR_RADIX_TREE_VALUE_ALIGN
+#define ACR_RADIX_TREE_ROUND(length) ((((length) + ACR_RADIX_TREE_VALUE_ALIGN - 1) / ACR_RADIX_TREE_VALUE_ALIGN) * ACR_RADIX_TREE_VALUE_ALIGN)
+
+// check if a child pointer is a key
+#define ACR_RADIX_TREE_IS_LEAF(child) ((((ACR_PointerValue_t)(child)) & 1) != 0)
+
+// get the key of a child pointer
+#define ACR_RADIX_TREE_LEAF(child) ((ACR_Byte_t*)(((ACR_PointerValue_t)(child)) & ~((ACR_PointerValue_t)1)))
+
+// get the child pointer of a key
+#define ACR_RADIX_TREE_TAG(leaf) ((void*)(((ACR_PointerValue_t)(leaf)) | 1))
+
+// the number of bytes of a key after its place in the tree
+#define ACR_RADIX_TREE_LEAF_LENGTH(me, leaf) (*((unsigned int*)((leaf) + ACR_RADIX_TREE_ROUND((me)->m_ValueLength))))
+
+// the bytes of a key after its place in the tree
+#define ACR_RADIX_TREE_LEAF_KEY(me, leaf) ((leaf) + ACR_RADIX_TREE_ROUND((me)->m_ValueLength) + sizeof(unsigned int))
+
+// the number of bytes allocated for a key
+#define ACR_RADIX_TREE_LEAF_SIZE(me, length) ACR_RADIX_TREE_ROUND(ACR_RADIX_TREE_ROUND((me)->m_ValueLength) + sizeof(unsigned int) + (length))
+
+// the prefix bytes that follow the children of a node
+#define ACR_RADIX_TREE_PREFIX(node) (((ACR_Byte_t*)(node)) + g_RadixTreeNodeLengths[(node)->m_Type])
+
+// the number of bytes allocated for a node
+#define ACR_RADIX_TREE_NODE_SIZE(type, prefixLength) ACR_RADIX_TREE_ROUND(g_RadixTreeNodeLengths[type] + (prefixLength))
+
+// the header of memory that is larger than
+// ACR_RADIX_TREE_SMALL_LENGTH
+#define ACR_RADIX_TREE_LARGE_HEADER ACR_RADIX_TREE_ROUND(sizeof(ACR_RadixTreeLarge_t))
+
+// the longest key that can be in a tree
+#define ACR_RADIX_TREE_MAX_KEY_LENGTH 0xFFFFFFFFUL
+
+////////////////////////////////////////////////////////////
+//
+// PRIVATE TYPES
+//
+////////////////////////////////////////////////////////////
+
+/** the kinds of nodes
+*/
+enum ACR_RadixTreeNodeType_e
+{
+	ACR_RADIX_TREE_NODE4 = 0,
+	ACR_RADIX_TREE_NODE16,
+	ACR_RADIX_TREE_NODE48,
+	ACR_RADIX_TREE_NODE256
+};
+
+#ifdef ACR_COMPILER_VS2017
+#pragma warning(push)
+// disable warning C4820: padding added after data member
+#pragma warning(disable:4820)
+#endif
+/** the header of every node
+*/
+typedef struct ACR_RadixTreeNode_s
+{
+	/** see enum ACR_RadixTreeNodeType_e
+	*/
+	ACR_Byte_t m_Type;
+
+	/** the number of children
+	*/
+	unsigned short m_Count;
+
+	/** the number of prefix bytes
+	*/
+	unsigned int m_PrefixLength;
+
+	/** the key that ends at this node or ACR_NULL
+	*/
+	ACR_Byte_t* m_Leaf;
+} ACR_RadixTreeNode_t;
+
+/** a node with up to 4 children in key byte order
+*/
+typedef struct ACR_RadixTreeNode4_s
+{
+	ACR_RadixTreeNode_t m_Node;
+	ACR_Byte_t m_Keys[4];
+	void* m_Children[4];
+} ACR_RadixTreeNode4_t;
+
+/** a node with up to 16 children in key byte order
+*/
+typedef struct ACR_RadixTreeNode16_s
+{
+	ACR_RadixTreeNode_t m_Node;
+	ACR_Byte_t m_Keys[16];
+	void* m_Children[16];
+} ACR_RadixTreeNode16_t;
+
+/** a node with up to 48 children and the child + 1 of each
+    key byte
+*/
+typedef struct ACR_RadixTreeNode48_s
+{
+	ACR_RadixTreeNode_t m_Node;
+	ACR_Byte_t m_Index[256];
+	void* m_Children[48];
+} ACR_RadixTreeNode48_t;
+
+/** a node with a child for each key byte
+*/
+typedef struct ACR_RadixTreeNode256_s
+{
+	ACR_RadixTreeNode_t m_Node;
+	void* m_Children[256];
+} ACR_RadixTreeNode256_t;
+
+/** the header of memory that is larger than
+    ACR_RADIX_TREE_SMALL_LENGTH
+*/
+typedef struct ACR_RadixTreeLarge_s
+{
+	struct ACR_RadixTreeLarge_s* m_Previous;
+	struct ACR_RadixTreeLarge_s* m_Next;
+} ACR_RadixTreeLarge_t;
+
+/** a node being listed by an iterator
+*/
+typedef struct ACR_RadixTreeFrame_s
+{
+	const ACR_RadixTreeNode_t* m_Node;
+	ACR_Length_t m_KeyLength;
+	ACR_Count_t m_Position;
+} ACR_RadixTreeFrame_t;
+#ifdef ACR_COMPILER_VS2017
+#pragma warning(pop)
+#endif
+
+////////////////////////////////////////////////////////////
+//
+// PRIVATE TABLES
+//
+////////////////////////////////////////////////////////////
+
+/** the number of bytes of each kind of node before its
+    prefix
+*/
+static const ACR_Length_t g_RadixTreeNodeLengths[4] =
+{
+	sizeof(ACR_RadixTreeNode4_t),
+	sizeof(ACR_RadixTreeNode16_t),
+	sizeof(ACR_RadixTreeNode48_t),
+	sizeof(ACR_RadixTreeNode256_t)
+};
+
+/** the most children of each kind of node
+*/
+static const unsigned short g_RadixTreeNodeCapacities[4] = {4, 16, 48, 256};
+
+/** a node shrinks to the next smaller kind when it has this
+    many children, which is less than the smaller kind can
+    hold so that adding and removing one key does not
+    change the kind every time
+*/
+static const unsigned short g_RadixTreeNodeShrink[4] = {0, 3, 12, 40};
+
+////////////////////////////////////////////////////////////
+//
+// PRIVATE FUNCTIONS
+//
+////////////////////////////////////////////////////////////
+
+/** allocate memory for a node or a key
+    \returns the memory or ACR_NULL
+*/
+static void* ACR_RadixTreeAlloc(
+	ACR_RadixTree_t* me,
+	ACR_Length_t length)
+{
+	#if ACR_HAS_MALLOC == ACR_BOOL_TRUE
+	ACR_RadixTreeLarge_t* large;
+	void* memory;
+	ACR_Count_t size;
+
+	if(length > ACR_RADIX_TREE_SMALL_LENGTH)
+	{
+		large = (ACR_RadixTreeLarge_t*)ACR_MALLOC(ACR_RADIX_TREE_LARGE_HEADER + length);
+		if(large == ACR_NULL)
+		{
+			return ACR_NULL;
+		}
+		large->m_Previous = ACR_NULL;
+		large->m_Next = (ACR_RadixTreeLarge_t*)me->m_Large;
+		if(large->m_Next != ACR_NULL)
+		{
+			large->m_Next->m_Previous = large;
+		}
+		me->m_Large = large;
+		me->m_MemoryLength += ACR_RADIX_TREE_LARGE_HEADER + length;
+		return ((ACR_Byte_t*)large) + ACR_RADIX_TREE_LARGE_HEADER;
+	}
+
+	size = (ACR_Count_t)(length / ACR_RADIX_TREE_VALUE_ALIGN) - 1;
+	memory = me->m_Free[size];
+	if(memory != ACR_NULL)
+	{
+		me->m_Free[size] = *((void**)memory);
+		return memory;
+	}
+
+	// the first bytes of each block point to the previous one
+	if((me->m_Blocks == ACR_NULL) || ((me->m_BlockUsed + length) > ACR_RADIX_TREE_BLOCK_LENGTH))
+	{
+		memory = ACR_MALLOC(ACR_RADIX_TREE_BLOCK_LENGTH);
+		if(memory == ACR_NULL)
+		{
+			return ACR_NULL;
+		}
+		*((void**)memory) = me->m_Blocks;
+		me->m_Blocks = memory;
+		me->m_BlockUsed = ACR_RADIX_TREE_ROUND(sizeof(void*));
+		me->m_MemoryLength += ACR_RADIX_TREE_BLOCK_LENGTH;
+	}
+	memory = ((ACR_Byte_t*)me->m_Blocks) + me->m_BlockUsed;
+	me->m_BlockUsed += length;
+	return memory;
+	#else
+	ACR_UNUSED(me);
+	ACR_UNUSED(length);
+	return ACR_NULL;
+	#endif
+}
+
+/** free the memory of a node or a key
+*/
+static void ACR_RadixTreeFree(
+	ACR_RadixTree_t* me,
+	void* memory,
+	ACR_Length_t length)
+{
+	#if ACR_HAS_MALLOC == ACR_BOOL_TRUE
+	ACR_RadixTreeLarge_t* large;
+	ACR_Count_t size;
+
+	if(length > ACR_RADIX_TREE_SMALL_LENGTH)
+	{
+		large = (ACR_RadixTreeLarge_t*)(((ACR_Byte_t*)memory) - ACR_RADIX_TREE_LARGE_HEADER);
+		if(large->m_Previous != ACR_NULL)
+		{
+			large->m_Previous->m_Next = large->m_Next;
+		}
+		else
+		{
+			me->m_Large = large->m_Next;
+		}
+		if(large->m_Next != ACR_NULL)
+		{
+			large->m_Next->m_Previous = large->m_Previous;
+		}
+		me->m_MemoryLength -= ACR_RADIX_TREE_LARGE_HEADER + length;
+		ACR_FREE(large);
+		return;
+	}
+
+	size = (ACR_Count_t)(length / ACR_RADIX_TREE_VALUE_ALIGN) - 1;
+	*((void**)memory) = me->m_Free[size];
+	me->m_Free[size] = memory;
+	#else
+	ACR_UNUSED(me);
+	ACR_UNUSED(memory);
+	ACR_UNUSED(length);
+	#endif
+}
+
+/** free the memory of a key
+*/
+static void ACR_RadixTreeFreeLeaf(
+	ACR_RadixTree_t* me,
+	ACR_Byte_t* leaf)
+{
+	ACR_RadixTreeFree(me, leaf, ACR_RADIX_TREE_LEAF_SIZE(me, ACR_RADIX_TREE_LEAF_LENGTH(me, leaf)));
+}
+
+/** free the memory of a node
+*/
+static void ACR_RadixTreeFreeNode(
+	ACR_RadixTree_t* me,
+	ACR_RadixTreeNode_t* node)
+{
+	ACR_RadixTreeFree(me, node, ACR_RADIX_TREE_NODE_SIZE(node->m_Type, node->m_PrefixLength));
+}
+
+/** make a key from up to three pieces of bytes
+    \param me the tree
+    \param value the value to copy or ACR_NULL for zeros
+    \param first the first bytes
+    \param firstLength the number of first bytes
+    \param byte a byte after the first bytes or -1 for none
+    \param last the last bytes
+    \param lastLength the number of last bytes
+    \returns the key or ACR_NULL
+*/
+static ACR_Byte_t* ACR_RadixTreeNewLeaf(
+	ACR_RadixTree_t* me,
+	const ACR_Byte_t* value,
+	const ACR_Byte_t* first,
+	ACR_Length_t firstLength,
+	int byte,
+	const ACR_Byte_t* last,
+	ACR_Length_t lastLength)
+{
+	ACR_Length_t length = firstLength + ((byte >= 0) ? 1 : 0) + lastLength;
+	ACR_Byte_t* leaf;
+	ACR_Byte_t* key;
+
+	leaf = (ACR_Byte_t*)ACR_RadixTreeAlloc(me, ACR_RADIX_TREE_LEAF_SIZE(me, length));
+	if(leaf == ACR_NULL)
+	{
+		return ACR_NULL;
+	}
+	if(value != ACR_NULL)
+	{
+		memcpy(leaf, value, (size_t)me->m_ValueLength);
+	}
+	else
+	{
+		memset(leaf, 0, (size_t)me->m_ValueLength);
+	}
+	ACR_RADIX_TREE_LEAF_LENGTH(me, leaf) = (unsigned int)length;
+	key = ACR_RADIX_TREE_LEAF_KEY(me, leaf);
+	if(firstLength > 0)
+	{
+		memcpy(key, first, (size_t)firstLength);
+		key += firstLength;
+	}
+	if(byte >= 0)
+	{
+		*key = (ACR_Byte_t)byte;
+		key++;
+	}
+	if(lastLength > 0)
+	{
+		memcpy(key, last, (size_t)lastLength);
+	}
+	return leaf;
+}
+
+/** make a node without children with a prefix from up to
+    three pieces of bytes
+    \returns the node or ACR_NULL
+*/
+static ACR_RadixTreeNode_t* ACR_RadixTreeNewNode(
+	ACR_RadixTree_t* me,
+	int type,
+	const ACR_Byte_t* first,
+	ACR_Length_t firstLength,
+	int byte,
+	const ACR_Byte_t* last,
+	ACR_Length_t lastLength)
+{
+	ACR_Length_t length = firstLength + ((byte >= 0) ? 1 : 0) + lastLength;
+	ACR_RadixTreeNode_t* node;
+	ACR_Byte_t* prefix;
+
+	node = (ACR_RadixTreeNode_t*)ACR_RadixTreeAlloc(me, ACR_RADIX_TREE_NODE_SIZE(type, length));
+	if(node == ACR_NULL)
+	{
+		return ACR_NULL;
+	}
+	memset(node, 0, (size_t)g_RadixTreeNodeLengths[type]);
+	node->m_Type = (ACR_Byte_t)type;
+	node->m_PrefixLength = (unsigned int)length;
+	prefix = ACR_RADIX_TREE_PREFIX(node);
+	if(firstLength > 0)
+	{
+		memcpy(prefix, first, (size_t)firstLength);
+		prefix += firstLength;
+	}
+	if(byte >= 0)
+	{
+		*prefix = (ACR_Byte_t)byte;
+		prefix++;
+	}
+	if(lastLength > 0)
+	{
+		memcpy(prefix, last, (size_t)lastLength);
+	}
+	return node;
+}
+
+/** find the child of a key byte
+    \returns the location of the child pointer or ACR_NULL
+*/
+static void** ACR_RadixTreeFindChild(
+	const ACR_RadixTreeNode_t* node,
+	ACR_Byte_t byte)
+{
+	const ACR_RadixTreeNode4_t* node4;
+	const ACR_RadixTreeNode16_t* node16;
+	const ACR_RadixTreeNode48_t* node48;
+	const ACR_RadixTreeNode256_t* node256;
+	#if ACR_HAS_SSE2 == ACR_BOOL_TRUE
+	unsigned int mask;
+	#endif
+	int i;
+
+	switch(node->m_Type)
+	{
+		case ACR_RADIX_TREE_NODE4:
+		{
+			node4 = (const ACR_RadixTreeNode4_t*)node;
+			for(i = 0; i < node->m_Count; i++)
+			{
+				if(node4->m_Keys[i] == byte)
+				{
+					return (void**)&node4->m_Children[i];
+				}
+			}
+			return ACR_NULL;
+		}
+		case ACR_RADIX_TREE_NODE16:
+		{
+			node16 = (const ACR_RadixTreeNode16_t*)node;
+			// compare all 16 key bytes at once and ignore the
+			// ones after the last child
+			#if ACR_HAS_SSE2 == ACR_BOOL_TRUE
+			mask = (unsigned int)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)node16->m_Keys), _mm_set1_epi8((char)byte)));
+			mask &= (1U << node->m_Count) - 1;
+			if(mask != 0)
+			{
+				return (void**)&node16->m_Children[ACR_BLOCK_TRAILING_ZEROS((ACR_Block_t)mask)];
+			}
+			#else
+			for(i = 0; i < node->m_Count; i++)
+			{
+				if(node16->m_Keys[i] == byte)
+				{
+					return (void**)&node16->m_Children[i];
+				}
+			}
+			#endif
+			return ACR_NULL;
+		}
+		case ACR_RADIX_TREE_NODE48:
+		{
+			node48 = (const ACR_RadixTreeNode48_t*)node;
+			if(node48->m_Index[byte] != 0)
+			{
+				return (void**)&node48->m_Children[node48->m_Index[byte] - 1];
+			}
+			return ACR_NULL;
+		}
+		default:
+		{
+			node256 = (const ACR_RadixTreeNode256_t*)node;
+			if(node256->m_Children[byte] != ACR_NULL)
+			{
+				return (void**)&node256->m_Children[byte];
+			}
+			return ACR_NULL;
+		}
+	}
+}
+
+/** get the children of a node in key byte order
+    \param node the node
+    \param position the position of the next child, which
+           starts at 0
+    \param byte location to store the key byte of the child
+    \returns the child or ACR_NULL if there are no more
+*/
+static void* ACR_RadixTreeNextChild(
+	const ACR_RadixTreeNode_t* node,
+	ACR_Count_t* position,
+	ACR_Byte_t* byte)
+{
+	const ACR_RadixTreeNode4_t* node4;
+	const ACR_RadixTreeNode16_t* node16;
+	const ACR_RadixTreeNode48_t* node48;
+	const ACR_RadixTreeNode256_t* node256;
+	ACR_Count_t pos = *position;
+
+	switch(node->m_Type)
+	{
+		case ACR_RADIX_TREE_NODE4:
+		{
+			node4 = (const ACR_RadixTreeNode4_t*)node;
+			if(pos < node->m_Count)
+			{
+				*position = pos + 1;
+				*byte = node4->m_Keys[pos];
+				return node4->m_Children[pos];
+			}
+			return ACR_NULL;
+		}
+		case ACR_RADIX_TREE_NODE16:
+		{
+			node16 = (const ACR_RadixTreeNode16_t*)node;
+			if(pos < node->m_Count)
+			{
+				*position = pos + 1;
+				*byte = node16->m_Keys[pos];
+				return node16->m_Children[pos];
+			}
+			return ACR_NULL;
+		}
+		case ACR_RADIX_TREE_NODE48:
+		{
+			node48 = (const ACR_RadixTreeNode48_t*)node;
+			for(; pos < 256; pos++)
+			{
+				if(node48->m_Index[pos] != 0)
+				{
+					*position = pos + 1;
+					*byte = (ACR_Byte_t)pos;
+					return node48->m_Children[node48->m_Index[pos] - 1];
+				}
+			}
+			*position = pos;
+			return ACR_NULL;
+		}
+		default:
+		{
+			node256 = (const ACR_RadixTreeNode256_t*)node;
+			for(; pos < 256; pos++)
+			{
+				if(node256->m_Children[pos] != ACR_NULL)
+				{
+					*position = pos + 1;
+					*byte = (ACR_Byte_t)pos;
+					return node256->m_Children[pos];
+				}
+			}
+			*position = pos;
+			return ACR_NULL;
+		}
+	}
+}
+
+/** add a child to a node that has room for it
+*/
+static void ACR_RadixTreeInsertChild(
+	ACR_RadixTreeNode_t* node,
+	ACR_Byte_t byte,
+	void* child)
+{
+	ACR_RadixTreeNode4_t* node4;
+	ACR_RadixTreeNode16_t* node16;
+	ACR_RadixTreeNode48_t* node48;
+	ACR_Byte_t* keys;
+	void** children;
+	int pos;
+
+	switch(node->m_Type)
+	{
+		case ACR_RADIX_TREE_NODE48:
+		{
+			node48 = (ACR_RadixTreeNode48_t*)node;
+			for(pos = 0; node48->m_Children[pos] != ACR_NULL; pos++)
+			{
+			}
+			node48->m_Children[pos] = child;
+			node48->m_Index[byte] = (ACR_Byte_t)(pos + 1);
+			break;
+		}
+		case ACR_RADIX_TREE_NODE256:
+		{
+			((ACR_RadixTreeNode256_t*)node)->m_Children[byte] = child;
+			break;
+		}
+		default:
+		{
+			if(node->m_Type == ACR_RADIX_TREE_NODE4)
+			{
+				node4 = (ACR_RadixTreeNode4_t*)node;
+				keys = node4->m_Keys;
+				children = node4->m_Children;
+			}
+			else
+			{
+				node16 = (ACR_RadixTreeNode16_t*)node;
+				keys = node16->m_Keys;
+				children = node16->m_Children;
+			}
+			// keep the children in key byte order
+			for(pos = 0; (pos < node->m_Count) && (keys[pos] < byte); pos++)
+			{
+			}
+			memmove(keys + pos + 1, keys + pos, (size_t)(node->m_Count - pos));
+			memmove(children + pos + 1, children + pos, (size_t)(node->m_Count - pos) * sizeof(void*));
+			keys[pos] = byte;
+			children[pos] = child;
+			break;
+		}
+	}
+	node->m_Count++;
+}
+
+/** make a copy of a node of another kind or with another
+    prefix
+    \returns the copy or ACR_NULL
+*/
+static ACR_RadixTreeNode_t* ACR_RadixTreeCopyNode(
+	ACR_RadixTree_t* me,
+	const ACR_RadixTreeNode_t* node,
+	int type,
+	const ACR_Byte_t* first,
+	ACR_Length_t firstLength,
+	int byte,
+	const ACR_Byte_t* last,
+	ACR_Length_t lastLength)
+{
+	ACR_RadixTreeNode_t* copy = ACR_RadixTreeNewNode(me, type, first, firstLength, byte, last, lastLength);
+	ACR_Count_t position = 0;
+	ACR_Byte_t key;
+	void* child;
+
+	if(copy != ACR_NULL)
+	{
+		copy->m_Leaf = node->m_Leaf;
+		child = ACR_RadixTreeNextChild(node, &position, &key);
+		while(child != ACR_NULL)
+		{
+			ACR_RadixTreeInsertChild(copy, key, child);
+			child = ACR_RadixTreeNextChild(node, &position, &key);
+		}
+	}
+	return copy;
+}
+
+/** add a child to a node, replacing the node with a larger
+    kind if it is full
+    \returns ACR_INFO_OK or ACR_INFO_ERROR
+*/
+static ACR_Info_t ACR_RadixTreeAddChild(
+	ACR_RadixTree_t* me,
+	void** ref,
+	ACR_Byte_t byte,
+	void* child)
+{
+	ACR_RadixTreeNode_t* node = (ACR_RadixTreeNode_t*)*ref;
+	ACR_RadixTreeNode_t* larger;
+
+	if(node->m_Count == g_RadixTreeNodeCapacities[node->m_Type])
+	{
+		larger = ACR_RadixTreeCopyNode(me, node, node->m_Type + 1, ACR_RADIX_TREE_PREFIX(node), node->m_PrefixLength, -1, ACR_NULL, 0);
+		if(larger == ACR_NULL)
+		{
+			return ACR_INFO_ERROR;
+		}
+		ACR_RadixTreeFreeNode(me, node);
+		*ref = larger;
+		node = larger;
+	}
+	ACR_RadixTreeInsertChild(node, byte, child);
+	return ACR_INFO_OK;
+}
+
+/** remove the child of a key byte from a node
+*/
+static void ACR_RadixTreeRemoveChild(
+	ACR_RadixTreeNode_t* node,
+	ACR_Byte_t byte)
+{
+	ACR_RadixTreeNode4_t* node4;
+	ACR_RadixTreeNode16_t* node16;
+	ACR_RadixTreeNode48_t* node48;
+	ACR_Byte_t* keys;
+	void** children;
+	int pos;
+
+	switch(node->m_Type)
+	{
+		case ACR_RADIX_TREE_NODE48:
+		{
+			node48 = (ACR_RadixTreeNode48_t*)node;
+			node48->m_Children[node48->m_Index[byte] - 1] = ACR_NULL;
+			node48->m_Index[byte] = 0;
+			break;
+		}
+		case ACR_RADIX_TREE_NODE256:
+		{
+			((ACR_RadixTreeNode256_t*)node)->m_Children[byte] = ACR_NULL;
+			break;
+		}
+		default:
+		{
+			if(node->m_Type == ACR_RADIX_TREE_NODE4)
+			{
+				node4 = (ACR_RadixTreeNode4_t*)node;
+				keys = node4->m_Keys;
+				children = node4->m_Children;
+			}
+			else
+			{
+				node16 = (ACR_RadixTreeNode16_t*)node;
+				keys = node16->m_Keys;
+				children = node16->m_Children;
+			}
+			for(pos = 0; keys[pos] != byte; pos++)
+			{
+			}
+			memmove(keys + pos, keys + pos + 1, (size_t)(node->m_Count - pos - 1));
+			memmove(children + pos, children + pos + 1, (size_t)(node->m_Count - pos - 1) * sizeof(void*));
+			break;
+		}
+	}
+	node->m_Count--;
+}
+
+/** make a node that lost a child or its key as small as it
+    can be. if memory cannot be allocated the node is left
+    as it is, which is still a valid tree
+*/
+static void ACR_RadixTreeShrink(
+	ACR_RadixTree_t* me,
+	void** ref)
+{
+	ACR_RadixTreeNode_t* node = (ACR_RadixTreeNode_t*)*ref;
+	ACR_RadixTreeNode_t* child;
+	ACR_RadixTreeNode_t* smaller;
+	ACR_Byte_t* leaf = ACR_NULL;
+	ACR_Count_t position = 0;
+	ACR_Byte_t byte;
+	void* only;
+
+	if((node->m_Count == 0) && (node->m_Leaf != ACR_NULL))
+	{
+		// the node only has the key that ends at it, so the
+		// key takes its place
+		leaf = ACR_RadixTreeNewLeaf(me, node->m_Leaf, ACR_RADIX_TREE_PREFIX(node), node->m_PrefixLength, -1, ACR_NULL, 0);
+		if(leaf != ACR_NULL)
+		{
+			ACR_RadixTreeFreeLeaf(me, node->m_Leaf);
+			ACR_RadixTreeFreeNode(me, node);
+			*ref = ACR_RADIX_TREE_TAG(leaf);
+		}
+	}
+	else if((node->m_Count == 1) && (node->m_Leaf == ACR_NULL))
+	{
+		// the node only has one child, so the child takes its
+		// place with the node prefix and the key byte in front
+		// of its own
+		only = ACR_RadixTreeNextChild(node, &position, &byte);
+		if(ACR_RADIX_TREE_IS_LEAF(only))
+		{
+			leaf = ACR_RADIX_TREE_LEAF(only);
+			leaf = ACR_RadixTreeNewLeaf(me, leaf, ACR_RADIX_TREE_PREFIX(node), node->m_PrefixLength, byte,
+				ACR_RADIX_TREE_LEAF_KEY(me, leaf), ACR_RADIX_TREE_LEAF_LENGTH(me, leaf));
+			if(leaf != ACR_NULL)
+			{
+				ACR_RadixTreeFreeLeaf(me, ACR_RADIX_TREE_LEAF(only));
+				ACR_RadixTreeFreeNode(me, node);
+				*ref = ACR_RADIX_TREE_TAG(leaf);
+			}
+		}
+		else
+		{
+			child = (ACR_RadixTreeNode_t*)only;
+			smaller = ACR_RadixTreeCopyNode(me, child, child->m_Type, ACR_RADIX_TREE_PREFIX(node), node->m_PrefixLength, byte,
+				ACR_RADIX_TREE_PREFIX(child), child->m_PrefixLength);
+			if(smaller != ACR_NULL)
+			{
+				ACR_RadixTreeFreeNode(me, child);
+				ACR_RadixTreeFreeNode(me, node);
+				*ref = smaller;
+			}
+		}
+	}
+	else if((node->m_Type != ACR_RADIX_TREE_NODE4) && (node->m_Count <= g_RadixTreeNodeShrink[node->m_Type]))
+	{
+		smaller = ACR_RadixTreeCopyNode(me, node, node->m_Type - 1, ACR_RADIX_TREE_PREFIX(node), node->m_PrefixLength, -1, ACR_NULL, 0);
+		if(smaller != ACR_NULL)
+		{
+			ACR_RadixTreeFreeNode(me, node);
+			*ref = smaller;
+		}
+	}
+}
+
+/** get the number of bytes that two byte arrays start with
+*/
+static ACR_Length_t ACR_RadixTreeCommon(
+	const ACR_Byte_t* a,
+	ACR_Length_t aLength,
+	const ACR_Byte_t* b,
+	ACR_Length_t bLength)
+{
+	ACR_Length_t length = (aLength < bLength) ? aLength : bLength;
+	ACR_Length_t i;
+	for(i = 0; (i < length) && (a[i] == b[i]); i++)
+	{
+	}
+	return i;
+}
+
+/** make sure the key of an iterator has room for a number of
+    bytes
+    \returns ACR_INFO_OK or ACR_INFO_ERROR
+*/
+static ACR_Info_t ACR_RadixTreeKeyRoom(
+	ACR_RadixTreeIterator_t* me,
+	ACR_Length_t used,
+	ACR_Length_t length)
+{
+	ACR_BUFFER(larger);
+	ACR_Length_t capacity = (me->m_Key.m_Length < 64) ? 64 : me->m_Key.m_Length;
+
+	if(length <= me->m_Key.m_Length)
+	{
+		return ACR_INFO_OK;
+	}
+	while(capacity < length)
+	{
+		capacity *= 2;
+	}
+	ACR_BUFFER_ALLOC(larger, capacity);
+	ACR_UNUSED(capacity);
+	if(larger.m_Pointer == ACR_NULL)
+	{
+		return ACR_INFO_ERROR;
+	}
+	if(used > 0)
+	{
+		memcpy(larger.m_Pointer, me->m_Key.m_Pointer, (size_t)used);
+	}
+	ACR_BUFFER_FREE(me->m_Key);
+	me->m_Key = larger;
+	return ACR_INFO_OK;
+}
+
+/** start listing the keys of a node or a key that is a
+    child of the last node being listed
+    \param me the iterator
+    \param child the node or key
+    \param keyLength the number of bytes of the current key
+           before the bytes of the child
+    \param key location to store the key if there is one
+    \param value location to store the value if there is
+           one
+    \returns - ACR_INFO_OK if there is a key
+	         - ACR_INFO_UNKNOWN if the child is a node without
+			   a key of its own, whose children are listed
+			   next
+			 - ACR_INFO_ERROR if memory could not be allocated
+*/
+static ACR_Info_t ACR_RadixTreeVisit(
+	ACR_RadixTreeIterator_t* me,
+	const ACR_RadixTree_t* tree,
+	const void* child,
+	ACR_Length_t keyLength,
+	ACR_String_t* key,
+	void** value)
+{
+	ACR_BUFFER(larger);
+	const ACR_RadixTreeNode_t* node;
+	ACR_RadixTreeFrame_t* frame;
+	const ACR_Byte_t* leaf;
+	const ACR_Byte_t* src;
+	ACR_Length_t length;
+	ACR_Length_t pos;
+	ACR_Count_t count = 0;
+
+	if(ACR_RADIX_TREE_IS_LEAF(child))
+	{
+		leaf = ACR_RADIX_TREE_LEAF(child);
+		src = ACR_RADIX_TREE_LEAF_KEY(tree, leaf);
+		length = ACR_RADIX_TREE_LEAF_LENGTH(tree, leaf);
+	}
+	else
+	{
+		node = (const ACR_RadixTreeNode_t*)child;
+		leaf = node->m_Leaf;
+		src = ACR_RADIX_TREE_PREFIX(node);
+		length = node->m_PrefixLength;
+
+		if(((me->m_Depth + 1) * sizeof(ACR_RadixTreeFrame_t)) > me->m_Stack.m_Length)
+		{
+			ACR_BUFFER_ALLOC(larger, (me->m_Stack.m_Length < (16 * sizeof(ACR_RadixTreeFrame_t))) ? (16 * sizeof(ACR_RadixTreeFrame_t)) : (2 * me->m_Stack.m_Length));
+			if(larger.m_Pointer == ACR_NULL)
+			{
+				return ACR_INFO_ERROR;
+			}
+			if(me->m_Depth > 0)
+			{
+				memcpy(larger.m_Pointer, me->m_Stack.m_Pointer, (size_t)(me->m_Depth * sizeof(ACR_RadixTreeFrame_t)));
+			}
+			ACR_BUFFER_FREE(me->m_Stack);
+			me->m_Stack = larger;
+		}
+		frame = ((ACR_RadixTreeFrame_t*)me->m_Stack.m_Pointer) + me->m_Depth;
+		frame->m_Node = node;
+		frame->m_KeyLength = keyLength + length;
+		frame->m_Position = 0;
+		me->m_Depth++;
+	}
+
+	if(ACR_RadixTreeKeyRoom(me, keyLength, keyLength + length + 1) != ACR_INFO_OK)
+	{
+		return ACR_INFO_ERROR;
+	}
+	if(length > 0)
+	{
+		memcpy(((ACR_Byte_t*)me->m_Key.m_Pointer) + keyLength, src, (size_t)length);
+	}
+	if(leaf == ACR_NULL)
+	{
+		return ACR_INFO_UNKNOWN;
+	}
+
+	length += keyLength;
+	src = (const ACR_Byte_t*)me->m_Key.m_Pointer;
+	// count the bytes that are not UTF8 continuation bytes
+	for(pos = 0; pos < length; pos++)
+	{
+		if((src[pos] & 0xC0) != 0x80)
+		{
+			count++;
+		}
+	}
+	if(key != ACR_NULL)
+	{
+		key->m_Buffer.m_Pointer = me->m_Key.m_Pointer;
+		key->m_Buffer.m_Length = length;
+		key->m_Buffer.m_Flags = ACR_BUFFER_IS_REF;
+		key->m_Count = count;
+	}
+	if(value != ACR_NULL)
+	{
+		*value = (void*)leaf;
+	}
+	return ACR_INFO_OK;
+}
+
+////////////////////////////////////////////////////////////
+//
+// PUBLIC FUNCTIONS
+//
+////////////////////////////////////////////////////////////
+
+/**********************************************************/
+void ACR_RadixTreeInit(
+	ACR_RadixTree_t* me,
+	ACR_Length_t valueLength)
+{
+	if(me == ACR_NULL)
+	{
+		return;
+	}
+
+	memset(me, 0, sizeof(ACR_RadixTree_t));
+	me->m_ValueLength = valueLength;
+}
+
+/**********************************************************/
+void ACR_RadixTreeDeInit(
+	ACR_RadixTree_t* me)
+{
+	#if ACR_HAS_MALLOC == ACR_BOOL_TRUE
+	ACR_RadixTreeLarge_t* large;
+	void* block;
+	#endif
+
+	if(me == ACR_NULL)
+	{
+		return;
+	}
+
+	// every node and key is in a block or in the list of large
+	// ones, so the tree does not need to be walked
+	#if ACR_HAS_MALLOC == ACR_BOOL_TRUE
+	while(me->m_Large != ACR_NULL)
+	{
+		large = (ACR_RadixTreeLarge_t*)me->m_Large;
+		me->m_Large = large->m_Next;
+		ACR_FREE(large);
+	}
+	while(me->m_Blocks != ACR_NULL)
+	{
+		block = me->m_Blocks;
+		me->m_Blocks = *((void**)block);
+		ACR_FREE(block);
+	}
+	#endif
+	ACR_RadixTreeInit(me, me->m_ValueLength);
+}
+
+/**********************************************************/
+ACR_Info_t ACR_RadixTreeAdd(
+	ACR_RadixTree_t* me,
+	ACR_String_t key,
+	void** value)
+{
+	const ACR_Byte_t* src = (const ACR_Byte_t*)key.m_Buffer.m_Pointer;
+	ACR_Length_t length = key.m_Buffer.m_Length;
+	ACR_Length_t depth = 0;
+	ACR_Length_t common;
+	ACR_Length_t leafLength;
+	ACR_RadixTreeNode_t* node;
+	ACR_RadixTreeNode_t* split;
+	ACR_RadixTreeNode_t* shorter = ACR_NULL;
+	ACR_Byte_t* leaf;
+	ACR_Byte_t* added;
+	ACR_Byte_t* moved = ACR_NULL;
+	ACR_Byte_t* leafKey;
+	void** ref;
+	void** child;
+
+	if((me == ACR_NULL) || ((src == ACR_NULL) && (length != 0)) || (length > ACR_RADIX_TREE_MAX_KEY_LENGTH))
+	{
+		return ACR_INFO_ERROR;
+	}
+
+	ref = &me->m_Root;
+	while(1)
+	{
+		if(*ref == ACR_NULL)
+		{
+			added = ACR_RadixTreeNewLeaf(me, ACR_NULL, src, length, -1, ACR_NULL, 0);
+			if(added == ACR_NULL)
+			{
+				return ACR_INFO_ERROR;
+			}
+			*ref = ACR_RADIX_TREE_TAG(added);
+			break;
+		}
+
+		if(ACR_RADIX_TREE_IS_LEAF(*ref))
+		{
+			leaf = ACR_RADIX_TREE_LEAF(*ref);
+			leafKey = ACR_RADIX_TREE_LEAF_KEY(me, leaf);
+			leafLength = ACR_RADIX_TREE_LEAF_LENGTH(me, leaf);
+			common = ACR_RadixTreeCommon(leafKey, leafLength, src + depth, length - depth);
+			if((common == leafLength) && (common == (length - depth)))
+			{
+				if(value != ACR_NULL)
+				{
+					*value = leaf;
+				}
+				return ACR_INFO_OLD;
+			}
+
+			// a node for the bytes both keys have takes the
+			// place of the key, with both keys below it
+			split = ACR_RadixTreeNewNode(me, ACR_RADIX_TREE_NODE4, leafKey, common, -1, ACR_NULL, 0);
+			// the key byte of a child is not stored in the child
+			added = ACR_RadixTreeNewLeaf(me, ACR_NULL, ACR_NULL, 0, -1, src + depth + common + ((common == (length - depth)) ? 0 : 1),
+				(common == (length - depth)) ? 0 : (length - depth - common - 1));
+			if((split != ACR_NULL) && (added != ACR_NULL))
+			{
+				moved = ACR_RadixTreeNewLeaf(me, leaf, ACR_NULL, 0, -1, leafKey + common + ((common == leafLength) ? 0 : 1),
+					(common == leafLength) ? 0 : (leafLength - common - 1));
+			}
+			if((split == ACR_NULL) || (added == ACR_NULL) || (moved == ACR_NULL))
+			{
+				if(split != ACR_NULL)
+				{
+					ACR_RadixTreeFreeNode(me, split);
+				}
+				if(added != ACR_NULL)
+				{
+					ACR_RadixTreeFreeLeaf(me, added);
+				}
+				return ACR_INFO_ERROR;
+			}
+			if(common == leafLength)
+			{
+				split->m_Leaf = moved;
+			}
+			else
+			{
+				ACR_RadixTreeInsertChild(split, leafKey[common], ACR_RADIX_TREE_TAG(moved));
+			}
+			if(common == (length - depth))
+			{
+				split->m_Leaf = added;
+			}
+			else
+			{
+				ACR_RadixTreeInsertChild(split, src[depth + common], ACR_RADIX_TREE_TAG(added));
+			}
+			ACR_RadixTreeFreeLeaf(me, leaf);
+			*ref = split;
+			break;
+		}
+
+		node = (ACR_RadixTreeNode_t*)*ref;
+		common = ACR_RadixTreeCommon(ACR_RADIX_TREE_PREFIX(node), node->m_PrefixLength, src + depth, length - depth);
+		if(common < node->m_PrefixLength)
+		{
+			// the key is different inside the prefix, so a node
+			// for the bytes before the difference takes the
+			// place of the node with a shorter prefix
+			split = ACR_RadixTreeNewNode(me, ACR_RADIX_TREE_NODE4, ACR_RADIX_TREE_PREFIX(node), common, -1, ACR_NULL, 0);
+			added = ACR_RadixTreeNewLeaf(me, ACR_NULL, ACR_NULL, 0, -1, src + depth + common + ((common == (length - depth)) ? 0 : 1),
+				(common == (length - depth)) ? 0 : (length - depth - common - 1));
+			if((split != ACR_NULL) && (added != ACR_NULL))
+			{
+				shorter = ACR_RadixTreeCopyNode(me, node, node->m_Type, ACR_RADIX_TREE_PREFIX(node) + common + 1,
+					node->m_PrefixLength - common - 1, -1, ACR_NULL, 0);
+			}
+			if((split == ACR_NULL) || (added == ACR_NULL) || (shorter == ACR_NULL))
+			{
+				if(split != ACR_NULL)
+				{
+					ACR_RadixTreeFreeNode(me, split);
+				}
+				if(added != ACR_NULL)
+				{
+					ACR_RadixTreeFreeLeaf(me, added);
+				}
+				return ACR_INFO_ERROR;
+			}
+			ACR_RadixTreeInsertChild(split, ACR_RADIX_TREE_PREFIX(node)[common], shorter);
+			if(common == (length - depth))
+			{
+				split->m_Leaf = added;
+			}
+			else
+			{
+				ACR_RadixTreeInsertChild(split, src[depth + common], ACR_RADIX_TREE_TAG(added));
+			}
+			ACR_RadixTreeFreeNode(me, node);
+			*ref = split;
+			break;
+		}
+
+		depth += common;
+		if(depth == length)
+		{
+			if(node->m_Leaf != ACR_NULL)
+			{
+				if(value != ACR_NULL)
+				{
+					*value = node->m_Leaf;
+				}
+				return ACR_INFO_OLD;
+			}
+			added = ACR_RadixTreeNewLeaf(me, ACR_NULL, ACR_NULL, 0, -1, ACR_NULL, 0);
+			if(added == ACR_NULL)
+			{
+				return ACR_INFO_ERROR;
+			}
+			node->m_Leaf = added;
+			break;
+		}
+
+		child = ACR_RadixTreeFindChild(node, src[depth]);
+		if(child == ACR_NULL)
+		{
+			added = ACR_RadixTreeNewLeaf(me, ACR_NULL, src + depth + 1, length - depth - 1, -1, ACR_NULL, 0);
+			if(added == ACR_NULL)
+			{
+				return ACR_INFO_ERROR;
+			}
+			if(ACR_RadixTreeAddChild(me, ref, src[depth], ACR_RADIX_TREE_TAG(added)) != ACR_INFO_OK)
+			{
+				ACR_RadixTreeFreeLeaf(me, added);
+				return ACR_INFO_ERROR;
+			}
+			break;
+		}
+		ref = child;
+		depth++;
+	}
+
+	me->m_Count++;
+	if(value != ACR_NULL)
+	{
+		*value = added;
+	}
+	return ACR_INFO_NEW;
+}
+
+/**********************************************************/
+ACR_Info_t ACR_RadixTreeFind(
+	const ACR_RadixTree_t* me,
+	ACR_String_t key,
+	void** value)
+{
+	const ACR_Byte_t* src = (const ACR_Byte_t*)key.m_Buffer.m_Pointer;
+	const ACR_RadixTreeNode_t* node;
+	const ACR_Byte_t* leaf;
+	ACR_Length_t length = key.m_Buffer.m_Length;
+	ACR_Length_t depth = 0;
+	void** child;
+	const void* current;
+
+	if((me == ACR_NULL) || ((src == ACR_NULL) && (length != 0)))
+	{
+		return ACR_INFO_UNKNOWN;
+	}
+
+	current = me->m_Root;
+	while(current != ACR_NULL)
+	{
+		if(ACR_RADIX_TREE_IS_LEAF(current))
+		{
+			leaf = ACR_RADIX_TREE_LEAF(current);
+			if((ACR_RADIX_TREE_LEAF_LENGTH(me, leaf) != (length - depth)) ||
+			   ((depth < length) && (memcmp(ACR_RADIX_TREE_LEAF_KEY(me, leaf), src + depth, (size_t)(length - depth)) != 0)))
+			{
+				return ACR_INFO_UNKNOWN;
+			}
+			if(value != ACR_NULL)
+			{
+				*value = (void*)leaf;
+			}
+			return ACR_INFO_OK;
+		}
+
+		node = (const ACR_RadixTreeNode_t*)current;
+		if((node->m_PrefixLength > (length - depth)) ||
+		   ((node->m_PrefixLength > 0) && (memcmp(ACR_RADIX_TREE_PREFIX(node), src + depth, (size_t)node->m_PrefixLength) != 0)))
+		{
+			return ACR_INFO_UNKNOWN;
+		}
+		depth += node->m_PrefixLength;
+		if(depth == length)
+		{
+			if(node->m_Leaf == ACR_NULL)
+			{
+				return ACR_INFO_UNKNOWN;
+			}
+			if(value != ACR_NULL)
+			{
+				*value = node->m_Leaf;
+			}
+			return ACR_INFO_OK;
+		}
+		child = ACR_RadixTreeFindChild(node, src[depth]);
+		if(child == ACR_NULL)
+		{
+			return ACR_INFO_UNKNOWN;
+		}
+		current = *child;
+		depth++;
+	}
+	return ACR_INFO_UNKNOWN;
+}
+
+/**********************************************************/
+ACR_Info_t ACR_RadixTreeRemove(
+	ACR_RadixTree_t* me,
+	ACR_String_t key)
+{
+	const ACR_Byte_t* src = (const ACR_Byte_t*)key.m_Buffer.m_Pointer;
+	ACR_RadixTreeNode_t* node;
+	ACR_Byte_t* leaf;
+	ACR_Length_t length = key.m_Buffer.m_Length;
+	ACR_Length_t depth = 0;
+	void** ref;
+	void** child;
+
+	if((me == ACR_NULL) || (me->m_Root == ACR_NULL) || ((src == ACR_NULL) && (length != 0)))
+	{
+		return ACR_INFO_UNKNOWN;
+	}
+
+	if(ACR_RADIX_TREE_IS_LEAF(me->m_Root))
+	{
+		leaf = ACR_RADIX_TREE_LEAF(me->m_Root);
+		if((ACR_RADIX_TREE_LEAF_LENGTH(me, leaf) != length) ||
+		   ((length > 0) && (memcmp(ACR_RADIX_TREE_LEAF_KEY(me, leaf), src, (size_t)length) != 0)))
+		{
+			return ACR_INFO_UNKNOWN;
+		}
+		ACR_RadixTreeFreeLeaf(me, leaf);
+		me->m_Root = ACR_NULL;
+		me->m_Count--;
+		return ACR_INFO_OK;
+	}
+
+	// keys are removed from the node above them so that the
+	// node can shrink
+	ref = &me->m_Root;
+	while(1)
+	{
+		node = (ACR_RadixTreeNode_t*)*ref;
+		if((node->m_PrefixLength > (length - depth)) ||
+		   ((node->m_PrefixLength > 0) && (memcmp(ACR_RADIX_TREE_PREFIX(node), src + depth, (size_t)node->m_PrefixLength) != 0)))
+		{
+			return ACR_INFO_UNKNOWN;
+		}
+		depth += node->m_PrefixLength;
+		if(depth == length)
+		{
+			if(node->m_Leaf == ACR_NULL)
+			{
+				return ACR_INFO_UNKNOWN;
+			}
+			ACR_RadixTreeFreeLeaf(me, node->m_Leaf);
+			node->m_Leaf = ACR_NULL;
+			break;
+		}
+		child = ACR_RadixTreeFindChild(node, src[depth]);
+		if(child == ACR_NULL)
+		{
+			return ACR_INFO_UNKNOWN;
+		}
+		if(ACR_RADIX_TREE_IS_LEAF(*child))
+		{
+			leaf = ACR_RADIX_TREE_LEAF(*child);
+			if((ACR_RADIX_TREE_LEAF_LENGTH(me, leaf) != (length - depth - 1)) ||
+			   (memcmp(ACR_RADIX_TREE_LEAF_KEY(me, leaf), src + depth + 1, (size_t)(length - depth - 1)) != 0))
+			{
+				return ACR_INFO_UNKNOWN;
+			}
+			ACR_RadixTreeFreeLeaf(me, leaf);
+			ACR_RadixTreeRemoveChild(node, src[depth]);
+			break;
+		}
+		ref = child;
+		depth++;
+	}
+
+	me->m_Count--;
+	if((node->m_Count == 0) && (node->m_Leaf == ACR_NULL))
+	{
+		// only a node that could not shrink before can be
+		// empty, and an empty node below the root is left in
+		// place since it is still a valid tree
+		if(ref == &me->m_Root)
+		{
+			ACR_RadixTreeFreeNode(me, node);
+			me->m_Root = ACR_NULL;
+		}
+		return ACR_INFO_OK;
+	}
+	ACR_RadixTreeShrink(me, ref);
+	return ACR_INFO_OK;
+}
+
+/**********************************************************/
+ACR_Info_t ACR_RadixTreeLongestPrefix(
+	const ACR_RadixTree_t* me,
+	ACR_String_t string,
+	ACR_Length_t* length,
+	void** value)
+{
+	const ACR_Byte_t* src = (const ACR_Byte_t*)string.m_Buffer.m_Pointer;
+	const ACR_RadixTreeNode_t* node;
+	const ACR_Byte_t* leaf;
+	const ACR_Byte_t* found = ACR_NULL;
+	ACR_Length_t foundLength = 0;
+	ACR_Length_t leafLength;
+	ACR_Length_t depth = 0;
+	void** child;
+	const void* current;
+
+	if((me == ACR_NULL) || ((src == ACR_NULL) && (string.m_Buffer.m_Length != 0)))
+	{
+		return ACR_INFO_UNKNOWN;
+	}
+
+	// every key on the path of the string that ends before it
+	// is a prefix, and the last one is the longest
+	current = me->m_Root;
+	while(current != ACR_NULL)
+	{
+		if(ACR_RADIX_TREE_IS_LEAF(current))
+		{
+			leaf = ACR_RADIX_TREE_LEAF(current);
+			leafLength = ACR_RADIX_TREE_LEAF_LENGTH(me, leaf);
+			if((leafLength <= (string.m_Buffer.m_Length - depth)) &&
+			   ((leafLength == 0) || (memcmp(ACR_RADIX_TREE_LEAF_KEY(me, leaf), src + depth, (size_t)leafLength) == 0)))
+			{
+				found = leaf;
+				foundLength = depth + leafLength;
+			}
+			break;
+		}
+
+		node = (const ACR_RadixTreeNode_t*)current;
+		if((node->m_PrefixLength > (string.m_Buffer.m_Length - depth)) ||
+		   ((node->m_PrefixLength > 0) && (memcmp(ACR_RADIX_TREE_PREFIX(node), src + depth, (size_t)node->m_PrefixLength) != 0)))
+		{
+			break;
+		}
+		depth += node->m_PrefixLength;
+		if(node->m_Leaf != ACR_NULL)
+		{
+			found = node->m_Leaf;
+			foundLength = depth;
+		}
+		if(depth == string.m_Buffer.m_Length)
+		{
+			break;
+		}
+		child = ACR_RadixTreeFindChild(node, src[depth]);
+		if(child == ACR_NULL)
+		{
+			break;
+		}
+		current = *child;
+		depth++;
+	}
+
+	if(found == ACR_NULL)
+	{
+		return ACR_INFO_UNKNOWN;
+	}
+	if(length != ACR_NULL)
+	{
+		*length = foundLength;
+	}
+	if(value != ACR_NULL)
+	{
+		*value = (void*)found;
+	}
+	return ACR_INFO_OK;
+}
+
+/**********************************************************/
+ACR_Info_t ACR_RadixTreeIteratorInit(
+	ACR_RadixTreeIterator_t* me,
+	const ACR_RadixTree_t* tree,
+	ACR_String_t prefix)
+{
+	const ACR_Byte_t* src = (const ACR_Byte_t*)prefix.m_Buffer.m_Pointer;
+	const ACR_RadixTreeNode_t* node;
+	const ACR_Byte_t* leaf;
+	ACR_Length_t length = prefix.m_Buffer.m_Length;
+	ACR_Length_t depth = 0;
+	ACR_Length_t compare;
+	void** child;
+	const void* current;
+
+	if(me == ACR_NULL)
+	{
+		return ACR_INFO_ERROR;
+	}
+
+	memset(me, 0, sizeof(ACR_RadixTreeIterator_t));
+	if((tree == ACR_NULL) || ((src == ACR_NULL) && (length != 0)))
+	{
+		return ACR_INFO_OK;
+	}
+
+	// find the node or key where every key below it starts
+	// with the prefix
+	current = tree->m_Root;
+	while(current != ACR_NULL)
+	{
+		if(ACR_RADIX_TREE_IS_LEAF(current))
+		{
+			leaf = ACR_RADIX_TREE_LEAF(current);
+			if((ACR_RADIX_TREE_LEAF_LENGTH(tree, leaf) < (length - depth)) ||
+			   ((depth < length) && (memcmp(ACR_RADIX_TREE_LEAF_KEY(tree, leaf), src + depth, (size_t)(length - depth)) != 0)))
+			{
+				return ACR_INFO_OK;
+			}
+			break;
+		}
+
+		node = (const ACR_RadixTreeNode_t*)current;
+		compare = (node->m_PrefixLength < (length - depth)) ? node->m_PrefixLength : (length - depth);
+		if((compare > 0) && (memcmp(ACR_RADIX_TREE_PREFIX(node), src + depth, (size_t)compare) != 0))
+		{
+			return ACR_INFO_OK;
+		}
+		if((length - depth) <= node->m_PrefixLength)
+		{
+			break;
+		}
+		depth += node->m_PrefixLength;
+		child = ACR_RadixTreeFindChild(node, src[depth]);
+		if(child == ACR_NULL)
+		{
+			return ACR_INFO_OK;
+		}
+		current = *child;
+		depth++;
+	}
+	if(current == ACR_NULL)
+	{
+		return ACR_INFO_OK;
+	}
+
+	// the key bytes above the node or key are the first bytes
+	// of the prefix
+	if(ACR_RadixTreeKeyRoom(me, 0, depth + 1) != ACR_INFO_OK)
+	{
+		return ACR_INFO_ERROR;
+	}
+	if(depth > 0)
+	{
+		memcpy(me->m_Key.m_Pointer, src, (size_t)depth);
+	}
+	me->m_Tree = tree;
+	me->m_Start = current;
+	me->m_StartLength = depth;
+	return ACR_INFO_OK;
+}
+
+/**********************************************************/
+void ACR_RadixTreeIteratorDeInit(
+	ACR_RadixTreeIterator_t* me)
+{
+	if(me == ACR_NULL)
+	{
+		return;
+	}
+
+	ACR_BUFFER_FREE(me->m_Stack);
+	ACR_BUFFER_FREE(me->m_Key);
+	me->m_Start = ACR_NULL;
+	me->m_Depth = 0;
+}
+
+/**********************************************************/
+ACR_Info_t ACR_RadixTreeNext(
+	ACR_RadixTreeIterator_t* me,
+	ACR_String_t* key,
+	void** value)
+{
+	ACR_RadixTreeFrame_t* frame;
+	ACR_Info_t result;
+	ACR_Byte_t byte;
+	const void* child;
+
+	if(me == ACR_NULL)
+	{
+		return ACR_INFO_UNKNOWN;
+	}
+
+	if(me->m_Start != ACR_NULL)
+	{
+		child = me->m_Start;
+		me->m_Start = ACR_NULL;
+		result = ACR_RadixTreeVisit(me, me->m_Tree, child, me->m_StartLength, key, value);
+		if(result != ACR_INFO_UNKNOWN)
+		{
+			return result;
+		}
+	}
+
+	// the key that ends at a node comes before the keys of its
+	// children, which are listed in key byte order
+	while(me->m_Depth > 0)
+	{
+		frame = ((ACR_RadixTreeFrame_t*)me->m_Stack.m_Pointer) + me->m_Depth - 1;
+		child = ACR_RadixTreeNextChild(frame->m_Node, &frame->m_Position, &byte);
+		if(child == ACR_NULL)
+		{
+			me->m_Depth--;
+			continue;
+		}
+		((ACR_Byte_t*)me->m_Key.m_Pointer)[frame->m_KeyLength] = byte;
+		result = ACR_RadixTreeVisit(me, me->m_Tree, child, frame->m_KeyLength + 1, key, value);
+		if(result != ACR_INFO_UNKNOWN)
+		{
+			return result;
+		}
+	}
+	return ACR_INFO_UNKNOWN;
+}
@@ -0,0 +1,1663 @@
+/*
+
+    ********** DO NOT REMOVE THIS INFORMATION ************
+
+    ACR - A set of C functions in a git Repository
+    Copyright (C) 2018 - 2020 Adam C. Rosenberg
+
+    Please read LICENSE before using this code
+
+    Please read README.md for instructions on including
+    this code in your project and where to find examples
+
+    If you contribute to this code, Please add your name
+    and email address to the AUTHORS list below so that
+    we know who to thank!
+
+    AUTHORS
+
+    Adam Rosenberg <adam@sirspot.com>
+
+    LICENSE
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+    ******************************************************
+
+*/
+/** \file roaringbitmap.c
+
+    functions for access to the ACR_RoaringBitmap_t type
+
+*/
+#include "ACR/roaringbitmap.h"
+
+////////////////////////////////////////////////////////////
+//
+// PRIVATE DEFINES
+//
+////////////////////////////////////////////////////////////
+
+/** serialized data starts with these 4 bytes
+*/
+#define ACR_ROARING_MAGIC "ACRR"
+
+/** serialized header is the magic value and the container count
+*/
+#define ACR_ROARING_HEADER_LENGTH 8
+
+/** serialized container descriptor is
+    key(2) type(1) reserved(1) length(4) cardinality(4) offset(4)
+*/
+#define ACR_ROARING_DESCRIPTOR_LENGTH 16
+
+/** serialized container data is aligned on this boundary
+*/
+#define ACR_ROARING_DATA_ALIGN 8
+
+/** the number of bytes in a bitmap container
+*/
+#define ACR_ROARING_BITMAP_BYTES (ACR_ROARING_CHUNK_SIZE / ACR_BITS_PER_BYTE)
+
+/** get the upper and lower 16 bits of a value
+*/
+#define ACR_ROARING_KEY(value) ((unsigned short)((value) >> 16))
+#define ACR_ROARING_LOW(value) ((unsigned short)((value) & 0xFFFF))
+
+/** get the container data as a specific type
+*/
+#define ACR_ROARING_VALUES(container) ((unsigned short*)(container)->m_Data.m_Pointer)
+#define ACR_ROARING_BLOCKS(container) ((ACR_Block_t*)(container)->m_Data.m_Pointer)
+
+/** get the containers of a bitmap
+*/
+#define ACR_ROARING_CONTAINERS(me) ((ACR_RoaringContainer_t*)(me)->m_Containers.m_Pointer)
+
+/** access a single bit in bitmap container blocks
+*/
+#define ACR_ROARING_BIT_TEST(blocks, low) (((blocks)[(low) / ACR_BITS_PER_BLOCK] & (((ACR_Block_t)1) << ((low) % ACR_BITS_PER_BLOCK))) != 0)
+#define ACR_ROARING_BIT_SET(blocks, low) (blocks)[(low) / ACR_BITS_PER_BLOCK] |= (((ACR_Block_t)1) << ((low) % ACR_BITS_PER_BLOCK));
+#define ACR_ROARING_BIT_CLEAR(blocks, low) (blocks)[(low) / ACR_BITS_PER_BLOCK] &= (~(((ACR_Block_t)1) << ((low) % ACR_BITS_PER_BLOCK)));
+
+////////////////////////////////////////////////////////////
+//
+// PRIVATE FUNCTIONS - CONTAINERS
+//
+////////////////////////////////////////////////////////////
+
+/** find the first position in a sorted array that is not less than the value
+*/
+static ACR_Count_t ACR_RoaringLowerBound(
+	const unsigned short* values,
+	ACR_Count_t length,
+	unsigned short value)
+{
+	ACR_Count_t low = 0;
+	ACR_Count_t high = length;
+	while(low < high)
+	{
+		ACR_Count_t middle = low + ((high - low) / 2);
+		if(values[middle] < value)
+		{
+			low = middle + 1;
+		}
+		else
+		{
+			high = middle;
+		}
+	}
+	return low;
+}
+
+/** find the first position at or after start that is not less
+    than the value by searching 1, 2, 4, 8... values ahead and
+	then doing a binary search within the last step
+*/
+static ACR_Count_t ACR_RoaringGallop(
+	const unsigned short* values,
+	ACR_Count_t start,
+	ACR_Count_t length,
+	unsigned short value)
+{
+	ACR_Count_t step = 1;
+	ACR_Count_t high = start;
+	ACR_Count_t low;
+	while((high < length) && (values[high] < value))
+	{
+		start = high + 1;
+		high += step;
+		step *= 2;
+	}
+	low = start;
+	if(high > length)
+	{
+		high = length;
+	}
+	return low + ACR_RoaringLowerBound(values + low, high - low, value);
+}
+
+/** make sure the container data has room for the specified
+    number of bytes without losing the existing data
+*/
+static ACR_Info_t ACR_RoaringContainerReserve(
+	ACR_RoaringContainer_t* container,
+	ACR_Length_t length,
+	ACR_Length_t used)
+{
+	ACR_BUFFER(newData);
+
+	if(container->m_Data.m_Length >= length)
+	{
+		return ACR_INFO_OK;
+	}
+
+	ACR_BUFFER_ALLOC(newData, length);
+	if(ACR_BUFFER_IS_VALID(newData) == ACR_BOOL_FALSE)
+	{
+		return ACR_INFO_ERROR;
+	}
+	if(used > 0)
+	{
+		memcpy(newData.m_Pointer, container->m_Data.m_Pointer, (size_t)used);
+	}
+	ACR_BUFFER_FREE(container->m_Data);
+	container->m_Data = newData;
+	return ACR_INFO_OK;
+}
+
+/** count the set bits in a bitmap container
+*/
+static ACR_Count_t ACR_RoaringBlocksCardinality(
+	const ACR_Block_t* blocks)
+{
+	ACR_Count_t count = 0;
+	ACR_Count_t i;
+	for(i = 0; i < ACR_ROARING_BITMAP_BLOCKS; i++)
+	{
+		count += (ACR_Count_t)ACR_BLOCK_POPCOUNT(blocks[i]);
+	}
+	return count;
+}
+
+/** fill bitmap container blocks with the values of any container
+*/
+static void ACR_RoaringContainerToBlocks(
+	const ACR_RoaringContainer_t* container,
+	ACR_Block_t* blocks)
+{
+	ACR_Count_t i;
+	if(container->m_Type == ACR_ROARING_BITMAP)
+	{
+		memcpy(blocks, container->m_Data.m_Pointer, ACR_ROARING_BITMAP_BYTES);
+		return;
+	}
+	ACR_MEMSET(blocks, 0, ACR_ROARING_BITMAP_BYTES);
+	if(container->m_Type == ACR_ROARING_ARRAY)
+	{
+		const unsigned short* values = ACR_ROARING_VALUES(container);
+		for(i = 0; i < container->m_Length; i++)
+		{
+			ACR_ROARING_BIT_SET(blocks, values[i]);
+		}
+	}
+	else
+	{
+		const unsigned short* runs = ACR_ROARING_VALUES(container);
+		for(i = 0; i < container->m_Length; i++)
+		{
+			ACR_Count_t value = runs[i*2];
+			ACR_Count_t last = value + runs[(i*2)+1];
+			while(value <= last)
+			{
+				ACR_ROARING_BIT_SET(blocks, value);
+				value++;
+			}
+		}
+	}
+}
+
+/** fill an array with the values of bitmap container blocks
+	\returns the number of values
+*/
+static ACR_Count_t ACR_RoaringBlocksToValues(
+	const ACR_Block_t* blocks,
+	unsigned short* values)
+{
+	ACR_Count_t length = 0;
+	ACR_Count_t i;
+	for(i = 0; i < ACR_ROARING_BITMAP_BLOCKS; i++)
+	{
+		ACR_Block_t block = blocks[i];
+		while(block != 0)
+		{
+			values[length] = (unsigned short)((i * ACR_BITS_PER_BLOCK) + (ACR_Count_t)ACR_BLOCK_TRAILING_ZEROS(block));
+			length++;
+			block &= (block - 1);
+		}
+	}
+	return length;
+}
+
+/** replace the container data with an array or bitmap copy
+    of the specified blocks based on the cardinality
+*/
+static ACR_Info_t ACR_RoaringContainerFromBlocks(
+	ACR_RoaringContainer_t* container,
+	const ACR_Block_t* blocks,
+	ACR_Count_t cardinality)
+{
+	ACR_BUFFER_FREE(container->m_Data);
+	if(cardinality <= ACR_ROARING_ARRAY_MAX)
+	{
+		ACR_BUFFER_ALLOC(container->m_Data, (cardinality + 1) * sizeof(unsigned short));
+		if(ACR_BUFFER_IS_VALID(container->m_Data) == ACR_BOOL_FALSE)
+		{
+			return ACR_INFO_ERROR;
+		}
+		container->m_Type = ACR_ROARING_ARRAY;
+		container->m_Length = ACR_RoaringBlocksToValues(blocks, ACR_ROARING_VALUES(container));
+	}
+	else
+	{
+		ACR_BUFFER_ALLOC(container->m_Data, ACR_ROARING_BITMAP_BYTES);
+		if(ACR_BUFFER_IS_VALID(container->m_Data) == ACR_BOOL_FALSE)
+		{
+			return ACR_INFO_ERROR;
+		}
+		container->m_Type = ACR_ROARING_BITMAP;
+		container->m_Length = ACR_ROARING_BITMAP_BLOCKS;
+		memcpy(container->m_Data.m_Pointer, blocks, ACR_ROARING_BITMAP_BYTES);
+	}
+	container->m_Cardinality = cardinality;
+	return ACR_INFO_OK;
+}
+
+/** convert a run container to an array or bitmap container
+    so that it can be changed
+*/
+static ACR_Info_t ACR_RoaringContainerUnRun(
+	ACR_RoaringContainer_t* container)
+{
+	ACR_Block_t blocks[ACR_ROARING_BITMAP_BLOCKS];
+	if(container->m_Type != ACR_ROARING_RUN)
+	{
+		return ACR_INFO_OK;
+	}
+	ACR_RoaringContainerToBlocks(container, blocks);
+	return ACR_RoaringContainerFromBlocks(container, blocks, container->m_Cardinality);
+}
+
+/** check if a container has the specified lower 16 bits
+*/
+static ACR_Info_t ACR_RoaringContainerContains(
+	const ACR_RoaringContainer_t* container,
+	unsigned short low)
+{
+	const unsigned short* values = ACR_ROARING_VALUES(container);
+	ACR_Count_t pos;
+	switch(container->m_Type)
+	{
+		case ACR_ROARING_ARRAY:
+		{
+			pos = ACR_RoaringLowerBound(values, container->m_Length, low);
+			if((pos < container->m_Length) && (values[pos] == low))
+			{
+				return ACR_INFO_TRUE;
+			}
+			break;
+		}
+		case ACR_ROARING_BITMAP:
+		{
+			if(ACR_ROARING_BIT_TEST(ACR_ROARING_BLOCKS(container), low))
+			{
+				return ACR_INFO_TRUE;
+			}
+			break;
+		}
+		default:
+		{
+			// binary search for the last run that starts at or before low
+			ACR_Count_t first = 0;
+			ACR_Count_t last = container->m_Length;
+			while(first < last)
+			{
+				ACR_Count_t middle = first + ((last - first) / 2);
+				if(values[middle*2] <= low)
+				{
+					first = middle + 1;
+				}
+				else
+				{
+					last = middle;
+				}
+			}
+			if(first > 0)
+			{
+				pos = first - 1;
+				if(((ACR_Count_t)low - values[pos*2]) <= values[(pos*2)+1])
+				{
+					return ACR_INFO_TRUE;
+				}
+			}
+			break;
+		}
+	}
+	return ACR_INFO_FALSE;
+}
+
+/** find the first value in a container that is not less than low
+	\returns ACR_INFO_OK or ACR_INFO_ERROR if none
+*/
+static ACR_Info_t ACR_RoaringContainerFindNext(
+	const ACR_RoaringContainer_t* container,
+	ACR_Count_t low,
+	ACR_Count_t* found)
+{
+	const unsigned short* values = ACR_ROARING_VALUES(container);
+	ACR_Count_t i;
+	switch(container->m_Type)
+	{
+		case ACR_ROARING_ARRAY:
+		{
+			i = ACR_RoaringLowerBound(values, container->m_Length, (unsigned short)low);
+			if(i < container->m_Length)
+			{
+				(*found) = values[i];
+				return ACR_INFO_OK;
+			}
+			break;
+		}
+		case ACR_ROARING_BITMAP:
+		{
+			const ACR_Block_t* blocks = ACR_ROARING_BLOCKS(container);
+			ACR_Block_t block;
+			i = low / ACR_BITS_PER_BLOCK;
+			block = blocks[i] & (~((((ACR_Block_t)1) << (low % ACR_BITS_PER_BLOCK)) - 1));
+			while(block == 0)
+			{
+				i++;
+				if(i >= ACR_ROARING_BITMAP_BLOCKS)
+				{
+					return ACR_INFO_ERROR;
+				}
+				block = blocks[i];
+			}
+			(*found) = (i * ACR_BITS_PER_BLOCK) + (ACR_Count_t)ACR_BLOCK_TRAILING_ZEROS(block);
+			return ACR_INFO_OK;
+		}
+		default:
+		{
+			for(i = 0; i < container->m_Length; i++)
+			{
+				ACR_Count_t start = values[i*2];
+				ACR_Count_t last = start + values[(i*2)+1];
+				if(low <= last)
+				{
+					(*found) = (low > start) ? low : start;
+					return ACR_INFO_OK;
+				}
+			}
+			break;
+		}
+	}
+	return ACR_INFO_ERROR;
+}
+
+/** make a copy of a container that owns its data
+*/
+static ACR_Info_t ACR_RoaringContainerCopy(
+	ACR_RoaringContainer_t* dst,
+	const ACR_RoaringContainer_t* src)
+{
+	ACR_Length_t length;
+	switch(src->m_Type)
+	{
+		case ACR_ROARING_ARRAY:
+			length = src->m_Length * sizeof(unsigned short);
+			break;
+		case ACR_ROARING_BITMAP:
+			length = ACR_ROARING_BITMAP_BYTES;
+			break;
+		default:
+			length = src->m_Length * 2 * sizeof(unsigned short);
+			break;
+	}
+	dst->m_Data.m_Pointer = ACR_NULL;
+	dst->m_Data.m_Length = ACR_ZERO_LENGTH;
+	dst->m_Data.m_Flags = ACR_BUFFER_FLAGS_NONE;
+	ACR_BUFFER_ALLOC(dst->m_Data, length);
+	if(ACR_BUFFER_IS_VALID(dst->m_Data) == ACR_BOOL_FALSE)
+	{
+		return ACR_INFO_ERROR;
+	}
+	memcpy(dst->m_Data.m_Pointer, src->m_Data.m_Pointer, (size_t)length);
+	dst->m_Length = src->m_Length;
+	dst->m_Cardinality = src->m_Cardinality;
+	dst->m_Key = src->m_Key;
+	dst->m_Type = src->m_Type;
+	return ACR_INFO_OK;
+}
+
+////////////////////////////////////////////////////////////
+//
+// PRIVATE FUNCTIONS - CONTAINER LIST
+//
+////////////////////////////////////////////////////////////
+
+/** find a container by key
+	\param index location to store the position of the container
+	       or the position where it should be inserted
+	\returns ACR_INFO_EQUAL if found or ACR_INFO_NOT_EQUAL
+*/
+static ACR_Info_t ACR_RoaringFindContainer(
+	ACR_RoaringBitmap_t* me,
+	unsigned short key,
+	ACR_Count_t* index)
+{
+	ACR_RoaringContainer_t* containers = ACR_ROARING_CONTAINERS(me);
+	ACR_Count_t low = 0;
+	ACR_Count_t high = me->m_ContainerCount;
+	while(low < high)
+	{
+		ACR_Count_t middle = low + ((high - low) / 2);
+		if(containers[middle].m_Key < key)
+		{
+			low = middle + 1;
+		}
+		else
+		{
+			high = middle;
+		}
+	}
+	(*index) = low;
+	if((low < me->m_ContainerCount) && (containers[low].m_Key == key))
+	{
+		return ACR_INFO_EQUAL;
+	}
+	return ACR_INFO_NOT_EQUAL;
+}
+
+/** insert an empty container
+	\returns the new container or ACR_NULL
+*/
+static ACR_RoaringContainer_t* ACR_RoaringInsertContainer(
+	ACR_RoaringBitmap_t* me,
+	ACR_Count_t index,
+	unsigned short key)
+{
+	ACR_RoaringContainer_t* container;
+	ACR_Length_t needed = (me->m_ContainerCount + 1) * sizeof(ACR_RoaringContainer_t);
+	if(me->m_Containers.m_Length < needed)
+	{
+		// double the number of containers each time more are needed
+		ACR_BUFFER(newContainers);
+		ACR_BUFFER_ALLOC(newContainers, needed * 2);
+		if(ACR_BUFFER_IS_VALID(newContainers) == ACR_BOOL_FALSE)
+		{
+			return ACR_NULL;
+		}
+		if(me->m_ContainerCount > 0)
+		{
+			memcpy(newContainers.m_Pointer, me->m_Containers.m_Pointer, me->m_ContainerCount * sizeof(ACR_RoaringContainer_t));
+		}
+		ACR_BUFFER_FREE(me->m_Containers);
+		me->m_Containers = newContainers;
+	}
+	container = ACR_ROARING_CONTAINERS(me) + index;
+	if(index < me->m_ContainerCount)
+	{
+		memmove(container + 1, container, (me->m_ContainerCount - index) * sizeof(ACR_RoaringContainer_t));
+	}
+	me->m_ContainerCount++;
+	container->m_Data.m_Pointer = ACR_NULL;
+	container->m_Data.m_Length = ACR_ZERO_LENGTH;
+	container->m_Data.m_Flags = ACR_BUFFER_FLAGS_NONE;
+	container->m_Length = 0;
+	container->m_Cardinality = 0;
+	container->m_Key = key;
+	container->m_Type = ACR_ROARING_ARRAY;
+	return container;
+}
+
+/** remove a container and free its data
+*/
+static void ACR_RoaringRemoveContainer(
+	ACR_RoaringBitmap_t* me,
+	ACR_Count_t index)
+{
+	ACR_RoaringContainer_t* container = ACR_ROARING_CONTAINERS(me) + index;
+	ACR_BUFFER_FREE(container->m_Data);
+	me->m_ContainerCount--;
+	if(index < me->m_ContainerCount)
+	{
+		memmove(container, container + 1, (me->m_ContainerCount - index) * sizeof(ACR_RoaringContainer_t));
+	}
+}
+
+/** add a container to the end of the result unless it is empty
+*/
+static ACR_RoaringContainer_t* ACR_RoaringAppendContainer(
+	ACR_RoaringBitmap_t* me,
+	unsigned short key)
+{
+	return ACR_RoaringInsertContainer(me, me->m_ContainerCount, key);
+}
+
+////////////////////////////////////////////////////////////
+//
+// PRIVATE FUNCTIONS - SET OPERATIONS
+//
+////////////////////////////////////////////////////////////
+
+/** intersect two sorted arrays
+	\returns the number of values written to out
+*/
+static ACR_Count_t ACR_RoaringIntersectArrays(
+	const unsigned short* a,
+	ACR_Count_t aLength,
+	const unsigned short* b,
+	ACR_Count_t bLength,
+	unsigned short* out)
+{
+	ACR_Count_t count = 0;
+	ACR_Count_t i = 0;
+	ACR_Count_t j = 0;
+
+	// make a the smaller array
+	if(aLength > bLength)
+	{
+		const unsigned short* tempValues = a;
+		ACR_Count_t tempLength = aLength;
+		a = b;
+		aLength = bLength;
+		b = tempValues;
+		bLength = tempLength;
+	}
+
+	if((aLength * ACR_ROARING_GALLOP_RATIO) < bLength)
+	{
+		// very different sizes so gallop through the large array
+		while((i < aLength) && (j < bLength))
+		{
+			j = ACR_RoaringGallop(b, j, bLength, a[i]);
+			if((j < bLength) && (b[j] == a[i]))
+			{
+				out[count] = a[i];
+				count++;
+				j++;
+			}
+			i++;
+		}
+		return count;
+	}
+
+	#if ACR_HAS_SSE2 == ACR_BOOL_TRUE
+	// compare 8 values of a with 8 values of b at a time and
+	// then skip ahead in whichever array has the smaller max
+	while(((i + 8) <= aLength) && ((j + 8) <= bLength))
+	{
+		__m128i va = _mm_loadu_si128((const __m128i*)(a + i));
+		__m128i match = _mm_cmpeq_epi16(va, _mm_set1_epi16((short)b[j]));
+		int mask;
+		int k;
+		for(k = 1; k < 8; k++)
+		{
+			match = _mm_or_si128(match, _mm_cmpeq_epi16(va, _mm_set1_epi16((short)b[j+k])));
+		}
+		// 2 bits per 16 bit value
+		mask = _mm_movemask_epi8(match);
+		for(k = 0; mask != 0; k++)
+		{
+			if((mask & 3) != 0)
+			{
+				out[count] = a[i+k];
+				count++;
+			}
+			mask >>= 2;
+		}
+		if(a[i+7] <= b[j+7])
+		{
+			if(a[i+7] == b[j+7])
+			{
+				j += 8;
+			}
+			i += 8;
+		}
+		else
+		{
+			j += 8;
+		}
+	}
+	#endif // #if ACR_HAS_SSE2 == ACR_BOOL_TRUE
+
+	// merge the remaining values
+	while((i < aLength) && (j < bLength))
+	{
+		if(a[i] < b[j])
+		{
+			i++;
+		}
+		else if(a[i] > b[j])
+		{
+			j++;
+		}
+		else
+		{
+			out[count] = a[i];
+			count++;
+			i++;
+			j++;
+		}
+	}
+	return count;
+}
+
+/** merge two sorted arrays without duplicates
+	\returns the number of values written to out
+*/
+static ACR_Count_t ACR_RoaringUnionArrays(
+	const unsigned short* a,
+	ACR_Count_t aLength,
+	const unsigned short* b,
+	ACR_Count_t bLength,
+	unsigned short* out)
+{
+	ACR_Count_t count = 0;
+	ACR_Count_t i = 0;
+	ACR_Count_t j = 0;
+	while((i < aLength) && (j < bLength))
+	{
+		if(a[i] < b[j])
+		{
+			out[count] = a[i];
+			i++;
+		}
+		else if(a[i] > b[j])
+		{
+			out[count] = b[j];
+			j++;
+		}
+		else
+		{
+			out[count] = a[i];
+			i++;
+			j++;
+		}
+		count++;
+	}
+	while(i < aLength)
+	{
+		out[count] = a[i];
+		count++;
+		i++;
+	}
+	while(j < bLength)
+	{
+		out[count] = b[j];
+		count++;
+		j++;
+	}
+	return count;
+}
+
+/** result container = a OR b for containers with the same key
+*/
+static ACR_Info_t ACR_RoaringContainerOr(
+	ACR_RoaringContainer_t* result,
+	const ACR_RoaringContainer_t* a,
+	const ACR_RoaringContainer_t* b)
+{
+	ACR_Block_t blocks[ACR_ROARING_BITMAP_BLOCKS];
+	ACR_Count_t i;
+
+	if((a->m_Type == ACR_ROARING_ARRAY) && (b->m_Type == ACR_ROARING_ARRAY) &&
+	   ((a->m_Length + b->m_Length) <= ACR_ROARING_ARRAY_MAX))
+	{
+		ACR_BUFFER_ALLOC(result->m_Data, (a->m_Length + b->m_Length) * sizeof(unsigned short));
+		if(ACR_BUFFER_IS_VALID(result->m_Data) == ACR_BOOL_FALSE)
+		{
+			return ACR_INFO_ERROR;
+		}
+		result->m_Type = ACR_ROARING_ARRAY;
+		result->m_Length = ACR_RoaringUnionArrays(ACR_ROARING_VALUES(a), a->m_Length, ACR_ROARING_VALUES(b), b->m_Length, ACR_ROARING_VALUES(result));
+		result->m_Cardinality = result->m_Length;
+		return ACR_INFO_OK;
+	}
+
+	// start with the bitmap (or the larger container)
+	// and then add the other container
+	if((b->m_Type == ACR_ROARING_BITMAP) || ((a->m_Type != ACR_ROARING_BITMAP) && (b->m_Cardinality > a->m_Cardinality)))
+	{
+		const ACR_RoaringContainer_t* temp = a;
+		a = b;
+		b = temp;
+	}
+	ACR_RoaringContainerToBlocks(a, blocks);
+	if(b->m_Type == ACR_ROARING_ARRAY)
+	{
+		const unsigned short* values = ACR_ROARING_VALUES(b);
+		for(i = 0; i < b->m_Length; i++)
+		{
+			ACR_ROARING_BIT_SET(blocks, values[i]);
+		}
+	}
+	else
+	{
+		ACR_Block_t otherBlocks[ACR_ROARING_BITMAP_BLOCKS];
+		ACR_RoaringContainerToBlocks(b, otherBlocks);
+		for(i = 0; i < ACR_ROARING_BITMAP_BLOCKS; i++)
+		{
+			blocks[i] |= otherBlocks[i];
+		}
+	}
+	return ACR_RoaringContainerFromBlocks(result, blocks, ACR_RoaringBlocksCardinality(blocks));
+}
+
+/** result container = a AND b for containers with the same key
+	\returns ACR_INFO_OK, ACR_INFO_ERROR, or ACR_INFO_INVALID if
+	         the result is empty
+*/
+static ACR_Info_t ACR_RoaringContainerAnd(
+	ACR_RoaringContainer_t* result,
+	const ACR_RoaringContainer_t* a,
+	const ACR_RoaringContainer_t* b)
+{
+	ACR_Block_t blocks[ACR_ROARING_BITMAP_BLOCKS];
+	ACR_Count_t i;
+
+	if((a->m_Type != ACR_ROARING_ARRAY) && (b->m_Type == ACR_ROARING_ARRAY))
+	{
+		const ACR_RoaringContainer_t* temp = a;
+		a = b;
+		b = temp;
+	}
+
+	if(a->m_Type == ACR_ROARING_ARRAY)
+	{
+		const unsigned short* values = ACR_ROARING_VALUES(a);
+		unsigned short* out;
+		ACR_BUFFER_ALLOC(result->m_Data, a->m_Length * sizeof(unsigned short));
+		if(ACR_BUFFER_IS_VALID(result->m_Data) == ACR_BOOL_FALSE)
+		{
+			return ACR_INFO_ERROR;
+		}
+		out = ACR_ROARING_VALUES(result);
+		result->m_Type = ACR_ROARING_ARRAY;
+		if(b->m_Type == ACR_ROARING_ARRAY)
+		{
+			result->m_Length = ACR_RoaringIntersectArrays(values, a->m_Length, ACR_ROARING_VALUES(b), b->m_Length, out);
+		}
+		else
+		{
+			const ACR_Block_t* otherBlocks = ACR_ROARING_BLOCKS(b);
+			if(b->m_Type == ACR_ROARING_RUN)
+			{
+				ACR_RoaringContainerToBlocks(b, blocks);
+				otherBlocks = blocks;
+			}
+			result->m_Length = 0;
+			for(i = 0; i < a->m_Length; i++)
+			{
+				// always write the value and only move forward when
+				// it is in both containers to avoid a branch
+				out[result->m_Length] = values[i];
+				result->m_Length += ACR_ROARING_BIT_TEST(otherBlocks, values[i]);
+			}
+		}
+		result->m_Cardinality = result->m_Length;
+		if(result->m_Length == 0)
+		{
+			ACR_BUFFER_FREE(result->m_Data);
+			return ACR_INFO_INVALID;
+		}
+		return ACR_INFO_OK;
+	}
+	else
+	{
+		ACR_Block_t otherBlocks[ACR_ROARING_BITMAP_BLOCKS];
+		ACR_Count_t cardinality = 0;
+		ACR_RoaringContainerToBlocks(a, blocks);
+		ACR_RoaringContainerToBlocks(b, otherBlocks);
+		for(i = 0; i < ACR_ROARING_BITMAP_BLOCKS; i++)
+		{
+			blocks[i] &= otherBlocks[i];
+			cardinality += (ACR_Count_t)ACR_BLOCK_POPCOUNT(blocks[i]);
+		}
+		if(cardinality == 0)
+		{
+			return ACR_INFO_INVALID;
+		}
+		return ACR_RoaringContainerFromBlocks(result, blocks, cardinality);
+	}
+}
+
+/** count the number of runs in a container
+*/
+static ACR_Count_t ACR_RoaringContainerRunCount(
+	const ACR_RoaringContainer_t* container)
+{
+	ACR_Count_t runs = 0;
+	ACR_Count_t i;
+	if(container->m_Type == ACR_ROARING_ARRAY)
+	{
+		const unsigned short* values = ACR_ROARING_VALUES(container);
+		runs = 1;
+		for(i = 1; i < container->m_Length; i++)
+		{
+			runs += (values[i] != (unsigned short)(values[i-1] + 1));
+		}
+	}
+	else if(container->m_Type == ACR_ROARING_BITMAP)
+	{
+		const ACR_Block_t* blocks = ACR_ROARING_BLOCKS(container);
+		ACR_Block_t carry = 0;
+		for(i = 0; i < ACR_ROARING_BITMAP_BLOCKS; i++)
+		{
+			// a run starts at each set bit where the
+			// previous bit is not set
+			ACR_Block_t starts = blocks[i] & (~((blocks[i] << 1) | carry));
+			runs += (ACR_Count_t)ACR_BLOCK_POPCOUNT(starts);
+			carry = blocks[i] >> (ACR_BITS_PER_BLOCK - 1);
+		}
+	}
+	else
+	{
+		runs = container->m_Length;
+	}
+	return runs;
+}
+
+////////////////////////////////////////////////////////////
+//
+// PRIVATE FUNCTIONS - SERIALIZATION
+//
+////////////////////////////////////////////////////////////
+
+/** write little endian values
+*/
+static void ACR_RoaringWrite16(
+	ACR_Byte_t* dst,
+	ACR_Count_t value)
+{
+	dst[0] = (ACR_Byte_t)(value & 0xFF);
+	dst[1] = (ACR_Byte_t)((value >> 8) & 0xFF);
+}
+
+static void ACR_RoaringWrite32(
+	ACR_Byte_t* dst,
+	ACR_Length_t value)
+{
+	dst[0] = (ACR_Byte_t)(value & 0xFF);
+	dst[1] = (ACR_Byte_t)((value >> 8) & 0xFF);
+	dst[2] = (ACR_Byte_t)((value >> 16) & 0xFF);
+	dst[3] = (ACR_Byte_t)((value >> 24) & 0xFF);
+}
+
+/** read little endian values
+*/
+static ACR_Count_t ACR_RoaringRead16(
+	const ACR_Byte_t* src)
+{
+	return ((ACR_Count_t)src[0]) | (((ACR_Count_t)src[1]) << 8);
+}
+
+static ACR_Length_t ACR_RoaringRead32(
+	const ACR_Byte_t* src)
+{
+	return ((ACR_Length_t)src[0]) | (((ACR_Length_t)src[1]) << 8) | (((ACR_Length_t)src[2]) << 16) | (((ACR_Length_t)src[3]) << 24);
+}
+
+/** get the number of bytes of serialized container data
+*/
+static ACR_Length_t ACR_RoaringContainerDataLength(
+	ACR_Byte_t type,
+	ACR_Length_t length)
+{
+	switch(type)
+	{
+		case ACR_ROARING_ARRAY:
+			return length * 2;
+		case ACR_ROARING_BITMAP:
+			return ACR_ROARING_BITMAP_BYTES;
+		default:
+			return length * 4;
+	}
+}
+
+/** check that the data of a container read from serialized
+    data matches its length and cardinality, so that using it
+	never reads past the container data
+	\returns ACR_INFO_OK or ACR_INFO_ERROR
+*/
+static ACR_Info_t ACR_RoaringContainerValidate(
+	const ACR_RoaringContainer_t* container)
+{
+	const unsigned short* values = ACR_ROARING_VALUES(container);
+	const ACR_Block_t* blocks;
+	ACR_Count_t cardinality = 0;
+	ACR_Count_t end = 0;
+	ACR_Count_t i;
+
+	switch(container->m_Type)
+	{
+		case ACR_ROARING_ARRAY:
+			// values must be sorted without duplicates
+			if((container->m_Length != container->m_Cardinality) || (container->m_Cardinality > ACR_ROARING_ARRAY_MAX))
+			{
+				return ACR_INFO_ERROR;
+			}
+			for(i = 1; i < container->m_Length; i++)
+			{
+				if(values[i] <= values[i-1])
+				{
+					return ACR_INFO_ERROR;
+				}
+			}
+			return ACR_INFO_OK;
+		case ACR_ROARING_BITMAP:
+			blocks = ACR_ROARING_BLOCKS(container);
+			for(i = 0; i < ACR_ROARING_BITMAP_BLOCKS; i++)
+			{
+				cardinality += (ACR_Count_t)ACR_BLOCK_POPCOUNT(blocks[i]);
+			}
+			break;
+		default:
+			// runs must be sorted without overlapping
+			for(i = 0; i < container->m_Length; i++)
+			{
+				if((i > 0) && (values[i * 2] < end))
+				{
+					return ACR_INFO_ERROR;
+				}
+				end = (ACR_Count_t)values[i * 2] + (ACR_Count_t)values[(i * 2) + 1] + 1;
+				if(end > ACR_ROARING_CHUNK_SIZE)
+				{
+					return ACR_INFO_ERROR;
+				}
+				cardinality += (ACR_Count_t)values[(i * 2) + 1] + 1;
+			}
+			break;
+	}
+	return (cardinality == container->m_Cardinality) ? ACR_INFO_OK : ACR_INFO_ERROR;
+}
+
+/** round up to the serialized data alignment
+*/
+#define ACR_ROARING_ALIGN(offset) (((offset) + (ACR_ROARING_DATA_ALIGN - 1)) & (~((ACR_Length_t)ACR_ROARING_DATA_ALIGN - 1)))
+
+////////////////////////////////////////////////////////////
+//
+// PUBLIC FUNCTIONS
+//
+////////////////////////////////////////////////////////////
+
+/**********************************************************/
+ACR_Info_t ACR_RoaringBitmapNew(
+	ACR_RoaringBitmap_t** mePtr)
+{
+	ACR_Info_t result = ACR_INFO_ERROR;
+	if(mePtr != ACR_NULL)
+	{
+		ACR_BUFFER(buffer);
+
+		ACR_BUFFER_ALLOC(buffer, sizeof(ACR_RoaringBitmap_t));
+		if(ACR_BUFFER_IS_VALID(buffer))
+		{
+			ACR_RoaringBitmapInit((ACR_RoaringBitmap_t*)buffer.m_Pointer);
+			result = ACR_INFO_OK;
+		}
+		(*mePtr) = (ACR_RoaringBitmap_t*)buffer.m_Pointer;
+	}
+	return result;
+}
+
+/**********************************************************/
+void ACR_RoaringBitmapDelete(
+	ACR_RoaringBitmap_t** mePtr)
+{
+	if(mePtr != ACR_NULL)
+	{
+		ACR_BUFFER(buffer);
+
+		ACR_RoaringBitmapDeInit((*mePtr));
+		ACR_BUFFER_REFERENCE(buffer, (*mePtr), sizeof(ACR_RoaringBitmap_t));
+		ACR_BUFFER_FORCE_FREE(buffer);
+		(*mePtr) = ACR_NULL;
+	}
+}
+
+/**********************************************************/
+void ACR_RoaringBitmapInit(
+	ACR_RoaringBitmap_t* me)
+{
+	if(me == ACR_NULL)
+	{
+		return;
+	}
+
+	me->m_Containers.m_Pointer = ACR_NULL;
+	me->m_Containers.m_Length = ACR_ZERO_LENGTH;
+	me->m_Containers.m_Flags = ACR_BUFFER_FLAGS_NONE;
+	me->m_ContainerCount = ACR_ZERO_COUNT;
+	me->m_Flags = ACR_ROARING_FLAGS_NONE;
+}
+
+/**********************************************************/
+void ACR_RoaringBitmapDeInit(
+	ACR_RoaringBitmap_t* me)
+{
+	ACR_Count_t i;
+
+	if(me == ACR_NULL)
+	{
+		return;
+	}
+
+	for(i = 0; i < me->m_ContainerCount; i++)
+	{
+		// Note: referenced data from ACR_RoaringBitmapRefSerialized()
+		//       has the ACR_BUFFER_IS_REF flag so it is not freed
+		ACR_BUFFER_FREE(ACR_ROARING_CONTAINERS(me)[i].m_Data);
+	}
+	ACR_BUFFER_FREE(me->m_Containers);
+	me->m_ContainerCount = ACR_ZERO_COUNT;
+	me->m_Flags = ACR_ROARING_FLAGS_NONE;
+}
+
+/**********************************************************/
+ACR_Info_t ACR_RoaringBitmapAdd(
+	ACR_RoaringBitmap_t* me,
+	ACR_RoaringValue_t value)
+{
+	ACR_RoaringContainer_t* container;
+	unsigned short low = ACR_ROARING_LOW(value);
+	ACR_Count_t index;
+
+	if(me == ACR_NULL)
+	{
+		return ACR_INFO_ERROR;
+	}
+
+	if((value > ACR_ROARING_MAX_VALUE) || ACR_HAS_FLAG(me->m_Flags, ACR_ROARING_IS_READ_ONLY))
+	{
+		return ACR_INFO_ERROR;
+	}
+
+	if(ACR_RoaringFindContainer(me, ACR_ROARING_KEY(value), &index) == ACR_INFO_EQUAL)
+	{
+		container = ACR_ROARING_CONTAINERS(me) + index;
+		if(ACR_RoaringContainerContains(container, low) == ACR_INFO_TRUE)
+		{
+			return ACR_INFO_OK;
+		}
+		if(ACR_RoaringContainerUnRun(container) != ACR_INFO_OK)
+		{
+			return ACR_INFO_ERROR;
+		}
+	}
+	else
+	{
+		container = ACR_RoaringInsertContainer(me, index, ACR_ROARING_KEY(value));
+		if(container == ACR_NULL)
+		{
+			return ACR_INFO_ERROR;
+		}
+	}
+
+	if((container->m_Type == ACR_ROARING_ARRAY) && (container->m_Length == ACR_ROARING_ARRAY_MAX))
+	{
+		// too many values for an array
+		ACR_Block_t blocks[ACR_ROARING_BITMAP_BLOCKS];
+		ACR_RoaringContainerToBlocks(container, blocks);
+		if(ACR_RoaringContainerFromBlocks(container, blocks, ACR_ROARING_ARRAY_MAX + 1) != ACR_INFO_OK)
+		{
+			return ACR_INFO_ERROR;
+		}
+		container->m_Cardinality = ACR_ROARING_ARRAY_MAX;
+	}
+
+	if(container->m_Type == ACR_ROARING_ARRAY)
+	{
+		unsigned short* values;
+		ACR_Count_t pos;
+		if(ACR_RoaringContainerReserve(container, (container->m_Length + 1) * sizeof(unsigned short) * 2, container->m_Length * sizeof(unsigned short)) != ACR_INFO_OK)
+		{
+			if(container->m_Length == 0)
+			{
+				ACR_RoaringRemoveContainer(me, index);
+			}
+			return ACR_INFO_ERROR;
+		}
+		values = ACR_ROARING_VALUES(container);
+		pos = ACR_RoaringLowerBound(values, container->m_Length, low);
+		memmove(values + pos + 1, values + pos, (container->m_Length - pos) * sizeof(unsigned short));
+		values[pos] = low;
+		container->m_Length++;
+	}
+	else
+	{
+		ACR_ROARING_BIT_SET(ACR_ROARING_BLOCKS(container), low);
+	}
+	container->m_Cardinality++;
+	return ACR_INFO_OK;
+}
+
+/**********************************************************/
+ACR_Info_t ACR_RoaringBitmapRemove(
+	ACR_RoaringBitmap_t* me,
+	ACR_RoaringValue_t value)
+{
+	ACR_RoaringContainer_t* container;
+	unsigned short low = ACR_ROARING_LOW(value);
+	ACR_Count_t index;
+
+	if(me == ACR_NULL)
+	{
+		return ACR_INFO_ERROR;
+	}
+
+	if((value > ACR_ROARING_MAX_VALUE) || ACR_HAS_FLAG(me->m_Flags, ACR_ROARING_IS_READ_ONLY))
+	{
+		return ACR_INFO_ERROR;
+	}
+
+	if(ACR_RoaringFindContainer(me, ACR_ROARING_KEY(value), &index) != ACR_INFO_EQUAL)
+	{
+		return ACR_INFO_OK;
+	}
+	container = ACR_ROARING_CONTAINERS(me) + index;
+	if(ACR_RoaringContainerContains(container, low) == ACR_INFO_FALSE)
+	{
+		return ACR_INFO_OK;
+	}
+	if(container->m_Cardinality == 1)
+	{
+		ACR_RoaringRemoveContainer(me, index);
+		return ACR_INFO_OK;
+	}
+	if(ACR_RoaringContainerUnRun(container) != ACR_INFO_OK)
+	{
+		return ACR_INFO_ERROR;
+	}
+
+	if(container->m_Type == ACR_ROARING_ARRAY)
+	{
+		unsigned short* values = ACR_ROARING_VALUES(container);
+		ACR_Count_t pos = ACR_RoaringLowerBound(values, container->m_Length, low);
+		container->m_Length--;
+		memmove(values + pos, values + pos + 1, (container->m_Length - pos) * sizeof(unsigned short));
+		container->m_Cardinality--;
+	}
+	else
+	{
+		ACR_ROARING_BIT_CLEAR(ACR_ROARING_BLOCKS(container), low);
+		container->m_Cardinality--;
+		if(container->m_Cardinality <= ACR_ROARING_ARRAY_MAX)
+		{
+			ACR_Block_t blocks[ACR_ROARING_BITMAP_BLOCKS];
+			memcpy(blocks, container->m_Data.m_Pointer, ACR_ROARING_BITMAP_BYTES);
+			return ACR_RoaringContainerFromBlocks(container, blocks, container->m_Cardinality);
+		}
+	}
+	return ACR_INFO_OK;
+}
+
+/**********************************************************/
+ACR_Info_t ACR_RoaringBitmapContains(
+	ACR_RoaringBitmap_t* me,
+	ACR_RoaringValue_t value)
+{
+	ACR_Count_t index;
+
+	if(me == ACR_NULL)
+	{
+		return ACR_INFO_FALSE;
+	}
+
+	if(value > ACR_ROARING_MAX_VALUE)
+	{
+		return ACR_INFO_FALSE;
+	}
+
+	if(ACR_RoaringFindContainer(me, ACR_ROARING_KEY(value), &index) != ACR_INFO_EQUAL)
+	{
+		return ACR_INFO_FALSE;
+	}
+
+	return ACR_RoaringContainerContains(ACR_ROARING_CONTAINERS(me) + index, ACR_ROARING_LOW(value));
+}
+
+/**********************************************************/
+ACR_Length_t ACR_RoaringBitmapCardinality(
+	ACR_RoaringBitmap_t* me)
+{
+	ACR_Length_t cardinality = 0;
+	ACR_Count_t i;
+
+	if(me == ACR_NULL)
+	{
+		return ACR_ZERO_LENGTH;
+	}
+
+	for(i = 0; i < me->m_ContainerCount; i++)
+	{
+		cardinality += ACR_ROARING_CONTAINERS(me)[i].m_Cardinality;
+	}
+	return cardinality;
+}
+
+/**********************************************************/
+ACR_Info_t ACR_RoaringBitmapFindNext(
+	ACR_RoaringBitmap_t* me,
+	ACR_RoaringValue_t from,
+	ACR_RoaringValue_t* found)
+{
+	ACR_RoaringContainer_t* containers;
+	ACR_Count_t index;
+	ACR_Count_t low;
+
+	if((me == ACR_NULL) || (found == ACR_NULL))
+	{
+		return ACR_INFO_ERROR;
+	}
+
+	if(from > ACR_ROARING_MAX_VALUE)
+	{
+		return ACR_INFO_ERROR;
+	}
+
+	containers = ACR_ROARING_CONTAINERS(me);
+	low = ACR_ROARING_LOW(from);
+	if(ACR_RoaringFindContainer(me, ACR_ROARING_KEY(from), &index) != ACR_INFO_EQUAL)
+	{
+		// start at the beginning of the next container
+		low = 0;
+	}
+	while(index < me->m_ContainerCount)
+	{
+		ACR_Count_t foundLow;
+		if(ACR_RoaringContainerFindNext(containers + index, low, &foundLow) == ACR_INFO_OK)
+		{
+			(*found) = (((ACR_RoaringValue_t)containers[index].m_Key) << 16) | foundLow;
+			return ACR_INFO_OK;
+		}
+		low = 0;
+		index++;
+	}
+	return ACR_INFO_ERROR;
+}
+
+/**********************************************************/
+ACR_Info_t ACR_RoaringBitmapRunOptimize(
+	ACR_RoaringBitmap_t* me)
+{
+	ACR_Count_t i;
+
+	if(me == ACR_NULL)
+	{
+		return ACR_INFO_ERROR;
+	}
+
+	if(ACR_HAS_FLAG(me->m_Flags, ACR_ROARING_IS_READ_ONLY))
+	{
+		return ACR_INFO_ERROR;
+	}
+
+	for(i = 0; i < me->m_ContainerCount; i++)
+	{
+		ACR_RoaringContainer_t* container = ACR_ROARING_CONTAINERS(me) + i;
+		ACR_Count_t runs = ACR_RoaringContainerRunCount(container);
+		ACR_Length_t currentLength = ACR_RoaringContainerDataLength(container->m_Type, container->m_Length);
+		if((container->m_Type != ACR_ROARING_RUN) && ((runs * 4) < currentLength))
+		{
+			ACR_BUFFER(runData);
+			ACR_Block_t blocks[ACR_ROARING_BITMAP_BLOCKS];
+			unsigned short* pairs;
+			ACR_Count_t run = 0;
+			ACR_Count_t value = 0;
+			ACR_BUFFER_ALLOC(runData, runs * 2 * sizeof(unsigned short));
+			if(ACR_BUFFER_IS_VALID(runData) == ACR_BOOL_FALSE)
+			{
+				return ACR_INFO_ERROR;
+			}
+			pairs = (unsigned short*)runData.m_Pointer;
+			ACR_RoaringContainerToBlocks(container, blocks);
+			while(run < runs)
+			{
+				ACR_Count_t start;
+				while(ACR_ROARING_BIT_TEST(blocks, value) == 0)
+				{
+					value++;
+				}
+				start = value;
+				while((value < ACR_ROARING_CHUNK_SIZE) && ACR_ROARING_BIT_TEST(blocks, value))
+				{
+					value++;
+				}
+				pairs[run*2] = (unsigned short)start;
+				pairs[(run*2)+1] = (unsigned short)(value - start - 1);
+				run++;
+			}
+			ACR_BUFFER_FREE(container->m_Data);
+			container->m_Data = runData;
+			container->m_Type = ACR_ROARING_RUN;
+			container->m_Length = runs;
+		}
+	}
+	return ACR_INFO_OK;
+}
+
+/**********************************************************/
+ACR_Info_t ACR_RoaringBitmapOr(
+	ACR_RoaringBitmap_t* result,
+	ACR_RoaringBitmap_t* a,
+	ACR_RoaringBitmap_t* b)
+{
+	ACR_RoaringContainer_t* aContainers;
+	ACR_RoaringContainer_t* bContainers;
+	ACR_RoaringContainer_t* container;
+	ACR_Count_t i = 0;
+	ACR_Count_t j = 0;
+	ACR_Info_t info;
+
+	if((result == ACR_NULL) || (a == ACR_NULL) || (b == ACR_NULL) || (result == a) || (result == b))
+	{
+		return ACR_INFO_ERROR;
+	}
+
+	ACR_RoaringBitmapDeInit(result);
+	aContainers = ACR_ROARING_CONTAINERS(a);
+	bContainers = ACR_ROARING_CONTAINERS(b);
+	while((i < a->m_ContainerCount) || (j < b->m_ContainerCount))
+	{
+		if((j >= b->m_ContainerCount) || ((i < a->m_ContainerCount) && (aContainers[i].m_Key < bContainers[j].m_Key)))
+		{
+			container = ACR_RoaringAppendContainer(result, aContainers[i].m_Key);
+			info = (container != ACR_NULL) ? ACR_RoaringContainerCopy(container, aContainers + i) : ACR_INFO_ERROR;
+			i++;
+		}
+		else if((i >= a->m_ContainerCount) || (bContainers[j].m_Key < aContainers[i].m_Key))
+		{
+			container = ACR_RoaringAppendContainer(result, bContainers[j].m_Key);
+			info = (container != ACR_NULL) ? ACR_RoaringContainerCopy(container, bContainers + j) : ACR_INFO_ERROR;
+			j++;
+		}
+		else
+		{
+			container = ACR_RoaringAppendContainer(result, aContainers[i].m_Key);
+			info = (container != ACR_NULL) ? ACR_RoaringContainerOr(container, aContainers + i, bContainers + j) : ACR_INFO_ERROR;
+			i++;
+			j++;
+		}
+		if(info != ACR_INFO_OK)
+		{
+			if(container != ACR_NULL)
+			{
+				ACR_RoaringRemoveContainer(result, result->m_ContainerCount - 1);
+			}
+			ACR_RoaringBitmapDeInit(result);
+			return ACR_INFO_ERROR;
+		}
+	}
+	return ACR_INFO_OK;
+}
+
+/**********************************************************/
+ACR_Info_t ACR_RoaringBitmapAnd(
+	ACR_RoaringBitmap_t* result,
+	ACR_RoaringBitmap_t* a,
+	ACR_RoaringBitmap_t* b)
+{
+	ACR_RoaringContainer_t* aContainers;
+	ACR_RoaringContainer_t* bContainers;
+	ACR_RoaringContainer_t* container;
+	ACR_Count_t i = 0;
+	ACR_Count_t j = 0;
+	ACR_Info_t info;
+
+	if((result == ACR_NULL) || (a == ACR_NULL) || (b == ACR_NULL) || (result == a) || (result == b))
+	{
+		return ACR_INFO_ERROR;
+	}
+
+	ACR_RoaringBitmapDeInit(result);
+	aContainers = ACR_ROARING_CONTAINERS(a);
+	bContainers = ACR_ROARING_CONTAINERS(b);
+	while((i < a->m_ContainerCount) && (j < b->m_ContainerCount))
+	{
+		if(aContainers[i].m_Key < bContainers[j].m_Key)
+		{
+			i++;
+		}
+		else if(bContainers[j].m_Key < aContainers[i].m_Key)
+		{
+			j++;
+		}
+		else
+		{
+			container = ACR_RoaringAppendContainer(result, aContainers[i].m_Key);
+			if(container == ACR_NULL)
+			{
+				ACR_RoaringBitmapDeInit(result);
+				return ACR_INFO_ERROR;
+			}
+			info = ACR_RoaringContainerAnd(container, aContainers + i, bContainers + j);
+			if(info != ACR_INFO_OK)
+			{
+				// remove the empty container
+				ACR_RoaringRemoveContainer(result, result->m_ContainerCount - 1);
+				if(info == ACR_INFO_ERROR)
+				{
+					ACR_RoaringBitmapDeInit(result);
+					return ACR_INFO_ERROR;
+				}
+			}
+			i++;
+			j++;
+		}
+	}
+	return ACR_INFO_OK;
+}
+
+/**********************************************************/
+ACR_Length_t ACR_RoaringBitmapSerializedLength(
+	ACR_RoaringBitmap_t* me)
+{
+	ACR_Length_t length;
+	ACR_Count_t i;
+
+	if(me == ACR_NULL)
+	{
+		return ACR_ZERO_LENGTH;
+	}
+
+	length = ACR_ROARING_HEADER_LENGTH + (me->m_ContainerCount * ACR_ROARING_DESCRIPTOR_LENGTH);
+	for(i = 0; i < me->m_ContainerCount; i++)
+	{
+		ACR_RoaringContainer_t* container = ACR_ROARING_CONTAINERS(me) + i;
+		length = ACR_ROARING_ALIGN(length);
+		length += ACR_RoaringContainerDataLength(container->m_Type, container->m_Length);
+	}
+	return length;
+}
+
+/**********************************************************/
+ACR_Info_t ACR_RoaringBitmapSerialize(
+	ACR_RoaringBitmap_t* me,
+	ACR_VarBuffer_t* dst)
+{
+	ACR_Length_t length;
+	ACR_Length_t offset;
+	ACR_Byte_t* start;
+	ACR_Byte_t* descriptor;
+	ACR_Count_t i;
+	ACR_Count_t k;
+
+	if((me == ACR_NULL) || (dst == ACR_NULL))
+	{
+		return ACR_INFO_ERROR;
+	}
+
+	length = ACR_RoaringBitmapSerializedLength(me);
+	if(ACR_VarBufferReserve(dst, dst->m_Buffer.m_Length + length) != ACR_INFO_OK)
+	{
+		return ACR_INFO_ERROR;
+	}
+
+	start = ((ACR_Byte_t*)dst->m_Buffer.m_Pointer) + dst->m_Buffer.m_Length;
+	ACR_MEMSET(start, 0, (size_t)length);
+	memcpy(start, ACR_ROARING_MAGIC, 4);
+	ACR_RoaringWrite32(start + 4, me->m_ContainerCount);
+	descriptor = start + ACR_ROARING_HEADER_LENGTH;
+	offset = ACR_ROARING_HEADER_LENGTH + (me->m_ContainerCount * ACR_ROARING_DESCRIPTOR_LENGTH);
+	for(i = 0; i < me->m_ContainerCount; i++)
+	{
+		ACR_RoaringContainer_t* container = ACR_ROARING_CONTAINERS(me) + i;
+		ACR_Length_t dataLength = ACR_RoaringContainerDataLength(container->m_Type, container->m_Length);
+		ACR_Byte_t* data;
+		offset = ACR_ROARING_ALIGN(offset);
+		data = start + offset;
+
+		ACR_RoaringWrite16(descriptor, container->m_Key);
+		descriptor[2] = container->m_Type;
+		ACR_RoaringWrite32(descriptor + 4, container->m_Length);
+		ACR_RoaringWrite32(descriptor + 8, container->m_Cardinality);
+		ACR_RoaringWrite32(descriptor + 12, offset);
+		descriptor += ACR_ROARING_DESCRIPTOR_LENGTH;
+
+		#ifdef ACR_COMPILER_VS2017
+		#pragma warning(suppress: 4127)
+		#endif
+		if(ACR_IS_BIG_ENDIAN == ACR_BOOL_FALSE)
+		{
+			memcpy(data, container->m_Data.m_Pointer, (size_t)dataLength);
+		}
+		else if(container->m_Type == ACR_ROARING_BITMAP)
+		{
+			// bit n is always stored in byte n/8
+			const ACR_Block_t* blocks = ACR_ROARING_BLOCKS(container);
+			for(k = 0; k < ACR_ROARING_BITMAP_BYTES; k++)
+			{
+				data[k] = (ACR_Byte_t)(blocks[k / ACR_BYTES_PER_BLOCK] >> ((k % ACR_BYTES_PER_BLOCK) * ACR_BITS_PER_BYTE));
+			}
+		}
+		else
+		{
+			const unsigned short* values = ACR_ROARING_VALUES(container);
+			for(k = 0; k < (dataLength / 2); k++)
+			{
+				ACR_RoaringWrite16(data + (k * 2), values[k]);
+			}
+		}
+		offset += dataLength;
+	}
+
+	dst->m_Buffer.m_Length += length;
+	return ACR_INFO_OK;
+}
+
+/**********************************************************/
+ACR_Info_t ACR_RoaringBitmapRefSerialized(
+	ACR_RoaringBitmap_t* me,
+	const void* src,
+	ACR_Length_t length)
+{
+	const ACR_Byte_t* start = (const ACR_Byte_t*)src;
+	const ACR_Byte_t* descriptor;
+	ACR_Count_t count;
+	ACR_Count_t i;
+
+	if((me == ACR_NULL) || (src == ACR_NULL))
+	{
+		return ACR_INFO_ERROR;
+	}
+
+	ACR_RoaringBitmapDeInit(me);
+
+	#ifdef ACR_COMPILER_VS2017
+	#pragma warning(suppress: 4127)
+	#endif
+	if(ACR_IS_BIG_ENDIAN != ACR_BOOL_FALSE)
+	{
+		// the data cannot be used in place
+		return ACR_INFO_ERROR;
+	}
+
+	if((((ACR_PointerValue_t)start) % ACR_ROARING_DATA_ALIGN) != 0)
+	{
+		return ACR_INFO_ERROR;
+	}
+
+	if((length < ACR_ROARING_HEADER_LENGTH) || (memcmp(start, ACR_ROARING_MAGIC, 4) != 0))
+	{
+		return ACR_INFO_ERROR;
+	}
+
+	count = (ACR_Count_t)ACR_RoaringRead32(start + 4);
+	if(count > ((length - ACR_ROARING_HEADER_LENGTH) / ACR_ROARING_DESCRIPTOR_LENGTH))
+	{
+		return ACR_INFO_ERROR;
+	}
+
+	if(count > 0)
+	{
+		ACR_BUFFER_ALLOC(me->m_Containers, count * sizeof(ACR_RoaringContainer_t));
+		if(ACR_BUFFER_IS_VALID(me->m_Containers) == ACR_BOOL_FALSE)
+		{
+			return ACR_INFO_ERROR;
+		}
+	}
+
+	descriptor = start + ACR_ROARING_HEADER_LENGTH;
+	for(i = 0; i < count; i++)
+	{
+		ACR_RoaringContainer_t* container = ACR_ROARING_CONTAINERS(me) + i;
+		ACR_Byte_t type = descriptor[2];
+		ACR_Length_t containerLength = ACR_RoaringRead32(descriptor + 4);
+		ACR_Length_t cardinality = ACR_RoaringRead32(descriptor + 8);
+		ACR_Length_t offset = ACR_RoaringRead32(descriptor + 12);
+		ACR_Length_t dataLength = ACR_RoaringContainerDataLength(type, containerLength);
+		descriptor += ACR_ROARING_DESCRIPTOR_LENGTH;
+
+		if(((type != ACR_ROARING_ARRAY) && (type != ACR_ROARING_BITMAP) && (type != ACR_ROARING_RUN)) ||
+		   (containerLength == 0) || (containerLength > ACR_ROARING_CHUNK_SIZE) ||
+		   (cardinality == 0) || (cardinality > ACR_ROARING_CHUNK_SIZE) ||
+		   ((offset % ACR_ROARING_DATA_ALIGN) != 0) || (offset > length) || (dataLength > (length - offset)) ||
+		   ((i > 0) && (ACR_RoaringRead16(descriptor - ACR_ROARING_DESCRIPTOR_LENGTH) <= container[-1].m_Key)))
+		{
+			ACR_RoaringBitmapDeInit(me);
+			return ACR_INFO_ERROR;
+		}
+
+		container->m_Data.m_Pointer = ACR_NULL;
+		container->m_Data.m_Length = ACR_ZERO_LENGTH;
+		container->m_Data.m_Flags = ACR_BUFFER_FLAGS_NONE;
+		ACR_BUFFER_REFERENCE(container->m_Data, (start + offset), dataLength);
+		container->m_Length = (ACR_Count_t)containerLength;
+		container->m_Cardinality = (ACR_Count_t)cardinality;
+		container->m_Key = (unsigned short)ACR_RoaringRead16(descriptor - ACR_ROARING_DESCRIPTOR_LENGTH);
+		container->m_Type = type;
+		me->m_ContainerCount++;
+
+		if(ACR_RoaringContainerValidate(container) != ACR_INFO_OK)
+		{
+			ACR_RoaringBitmapDeInit(me);
+			return ACR_INFO_ERROR;
+		}
+	}
+
+	ACR_ADD_FLAGS(me->m_Flags, ACR_ROARING_IS_READ_ONLY);
+	return ACR_INFO_OK;
+}
@@ -44,6 +44,369 @@
 */
 #include "ACR/string.h"
 
+////////////////////////////////////////////////////////////
+//
+// PRIVATE DEFINES
+//
+////////////////////////////////////////////////////////////
+
+/** check for a continuation byte [10xxxxxx]
+*/
+#define ACR_STRING_IS_CONTINUATION(c) (((c) & 0xC0) == 0x80)
+
+#if ACR_HAS_SSE2 == ACR_BOOL_TRUE
+/** the number of bytes counted at a time
+*/
+#define ACR_STRING_CHUNK_LENGTH 16
+#else
+#define ACR_STRING_CHUNK_LENGTH ACR_BYTES_PER_BLOCK
+#endif
+
+/** a block with the low bit of every byte set
+*/
+#define ACR_STRING_LOW_BITS (~((ACR_Block_t)0) / 0xFF)
+
+/** a block with the high bit of every byte set
+*/
+#define ACR_STRING_HIGH_BITS (ACR_STRING_LOW_BITS * 0x80)
+
+/** check if a byte is in the tokenizer byte set
+*/
+#define ACR_STRING_TOKENIZER_HAS_BYTE(me, c) (((me)->m_ByteSet[(c) >> 3] & (1 << ((c) & 7))) != 0)
+
+////////////////////////////////////////////////////////////
+//
+// PRIVATE FUNCTIONS - CHARACTER COUNTING
+//
+////////////////////////////////////////////////////////////
+
+/** count the characters that start in the next
+    ACR_STRING_CHUNK_LENGTH bytes, which is every byte
+	that is not a continuation byte
+*/
+static ACR_Count_t ACR_StringChunkCount(
+	const ACR_Byte_t* src)
+{
+	#if ACR_HAS_SSE2 == ACR_BOOL_TRUE
+	// continuation bytes 0x80 to 0xBF are the only signed
+	// values less than -64
+	__m128i v = _mm_loadu_si128((const __m128i*)src);
+	return (ACR_Count_t)(ACR_STRING_CHUNK_LENGTH - ACR_BLOCK_POPCOUNT((ACR_Block_t)_mm_movemask_epi8(_mm_cmplt_epi8(v, _mm_set1_epi8(-64)))));
+	#else
+	ACR_Block_t block;
+	memcpy(&block, src, ACR_BYTES_PER_BLOCK);
+	// continuation bytes are 10xxxxxx
+	return (ACR_Count_t)(ACR_STRING_CHUNK_LENGTH - ACR_BLOCK_POPCOUNT(block & (~(block << 1)) & ACR_STRING_HIGH_BITS));
+	#endif
+}
+
+/** count the characters in UTF8 data
+*/
+static ACR_Count_t ACR_StringCountCharacters(
+	const ACR_Byte_t* src,
+	ACR_Length_t length)
+{
+	ACR_Length_t pos = 0;
+	ACR_Count_t count = 0;
+
+	while((length - pos) >= ACR_STRING_CHUNK_LENGTH)
+	{
+		count += ACR_StringChunkCount(src + pos);
+		pos += ACR_STRING_CHUNK_LENGTH;
+	}
+	while(pos < length)
+	{
+		if(ACR_STRING_IS_CONTINUATION(src[pos]) == ACR_BOOL_FALSE)
+		{
+			count++;
+		}
+		pos++;
+	}
+	return count;
+}
+
+////////////////////////////////////////////////////////////
+//
+// PRIVATE FUNCTIONS - STRING INDEX
+//
+////////////////////////////////////////////////////////////
+
+/** get the byte offset of a character by counting forward
+    from a known character, skipping whole chunks of bytes
+	that end before the character
+	\param src the UTF8 string data
+	\param length the length of src
+	\param pos the byte offset of the known character
+	\param count the position of the known character
+	\param position the position of the character to find
+	\param reached location to store the position of the
+	       character that was found, which is less than
+		   position when the string ends first
+	\returns the byte offset of the character or length if
+	         the string ends first
+*/
+static ACR_Length_t ACR_StringIndexFind(
+	const ACR_Byte_t* src,
+	ACR_Length_t length,
+	ACR_Length_t pos,
+	ACR_Count_t count,
+	ACR_Count_t position,
+	ACR_Count_t* reached)
+{
+	ACR_Count_t chunkCount;
+
+	while((length - pos) >= ACR_STRING_CHUNK_LENGTH)
+	{
+		chunkCount = ACR_StringChunkCount(src + pos);
+		if((count + chunkCount) > position)
+		{
+			break;
+		}
+		count += chunkCount;
+		pos += ACR_STRING_CHUNK_LENGTH;
+	}
+
+	while(pos < length)
+	{
+		if(ACR_STRING_IS_CONTINUATION(src[pos]) == ACR_BOOL_FALSE)
+		{
+			if(count == position)
+			{
+				break;
+			}
+			count++;
+		}
+		pos++;
+	}
+
+	(*reached) = count;
+	return pos;
+}
+
+/** get the byte offset of a character using the index if
+    there is one, building it first if it is out of date
+	\see ACR_StringIndexFind()
+*/
+static ACR_Length_t ACR_StringIndexLocate(
+	ACR_String_t string,
+	ACR_StringIndex_t* index,
+	ACR_Count_t position,
+	ACR_Count_t* reached)
+{
+	const ACR_Byte_t* src = (const ACR_Byte_t*)string.m_Buffer.m_Pointer;
+	ACR_Count_t sample;
+
+	if(index != ACR_NULL)
+	{
+		if((index->m_Pointer != string.m_Buffer.m_Pointer) ||
+		   (index->m_Length != string.m_Buffer.m_Length))
+		{
+			ACR_StringIndexBuild(index, string);
+		}
+		if(index->m_Pointer == string.m_Buffer.m_Pointer)
+		{
+			if(position >= index->m_Count)
+			{
+				(*reached) = index->m_Count;
+				return string.m_Buffer.m_Length;
+			}
+			sample = position / ACR_STRING_INDEX_INTERVAL;
+			return ACR_StringIndexFind(src, string.m_Buffer.m_Length, ((const ACR_Length_t*)index->m_Samples.m_Pointer)[sample], sample * ACR_STRING_INDEX_INTERVAL, position, reached);
+		}
+	}
+	return ACR_StringIndexFind(src, string.m_Buffer.m_Length, 0, 0, position, reached);
+}
+
+////////////////////////////////////////////////////////////
+//
+// PRIVATE FUNCTIONS - TOKENIZER
+//
+////////////////////////////////////////////////////////////
+
+/** get the length of the delimiter at the start of the data
+    \returns the length in bytes or 0 if it is not a
+	         delimiter
+*/
+static ACR_Length_t ACR_StringTokenizerMatch(
+	const ACR_StringTokenizer_t* me,
+	const ACR_Byte_t* src,
+	ACR_Length_t length)
+{
+	const ACR_Byte_t* delimiters = (const ACR_Byte_t*)me->m_Delimiters.m_Buffer.m_Pointer;
+	ACR_Length_t pos = 0;
+	ACR_Length_t bytes;
+
+	if(ACR_STRING_TOKENIZER_HAS_BYTE(me, src[0]) == ACR_BOOL_FALSE)
+	{
+		return 0;
+	}
+	if(src[0] < 0x80)
+	{
+		// ASCII delimiters are always a single byte
+		return 1;
+	}
+
+	while(pos < me->m_Delimiters.m_Buffer.m_Length)
+	{
+		bytes = ACR_UTF8_BYTE_COUNT(delimiters[pos]);
+		if((bytes <= length) &&
+		   (bytes <= (me->m_Delimiters.m_Buffer.m_Length - pos)) &&
+		   (memcmp(src, delimiters + pos, bytes) == 0))
+		{
+			return bytes;
+		}
+		pos += bytes;
+	}
+	return 0;
+}
+
+/** find the next delimiter while counting the characters
+    before it
+	\param me the tokenizer
+	\param pos the byte offset to start from, which will be
+	       updated to the offset of the delimiter or the end
+		   of the string
+	\param count location to store the number of characters
+	       before the delimiter
+	\returns the length of the delimiter or 0 at the end of
+	         the string
+*/
+static ACR_Length_t ACR_StringTokenizerScan(
+	ACR_StringTokenizer_t* me,
+	ACR_Length_t* pos,
+	ACR_Count_t* count)
+{
+	const ACR_Byte_t* src = (const ACR_Byte_t*)me->m_Source.m_Buffer.m_Pointer;
+	ACR_Length_t length = me->m_Source.m_Buffer.m_Length;
+	ACR_Length_t p = (*pos);
+	ACR_Count_t characters = 0;
+	ACR_Length_t delimiter;
+	int b;
+
+	#if ACR_HAS_SSE2 == ACR_BOOL_TRUE
+	if(me->m_SimdCount > 0)
+	{
+		__m128i bytes[ACR_STRING_TOKENIZER_SIMD_BYTES];
+		__m128i v;
+		__m128i found;
+		ACR_Length_t chunk = p;
+		unsigned int mask = 0;
+		unsigned int continuation = 0;
+		unsigned int before;
+		int loaded = 0;
+		int i;
+
+		for(b = 0; b < me->m_SimdCount; b++)
+		{
+			bytes[b] = _mm_set1_epi8((char)me->m_SimdBytes[b]);
+		}
+
+		if((p >= me->m_MaskPosition) && ((p - me->m_MaskPosition) < ACR_STRING_CHUNK_LENGTH))
+		{
+			// continue with the chunk that had the previous
+			// delimiter so that each chunk is only read once
+			chunk = me->m_MaskPosition;
+			mask = me->m_Mask;
+			continuation = me->m_Continuation;
+			loaded = 1;
+		}
+
+		for(;;)
+		{
+			if(loaded == 0)
+			{
+				if((length - chunk) < ACR_STRING_CHUNK_LENGTH)
+				{
+					break;
+				}
+				v = _mm_loadu_si128((const __m128i*)(src + chunk));
+				found = _mm_cmpeq_epi8(v, bytes[0]);
+				for(b = 1; b < me->m_SimdCount; b++)
+				{
+					found = _mm_or_si128(found, _mm_cmpeq_epi8(v, bytes[b]));
+				}
+				mask = (unsigned int)_mm_movemask_epi8(found);
+				// continuation bytes 0x80 to 0xBF are the only
+				// signed values less than -64
+				continuation = (unsigned int)_mm_movemask_epi8(_mm_cmplt_epi8(v, _mm_set1_epi8(-64)));
+			}
+			loaded = 0;
+
+			// ignore the bytes before the start of the token
+			before = (1u << (p - chunk)) - 1;
+			mask &= ~before;
+			while(mask != 0)
+			{
+				i = ACR_BLOCK_TRAILING_ZEROS((ACR_Block_t)mask);
+				mask &= mask - 1;
+				delimiter = (src[chunk + (ACR_Length_t)i] < 0x80) ? 1 : ACR_StringTokenizerMatch(me, src + chunk + i, length - (chunk + (ACR_Length_t)i));
+				if(delimiter != 0)
+				{
+					characters += (ACR_Count_t)ACR_BLOCK_POPCOUNT((ACR_Block_t)((~continuation) & ((1u << i) - 1) & (~before)));
+					me->m_MaskPosition = chunk;
+					me->m_Mask = mask;
+					me->m_Continuation = continuation;
+					(*pos) = chunk + (ACR_Length_t)i;
+					(*count) = characters;
+					return delimiter;
+				}
+			}
+
+			characters += (ACR_Count_t)ACR_BLOCK_POPCOUNT((ACR_Block_t)((~continuation) & 0xFFFF & (~before)));
+			chunk += ACR_STRING_CHUNK_LENGTH;
+			p = chunk;
+		}
+	}
+	#else
+	if(me->m_SimdCount > 0)
+	{
+		ACR_Block_t block;
+		ACR_Block_t x;
+		ACR_Block_t found;
+
+		// skip whole blocks that do not have the first byte
+		// of any delimiter
+		while((length - p) >= ACR_STRING_CHUNK_LENGTH)
+		{
+			memcpy(&block, src + p, ACR_BYTES_PER_BLOCK);
+			found = 0;
+			for(b = 0; b < me->m_SimdCount; b++)
+			{
+				// a byte of x is zero where the byte matches
+				x = block ^ (ACR_STRING_LOW_BITS * me->m_SimdBytes[b]);
+				found |= (x - ACR_STRING_LOW_BITS) & (~x) & ACR_STRING_HIGH_BITS;
+			}
+			if(found != 0)
+			{
+				break;
+			}
+			characters += ACR_StringChunkCount(src + p);
+			p += ACR_STRING_CHUNK_LENGTH;
+		}
+	}
+	#endif // #if ACR_HAS_SSE2 == ACR_BOOL_TRUE
+
+	while(p < length)
+	{
+		delimiter = ACR_StringTokenizerMatch(me, src + p, length - p);
+		if(delimiter != 0)
+		{
+			(*pos) = p;
+			(*count) = characters;
+			return delimiter;
+		}
+		if(ACR_STRING_IS_CONTINUATION(src[p]) == ACR_BOOL_FALSE)
+		{
+			characters++;
+		}
+		p++;
+	}
+
+	(*pos) = p;
+	(*count) = characters;
+	return 0;
+}
+
 ////////////////////////////////////////////////////////////
 //
 // PUBLIC FUNCTIONS
@@ -110,3 +473,380 @@ void ACR_StringDeInit(
 
 	ACR_BUFFER_FREE(me->m_Buffer);
 }
+
+/**********************************************************/
+void ACR_StringIndexInit(
+	ACR_StringIndex_t* me)
+{
+	if(me == ACR_NULL)
+	{
+		return;
+	}
+
+	me->m_Samples.m_Pointer = ACR_NULL;
+	me->m_Samples.m_Length = ACR_ZERO_LENGTH;
+	me->m_Samples.m_Flags = ACR_BUFFER_FLAGS_NONE;
+	me->m_SampleCount = 0;
+	me->m_Pointer = ACR_NULL;
+	me->m_Length = ACR_ZERO_LENGTH;
+	me->m_Count = 0;
+}
+
+/**********************************************************/
+void ACR_StringIndexDeInit(
+	ACR_StringIndex_t* me)
+{
+	if(me == ACR_NULL)
+	{
+		return;
+	}
+
+	ACR_BUFFER_FREE(me->m_Samples);
+	ACR_StringIndexInvalidate(me);
+}
+
+/**********************************************************/
+ACR_Info_t ACR_StringIndexBuild(
+	ACR_StringIndex_t* me,
+	ACR_String_t string)
+{
+	const ACR_Byte_t* src = (const ACR_Byte_t*)string.m_Buffer.m_Pointer;
+	ACR_Length_t length = string.m_Buffer.m_Length;
+	ACR_Length_t pos = 0;
+	ACR_Length_t* samples;
+	ACR_Count_t count = 0;
+	ACR_Count_t next = 0;
+	ACR_Count_t sampleCount = 0;
+	ACR_Count_t chunkCount;
+	ACR_Length_t samplesLength;
+
+	if(me == ACR_NULL)
+	{
+		return ACR_INFO_ERROR;
+	}
+
+	ACR_StringIndexInvalidate(me);
+	if(src == ACR_NULL)
+	{
+		length = ACR_ZERO_LENGTH;
+	}
+
+	// there can be no more characters than bytes so this is
+	// enough samples for any string of this length
+	samplesLength = (ACR_Length_t)(((length / ACR_STRING_INDEX_INTERVAL) + 1) * sizeof(ACR_Length_t));
+	if(me->m_Samples.m_Length < samplesLength)
+	{
+		ACR_BUFFER_ALLOC(me->m_Samples, samplesLength);
+		if(ACR_BUFFER_IS_VALID(me->m_Samples) == ACR_BOOL_FALSE)
+		{
+			return ACR_INFO_ERROR;
+		}
+	}
+	samples = (ACR_Length_t*)me->m_Samples.m_Pointer;
+
+	while(pos < length)
+	{
+		// skip whole chunks that end before the next
+		// character to sample
+		if((length - pos) >= ACR_STRING_CHUNK_LENGTH)
+		{
+			chunkCount = ACR_StringChunkCount(src + pos);
+			if((count + chunkCount) <= next)
+			{
+				count += chunkCount;
+				pos += ACR_STRING_CHUNK_LENGTH;
+				continue;
+			}
+		}
+
+		if(ACR_STRING_IS_CONTINUATION(src[pos]) == ACR_BOOL_FALSE)
+		{
+			if(count == next)
+			{
+				samples[sampleCount] = pos;
+				sampleCount++;
+				next += ACR_STRING_INDEX_INTERVAL;
+			}
+			count++;
+		}
+		pos++;
+	}
+
+	me->m_SampleCount = sampleCount;
+	me->m_Pointer = string.m_Buffer.m_Pointer;
+	me->m_Length = string.m_Buffer.m_Length;
+	me->m_Count = count;
+	return ACR_INFO_OK;
+}
+
+/**********************************************************/
+void ACR_StringIndexInvalidate(
+	ACR_StringIndex_t* me)
+{
+	if(me == ACR_NULL)
+	{
+		return;
+	}
+
+	me->m_SampleCount = 0;
+	me->m_Pointer = ACR_NULL;
+	me->m_Length = ACR_ZERO_LENGTH;
+	me->m_Count = 0;
+}
+
+/**********************************************************/
+ACR_Info_t ACR_StringCharAt(
+	ACR_String_t string,
+	ACR_StringIndex_t* index,
+	ACR_Count_t position,
+	ACR_Unicode_t* character)
+{
+	const ACR_Byte_t* src = (const ACR_Byte_t*)string.m_Buffer.m_Pointer;
+	ACR_Length_t pos;
+	ACR_Count_t reached;
+	int bytes;
+
+	if((src == ACR_NULL) || (character == ACR_NULL))
+	{
+		return ACR_INFO_ERROR;
+	}
+
+	pos = ACR_StringIndexLocate(string, index, position, &reached);
+	if(pos >= string.m_Buffer.m_Length)
+	{
+		return ACR_INFO_ERROR;
+	}
+
+	bytes = ACR_UTF8_BYTE_COUNT(src[pos]);
+	if(((ACR_Length_t)bytes) > (string.m_Buffer.m_Length - pos))
+	{
+		return ACR_INFO_ERROR;
+	}
+	(*character) = ACR_Utf8ToUnicode(src + pos, bytes);
+	return ACR_INFO_OK;
+}
+
+/**********************************************************/
+ACR_Info_t ACR_StringSubstringChars(
+	ACR_String_t string,
+	ACR_StringIndex_t* index,
+	ACR_Count_t start,
+	ACR_Count_t count,
+	ACR_String_t* result)
+{
+	ACR_STRING(part);
+	const ACR_Byte_t* src = (const ACR_Byte_t*)string.m_Buffer.m_Pointer;
+	ACR_Length_t first;
+	ACR_Length_t last;
+	ACR_Count_t reached;
+
+	if(result == ACR_NULL)
+	{
+		return ACR_INFO_ERROR;
+	}
+
+	if(src == ACR_NULL)
+	{
+		string.m_Buffer.m_Length = ACR_ZERO_LENGTH;
+	}
+
+	first = ACR_StringIndexLocate(string, index, start, &reached);
+	if(reached != start)
+	{
+		// start is past the end of the string
+		return ACR_INFO_ERROR;
+	}
+
+	// the end of the part is found by counting on from the
+	// start unless the index can jump there directly
+	if(count > (ACR_MAX_COUNT - start))
+	{
+		count = ACR_MAX_COUNT - start;
+	}
+	if((index != ACR_NULL) && (count > ACR_STRING_INDEX_INTERVAL))
+	{
+		last = ACR_StringIndexLocate(string, index, start + count, &reached);
+	}
+	else
+	{
+		last = ACR_StringIndexFind(src, string.m_Buffer.m_Length, first, start, start + count, &reached);
+	}
+
+	if(src != ACR_NULL)
+	{
+		ACR_STRING_REFERENCE(part, (void*)(src + first), last - first, reached - start);
+	}
+	(*result) = part;
+	return ACR_INFO_OK;
+}
+
+/**********************************************************/
+ACR_Info_t ACR_StringTokenizerInit(
+	ACR_StringTokenizer_t* me,
+	ACR_String_t source,
+	ACR_String_t delimiters,
+	ACR_Info_t skipEmpty)
+{
+	const ACR_Byte_t* src = (const ACR_Byte_t*)delimiters.m_Buffer.m_Pointer;
+	ACR_Length_t pos = 0;
+	ACR_Byte_t c;
+	int b;
+
+	if(me == ACR_NULL)
+	{
+		return ACR_INFO_ERROR;
+	}
+
+	me->m_Source = source;
+	me->m_Delimiters = delimiters;
+	me->m_Position = 0;
+	me->m_SkipEmpty = skipEmpty;
+	me->m_State = ACR_INFO_READY;
+	me->m_SimdCount = 0;
+	me->m_MaskPosition = ACR_MAX_LENGTH;
+	me->m_Mask = 0;
+	me->m_Continuation = 0;
+	memset(me->m_ByteSet, 0, sizeof(me->m_ByteSet));
+	if(source.m_Buffer.m_Pointer == ACR_NULL)
+	{
+		me->m_Source.m_Buffer.m_Length = ACR_ZERO_LENGTH;
+	}
+	if(src == ACR_NULL)
+	{
+		me->m_Delimiters.m_Buffer.m_Length = ACR_ZERO_LENGTH;
+	}
+
+	while(pos < me->m_Delimiters.m_Buffer.m_Length)
+	{
+		c = src[pos];
+		if(ACR_STRING_TOKENIZER_HAS_BYTE(me, c) == ACR_BOOL_FALSE)
+		{
+			me->m_ByteSet[c >> 3] |= (ACR_Byte_t)(1 << (c & 7));
+			if(me->m_SimdCount >= 0)
+			{
+				if(me->m_SimdCount < ACR_STRING_TOKENIZER_SIMD_BYTES)
+				{
+					me->m_SimdBytes[me->m_SimdCount] = c;
+					me->m_SimdCount++;
+				}
+				else
+				{
+					// too many to check a chunk at a time
+					me->m_SimdCount = -1;
+				}
+			}
+		}
+		pos += ACR_UTF8_BYTE_COUNT(c);
+	}
+	if(me->m_SimdCount < 0)
+	{
+		me->m_SimdCount = 0;
+	}
+	for(b = me->m_SimdCount; b < ACR_STRING_TOKENIZER_SIMD_BYTES; b++)
+	{
+		me->m_SimdBytes[b] = 0;
+	}
+
+	return ACR_INFO_OK;
+}
+
+/**********************************************************/
+ACR_Info_t ACR_StringTokenizerNext(
+	ACR_StringTokenizer_t* me,
+	ACR_String_t* token)
+{
+	ACR_STRING(part);
+	ACR_Length_t start;
+	ACR_Length_t pos;
+	ACR_Length_t delimiter;
+	ACR_Count_t count;
+
+	if((me == ACR_NULL) || (token == ACR_NULL))
+	{
+		return ACR_INFO_END;
+	}
+
+	while(me->m_State != ACR_INFO_END)
+	{
+		start = me->m_Position;
+		pos = start;
+		delimiter = ACR_StringTokenizerScan(me, &pos, &count);
+		if(delimiter != 0)
+		{
+			me->m_Position = pos + delimiter;
+		}
+		else
+		{
+			me->m_Position = pos;
+			me->m_State = ACR_INFO_END;
+		}
+
+		if((pos == start) && (me->m_SkipEmpty == ACR_INFO_YES))
+		{
+			continue;
+		}
+
+		if(me->m_Source.m_Buffer.m_Pointer != ACR_NULL)
+		{
+			ACR_STRING_REFERENCE(part, (((ACR_Byte_t*)me->m_Source.m_Buffer.m_Pointer) + start), pos - start, count);
+		}
+		(*token) = part;
+		return ACR_INFO_OK;
+	}
+	return ACR_INFO_END;
+}
+
+/**********************************************************/
+ACR_Count_t ACR_StringTokenizerNextBatch(
+	ACR_StringTokenizer_t* me,
+	ACR_String_t* tokens,
+	ACR_Count_t tokensCount)
+{
+	ACR_Count_t count = 0;
+
+	if(tokens == ACR_NULL)
+	{
+		return 0;
+	}
+
+	while((count < tokensCount) && (ACR_StringTokenizerNext(me, &tokens[count]) == ACR_INFO_OK))
+	{
+		count++;
+	}
+	return count;
+}
+
+/**********************************************************/
+ACR_Count_t ACR_StringSplit(
+	ACR_String_t source,
+	ACR_String_t delimiters,
+	ACR_String_t* tokens,
+	ACR_Count_t tokensCount)
+{
+	ACR_StringTokenizer_t tokenizer;
+	ACR_STRING(rest);
+	ACR_Count_t count;
+	const ACR_Byte_t* src;
+	ACR_Length_t length;
+
+	if((tokens == ACR_NULL) || (tokensCount == 0))
+	{
+		return 0;
+	}
+
+	ACR_StringTokenizerInit(&tokenizer, source, delimiters, ACR_INFO_NO);
+	count = ACR_StringTokenizerNextBatch(&tokenizer, tokens, tokensCount - 1);
+	if(tokenizer.m_State != ACR_INFO_END)
+	{
+		// the last item is the rest of the string
+		src = (const ACR_Byte_t*)tokenizer.m_Source.m_Buffer.m_Pointer;
+		length = tokenizer.m_Source.m_Buffer.m_Length - tokenizer.m_Position;
+		if(src != ACR_NULL)
+		{
+			ACR_STRING_REFERENCE(rest, (src + tokenizer.m_Position), length, ACR_StringCountCharacters(src + tokenizer.m_Position, length));
+		}
+		tokens[count] = rest;
+		count++;
+	}
+	return count;
+}
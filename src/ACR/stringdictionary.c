@@ -0,0 +1,667 @@
+/*
+
+    ********** DO NOT REMOVE THIS INFORMATION ************
+
+    ACR - A set of C functions in a git Repository
+    Copyright (C) 2018 - 2020 Adam C. Rosenberg
+
+    Please read LICENSE before using this code
+
+    Please read README.md for instructions on including
+    this code in your project and where to find examples
+
+    If you contribute to this code, Please add your name
+    and email address to the AUTHORS list below so that
+    we know who to thank!
+
+    AUTHORS
+
+    Adam Rosenberg <adam@sirspot.com>
+
+    LICENSE
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+    ******************************************************
+
+*/
+/** \file stringdictionary.c
+
+    functions for access to the ACR_StringDictionary_t type
+
+*/
+#include "ACR/stringdictionary.h"
+
+////////////////////////////////////////////////////////////
+//
+// PRIVATE DEFINES
+//
+////////////////////////////////////////////////////////////
+
+/** serialized data starts with these 4 bytes
+*/
+#define ACR_STRING_DICTIONARY_MAGIC "ACRD"
+
+/** serialized header is the magic value, block size, string
+    count, block count, max string length, and blocks length
+*/
+#define ACR_STRING_DICTIONARY_HEADER_LENGTH 24
+
+/** the largest value stored in the serialized data
+*/
+#define ACR_STRING_DICTIONARY_MAX_VALUE 0xFFFFFFFFUL
+
+/** the most bytes needed for two lengths stored as 7 bits
+    per byte
+*/
+#define ACR_STRING_DICTIONARY_MAX_LENGTHS_BYTES 10
+
+////////////////////////////////////////////////////////////
+//
+// PRIVATE FUNCTIONS
+//
+////////////////////////////////////////////////////////////
+
+/** write and read little endian values
+*/
+static void ACR_StringDictionaryWrite32(
+	ACR_Byte_t* dst,
+	ACR_Length_t value)
+{
+	dst[0] = (ACR_Byte_t)(value & 0xFF);
+	dst[1] = (ACR_Byte_t)((value >> 8) & 0xFF);
+	dst[2] = (ACR_Byte_t)((value >> 16) & 0xFF);
+	dst[3] = (ACR_Byte_t)((value >> 24) & 0xFF);
+}
+
+static ACR_Length_t ACR_StringDictionaryRead32(
+	const ACR_Byte_t* src)
+{
+	return ((ACR_Length_t)src[0]) | (((ACR_Length_t)src[1]) << 8) | (((ACR_Length_t)src[2]) << 16) | (((ACR_Length_t)src[3]) << 24);
+}
+
+/** write a length as 7 bits per byte with the high bit set
+    on every byte except the last
+	\returns the number of bytes written
+*/
+static ACR_Length_t ACR_StringDictionaryWriteLength(
+	ACR_Byte_t* dst,
+	ACR_Length_t value)
+{
+	ACR_Length_t length = 0;
+
+	while(value >= 0x80)
+	{
+		dst[length] = (ACR_Byte_t)((value & 0x7F) | 0x80);
+		value >>= 7;
+		length++;
+	}
+	dst[length] = (ACR_Byte_t)value;
+	return length + 1;
+}
+
+/** read a length written by ACR_StringDictionaryWriteLength()
+	\returns ACR_INFO_ERROR if the length does not end before
+	         end or is larger than 32 bits
+*/
+static ACR_Info_t ACR_StringDictionaryReadLength(
+	const ACR_Byte_t** src,
+	const ACR_Byte_t* end,
+	ACR_Length_t* value)
+{
+	const ACR_Byte_t* pos = (*src);
+	ACR_Length_t result = 0;
+	ACR_Count_t shift = 0;
+
+	while(pos < end)
+	{
+		result |= ((ACR_Length_t)((*pos) & 0x7F)) << shift;
+		if(((*pos) & 0x80) == 0)
+		{
+			(*src) = pos + 1;
+			(*value) = result;
+			return ACR_INFO_OK;
+		}
+		pos++;
+		shift += 7;
+		if(shift > 28)
+		{
+			break;
+		}
+	}
+	return ACR_INFO_ERROR;
+}
+
+/** compare bytes in byte order where a prefix is first
+	\returns <0, 0, or >0 like memcmp
+*/
+static int ACR_StringDictionaryCompare(
+	const ACR_Byte_t* a,
+	ACR_Length_t aLength,
+	const ACR_Byte_t* b,
+	ACR_Length_t bLength)
+{
+	int result = 0;
+	ACR_Length_t length = (aLength < bLength) ? aLength : bLength;
+
+	if(length > 0)
+	{
+		result = memcmp(a, b, (size_t)length);
+	}
+	if(result == 0)
+	{
+		if(aLength < bLength)
+		{
+			return -1;
+		}
+		return (aLength > bLength) ? 1 : 0;
+	}
+	return result;
+}
+
+/** get the bytes of a block
+	\returns ACR_INFO_ERROR if the block offsets are not valid
+*/
+static ACR_Info_t ACR_StringDictionaryBlock(
+	const ACR_StringDictionary_t* me,
+	ACR_Count_t block,
+	const ACR_Byte_t** start,
+	const ACR_Byte_t** end)
+{
+	ACR_Length_t offset = ACR_StringDictionaryRead32(me->m_BlockOffsets + (block * 4));
+	ACR_Length_t next = me->m_BlocksLength;
+
+	if((block + 1) < me->m_BlockCount)
+	{
+		next = ACR_StringDictionaryRead32(me->m_BlockOffsets + ((block + 1) * 4));
+	}
+	if((offset > next) || (next > me->m_BlocksLength))
+	{
+		return ACR_INFO_ERROR;
+	}
+	(*start) = me->m_Blocks + offset;
+	(*end) = me->m_Blocks + next;
+	return ACR_INFO_OK;
+}
+
+/** get the first string of a block
+	\returns ACR_INFO_ERROR if the block is not valid
+*/
+static ACR_Info_t ACR_StringDictionaryHead(
+	const ACR_StringDictionary_t* me,
+	ACR_Count_t block,
+	const ACR_Byte_t** head,
+	ACR_Length_t* headLength,
+	const ACR_Byte_t** end)
+{
+	if((ACR_StringDictionaryBlock(me, block, head, end) != ACR_INFO_OK) ||
+		(ACR_StringDictionaryReadLength(head, (*end), headLength) != ACR_INFO_OK) ||
+		((*headLength) > (ACR_Length_t)((*end) - (*head))))
+	{
+		return ACR_INFO_ERROR;
+	}
+	return ACR_INFO_OK;
+}
+
+/** check the header of m_Data and set the members used to
+    find and get strings
+*/
+static ACR_Info_t ACR_StringDictionaryAttach(
+	ACR_StringDictionary_t* me)
+{
+	const ACR_Byte_t* start = (const ACR_Byte_t*)me->m_Data.m_Buffer.m_Pointer;
+	ACR_Length_t length = me->m_Data.m_Buffer.m_Length;
+	ACR_Length_t blockSize;
+	ACR_Length_t count;
+	ACR_Length_t blockCount;
+	ACR_Length_t blocksLength;
+
+	if((start == ACR_NULL) || (length < ACR_STRING_DICTIONARY_HEADER_LENGTH) || (memcmp(start, ACR_STRING_DICTIONARY_MAGIC, 4) != 0))
+	{
+		return ACR_INFO_ERROR;
+	}
+
+	blockSize = ACR_StringDictionaryRead32(start + 4);
+	count = ACR_StringDictionaryRead32(start + 8);
+	blockCount = ACR_StringDictionaryRead32(start + 12);
+	blocksLength = ACR_StringDictionaryRead32(start + 20);
+	length -= ACR_STRING_DICTIONARY_HEADER_LENGTH;
+	if((blockSize == 0) || (blockSize > ACR_MAX_COUNT) || (count > ACR_MAX_COUNT) ||
+		(blockCount != ((count / blockSize) + (((count % blockSize) != 0) ? 1 : 0))) ||
+		(blocksLength > length) || ((length - blocksLength) != (blockCount * 4)))
+	{
+		return ACR_INFO_ERROR;
+	}
+
+	me->m_Blocks = start + ACR_STRING_DICTIONARY_HEADER_LENGTH;
+	me->m_BlockOffsets = me->m_Blocks + blocksLength;
+	me->m_BlocksLength = blocksLength;
+	me->m_MaxLength = ACR_StringDictionaryRead32(start + 16);
+	me->m_Count = (ACR_Count_t)count;
+	me->m_BlockCount = (ACR_Count_t)blockCount;
+	me->m_BlockSize = (ACR_Count_t)blockSize;
+	ACR_ADD_FLAGS(me->m_Flags, ACR_STRING_DICTIONARY_IS_READ_ONLY);
+	return ACR_INFO_OK;
+}
+
+////////////////////////////////////////////////////////////
+//
+// PUBLIC FUNCTIONS
+//
+////////////////////////////////////////////////////////////
+
+/**********************************************************/
+void ACR_StringDictionaryInit(
+	ACR_StringDictionary_t* me,
+	ACR_Count_t blockSize)
+{
+	if(me == ACR_NULL)
+	{
+		return;
+	}
+
+	if(blockSize == 0)
+	{
+		blockSize = ACR_STRING_DICTIONARY_DEFAULT_BLOCK_SIZE;
+	}
+	if(blockSize > ACR_MAX_COUNT)
+	{
+		blockSize = ACR_MAX_COUNT;
+	}
+
+	ACR_VarBufferInit(&me->m_Data);
+	ACR_VarBufferInit(&me->m_Offsets);
+	ACR_VarBufferInit(&me->m_Last);
+	me->m_Data.m_Buffer.m_Flags = ACR_BUFFER_FLAGS_NONE;
+	me->m_Offsets.m_Buffer.m_Flags = ACR_BUFFER_FLAGS_NONE;
+	me->m_Last.m_Buffer.m_Flags = ACR_BUFFER_FLAGS_NONE;
+	me->m_Blocks = ACR_NULL;
+	me->m_BlockOffsets = ACR_NULL;
+	me->m_BlocksLength = ACR_ZERO_LENGTH;
+	me->m_MaxLength = ACR_ZERO_LENGTH;
+	me->m_Count = ACR_ZERO_COUNT;
+	me->m_BlockCount = ACR_ZERO_COUNT;
+	me->m_BlockSize = blockSize;
+	me->m_Flags = ACR_STRING_DICTIONARY_FLAGS_NONE;
+}
+
+/**********************************************************/
+void ACR_StringDictionaryDeInit(
+	ACR_StringDictionary_t* me)
+{
+	if(me == ACR_NULL)
+	{
+		return;
+	}
+
+	ACR_VarBufferDeInit(&me->m_Data);
+	ACR_VarBufferDeInit(&me->m_Offsets);
+	ACR_VarBufferDeInit(&me->m_Last);
+	ACR_StringDictionaryInit(me, me->m_BlockSize);
+}
+
+/**********************************************************/
+ACR_Info_t ACR_StringDictionaryAdd(
+	ACR_StringDictionary_t* me,
+	ACR_String_t string)
+{
+	const ACR_Byte_t* src = (const ACR_Byte_t*)string.m_Buffer.m_Pointer;
+	ACR_Length_t length = string.m_Buffer.m_Length;
+	ACR_Length_t shared = 0;
+	ACR_Length_t used;
+	ACR_Byte_t* dst;
+
+	if((me == ACR_NULL) || (ACR_HAS_FLAG(me->m_Flags, ACR_STRING_DICTIONARY_IS_READ_ONLY) != ACR_BOOL_FALSE) || (me->m_Count >= ACR_MAX_COUNT))
+	{
+		return ACR_INFO_ERROR;
+	}
+	if((src == ACR_NULL) && (length > 0))
+	{
+		return ACR_INFO_ERROR;
+	}
+
+	if(me->m_Count > 0)
+	{
+		if(ACR_StringDictionaryCompare((const ACR_Byte_t*)me->m_Last.m_Buffer.m_Pointer, me->m_Last.m_Buffer.m_Length, src, length) >= 0)
+		{
+			return ACR_INFO_ERROR;
+		}
+	}
+
+	// the serialized data uses 32 bit values, so everything
+	// including the block offsets must stay within 4GB
+	used = me->m_Data.m_Buffer.m_Length + me->m_Offsets.m_Buffer.m_Length;
+	if(used == 0)
+	{
+		used = ACR_STRING_DICTIONARY_HEADER_LENGTH;
+	}
+	if(length > (ACR_STRING_DICTIONARY_MAX_VALUE - ACR_STRING_DICTIONARY_MAX_LENGTHS_BYTES - 4 - used))
+	{
+		return ACR_INFO_ERROR;
+	}
+
+	// reserve everything first so that a failure leaves the
+	// dictionary unchanged
+	if((ACR_VarBufferReserve(&me->m_Data, used + ACR_STRING_DICTIONARY_MAX_LENGTHS_BYTES + length - me->m_Offsets.m_Buffer.m_Length) != ACR_INFO_OK) ||
+		(ACR_VarBufferReserve(&me->m_Offsets, me->m_Offsets.m_Buffer.m_Length + 4) != ACR_INFO_OK) ||
+		(ACR_VarBufferReserve(&me->m_Last, (length > 0) ? length : 1) != ACR_INFO_OK))
+	{
+		return ACR_INFO_ERROR;
+	}
+	if(me->m_Data.m_Buffer.m_Length == 0)
+	{
+		me->m_Data.m_Buffer.m_Length = ACR_STRING_DICTIONARY_HEADER_LENGTH;
+	}
+
+	dst = ((ACR_Byte_t*)me->m_Data.m_Buffer.m_Pointer) + me->m_Data.m_Buffer.m_Length;
+	if((me->m_Count % me->m_BlockSize) == 0)
+	{
+		// the first string of a block is stored in full
+		ACR_StringDictionaryWrite32(((ACR_Byte_t*)me->m_Offsets.m_Buffer.m_Pointer) + me->m_Offsets.m_Buffer.m_Length,
+			me->m_Data.m_Buffer.m_Length - ACR_STRING_DICTIONARY_HEADER_LENGTH);
+		me->m_Offsets.m_Buffer.m_Length += 4;
+		me->m_BlockCount++;
+	}
+	else
+	{
+		const ACR_Byte_t* last = (const ACR_Byte_t*)me->m_Last.m_Buffer.m_Pointer;
+		ACR_Length_t lastLength = me->m_Last.m_Buffer.m_Length;
+		while((shared < lastLength) && (shared < length) && (last[shared] == src[shared]))
+		{
+			shared++;
+		}
+		dst += ACR_StringDictionaryWriteLength(dst, shared);
+	}
+	dst += ACR_StringDictionaryWriteLength(dst, length - shared);
+	if(length > shared)
+	{
+		memcpy(dst, src + shared, (size_t)(length - shared));
+		memcpy(((ACR_Byte_t*)me->m_Last.m_Buffer.m_Pointer) + shared, src + shared, (size_t)(length - shared));
+		dst += length - shared;
+	}
+	me->m_Data.m_Buffer.m_Length = (ACR_Length_t)(dst - (ACR_Byte_t*)me->m_Data.m_Buffer.m_Pointer);
+	me->m_Last.m_Buffer.m_Length = length;
+	if(length > me->m_MaxLength)
+	{
+		me->m_MaxLength = length;
+	}
+	me->m_Count++;
+	return ACR_INFO_OK;
+}
+
+/**********************************************************/
+ACR_Info_t ACR_StringDictionaryFinish(
+	ACR_StringDictionary_t* me)
+{
+	ACR_Byte_t* start;
+	ACR_Length_t blocksLength;
+
+	if(me == ACR_NULL)
+	{
+		return ACR_INFO_ERROR;
+	}
+	if(ACR_HAS_FLAG(me->m_Flags, ACR_STRING_DICTIONARY_IS_READ_ONLY) != ACR_BOOL_FALSE)
+	{
+		return ACR_INFO_OK;
+	}
+
+	if(me->m_Data.m_Buffer.m_Length == 0)
+	{
+		if(ACR_VarBufferReserve(&me->m_Data, ACR_STRING_DICTIONARY_HEADER_LENGTH) != ACR_INFO_OK)
+		{
+			return ACR_INFO_ERROR;
+		}
+		me->m_Data.m_Buffer.m_Length = ACR_STRING_DICTIONARY_HEADER_LENGTH;
+	}
+	blocksLength = me->m_Data.m_Buffer.m_Length - ACR_STRING_DICTIONARY_HEADER_LENGTH;
+	if((me->m_Offsets.m_Buffer.m_Length > 0) &&
+		((ACR_VarBufferReserve(&me->m_Data, me->m_Data.m_Buffer.m_Length + me->m_Offsets.m_Buffer.m_Length) != ACR_INFO_OK) ||
+		(ACR_VarBufferAppend(&me->m_Data, me->m_Offsets.m_Buffer.m_Pointer, me->m_Offsets.m_Buffer.m_Length) != ACR_INFO_OK)))
+	{
+		return ACR_INFO_ERROR;
+	}
+
+	start = (ACR_Byte_t*)me->m_Data.m_Buffer.m_Pointer;
+	memcpy(start, ACR_STRING_DICTIONARY_MAGIC, 4);
+	ACR_StringDictionaryWrite32(start + 4, me->m_BlockSize);
+	ACR_StringDictionaryWrite32(start + 8, me->m_Count);
+	ACR_StringDictionaryWrite32(start + 12, me->m_BlockCount);
+	ACR_StringDictionaryWrite32(start + 16, me->m_MaxLength);
+	ACR_StringDictionaryWrite32(start + 20, blocksLength);
+
+	// the strings can no longer be added, so the memory used
+	// to add them is not needed
+	ACR_VarBufferDeInit(&me->m_Offsets);
+	ACR_VarBufferDeInit(&me->m_Last);
+	return ACR_StringDictionaryAttach(me);
+}
+
+/**********************************************************/
+ACR_Info_t ACR_StringDictionaryRef(
+	ACR_StringDictionary_t* me,
+	const void* src,
+	ACR_Length_t length)
+{
+	if((me == ACR_NULL) || (src == ACR_NULL))
+	{
+		return ACR_INFO_ERROR;
+	}
+
+	ACR_StringDictionaryDeInit(me);
+
+	// the data is used in place. numbers are read a byte at a
+	// time so neither the alignment nor the byte order of this
+	// system matter, and only the header is checked so that
+	// the time to load does not depend on the number of strings
+	ACR_VAR_BUFFER_REFERENCE(me->m_Data, src, length);
+	me->m_Data.m_Buffer.m_Length = length;
+	if(ACR_StringDictionaryAttach(me) != ACR_INFO_OK)
+	{
+		ACR_StringDictionaryDeInit(me);
+		return ACR_INFO_ERROR;
+	}
+	return ACR_INFO_OK;
+}
+
+/**********************************************************/
+ACR_Info_t ACR_StringDictionaryFind(
+	const ACR_StringDictionary_t* me,
+	ACR_String_t string,
+	ACR_Count_t* id)
+{
+	const ACR_Byte_t* key = (const ACR_Byte_t*)string.m_Buffer.m_Pointer;
+	ACR_Length_t keyLength = string.m_Buffer.m_Length;
+	const ACR_Byte_t* pos;
+	const ACR_Byte_t* end;
+	ACR_Length_t length;
+	ACR_Length_t shared;
+	ACR_Length_t matched;
+	ACR_Count_t low = 0;
+	ACR_Count_t high;
+	ACR_Count_t middle;
+	ACR_Count_t index;
+	ACR_Count_t count;
+	int compare;
+
+	if((me == ACR_NULL) || (ACR_HAS_FLAG(me->m_Flags, ACR_STRING_DICTIONARY_IS_READ_ONLY) == ACR_BOOL_FALSE) || ((key == ACR_NULL) && (keyLength > 0)))
+	{
+		return ACR_INFO_UNKNOWN;
+	}
+
+	// find the last block with a first string before the key
+	high = me->m_BlockCount;
+	while(low < high)
+	{
+		middle = low + ((high - low) / 2);
+		if(ACR_StringDictionaryHead(me, middle, &pos, &length, &end) != ACR_INFO_OK)
+		{
+			return ACR_INFO_UNKNOWN;
+		}
+		compare = ACR_StringDictionaryCompare(pos, length, key, keyLength);
+		if(compare == 0)
+		{
+			if(id != ACR_NULL)
+			{
+				(*id) = middle * me->m_BlockSize;
+			}
+			return ACR_INFO_OK;
+		}
+		if(compare < 0)
+		{
+			low = middle + 1;
+		}
+		else
+		{
+			high = middle;
+		}
+	}
+	if(low == 0)
+	{
+		return ACR_INFO_UNKNOWN;
+	}
+	low--;
+
+	// walk the rest of the block keeping the number of bytes
+	// the current string matches the key, which is before the
+	// key. the strings are never decoded
+	if(ACR_StringDictionaryHead(me, low, &pos, &length, &end) != ACR_INFO_OK)
+	{
+		return ACR_INFO_UNKNOWN;
+	}
+	matched = 0;
+	while((matched < length) && (matched < keyLength) && (pos[matched] == key[matched]))
+	{
+		matched++;
+	}
+	pos += length;
+	count = me->m_Count - (low * me->m_BlockSize);
+	if(count > me->m_BlockSize)
+	{
+		count = me->m_BlockSize;
+	}
+	for(index = 1; index < count; index++)
+	{
+		if((ACR_StringDictionaryReadLength(&pos, end, &shared) != ACR_INFO_OK) ||
+			(ACR_StringDictionaryReadLength(&pos, end, &length) != ACR_INFO_OK) ||
+			(length > (ACR_Length_t)(end - pos)))
+		{
+			return ACR_INFO_UNKNOWN;
+		}
+		if(shared < matched)
+		{
+			// this string has a larger byte than the string
+			// before it where that one matched the key
+			return ACR_INFO_UNKNOWN;
+		}
+		if(shared == matched)
+		{
+			ACR_Length_t suffix = 0;
+			while((suffix < length) && ((matched + suffix) < keyLength) && (pos[suffix] == key[matched + suffix]))
+			{
+				suffix++;
+			}
+			if(suffix == length)
+			{
+				if((matched + suffix) == keyLength)
+				{
+					if(id != ACR_NULL)
+					{
+						(*id) = (low * me->m_BlockSize) + index;
+					}
+					return ACR_INFO_OK;
+				}
+			}
+			else if(((matched + suffix) == keyLength) || (pos[suffix] > key[matched + suffix]))
+			{
+				return ACR_INFO_UNKNOWN;
+			}
+			matched += suffix;
+		}
+		// when shared > matched the string has the same byte
+		// as the one before it where that one was before the
+		// key, so it is also before the key
+		pos += length;
+	}
+
+	return ACR_INFO_UNKNOWN;
+}
+
+/**********************************************************/
+ACR_Info_t ACR_StringDictionaryGet(
+	const ACR_StringDictionary_t* me,
+	ACR_Count_t id,
+	ACR_Byte_t* memory,
+	ACR_Length_t memoryLength,
+	ACR_String_t* string)
+{
+	const ACR_Byte_t* pos;
+	const ACR_Byte_t* end;
+	ACR_Length_t length;
+	ACR_Length_t shared;
+	ACR_Length_t suffix;
+	ACR_Count_t index;
+	ACR_Count_t count = 0;
+
+	if((me == ACR_NULL) || (ACR_HAS_FLAG(me->m_Flags, ACR_STRING_DICTIONARY_IS_READ_ONLY) == ACR_BOOL_FALSE) || (id >= me->m_Count))
+	{
+		return ACR_INFO_UNKNOWN;
+	}
+
+	if(ACR_StringDictionaryHead(me, id / me->m_BlockSize, &pos, &length, &end) != ACR_INFO_OK)
+	{
+		return ACR_INFO_ERROR;
+	}
+	if(length > memoryLength)
+	{
+		return ACR_INFO_ERROR;
+	}
+	if(length > 0)
+	{
+		memcpy(memory, pos, (size_t)length);
+	}
+	pos += length;
+	for(index = id % me->m_BlockSize; index > 0; index--)
+	{
+		if((ACR_StringDictionaryReadLength(&pos, end, &shared) != ACR_INFO_OK) ||
+			(ACR_StringDictionaryReadLength(&pos, end, &suffix) != ACR_INFO_OK) ||
+			(shared > length) || (suffix > (ACR_Length_t)(end - pos)) || (suffix > (memoryLength - shared)))
+		{
+			return ACR_INFO_ERROR;
+		}
+		if(suffix > 0)
+		{
+			memcpy(memory + shared, pos, (size_t)suffix);
+		}
+		length = shared + suffix;
+		pos += suffix;
+	}
+
+	if(string != ACR_NULL)
+	{
+		// count the bytes that are not UTF8 continuation bytes
+		for(index = 0; index < length; index++)
+		{
+			if((memory[index] & 0xC0) != 0x80)
+			{
+				count++;
+			}
+		}
+		string->m_Buffer.m_Pointer = memory;
+		string->m_Buffer.m_Length = length;
+		string->m_Buffer.m_Flags = ACR_BUFFER_IS_REF;
+		string->m_Count = count;
+	}
+	return ACR_INFO_OK;
+}
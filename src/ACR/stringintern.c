@@ -0,0 +1,599 @@
+/*
+
+    ********** DO NOT REMOVE THIS INFORMATION ************
+
+    ACR - A set of C functions in a git Repository
+    Copyright (C) 2018 - 2020 Adam C. Rosenberg
+
+    Please read LICENSE before using this code
+
+    Please read README.md for instructions on including
+    this code in your project and where to find examples
+
+    If you contribute to this code, Please add your name
+    and email address to the AUTHORS list below so that
+    we know who to thank!
+
+    AUTHORS
+
+    Adam Rosenberg <adam@sirspot.com>
+
+    LICENSE
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+    ******************************************************
+
+*/
+/** \file stringintern.c
+
+    global tables of unique strings
+
+    Each table is an open addressing hash table of pointers
+    to entries, and each entry is the string followed by its
+    bytes in a block of memory that never moves. Readers
+    find strings without locking because an entry is filled
+    in before its pointer is stored in a slot, and a larger
+    table is filled in before it replaces the current one.
+    Replaced tables are kept until ACR_StringInternFree()
+    since a reader may still be using one.
+
+*/
+#include "ACR/stringintern.h"
+#include "ACR/hash.h"
+
+// included for memcmp() and memcpy()
+#include <string.h>
+
+////////////////////////////////////////////////////////////
+//
+// PRIVATE DEFINES
+//
+////////////////////////////////////////////////////////////
+
+// the tables are locked with the native lock functions and
+// read with atomic loads when threads are available
+#ifndef ACR_NO_THREADS
+#if defined(ACR_COMPILER_GCC) || defined(ACR_COMPILER_CLANG) || defined(ACR_COMPILER_MINGW)
+#define ACR_STRING_INTERN_HAS_THREADS ACR_BOOL_TRUE
+#define ACR_STRING_INTERN_LOAD(ptr) __atomic_load_n(&(ptr), __ATOMIC_ACQUIRE)
+#define ACR_STRING_INTERN_STORE(ptr, value) __atomic_store_n(&(ptr), (value), __ATOMIC_RELEASE)
+#define ACR_STRING_INTERN_ADD(value, n) __atomic_fetch_add(&(value), (n), __ATOMIC_RELAXED)
+#elif defined(_WIN32)
+// included for _ReadWriteBarrier()
+#include <intrin.h>
+#define ACR_STRING_INTERN_HAS_THREADS ACR_BOOL_TRUE
+// volatile loads and stores are ordered on x86 and x64, so
+// only the compiler needs to be stopped from moving them
+#define ACR_STRING_INTERN_LOAD(ptr) ACR_StringInternLoad((void* volatile*)&(ptr))
+#define ACR_STRING_INTERN_STORE(ptr, value) _ReadWriteBarrier(); *((void* volatile*)&(ptr)) = (value); _ReadWriteBarrier();
+#if ACR_USE_64BIT == ACR_BOOL_TRUE
+#define ACR_STRING_INTERN_ADD(value, n) InterlockedExchangeAdd64((volatile LONG64*)&(value), (LONG64)(n))
+#else
+#define ACR_STRING_INTERN_ADD(value, n) InterlockedExchangeAdd((volatile LONG*)&(value), (LONG)(n))
+#endif
+#endif
+#endif // #ifndef ACR_NO_THREADS
+
+#ifndef ACR_STRING_INTERN_HAS_THREADS
+#define ACR_STRING_INTERN_HAS_THREADS ACR_BOOL_FALSE
+#define ACR_STRING_INTERN_LOAD(ptr) (ptr)
+#define ACR_STRING_INTERN_STORE(ptr, value) (ptr) = (value);
+#define ACR_STRING_INTERN_ADD(value, n) (value) += (n)
+#endif
+
+#if ACR_STRING_INTERN_HAS_THREADS == ACR_BOOL_TRUE
+#if defined(_WIN32)
+// included for AcquireSRWLockExclusive()
+#include <windows.h>
+typedef SRWLOCK ACR_StringInternLock_t;
+#define ACR_STRING_INTERN_LOCK_INIT SRWLOCK_INIT
+#define ACR_STRING_INTERN_LOCK(lock) AcquireSRWLockExclusive(&(lock));
+#define ACR_STRING_INTERN_UNLOCK(lock) ReleaseSRWLockExclusive(&(lock));
+#else
+// included for pthread_mutex_lock()
+#include <pthread.h>
+typedef pthread_mutex_t ACR_StringInternLock_t;
+#define ACR_STRING_INTERN_LOCK_INIT PTHREAD_MUTEX_INITIALIZER
+#define ACR_STRING_INTERN_LOCK(lock) pthread_mutex_lock(&(lock));
+#define ACR_STRING_INTERN_UNLOCK(lock) pthread_mutex_unlock(&(lock));
+#endif
+#else
+typedef int ACR_StringInternLock_t;
+#define ACR_STRING_INTERN_LOCK_INIT 0
+#define ACR_STRING_INTERN_LOCK(lock)
+#define ACR_STRING_INTERN_UNLOCK(lock)
+#endif
+
+// the number of slots in a new table
+#define ACR_STRING_INTERN_MIN_CAPACITY 1024
+
+// round a length up so that the next entry is aligned
+#define ACR_STRING_INTERN_ROUND(length) ((((length) + sizeof(ACR_Length_t) - 1) / sizeof(ACR_Length_t)) * sizeof(ACR_Length_t))
+
+////////////////////////////////////////////////////////////
+//
+// PRIVATE TYPES
+//
+////////////////////////////////////////////////////////////
+
+#ifdef ACR_COMPILER_VS2017
+#pragma warning(push)
+// disable warning C4820: padding added after data member
+#pragma warning(disable:4820)
+#endif
+/** an interned string, which is followed by its bytes and
+    a null-terminator
+*/
+typedef struct ACR_StringInternEntry_s
+{
+	ACR_String_t m_String;
+	unsigned long m_Hash;
+} ACR_StringInternEntry_t;
+
+/** the slots of a hash table, which are followed by
+    m_Capacity entry pointers
+*/
+typedef struct ACR_StringInternSlots_s
+{
+	struct ACR_StringInternSlots_s* m_Replaced;
+	ACR_StringInternEntry_t** m_Entries;
+	ACR_Count_t m_Capacity;
+} ACR_StringInternSlots_t;
+
+/** a block of memory for entries
+*/
+typedef struct ACR_StringInternBlock_s
+{
+	struct ACR_StringInternBlock_s* m_Previous;
+	ACR_Length_t m_Used;
+	ACR_Length_t m_Length;
+} ACR_StringInternBlock_t;
+
+/** a table of unique strings
+*/
+typedef struct ACR_StringInternTable_s
+{
+	ACR_StringInternLock_t m_Lock;
+	ACR_StringInternSlots_t* m_Slots;
+	ACR_StringInternBlock_t* m_Block;
+	ACR_Count_t m_Count;
+	ACR_Length_t m_StringBytes;
+	ACR_Length_t m_ArenaBytes;
+	ACR_Length_t m_TableBytes;
+	ACR_Length_t m_Lookups;
+	ACR_Length_t m_Probes;
+} ACR_StringInternTable_t;
+#ifdef ACR_COMPILER_VS2017
+#pragma warning(pop)
+#endif
+
+////////////////////////////////////////////////////////////
+//
+// PRIVATE TABLES
+//
+////////////////////////////////////////////////////////////
+
+/** the case-sensitive table
+*/
+static ACR_StringInternTable_t g_ACRStringInternExact = {ACR_STRING_INTERN_LOCK_INIT, ACR_NULL, ACR_NULL, 0, 0, 0, 0, 0, 0};
+
+/** the case-insensitive table
+*/
+static ACR_StringInternTable_t g_ACRStringInternFolded = {ACR_STRING_INTERN_LOCK_INIT, ACR_NULL, ACR_NULL, 0, 0, 0, 0, 0, 0};
+
+////////////////////////////////////////////////////////////
+//
+// PRIVATE FUNCTIONS
+//
+////////////////////////////////////////////////////////////
+
+#if (ACR_STRING_INTERN_HAS_THREADS == ACR_BOOL_TRUE) && !defined(ACR_COMPILER_GCC) && !defined(ACR_COMPILER_CLANG) && !defined(ACR_COMPILER_MINGW)
+/** load a pointer before any of the loads after it
+*/
+static void* ACR_StringInternLoad(
+	void* volatile* ptr)
+{
+	void* value = *ptr;
+	_ReadWriteBarrier();
+	return value;
+}
+#endif
+
+#if ACR_HAS_MALLOC == ACR_BOOL_TRUE
+
+/** hash the bytes of a string
+*/
+static unsigned long ACR_StringInternHash(
+	const ACR_Byte_t* src,
+	ACR_Length_t length)
+{
+	#if ACR_USE_64BIT == ACR_BOOL_TRUE
+	return (unsigned long)ACR_Hash64(src, length, 0);
+	#else
+	unsigned long hash = 2166136261UL;
+	ACR_Length_t pos;
+	for(pos = 0; pos < length; pos++)
+	{
+		hash = ((hash ^ src[pos]) * 16777619UL) & 0xFFFFFFFFUL;
+	}
+	return hash;
+	#endif
+}
+
+/** hash the case folded characters of a string the same
+    way that ACR_StringCompareToMemory() ignores case
+*/
+static unsigned long ACR_StringInternHashFolded(
+	const ACR_Byte_t* src,
+	ACR_Length_t length)
+{
+	#if ACR_USE_64BIT == ACR_BOOL_TRUE
+	ACR_String_t folded;
+	folded.m_Buffer.m_Pointer = (void*)src;
+	folded.m_Buffer.m_Length = length;
+	folded.m_Buffer.m_Flags = ACR_BUFFER_IS_REF;
+	folded.m_Count = 0;
+	return (unsigned long)ACR_HashString(folded, ACR_INFO_NO, 0);
+	#else
+	unsigned long hash = 2166136261UL;
+	ACR_Length_t pos = 0;
+	ACR_Length_t bytes;
+	ACR_Unicode_t c;
+	while(pos < length)
+	{
+		c = src[pos];
+		if(c < 0x80)
+		{
+			// ASCII characters do not need to be decoded
+			if((c >= 'A') && (c <= 'Z'))
+			{
+				c += 'a' - 'A';
+			}
+			pos++;
+		}
+		else
+		{
+			bytes = ACR_UTF8_BYTE_COUNT(src[pos]);
+			if(bytes > (length - pos))
+			{
+				// the last character is missing some of its bytes
+				break;
+			}
+			c = ACR_UnicodeFold(ACR_Utf8ToUnicode(src + pos, (int)bytes));
+			pos += bytes;
+		}
+		hash = ((hash ^ c) * 16777619UL) & 0xFFFFFFFFUL;
+	}
+	return hash;
+	#endif
+}
+
+/** check if an entry is the same string
+*/
+static int ACR_StringInternMatch(
+	const ACR_StringInternEntry_t* entry,
+	ACR_String_t src,
+	unsigned long hash,
+	ACR_Info_t caseSensitive)
+{
+	if(entry->m_Hash != hash)
+	{
+		return 0;
+	}
+	if((caseSensitive != ACR_INFO_NO) || (src.m_Buffer.m_Length == 0))
+	{
+		return (entry->m_String.m_Buffer.m_Length == src.m_Buffer.m_Length) &&
+		       ((src.m_Buffer.m_Length == 0) ||
+		        (memcmp(entry->m_String.m_Buffer.m_Pointer, src.m_Buffer.m_Pointer, (size_t)src.m_Buffer.m_Length) == 0));
+	}
+	return ACR_StringCompareToMemory(src, (const ACR_Byte_t*)entry->m_String.m_Buffer.m_Pointer, entry->m_String.m_Buffer.m_Length,
+		ACR_MAX_COUNT, ACR_INFO_NO) == ACR_INFO_EQUAL;
+}
+
+/** find a string in the slots
+    \returns the entry or ACR_NULL with the free slot in
+	         (*slot)
+*/
+static ACR_StringInternEntry_t* ACR_StringInternFind(
+	ACR_StringInternTable_t* table,
+	ACR_StringInternSlots_t* slots,
+	ACR_String_t src,
+	unsigned long hash,
+	ACR_Info_t caseSensitive,
+	ACR_Count_t* slot)
+{
+	ACR_StringInternEntry_t* entry;
+	ACR_Count_t mask = slots->m_Capacity - 1;
+	ACR_Count_t pos = (ACR_Count_t)hash & mask;
+	ACR_Count_t probes = 1;
+	while(1)
+	{
+		entry = (ACR_StringInternEntry_t*)ACR_STRING_INTERN_LOAD(slots->m_Entries[pos]);
+		if((entry == ACR_NULL) || (ACR_StringInternMatch(entry, src, hash, caseSensitive) != 0))
+		{
+			break;
+		}
+		pos = (pos + 1) & mask;
+		probes++;
+	}
+	#if ACR_STRING_INTERN_LOOKUP_STATS == ACR_BOOL_TRUE
+	ACR_STRING_INTERN_ADD(table->m_Probes, probes);
+	#else
+	ACR_UNUSED(table);
+	ACR_UNUSED(probes);
+	#endif
+	(*slot) = pos;
+	return entry;
+}
+
+/** make the slots larger while the table is locked
+    \returns ACR_INFO_OK or ACR_INFO_ERROR
+*/
+static ACR_Info_t ACR_StringInternGrow(
+	ACR_StringInternTable_t* table)
+{
+	ACR_StringInternSlots_t* slots = table->m_Slots;
+	ACR_StringInternSlots_t* larger;
+	ACR_StringInternEntry_t* entry;
+	ACR_Count_t capacity = (slots == ACR_NULL) ? ACR_STRING_INTERN_MIN_CAPACITY : (slots->m_Capacity * 2);
+	ACR_Length_t length = sizeof(ACR_StringInternSlots_t) + ((ACR_Length_t)capacity * sizeof(ACR_StringInternEntry_t*));
+	ACR_Count_t i;
+	ACR_Count_t pos;
+
+	if((slots != ACR_NULL) && (capacity < slots->m_Capacity))
+	{
+		return ACR_INFO_ERROR;
+	}
+	larger = (ACR_StringInternSlots_t*)ACR_MALLOC(length);
+	if(larger == ACR_NULL)
+	{
+		return ACR_INFO_ERROR;
+	}
+	larger->m_Replaced = slots;
+	larger->m_Entries = (ACR_StringInternEntry_t**)(larger + 1);
+	larger->m_Capacity = capacity;
+	memset(larger->m_Entries, 0, (size_t)capacity * sizeof(ACR_StringInternEntry_t*));
+
+	if(slots != ACR_NULL)
+	{
+		for(i = 0; i < slots->m_Capacity; i++)
+		{
+			entry = slots->m_Entries[i];
+			if(entry != ACR_NULL)
+			{
+				pos = (ACR_Count_t)entry->m_Hash & (capacity - 1);
+				while(larger->m_Entries[pos] != ACR_NULL)
+				{
+					pos = (pos + 1) & (capacity - 1);
+				}
+				larger->m_Entries[pos] = entry;
+			}
+		}
+	}
+
+	// readers see the larger slots only after they are full
+	table->m_TableBytes += length;
+	ACR_STRING_INTERN_STORE(table->m_Slots, larger);
+	return ACR_INFO_OK;
+}
+
+/** copy a string into a new entry while the table is locked
+    \returns the entry or ACR_NULL
+*/
+static ACR_StringInternEntry_t* ACR_StringInternAdd(
+	ACR_StringInternTable_t* table,
+	ACR_String_t src,
+	unsigned long hash)
+{
+	ACR_StringInternBlock_t* block = table->m_Block;
+	ACR_StringInternEntry_t* entry;
+	ACR_Length_t header = ACR_STRING_INTERN_ROUND(sizeof(ACR_StringInternBlock_t));
+	ACR_Length_t length = ACR_STRING_INTERN_ROUND(sizeof(ACR_StringInternEntry_t) + src.m_Buffer.m_Length + 1);
+	ACR_Length_t blockLength;
+	ACR_Byte_t* bytes;
+
+	if(length < src.m_Buffer.m_Length)
+	{
+		return ACR_NULL;
+	}
+	if((block == ACR_NULL) || ((block->m_Length - block->m_Used) < length))
+	{
+		blockLength = (length > (ACR_STRING_INTERN_BLOCK_LENGTH - header)) ? (header + length) : ACR_STRING_INTERN_BLOCK_LENGTH;
+		block = (ACR_StringInternBlock_t*)ACR_MALLOC(blockLength);
+		if(block == ACR_NULL)
+		{
+			return ACR_NULL;
+		}
+		block->m_Previous = table->m_Block;
+		block->m_Used = header;
+		block->m_Length = blockLength;
+		table->m_Block = block;
+		table->m_ArenaBytes += blockLength;
+	}
+
+	entry = (ACR_StringInternEntry_t*)(((ACR_Byte_t*)block) + block->m_Used);
+	bytes = (ACR_Byte_t*)(entry + 1);
+	block->m_Used += length;
+	if(src.m_Buffer.m_Length > 0)
+	{
+		memcpy(bytes, src.m_Buffer.m_Pointer, (size_t)src.m_Buffer.m_Length);
+	}
+	bytes[src.m_Buffer.m_Length] = 0;
+	entry->m_String.m_Buffer.m_Pointer = bytes;
+	entry->m_String.m_Buffer.m_Length = src.m_Buffer.m_Length;
+	entry->m_String.m_Buffer.m_Flags = ACR_BUFFER_IS_REF;
+	entry->m_String.m_Count = src.m_Count;
+	entry->m_Hash = hash;
+	table->m_StringBytes += src.m_Buffer.m_Length;
+	return entry;
+}
+
+/** free the memory of a table
+*/
+static void ACR_StringInternFreeTable(
+	ACR_StringInternTable_t* table)
+{
+	ACR_StringInternSlots_t* slots;
+	ACR_StringInternBlock_t* block;
+
+	while(table->m_Slots != ACR_NULL)
+	{
+		slots = table->m_Slots;
+		table->m_Slots = slots->m_Replaced;
+		ACR_FREE(slots);
+	}
+	while(table->m_Block != ACR_NULL)
+	{
+		block = table->m_Block;
+		table->m_Block = block->m_Previous;
+		ACR_FREE(block);
+	}
+	table->m_Count = 0;
+	table->m_StringBytes = 0;
+	table->m_ArenaBytes = 0;
+	table->m_TableBytes = 0;
+	table->m_Lookups = 0;
+	table->m_Probes = 0;
+}
+
+#endif // #if ACR_HAS_MALLOC == ACR_BOOL_TRUE
+
+////////////////////////////////////////////////////////////
+//
+// PUBLIC FUNCTIONS
+//
+////////////////////////////////////////////////////////////
+
+/**********************************************************/
+ACR_String_t ACR_StringIntern(
+	ACR_String_t src,
+	ACR_Info_t caseSensitive)
+{
+	ACR_StringInternTable_t* table = (caseSensitive != ACR_INFO_NO) ? &g_ACRStringInternExact : &g_ACRStringInternFolded;
+	ACR_StringInternSlots_t* slots;
+	ACR_StringInternEntry_t* entry = ACR_NULL;
+	unsigned long hash;
+	ACR_Count_t slot = 0;
+	ACR_STRING(result);
+
+	#if ACR_HAS_MALLOC == ACR_BOOL_TRUE
+	if((src.m_Buffer.m_Pointer == ACR_NULL) && (src.m_Buffer.m_Length != 0))
+	{
+		return result;
+	}
+
+	hash = (caseSensitive != ACR_INFO_NO) ? ACR_StringInternHash((const ACR_Byte_t*)src.m_Buffer.m_Pointer, src.m_Buffer.m_Length) :
+	                                        ACR_StringInternHashFolded((const ACR_Byte_t*)src.m_Buffer.m_Pointer, src.m_Buffer.m_Length);
+	#if ACR_STRING_INTERN_LOOKUP_STATS == ACR_BOOL_TRUE
+	ACR_STRING_INTERN_ADD(table->m_Lookups, 1);
+	#endif
+
+	// most strings are already in the table so look without
+	// locking first
+	slots = (ACR_StringInternSlots_t*)ACR_STRING_INTERN_LOAD(table->m_Slots);
+	if(slots != ACR_NULL)
+	{
+		entry = ACR_StringInternFind(table, slots, src, hash, caseSensitive, &slot);
+	}
+
+	if(entry == ACR_NULL)
+	{
+		ACR_STRING_INTERN_LOCK(table->m_Lock);
+		// look again since another thread may have added it
+		// or replaced the slots
+		slots = table->m_Slots;
+		if(slots != ACR_NULL)
+		{
+			entry = ACR_StringInternFind(table, slots, src, hash, caseSensitive, &slot);
+		}
+		if(entry == ACR_NULL)
+		{
+			// keep the table at most half full so that probes
+			// stay short
+			if((slots == ACR_NULL) || ((table->m_Count + 1) > (slots->m_Capacity / 2)))
+			{
+				if(ACR_StringInternGrow(table) == ACR_INFO_OK)
+				{
+					slots = table->m_Slots;
+					ACR_StringInternFind(table, slots, src, hash, caseSensitive, &slot);
+				}
+				else
+				{
+					slots = ACR_NULL;
+				}
+			}
+			if(slots != ACR_NULL)
+			{
+				entry = ACR_StringInternAdd(table, src, hash);
+				if(entry != ACR_NULL)
+				{
+					// readers see the entry only after it is filled in
+					table->m_Count++;
+					ACR_STRING_INTERN_STORE(slots->m_Entries[slot], entry);
+				}
+			}
+		}
+		ACR_STRING_INTERN_UNLOCK(table->m_Lock);
+	}
+
+	if(entry != ACR_NULL)
+	{
+		result = entry->m_String;
+	}
+	#else
+	ACR_UNUSED(src);
+	ACR_UNUSED(table);
+	ACR_UNUSED(slots);
+	ACR_UNUSED(entry);
+	ACR_UNUSED(hash);
+	ACR_UNUSED(slot);
+	#endif
+	return result;
+}
+
+/**********************************************************/
+void ACR_StringInternGetStats(
+	ACR_Info_t caseSensitive,
+	ACR_StringInternStats_t* stats)
+{
+	ACR_StringInternTable_t* table = (caseSensitive != ACR_INFO_NO) ? &g_ACRStringInternExact : &g_ACRStringInternFolded;
+	ACR_StringInternSlots_t* slots;
+
+	if(stats == ACR_NULL)
+	{
+		return;
+	}
+
+	ACR_STRING_INTERN_LOCK(table->m_Lock);
+	slots = table->m_Slots;
+	stats->m_Count = table->m_Count;
+	stats->m_Capacity = (slots != ACR_NULL) ? slots->m_Capacity : 0;
+	stats->m_StringBytes = table->m_StringBytes;
+	stats->m_ArenaBytes = table->m_ArenaBytes;
+	stats->m_TableBytes = table->m_TableBytes;
+	stats->m_Lookups = table->m_Lookups;
+	stats->m_Probes = table->m_Probes;
+	ACR_STRING_INTERN_UNLOCK(table->m_Lock);
+}
+
+/**********************************************************/
+void ACR_StringInternFree(void)
+{
+	#if ACR_HAS_MALLOC == ACR_BOOL_TRUE
+	ACR_StringInternFreeTable(&g_ACRStringInternExact);
+	ACR_StringInternFreeTable(&g_ACRStringInternFolded);
+	#endif
+}
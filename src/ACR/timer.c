@@ -0,0 +1,80 @@
+/*
+
+    ********** DO NOT REMOVE THIS INFORMATION ************
+
+    ACR - A set of C functions in a git Repository
+    Copyright (C) 2018 - 2020 Adam C. Rosenberg
+
+    Please read LICENSE before using this code
+
+    Please read README.md for instructions on including
+    this code in your project and where to find examples
+
+    If you contribute to this code, Please add your name
+    and email address to the AUTHORS list below so that
+    we know who to thank!
+
+    AUTHORS
+
+    Adam Rosenberg <adam@sirspot.com>
+
+    LICENSE
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+    ******************************************************
+
+*/
+/** \file timer.c
+
+    the monotonic clock used to time benchmarks
+
+    this is kept out of public.c because clock_gettime() is
+    only declared when _POSIX_C_SOURCE is defined in strict
+    c99 mode, and that also changes which system macros the
+    rest of the library sees
+
+*/
+#ifndef _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 200112L
+#endif
+
+#include "ACR/public.h"
+
+////////////////////////////////////////////////////////////
+//
+// PUBLIC FUNCTIONS
+//
+////////////////////////////////////////////////////////////
+
+/**********************************************************/
+double ACR_TimerSeconds(void)
+{
+#if ACR_HAS_RTC == ACR_BOOL_TRUE
+	#if defined(CLOCK_MONOTONIC)
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return ((double)now.tv_sec) + (((double)now.tv_nsec) / 1000000000.0);
+	#elif defined(TIME_UTC)
+	struct timespec now;
+	timespec_get(&now, TIME_UTC);
+	return ((double)now.tv_sec) + (((double)now.tv_nsec) / 1000000000.0);
+	#else
+	return ((double)clock()) / ((double)CLOCKS_PER_SEC);
+	#endif
+#else
+	return 0;
+#endif
+}
@@ -0,0 +1,604 @@
+/*
+
+    ********** DO NOT REMOVE THIS INFORMATION ************
+
+    ACR - A set of C functions in a git Repository
+    Copyright (C) 2018 - 2020 Adam C. Rosenberg
+
+    Please read LICENSE before using this code
+
+    Please read README.md for instructions on including
+    this code in your project and where to find examples
+
+    If you contribute to this code, Please add your name
+    and email address to the AUTHORS list below so that
+    we know who to thank!
+
+    AUTHORS
+
+    Adam Rosenberg <adam@sirspot.com>
+
+    LICENSE
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+    ******************************************************
+
+*/
+/** \file unicodecase.c
+
+    unicode case mapping and case folding using compact
+    two stage lookup tables
+
+    The tables hold the simple (one character to one
+    character) mappings from UnicodeData.txt and the common
+    and simple (C and S) mappings from CaseFolding.txt for
+    Unicode 14.0.0. Characters at or above
+    ACR_UNICODE_CASE_LIMIT have no case mapping.
+
+    The tables are generated from the Unicode 14.0.0 data
+    in the unicodedata module of Python 3.11 by running
+    this from the root of the repository:
+
+        python3 tools/unicodecase.py
+
+*/
+#include "ACR/public.h"
+
+////////////////////////////////////////////////////////////
+//
+// PRIVATE DEFINES
+//
+////////////////////////////////////////////////////////////
+
+/** the number of characters in each block of the second
+    stage table
+*/
+#define ACR_UNICODE_CASE_BLOCK_BITS 6
+#define ACR_UNICODE_CASE_BLOCK_MASK ((1 << ACR_UNICODE_CASE_BLOCK_BITS) - 1)
+
+/** get the index into the delta tables for a character
+    that is less than ACR_UNICODE_CASE_LIMIT
+*/
+#define ACR_UNICODE_CASE_INDEX(u) g_ACRUnicodeCaseBlocks[(((ACR_Length_t)g_ACRUnicodeCasePages[(u) >> ACR_UNICODE_CASE_BLOCK_BITS]) << ACR_UNICODE_CASE_BLOCK_BITS) | ((u) & ACR_UNICODE_CASE_BLOCK_MASK)]
+
+////////////////////////////////////////////////////////////
+//
+// PRIVATE TABLES
+//
+////////////////////////////////////////////////////////////
+
+/** first stage: the block of g_ACRUnicodeCaseBlocks for
+    each 64 characters
+*/
+static const ACR_Byte_t g_ACRUnicodeCasePages[2048] =
+{
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,   0,   0,  11,  12,  13,
+     14,  15,  16,  17,  18,  19,  20,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,  21,  22,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  23,  24,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,  25,   0,   0,  26,  27,   0,  28,  28,  29,  28,  30,  31,  32,  33,
+      0,   0,   0,   0,  34,  35,  36,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,  37,  38,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+     39,  40,  28,  41,  42,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,  43,  44,   0,  45,  46,  47,  48,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  49,  50,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  51,  52,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+     53,  54,  55,  56,   0,  57,  58,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,  59,  60,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,  61,  62,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,  63,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,  64,  65,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0
+};
+
+/** second stage: the index into the delta tables for each
+    character, with blocks that are the same stored once
+*/
+static const ACR_Byte_t g_ACRUnicodeCaseBlocks[4224] =
+{
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+      1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   0,   0,   0,   0,   0,
+      0,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+      2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   3,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+      1,   1,   1,   1,   1,   1,   1,   0,   1,   1,   1,   1,   1,   1,   1,   0,
+      2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+      2,   2,   2,   2,   2,   2,   2,   0,   2,   2,   2,   2,   2,   2,   2,   4,
+      5,   6,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6,
+      5,   6,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6,
+      5,   6,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6,
+      7,   8,   5,   6,   5,   6,   5,   6,   0,   5,   6,   5,   6,   5,   6,   5,
+      6,   5,   6,   5,   6,   5,   6,   5,   6,   0,   5,   6,   5,   6,   5,   6,
+      5,   6,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6,
+      5,   6,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6,
+      5,   6,   5,   6,   5,   6,   5,   6,   9,   5,   6,   5,   6,   5,   6,  10,
+     11,  12,   5,   6,   5,   6,  13,   5,   6,  14,  14,   5,   6,   0,  15,  16,
+     17,   5,   6,  14,  18,  19,  20,  21,   5,   6,  22,   0,  20,  23,  24,  25,
+      5,   6,   5,   6,   5,   6,  26,   5,   6,  26,   0,   0,   5,   6,  26,   5,
+      6,  27,  27,   5,   6,   5,   6,  28,   5,   6,   0,   0,   5,   6,   0,  29,
+      0,   0,   0,   0,  30,  31,  32,  30,  31,  32,  30,  31,  32,   5,   6,   5,
+      6,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6,  33,   5,   6,
+      5,   6,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6,
+      0,  30,  31,  32,   5,   6,  34,  35,   5,   6,   5,   6,   5,   6,   5,   6,
+      5,   6,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6,
+      5,   6,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6,
+     36,   0,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6,
+      5,   6,   5,   6,   0,   0,   0,   0,   0,   0,  37,   5,   6,  38,  39,  40,
+     40,   5,   6,  41,  42,  43,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6,
+     44,  45,  46,  47,  48,   0,  49,  49,   0,  50,   0,  51,  52,   0,   0,   0,
+     49,  53,   0,  54,   0,  55,  56,   0,  57,  58,  56,  59,  60,   0,   0,  58,
+      0,  61,  62,   0,   0,  63,   0,   0,   0,   0,   0,   0,   0,  64,   0,   0,
+     65,   0,  66,  65,   0,   0,   0,  67,  65,  68,  69,  69,  70,   0,   0,   0,
+      0,   0,  71,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  72,  73,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,  74,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      5,   6,   5,   6,   0,   0,   5,   6,   0,   0,   0,  24,  24,  24,   0,  75,
+      0,   0,   0,   0,   0,   0,  76,   0,  77,  77,  77,   0,  78,   0,  79,  79,
+      0,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+      1,   1,   0,   1,   1,   1,   1,   1,   1,   1,   1,   1,  80,  81,  81,  81,
+      0,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+      2,   2,  82,   2,   2,   2,   2,   2,   2,   2,   2,   2,  83,  84,  84,  85,
+     86,  87,   0,   0,   0,  88,  89,  90,   5,   6,   5,   6,   5,   6,   5,   6,
+      5,   6,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6,
+     91,  92,  93,  94,  95,  96,   0,   5,   6,  97,   5,   6,   0,  36,  36,  36,
+     98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  98,  98,
+      1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+      1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+      2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+      2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+     99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,
+      5,   6,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6,
+      5,   6,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6,
+      5,   6,   0,   0,   0,   0,   0,   0,   0,   0,   5,   6,   5,   6,   5,   6,
+      5,   6,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6,
+      5,   6,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6,
+      5,   6,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6,
+    100,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6, 101,
+      5,   6,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6,
+      5,   6,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6,
+      5,   6,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6,
+      5,   6,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6,
+      5,   6,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6,
+      5,   6,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6,
+      0, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+    102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+    102, 102, 102, 102, 102, 102, 102,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104,   0, 104,   0,   0,   0,   0,   0, 104,   0,   0,
+    105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105,
+    105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105,
+    105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105,   0,   0, 105, 105, 105,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106,
+    106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106,
+    106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106,
+    106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106,
+    106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106,
+    107, 107, 107, 107, 107, 107,   0,   0, 108, 108, 108, 108, 108, 108,   0,   0,
+    109, 110, 111, 112, 112, 113, 114, 115, 116,   0,   0,   0,   0,   0,   0,   0,
+    117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117,
+    117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117,
+    117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117,   0,   0, 117, 117, 117,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0, 118,   0,   0,   0, 119,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 120,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      5,   6,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6,
+      5,   6,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6,
+      5,   6,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6,
+      5,   6,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6,
+      5,   6,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6,
+      5,   6,   5,   6,   5,   6,   0,   0,   0,   0,   0, 121,   0,   0, 122,   0,
+      5,   6,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6,
+      5,   6,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6,
+    123, 123, 123, 123, 123, 123, 123, 123, 124, 124, 124, 124, 124, 124, 124, 124,
+    123, 123, 123, 123, 123, 123,   0,   0, 124, 124, 124, 124, 124, 124,   0,   0,
+    123, 123, 123, 123, 123, 123, 123, 123, 124, 124, 124, 124, 124, 124, 124, 124,
+    123, 123, 123, 123, 123, 123, 123, 123, 124, 124, 124, 124, 124, 124, 124, 124,
+    123, 123, 123, 123, 123, 123,   0,   0, 124, 124, 124, 124, 124, 124,   0,   0,
+      0, 123,   0, 123,   0, 123,   0, 123,   0, 124,   0, 124,   0, 124,   0, 124,
+    123, 123, 123, 123, 123, 123, 123, 123, 124, 124, 124, 124, 124, 124, 124, 124,
+    125, 125, 126, 126, 126, 126, 127, 127, 128, 128, 129, 129, 130, 130,   0,   0,
+    123, 123, 123, 123, 123, 123, 123, 123, 124, 124, 124, 124, 124, 124, 124, 124,
+    123, 123, 123, 123, 123, 123, 123, 123, 124, 124, 124, 124, 124, 124, 124, 124,
+    123, 123, 123, 123, 123, 123, 123, 123, 124, 124, 124, 124, 124, 124, 124, 124,
+    123, 123,   0, 131,   0,   0,   0,   0, 124, 124, 132, 132, 133,   0, 134,   0,
+      0,   0,   0, 131,   0,   0,   0,   0, 135, 135, 135, 135, 133,   0,   0,   0,
+    123, 123,   0,   0,   0,   0,   0,   0, 124, 124, 136, 136,   0,   0,   0,   0,
+    123, 123,   0,   0,   0,  93,   0,   0, 124, 124, 137, 137,  97,   0,   0,   0,
+      0,   0,   0, 131,   0,   0,   0,   0, 138, 138, 139, 139, 133,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0, 140,   0,   0,   0, 141, 142,   0,   0,   0,   0,
+      0,   0, 143,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 144,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145,
+    146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+      0,   0,   0,   5,   6,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0, 147, 147, 147, 147, 147, 147, 147, 147, 147, 147,
+    147, 147, 147, 147, 147, 147, 147, 147, 147, 147, 147, 147, 147, 147, 147, 147,
+    148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148,
+    148, 148, 148, 148, 148, 148, 148, 148, 148, 148,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+    102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+    102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+      5,   6, 149, 150, 151, 152, 153,   5,   6,   5,   6,   5,   6, 154, 155, 156,
+    157,   0,   5,   6,   0,   5,   6,   0,   0,   0,   0,   0,   0,   0, 158, 158,
+      5,   6,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6,
+      5,   6,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6,
+      5,   6,   5,   6,   0,   0,   0,   0,   0,   0,   0,   5,   6,   5,   6,   0,
+      0,   0,   5,   6,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159,
+    159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159,
+    159, 159, 159, 159, 159, 159,   0, 159,   0,   0,   0,   0,   0, 159,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      5,   6,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6,
+      5,   6,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6,
+      5,   6,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      5,   6,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6,
+      5,   6,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6,
+      0,   0,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6,
+      5,   6,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6,
+      5,   6,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6,
+      5,   6,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   5,   6,   5,   6, 160,   5,   6,
+      5,   6,   5,   6,   5,   6,   5,   6,   0,   0,   0,   5,   6, 161,   0,   0,
+      5,   6,   5,   6, 162,   0,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6,
+      5,   6,   5,   6,   5,   6,   5,   6,   5,   6, 163, 164, 165, 166, 163,   0,
+    167, 168, 169, 170,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6,   5,   6,
+      5,   6,   5,   6, 171, 172, 173,   5,   6,   5,   6,   0,   0,   0,   0,   0,
+      5,   6,   0,   0,   0,   0,   5,   6,   5,   6,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   5,   6,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0, 174,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175,
+    175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175,
+    175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175,
+    175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175,
+    175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+      1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   0,   0,   0,   0,   0,
+      0,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+      2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+    176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+    176, 176, 176, 176, 176, 176, 176, 176, 177, 177, 177, 177, 177, 177, 177, 177,
+    177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+    177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+    176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+    176, 176, 176, 176,   0,   0,   0,   0, 177, 177, 177, 177, 177, 177, 177, 177,
+    177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+    177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    178, 178, 178, 178, 178, 178, 178, 178, 178, 178, 178,   0, 178, 178, 178, 178,
+    178, 178, 178, 178, 178, 178, 178, 178, 178, 178, 178,   0, 178, 178, 178, 178,
+    178, 178, 178,   0, 178, 178,   0, 179, 179, 179, 179, 179, 179, 179, 179, 179,
+    179, 179,   0, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179,
+    179, 179,   0, 179, 179, 179, 179, 179, 179, 179,   0, 179, 179,   0,   0,   0,
+     78,  78,  78,  78,  78,  78,  78,  78,  78,  78,  78,  78,  78,  78,  78,  78,
+     78,  78,  78,  78,  78,  78,  78,  78,  78,  78,  78,  78,  78,  78,  78,  78,
+     78,  78,  78,  78,  78,  78,  78,  78,  78,  78,  78,  78,  78,  78,  78,  78,
+     78,  78,  78,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+     83,  83,  83,  83,  83,  83,  83,  83,  83,  83,  83,  83,  83,  83,  83,  83,
+     83,  83,  83,  83,  83,  83,  83,  83,  83,  83,  83,  83,  83,  83,  83,  83,
+     83,  83,  83,  83,  83,  83,  83,  83,  83,  83,  83,  83,  83,  83,  83,  83,
+     83,  83,  83,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+      1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+      2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+      2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+      1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+      2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+      2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    180, 180, 180, 180, 180, 180, 180, 180, 180, 180, 180, 180, 180, 180, 180, 180,
+    180, 180, 180, 180, 180, 180, 180, 180, 180, 180, 180, 180, 180, 180, 180, 180,
+    180, 180, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181,
+    181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181,
+    181, 181, 181, 181,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0
+};
+
+/** the value to add to a character to get its lower-case
+    representation
+*/
+static const long g_ACRUnicodeLowerDelta[182] =
+{
+         0,     32,      0,      0,      0,      1,      0,   -199,      0,   -121,
+         0,      0,    210,    206,    205,     79,    202,    203,    207,      0,
+       211,    209,      0,    213,      0,    214,    218,    217,    219,      0,
+         2,      1,      0,      0,    -97,    -56,   -130,  10795,   -163,  10792,
+         0,   -195,     69,     71,      0,      0,      0,      0,      0,      0,
+         0,      0,      0,      0,      0,      0,      0,      0,      0,      0,
+         0,      0,      0,      0,      0,      0,      0,      0,      0,      0,
+         0,      0,      0,      0,      0,    116,     38,     37,     64,     63,
+         0,      0,      0,      0,      0,      8,      0,      0,      0,      0,
+         0,      0,      0,      0,      0,    -60,      0,     -7,     80,      0,
+        15,      0,     48,      0,   7264,      0,  38864,      8,      0,      0,
+         0,      0,      0,      0,      0,      0,      0,  -3008,      0,      0,
+         0,      0,  -7615,      0,     -8,      0,      0,      0,      0,      0,
+         0,      0,    -74,     -9,      0,    -86,   -100,   -112,   -128,   -126,
+     -7517,  -8383,  -8262,     28,      0,     16,      0,     26,      0, -10743,
+     -3814, -10727,      0,      0, -10780, -10749, -10783, -10782, -10815,      0,
+    -35332, -42280,      0, -42308, -42319, -42315, -42305, -42258, -42282, -42261,
+       928,    -48, -42307, -35384,      0,      0,     40,      0,     39,      0,
+        34,      0
+};
+
+/** the value to add to a character to get its upper-case
+    representation
+*/
+static const long g_ACRUnicodeUpperDelta[182] =
+{
+         0,      0,    -32,    743,    121,      0,     -1,      0,   -232,      0,
+      -300,    195,      0,      0,      0,      0,      0,      0,      0,     97,
+         0,      0,    163,      0,    130,      0,      0,      0,      0,     56,
+         0,     -1,     -2,    -79,      0,      0,      0,      0,      0,      0,
+     10815,      0,      0,      0,  10783,  10780,  10782,   -210,   -206,   -205,
+      -202,   -203,  42319,  42315,   -207,  42280,  42308,   -209,   -211,  10743,
+     42305,  10749,   -213,   -214,  10727,   -218,  42307,  42282,    -69,   -217,
+       -71,   -219,  42261,  42258,     84,      0,      0,      0,      0,      0,
+       -38,    -37,    -31,    -64,    -63,      0,    -62,    -57,    -47,    -54,
+        -8,    -86,    -80,      7,   -116,      0,    -96,      0,      0,    -80,
+         0,    -15,      0,    -48,      0,   3008,      0,      0,     -8,  -6254,
+     -6253,  -6244,  -6242,  -6243,  -6236,  -6181,  35266,      0,  35332,   3814,
+     35384,    -59,      0,      8,      0,     74,     86,    100,    128,    112,
+       126,      9,      0,      0,  -7205,      0,      0,      0,      0,      0,
+         0,      0,      0,      0,    -28,      0,    -16,      0,    -26,      0,
+         0,      0, -10795, -10792,      0,      0,      0,      0,      0,  -7264,
+         0,      0,     48,      0,      0,      0,      0,      0,      0,      0,
+         0,      0,      0,      0,   -928, -38864,      0,    -40,      0,    -39,
+         0,    -34
+};
+
+/** the value to add to a character to get its case folded
+    representation
+*/
+static const long g_ACRUnicodeFoldDelta[182] =
+{
+         0,     32,      0,    775,      0,      1,      0,      0,      0,   -121,
+      -268,      0,    210,    206,    205,     79,    202,    203,    207,      0,
+       211,    209,      0,    213,      0,    214,    218,    217,    219,      0,
+         2,      1,      0,      0,    -97,    -56,   -130,  10795,   -163,  10792,
+         0,   -195,     69,     71,      0,      0,      0,      0,      0,      0,
+         0,      0,      0,      0,      0,      0,      0,      0,      0,      0,
+         0,      0,      0,      0,      0,      0,      0,      0,      0,      0,
+         0,      0,      0,      0,    116,    116,     38,     37,     64,     63,
+         0,      0,      1,      0,      0,      8,    -30,    -25,    -15,    -22,
+         0,    -54,    -48,      0,      0,    -60,    -64,     -7,     80,      0,
+        15,      0,     48,      0,   7264,      0,      0,      0,     -8,  -6222,
+     -6221,  -6212,  -6210,  -6211,  -6204,  -6180,  35267,  -3008,      0,      0,
+         0,    -58,  -7615,      0,     -8,      0,      0,      0,      0,      0,
+         0,      0,    -74,     -9,  -7173,    -86,   -100,   -112,   -128,   -126,
+     -7517,  -8383,  -8262,     28,      0,     16,      0,     26,      0, -10743,
+     -3814, -10727,      0,      0, -10780, -10749, -10783, -10782, -10815,      0,
+    -35332, -42280,      0, -42308, -42319, -42315, -42305, -42258, -42282, -42261,
+       928,    -48, -42307, -35384,      0, -38864,     40,      0,     39,      0,
+        34,      0
+};
+
+////////////////////////////////////////////////////////////
+//
+// PUBLIC FUNCTIONS
+//
+////////////////////////////////////////////////////////////
+
+/**********************************************************/
+ACR_Unicode_t ACR_UnicodeToLower(
+	ACR_Unicode_t u)
+{
+	if(u < ACR_UNICODE_CASE_LIMIT)
+	{
+		u = (ACR_Unicode_t)((long)u + g_ACRUnicodeLowerDelta[ACR_UNICODE_CASE_INDEX(u)]);
+	}
+	return u;
+}
+
+/**********************************************************/
+ACR_Unicode_t ACR_UnicodeToUpper(
+	ACR_Unicode_t u)
+{
+	if(u < ACR_UNICODE_CASE_LIMIT)
+	{
+		u = (ACR_Unicode_t)((long)u + g_ACRUnicodeUpperDelta[ACR_UNICODE_CASE_INDEX(u)]);
+	}
+	return u;
+}
+
+/**********************************************************/
+ACR_Unicode_t ACR_UnicodeFold(
+	ACR_Unicode_t u)
+{
+	if(u < ACR_UNICODE_CASE_LIMIT)
+	{
+		u = (ACR_Unicode_t)((long)u + g_ACRUnicodeFoldDelta[ACR_UNICODE_CASE_INDEX(u)]);
+	}
+	return u;
+}
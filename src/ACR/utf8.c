@@ -0,0 +1,1257 @@
+/*
+
+    ********** DO NOT REMOVE THIS INFORMATION ************
+
+    ACR - A set of C functions in a git Repository
+    Copyright (C) 2018 - 2020 Adam C. Rosenberg
+
+    Please read LICENSE before using this code
+
+    Please read README.md for instructions on including
+    this code in your project and where to find examples
+
+    If you contribute to this code, Please add your name
+    and email address to the AUTHORS list below so that
+    we know who to thank!
+
+    AUTHORS
+
+    Adam Rosenberg <adam@sirspot.com>
+
+    LICENSE
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+    ******************************************************
+
+*/
+/** \file utf8.c
+
+    functions to check and convert UTF8 encoded data
+
+*/
+#include "ACR/utf8.h"
+
+////////////////////////////////////////////////////////////
+//
+// PRIVATE DEFINES
+//
+////////////////////////////////////////////////////////////
+
+/** check for a continuation byte [10xxxxxx]
+*/
+#define ACR_UTF8_IS_CONTINUATION(c) (((c) & 0xC0) == 0x80)
+
+/** a block with the high bit of every byte set
+*/
+#define ACR_UTF8_HIGH_BITS ((~((ACR_Block_t)0) / 0xFF) * 0x80)
+
+#if ACR_HAS_SSSE3 == ACR_BOOL_TRUE
+
+// error bits for the SIMD lookup tables. each table gives
+// the errors that are possible for one 4 bit part of a pair
+// of bytes, so an error is only found when all three tables
+// agree
+#define ACR_UTF8_TOO_SHORT      0x01
+#define ACR_UTF8_TOO_LONG       0x02
+#define ACR_UTF8_OVERLONG_3     0x04
+#define ACR_UTF8_TOO_LARGE      0x08
+#define ACR_UTF8_SURROGATE      0x10
+#define ACR_UTF8_OVERLONG_2     0x20
+#define ACR_UTF8_TOO_LARGE_1000 0x40
+#define ACR_UTF8_OVERLONG_4     0x40
+#define ACR_UTF8_TWO_CONTS      0x80
+#define ACR_UTF8_CARRY          (ACR_UTF8_TOO_SHORT | ACR_UTF8_TOO_LONG | ACR_UTF8_TWO_CONTS)
+
+/** errors by the high 4 bits of the first byte
+*/
+static const ACR_Byte_t g_ACRUtf8Byte1High[16] =
+{
+	// 0xxx ASCII
+	ACR_UTF8_TOO_LONG, ACR_UTF8_TOO_LONG, ACR_UTF8_TOO_LONG, ACR_UTF8_TOO_LONG,
+	ACR_UTF8_TOO_LONG, ACR_UTF8_TOO_LONG, ACR_UTF8_TOO_LONG, ACR_UTF8_TOO_LONG,
+	// 10xx continuation
+	ACR_UTF8_TWO_CONTS, ACR_UTF8_TWO_CONTS, ACR_UTF8_TWO_CONTS, ACR_UTF8_TWO_CONTS,
+	// 1100 two byte lead
+	ACR_UTF8_TOO_SHORT | ACR_UTF8_OVERLONG_2,
+	// 1101 two byte lead
+	ACR_UTF8_TOO_SHORT,
+	// 1110 three byte lead
+	ACR_UTF8_TOO_SHORT | ACR_UTF8_OVERLONG_3 | ACR_UTF8_SURROGATE,
+	// 1111 four byte lead
+	ACR_UTF8_TOO_SHORT | ACR_UTF8_TOO_LARGE | ACR_UTF8_TOO_LARGE_1000 | ACR_UTF8_OVERLONG_4
+};
+
+/** errors by the low 4 bits of the first byte
+*/
+static const ACR_Byte_t g_ACRUtf8Byte1Low[16] =
+{
+	// xxxx0000
+	ACR_UTF8_CARRY | ACR_UTF8_OVERLONG_3 | ACR_UTF8_OVERLONG_2 | ACR_UTF8_OVERLONG_4,
+	// xxxx0001
+	ACR_UTF8_CARRY | ACR_UTF8_OVERLONG_2,
+	// xxxx001x
+	ACR_UTF8_CARRY,
+	ACR_UTF8_CARRY,
+	// xxxx0100
+	ACR_UTF8_CARRY | ACR_UTF8_TOO_LARGE,
+	// xxxx0101 to xxxx1100
+	ACR_UTF8_CARRY | ACR_UTF8_TOO_LARGE | ACR_UTF8_TOO_LARGE_1000,
+	ACR_UTF8_CARRY | ACR_UTF8_TOO_LARGE | ACR_UTF8_TOO_LARGE_1000,
+	ACR_UTF8_CARRY | ACR_UTF8_TOO_LARGE | ACR_UTF8_TOO_LARGE_1000,
+	ACR_UTF8_CARRY | ACR_UTF8_TOO_LARGE | ACR_UTF8_TOO_LARGE_1000,
+	ACR_UTF8_CARRY | ACR_UTF8_TOO_LARGE | ACR_UTF8_TOO_LARGE_1000,
+	ACR_UTF8_CARRY | ACR_UTF8_TOO_LARGE | ACR_UTF8_TOO_LARGE_1000,
+	ACR_UTF8_CARRY | ACR_UTF8_TOO_LARGE | ACR_UTF8_TOO_LARGE_1000,
+	ACR_UTF8_CARRY | ACR_UTF8_TOO_LARGE | ACR_UTF8_TOO_LARGE_1000,
+	// xxxx1101
+	ACR_UTF8_CARRY | ACR_UTF8_TOO_LARGE | ACR_UTF8_TOO_LARGE_1000 | ACR_UTF8_SURROGATE,
+	// xxxx1110 to xxxx1111
+	ACR_UTF8_CARRY | ACR_UTF8_TOO_LARGE | ACR_UTF8_TOO_LARGE_1000,
+	ACR_UTF8_CARRY | ACR_UTF8_TOO_LARGE | ACR_UTF8_TOO_LARGE_1000
+};
+
+/** errors by the high 4 bits of the second byte
+*/
+static const ACR_Byte_t g_ACRUtf8Byte2High[16] =
+{
+	// 0xxx ASCII
+	ACR_UTF8_TOO_SHORT, ACR_UTF8_TOO_SHORT, ACR_UTF8_TOO_SHORT, ACR_UTF8_TOO_SHORT,
+	ACR_UTF8_TOO_SHORT, ACR_UTF8_TOO_SHORT, ACR_UTF8_TOO_SHORT, ACR_UTF8_TOO_SHORT,
+	// 1000
+	ACR_UTF8_TOO_LONG | ACR_UTF8_OVERLONG_2 | ACR_UTF8_TWO_CONTS | ACR_UTF8_OVERLONG_3 | ACR_UTF8_TOO_LARGE_1000 | ACR_UTF8_OVERLONG_4,
+	// 1001
+	ACR_UTF8_TOO_LONG | ACR_UTF8_OVERLONG_2 | ACR_UTF8_TWO_CONTS | ACR_UTF8_OVERLONG_3 | ACR_UTF8_TOO_LARGE,
+	// 101x
+	ACR_UTF8_TOO_LONG | ACR_UTF8_OVERLONG_2 | ACR_UTF8_TWO_CONTS | ACR_UTF8_SURROGATE | ACR_UTF8_TOO_LARGE,
+	ACR_UTF8_TOO_LONG | ACR_UTF8_OVERLONG_2 | ACR_UTF8_TWO_CONTS | ACR_UTF8_SURROGATE | ACR_UTF8_TOO_LARGE,
+	// 11xx
+	ACR_UTF8_TOO_SHORT, ACR_UTF8_TOO_SHORT, ACR_UTF8_TOO_SHORT, ACR_UTF8_TOO_SHORT
+};
+
+/** the max value of each of the last 3 bytes of a block
+    that does not start a sequence needing the next block
+*/
+static const ACR_Byte_t g_ACRUtf8IncompleteMax[16] =
+{
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xDF, 0xBF
+};
+
+#endif // #if ACR_HAS_SSSE3 == ACR_BOOL_TRUE
+
+////////////////////////////////////////////////////////////
+//
+// PRIVATE FUNCTIONS - VALIDATION
+//
+////////////////////////////////////////////////////////////
+
+/** check one UTF8 sequence
+	\param src the first byte of the sequence
+	\param remaining the number of bytes available at src
+	\param length location to store the length of the valid sequence
+	       or the length of the maximal invalid part
+	\returns ACR_INFO_VALID or ACR_INFO_INVALID
+*/
+static ACR_Info_t ACR_Utf8CheckSequence(
+	const ACR_Byte_t* src,
+	ACR_Length_t remaining,
+	ACR_Length_t* length)
+{
+	ACR_Byte_t c = src[0];
+	ACR_Byte_t lower = 0x80;
+	ACR_Byte_t upper = 0xBF;
+	ACR_Length_t needed;
+	ACR_Length_t i;
+
+	(*length) = 1;
+	if(c < 0x80)
+	{
+		return ACR_INFO_VALID;
+	}
+	else if(c < 0xC2)
+	{
+		// continuation byte or overlong 2 byte lead
+		return ACR_INFO_INVALID;
+	}
+	else if(c < 0xE0)
+	{
+		needed = 2;
+	}
+	else if(c < 0xF0)
+	{
+		needed = 3;
+		if(c == 0xE0)
+		{
+			// overlong
+			lower = 0xA0;
+		}
+		else if(c == 0xED)
+		{
+			// surrogate
+			upper = 0x9F;
+		}
+	}
+	else if(c < 0xF5)
+	{
+		needed = 4;
+		if(c == 0xF0)
+		{
+			// overlong
+			lower = 0x90;
+		}
+		else if(c == 0xF4)
+		{
+			// above U+10FFFF
+			upper = 0x8F;
+		}
+	}
+	else
+	{
+		return ACR_INFO_INVALID;
+	}
+
+	// the second byte has a special range and
+	// the rest are any continuation byte
+	for(i = 1; i < needed; i++)
+	{
+		if((i >= remaining) || (src[i] < lower) || (src[i] > upper))
+		{
+			return ACR_INFO_INVALID;
+		}
+		lower = 0x80;
+		upper = 0xBF;
+		(*length) = i + 1;
+	}
+	return ACR_INFO_VALID;
+}
+
+/** get the number of ASCII bytes at the start of the data
+*/
+static ACR_Length_t ACR_Utf8AsciiLength(
+	const ACR_Byte_t* src,
+	ACR_Length_t length)
+{
+	ACR_Length_t pos = 0;
+	ACR_Block_t block;
+
+	#if ACR_HAS_SSE2 == ACR_BOOL_TRUE
+	while((length - pos) >= 32)
+	{
+		__m128i a = _mm_loadu_si128((const __m128i*)(src + pos));
+		__m128i b = _mm_loadu_si128((const __m128i*)(src + pos + 16));
+		if(_mm_movemask_epi8(_mm_or_si128(a, b)) != 0)
+		{
+			break;
+		}
+		pos += 32;
+	}
+	#endif // #if ACR_HAS_SSE2 == ACR_BOOL_TRUE
+
+	while((length - pos) >= ACR_BYTES_PER_BLOCK)
+	{
+		memcpy(&block, src + pos, ACR_BYTES_PER_BLOCK);
+		if((block & ACR_UTF8_HIGH_BITS) != 0)
+		{
+			break;
+		}
+		pos += ACR_BYTES_PER_BLOCK;
+	}
+
+	while((pos < length) && (src[pos] < 0x80))
+	{
+		pos++;
+	}
+	return pos;
+}
+
+/** check the data one character at a time after skipping
+    any runs of ASCII
+*/
+static ACR_Info_t ACR_Utf8ValidateScalar(
+	const ACR_Byte_t* src,
+	ACR_Length_t length,
+	ACR_Length_t* errorOffset)
+{
+	ACR_Length_t pos = 0;
+	ACR_Length_t sequenceLength;
+
+	while(pos < length)
+	{
+		if(src[pos] < 0x80)
+		{
+			pos += ACR_Utf8AsciiLength(src + pos, length - pos);
+			continue;
+		}
+		if(ACR_Utf8CheckSequence(src + pos, length - pos, &sequenceLength) != ACR_INFO_VALID)
+		{
+			(*errorOffset) = pos;
+			return ACR_INFO_INVALID;
+		}
+		pos += sequenceLength;
+	}
+	return ACR_INFO_VALID;
+}
+
+#if ACR_HAS_SSSE3 == ACR_BOOL_TRUE
+
+/** find errors in 16 bytes of data where prev is the previous
+    16 bytes. the result is not zero when there is an error
+	except for a sequence that is not finished by the end of
+	input, see ACR_Utf8SimdIncomplete()
+*/
+static __m128i ACR_Utf8SimdCheck(
+	__m128i input,
+	__m128i prev)
+{
+	__m128i nibbleMask = _mm_set1_epi8(0x0F);
+	__m128i prev1 = _mm_alignr_epi8(input, prev, 15);
+	__m128i prev2 = _mm_alignr_epi8(input, prev, 14);
+	__m128i prev3 = _mm_alignr_epi8(input, prev, 13);
+	__m128i byte1High = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)g_ACRUtf8Byte1High), _mm_and_si128(_mm_srli_epi16(prev1, 4), nibbleMask));
+	__m128i byte1Low = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)g_ACRUtf8Byte1Low), _mm_and_si128(prev1, nibbleMask));
+	__m128i byte2High = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)g_ACRUtf8Byte2High), _mm_and_si128(_mm_srli_epi16(input, 4), nibbleMask));
+	__m128i special = _mm_and_si128(_mm_and_si128(byte1High, byte1Low), byte2High);
+
+	// the third and fourth bytes of a sequence must be continuation
+	// bytes, which is marked by TWO_CONTS in special
+	__m128i isThird = _mm_subs_epu8(prev2, _mm_set1_epi8((char)(0xE0 - 0x80)));
+	__m128i isFourth = _mm_subs_epu8(prev3, _mm_set1_epi8((char)(0xF0 - 0x80)));
+	__m128i must23 = _mm_and_si128(_mm_or_si128(isThird, isFourth), _mm_set1_epi8((char)0x80));
+	return _mm_xor_si128(must23, special);
+}
+
+/** not zero when the last bytes of input start a sequence
+    that needs more bytes
+*/
+static __m128i ACR_Utf8SimdIncomplete(
+	__m128i input)
+{
+	return _mm_subs_epu8(input, _mm_loadu_si128((const __m128i*)g_ACRUtf8IncompleteMax));
+}
+
+/** check 64 bytes at a time
+	\returns the number of bytes that are known to be valid, which
+	         may end in the middle of a sequence
+*/
+static ACR_Length_t ACR_Utf8ValidateSimd(
+	const ACR_Byte_t* src,
+	ACR_Length_t length)
+{
+	__m128i zero = _mm_setzero_si128();
+	__m128i prev = zero;
+	__m128i prevIncomplete = zero;
+	__m128i error;
+	__m128i in[4];
+	ACR_Length_t pos = 0;
+	int i;
+
+	while((length - pos) >= 64)
+	{
+		in[0] = _mm_loadu_si128((const __m128i*)(src + pos));
+		in[1] = _mm_loadu_si128((const __m128i*)(src + pos + 16));
+		in[2] = _mm_loadu_si128((const __m128i*)(src + pos + 32));
+		in[3] = _mm_loadu_si128((const __m128i*)(src + pos + 48));
+		if(_mm_movemask_epi8(_mm_or_si128(_mm_or_si128(in[0], in[1]), _mm_or_si128(in[2], in[3]))) == 0)
+		{
+			// all ASCII so the only possible error is
+			// a sequence from the previous bytes that
+			// was not finished
+			error = prevIncomplete;
+			prevIncomplete = zero;
+		}
+		else
+		{
+			error = zero;
+			for(i = 0; i < 4; i++)
+			{
+				error = _mm_or_si128(error, ACR_Utf8SimdCheck(in[i], prev));
+				prev = in[i];
+			}
+			prevIncomplete = ACR_Utf8SimdIncomplete(in[3]);
+		}
+		if(_mm_movemask_epi8(_mm_cmpeq_epi8(error, zero)) != 0xFFFF)
+		{
+			break;
+		}
+		prev = in[3];
+		pos += 64;
+	}
+	return pos;
+}
+
+#endif // #if ACR_HAS_SSSE3 == ACR_BOOL_TRUE
+
+/** append data to a variable length buffer that grows as needed
+*/
+static ACR_Info_t ACR_Utf8Append(
+	ACR_VarBuffer_t* dst,
+	const void* src,
+	ACR_Length_t length)
+{
+	if(length == 0)
+	{
+		return ACR_INFO_OK;
+	}
+	if(ACR_VarBufferReserve(dst, dst->m_Buffer.m_Length + length) != ACR_INFO_OK)
+	{
+		return ACR_INFO_ERROR;
+	}
+	return ACR_VarBufferAppend(dst, (void*)src, length);
+}
+
+////////////////////////////////////////////////////////////
+//
+// PRIVATE FUNCTIONS - TRANSCODING
+//
+////////////////////////////////////////////////////////////
+
+/** count the characters in valid UTF8 data and the number
+    of those characters that are 4 bytes long, which need a
+    surrogate pair in UTF16
+*/
+static void ACR_Utf8Count(
+	const ACR_Byte_t* src,
+	ACR_Length_t length,
+	ACR_Length_t* characters,
+	ACR_Length_t* fourByte)
+{
+	ACR_Length_t pos = 0;
+	ACR_Length_t continuation = 0;
+	ACR_Length_t leads = 0;
+	ACR_Block_t block;
+
+	#if ACR_HAS_SSE2 == ACR_BOOL_TRUE
+	while((length - pos) >= 16)
+	{
+		__m128i v = _mm_loadu_si128((const __m128i*)(src + pos));
+		// continuation bytes 0x80 to 0xBF are the only signed
+		// values less than -64 and 4 byte leads 0xF0 to 0xF4
+		// are the only signed values from -16 to -1
+		continuation += (ACR_Length_t)ACR_BLOCK_POPCOUNT((ACR_Block_t)_mm_movemask_epi8(_mm_cmplt_epi8(v, _mm_set1_epi8(-64))));
+		leads += (ACR_Length_t)ACR_BLOCK_POPCOUNT((ACR_Block_t)_mm_movemask_epi8(_mm_and_si128(_mm_cmpgt_epi8(v, _mm_set1_epi8(-17)), _mm_cmplt_epi8(v, _mm_setzero_si128()))));
+		pos += 16;
+	}
+	#endif // #if ACR_HAS_SSE2 == ACR_BOOL_TRUE
+
+	while((length - pos) >= ACR_BYTES_PER_BLOCK)
+	{
+		memcpy(&block, src + pos, ACR_BYTES_PER_BLOCK);
+		// continuation bytes are 10xxxxxx and 4 byte leads
+		// are 1111xxxx
+		continuation += (ACR_Length_t)ACR_BLOCK_POPCOUNT(block & (~(block << 1)) & ACR_UTF8_HIGH_BITS);
+		leads += (ACR_Length_t)ACR_BLOCK_POPCOUNT(block & (block << 1) & (block << 2) & (block << 3) & ACR_UTF8_HIGH_BITS);
+		pos += ACR_BYTES_PER_BLOCK;
+	}
+
+	while(pos < length)
+	{
+		if(ACR_UTF8_IS_CONTINUATION(src[pos]))
+		{
+			continuation++;
+		}
+		else if(src[pos] >= 0xF0)
+		{
+			leads++;
+		}
+		pos++;
+	}
+
+	(*characters) = length - continuation;
+	(*fourByte) = leads;
+}
+
+/** the number of bytes needed to encode a character as UTF8
+*/
+#define ACR_UTF8_ENCODED_LENGTH(u) (((u) < 0x80) ? 1 : ((u) < 0x800) ? 2 : ((u) < 0x10000) ? 3 : 4)
+
+/** get the number of ASCII code units at the start of
+    UTF16LE (unitBytes 2) or UTF32LE (unitBytes 4) data
+*/
+static ACR_Length_t ACR_Utf8WideAsciiLength(
+	const ACR_Byte_t* src,
+	ACR_Length_t length,
+	ACR_Length_t unitBytes)
+{
+	ACR_Length_t pos = 0;
+	ACR_Length_t i;
+
+	#if ACR_HAS_SSE2 == ACR_BOOL_TRUE
+	// every byte except the first byte of each code unit must
+	// be 0 and the first byte must be less than 0x80
+	__m128i mask = (unitBytes == 2) ? _mm_set1_epi16((short)0xFF80) : _mm_set1_epi32((int)0xFFFFFF80);
+	while((length - pos) >= 16)
+	{
+		__m128i v = _mm_loadu_si128((const __m128i*)(src + pos));
+		if(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(v, mask), _mm_setzero_si128())) != 0xFFFF)
+		{
+			break;
+		}
+		pos += 16;
+	}
+	#endif // #if ACR_HAS_SSE2 == ACR_BOOL_TRUE
+
+	while((length - pos) >= unitBytes)
+	{
+		if(src[pos] >= 0x80)
+		{
+			break;
+		}
+		for(i = 1; i < unitBytes; i++)
+		{
+			if(src[pos + i] != 0)
+			{
+				return pos / unitBytes;
+			}
+		}
+		pos += unitBytes;
+	}
+	return pos / unitBytes;
+}
+
+/** read one character from UTF16LE data
+	\param src the data
+	\param length the number of bytes available at src
+	\param u location to store the character
+	\returns the number of bytes used or 0 if the data is not
+	         valid UTF16
+*/
+static ACR_Length_t ACR_Utf16Decode(
+	const ACR_Byte_t* src,
+	ACR_Length_t length,
+	ACR_Unicode_t* u)
+{
+	ACR_Unicode_t high;
+	ACR_Unicode_t low;
+
+	if(length < 2)
+	{
+		return 0;
+	}
+	high = ((ACR_Unicode_t)src[0]) | (((ACR_Unicode_t)src[1]) << 8);
+	if((high < 0xD800) || (high > 0xDFFF))
+	{
+		(*u) = high;
+		return 2;
+	}
+	if((high > 0xDBFF) || (length < 4))
+	{
+		// unpaired low surrogate or missing low surrogate
+		return 0;
+	}
+	low = ((ACR_Unicode_t)src[2]) | (((ACR_Unicode_t)src[3]) << 8);
+	if((low < 0xDC00) || (low > 0xDFFF))
+	{
+		return 0;
+	}
+	(*u) = 0x10000 + ((high - 0xD800) << 10) + (low - 0xDC00);
+	return 4;
+}
+
+/** read one character from UTF32LE data
+	\returns the number of bytes used or 0 if the data is not
+	         valid UTF32
+*/
+static ACR_Length_t ACR_Utf32Decode(
+	const ACR_Byte_t* src,
+	ACR_Length_t length,
+	ACR_Unicode_t* u)
+{
+	ACR_Unicode_t value;
+
+	if(length < 4)
+	{
+		return 0;
+	}
+	value = ((ACR_Unicode_t)src[0]) | (((ACR_Unicode_t)src[1]) << 8) | (((ACR_Unicode_t)src[2]) << 16) | (((ACR_Unicode_t)src[3]) << 24);
+	if((value > 0x10FFFF) || ((value >= 0xD800) && (value <= 0xDFFF)))
+	{
+		return 0;
+	}
+	(*u) = value;
+	return 4;
+}
+
+/** check UTF16LE (unitBytes 2) or UTF32LE (unitBytes 4) data
+    and get the number of bytes needed to encode it as UTF8
+*/
+static ACR_Info_t ACR_Utf8WideLength(
+	const ACR_Byte_t* src,
+	ACR_Length_t length,
+	ACR_Length_t unitBytes,
+	ACR_Length_t* utf8Length,
+	ACR_Length_t* errorOffset)
+{
+	ACR_Length_t pos = 0;
+	ACR_Length_t total = 0;
+	ACR_Length_t ascii;
+	ACR_Length_t used;
+	ACR_Unicode_t u = 0;
+
+	if((src == ACR_NULL) && (length > 0))
+	{
+		return ACR_INFO_ERROR;
+	}
+
+	while(pos < length)
+	{
+		// each ASCII code unit is one UTF8 byte
+		ascii = ACR_Utf8WideAsciiLength(src + pos, length - pos, unitBytes);
+		total += ascii;
+		pos += ascii * unitBytes;
+		if(pos == length)
+		{
+			break;
+		}
+
+		used = (unitBytes == 2) ? ACR_Utf16Decode(src + pos, length - pos, &u) : ACR_Utf32Decode(src + pos, length - pos, &u);
+		if(used == 0)
+		{
+			if(errorOffset != ACR_NULL)
+			{
+				(*errorOffset) = pos;
+			}
+			return ACR_INFO_INVALID;
+		}
+		total += ACR_UTF8_ENCODED_LENGTH(u);
+		pos += used;
+	}
+
+	(*utf8Length) = total;
+	return ACR_INFO_VALID;
+}
+
+/** convert UTF16LE (unitBytes 2) or UTF32LE (unitBytes 4)
+    data to UTF8 at the end of a variable length buffer
+*/
+static ACR_Info_t ACR_Utf8FromWide(
+	ACR_VarBuffer_t* dst,
+	const ACR_Byte_t* src,
+	ACR_Length_t length,
+	ACR_Length_t unitBytes,
+	ACR_Length_t* errorOffset)
+{
+	ACR_Length_t pos = 0;
+	ACR_Length_t utf8Length;
+	ACR_Length_t ascii;
+	ACR_Length_t i;
+	ACR_Byte_t* out;
+	ACR_Unicode_t u = 0;
+	ACR_Info_t result;
+
+	if(dst == ACR_NULL)
+	{
+		return ACR_INFO_ERROR;
+	}
+	result = ACR_Utf8WideLength(src, length, unitBytes, &utf8Length, errorOffset);
+	if(result != ACR_INFO_VALID)
+	{
+		return result;
+	}
+	if(ACR_VarBufferReserve(dst, dst->m_Buffer.m_Length + utf8Length) != ACR_INFO_OK)
+	{
+		return ACR_INFO_ERROR;
+	}
+
+	out = ((ACR_Byte_t*)dst->m_Buffer.m_Pointer) + dst->m_Buffer.m_Length;
+	while(pos < length)
+	{
+		ascii = ACR_Utf8WideAsciiLength(src + pos, length - pos, unitBytes);
+		i = 0;
+		#if ACR_HAS_SSE2 == ACR_BOOL_TRUE
+		// narrow 16 bytes of ASCII code units at a time
+		while((ascii - i) >= (16 / unitBytes))
+		{
+			__m128i v = _mm_loadu_si128((const __m128i*)(src + pos + (i * unitBytes)));
+			if(unitBytes == 4)
+			{
+				v = _mm_packs_epi32(v, v);
+			}
+			v = _mm_packus_epi16(v, v);
+			if(unitBytes == 2)
+			{
+				_mm_storel_epi64((__m128i*)out, v);
+			}
+			else
+			{
+				memcpy(out, &v, 4);
+			}
+			out += 16 / unitBytes;
+			i += 16 / unitBytes;
+		}
+		#endif // #if ACR_HAS_SSE2 == ACR_BOOL_TRUE
+		for(; i < ascii; i++)
+		{
+			(*out) = src[pos + (i * unitBytes)];
+			out++;
+		}
+		pos += ascii * unitBytes;
+		if(pos == length)
+		{
+			break;
+		}
+
+		// the data was already checked
+		pos += (unitBytes == 2) ? ACR_Utf16Decode(src + pos, length - pos, &u) : ACR_Utf32Decode(src + pos, length - pos, &u);
+		out += ACR_UnicodeToUtf8(u, out);
+	}
+
+	if(ACR_VarBufferAppend(dst, ACR_NULL, utf8Length) != ACR_INFO_OK)
+	{
+		return ACR_INFO_ERROR;
+	}
+	return ACR_INFO_VALID;
+}
+
+/** convert valid UTF8 data to UTF16LE (unitBytes 2) or
+    UTF32LE (unitBytes 4) at the end of a variable length
+	buffer
+*/
+static ACR_Info_t ACR_Utf8ToWide(
+	ACR_VarBuffer_t* dst,
+	const ACR_Byte_t* src,
+	ACR_Length_t length,
+	ACR_Length_t unitBytes,
+	ACR_Length_t* errorOffset)
+{
+	ACR_Length_t pos = 0;
+	ACR_Length_t wideLength;
+	ACR_Length_t characters;
+	ACR_Length_t fourByte;
+	ACR_Length_t ascii;
+	ACR_Length_t bytes;
+	ACR_Length_t i;
+	ACR_Byte_t* out;
+	ACR_Unicode_t u;
+	ACR_Info_t result;
+
+	if(dst == ACR_NULL)
+	{
+		return ACR_INFO_ERROR;
+	}
+	result = ACR_Utf8Validate(src, length, errorOffset);
+	if(result != ACR_INFO_VALID)
+	{
+		return result;
+	}
+	ACR_Utf8Count(src, length, &characters, &fourByte);
+	wideLength = (unitBytes == 2) ? ((characters + fourByte) * 2) : (characters * 4);
+	if(ACR_VarBufferReserve(dst, dst->m_Buffer.m_Length + wideLength) != ACR_INFO_OK)
+	{
+		return ACR_INFO_ERROR;
+	}
+
+	out = ((ACR_Byte_t*)dst->m_Buffer.m_Pointer) + dst->m_Buffer.m_Length;
+	while(pos < length)
+	{
+		ascii = ACR_Utf8AsciiLength(src + pos, length - pos);
+		i = 0;
+		#if ACR_HAS_SSE2 == ACR_BOOL_TRUE
+		// widen 16 ASCII bytes at a time
+		while((ascii - i) >= 16)
+		{
+			__m128i zero = _mm_setzero_si128();
+			__m128i v = _mm_loadu_si128((const __m128i*)(src + pos + i));
+			__m128i lo = _mm_unpacklo_epi8(v, zero);
+			__m128i hi = _mm_unpackhi_epi8(v, zero);
+			if(unitBytes == 2)
+			{
+				_mm_storeu_si128((__m128i*)out, lo);
+				_mm_storeu_si128((__m128i*)(out + 16), hi);
+			}
+			else
+			{
+				_mm_storeu_si128((__m128i*)out, _mm_unpacklo_epi16(lo, zero));
+				_mm_storeu_si128((__m128i*)(out + 16), _mm_unpackhi_epi16(lo, zero));
+				_mm_storeu_si128((__m128i*)(out + 32), _mm_unpacklo_epi16(hi, zero));
+				_mm_storeu_si128((__m128i*)(out + 48), _mm_unpackhi_epi16(hi, zero));
+			}
+			out += 16 * unitBytes;
+			i += 16;
+		}
+		#endif // #if ACR_HAS_SSE2 == ACR_BOOL_TRUE
+		for(; i < ascii; i++)
+		{
+			out[0] = src[pos + i];
+			out[1] = 0;
+			if(unitBytes == 4)
+			{
+				out[2] = 0;
+				out[3] = 0;
+			}
+			out += unitBytes;
+		}
+		pos += ascii;
+		if(pos == length)
+		{
+			break;
+		}
+
+		// the data was already checked
+		bytes = ACR_UTF8_BYTE_COUNT(src[pos]);
+		u = ACR_Utf8ToUnicode(src + pos, (int)bytes);
+		pos += bytes;
+		if(unitBytes == 4)
+		{
+			out[0] = (ACR_Byte_t)(u & 0xFF);
+			out[1] = (ACR_Byte_t)((u >> 8) & 0xFF);
+			out[2] = (ACR_Byte_t)(u >> 16);
+			out[3] = 0;
+			out += 4;
+		}
+		else
+		{
+			if(u >= 0x10000)
+			{
+				// high surrogate
+				u -= 0x10000;
+				out[0] = (ACR_Byte_t)((u >> 10) & 0xFF);
+				out[1] = (ACR_Byte_t)(0xD8 | (u >> 18));
+				out += 2;
+				u = 0xDC00 | (u & 0x3FF);
+			}
+			out[0] = (ACR_Byte_t)(u & 0xFF);
+			out[1] = (ACR_Byte_t)(u >> 8);
+			out += 2;
+		}
+	}
+
+	if(ACR_VarBufferAppend(dst, ACR_NULL, wideLength) != ACR_INFO_OK)
+	{
+		return ACR_INFO_ERROR;
+	}
+	return ACR_INFO_VALID;
+}
+
+////////////////////////////////////////////////////////////
+//
+// PRIVATE FUNCTIONS - STREAMING DECODER
+//
+////////////////////////////////////////////////////////////
+
+/** decoder states, which are multiplied by the number of
+    byte types so they can be added to a byte type to find
+	the next state in g_ACRUtf8DecoderStates
+*/
+#define ACR_UTF8_DECODER_ACCEPT 0
+#define ACR_UTF8_DECODER_REJECT 12
+
+/** the type of each byte, which is picked so that 0xFF
+    shifted right by the type is a mask for the bits of
+	the character in a first byte
+*/
+static const ACR_Byte_t g_ACRUtf8DecoderTypes[256] =
+{
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+	  9,   9,   9,   9,   9,   9,   9,   9,   9,   9,   9,   9,   9,   9,   9,   9,
+	  7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,
+	  7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,
+	  8,   8,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+	  2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+	 10,   3,   3,   3,   3,   3,   3,   3,   3,   3,   3,   3,   3,   4,   3,   3,
+	 11,   6,   6,   6,   5,   8,   8,   8,   8,   8,   8,   8,   8,   8,   8,   8
+};
+
+/** the next state for each state and byte type. the states
+    after the first byte are: need 1 more byte, need 2 more,
+	E0 needs A0 to BF, ED needs 80 to 9F, need 3 more, F0
+	needs 90 to BF, and F4 needs 80 to 8F
+*/
+static const ACR_Byte_t g_ACRUtf8DecoderStates[108] =
+{
+	  0,  12,  24,  36,  60,  96,  72,  12,  12,  12,  48,  84,
+	 12,  12,  12,  12,  12,  12,  12,  12,  12,  12,  12,  12,
+	 12,   0,  12,  12,  12,  12,  12,   0,  12,   0,  12,  12,
+	 12,  24,  12,  12,  12,  12,  12,  24,  12,  24,  12,  12,
+	 12,  12,  12,  12,  12,  12,  12,  24,  12,  12,  12,  12,
+	 12,  24,  12,  12,  12,  12,  12,  12,  12,  24,  12,  12,
+	 12,  36,  12,  12,  12,  12,  12,  36,  12,  36,  12,  12,
+	 12,  12,  12,  12,  12,  12,  12,  36,  12,  36,  12,  12,
+	 12,  36,  12,  12,  12,  12,  12,  12,  12,  12,  12,  12
+};
+
+/** move the decoder to the next state for one byte
+    without any branches
+*/
+#define ACR_UTF8_DECODER_STEP(state, codepoint, byte) \
+	{ \
+		ACR_Byte_t type = g_ACRUtf8DecoderTypes[(byte)]; \
+		(codepoint) = ((state) != ACR_UTF8_DECODER_ACCEPT) ? (((byte) & 0x3F) | ((codepoint) << 6)) : ((0xFF >> type) & (byte)); \
+		(state) = g_ACRUtf8DecoderStates[(state) + type]; \
+	}
+
+////////////////////////////////////////////////////////////
+//
+// PUBLIC FUNCTIONS
+//
+////////////////////////////////////////////////////////////
+
+/**********************************************************/
+ACR_Info_t ACR_Utf8Validate(
+	const ACR_Byte_t* src,
+	ACR_Length_t length,
+	ACR_Length_t* errorOffset)
+{
+	ACR_Length_t pos = 0;
+	ACR_Length_t offset;
+
+	if((src == ACR_NULL) && (length > 0))
+	{
+		return ACR_INFO_ERROR;
+	}
+
+	#if ACR_HAS_SSSE3 == ACR_BOOL_TRUE
+	pos = ACR_Utf8ValidateSimd(src, length);
+
+	// the SIMD check stops at a 64 byte boundary, which can be
+	// in the middle of a sequence, so go back to the start of
+	// the last sequence that could still need more bytes and
+	// check the rest one character at a time
+	offset = (pos > 3) ? (pos - 3) : 0;
+	while((offset < pos) && ACR_UTF8_IS_CONTINUATION(src[offset]))
+	{
+		offset++;
+	}
+	pos = offset;
+	#endif // #if ACR_HAS_SSSE3 == ACR_BOOL_TRUE
+
+	if(ACR_Utf8ValidateScalar(src + pos, length - pos, &offset) != ACR_INFO_VALID)
+	{
+		if(errorOffset != ACR_NULL)
+		{
+			(*errorOffset) = pos + offset;
+		}
+		return ACR_INFO_INVALID;
+	}
+	return ACR_INFO_VALID;
+}
+
+/**********************************************************/
+ACR_Info_t ACR_Utf8Sanitize(
+	ACR_VarBuffer_t* dst,
+	const ACR_Byte_t* src,
+	ACR_Length_t length,
+	ACR_Count_t* replacedCount)
+{
+	ACR_Length_t pos = 0;
+	ACR_Length_t errorOffset;
+	ACR_Length_t invalidLength;
+	ACR_Count_t count = 0;
+
+	if((dst == ACR_NULL) || ((src == ACR_NULL) && (length > 0)))
+	{
+		return ACR_INFO_ERROR;
+	}
+
+	while(pos < length)
+	{
+		if(ACR_Utf8Validate(src + pos, length - pos, &errorOffset) == ACR_INFO_VALID)
+		{
+			if(ACR_Utf8Append(dst, src + pos, length - pos) != ACR_INFO_OK)
+			{
+				return ACR_INFO_ERROR;
+			}
+			break;
+		}
+
+		// the valid part then a replacement for the invalid part
+		ACR_Utf8CheckSequence(src + pos + errorOffset, length - pos - errorOffset, &invalidLength);
+		if((ACR_Utf8Append(dst, src + pos, errorOffset) != ACR_INFO_OK) ||
+		   (ACR_Utf8Append(dst, ACR_UTF8_REPLACEMENT, ACR_UTF8_REPLACEMENT_LENGTH) != ACR_INFO_OK))
+		{
+			return ACR_INFO_ERROR;
+		}
+		count++;
+		pos += errorOffset + invalidLength;
+	}
+
+	if(replacedCount != ACR_NULL)
+	{
+		(*replacedCount) = count;
+	}
+	return ACR_INFO_OK;
+}
+
+/**********************************************************/
+ACR_Info_t ACR_Utf8ToUtf16Length(
+	const ACR_Byte_t* src,
+	ACR_Length_t length,
+	ACR_Length_t* utf16Length)
+{
+	ACR_Length_t characters;
+	ACR_Length_t fourByte;
+	ACR_Info_t result;
+
+	if(utf16Length == ACR_NULL)
+	{
+		return ACR_INFO_ERROR;
+	}
+	result = ACR_Utf8Validate(src, length, ACR_NULL);
+	if(result == ACR_INFO_VALID)
+	{
+		ACR_Utf8Count(src, length, &characters, &fourByte);
+		(*utf16Length) = (characters + fourByte) * 2;
+	}
+	return result;
+}
+
+/**********************************************************/
+ACR_Info_t ACR_Utf8ToUtf32Length(
+	const ACR_Byte_t* src,
+	ACR_Length_t length,
+	ACR_Length_t* utf32Length)
+{
+	ACR_Length_t characters;
+	ACR_Length_t fourByte;
+	ACR_Info_t result;
+
+	if(utf32Length == ACR_NULL)
+	{
+		return ACR_INFO_ERROR;
+	}
+	result = ACR_Utf8Validate(src, length, ACR_NULL);
+	if(result == ACR_INFO_VALID)
+	{
+		ACR_Utf8Count(src, length, &characters, &fourByte);
+		(*utf32Length) = characters * 4;
+	}
+	return result;
+}
+
+/**********************************************************/
+ACR_Info_t ACR_Utf16ToUtf8Length(
+	const ACR_Byte_t* src,
+	ACR_Length_t length,
+	ACR_Length_t* utf8Length)
+{
+	if(utf8Length == ACR_NULL)
+	{
+		return ACR_INFO_ERROR;
+	}
+	return ACR_Utf8WideLength(src, length, 2, utf8Length, ACR_NULL);
+}
+
+/**********************************************************/
+ACR_Info_t ACR_Utf32ToUtf8Length(
+	const ACR_Byte_t* src,
+	ACR_Length_t length,
+	ACR_Length_t* utf8Length)
+{
+	if(utf8Length == ACR_NULL)
+	{
+		return ACR_INFO_ERROR;
+	}
+	return ACR_Utf8WideLength(src, length, 4, utf8Length, ACR_NULL);
+}
+
+/**********************************************************/
+ACR_Info_t ACR_Utf8ToUtf16(
+	ACR_VarBuffer_t* dst,
+	const ACR_Byte_t* src,
+	ACR_Length_t length,
+	ACR_Length_t* errorOffset)
+{
+	return ACR_Utf8ToWide(dst, src, length, 2, errorOffset);
+}
+
+/**********************************************************/
+ACR_Info_t ACR_Utf8ToUtf32(
+	ACR_VarBuffer_t* dst,
+	const ACR_Byte_t* src,
+	ACR_Length_t length,
+	ACR_Length_t* errorOffset)
+{
+	return ACR_Utf8ToWide(dst, src, length, 4, errorOffset);
+}
+
+/**********************************************************/
+ACR_Info_t ACR_Utf16ToUtf8(
+	ACR_VarBuffer_t* dst,
+	const ACR_Byte_t* src,
+	ACR_Length_t length,
+	ACR_Length_t* errorOffset)
+{
+	return ACR_Utf8FromWide(dst, src, length, 2, errorOffset);
+}
+
+/**********************************************************/
+ACR_Info_t ACR_Utf32ToUtf8(
+	ACR_VarBuffer_t* dst,
+	const ACR_Byte_t* src,
+	ACR_Length_t length,
+	ACR_Length_t* errorOffset)
+{
+	return ACR_Utf8FromWide(dst, src, length, 4, errorOffset);
+}
+
+/**********************************************************/
+void ACR_Utf8DecoderInit(
+	ACR_Utf8Decoder_t* me)
+{
+	if(me == ACR_NULL)
+	{
+		return;
+	}
+
+	me->m_Codepoint = 0;
+	me->m_ErrorCount = 0;
+	me->m_State = ACR_UTF8_DECODER_ACCEPT;
+}
+
+/**********************************************************/
+ACR_Length_t ACR_Utf8DecoderDecode(
+	ACR_Utf8Decoder_t* me,
+	const ACR_Byte_t* src,
+	ACR_Length_t length,
+	ACR_Unicode_t* dst,
+	ACR_Count_t dstCount,
+	ACR_Count_t* decodedCount)
+{
+	ACR_Length_t pos = 0;
+	ACR_Count_t count = 0;
+	ACR_Unicode_t codepoint;
+	ACR_Byte_t state;
+	ACR_Byte_t prevState;
+
+	if((me == ACR_NULL) || (src == ACR_NULL) || (dst == ACR_NULL))
+	{
+		if(decodedCount != ACR_NULL)
+		{
+			(*decodedCount) = 0;
+		}
+		return 0;
+	}
+
+	codepoint = me->m_Codepoint;
+	state = me->m_State;
+	while((pos < length) && (count < dstCount))
+	{
+		prevState = state;
+		ACR_UTF8_DECODER_STEP(state, codepoint, src[pos]);
+		if(state == ACR_UTF8_DECODER_ACCEPT)
+		{
+			dst[count] = codepoint;
+			count++;
+		}
+		else if(state == ACR_UTF8_DECODER_REJECT)
+		{
+			// replace the invalid part and start again. a byte
+			// that ended an unfinished sequence is checked again
+			// since it could be the start of the next character
+			dst[count] = ACR_UNICODE_REPLACEMENT;
+			count++;
+			me->m_ErrorCount++;
+			state = ACR_UTF8_DECODER_ACCEPT;
+			if(prevState != ACR_UTF8_DECODER_ACCEPT)
+			{
+				continue;
+			}
+		}
+		pos++;
+	}
+	me->m_Codepoint = codepoint;
+	me->m_State = state;
+
+	if(decodedCount != ACR_NULL)
+	{
+		(*decodedCount) = count;
+	}
+	return pos;
+}
+
+/**********************************************************/
+ACR_Count_t ACR_Utf8DecoderCount(
+	ACR_Utf8Decoder_t* me,
+	const ACR_Byte_t* src,
+	ACR_Length_t length)
+{
+	ACR_Length_t pos = 0;
+	ACR_Length_t ascii;
+	ACR_Count_t count = 0;
+	ACR_Unicode_t codepoint;
+	ACR_Byte_t state;
+	ACR_Byte_t prevState;
+
+	if((me == ACR_NULL) || (src == ACR_NULL))
+	{
+		return 0;
+	}
+
+	codepoint = me->m_Codepoint;
+	state = me->m_State;
+	while(pos < length)
+	{
+		if((state == ACR_UTF8_DECODER_ACCEPT) && (src[pos] < 0x80))
+		{
+			// skip the run of ASCII
+			ascii = ACR_Utf8AsciiLength(src + pos, length - pos);
+			count += (ACR_Count_t)ascii;
+			pos += ascii;
+			continue;
+		}
+		prevState = state;
+		ACR_UTF8_DECODER_STEP(state, codepoint, src[pos]);
+		count += (state == ACR_UTF8_DECODER_ACCEPT);
+		if(state == ACR_UTF8_DECODER_REJECT)
+		{
+			// count a replacement, see ACR_Utf8DecoderDecode()
+			count++;
+			me->m_ErrorCount++;
+			state = ACR_UTF8_DECODER_ACCEPT;
+			if(prevState != ACR_UTF8_DECODER_ACCEPT)
+			{
+				continue;
+			}
+		}
+		pos++;
+	}
+	me->m_Codepoint = codepoint;
+	me->m_State = state;
+
+	return count;
+}
+
+/**********************************************************/
+ACR_Count_t ACR_Utf8DecoderFinish(
+	ACR_Utf8Decoder_t* me,
+	ACR_Unicode_t* dst)
+{
+	if(me == ACR_NULL)
+	{
+		return 0;
+	}
+
+	me->m_Codepoint = 0;
+	if(me->m_State != ACR_UTF8_DECODER_ACCEPT)
+	{
+		// the data ended in the middle of a character
+		me->m_State = ACR_UTF8_DECODER_ACCEPT;
+		me->m_ErrorCount++;
+		if(dst != ACR_NULL)
+		{
+			(*dst) = ACR_UNICODE_REPLACEMENT;
+		}
+		return 1;
+	}
+	return 0;
+}
@@ -148,6 +148,49 @@ ACR_Info_t ACR_VarBufferAllocate(
 	return ACR_INFO_ERROR;
 }
 
+/**********************************************************/
+ACR_Info_t ACR_VarBufferReserve(
+	ACR_VarBuffer_t* me,
+	ACR_Length_t length)
+{
+	if(me == ACR_NULL)
+	{
+		return ACR_INFO_ERROR;
+	}
+
+	if(length <= me->m_MaxLength)
+	{
+		return ACR_INFO_OK;
+	}
+
+	#if ACR_HAS_MALLOC == ACR_BOOL_TRUE
+	{
+		ACR_BUFFER(newBuffer);
+		ACR_Length_t newMaxLength = me->m_MaxLength * 2;
+		if(newMaxLength < length)
+		{
+			newMaxLength = length;
+		}
+		ACR_BUFFER_ALLOC(newBuffer, newMaxLength);
+		if(ACR_BUFFER_IS_VALID(newBuffer) == ACR_BOOL_FALSE)
+		{
+			return ACR_INFO_ERROR;
+		}
+		if(me->m_Buffer.m_Length > 0)
+		{
+			memcpy(newBuffer.m_Pointer, me->m_Buffer.m_Pointer, (size_t)me->m_Buffer.m_Length);
+		}
+		newBuffer.m_Length = me->m_Buffer.m_Length;
+		ACR_BUFFER_FREE(me->m_Buffer);
+		me->m_Buffer = newBuffer;
+		me->m_MaxLength = newMaxLength;
+		return ACR_INFO_OK;
+	}
+	#else
+	return ACR_INFO_ERROR;
+	#endif
+}
+
 /**********************************************************/
 ACR_Info_t ACR_VarBufferRef(
 	ACR_VarBuffer_t* me,
@@ -0,0 +1,244 @@
+#!/usr/bin/env python3
+#
+#    ********** DO NOT REMOVE THIS INFORMATION ************
+#
+#    ACR - A set of C functions in a git Repository
+#    Copyright (C) 2018 - 2020 Adam C. Rosenberg
+#
+#    Please read LICENSE before using this code
+#
+#    Please read README.md for instructions on including
+#    this code in your project and where to find examples
+#
+#    If you contribute to this code, Please add your name
+#    and email address to the AUTHORS list below so that
+#    we know who to thank!
+#
+#    AUTHORS
+#
+#    Adam Rosenberg <adam@sirspot.com>
+#
+#    LICENSE
+#
+#    This program is free software: you can redistribute it and/or modify
+#    it under the terms of the GNU General Public License as published by
+#    the Free Software Foundation, either version 3 of the License, or
+#    (at your option) any later version.
+#
+#    This program is distributed in the hope that it will be useful,
+#    but WITHOUT ANY WARRANTY; without even the implied warranty of
+#    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#    GNU General Public License for more details.
+#
+#    You should have received a copy of the GNU General Public License
+#    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+#
+#
+#    ******************************************************
+#
+#
+# tools/normalize.py
+#
+# writes the normalization tables in src/ACR/normalize.c
+#
+# The source data is the Unicode Character Database that is
+# built into the unicodedata module of Python, which is
+# Unicode 14.0.0 for Python 3.11. The decompositions and
+# combining classes come from unicodedata.decomposition()
+# and unicodedata.combining(), and unicodedata.normalize()
+# decides which compositions are excluded and which
+# characters fail the NFC quick check.
+#
+# usage, from the root of the repository:
+#
+#     python3 tools/normalize.py
+#
+# only the PRIVATE TABLES section of normalize.c is
+# replaced, so the rest of the file can be edited by hand
+import os
+import sys
+import unicodedata
+
+UNICODE_VERSION = '14.0.0'
+
+# must match ACR_NORMALIZE_LIMIT in normalize.c
+LIMIT = 0x30000
+
+# must match ACR_NORMALIZE_BLOCK_BITS in normalize.c
+BLOCK = 64
+
+# must match the quick check flags in normalize.c
+NFC_NO = 0x01
+NFC_MAYBE = 0x02
+NFD_NO = 0x04
+
+# must match ACR_NORMALIZE_NFC_FIRST_BYTE and
+# ACR_NORMALIZE_NFD_FIRST_BYTE in normalize.c
+NFC_FIRST_BYTE = 0xCC
+NFD_FIRST_BYTE = 0xC3
+
+# hangul syllables and jamo are handled by calculation
+HANGUL_S_BASE = 0xAC00
+HANGUL_S_END = 0xD7A4
+HANGUL_V = range(0x1161, 0x1176)
+HANGUL_T = range(0x11A8, 0x11C3)
+
+TARGET = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'src', 'ACR', 'normalize.c')
+BANNER = '/' * 60 + '\n'
+TABLES_START = BANNER + '//\n// PRIVATE TABLES\n//\n' + BANNER + '\n'
+TABLES_END = BANNER + '//\n'
+
+def is_surrogate(c):
+	return 0xD800 <= c < 0xE000
+
+def canonical_decomposition(c):
+	d = unicodedata.decomposition(chr(c))
+	if not d or d.startswith('<'):
+		return None
+	return [int(x, 16) for x in d.split()]
+
+def full_decomposition(c):
+	d = canonical_decomposition(c)
+	if d is None:
+		return [c]
+	out = []
+	for x in d:
+		out += full_decomposition(x)
+	return out
+
+def build():
+	decompositions = {}
+	pairs = {}
+	for c in range(0x110000):
+		if HANGUL_S_BASE <= c < HANGUL_S_END:
+			continue
+		d = canonical_decomposition(c)
+		if d is None:
+			continue
+		if c >= LIMIT:
+			sys.exit('U+%04X has a decomposition but is not less than LIMIT' % c)
+		decompositions[c] = full_decomposition(c)
+		# a pair that does not survive NFC is a composition exclusion
+		if len(d) == 2 and unicodedata.normalize('NFC', chr(c)) == chr(c):
+			pairs[(d[0], d[1])] = c
+
+	seconds = sorted(set(b for a, b in pairs))
+	secondIndex = {b: i for i, b in enumerate(seconds)}
+	nfcNo = set()
+	for c in range(0x110000):
+		if not is_surrogate(c) and unicodedata.normalize('NFC', chr(c)) != chr(c):
+			nfcNo.add(c)
+	nfcMaybe = set(seconds) | set(HANGUL_V) | set(HANGUL_T)
+	nfdNo = set(decompositions) | set(range(HANGUL_S_BASE, HANGUL_S_END))
+	for c in range(LIMIT, 0x110000):
+		if not is_surrogate(c) and unicodedata.combining(chr(c)) != 0:
+			sys.exit('U+%04X has a combining class but is not less than LIMIT' % c)
+	if chr(min(nfcNo | nfcMaybe)).encode()[0] != NFC_FIRST_BYTE:
+		sys.exit('NFC_FIRST_BYTE is wrong')
+	if chr(min(nfdNo)).encode()[0] != NFD_FIRST_BYTE:
+		sys.exit('NFD_FIRST_BYTE is wrong')
+
+	records = {(0, 0, 0): 0}
+	recordList = [(0, 0, 0)]
+	rows = []
+	for c in range(LIMIT):
+		flags = 0
+		if c in nfcNo:
+			flags |= NFC_NO
+		if c in nfcMaybe:
+			flags |= NFC_MAYBE
+		if c in nfdNo:
+			flags |= NFD_NO
+		combining = 0 if is_surrogate(c) else unicodedata.combining(chr(c))
+		record = (combining, flags, secondIndex[c] + 1 if c in secondIndex else 0)
+		if record not in records:
+			records[record] = len(recordList)
+			recordList.append(record)
+		rows.append(records[record])
+
+	data = [0]
+	offsets = {}
+	for c in sorted(decompositions):
+		utf8 = ''.join(map(chr, decompositions[c])).encode()
+		offsets[c] = len(data)
+		data.append(len(utf8))
+		data += list(utf8)
+	decompositionRows = [offsets.get(c, 0) for c in range(LIMIT)]
+
+	if len(recordList) > 256 or len(seconds) + 1 > 256 or len(seconds) > 64:
+		sys.exit('the property tables no longer fit')
+	if len(data) > 0x10000:
+		sys.exit('the decomposition data no longer fits in unsigned short')
+	return rows, recordList, decompositionRows, data, pairs, secondIndex
+
+def two_stage(rows):
+	blocks = {}
+	blockList = []
+	pages = []
+	for i in range(0, LIMIT, BLOCK):
+		block = tuple(rows[i:i + BLOCK])
+		if block not in blocks:
+			blocks[block] = len(blockList)
+			blockList.append(block)
+		pages.append(blocks[block])
+	if len(blockList) > 256:
+		sys.exit('the first stage no longer fits in ACR_Byte_t')
+	return pages, blockList
+
+def fmt(values, perLine, width):
+	lines = []
+	for i in range(0, len(values), perLine):
+		lines.append('\t' + ', '.join(('%' + str(width) + 's') % v for v in values[i:i + perLine]) + ',')
+	lines[-1] = lines[-1][:-1]
+	return '\n'.join(lines)
+
+def table(doc, declaration, values, perLine, width):
+	return '%s\nstatic const %s[%d] =\n{\n%s\n};\n' % (doc, declaration, len(values), fmt(values, perLine, width))
+
+def tables():
+	rows, recordList, decompositionRows, data, pairs, secondIndex = build()
+	pages, blockList = two_stage(rows)
+	decompositionPages, decompositionBlockList = two_stage(decompositionRows)
+	keys = sorted(pairs)
+	out = []
+	out.append(table('''/** first stage: the block of g_ACRNormalizeBlocks for
+    each %d characters
+*/''' % BLOCK, 'ACR_Byte_t g_ACRNormalizePages', pages, 16, 3))
+	out.append(table('''/** second stage: the index into the property tables for
+    each character, with blocks that are the same stored once
+*/''', 'ACR_Byte_t g_ACRNormalizeBlocks', [v for b in blockList for v in b], 16, 3))
+	out.append(table('''/** the canonical combining class of each property index
+*/''', 'ACR_Byte_t g_ACRNormalizeCombiningClass', [r[0] for r in recordList], 16, 3))
+	out.append(table('''/** the quick check flags of each property index
+*/''', 'ACR_Byte_t g_ACRNormalizeFlags', [r[1] for r in recordList], 16, 3))
+	out.append(table('''/** 1 plus the index of each character that can be the
+    second character of a composition or 0
+*/''', 'ACR_Byte_t g_ACRNormalizeSecond', [r[2] for r in recordList], 16, 3))
+	out.append(table('''/** first stage: the block of g_ACRNormalizeDecompositionBlocks
+    for each %d characters
+*/''' % BLOCK, 'ACR_Byte_t g_ACRNormalizeDecompositionPages', decompositionPages, 16, 3))
+	out.append(table('''/** second stage: the offset of the decomposition of each
+    character in g_ACRNormalizeDecompositionData or 0
+*/''', 'unsigned short g_ACRNormalizeDecompositionBlocks', [v for b in decompositionBlockList for v in b], 12, 5))
+	out.append(table('''/** the full canonical decomposition of each character as
+    a length byte followed by that many bytes of UTF8
+*/''', 'ACR_Byte_t g_ACRNormalizeDecompositionData', ['0x%02X' % v for v in data], 12, 4))
+	out.append(table('''/** the first character of each composition multiplied by
+    64 plus the index of the second character, sorted
+*/''', 'unsigned long g_ACRNormalizeCompositionKeys', ['0x%06X' % ((a << 6) | secondIndex[b]) for a, b in keys], 8, 8))
+	out.append(table('''/** the composition of each key minus its first character
+*/''', 'short g_ACRNormalizeCompositionDeltas', [pairs[k] - k[0] for k in keys], 12, 5))
+	return '\n'.join(out) + '\n'
+
+def main():
+	if unicodedata.unidata_version != UNICODE_VERSION:
+		sys.exit('this Python has Unicode %s but the tables are for Unicode %s' % (unicodedata.unidata_version, UNICODE_VERSION))
+	with open(TARGET, newline='') as f:
+		source = f.read()
+	start = source.index(TABLES_START) + len(TABLES_START)
+	end = source.index(TABLES_END, start)
+	with open(TARGET, 'w', newline='') as f:
+		f.write(source[:start] + tables() + source[end:])
+
+if __name__ == '__main__':
+	main()
@@ -0,0 +1,186 @@
+#!/usr/bin/env python3
+#
+#    ********** DO NOT REMOVE THIS INFORMATION ************
+#
+#    ACR - A set of C functions in a git Repository
+#    Copyright (C) 2018 - 2020 Adam C. Rosenberg
+#
+#    Please read LICENSE before using this code
+#
+#    Please read README.md for instructions on including
+#    this code in your project and where to find examples
+#
+#    If you contribute to this code, Please add your name
+#    and email address to the AUTHORS list below so that
+#    we know who to thank!
+#
+#    AUTHORS
+#
+#    Adam Rosenberg <adam@sirspot.com>
+#
+#    LICENSE
+#
+#    This program is free software: you can redistribute it and/or modify
+#    it under the terms of the GNU General Public License as published by
+#    the Free Software Foundation, either version 3 of the License, or
+#    (at your option) any later version.
+#
+#    This program is distributed in the hope that it will be useful,
+#    but WITHOUT ANY WARRANTY; without even the implied warranty of
+#    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#    GNU General Public License for more details.
+#
+#    You should have received a copy of the GNU General Public License
+#    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+#
+#
+#    ******************************************************
+#
+#
+# tools/unicodecase.py
+#
+# writes the case mapping tables in src/ACR/unicodecase.c
+#
+# The source data is the Unicode Character Database that is
+# built into the unicodedata module of Python, which is
+# Unicode 14.0.0 for Python 3.11. The simple (one character
+# to one character) mappings are taken from str.lower(),
+# str.upper(), str.title() and str.casefold(), which give the
+# full mappings from UnicodeData.txt, SpecialCasing.txt and
+# CaseFolding.txt, by keeping the results that are a single
+# character.
+#
+# usage, from the root of the repository:
+#
+#     python3 tools/unicodecase.py
+#
+# only the PRIVATE TABLES section of unicodecase.c is
+# replaced, so the rest of the file can be edited by hand
+import os
+import sys
+import unicodedata
+
+UNICODE_VERSION = '14.0.0'
+
+# must match ACR_UNICODE_CASE_LIMIT in include/ACR/public.h
+LIMIT = 0x20000
+
+# must match ACR_UNICODE_CASE_BLOCK_BITS in unicodecase.c
+BLOCK = 64
+
+TARGET = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'src', 'ACR', 'unicodecase.c')
+BANNER = '/' * 60 + '\n'
+TABLES_START = BANNER + '//\n// PRIVATE TABLES\n//\n' + BANNER + '\n'
+TABLES_END = BANNER + '//\n// PUBLIC FUNCTIONS\n'
+
+def simple_lower(c):
+	l = chr(c).lower()
+	if len(l) == 1:
+		return ord(l)
+	# the only character with a full lower case mapping that
+	# is longer than its simple mapping
+	if c == 0x130:
+		return 0x69
+	return c
+
+def simple_upper(c):
+	u = chr(c).upper()
+	if len(u) == 1:
+		return ord(u)
+	# the simple upper case mapping of characters such as
+	# U+1F80 is the same as the title case mapping
+	t = chr(c).title()
+	if len(t) == 1:
+		return ord(t)
+	return c
+
+def simple_fold(c):
+	f = chr(c).casefold()
+	if len(f) == 1:
+		return ord(f)
+	# the simple (S) folding is the simple lower case mapping
+	# for every character that has a full (F) folding
+	l = chr(c).lower()
+	if len(l) == 1:
+		return ord(l)
+	return c
+
+def build():
+	records = {(0, 0, 0): 0}
+	recordList = [(0, 0, 0)]
+	rows = []
+	for c in range(0x110000):
+		if 0xD800 <= c < 0xE000:
+			record = (0, 0, 0)
+		else:
+			record = (simple_lower(c) - c, simple_upper(c) - c, simple_fold(c) - c)
+		if c >= LIMIT:
+			if record != (0, 0, 0):
+				sys.exit('U+%04X has a case mapping but is not less than LIMIT' % c)
+			continue
+		if record not in records:
+			records[record] = len(recordList)
+			recordList.append(record)
+		rows.append(records[record])
+	blocks = {}
+	blockList = []
+	pages = []
+	for i in range(0, LIMIT, BLOCK):
+		block = tuple(rows[i:i + BLOCK])
+		if block not in blocks:
+			blocks[block] = len(blockList)
+			blockList.append(block)
+		pages.append(blocks[block])
+	if len(blockList) > 256 or len(recordList) > 256:
+		sys.exit('the tables no longer fit in ACR_Byte_t')
+	return pages, blockList, recordList
+
+def fmt(values, perLine, width):
+	lines = []
+	for i in range(0, len(values), perLine):
+		lines.append('    ' + ', '.join(('%' + str(width) + 's') % v for v in values[i:i + perLine]) + ',')
+	lines[-1] = lines[-1][:-1]
+	return '\n'.join(lines)
+
+def tables():
+	pages, blockList, recordList = build()
+	out = []
+	out.append('''/** first stage: the block of g_ACRUnicodeCaseBlocks for
+    each %d characters
+*/
+static const ACR_Byte_t g_ACRUnicodeCasePages[%d] =
+{
+%s
+};
+''' % (BLOCK, len(pages), fmt(pages, 16, 3)))
+	out.append('''/** second stage: the index into the delta tables for each
+    character, with blocks that are the same stored once
+*/
+static const ACR_Byte_t g_ACRUnicodeCaseBlocks[%d] =
+{
+%s
+};
+''' % (len(blockList) * BLOCK, fmt([v for b in blockList for v in b], 16, 3)))
+	for name, k, desc in (('Lower', 0, 'lower-case'), ('Upper', 1, 'upper-case'), ('Fold', 2, 'case folded')):
+		out.append('''/** the value to add to a character to get its %s
+    representation
+*/
+static const long g_ACRUnicode%sDelta[%d] =
+{
+%s
+};
+''' % (desc, name, len(recordList), fmt([r[k] for r in recordList], 10, 6)))
+	return '\n'.join(out) + '\n'
+
+def main():
+	if unicodedata.unidata_version != UNICODE_VERSION:
+		sys.exit('this Python has Unicode %s but the tables are for Unicode %s' % (unicodedata.unidata_version, UNICODE_VERSION))
+	with open(TARGET, newline='') as f:
+		source = f.read()
+	start = source.index(TABLES_START) + len(TABLES_START)
+	end = source.index(TABLES_END, start)
+	with open(TARGET, 'w', newline='') as f:
+		f.write(source[:start] + tables() + source[end:])
+
+if __name__ == '__main__':
+	main()